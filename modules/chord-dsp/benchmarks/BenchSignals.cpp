@@ -0,0 +1,177 @@
+#include "BenchSignals.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace margelo::nitro::chorddsp::bench {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+double midiToHz(int note) {
+  return 440.0 * std::pow(2.0, (note - 69) / 12.0);
+}
+
+template <typename T>
+bool readValue(std::ifstream& in, T& value) {
+  return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+bool readWav(const std::filesystem::path& path, BenchSignal& signal) {
+  std::ifstream in(path, std::ios::binary);
+  char riff[4], wave[4];
+  uint32_t riffSize = 0;
+  if (!in.read(riff, 4) || !readValue(in, riffSize) || !in.read(wave, 4)) return false;
+  if (std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(wave, "WAVE", 4) != 0) return false;
+
+  uint16_t format = 0, channels = 0, bits = 0;
+  uint32_t rate = 0;
+  char id[4];
+  uint32_t size = 0;
+  while (in.read(id, 4) && readValue(in, size)) {
+    if (std::memcmp(id, "fmt ", 4) == 0) {
+      uint32_t byteRate = 0;
+      uint16_t blockAlign = 0;
+      readValue(in, format);
+      readValue(in, channels);
+      readValue(in, rate);
+      readValue(in, byteRate);
+      readValue(in, blockAlign);
+      readValue(in, bits);
+      in.seekg(size - 16, std::ios::cur);
+    } else if (std::memcmp(id, "data", 4) == 0) {
+      // WAVE_FORMAT_EXTENSIBLE (0xFFFE) is accepted by sample width alone
+      bool pcm16 = (format == 1 || format == 0xFFFE) && bits == 16;
+      bool float32 = (format == 3 || format == 0xFFFE) && bits == 32;
+      if (channels == 0 || rate == 0 || !(pcm16 || float32)) return false;
+
+      std::vector<char> data(size);
+      if (!in.read(data.data(), size)) return false;
+      size_t frames = size / (channels * (bits / 8));
+      signal.sampleRate = rate;
+      signal.samples.assign(frames, 0.0f);
+      for (size_t f = 0; f < frames; f++) {
+        float sum = 0.0f;
+        for (uint16_t c = 0; c < channels; c++) {
+          size_t offset = (f * channels + c) * (bits / 8);
+          if (pcm16) {
+            int16_t v;
+            std::memcpy(&v, data.data() + offset, 2);
+            sum += v / 32768.0f;
+          } else {
+            float v;
+            std::memcpy(&v, data.data() + offset, 4);
+            sum += v;
+          }
+        }
+        signal.samples[f] = sum / channels;
+      }
+      return true;
+    } else {
+      // Chunks are padded to an even size
+      in.seekg(size + (size & 1), std::ios::cur);
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+BenchSignal sineChords(double sampleRate, double seconds) {
+  // Root MIDI note and third (3 = minor, 4 = major) per chord
+  static const int kChords[4][2] = {{48, 4}, {57, 3}, {53, 4}, {55, 4}};
+  BenchSignal signal{"sine_chords", sampleRate, std::vector<float>(static_cast<size_t>(sampleRate * seconds))};
+  for (size_t i = 0; i < signal.samples.size(); i++) {
+    double t = i / sampleRate;
+    const int* chord = kChords[static_cast<int>(t) % 4];
+    int notes[4] = {chord[0] - 12, chord[0], chord[0] + chord[1], chord[0] + 7};
+    double v = 0.0;
+    for (int note : notes) v += 0.15 * std::sin(2.0 * kPi * midiToHz(note) * t);
+    signal.samples[i] = static_cast<float>(v);
+  }
+  return signal;
+}
+
+BenchSignal whiteNoise(double sampleRate, double seconds) {
+  BenchSignal signal{"white_noise", sampleRate, std::vector<float>(static_cast<size_t>(sampleRate * seconds))};
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(-0.316f, 0.316f);
+  for (float& v : signal.samples) v = dist(rng);
+  return signal;
+}
+
+BenchSignal pluckedGuitar(double sampleRate, double seconds) {
+  // Open E, A, D and G shapes, low string first (MIDI, -1 = muted)
+  static const int kShapes[4][6] = {{40, 47, 52, 56, 59, 64}, {-1, 45, 52, 57, 61, 64}, {-1, -1, 50, 57, 62, 66}, {43, 47, 50, 55, 59, 67}};
+  constexpr double kStrumPeriod = 0.5;
+  constexpr double kStrumSpread = 0.012; // seconds between strings
+
+  BenchSignal signal{"plucked_guitar", sampleRate, std::vector<float>(static_cast<size_t>(sampleRate * seconds), 0.0f)};
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> excite(-1.0f, 1.0f);
+
+  size_t strumLength = static_cast<size_t>(kStrumPeriod * sampleRate);
+  for (int strum = 0; strum * kStrumPeriod < seconds; strum++) {
+    const int* shape = kShapes[(strum / 2) % 4];
+    for (int s = 0; s < 6; s++) {
+      if (shape[s] < 0) continue;
+      size_t start = static_cast<size_t>((strum * kStrumPeriod + s * kStrumSpread) * sampleRate);
+      size_t period = std::max<size_t>(2, static_cast<size_t>(std::lround(sampleRate / midiToHz(shape[s]))));
+
+      // Karplus-Strong: noise burst through a damped two-point average
+      std::vector<float> line(period);
+      for (float& v : line) v = excite(rng);
+      for (size_t n = 0; n < strumLength && start + n < signal.samples.size(); n++) {
+        size_t k = n % period;
+        float out = line[k];
+        line[k] = 0.498f * (line[k] + line[(k + 1) % period]);
+        signal.samples[start + n] += 0.08f * out;
+      }
+    }
+  }
+  return signal;
+}
+
+std::vector<BenchSignal> loadWavClips(const std::string& directory) {
+  std::vector<std::filesystem::path> paths;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".wav") paths.push_back(entry.path());
+  }
+  if (error) {
+    std::fprintf(stderr, "chord-dsp bench: cannot list %s: %s\n", directory.c_str(), error.message().c_str());
+  }
+  std::sort(paths.begin(), paths.end());
+
+  std::vector<BenchSignal> clips;
+  for (const auto& path : paths) {
+    BenchSignal clip;
+    clip.name = "clip_" + path.stem().string();
+    if (readWav(path, clip) && !clip.samples.empty()) {
+      clips.push_back(std::move(clip));
+    } else {
+      std::fprintf(stderr, "chord-dsp bench: skipping %s (need 16-bit PCM or 32-bit float WAV)\n", path.string().c_str());
+    }
+  }
+  return clips;
+}
+
+std::vector<BenchSignal> benchSignals() {
+  std::vector<BenchSignal> signals;
+  signals.push_back(sineChords(kBenchSampleRate, kBenchSeconds));
+  signals.push_back(whiteNoise(kBenchSampleRate, kBenchSeconds));
+  signals.push_back(pluckedGuitar(kBenchSampleRate, kBenchSeconds));
+  if (const char* dir = std::getenv("CHORD_DSP_BENCH_CLIPS")) {
+    for (BenchSignal& clip : loadWavClips(dir)) signals.push_back(std::move(clip));
+  }
+  return signals;
+}
+
+} // namespace margelo::nitro::chorddsp::bench
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::chorddsp::bench {
+
+// Mono benchmark input. Synthetic signals are seeded, so every run sees the
+// same samples.
+struct BenchSignal {
+  std::string name;
+  double sampleRate = 0.0;
+  std::vector<float> samples;
+};
+
+// App capture rate (see CONFIG.SAMPLE_RATE in src/components)
+constexpr double kBenchSampleRate = 16000.0;
+constexpr double kBenchSeconds = 10.0;
+
+// I - vi - IV - V in C as sine triads over a bass root, one chord per second
+BenchSignal sineChords(double sampleRate, double seconds);
+// White noise at -10 dBFS
+BenchSignal whiteNoise(double sampleRate, double seconds);
+// Karplus-Strong strums of open guitar chords, two per second
+BenchSignal pluckedGuitar(double sampleRate, double seconds);
+
+// Every .wav (16-bit PCM or 32-bit float, channels averaged) in `directory`,
+// sorted by name. Unreadable files are skipped with a message on stderr.
+std::vector<BenchSignal> loadWavClips(const std::string& directory);
+
+// The synthetic signals plus the clips in $CHORD_DSP_BENCH_CLIPS, if set
+std::vector<BenchSignal> benchSignals();
+
+} // namespace margelo::nitro::chorddsp::bench
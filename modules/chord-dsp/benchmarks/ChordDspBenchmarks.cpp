@@ -0,0 +1,481 @@
+// Microbenchmarks for the ChordDSPCore hot paths. Every case reports
+// ns/frame (wall time over the timed loop divided by frames processed) and
+// allocs/frame (heap allocations in the timed loop per frame); the label
+// names the FFT and aubio vector backends the binary was built with.
+
+#include "BenchSignals.hpp"
+#include "dsp/BiquadCascade.hpp"
+#include "dsp/ChordClassifier.hpp"
+#include "dsp/ChordDSPCore.hpp"
+#include "dsp/ChordDecoder.hpp"
+#include "dsp/OnsetDetectorPool.hpp"
+#include "dsp/PitchTracker.hpp"
+#include "dsp/ResonatorBank.hpp"
+#include "dsp/StreamingMel.hpp"
+#include "dsp/VectorOps.hpp"
+#include <algorithm>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+extern "C" {
+#include "aubio/onset/peakpicker.h"
+}
+
+using namespace margelo::nitro::chorddsp;
+using namespace margelo::nitro::chorddsp::bench;
+
+// --- allocation counting ---
+
+namespace {
+std::atomic<uint64_t> gAllocations{0};
+} // namespace
+
+#if defined(__GLIBC__)
+// Interpose the C allocator so aubio's calloc/malloc are counted too;
+// operator new goes through malloc as well
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+  gAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+void* calloc(size_t count, size_t size) {
+  gAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+void* realloc(void* ptr, size_t size) {
+  gAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+void free(void* ptr) {
+  __libc_free(ptr);
+}
+}
+#else
+// Elsewhere only C++ allocations are counted
+void* operator new(size_t size) {
+  gAllocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+#endif
+
+namespace {
+
+#if defined(__APPLE__)
+constexpr const char* kBackend = "fft=vdsp aubio=accelerate";
+#elif defined(CHORD_DSP_BENCH_SCALAR)
+constexpr const char* kBackend = "fft=ooura aubio=scalar";
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+constexpr const char* kBackend = "fft=simd aubio=neon";
+#elif defined(__SSE2__) || defined(_M_X64)
+constexpr const char* kBackend = "fft=simd aubio=sse2";
+#else
+constexpr const char* kBackend = "fft=ooura aubio=scalar";
+#endif
+
+constexpr int kAnalysisHop = 1024;
+
+// Times the benchmark loop; `body` runs one iteration and returns the number
+// of frames it processed
+template <typename Body>
+void measure(benchmark::State& state, Body&& body) {
+  uint64_t frames = 0;
+  uint64_t allocations = gAllocations.load(std::memory_order_relaxed);
+  auto start = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    frames += body();
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  allocations = gAllocations.load(std::memory_order_relaxed) - allocations;
+
+  double perFrame = frames > 0 ? 1.0 / static_cast<double>(frames) : 0.0;
+  state.counters["ns/frame"] = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) * perFrame;
+  state.counters["allocs/frame"] = static_cast<double>(allocations) * perFrame;
+  state.SetItemsProcessed(static_cast<int64_t>(frames));
+  state.SetLabel(kBackend);
+}
+
+// End positions of successive kFFTSize windows, hopping by kAnalysisHop
+class WindowCursor {
+public:
+  WindowCursor(size_t count, size_t window) : count_(count), window_(window), end_(window) {}
+
+  size_t next() {
+    size_t end = end_;
+    end_ += kAnalysisHop;
+    if (end_ > count_) end_ = window_;
+    return end;
+  }
+
+private:
+  size_t count_;
+  size_t window_;
+  size_t end_;
+};
+
+// Frames a whole-buffer chroma pass folds
+size_t chromaFrames(size_t count) {
+  return static_cast<size_t>(ChordDSPCore::chromaFrameCount(count));
+}
+
+void resample(benchmark::State& state, const BenchSignal& signal) {
+  ChordDSPCore core;
+  core.resampleToTarget(signal.samples.data(), signal.samples.size(), signal.sampleRate);
+  // Frames: kHopSize output samples
+  measure(state, [&] {
+    const std::vector<float>& out = core.resampleToTarget(signal.samples.data(), signal.samples.size(), signal.sampleRate);
+    benchmark::DoNotOptimize(out.data());
+    return out.size() / ChordDSPCore::kHopSize;
+  });
+}
+
+void ingest(benchmark::State& state, const BenchSignal& signal, PcmFormat format, int channels, bool filtered) {
+  // The signal as interleaved capture chunks, every channel the same
+  size_t frames = signal.samples.size();
+  size_t sampleBytes = pcmSampleBytes(format);
+  std::vector<uint8_t> pcm(frames * channels * sampleBytes);
+  for (size_t f = 0; f < frames; f++) {
+    float x = signal.samples[f];
+    for (int c = 0; c < channels; c++) {
+      uint8_t* dst = pcm.data() + (f * channels + c) * sampleBytes;
+      if (format == PcmFormat::Int16) {
+        *reinterpret_cast<int16_t*>(dst) = static_cast<int16_t>(std::max(-32768.0f, std::min(32767.0f, x * 32768.0f)));
+      } else if (format == PcmFormat::Int32) {
+        *reinterpret_cast<int32_t*>(dst) = static_cast<int32_t>(std::max(-1.0f, std::min(0.999999f, x)) * 2147483647.0);
+      } else {
+        *reinterpret_cast<float*>(dst) = x;
+      }
+    }
+  }
+  // The app's pre-filter: DC blocker, 60 Hz high-pass and pre-emphasis, all four sections
+  BiquadCascade filter(filtered ? BiquadCascade::design(signal.sampleRate, 20.0, 60.0, 0.97) : std::vector<BiquadCascade::Section>());
+  std::vector<float> out(kAnalysisHop);
+  size_t chunks = frames / kAnalysisHop;
+  size_t chunk = 0;
+  // Frames: one kAnalysisHop-frame chunk
+  measure(state, [&] {
+    PcmLevels levels;
+    conditionPcm(pcm.data() + chunk * kAnalysisHop * channels * sampleBytes, format, channels, kAnalysisHop, 10.0f, out.data(), levels, &filter);
+    benchmark::DoNotOptimize(levels);
+    benchmark::DoNotOptimize(out.data());
+    chunk = (chunk + 1) % chunks;
+    return 1;
+  });
+}
+
+void melSpectrogram(benchmark::State& state, const BenchSignal& signal, int threads) {
+  ChordDSPCore core;
+  core.setMelThreads(threads);
+  std::vector<float> audio = core.resampleToTarget(signal.samples.data(), signal.samples.size(), signal.sampleRate);
+  std::vector<float> mel(static_cast<size_t>(ChordDSPCore::melFrameCount(audio.size())) * ChordDSPCore::kMelBins);
+  core.computeMelFrames(audio.data(), audio.size(), mel.data());
+  measure(state, [&] {
+    int frames = core.computeMelFrames(audio.data(), audio.size(), mel.data());
+    benchmark::ClobberMemory();
+    return static_cast<uint64_t>(frames);
+  });
+}
+
+void streamingMel(benchmark::State& state, const BenchSignal& signal) {
+  StreamingMel mel(signal.sampleRate, ChordDSPCore::kTargetSampleRate, ChordDSPCore::kFFTSize, ChordDSPCore::kHopSize, ChordDSPCore::kMelBins,
+                   ChordDSPCore::kMinFreq, ChordDSPCore::kMaxFreq, 64);
+  mel.push(signal.samples.data(), kAnalysisHop);
+  size_t pos = kAnalysisHop;
+  measure(state, [&] {
+    if (pos + kAnalysisHop > signal.samples.size()) pos = 0;
+    int frames = mel.push(signal.samples.data() + pos, kAnalysisHop);
+    pos += kAnalysisHop;
+    return static_cast<uint64_t>(frames);
+  });
+}
+
+void chromagram(benchmark::State& state, const BenchSignal& signal, bool bass, ChromaAssignment assignment) {
+  ChordDSPCore core;
+  core.setChromaAssignment(assignment);
+  float minFreq = bass ? ChordDSPCore::kBassMinFreq : ChordDSPCore::kChromaMinFreq;
+  float maxFreq = bass ? ChordDSPCore::kBassMaxFreq : ChordDSPCore::kChromaMaxFreq;
+  float chroma[12];
+  core.computeChromagram(signal.samples.data(), signal.samples.size(), signal.sampleRate, minFreq, maxFreq, chroma);
+  measure(state, [&] {
+    core.computeChromagram(signal.samples.data(), signal.samples.size(), signal.sampleRate, minFreq, maxFreq, chroma);
+    benchmark::DoNotOptimize(chroma);
+    return chromaFrames(signal.samples.size());
+  });
+}
+
+void chromaTimeline(benchmark::State& state, const BenchSignal& signal) {
+  ChordDSPCore core;
+  std::vector<float> frames(chromaFrames(signal.samples.size()) * ChordDSPCore::kChromaFrameSize);
+  core.computeChromaFrames(signal.samples.data(), signal.samples.size(), signal.sampleRate, frames.data());
+  measure(state, [&] {
+    int n = core.computeChromaFrames(signal.samples.data(), signal.samples.size(), signal.sampleRate, frames.data());
+    benchmark::DoNotOptimize(frames.data());
+    return static_cast<uint64_t>(n);
+  });
+}
+
+// bassInterval > 0 adds a long analyzeBass() transform every that many frames,
+// as StreamingChordAnalyzer.setBassInterval()
+void analyzeFrame(benchmark::State& state, const BenchSignal& signal, ChromaAssignment assignment, bool harmonic, bool whitened = false, int bassInterval = 0) {
+  ChordDSPCore core;
+  core.setChromaAssignment(assignment);
+  core.setHarmonicPercussive(harmonic);
+  core.setSpectralWhitening(whitened);
+  core.initOnsetDetector(signal.sampleRate, ChordDSPCore::kFFTSize, kAnalysisHop);
+  core.warmup();
+  // Windows end at least kBassFFTSize in so both transforms see full input
+  int window = bassInterval > 0 ? ChordDSPCore::kBassFFTSize : ChordDSPCore::kFFTSize;
+  WindowCursor cursor(signal.samples.size(), window);
+  float result[ChordDSPCore::kAnalyzeFrameSize];
+  core.analyzeFrame(signal.samples.data(), window, signal.sampleRate, result);
+  if (bassInterval > 0) core.analyzeBass(signal.samples.data(), window, signal.sampleRate, result + 12);
+  int frame = 0;
+  measure(state, [&] {
+    size_t end = cursor.next();
+    core.analyzeFrame(signal.samples.data(), end, signal.sampleRate, result);
+    if (bassInterval > 0 && ++frame % bassInterval == 0) core.analyzeBass(signal.samples.data(), end, signal.sampleRate, result + 12);
+    benchmark::DoNotOptimize(result);
+    return uint64_t{1};
+  });
+}
+
+void constantQ(benchmark::State& state, const BenchSignal& signal, int numBins) {
+  ChordDSPCore core;
+  ConstantQ& cq = core.constantQ(static_cast<int>(signal.sampleRate), numBins);
+  std::vector<float> out(static_cast<size_t>(numBins) + 12);
+  WindowCursor cursor(signal.samples.size(), cq.windowSize());
+  core.computeConstantQ(cq, signal.samples.data(), cq.windowSize(), out.data());
+  measure(state, [&] {
+    core.computeConstantQ(cq, signal.samples.data(), cursor.next(), out.data());
+    benchmark::ClobberMemory();
+    return uint64_t{1};
+  });
+}
+
+void onsetDetect(benchmark::State& state, const BenchSignal& signal, const std::vector<std::string>& methods) {
+  OnsetConfig config;
+  config.sampleRate = static_cast<uint_t>(signal.sampleRate);
+  config.bufferSize = ChordDSPCore::kFFTSize;
+  config.hopSize = kAnalysisHop;
+  config.methods = methods;
+  config.weights.assign(methods.size(), 1.0);
+  PooledOnset onset(config);
+
+  size_t pos = 0;
+  onset.process(signal.samples.data(), kAnalysisHop);
+  measure(state, [&] {
+    if (pos + kAnalysisHop > signal.samples.size()) pos = 0;
+    onset.process(signal.samples.data() + pos, kAnalysisHop);
+    pos += kAnalysisHop;
+    benchmark::DoNotOptimize(onset.isOnset());
+    return uint64_t{1};
+  });
+}
+
+void peakPicker(benchmark::State& state, const BenchSignal& signal) {
+  // Descriptor curve from the app's default detector, replayed hop by hop
+  ChordDSPCore core;
+  std::vector<float> times;
+  std::vector<float> curve;
+  core.detectOnsetsBatch(signal.samples.data(), signal.samples.size(), signal.sampleRate, times, curve);
+
+  aubio_peakpicker_t* picker = new_aubio_peakpicker();
+  aubio_peakpicker_set_threshold(picker, 0.3f);
+  fvec_t* in = new_fvec(1);
+  fvec_t* out = new_fvec(1);
+  size_t pos = 0;
+  measure(state, [&] {
+    in->data[0] = curve[pos];
+    pos = (pos + 1) % curve.size();
+    aubio_peakpicker_do(picker, in, out);
+    benchmark::DoNotOptimize(out->data[0]);
+    return uint64_t{1};
+  });
+  del_fvec(out);
+  del_fvec(in);
+  del_aubio_peakpicker(picker);
+}
+
+void classifyChord(benchmark::State& state, const BenchSignal& signal) {
+  // Chroma and bass chroma of every analysis frame, classified in turn
+  ChordDSPCore core;
+  std::vector<double> frames;
+  float result[ChordDSPCore::kAnalyzeFrameSize];
+  for (size_t end = ChordDSPCore::kFFTSize; end <= signal.samples.size(); end += kAnalysisHop) {
+    core.analyzeFrame(signal.samples.data(), end, signal.sampleRate, result);
+    frames.insert(frames.end(), result, result + 24);
+  }
+  std::vector<float> chroma(frames.begin(), frames.end());
+  size_t numFrames = chroma.size() / 24;
+
+  ChordClassifier classifier;
+  size_t frame = 0;
+  int previousRoot = -1;
+  measure(state, [&] {
+    const float* f = chroma.data() + frame * 24;
+    ChordCandidate chord = classifier.classifyTwoStage(f, f + 12, previousRoot);
+    previousRoot = chord.root;
+    frame = (frame + 1) % numFrames;
+    benchmark::DoNotOptimize(chord);
+    return uint64_t{1};
+  });
+}
+
+void viterbiDecode(benchmark::State& state, const BenchSignal& signal, int lag) {
+  // Template scores of every analysis frame; lag < 0 decodes the whole
+  // signal per iteration, otherwise one online step per iteration
+  ChordDSPCore core;
+  ChordClassifier classifier;
+  std::vector<float> scores;
+  float result[ChordDSPCore::kAnalyzeFrameSize];
+  float row[kNumChords];
+  for (size_t end = ChordDSPCore::kFFTSize; end <= signal.samples.size(); end += kAnalysisHop) {
+    core.analyzeFrame(signal.samples.data(), end, signal.sampleRate, result);
+    classifier.biasedScore(result, row);
+    scores.insert(scores.end(), row, row + kNumChords);
+  }
+  int numFrames = static_cast<int>(scores.size() / kNumChords);
+
+  ChordDecoder decoder(ChordDecoder::Params(), std::max(lag, 0));
+  std::vector<ChordDecoder::Decision> decisions(static_cast<size_t>(numFrames));
+  if (lag < 0) {
+    measure(state, [&] {
+      decoder.decode(scores.data(), numFrames, decisions.data());
+      benchmark::DoNotOptimize(decisions.data());
+      return static_cast<uint64_t>(numFrames);
+    });
+    return;
+  }
+  int frame = 0;
+  measure(state, [&] {
+    ChordDecoder::Decision decision;
+    benchmark::DoNotOptimize(decoder.push(scores.data() + static_cast<size_t>(frame) * kNumChords, decision));
+    frame = (frame + 1) % numFrames;
+    return uint64_t{1};
+  });
+}
+
+void pitchTrack(benchmark::State& state, const BenchSignal& signal, int bufferSize) {
+  // One tuner buffer per analysis hop, read straight from the signal
+  PitchTracker tracker(static_cast<int>(signal.sampleRate), bufferSize, 0.15f);
+  size_t offset = 0;
+  size_t last = signal.samples.size() - static_cast<size_t>(bufferSize);
+  measure(state, [&] {
+    PitchTracker::Result result = tracker.detect(signal.samples.data() + offset);
+    offset = offset + kAnalysisHop > last ? 0 : offset + kAnalysisHop;
+    benchmark::DoNotOptimize(result);
+    return uint64_t{1};
+  });
+}
+
+void noteBank(benchmark::State& state, const BenchSignal& signal, int notes) {
+  // One analysis hop through the open guitar strings or the 88 piano keys
+  constexpr int kGuitarStrings[] = {40, 45, 50, 55, 59, 64};
+  std::vector<double> frequencies;
+  for (int i = 0; i < notes; i++) {
+    int midi = notes == 6 ? kGuitarStrings[i] : 21 + i;
+    frequencies.push_back(440.0 * std::exp2((midi - 69) / 12.0));
+  }
+  ResonatorBank bank(signal.sampleRate, frequencies);
+  std::vector<float> magnitudes(notes);
+  size_t offset = 0;
+  size_t last = signal.samples.size() - kAnalysisHop;
+  measure(state, [&] {
+    bank.process(signal.samples.data() + offset, kAnalysisHop);
+    bank.magnitudes(magnitudes.data());
+    offset = offset + kAnalysisHop > last ? 0 : offset + kAnalysisHop;
+    benchmark::DoNotOptimize(magnitudes.data());
+    return uint64_t{1};
+  });
+}
+
+void registerBenchmarks() {
+  static const std::vector<BenchSignal> signals = benchSignals();
+  static const std::vector<std::pair<std::string, std::vector<std::string>>> onsetMethods = {
+      {"default", {"default"}}, {"hfc", {"hfc"}}, {"complex", {"complex"}}, {"specflux", {"specflux"}}, {"phase", {"phase"}}, {"fused", {"hfc", "specflux", "complex"}},
+  };
+
+  for (const BenchSignal& s : signals) {
+    const BenchSignal* signal = &s;
+    benchmark::RegisterBenchmark(("Resample/" + s.name).c_str(), [signal](benchmark::State& st) { resample(st, *signal); });
+    for (auto [name, format, channels] : {std::tuple{"float32x1", PcmFormat::Float32, 1}, std::tuple{"int16x1", PcmFormat::Int16, 1}, std::tuple{"int16x2", PcmFormat::Int16, 2},
+                                          std::tuple{"int32x2", PcmFormat::Int32, 2}}) {
+      benchmark::RegisterBenchmark(("Ingest/" + s.name + "/" + name).c_str(),
+                                   [signal, format, channels](benchmark::State& st) { ingest(st, *signal, format, channels, false); });
+    }
+    for (auto [name, format, channels] : {std::tuple{"float32x1", PcmFormat::Float32, 1}, std::tuple{"int16x2", PcmFormat::Int16, 2}}) {
+      benchmark::RegisterBenchmark(("Ingest/" + s.name + "/" + name + "/filtered").c_str(),
+                                   [signal, format, channels](benchmark::State& st) { ingest(st, *signal, format, channels, true); });
+    }
+    benchmark::RegisterBenchmark(("MelSpectrogram/" + s.name).c_str(), [signal](benchmark::State& st) { melSpectrogram(st, *signal, 1); });
+    for (int threads : {2, 4, 8}) {
+      benchmark::RegisterBenchmark(("MelSpectrogram/" + s.name + "/threads:" + std::to_string(threads)).c_str(),
+                                   [signal, threads](benchmark::State& st) { melSpectrogram(st, *signal, threads); })
+          ->UseRealTime();
+    }
+    benchmark::RegisterBenchmark(("StreamingMel/" + s.name).c_str(), [signal](benchmark::State& st) { streamingMel(st, *signal); });
+    for (auto [mode, assignment] : {std::pair{"/nearest", ChromaAssignment::Nearest}, std::pair{"/soft", ChromaAssignment::Soft}, std::pair{"/peaks", ChromaAssignment::Peaks}}) {
+      benchmark::RegisterBenchmark(("Chromagram/" + s.name + mode).c_str(), [signal, assignment](benchmark::State& st) { chromagram(st, *signal, false, assignment); });
+      benchmark::RegisterBenchmark(("BassChromagram/" + s.name + mode).c_str(), [signal, assignment](benchmark::State& st) { chromagram(st, *signal, true, assignment); });
+      benchmark::RegisterBenchmark(("AnalyzeFrame/" + s.name + mode).c_str(), [signal, assignment](benchmark::State& st) { analyzeFrame(st, *signal, assignment, false); });
+    }
+    benchmark::RegisterBenchmark(("AnalyzeFrame/" + s.name + "/hpss").c_str(), [signal](benchmark::State& st) { analyzeFrame(st, *signal, ChromaAssignment::Nearest, true); });
+    benchmark::RegisterBenchmark(("AnalyzeFrame/" + s.name + "/whitened").c_str(), [signal](benchmark::State& st) { analyzeFrame(st, *signal, ChromaAssignment::Nearest, false, true); });
+    for (int interval : {1, 4}) {
+      benchmark::RegisterBenchmark(("AnalyzeFrame/" + s.name + "/bass:" + std::to_string(interval)).c_str(),
+                                   [signal, interval](benchmark::State& st) { analyzeFrame(st, *signal, ChromaAssignment::Nearest, false, false, interval); });
+    }
+    benchmark::RegisterBenchmark(("ChromaFrames/" + s.name).c_str(), [signal](benchmark::State& st) { chromaTimeline(st, *signal); });
+    for (int bins : {36, 84}) {
+      benchmark::RegisterBenchmark(("ConstantQ/" + s.name + "/" + std::to_string(bins)).c_str(), [signal, bins](benchmark::State& st) { constantQ(st, *signal, bins); });
+    }
+    for (const auto& [name, methods] : onsetMethods) {
+      const std::vector<std::string>* m = &methods;
+      benchmark::RegisterBenchmark(("OnsetDo/" + s.name + "/" + name).c_str(), [signal, m](benchmark::State& st) { onsetDetect(st, *signal, *m); });
+    }
+    benchmark::RegisterBenchmark(("PeakPicker/" + s.name).c_str(), [signal](benchmark::State& st) { peakPicker(st, *signal); });
+    benchmark::RegisterBenchmark(("ClassifyTwoStage/" + s.name).c_str(), [signal](benchmark::State& st) { classifyChord(st, *signal); });
+    benchmark::RegisterBenchmark(("ViterbiDecode/" + s.name).c_str(), [signal](benchmark::State& st) { viterbiDecode(st, *signal, -1); });
+    for (int lag : {0, 16}) {
+      benchmark::RegisterBenchmark(("ViterbiStep/" + s.name + "/lag:" + std::to_string(lag)).c_str(), [signal, lag](benchmark::State& st) { viterbiDecode(st, *signal, lag); });
+    }
+    for (int size : {1024, 2048}) {
+      benchmark::RegisterBenchmark(("PitchTrack/" + s.name + "/" + std::to_string(size)).c_str(), [signal, size](benchmark::State& st) { pitchTrack(st, *signal, size); });
+    }
+    for (int notes : {6, 88}) {
+      benchmark::RegisterBenchmark(("NoteBank/" + s.name + "/" + std::to_string(notes)).c_str(), [signal, notes](benchmark::State& st) { noteBank(st, *signal, notes); });
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  registerBenchmarks();
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,366 @@
+// Offline replay of recorded WAV files through the app's native analysis
+// (FileAnalyzer: the per-hop analyzeFrame() path behind the RMS gate, then
+// the fixed-lag ChordDecoder), as fast as the host runs it. Reports per
+// file and for the corpus: real-time factor, time per analysis stage, peak
+// resident memory and, for files with a label file next to them, chord
+// accuracy, so a settings or performance change can be checked for speed
+// and quality in one run.
+//
+//   chord_dsp_replay [options] <file.wav | directory>...
+//
+// Labels are MIREX .lab files with the WAV's name (`song.wav` ->
+// `song.lab`): one "start end label" line per segment, labels in Harte
+// syntax (C:maj, A:min, G:7, F#:min7/b3, N).
+//
+// Files are resampled to the app's 16 kHz capture rate first, as live
+// audio is, unless --rate says otherwise.
+
+#include "dsp/ChordClassifier.hpp"
+#include "dsp/FileAnalyzer.hpp"
+#include "dsp/PerfStats.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+using namespace margelo::nitro::chorddsp;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr const char* kStageNames[PerfStats::kNumStages] = {"resample", "fft", "chroma", "mel", "onset", "constantQ", "bridge"};
+
+// Analysis rate by default, the app's capture rate
+constexpr int kCaptureRate = 16000;
+
+// Accuracy grid step in seconds, as MIREX
+constexpr double kGridSeconds = 0.01;
+
+void printUsage() {
+  std::fprintf(stderr,
+               "usage: chord_dsp_replay [options] <file.wav | directory>...\n"
+               "\n"
+               "  --rate N             analysis rate in Hz, 0 for the file's own (default 16000)\n"
+               "  --hop N              hop size in samples at that rate (default 1024)\n"
+               "  --min-rms X          RMS gate on the raw samples (default 0.0005)\n"
+               "  --onset-threshold X  aubio peak-picking threshold (default 0.3)\n"
+               "  --silence-db X       onset silence gate in dB (default -40)\n"
+               "  --min-ioi-ms X       minimum inter-onset interval (default 50)\n"
+               "  --onset-methods A,B  onset descriptors, fused with equal weights (default default)\n"
+               "  --soft               soft chroma folding\n"
+               "  --peaks              peak-only chroma folding\n"
+               "  --hpss               harmonic/percussive separation\n"
+               "  --whitening          spectral whitening\n"
+               "  --tuning             tuning estimation\n"
+               "  --csv                one CSV row per file instead of the tables\n");
+}
+
+// A labeled segment: root a pitch class (-1 for N), quality a ChordQuality
+// (-1 outside the classifier's vocabulary); X segments are dropped
+struct Segment {
+  double start = 0.0;
+  double end = 0.0;
+  int root = -1;
+  int quality = -1;
+};
+
+int parseRoot(const std::string& label, size_t& pos) {
+  static constexpr int kNatural[7] = {9, 11, 0, 2, 4, 5, 7}; // A to G
+  char letter = static_cast<char>(std::toupper(static_cast<unsigned char>(label[pos])));
+  if (letter < 'A' || letter > 'G') return -1;
+  int root = kNatural[letter - 'A'];
+  for (pos++; pos < label.size() && (label[pos] == '#' || label[pos] == 'b'); pos++) {
+    root += label[pos] == '#' ? 1 : -1;
+  }
+  return (root + 12) % 12;
+}
+
+// Harte shorthand to the classifier's qualities; extensions reduce to the
+// seventh chord or triad they contain
+int parseQuality(const std::string& shorthand) {
+  static const std::pair<const char*, int> kQualities[] = {
+      {"", kChordMaj},        {"maj", kChordMaj},   {"min", kChordMin},      {"7", kChordDom7},    {"maj7", kChordMaj7},
+      {"min7", kChordMin7},   {"sus2", kChordSus2}, {"sus4", kChordSus4},    {"6", kChordMaj},     {"maj6", kChordMaj},
+      {"min6", kChordMin},    {"9", kChordDom7},    {"maj9", kChordMaj7},    {"min9", kChordMin7}, {"11", kChordDom7},
+      {"13", kChordDom7},     {"add9", kChordMaj},  {"madd9", kChordMin},
+  };
+  for (const auto& [name, quality] : kQualities) {
+    if (shorthand == name) return quality;
+  }
+  return -1;
+}
+
+// Returns false for X (unknown) and unparseable labels
+bool parseLabel(const std::string& label, Segment& segment) {
+  if (label == "N") {
+    segment.root = -1;
+    return true;
+  }
+  size_t pos = 0;
+  segment.root = parseRoot(label, pos);
+  if (segment.root < 0) return false;
+  std::string shorthand;
+  if (pos < label.size() && label[pos] == ':') {
+    size_t end = label.find_first_of("/(", pos + 1);
+    shorthand = label.substr(pos + 1, end == std::string::npos ? std::string::npos : end - pos - 1);
+  }
+  // An inversion ("/3") keeps the chord
+  segment.quality = parseQuality(shorthand);
+  return true;
+}
+
+std::vector<Segment> loadLabels(const fs::path& path) {
+  std::vector<Segment> segments;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    Segment segment;
+    std::string label;
+    if (!(fields >> segment.start >> segment.end >> label)) continue;
+    if (segment.end > segment.start && parseLabel(label, segment)) segments.push_back(segment);
+  }
+  std::sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) { return a.start < b.start; });
+  return segments;
+}
+
+// Labeled seconds and the seconds the estimate got right
+struct Accuracy {
+  double chordSeconds = 0.0; // segments in the vocabulary (and N)
+  double chordHits = 0.0;
+  double rootSeconds = 0.0;  // all segments
+  double rootHits = 0.0;
+
+  void add(const Accuracy& other) {
+    chordSeconds += other.chordSeconds;
+    chordHits += other.chordHits;
+    rootSeconds += other.rootSeconds;
+    rootHits += other.rootHits;
+  }
+};
+
+// Samples the estimated chord runs on a kGridSeconds grid over the labels.
+// A run is placed at the center of its first hop's window.
+Accuracy score(const FileAnalyzer::Result& result, const std::vector<Segment>& labels) {
+  Accuracy accuracy;
+  const std::vector<float>& chords = result.chords;
+  size_t runs = chords.size() / FileAnalyzer::kChordSize;
+  double offset = FileAnalyzer::kWindowSize / 2.0 / result.sampleRate;
+
+  size_t run = 0;
+  for (const Segment& segment : labels) {
+    // Overlapping labels step back in time
+    while (run > 0 && chords[(run - 1) * FileAnalyzer::kChordSize] + offset > segment.start) run--;
+    for (double t = segment.start + kGridSeconds / 2.0; t < segment.end; t += kGridSeconds) {
+      while (run < runs && chords[run * FileAnalyzer::kChordSize] + offset <= t) run++;
+      // run - 1 is the last run started by t; none before the first
+      int root = -1;
+      int quality = -1;
+      if (run > 0) {
+        const float* row = chords.data() + (run - 1) * FileAnalyzer::kChordSize;
+        root = static_cast<int>(row[1]);
+        quality = static_cast<int>(row[2]);
+      }
+
+      accuracy.rootSeconds += kGridSeconds;
+      if (root == segment.root) accuracy.rootHits += kGridSeconds;
+      if (segment.root >= 0 && segment.quality < 0) continue;
+      accuracy.chordSeconds += kGridSeconds;
+      if (root == segment.root && (root < 0 || quality == segment.quality)) accuracy.chordHits += kGridSeconds;
+    }
+  }
+  return accuracy;
+}
+
+double peakResidentMegabytes() {
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0); // bytes
+#else
+  return static_cast<double>(usage.ru_maxrss) / 1024.0; // kilobytes
+#endif
+}
+
+void collectWavs(const fs::path& path, std::vector<fs::path>& out) {
+  auto isWav = [](const fs::path& p) {
+    std::string ext = p.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext == ".wav";
+  };
+  if (fs::is_directory(path)) {
+    std::vector<fs::path> found;
+    for (const auto& entry : fs::recursive_directory_iterator(path)) {
+      if (entry.is_regular_file() && isWav(entry.path())) found.push_back(entry.path());
+    }
+    std::sort(found.begin(), found.end());
+    out.insert(out.end(), found.begin(), found.end());
+  } else {
+    out.push_back(path);
+  }
+}
+
+std::string percent(double hits, double total) {
+  if (total <= 0.0) return "-";
+  char text[16];
+  std::snprintf(text, sizeof(text), "%.1f", 100.0 * hits / total);
+  return text;
+}
+
+std::vector<std::string> splitList(const std::string& list) {
+  std::vector<std::string> items;
+  std::istringstream in(list);
+  std::string item;
+  while (std::getline(in, item, ',')) {
+    if (!item.empty()) items.push_back(item);
+  }
+  return items;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  FileAnalyzer::Options options;
+  options.sampleRate = kCaptureRate;
+  bool csv = false;
+  bool sawPath = false;
+  std::vector<fs::path> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto value = [&]() -> std::string {
+      if (i + 1 >= argc) {
+        std::fprintf(stderr, "%s needs a value\n", arg.c_str());
+        std::exit(2);
+      }
+      return argv[++i];
+    };
+    if (arg == "--rate") {
+      options.sampleRate = std::atoi(value().c_str());
+    } else if (arg == "--hop") {
+      options.hopSize = std::atoi(value().c_str());
+    } else if (arg == "--min-rms") {
+      options.minRms = std::strtof(value().c_str(), nullptr);
+    } else if (arg == "--onset-threshold") {
+      options.onsetParams.threshold = std::strtod(value().c_str(), nullptr);
+    } else if (arg == "--silence-db") {
+      options.onsetParams.silenceDb = std::strtod(value().c_str(), nullptr);
+    } else if (arg == "--min-ioi-ms") {
+      options.onsetParams.minIoiMs = std::strtod(value().c_str(), nullptr);
+    } else if (arg == "--onset-methods") {
+      options.onsetMethods = splitList(value());
+      options.onsetWeights.assign(options.onsetMethods.size(), 1.0);
+    } else if (arg == "--soft") {
+      options.chromaAssignment = ChromaAssignment::Soft;
+    } else if (arg == "--peaks") {
+      options.chromaAssignment = ChromaAssignment::Peaks;
+    } else if (arg == "--hpss") {
+      options.harmonicPercussive = true;
+    } else if (arg == "--whitening") {
+      options.spectralWhitening = true;
+    } else if (arg == "--tuning") {
+      options.tuningEstimation = true;
+    } else if (arg == "--csv") {
+      csv = true;
+    } else if (arg == "--help" || arg == "-h") {
+      printUsage();
+      return 0;
+    } else if (!arg.empty() && arg[0] == '-') {
+      std::fprintf(stderr, "unknown option %s\n", arg.c_str());
+      printUsage();
+      return 2;
+    } else {
+      collectWavs(arg, inputs);
+      sawPath = true;
+    }
+  }
+  if (!sawPath) {
+    printUsage();
+    return 2;
+  }
+  if (inputs.empty()) {
+    std::fprintf(stderr, "no .wav files found\n");
+    return 1;
+  }
+
+  FileAnalyzer analyzer;
+  PerfStats corpusStages;
+  Accuracy corpusAccuracy;
+  double audioSeconds = 0.0;
+  double analysisSeconds = 0.0;
+  size_t failed = 0;
+
+  if (csv) {
+    std::printf("file,audio_s,analysis_s,rtf,chord_pct,root_pct,onsets,peak_rss_mb\n");
+  } else {
+    std::printf("%-40s %9s %9s %8s %7s %7s %7s\n", "file", "audio s", "RTF", "x rt", "chord%", "root%", "onsets");
+  }
+
+  for (const fs::path& path : inputs) {
+    FileAnalyzer::Result result;
+    analyzer.perf().reset();
+    uint64_t start = PerfStats::now();
+    try {
+      result = analyzer.analyze(path.string(), options);
+    } catch (const std::exception& e) {
+      std::fprintf(stderr, "%s: %s\n", path.string().c_str(), e.what());
+      failed++;
+      continue;
+    }
+    double elapsed = static_cast<double>(PerfStats::now() - start) / 1e9;
+    corpusStages.merge(analyzer.perf());
+
+    // Audio the hops cover, the tail shorter than a hop aside
+    double seconds = result.hops == 0 ? 0.0 : ((result.hops - 1) * static_cast<double>(result.hopSize) + FileAnalyzer::kWindowSize) / result.sampleRate;
+    audioSeconds += seconds;
+    analysisSeconds += elapsed;
+
+    Accuracy accuracy;
+    fs::path labels = fs::path(path).replace_extension(".lab");
+    if (fs::exists(labels)) accuracy = score(result, loadLabels(labels));
+    corpusAccuracy.add(accuracy);
+
+    double rtf = seconds > 0.0 ? elapsed / seconds : 0.0;
+    std::string chord = percent(accuracy.chordHits, accuracy.chordSeconds);
+    std::string root = percent(accuracy.rootHits, accuracy.rootSeconds);
+    if (csv) {
+      std::printf("%s,%.3f,%.4f,%.5f,%s,%s,%zu,%.1f\n", path.string().c_str(), seconds, elapsed, rtf, chord.c_str(), root.c_str(), result.onsets.size(),
+                  peakResidentMegabytes());
+    } else {
+      std::printf("%-40s %9.1f %9.5f %8.0f %7s %7s %7zu\n", path.filename().string().c_str(), seconds, rtf, rtf > 0.0 ? 1.0 / rtf : 0.0, chord.c_str(),
+                  root.c_str(), result.onsets.size());
+    }
+  }
+
+  if (!csv && audioSeconds > 0.0) {
+    double rtf = analysisSeconds / audioSeconds;
+    std::printf("%-40s %9.1f %9.5f %8.0f %7s %7s\n", "total", audioSeconds, rtf, 1.0 / rtf,
+                percent(corpusAccuracy.chordHits, corpusAccuracy.chordSeconds).c_str(), percent(corpusAccuracy.rootHits, corpusAccuracy.rootSeconds).c_str());
+
+    // Stage totals are histogram sums (within ~6%); the rest of the wall
+    // time is WAV conversion, the RMS gate, classification and decoding
+    std::printf("\n%-12s %10s %9s %9s %10s %6s\n", "stage", "frames", "p50 us", "p95 us", "total ms", "share");
+    double stageNanos = 0.0;
+    for (int i = 0; i < PerfStats::kNumStages; i++) {
+      auto stage = static_cast<PerfStats::Stage>(i);
+      if (corpusStages.count(stage) == 0) continue;
+      double total = corpusStages.total(stage);
+      stageNanos += total;
+      std::printf("%-12s %10llu %9.2f %9.2f %10.1f %5.1f%%\n", kStageNames[i], static_cast<unsigned long long>(corpusStages.count(stage)),
+                  corpusStages.percentile(stage, 0.50) / 1000.0, corpusStages.percentile(stage, 0.95) / 1000.0, total / 1e6, 100.0 * total / (analysisSeconds * 1e9));
+    }
+    double other = std::max(0.0, analysisSeconds * 1e9 - stageNanos);
+    std::printf("%-12s %10s %9s %9s %10.1f %5.1f%%\n", "other", "", "", "", other / 1e6, 100.0 * other / (analysisSeconds * 1e9));
+    std::printf("\npeak RSS %.1f MB\n", peakResidentMegabytes());
+  }
+  return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+// Float32 view over an ArrayBuffer. For JS-owned buffers it is only valid
+// for the duration of the synchronous call that received it.
+struct Float32View {
+  float* data;
+  size_t size;
+};
+
+inline Float32View float32View(const std::shared_ptr<ArrayBuffer>& buffer, const char* name) {
+  if (!buffer) {
+    throw std::invalid_argument(std::string(name) + " must be an ArrayBuffer");
+  }
+  size_t bytes = buffer->size();
+  if (bytes % sizeof(float) != 0) {
+    throw std::invalid_argument(std::string(name) + " byte length " + std::to_string(bytes) + " is not a multiple of 4 (float32)");
+  }
+  uint8_t* data = buffer->data();
+  if (reinterpret_cast<uintptr_t>(data) % alignof(float) != 0) {
+    throw std::invalid_argument(std::string(name) + " data is not 4-byte aligned (float32)");
+  }
+  return {reinterpret_cast<float*>(data), bytes / sizeof(float)};
+}
+
+inline void requireCapacity(const Float32View& view, size_t needed, const char* method) {
+  if (view.size < needed) {
+    throw std::invalid_argument(std::string(method) + ": output holds " + std::to_string(view.size) + " floats, needs " + std::to_string(needed));
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
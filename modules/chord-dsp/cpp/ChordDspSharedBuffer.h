@@ -0,0 +1,26 @@
+#pragma once
+
+// Plain C view of the native float buffers chord-dsp shares with other
+// native modules (see dsp/SharedBufferRegistry.hpp). JS only passes the
+// handle around; the consumer retains the buffer, reads it in place and
+// releases it. Other modules declare these two functions themselves, so
+// keep their copies in sync (modules/chord-model-inference-module/ios).
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Keeps buffer `handle` alive until the matching release and returns its
+// data, with its length in floats in *size. Returns NULL (and leaves *size
+// alone) if the handle is unknown. Thread safe.
+float* chord_dsp_shared_buffer_retain(int64_t handle, size_t* size);
+
+// Drops one retain taken with chord_dsp_shared_buffer_retain()
+void chord_dsp_shared_buffer_release(int64_t handle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,203 @@
+#include "HybridChordClassifier.hpp"
+#include "ArrayBufferView.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+void writeCandidate(const ChordCandidate& chord, float* out) {
+  out[0] = static_cast<float>(chord.root);
+  out[1] = static_cast<float>(chord.quality);
+  out[2] = chord.confidence;
+}
+
+void writeChord(int chord, float confidence, float* out) {
+  out[0] = chord < 0 ? -1.0f : static_cast<float>(chord % 12);
+  out[1] = chord < 0 ? 0.0f : static_cast<float>(chord / 12);
+  out[2] = confidence;
+}
+
+void requireValues(const Float32View& view, size_t needed, const char* name, const char* method) {
+  if (view.size < needed) {
+    throw std::invalid_argument(std::string(method) + ": " + name + " holds " + std::to_string(view.size) + " floats, needs " + std::to_string(needed));
+  }
+}
+
+int previousRootArg(double previousRoot) {
+  if (!std::isfinite(previousRoot) || previousRoot < 0.0) return -1;
+  return static_cast<int>(previousRoot) % 12;
+}
+
+} // namespace
+
+void HybridChordClassifier::classifyInto(const std::shared_ptr<ArrayBuffer>& chroma, const std::shared_ptr<ArrayBuffer>& output) {
+  Float32View in = float32View(chroma, "chroma");
+  Float32View out = float32View(output, "output");
+  requireValues(in, 12, "chroma", "classifyInto");
+  requireCapacity(out, 3, "classifyInto");
+
+  writeCandidate(classifier_.classify(in.data), out.data);
+}
+
+void HybridChordClassifier::classifyWithBassInto(const std::shared_ptr<ArrayBuffer>& frame, double previousRoot, const std::shared_ptr<ArrayBuffer>& output) {
+  Float32View in = float32View(frame, "frame");
+  Float32View out = float32View(output, "output");
+  requireValues(in, 24, "frame", "classifyWithBassInto");
+  requireCapacity(out, 3, "classifyWithBassInto");
+
+  writeCandidate(classifier_.classifyWithBass(in.data, in.data + 12, previousRootArg(previousRoot)), out.data);
+}
+
+void HybridChordClassifier::classifyTwoStageInto(const std::shared_ptr<ArrayBuffer>& frame, double previousRoot, const std::shared_ptr<ArrayBuffer>& output) {
+  Float32View in = float32View(frame, "frame");
+  Float32View out = float32View(output, "output");
+  requireValues(in, 24, "frame", "classifyTwoStageInto");
+  requireCapacity(out, 3, "classifyTwoStageInto");
+
+  writeCandidate(classifier_.classifyTwoStage(in.data, in.data + 12, previousRootArg(previousRoot)), out.data);
+}
+
+double HybridChordClassifier::topNInto(const std::shared_ptr<ArrayBuffer>& chroma, double n, const std::shared_ptr<ArrayBuffer>& output) {
+  if (!(n >= 1.0)) {
+    throw std::invalid_argument("topNInto: n must be >= 1");
+  }
+  Float32View in = float32View(chroma, "chroma");
+  Float32View out = float32View(output, "output");
+  requireValues(in, 12, "chroma", "topNInto");
+  int count = static_cast<int>(std::min(n, static_cast<double>(kNumChords)));
+  requireCapacity(out, static_cast<size_t>(count) * 3, "topNInto");
+
+  ChordCandidate best[kNumChords];
+  count = classifier_.topN(in.data, count, best);
+  for (int i = 0; i < count; i++) {
+    writeCandidate(best[i], out.data + i * 3);
+  }
+  return static_cast<double>(count);
+}
+
+double HybridChordClassifier::classifyActivationsInto(const std::shared_ptr<ArrayBuffer>& notes, double threshold, const std::shared_ptr<ArrayBuffer>& output) {
+  if (!std::isfinite(threshold)) {
+    throw std::invalid_argument("classifyActivationsInto: threshold must be finite");
+  }
+  Float32View in = float32View(notes, "notes");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, 3, "classifyActivationsInto");
+
+  int frames = static_cast<int>(in.size / kNumPianoKeys);
+  if (frames == 0) return 0.0;
+  writeCandidate(classifier_.classifyActivations(in.data, frames, static_cast<float>(threshold)), out.data);
+  return static_cast<double>(frames);
+}
+
+void HybridChordClassifier::configureSmoother(double minHoldMs, double minFramesToConfirm, double hysteresisMargin) {
+  if (!std::isfinite(minHoldMs) || minHoldMs < 0.0) {
+    throw std::invalid_argument("configureSmoother: minHoldMs must be finite and >= 0");
+  }
+  if (!(minFramesToConfirm >= 1.0)) {
+    throw std::invalid_argument("configureSmoother: minFramesToConfirm must be >= 1");
+  }
+  if (!std::isfinite(hysteresisMargin)) {
+    throw std::invalid_argument("configureSmoother: hysteresisMargin must be finite");
+  }
+  smoother_.configure(minHoldMs, static_cast<int>(minFramesToConfirm), static_cast<float>(hysteresisMargin));
+  smoother_.reset();
+}
+
+void HybridChordClassifier::smoothInto(double root, double quality, double confidence, bool isOnset, double nowMs, const std::shared_ptr<ArrayBuffer>& output) {
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, 3, "smoothInto");
+
+  int chord = -1;
+  if (root >= 0.0) {
+    if (root >= 12.0 || quality < 0.0 || quality >= static_cast<double>(kNumChordQualities)) {
+      throw std::invalid_argument("smoothInto: root must be -1 or in [0, 12) and quality in [0, " + std::to_string(kNumChordQualities) + ")");
+    }
+    chord = ChordCandidate{static_cast<int>(root), static_cast<int>(quality)}.index();
+  }
+
+  ChordSmoother::Result smoothed = smoother_.process(chord, static_cast<float>(confidence), isOnset, nowMs);
+  writeChord(smoothed.chord, smoothed.confidence, out.data);
+}
+
+double HybridChordClassifier::currentRoot() {
+  return static_cast<double>(smoother_.currentRoot());
+}
+
+void HybridChordClassifier::resetSmoother() {
+  smoother_.reset();
+}
+
+void HybridChordClassifier::configureDecoder(double selfTransition, double temperature, double noChordScore, double lagFrames) {
+  if (!(lagFrames >= 0.0 && lagFrames <= static_cast<double>(ChordDecoder::kMaxLag))) {
+    throw std::invalid_argument("configureDecoder: lagFrames must be in [0, " + std::to_string(ChordDecoder::kMaxLag) + "]");
+  }
+  ChordDecoder::Params params;
+  params.selfTransition = static_cast<float>(selfTransition);
+  params.temperature = static_cast<float>(temperature);
+  params.noChordScore = static_cast<float>(noChordScore);
+  try {
+    decoder_.configure(params, static_cast<int>(lagFrames));
+  } catch (const std::invalid_argument& e) {
+    throw std::invalid_argument(std::string("configureDecoder: ") + e.what());
+  }
+}
+
+double HybridChordClassifier::decodeInto(const std::shared_ptr<ArrayBuffer>& frames, double stride, const std::shared_ptr<ArrayBuffer>& output) {
+  if (!(stride >= 12.0) || stride != std::floor(stride)) {
+    throw std::invalid_argument("decodeInto: stride must be an integer >= 12");
+  }
+  Float32View in = float32View(frames, "frames");
+  Float32View out = float32View(output, "output");
+  size_t step = static_cast<size_t>(stride);
+  // A shorter last frame still holds its 12 chroma values
+  size_t count = in.size < 12 ? 0 : (in.size - 12) / step + 1;
+  requireCapacity(out, count * 3, "decodeInto");
+  if (count == 0) return 0.0;
+
+  decodeScores_.resize(count * kNumChords);
+  decisions_.resize(count);
+  for (size_t f = 0; f < count; f++) {
+    classifier_.biasedScore(in.data + f * step, decodeScores_.data() + f * kNumChords);
+  }
+  decoder_.decode(decodeScores_.data(), static_cast<int>(count), decisions_.data());
+  for (size_t f = 0; f < count; f++) {
+    writeChord(decisions_[f].chord, decisions_[f].confidence, out.data + f * 3);
+  }
+  return static_cast<double>(count);
+}
+
+double HybridChordClassifier::decodeStepInto(const std::shared_ptr<ArrayBuffer>& chroma, const std::shared_ptr<ArrayBuffer>& output) {
+  Float32View in = float32View(chroma, "chroma");
+  Float32View out = float32View(output, "output");
+  requireValues(in, 12, "chroma", "decodeStepInto");
+  requireCapacity(out, 3, "decodeStepInto");
+
+  float scores[kNumChords];
+  classifier_.biasedScore(in.data, scores);
+  ChordDecoder::Decision decision;
+  if (!decoder_.push(scores, decision)) return 0.0;
+  writeChord(decision.chord, decision.confidence, out.data);
+  return 1.0;
+}
+
+double HybridChordClassifier::flushDecoderInto(const std::shared_ptr<ArrayBuffer>& output) {
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, static_cast<size_t>(decoder_.lag()) * 3, "flushDecoderInto");
+
+  ChordDecoder::Decision pending[ChordDecoder::kMaxLag];
+  int count = decoder_.flush(pending);
+  for (int i = 0; i < count; i++) {
+    writeChord(pending[i].chord, pending[i].confidence, out.data + i * 3);
+  }
+  return static_cast<double>(count);
+}
+
+void HybridChordClassifier::resetDecoder() {
+  decoder_.reset();
+}
+
+} // namespace margelo::nitro::chorddsp
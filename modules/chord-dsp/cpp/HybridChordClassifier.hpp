@@ -0,0 +1,43 @@
+#pragma once
+
+#include "HybridChordClassifierSpec.hpp"
+#include "dsp/ChordClassifier.hpp"
+#include "dsp/ChordDecoder.hpp"
+#include "dsp/ChordSmoother.hpp"
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// JS handle on the native chord classifier, a chord smoother and a Viterbi
+// chord decoder. The templates are built once per instance; classification
+// itself allocates nothing and writes into caller-owned buffers, and
+// decodeInto() reuses its score matrix across calls.
+class HybridChordClassifier : public HybridChordClassifierSpec {
+public:
+  HybridChordClassifier() : HybridObject(TAG) {}
+
+  void classifyInto(const std::shared_ptr<ArrayBuffer>& chroma, const std::shared_ptr<ArrayBuffer>& output) override;
+  void classifyWithBassInto(const std::shared_ptr<ArrayBuffer>& frame, double previousRoot, const std::shared_ptr<ArrayBuffer>& output) override;
+  void classifyTwoStageInto(const std::shared_ptr<ArrayBuffer>& frame, double previousRoot, const std::shared_ptr<ArrayBuffer>& output) override;
+  double topNInto(const std::shared_ptr<ArrayBuffer>& chroma, double n, const std::shared_ptr<ArrayBuffer>& output) override;
+  double classifyActivationsInto(const std::shared_ptr<ArrayBuffer>& notes, double threshold, const std::shared_ptr<ArrayBuffer>& output) override;
+  void configureSmoother(double minHoldMs, double minFramesToConfirm, double hysteresisMargin) override;
+  void smoothInto(double root, double quality, double confidence, bool isOnset, double nowMs, const std::shared_ptr<ArrayBuffer>& output) override;
+  double currentRoot() override;
+  void resetSmoother() override;
+  void configureDecoder(double selfTransition, double temperature, double noChordScore, double lagFrames) override;
+  double decodeInto(const std::shared_ptr<ArrayBuffer>& frames, double stride, const std::shared_ptr<ArrayBuffer>& output) override;
+  double decodeStepInto(const std::shared_ptr<ArrayBuffer>& chroma, const std::shared_ptr<ArrayBuffer>& output) override;
+  double flushDecoderInto(const std::shared_ptr<ArrayBuffer>& output) override;
+  void resetDecoder() override;
+
+private:
+  ChordClassifier classifier_;
+  ChordSmoother smoother_;
+  ChordDecoder decoder_;
+  // decodeInto()'s frames x kNumChords scores and its decisions
+  std::vector<float> decodeScores_;
+  std::vector<ChordDecoder::Decision> decisions_;
+};
+
+} // namespace margelo::nitro::chorddsp
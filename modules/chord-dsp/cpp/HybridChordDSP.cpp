@@ -1,338 +1,490 @@
 #include "HybridChordDSP.hpp"
-#include <cmath>
+#include "ArrayBufferView.hpp"
+#include "dsp/AsyncQueue.hpp"
 #include <algorithm>
-
-#ifdef __APPLE__
-#include <Accelerate/Accelerate.h>
-#endif
-
-// aubio headers (aubio.h has its own extern "C" guards)
-#include "aubio/aubio.h"
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace margelo::nitro::chorddsp {
 
-HybridChordDSP::~HybridChordDSP() {
-  if (onsetDetector_) {
-    del_aubio_onset(onsetDetector_);
-    onsetDetector_ = nullptr;
-  }
-  if (onsetInput_) {
-    del_fvec(onsetInput_);
-    onsetInput_ = nullptr;
-  }
-  if (onsetOutput_) {
-    del_fvec(onsetOutput_);
-    onsetOutput_ = nullptr;
-  }
+namespace {
+
+// "max" (default), "l1", "l2" or "none"
+Normalization parseNormalization(const std::optional<std::string>& name, const char* method) {
+  if (!name || *name == "max") return Normalization::Max;
+  if (*name == "l1") return Normalization::L1;
+  if (*name == "l2") return Normalization::L2;
+  if (*name == "none") return Normalization::None;
+  throw std::invalid_argument(std::string(method) + ": unknown normalization \"" + *name + "\", expected max, l1, l2 or none");
 }
 
-float HybridChordDSP::hzToMel(float hz) {
-  return 2595.0f * std::log10(1.0f + hz / 700.0f);
+// "log" (default), "db" or "power"
+MelScale parseMelScale(const std::optional<std::string>& name, const char* method) {
+  if (!name || *name == "log") return MelScale::Log;
+  if (*name == "db") return MelScale::Decibel;
+  if (*name == "power") return MelScale::Power;
+  throw std::invalid_argument(std::string(method) + ": unknown scale \"" + *name + "\", expected log, db or power");
 }
 
-float HybridChordDSP::melToHz(float mel) {
-  return 700.0f * (std::pow(10.0f, mel / 2595.0f) - 1.0f);
+// detectOnsetsBatch() layout: [numOnsets, numHops, times, curve]
+std::shared_ptr<ArrayBuffer> onsetsBuffer(const std::vector<float>& times, const std::vector<float>& curve) {
+  size_t count = 2 + times.size() + curve.size();
+  std::shared_ptr<ArrayBuffer> result = ArrayBuffer::allocate(count * sizeof(float));
+  float* out = reinterpret_cast<float*>(result->data());
+  out[0] = static_cast<float>(times.size());
+  out[1] = static_cast<float>(curve.size());
+  std::copy(times.begin(), times.end(), out + 2);
+  std::copy(curve.begin(), curve.end(), out + 2 + times.size());
+  return result;
 }
 
-void HybridChordDSP::initMelFilterbank() {
-  if (filterBankInitialized_) return;
+// analyzeFile() layout: [sampleRate, hopSize, numHops, numOnsets,
+// numChords, onsets, frames, chords]
+std::shared_ptr<ArrayBuffer> fileResultBuffer(const FileAnalyzer::Result& analysis) {
+  size_t count = 5 + analysis.onsets.size() + analysis.frames.size() + analysis.chords.size();
+  std::shared_ptr<ArrayBuffer> result = ArrayBuffer::allocate(count * sizeof(float));
+  float* out = reinterpret_cast<float*>(result->data());
+  out[0] = static_cast<float>(analysis.sampleRate);
+  out[1] = static_cast<float>(analysis.hopSize);
+  out[2] = static_cast<float>(analysis.hops);
+  out[3] = static_cast<float>(analysis.onsets.size());
+  out[4] = static_cast<float>(analysis.chords.size() / FileAnalyzer::kChordSize);
+  out = std::copy(analysis.onsets.begin(), analysis.onsets.end(), out + 5);
+  out = std::copy(analysis.frames.begin(), analysis.frames.end(), out);
+  std::copy(analysis.chords.begin(), analysis.chords.end(), out);
+  return result;
+}
 
-  int fftBins = kFFTSize / 2 + 1;
-  float melMin = hzToMel(kMinFreq);
-  float melMax = hzToMel(kMaxFreq);
+// expo-file-system hands out file:// URIs
+std::string localPath(const std::string& path) {
+  constexpr const char* kFileScheme = "file://";
+  return path.rfind(kFileScheme, 0) == 0 ? path.substr(std::char_traits<char>::length(kFileScheme)) : path;
+}
 
-  std::vector<float> melPoints(kMelBins + 2);
-  for (int i = 0; i < kMelBins + 2; i++) {
-    melPoints[i] = melMin + (melMax - melMin) * i / (kMelBins + 1);
-  }
+// Each AsyncQueue thread's own core and file analyzer, built on its first job
+ChordDSPCore& workerCore() {
+  static thread_local ChordDSPCore core;
+  return core;
+}
 
-  std::vector<float> binFreqs(kMelBins + 2);
-  for (int i = 0; i < kMelBins + 2; i++) {
-    float hz = melToHz(melPoints[i]);
-    binFreqs[i] = hz * kFFTSize / static_cast<float>(kTargetSampleRate);
-  }
+FileAnalyzer& workerFileAnalyzer() {
+  static thread_local FileAnalyzer analyzer;
+  return analyzer;
+}
 
-  melFilterbank_.resize(kMelBins, std::vector<float>(fftBins, 0.0f));
+using BufferPromise = Promise<std::shared_ptr<ArrayBuffer>>;
+using AsyncWork = std::function<std::shared_ptr<ArrayBuffer>(const std::atomic<bool>& cancelled)>;
 
-  for (int m = 0; m < kMelBins; m++) {
-    float left = binFreqs[m];
-    float center = binFreqs[m + 1];
-    float right = binFreqs[m + 2];
+std::exception_ptr asyncError(const std::string& method, const std::string& message) {
+  return std::make_exception_ptr(std::runtime_error(method + ": " + message));
+}
 
-    for (int k = 0; k < fftBins; k++) {
-      float fk = static_cast<float>(k);
-      if (fk >= left && fk <= center && center > left) {
-        melFilterbank_[m][k] = (fk - left) / (center - left);
-      } else if (fk > center && fk <= right && right > center) {
-        melFilterbank_[m][k] = (right - fk) / (right - center);
+// Posts `work` under `lane` and settles the promise from the queue thread:
+// rejected as cancelled when the job was replaced before it ran or flagged
+// while it ran, with the method's name prefixed to errors otherwise
+std::shared_ptr<BufferPromise> postAsync(const char* method, const std::string& lane, AsyncWork work) {
+  if (lane.empty()) {
+    throw std::invalid_argument(std::string(method) + ": lane must not be empty");
+  }
+  std::shared_ptr<BufferPromise> promise = BufferPromise::create();
+  std::string name(method);
+  AsyncQueue::Dropped dropped = [promise, name] { promise->reject(asyncError(name, "cancelled")); };
+  AsyncQueue::Job job = [promise, name, work = std::move(work)](const std::atomic<bool>& cancelled) {
+    try {
+      std::shared_ptr<ArrayBuffer> result = work(cancelled);
+      if (cancelled.load(std::memory_order_relaxed)) {
+        promise->reject(asyncError(name, "cancelled"));
+      } else {
+        promise->resolve(std::move(result));
       }
+    } catch (const std::exception& e) {
+      promise->reject(asyncError(name, e.what()));
     }
+  };
+  if (!AsyncQueue::shared().post(lane, std::move(job), std::move(dropped))) {
+    promise->reject(asyncError(name, "more than " + std::to_string(AsyncQueue::kSharedMaxWaiting) + " lanes waiting"));
   }
+  return promise;
+}
 
-  filterBankInitialized_ = true;
+} // namespace
+
+const float* HybridChordDSP::narrow(const std::vector<double>& samples) {
+  input_.resize(samples.size());
+  std::copy(samples.begin(), samples.end(), input_.begin());
+  return input_.data();
 }
 
 std::vector<double> HybridChordDSP::resampleTo22050(const std::vector<double>& samples, double sourceSampleRate) {
+  PerfStats::Call call(core_.perf());
   if (static_cast<int>(sourceSampleRate) == kTargetSampleRate) {
     return samples;
   }
+  const std::vector<float>& audio = core_.resampleToTarget(narrow(samples), samples.size(), sourceSampleRate);
+  return std::vector<double>(audio.begin(), audio.end());
+}
 
-  double ratio = static_cast<double>(kTargetSampleRate) / sourceSampleRate;
-  int outputLen = static_cast<int>(std::ceil(samples.size() * ratio));
-  std::vector<double> output(outputLen);
-
-  for (int i = 0; i < outputLen; i++) {
-    double srcIdx = i / ratio;
-    int idx0 = static_cast<int>(srcIdx);
-    double frac = srcIdx - idx0;
+double HybridChordDSP::resampledLength(double numSamples, double sourceSampleRate) {
+  if (numSamples < 0.0) {
+    throw std::invalid_argument("resampledLength: numSamples must not be negative");
+  }
+  if (static_cast<int>(sourceSampleRate) == kTargetSampleRate) {
+    return numSamples;
+  }
+  return static_cast<double>(core_.resampledLength(static_cast<size_t>(numSamples), sourceSampleRate));
+}
 
-    if (idx0 + 1 < static_cast<int>(samples.size())) {
-      output[i] = samples[idx0] * (1.0 - frac) + samples[idx0 + 1] * frac;
-    } else if (idx0 < static_cast<int>(samples.size())) {
-      output[i] = samples[idx0];
-    }
+double HybridChordDSP::resampleTo22050Into(const std::shared_ptr<ArrayBuffer>& samples, double sourceSampleRate, const std::shared_ptr<ArrayBuffer>& output) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  if (static_cast<int>(sourceSampleRate) == kTargetSampleRate) {
+    requireCapacity(out, in.size, "resampleTo22050Into");
+    std::copy(in.data, in.data + in.size, out.data);
+    return static_cast<double>(in.size);
   }
 
-  return output;
+  requireCapacity(out, core_.resampledLength(in.size, sourceSampleRate), "resampleTo22050Into");
+  const std::vector<float>& audio = core_.resampleToTarget(in.data, in.size, sourceSampleRate);
+  std::copy(audio.begin(), audio.end(), out.data);
+  return static_cast<double>(audio.size());
 }
 
 std::vector<double> HybridChordDSP::computeMelSpectrogram(const std::vector<double>& samples, double sampleRate) {
-  initMelFilterbank();
-
-  std::vector<double> audio;
+  PerfStats::Call call(core_.perf());
+  const float* audio = narrow(samples);
+  size_t count = samples.size();
   if (static_cast<int>(sampleRate) != kTargetSampleRate) {
-    audio = resampleTo22050(samples, sampleRate);
-  } else {
-    audio = samples;
+    const std::vector<float>& resampled = core_.resampleToTarget(audio, count, sampleRate);
+    audio = resampled.data();
+    count = resampled.size();
   }
 
-  int numSamples = static_cast<int>(audio.size());
-  int numFrames = std::max(0, (numSamples - kFFTSize) / kHopSize + 1);
-  if (numFrames == 0) return {};
+  melOutput_.resize(static_cast<size_t>(ChordDSPCore::melFrameCount(count)) * kMelBins);
+  core_.computeMelFrames(audio, count, melOutput_.data());
+  return std::vector<double>(melOutput_.begin(), melOutput_.end());
+}
 
-  int fftBins = kFFTSize / 2 + 1;
-  std::vector<double> result(numFrames * kMelBins, 0.0);
+double HybridChordDSP::computeMelSpectrogramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& scale) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  MelScale melScale = parseMelScale(scale, "computeMelSpectrogramInto");
 
-  std::vector<float> window(kFFTSize);
-  for (int i = 0; i < kFFTSize; i++) {
-    window[i] = 0.5f * (1.0f - std::cos(2.0f * M_PI * i / (kFFTSize - 1)));
+  const float* audio = in.data;
+  size_t count = in.size;
+  if (static_cast<int>(sampleRate) != kTargetSampleRate) {
+    const std::vector<float>& resampled = core_.resampleToTarget(in.data, in.size, sampleRate);
+    audio = resampled.data();
+    count = resampled.size();
   }
 
-#ifdef __APPLE__
-  vDSP_Length log2n = static_cast<vDSP_Length>(std::log2(kFFTSize));
-  FFTSetup fftSetup = vDSP_create_fftsetup(log2n, FFT_RADIX2);
+  int numFrames = ChordDSPCore::melFrameCount(count);
+  requireCapacity(out, static_cast<size_t>(numFrames) * kMelBins, "computeMelSpectrogramInto");
+  core_.computeMelFrames(audio, count, out.data, melScale);
+  return static_cast<double>(numFrames);
+}
 
-  std::vector<float> realPart(kFFTSize);
-  std::vector<float> imagPart(kFFTSize);
-  DSPSplitComplex splitComplex = {realPart.data(), imagPart.data()};
-  std::vector<float> magnitudes(fftBins);
-  std::vector<float> windowed(kFFTSize);
+void HybridChordDSP::setSoftChroma(bool enabled) {
+  core_.setChromaAssignment(enabled ? ChromaAssignment::Soft : ChromaAssignment::Nearest);
+}
 
-  for (int frame = 0; frame < numFrames; frame++) {
-    int offset = frame * kHopSize;
+void HybridChordDSP::setPeakChroma(bool enabled) {
+  core_.setChromaAssignment(enabled ? ChromaAssignment::Peaks : ChromaAssignment::Nearest);
+}
 
-    for (int i = 0; i < kFFTSize; i++) {
-      windowed[i] = static_cast<float>(audio[offset + i]) * window[i];
-    }
+void HybridChordDSP::setHarmonicPercussive(bool enabled) {
+  core_.setHarmonicPercussive(enabled);
+}
 
-    vDSP_ctoz(reinterpret_cast<DSPComplex*>(windowed.data()), 2, &splitComplex, 1, kFFTSize / 2);
-    vDSP_fft_zrip(fftSetup, &splitComplex, 1, log2n, FFT_FORWARD);
+void HybridChordDSP::setSpectralWhitening(bool enabled) {
+  core_.setSpectralWhitening(enabled);
+}
 
-    float scale = 1.0f / (2.0f * kFFTSize);
-    vDSP_zvmags(&splitComplex, 1, magnitudes.data(), 1, fftBins);
-    vDSP_vsmul(magnitudes.data(), 1, &scale, magnitudes.data(), 1, fftBins);
+void HybridChordDSP::setTuningEstimation(bool enabled) {
+  core_.setTuningEstimation(enabled);
+}
 
-    for (int m = 0; m < kMelBins; m++) {
-      float sum = 0.0f;
-      vDSP_dotpr(magnitudes.data(), 1, melFilterbank_[m].data(), 1, &sum, fftBins);
-      result[frame * kMelBins + m] = static_cast<double>(std::log(std::max(sum, 1e-10f)));
-    }
-  }
+double HybridChordDSP::getTuningOffset() {
+  return core_.tuningOffset();
+}
 
-  vDSP_destroy_fftsetup(fftSetup);
-#else
-  for (int frame = 0; frame < numFrames; frame++) {
-    int offset = frame * kHopSize;
-    std::vector<float> magnitudes(fftBins, 0.0f);
-
-    for (int k = 0; k < fftBins; k++) {
-      float re = 0.0f, im = 0.0f;
-      for (int n = 0; n < kFFTSize; n++) {
-        float sample = static_cast<float>(audio[offset + n]) * window[n];
-        float angle = 2.0f * M_PI * k * n / kFFTSize;
-        re += sample * std::cos(angle);
-        im -= sample * std::sin(angle);
-      }
-      magnitudes[k] = (re * re + im * im) / kFFTSize;
-    }
+void HybridChordDSP::setSpectralFeatures(bool enabled) {
+  core_.setSpectralFeatures(enabled);
+}
 
-    for (int m = 0; m < kMelBins; m++) {
-      float sum = 0.0f;
-      for (int k = 0; k < fftBins; k++) {
-        sum += magnitudes[k] * melFilterbank_[m][k];
-      }
-      result[frame * kMelBins + m] = static_cast<double>(std::log(std::max(sum, 1e-10f)));
-    }
+std::vector<double> HybridChordDSP::getSpectralFeatures() {
+  const float* features = core_.frameFeatures();
+  if (!features) return {};
+  return std::vector<double>(features, features + SpectralFeatures::kNumFeatures);
+}
+
+void HybridChordDSP::setMelThreads(double threads) {
+  if (threads < 0.0) {
+    throw std::invalid_argument("setMelThreads: threads must not be negative, got " + std::to_string(threads));
   }
-#endif
+  core_.setMelThreads(static_cast<int>(threads));
+}
 
-  return result;
+std::vector<double> HybridChordDSP::computeChromagram(const std::vector<double>& samples, double sampleRate) {
+  PerfStats::Call call(core_.perf());
+  float chroma[12];
+  core_.computeChromagram(narrow(samples), samples.size(), sampleRate, ChordDSPCore::kChromaMinFreq, ChordDSPCore::kChromaMaxFreq, chroma);
+  return std::vector<double>(chroma, chroma + 12);
 }
 
-// Internal chromagram with configurable frequency range
-std::vector<double> HybridChordDSP::computeChromagramInternal(const std::vector<double>& samples, double sampleRate, float minFreq, float maxFreq) {
-  int numSamples = static_cast<int>(samples.size());
-  if (numSamples < kFFTSize) return std::vector<double>(12, 0.0);
+std::vector<double> HybridChordDSP::computeBassChromagram(const std::vector<double>& samples, double sampleRate) {
+  PerfStats::Call call(core_.perf());
+  float chroma[12];
+  core_.computeChromagram(narrow(samples), samples.size(), sampleRate, ChordDSPCore::kBassMinFreq, ChordDSPCore::kBassMaxFreq, chroma);
+  return std::vector<double>(chroma, chroma + 12);
+}
 
-  int numFrames = (numSamples - kFFTSize) / kHopSize + 1;
-  std::vector<double> chroma(12, 0.0);
+void HybridChordDSP::computeChromagramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, 12, "computeChromagramInto");
+  Normalization norm = parseNormalization(normalization, "computeChromagramInto");
+  core_.computeChromagram(in.data, in.size, sampleRate, ChordDSPCore::kChromaMinFreq, ChordDSPCore::kChromaMaxFreq, out.data, norm);
+}
 
-  std::vector<float> window(kFFTSize);
-  for (int i = 0; i < kFFTSize; i++) {
-    window[i] = 0.5f * (1.0f - std::cos(2.0f * M_PI * i / (kFFTSize - 1)));
+double HybridChordDSP::chromaFrameCount(double numSamples) {
+  if (numSamples < 0.0) {
+    throw std::invalid_argument("chromaFrameCount: numSamples must not be negative");
   }
+  return static_cast<double>(ChordDSPCore::chromaFrameCount(static_cast<size_t>(numSamples)));
+}
 
-  int fftBins = kFFTSize / 2 + 1;
-  int sr = static_cast<int>(sampleRate);
-
-#ifdef __APPLE__
-  vDSP_Length log2n = static_cast<vDSP_Length>(std::log2(kFFTSize));
-  FFTSetup fftSetup = vDSP_create_fftsetup(log2n, FFT_RADIX2);
+double HybridChordDSP::computeChromaFramesInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  Normalization norm = parseNormalization(normalization, "computeChromaFramesInto");
+  size_t frames = static_cast<size_t>(ChordDSPCore::chromaFrameCount(in.size));
+  requireCapacity(out, frames * ChordDSPCore::kChromaFrameSize, "computeChromaFramesInto");
+  return static_cast<double>(core_.computeChromaFrames(in.data, in.size, sampleRate, out.data, norm));
+}
 
-  std::vector<float> realPart(kFFTSize);
-  std::vector<float> imagPart(kFFTSize);
-  DSPSplitComplex splitComplex = {realPart.data(), imagPart.data()};
-  std::vector<float> magnitudes(fftBins);
-  std::vector<float> windowed(kFFTSize);
+void HybridChordDSP::computeBassChromagramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, 12, "computeBassChromagramInto");
+  Normalization norm = parseNormalization(normalization, "computeBassChromagramInto");
+  core_.computeChromagram(in.data, in.size, sampleRate, ChordDSPCore::kBassMinFreq, ChordDSPCore::kBassMaxFreq, out.data, norm);
+}
 
-  for (int frame = 0; frame < numFrames; frame++) {
-    int offset = frame * kHopSize;
+std::vector<double> HybridChordDSP::analyzeFrame(const std::vector<double>& samples, double sampleRate) {
+  PerfStats::Call call(core_.perf());
+  float result[kAnalyzeFrameSize];
+  core_.analyzeFrame(narrow(samples), samples.size(), sampleRate, result);
+  return std::vector<double>(result, result + kAnalyzeFrameSize);
+}
 
-    for (int i = 0; i < kFFTSize; i++) {
-      windowed[i] = static_cast<float>(samples[offset + i]) * window[i];
-    }
+void HybridChordDSP::analyzeFrameInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, kAnalyzeFrameSize, "analyzeFrameInto");
+  core_.analyzeFrame(in.data, in.size, sampleRate, out.data, parseNormalization(normalization, "analyzeFrameInto"));
+}
 
-    vDSP_ctoz(reinterpret_cast<DSPComplex*>(windowed.data()), 2, &splitComplex, 1, kFFTSize / 2);
-    vDSP_fft_zrip(fftSetup, &splitComplex, 1, log2n, FFT_FORWARD);
+double HybridChordDSP::constantQWindowSize(double sampleRate, double numBins) {
+  return static_cast<double>(core_.constantQ(static_cast<int>(sampleRate), static_cast<int>(numBins)).windowSize());
+}
 
-    float scale = 1.0f / (2.0f * kFFTSize);
-    vDSP_zvmags(&splitComplex, 1, magnitudes.data(), 1, fftBins);
-    vDSP_vsmul(magnitudes.data(), 1, &scale, magnitudes.data(), 1, fftBins);
+void HybridChordDSP::computeConstantQInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, double numBins, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  ConstantQ& cq = core_.constantQ(static_cast<int>(sampleRate), static_cast<int>(numBins));
+  requireCapacity(out, static_cast<size_t>(cq.numBins()) + 12, "computeConstantQInto");
+  Normalization norm = parseNormalization(normalization, "computeConstantQInto");
 
-    for (int k = 1; k < fftBins; k++) {
-      float freq = static_cast<float>(k) * sr / kFFTSize;
-      if (freq < minFreq || freq > maxFreq) continue;
+  core_.computeConstantQ(cq, in.data, in.size, out.data, norm);
+}
 
-      float midiNote = 69.0f + 12.0f * std::log2(freq / 440.0f);
-      int pitchClass = static_cast<int>(std::round(midiNote)) % 12;
-      if (pitchClass < 0) pitchClass += 12;
+double HybridChordDSP::scratchAllocationCount() {
+  return static_cast<double>(core_.scratchAllocations());
+}
 
-      chroma[pitchClass] += static_cast<double>(magnitudes[k]);
+std::vector<double> HybridChordDSP::getPerfStats() {
+  PerfStats& perf = core_.perf();
+  std::vector<double> result;
+  result.reserve(1 + PerfStats::kNumStages * 4);
+  result.push_back(static_cast<double>(perf.frames()));
+  for (int i = 0; i < PerfStats::kNumStages; i++) {
+    auto stage = static_cast<PerfStats::Stage>(i);
+    result.push_back(static_cast<double>(perf.count(stage)));
+    for (double q : {0.50, 0.95, 0.99}) {
+      result.push_back(perf.percentile(stage, q) / 1000.0);
     }
   }
+  return result;
+}
 
-  vDSP_destroy_fftsetup(fftSetup);
-#else
-  for (int frame = 0; frame < numFrames; frame++) {
-    int offset = frame * kHopSize;
-
-    for (int k = 1; k < fftBins; k++) {
-      float re = 0.0f, im = 0.0f;
-      for (int n = 0; n < kFFTSize; n++) {
-        float sample = static_cast<float>(samples[offset + n]) * window[n];
-        float angle = 2.0f * M_PI * k * n / kFFTSize;
-        re += sample * std::cos(angle);
-        im -= sample * std::sin(angle);
-      }
-      float mag = (re * re + im * im) / kFFTSize;
-
-      float freq = static_cast<float>(k) * sr / kFFTSize;
-      if (freq < minFreq || freq > maxFreq) continue;
-
-      float midiNote = 69.0f + 12.0f * std::log2(freq / 440.0f);
-      int pitchClass = static_cast<int>(std::round(midiNote)) % 12;
-      if (pitchClass < 0) pitchClass += 12;
+void HybridChordDSP::resetPerfStats() {
+  core_.perf().reset();
+}
 
-      chroma[pitchClass] += static_cast<double>(mag);
-    }
-  }
-#endif
+void HybridChordDSP::warmup() {
+  core_.warmup();
+}
 
-  double maxVal = *std::max_element(chroma.begin(), chroma.end());
-  if (maxVal > 0.0) {
-    for (auto& v : chroma) v /= maxVal;
-  }
+// --- aubio onset detection ---
 
-  return chroma;
+void HybridChordDSP::initOnsetDetector(double sampleRate, double bufferSize, double hopSize) {
+  core_.initOnsetDetector(sampleRate, bufferSize, hopSize);
 }
 
-std::vector<double> HybridChordDSP::computeChromagram(const std::vector<double>& samples, double sampleRate) {
-  return computeChromagramInternal(samples, sampleRate, 60.0f, 2000.0f);
+std::vector<double> HybridChordDSP::detectOnset(const std::vector<double>& samples) {
+  PerfStats::Call call(core_.perf());
+  onsetOutput_.resize(core_.onsetResultSize());
+  core_.detectOnset(narrow(samples), samples.size(), onsetOutput_.data());
+  return std::vector<double>(onsetOutput_.begin(), onsetOutput_.end());
 }
 
-std::vector<double> HybridChordDSP::computeBassChromagram(const std::vector<double>& samples, double sampleRate) {
-  // Bass range covers fundamentals of bass guitar and low piano (E1=41Hz to B3=247Hz)
-  return computeChromagramInternal(samples, sampleRate, 40.0f, 250.0f);
+void HybridChordDSP::detectOnsetInto(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, core_.onsetResultSize(), "detectOnsetInto");
+
+  core_.detectOnset(in.data, in.size, out.data);
 }
 
-// --- aubio onset detection ---
+std::shared_ptr<ArrayBuffer> HybridChordDSP::detectOnsetsBatch(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate) {
+  PerfStats::Call call(core_.perf());
+  Float32View in = float32View(samples, "samples");
+  if (sampleRate < 1.0) {
+    throw std::invalid_argument("detectOnsetsBatch: sampleRate must be positive, got " + std::to_string(sampleRate));
+  }
 
-void HybridChordDSP::initOnsetDetector(double sampleRate, double bufferSize, double hopSize) {
-  // Clean up previous instance
-  if (onsetDetector_) {
-    del_aubio_onset(onsetDetector_);
-    onsetDetector_ = nullptr;
+  std::vector<float> times;
+  std::vector<float> curve;
+  core_.detectOnsetsBatch(in.data, in.size, sampleRate, times, curve);
+  return onsetsBuffer(times, curve);
+}
+
+FileAnalyzer::Options HybridChordDSP::fileOptions(std::optional<double> hopSize, std::optional<double> minRms, const char* method) const {
+  FileAnalyzer::Options options;
+  if (hopSize.has_value()) {
+    if (!(*hopSize >= 1.0 && *hopSize <= FileAnalyzer::kWindowSize)) {
+      throw std::invalid_argument(std::string(method) + ": hopSize must be in [1, " + std::to_string(FileAnalyzer::kWindowSize) + "], got " + std::to_string(*hopSize));
+    }
+    options.hopSize = static_cast<int>(*hopSize);
   }
-  if (onsetInput_) {
-    del_fvec(onsetInput_);
-    onsetInput_ = nullptr;
+  if (minRms.has_value()) {
+    if (!(*minRms >= 0.0)) {
+      throw std::invalid_argument(std::string(method) + ": minRms must not be negative");
+    }
+    options.minRms = static_cast<float>(*minRms);
   }
-  if (onsetOutput_) {
-    del_fvec(onsetOutput_);
-    onsetOutput_ = nullptr;
+  options.chromaAssignment = core_.chromaAssignment();
+  options.harmonicPercussive = core_.harmonicPercussive();
+  options.spectralWhitening = core_.spectralWhitening();
+  options.tuningEstimation = core_.tuningEstimation();
+  options.onsetParams = core_.onsetParams();
+  options.onsetMethods = core_.onsetMethods();
+  options.onsetWeights = core_.onsetWeights();
+  return options;
+}
+
+std::shared_ptr<ArrayBuffer> HybridChordDSP::analyzeFile(const std::string& path, std::optional<double> hopSize, std::optional<double> minRms) {
+  FileAnalyzer::Options options = fileOptions(hopSize, minRms, "analyzeFile");
+  if (!fileAnalyzer_) fileAnalyzer_ = std::make_unique<FileAnalyzer>();
+  try {
+    return fileResultBuffer(fileAnalyzer_->analyze(localPath(path), options));
+  } catch (const std::invalid_argument& e) {
+    throw std::invalid_argument(std::string("analyzeFile: ") + e.what());
   }
+}
 
-  uint_t bufSize = static_cast<uint_t>(bufferSize);
-  uint_t hop = static_cast<uint_t>(hopSize);
-  uint_t sr = static_cast<uint_t>(sampleRate);
+void HybridChordDSP::resetOnsetDetector() {
+  core_.resetOnsetDetector();
+}
 
-  onsetHopSize_ = hop;
-  onsetDetector_ = new_aubio_onset("default", bufSize, hop, sr);
-  aubio_onset_set_threshold(onsetDetector_, 0.3f);
-  aubio_onset_set_silence(onsetDetector_, -40.0f);
-  aubio_onset_set_minioi_ms(onsetDetector_, 50.0f);
+void HybridChordDSP::setOnsetDescriptors(const std::vector<std::string>& methods, const std::vector<double>& weights) {
+  core_.setOnsetDescriptors(methods, weights);
+}
 
-  onsetInput_ = new_fvec(hop);
-  onsetOutput_ = new_fvec(1);
+void HybridChordDSP::setOnsetParameters(double threshold, double silenceDb, double minIoiMs) {
+  core_.setOnsetParams(onsetParams(threshold, silenceDb, minIoiMs));
 }
 
-std::vector<double> HybridChordDSP::detectOnset(const std::vector<double>& samples) {
-  if (!onsetDetector_ || !onsetInput_ || !onsetOutput_) {
-    return {0.0, 0.0};
+void HybridChordDSP::reserveOnsetDetectors(double count, double sampleRate, double bufferSize, double hopSize, const std::vector<std::string>& methods) {
+  if (count < 0.0) {
+    throw std::invalid_argument("reserveOnsetDetectors: count must not be negative");
   }
+  std::vector<double> weights(methods.size(), 1.0);
+  validateOnsetDescriptors(methods, weights, "reserveOnsetDetectors");
+  OnsetConfig config = core_.onsetConfig(sampleRate, bufferSize, hopSize);
+  config.methods = methods;
+  config.weights = weights;
+  OnsetDetectorPool::shared().reserve(config, static_cast<size_t>(count));
+}
 
-  // Copy samples into aubio input buffer
-  uint_t len = std::min(static_cast<uint_t>(samples.size()), onsetHopSize_);
-  for (uint_t i = 0; i < len; i++) {
-    onsetInput_->data[i] = static_cast<smpl_t>(samples[i]);
-  }
-  // Zero-pad if needed
-  for (uint_t i = len; i < onsetHopSize_; i++) {
-    onsetInput_->data[i] = 0.0f;
+// --- Promise variants ---
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridChordDSP::computeMelSpectrogramAsync(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::string& lane, const std::optional<std::string>& scale) {
+  Float32View in = float32View(samples, "samples");
+  MelScale melScale = parseMelScale(scale, "computeMelSpectrogramAsync");
+  if (sampleRate < 1.0) {
+    throw std::invalid_argument("computeMelSpectrogramAsync: sampleRate must be positive, got " + std::to_string(sampleRate));
   }
+  std::vector<float> audio(in.data, in.data + in.size);
+
+  return postAsync("computeMelSpectrogramAsync", lane, [audio = std::move(audio), sampleRate, melScale](const std::atomic<bool>&) {
+    ChordDSPCore& core = workerCore();
+    const float* data = audio.data();
+    size_t count = audio.size();
+    if (static_cast<int>(sampleRate) != kTargetSampleRate) {
+      const std::vector<float>& resampled = core.resampleToTarget(data, count, sampleRate);
+      data = resampled.data();
+      count = resampled.size();
+    }
+    int numFrames = ChordDSPCore::melFrameCount(count);
+    std::shared_ptr<ArrayBuffer> result = ArrayBuffer::allocate(static_cast<size_t>(numFrames) * kMelBins * sizeof(float));
+    core.computeMelFrames(data, count, reinterpret_cast<float*>(result->data()), melScale);
+    return result;
+  });
+}
 
-  aubio_onset_do(onsetDetector_, onsetInput_, onsetOutput_);
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridChordDSP::detectOnsetsBatchAsync(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::string& lane) {
+  Float32View in = float32View(samples, "samples");
+  if (sampleRate < 1.0) {
+    throw std::invalid_argument("detectOnsetsBatchAsync: sampleRate must be positive, got " + std::to_string(sampleRate));
+  }
+  std::vector<float> audio(in.data, in.data + in.size);
+
+  return postAsync("detectOnsetsBatchAsync", lane, [audio = std::move(audio), sampleRate, methods = core_.onsetMethods(), weights = core_.onsetWeights(), params = core_.onsetParams()](const std::atomic<bool>&) {
+    ChordDSPCore& core = workerCore();
+    core.setOnsetDescriptors(methods, weights);
+    core.setOnsetParams(params);
+    std::vector<float> times;
+    std::vector<float> curve;
+    core.detectOnsetsBatch(audio.data(), audio.size(), sampleRate, times, curve);
+    return onsetsBuffer(times, curve);
+  });
+}
 
-  double isOnset = onsetOutput_->data[0] > 0.0f ? 1.0 : 0.0;
-  double descriptor = static_cast<double>(aubio_onset_get_descriptor(onsetDetector_));
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridChordDSP::analyzeFileAsync(const std::string& path, const std::string& lane, std::optional<double> hopSize, std::optional<double> minRms) {
+  FileAnalyzer::Options options = fileOptions(hopSize, minRms, "analyzeFileAsync");
 
-  return {isOnset, descriptor};
+  return postAsync("analyzeFileAsync", lane, [options, filePath = localPath(path)](const std::atomic<bool>& cancelled) {
+    FileAnalyzer::Options jobOptions = options;
+    jobOptions.cancel = &cancelled;
+    return fileResultBuffer(workerFileAnalyzer().analyze(filePath, jobOptions));
+  });
 }
 
-void HybridChordDSP::resetOnsetDetector() {
-  if (onsetDetector_) {
-    aubio_onset_reset(onsetDetector_);
-  }
+void HybridChordDSP::cancelAsync(const std::string& lane) {
+  AsyncQueue::shared().cancel(lane);
 }
 
 } // namespace margelo::nitro::chorddsp
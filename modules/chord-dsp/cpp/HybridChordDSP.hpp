@@ -1,22 +1,21 @@
 #pragma once
 
 #include "HybridChordDSPSpec.hpp"
+#include "dsp/ChordDSPCore.hpp"
+#include "dsp/FileAnalyzer.hpp"
+#include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
-// aubio types (real definitions, not forward declarations, to avoid
-// typedef conflicts with aubio's anonymous-struct fvec_t)
-extern "C" {
-#include "aubio/types.h"
-#include "aubio/fvec.h"
-#include "aubio/onset/onset.h"
-}
-
 namespace margelo::nitro::chorddsp {
 
+// JS face of ChordDSPCore: validates arguments, views JS arrays and
+// ArrayBuffers and forwards to the core. The core is float32 only; number[]
+// arguments are narrowed once per call and results widened on return.
 class HybridChordDSP : public HybridChordDSPSpec {
 public:
   HybridChordDSP() : HybridObject(TAG) {}
-  ~HybridChordDSP();
 
   std::vector<double> resampleTo22050(const std::vector<double>& samples, double sourceSampleRate) override;
   std::vector<double> computeMelSpectrogram(const std::vector<double>& samples, double sampleRate) override;
@@ -25,30 +24,66 @@ public:
   void initOnsetDetector(double sampleRate, double bufferSize, double hopSize) override;
   std::vector<double> detectOnset(const std::vector<double>& samples) override;
   void resetOnsetDetector() override;
+  void setOnsetDescriptors(const std::vector<std::string>& methods, const std::vector<double>& weights) override;
+  void setOnsetParameters(double threshold, double silenceDb, double minIoiMs) override;
+  void reserveOnsetDetectors(double count, double sampleRate, double bufferSize, double hopSize, const std::vector<std::string>& methods) override;
+  void warmup() override;
+  double scratchAllocationCount() override;
+  std::vector<double> getPerfStats() override;
+  void resetPerfStats() override;
+  void setSoftChroma(bool enabled) override;
+  void setPeakChroma(bool enabled) override;
+  void setHarmonicPercussive(bool enabled) override;
+  void setSpectralWhitening(bool enabled) override;
+  void setTuningEstimation(bool enabled) override;
+  double getTuningOffset() override;
+  void setSpectralFeatures(bool enabled) override;
+  std::vector<double> getSpectralFeatures() override;
+  void setMelThreads(double threads) override;
+  std::vector<double> analyzeFrame(const std::vector<double>& samples, double sampleRate) override;
+
+  // Float32 ArrayBuffer variants: read JS memory in place and write into a caller-provided buffer
+  double resampledLength(double numSamples, double sourceSampleRate) override;
+  double resampleTo22050Into(const std::shared_ptr<ArrayBuffer>& samples, double sourceSampleRate, const std::shared_ptr<ArrayBuffer>& output) override;
+  double computeMelSpectrogramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& scale) override;
+  void computeChromagramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) override;
+  double chromaFrameCount(double numSamples) override;
+  double computeChromaFramesInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) override;
+  void computeBassChromagramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) override;
+  void detectOnsetInto(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) override;
+  std::shared_ptr<ArrayBuffer> detectOnsetsBatch(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate) override;
+  std::shared_ptr<ArrayBuffer> analyzeFile(const std::string& path, std::optional<double> hopSize, std::optional<double> minRms) override;
+  void analyzeFrameInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) override;
+
+  // Constant-Q mode (sparse spectral kernels, octave-wise decimation)
+  double constantQWindowSize(double sampleRate, double numBins) override;
+  void computeConstantQInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, double numBins, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) override;
+
+  // Promise variants on AsyncQueue::shared(): arguments are checked and
+  // copied here, the work runs on a queue thread with that thread's own core
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> computeMelSpectrogramAsync(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::string& lane, const std::optional<std::string>& scale) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> detectOnsetsBatchAsync(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::string& lane) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> analyzeFileAsync(const std::string& path, const std::string& lane, std::optional<double> hopSize, std::optional<double> minRms) override;
+  void cancelAsync(const std::string& lane) override;
 
 private:
-  static constexpr int kTargetSampleRate = 22050;
-  static constexpr int kFFTSize = 2048;
-  static constexpr int kHopSize = 512;
-  static constexpr int kMelBins = 229;
-  static constexpr float kMinFreq = 30.0f;
-  static constexpr float kMaxFreq = 11025.0f;
-
-  std::vector<std::vector<float>> melFilterbank_;
-  bool filterBankInitialized_ = false;
-
-  void initMelFilterbank();
-  float hzToMel(float hz);
-  float melToHz(float mel);
-
-  // Internal chromagram with configurable frequency range
-  std::vector<double> computeChromagramInternal(const std::vector<double>& samples, double sampleRate, float minFreq, float maxFreq);
-
-  // aubio onset detector
-  aubio_onset_t* onsetDetector_ = nullptr;
-  fvec_t* onsetInput_ = nullptr;
-  fvec_t* onsetOutput_ = nullptr;
-  uint_t onsetHopSize_ = 0;
+  static constexpr int kFFTSize = ChordDSPCore::kFFTSize;
+  static constexpr int kAnalyzeFrameSize = ChordDSPCore::kAnalyzeFrameSize;
+  static constexpr int kTargetSampleRate = ChordDSPCore::kTargetSampleRate;
+  static constexpr int kMelBins = ChordDSPCore::kMelBins;
+
+  ChordDSPCore core_;
+  // analyzeFile()'s own core, classifier and decoder, built on first use
+  std::unique_ptr<FileAnalyzer> fileAnalyzer_;
+
+  // number[] arguments narrowed to float for the core, and reusable float
+  // results for the number[] methods that are not fixed size
+  std::vector<float> input_;
+  std::vector<float> melOutput_;
+  std::vector<float> onsetOutput_;
+  const float* narrow(const std::vector<double>& samples);
+  // analyzeFile() options from its arguments and the core's settings
+  FileAnalyzer::Options fileOptions(std::optional<double> hopSize, std::optional<double> minRms, const char* method) const;
 };
 
 } // namespace margelo::nitro::chorddsp
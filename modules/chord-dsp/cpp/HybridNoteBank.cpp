@@ -0,0 +1,71 @@
+#include "HybridNoteBank.hpp"
+#include "ArrayBufferView.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace margelo::nitro::chorddsp {
+
+void HybridNoteBank::configure(double sampleRate, const std::vector<double>& notes, std::optional<double> referenceHz, std::optional<double> bandwidthCents) {
+  double reference = referenceHz.value_or(440.0);
+  if (!(reference >= 400.0 && reference <= 480.0)) {
+    throw std::invalid_argument("NoteBank: referenceHz must be in [400, 480], got " + std::to_string(reference));
+  }
+  std::vector<double> frequencies;
+  std::vector<int> pitchClasses;
+  frequencies.reserve(notes.size());
+  pitchClasses.reserve(notes.size());
+  for (double note : notes) {
+    if (!std::isfinite(note)) {
+      throw std::invalid_argument("NoteBank: notes must be finite MIDI note numbers");
+    }
+    frequencies.push_back(reference * std::exp2((note - 69.0) / 12.0));
+    int rounded = static_cast<int>(std::lround(note));
+    pitchClasses.push_back(((rounded % 12) + 12) % 12);
+  }
+
+  float bandwidth = static_cast<float>(bandwidthCents.value_or(ResonatorBank::kDefaultBandwidthCents));
+  bank_ = std::make_unique<ResonatorBank>(sampleRate, frequencies, bandwidth);
+  pitchClasses_ = std::move(pitchClasses);
+  magnitudes_.assign(notes.size(), 0.0f);
+}
+
+void HybridNoteBank::requireBank(const char* method) const {
+  if (!bank_) {
+    throw std::invalid_argument(std::string("NoteBank: configure() must be called before ") + method + "()");
+  }
+}
+
+void HybridNoteBank::process(const std::shared_ptr<ArrayBuffer>& samples) {
+  requireBank("process");
+  Float32View in = float32View(samples, "samples");
+  bank_->process(in.data, in.size);
+}
+
+void HybridNoteBank::readInto(const std::shared_ptr<ArrayBuffer>& output) {
+  requireBank("readInto");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, static_cast<size_t>(bank_->size()), "readInto");
+  bank_->magnitudes(out.data);
+}
+
+void HybridNoteBank::readPitchClassesInto(const std::shared_ptr<ArrayBuffer>& output) {
+  requireBank("readPitchClassesInto");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, 12, "readPitchClassesInto");
+
+  bank_->magnitudes(magnitudes_.data());
+  std::fill(out.data, out.data + 12, 0.0f);
+  for (size_t k = 0; k < magnitudes_.size(); k++) {
+    out.data[pitchClasses_[k]] += magnitudes_[k] * magnitudes_[k];
+  }
+  for (int pc = 0; pc < 12; pc++) out.data[pc] = std::sqrt(out.data[pc]);
+}
+
+void HybridNoteBank::reset() {
+  if (bank_) bank_->reset();
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "HybridNoteBankSpec.hpp"
+#include "dsp/ResonatorBank.hpp"
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// JS handle on a native ResonatorBank tuned to MIDI notes. configure()
+// builds the bank; process() and the reads allocate nothing.
+class HybridNoteBank : public HybridNoteBankSpec {
+public:
+  HybridNoteBank() : HybridObject(TAG) {}
+
+  void configure(double sampleRate, const std::vector<double>& notes, std::optional<double> referenceHz, std::optional<double> bandwidthCents) override;
+  void process(const std::shared_ptr<ArrayBuffer>& samples) override;
+  void readInto(const std::shared_ptr<ArrayBuffer>& output) override;
+  void readPitchClassesInto(const std::shared_ptr<ArrayBuffer>& output) override;
+  void reset() override;
+
+private:
+  std::unique_ptr<ResonatorBank> bank_;
+  // Pitch class (0 = C) of each note, rounded to the nearest semitone
+  std::vector<int> pitchClasses_;
+  std::vector<float> magnitudes_;
+  void requireBank(const char* method) const;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,67 @@
+#include "HybridOnsetDetector.hpp"
+#include "ArrayBufferView.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+void HybridOnsetDetector::configure(double sampleRate, double bufferSize, double hopSize, const std::vector<std::string>& methods, const std::vector<double>& weights) {
+  if (sampleRate < 1.0) {
+    throw std::invalid_argument("OnsetDetector: sampleRate must be positive");
+  }
+  if (hopSize < 1.0 || hopSize > bufferSize) {
+    throw std::invalid_argument("OnsetDetector: hopSize must be in [1, bufferSize], got " + std::to_string(hopSize));
+  }
+  validateOnsetDescriptors(methods, weights, "OnsetDetector");
+
+  OnsetConfig config;
+  config.sampleRate = static_cast<uint_t>(sampleRate);
+  config.bufferSize = static_cast<uint_t>(bufferSize);
+  config.hopSize = static_cast<uint_t>(hopSize);
+  config.methods = methods;
+  config.weights = weights;
+
+  // Hand the previous detector back first so an identical config reuses it
+  onset_.reset();
+  onset_ = OnsetDetectorPool::shared().acquire(config);
+}
+
+void HybridOnsetDetector::process(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) {
+  PooledOnset& onset = detector("process");
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, onset.resultSize(), "process");
+
+  onset.process(in.data, in.size);
+  onset.writeResult(out.data);
+}
+
+void HybridOnsetDetector::setParameters(double threshold, double silenceDb, double minIoiMs) {
+  OnsetParams params = onsetParams(threshold, silenceDb, minIoiMs);
+  validateOnsetParams(params, "setParameters");
+  // process() runs on the calling thread, so this is already between hops
+  detector("setParameters").setParams(params);
+}
+
+double HybridOnsetDetector::resultSize() {
+  return static_cast<double>(detector("resultSize").resultSize());
+}
+
+void HybridOnsetDetector::reset() {
+  if (onset_) {
+    onset_->reset();
+  }
+}
+
+void HybridOnsetDetector::release() {
+  onset_.reset();
+}
+
+PooledOnset& HybridOnsetDetector::detector(const char* method) {
+  if (!onset_) {
+    throw std::invalid_argument(std::string("OnsetDetector: configure() must be called before ") + method + "()");
+  }
+  return *onset_;
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "HybridOnsetDetectorSpec.hpp"
+#include "dsp/OnsetDetectorPool.hpp"
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// JS handle on one pooled aubio onset detector. The detector goes back to
+// OnsetDetectorPool on release(), reconfiguration or destruction, so several
+// streams can run side by side without sharing state or reallocating.
+class HybridOnsetDetector : public HybridOnsetDetectorSpec {
+public:
+  HybridOnsetDetector() : HybridObject(TAG) {}
+
+  void configure(double sampleRate, double bufferSize, double hopSize, const std::vector<std::string>& methods, const std::vector<double>& weights) override;
+  void process(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) override;
+  void setParameters(double threshold, double silenceDb, double minIoiMs) override;
+  double resultSize() override;
+  void reset() override;
+  void release() override;
+
+private:
+  // Throws unless configure() was called since the last release()
+  PooledOnset& detector(const char* method);
+
+  OnsetDetectorPool::Handle onset_;
+};
+
+} // namespace margelo::nitro::chorddsp
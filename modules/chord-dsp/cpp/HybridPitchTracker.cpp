@@ -0,0 +1,50 @@
+#include "HybridPitchTracker.hpp"
+#include "ArrayBufferView.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+void HybridPitchTracker::configure(double sampleRate, double bufferSize, double threshold) {
+  if (sampleRate < 1.0) {
+    throw std::invalid_argument("PitchTracker: sampleRate must be positive");
+  }
+  if (!(bufferSize >= 8.0 && bufferSize <= 65536.0)) {
+    throw std::invalid_argument("PitchTracker: bufferSize must be in [8, 65536], got " + std::to_string(bufferSize));
+  }
+  if (!(threshold > 0.0 && threshold < 1.0)) {
+    throw std::invalid_argument("PitchTracker: threshold must be in (0, 1), got " + std::to_string(threshold));
+  }
+
+  int rate = static_cast<int>(sampleRate);
+  int size = static_cast<int>(bufferSize);
+  if (tracker_ && tracker_->sampleRate() == rate && tracker_->bufferSize() == size) {
+    tracker_->setThreshold(static_cast<float>(threshold));
+    return;
+  }
+  tracker_ = std::make_unique<PitchTracker>(rate, size, static_cast<float>(threshold));
+}
+
+bool HybridPitchTracker::detectInto(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) {
+  if (!tracker_) {
+    throw std::invalid_argument("PitchTracker: configure() must be called before detectInto()");
+  }
+  Float32View in = float32View(samples, "samples");
+  Float32View out = float32View(output, "output");
+  size_t size = static_cast<size_t>(tracker_->bufferSize());
+  if (in.size < size) {
+    throw std::invalid_argument("detectInto: samples holds " + std::to_string(in.size) + " floats, needs " + std::to_string(size));
+  }
+  requireCapacity(out, kResultSize, "detectInto");
+
+  PitchTracker::Result result = tracker_->detect(in.data + (in.size - size));
+  out.data[0] = result.frequency;
+  out.data[1] = result.probability;
+  out.data[2] = result.autocorrPeak;
+  out.data[3] = result.confidence;
+  out.data[4] = result.jitter;
+  return result.frequency > 0.0f;
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "HybridPitchTrackerSpec.hpp"
+#include "dsp/PitchTracker.hpp"
+#include <memory>
+
+namespace margelo::nitro::chorddsp {
+
+// JS handle on a native YIN pitch tracker. The FFT plan and scratch are
+// built by configure(); detectInto() allocates nothing and writes into a
+// caller-owned buffer.
+class HybridPitchTracker : public HybridPitchTrackerSpec {
+public:
+  HybridPitchTracker() : HybridObject(TAG) {}
+
+  void configure(double sampleRate, double bufferSize, double threshold) override;
+  bool detectInto(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) override;
+
+  static constexpr size_t kResultSize = 5;
+
+private:
+  std::unique_ptr<PitchTracker> tracker_;
+};
+
+} // namespace margelo::nitro::chorddsp
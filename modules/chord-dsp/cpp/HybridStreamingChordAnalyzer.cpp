@@ -0,0 +1,830 @@
+#include "HybridStreamingChordAnalyzer.hpp"
+#include "ArrayBufferView.hpp"
+#include "dsp/SharedBufferRegistry.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#elif defined(__ANDROID__)
+#include <sys/resource.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// Best effort: run the calling thread just below the audio I/O threads
+void raiseWorkerPriority() {
+#if defined(__APPLE__)
+  pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+#elif defined(__ANDROID__)
+  // ANDROID_PRIORITY_AUDIO; on Linux this applies to the calling thread
+  setpriority(PRIO_PROCESS, 0, -16);
+#endif
+}
+
+PcmFormat parsePcmFormat(const std::string& name) {
+  if (name == "float32") return PcmFormat::Float32;
+  if (name == "int16") return PcmFormat::Int16;
+  if (name == "int32") return PcmFormat::Int32;
+  throw std::invalid_argument("pushPcm: unknown format \"" + name + "\", expected float32, int16 or int32");
+}
+
+// Null for no sections; BiquadCascade's errors are rethrown as `method`'s
+std::unique_ptr<BiquadCascade> makePreFilter(const std::vector<BiquadCascade::Section>& sections, const std::string& method) {
+  if (sections.empty()) return nullptr;
+  try {
+    return std::make_unique<BiquadCascade>(sections);
+  } catch (const std::invalid_argument& e) {
+    throw std::invalid_argument(method + ": " + e.what());
+  }
+}
+
+std::vector<BiquadCascade::Section> designPreFilter(double sampleRate, double dcCutoffHz, double highPassHz, double preEmphasis, const std::string& method) {
+  try {
+    return BiquadCascade::design(sampleRate, dcCutoffHz, highPassHz, preEmphasis);
+  } catch (const std::invalid_argument& e) {
+    throw std::invalid_argument(method + ": " + e.what());
+  }
+}
+
+} // namespace
+
+HybridStreamingChordAnalyzer::~HybridStreamingChordAnalyzer() {
+  stopWorker();
+  if (sharedMel_) SharedBufferRegistry::shared().destroy(sharedMel_);
+}
+
+void HybridStreamingChordAnalyzer::configure(double sampleRate, double hopSize, double historySize, double inputGain, double minRms) {
+  if (sampleRate <= 0.0) {
+    throw std::invalid_argument("StreamingChordAnalyzer: sampleRate must be positive");
+  }
+  if (hopSize < 1.0 || hopSize > kWindowSize) {
+    throw std::invalid_argument("StreamingChordAnalyzer: hopSize must be in [1, " + std::to_string(kWindowSize) + "], got " + std::to_string(hopSize));
+  }
+  if (historySize < 0.0) {
+    throw std::invalid_argument("StreamingChordAnalyzer: historySize must not be negative");
+  }
+  // Before anything changes: a high-pass above the new Nyquist frequency fails here
+  std::unique_ptr<BiquadCascade> preFilter;
+  if (preFilterDesigned_) {
+    preFilter = makePreFilter(designPreFilter(sampleRate, preFilterDcHz_, preFilterHighPassHz_, preFilterEmphasis_, "configure"), "configure");
+  } else if (preFilter_) {
+    preFilter_->reset();
+  }
+
+  stopWorker();
+  queue_.reset();
+
+  sampleRate_ = sampleRate;
+  hopSize_ = static_cast<uint64_t>(hopSize);
+  inputGain_ = static_cast<float>(inputGain);
+  minRms_ = static_cast<float>(minRms);
+  if (preFilterDesigned_) preFilter_ = std::move(preFilter);
+
+  // One extra long window of headroom so the consumer can lag a little
+  // behind the producer without its analysis windows being overwritten
+  size_t history = std::max(static_cast<size_t>(historySize), static_cast<size_t>(kWindowSize));
+  ring_ = std::make_unique<SampleRing>(history + kBassWindowSize);
+  window_.assign(kWindowSize, 0.0f);
+  analyzedUpTo_ = 0;
+  lastValid_ = false;
+  scheduler_ = std::make_unique<AnalysisScheduler>(hopSize / sampleRate);
+  scheduler_->setFloor(thermalState_);
+  if (segmentsEnabled_) buildSegmenter();
+  if (keyHalfLife_ > 0.0) buildKeyEstimator();
+  if (chords_) chords_->reset();
+  chordEvents_.clear();
+
+  // Enough cached mel frames to cover the whole history
+  size_t resampledHistory = static_cast<size_t>(std::ceil(history * ChordDSPCore::kTargetSampleRate / sampleRate));
+  int melFrames = resampledHistory < static_cast<size_t>(kWindowSize) ? 1 : static_cast<int>((resampledHistory - kWindowSize) / ChordDSPCore::kHopSize + 1);
+  mel_ = std::make_unique<StreamingMel>(sampleRate, ChordDSPCore::kTargetSampleRate, ChordDSPCore::kFFTSize, ChordDSPCore::kHopSize, ChordDSPCore::kMelBins,
+                                        ChordDSPCore::kMinFreq, ChordDSPCore::kMaxFreq, melFrames);
+  melInput_.assign(kWindowSize, 0.0f);
+  melUpTo_ = 0;
+
+  dsp_.initOnsetDetector(sampleRate, kWindowSize, hopSize);
+  dsp_.warmup();
+  if (bassInterval_ > 0) dsp_.analyzeBass(bassWindow_.data(), kBassWindowSize, sampleRate, bass_);
+}
+
+void HybridStreamingChordAnalyzer::pushSamples(const std::shared_ptr<ArrayBuffer>& samples) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before pushSamples()");
+  }
+  Float32View in = float32View(samples, "samples");
+  ingest(in.data, PcmFormat::Float32, 1, in.size);
+}
+
+std::vector<double> HybridStreamingChordAnalyzer::pushPcm(const std::shared_ptr<ArrayBuffer>& samples, const std::string& format, double channels) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before pushPcm()");
+  }
+  if (!samples) {
+    throw std::invalid_argument("samples must be an ArrayBuffer");
+  }
+  PcmFormat pcm = parsePcmFormat(format);
+  if (channels < 1.0 || channels > kMaxChannels || channels != std::floor(channels)) {
+    throw std::invalid_argument("pushPcm: channels must be an integer in [1, " + std::to_string(kMaxChannels) + "], got " + std::to_string(channels));
+  }
+  int count = static_cast<int>(channels);
+  size_t frameBytes = pcmSampleBytes(pcm) * count;
+  size_t bytes = samples->size();
+  if (bytes % frameBytes != 0) {
+    throw std::invalid_argument("pushPcm: byte length " + std::to_string(bytes) + " is not a multiple of " + std::to_string(frameBytes) + " (" +
+                                std::to_string(count) + " " + format + " channels)");
+  }
+
+  size_t frames = bytes / frameBytes;
+  PcmLevels levels = ingest(samples->data(), pcm, count, frames);
+  double rms = frames > 0 ? std::sqrt(levels.sumSquares / std::min(frames, ring_->capacity())) : 0.0;
+  return {rms, levels.peak};
+}
+
+PcmLevels HybridStreamingChordAnalyzer::ingest(const void* data, PcmFormat format, int channels, size_t frames) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  size_t frameBytes = pcmSampleBytes(format) * channels;
+  PcmLevels levels;
+  ring_->writeWith(frames, [&](float* out, size_t offset, size_t n) {
+    conditionPcm(bytes + offset * frameBytes, format, channels, n, inputGain_, out, levels, preFilter_.get());
+  });
+  if (workerRunning_.load(std::memory_order_relaxed)) {
+    wake_.notify_one();
+  }
+  return levels;
+}
+
+double HybridStreamingChordAnalyzer::pullFrames(const std::shared_ptr<ArrayBuffer>& output) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before pullFrames()");
+  }
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, kFrameSize, "pullFrames");
+  size_t maxFrames = out.size / kFrameSize;
+
+  size_t frames = 0;
+  if (queue_) {
+    notifyPending_.store(false, std::memory_order_relaxed);
+    while (frames < maxFrames && queue_->pop(out.data + frames * kFrameSize)) frames++;
+  }
+  if (!workerRunning_.load(std::memory_order_relaxed)) {
+    while (frames < maxFrames && analyzeNextHop(out.data + frames * kFrameSize)) frames++;
+    flushChordEvents();
+  }
+  return static_cast<double>(frames);
+}
+
+bool HybridStreamingChordAnalyzer::analyzeNextHop(float* frame) {
+  uint64_t written = ring_->written();
+
+  // If we fell further behind than the ring can hold, drop the oldest hops
+  // (keeping hop alignment) instead of analyzing overwritten audio
+  uint64_t maxLag = ring_->capacity() - kWindowSize;
+  if (written - analyzedUpTo_ > maxLag) {
+    uint64_t behind = written - analyzedUpTo_ - maxLag;
+    analyzedUpTo_ += (behind + hopSize_ - 1) / hopSize_ * hopSize_;
+  }
+
+  if (analyzedUpTo_ + hopSize_ > written) return false;
+  analyzedUpTo_ += hopSize_;
+  analyzeHop(analyzedUpTo_, frame);
+  return true;
+}
+
+void HybridStreamingChordAnalyzer::analyzeHop(uint64_t end, float* frame) {
+  constexpr int kRms = ChordDSPCore::kAnalyzeFrameSize;
+  constexpr int kActive = kRms + 1;
+  std::fill(frame, frame + kFrameSize, 0.0f);
+
+  if (!ring_->read(end, window_.data(), kWindowSize)) return;
+
+  // Samples arrive gained and clamped from ingest()
+  double sumSquares = 0.0;
+  double sumDiffSquares = 0.0;
+  float previous = 0.0f;
+  for (int i = 0; i < kWindowSize; i++) {
+    float sample = window_[i];
+    sumSquares += sample * sample;
+    float diff = sample - previous;
+    sumDiffSquares += diff * diff;
+    previous = sample;
+  }
+  float rms = static_cast<float>(std::sqrt(sumSquares / kWindowSize));
+  frame[kRms] = rms;
+
+  // Silent hops skip the FFT and leave the onset detector untouched
+  if (rms < minRms_) {
+    lastValid_ = false;
+    if (segmenter_) segmenter_->reset();
+    if (chords_) trackNoChord(end, true);
+    return;
+  }
+
+  double brightness = sumSquares > 0.0 ? sumDiffSquares / sumSquares : 0.0;
+  if (isStationary(sumSquares, brightness)) {
+    // Nothing moved: repeat the last analysis without a new onset
+    heldHops_++;
+    std::copy(lastAnalysis_, lastAnalysis_ + ChordDSPCore::kAnalyzeFrameSize, frame);
+    frame[ChordDSPCore::kAnalyzeFrameSize - 2] = 0.0f;
+    frame[kRms] = rms;
+    frame[kActive] = kHeld;
+    if (!noisyHop_) {
+      finishHop(end, frame);
+    } else if (chords_) {
+      trackNoChord(end, false);
+    }
+    return;
+  }
+
+  // Onset runs every hop; chroma only every chromaStride() hops
+  bool foldChroma = !lastValid_ || scheduler_->nextHopFoldsChroma();
+  uint64_t start = PerfStats::now();
+  dsp_.analyzeFrame(window_.data(), kWindowSize, sampleRate_, frame, Normalization::Max, foldChroma);
+  if (!foldChroma) {
+    std::copy(lastAnalysis_, lastAnalysis_ + ChordDSPCore::kChromaFrameSize, frame);
+  }
+  if (foldChroma && bassInterval_ > 0) foldLongBass(end, frame);
+  frame[kActive] = kAnalyzed;
+  if (const float* features = dsp_.frameFeatures()) {
+    FeatureSnapshot snapshot;
+    std::copy(features, features + SpectralFeatures::kNumFeatures, snapshot.values);
+    features_.publish(snapshot);
+    noisyHop_ = noiseFlatness_ > 0.0f && features[SpectralFeatures::kFlatness] >= noiseFlatness_;
+  }
+  if (adaptive_) {
+    scheduler_->record(PerfStats::now() - start, backlogHops(end));
+  }
+
+  std::copy(frame, frame + ChordDSPCore::kAnalyzeFrameSize, lastAnalysis_);
+  lastEnergy_ = sumSquares;
+  lastBrightness_ = brightness;
+  lastValid_ = true;
+  heldHops_ = 0;
+  if (!noisyHop_) {
+    finishHop(end, frame);
+  } else if (chords_) {
+    trackNoChord(end, false);
+  }
+}
+
+void HybridStreamingChordAnalyzer::finishHop(uint64_t end, const float* frame) {
+  // Key first, so the chord tracker's key prior includes this hop
+  if (key_) key_->update(frame);
+  if (!segmenter_) {
+    if (chords_) trackChord(end, frame, frame[ChordDSPCore::kAnalyzeFrameSize - 2] > 0.0f);
+    return;
+  }
+  float segment[OnsetSegmenter::kSegmentSize];
+  if (segmenter_->push(frame, segment)) {
+    // A full queue drops the newest segment, like a full frame queue pauses
+    segments_->push(segment);
+    // [chroma x12, bassChroma x12, hops, onset, onsetDescriptor]
+    if (chords_) trackChord(end, segment, segment[25] > 0.0f);
+  }
+}
+
+void HybridStreamingChordAnalyzer::trackChord(uint64_t end, const float* values, bool isOnset) {
+  KeyEstimator::Estimate key;
+  if (key_) key = key_->estimate();
+  double nowMs = static_cast<double>(end) * 1000.0 / sampleRate_;
+  float event[ChordChangeTracker::kEventSize];
+  if (chords_->push(values, values + 12, isOnset, nowMs, key_ ? &key : nullptr, event)) {
+    chordEvents_.insert(chordEvents_.end(), event, event + ChordChangeTracker::kEventSize);
+  }
+}
+
+void HybridStreamingChordAnalyzer::trackNoChord(uint64_t end, bool silent) {
+  double nowMs = static_cast<double>(end) * 1000.0 / sampleRate_;
+  float event[ChordChangeTracker::kEventSize];
+  if (chords_->pushNoChord(silent, nowMs, event)) {
+    chordEvents_.insert(chordEvents_.end(), event, event + ChordChangeTracker::kEventSize);
+  }
+}
+
+void HybridStreamingChordAnalyzer::flushChordEvents() {
+  if (chordEvents_.empty() || !onChordEvents_) return;
+  auto now = std::chrono::steady_clock::now();
+  if (now - lastChordFlush_ < std::chrono::duration<double, std::milli>(chordEventIntervalMs_)) return;
+  lastChordFlush_ = now;
+  onChordEvents_(chordEvents_);
+  chordEvents_.clear();
+}
+
+void HybridStreamingChordAnalyzer::buildSegmenter() {
+  double hopSeconds = static_cast<double>(hopSize_) / sampleRate_;
+  int minHops = std::max(1, static_cast<int>(std::lround(segmentMinSeconds_ / hopSeconds)));
+  int maxHops = std::max(minHops, static_cast<int>(std::lround(segmentMaxSeconds_ / hopSeconds)));
+  segmenter_ = std::make_unique<OnsetSegmenter>(minHops, maxHops);
+  if (!segments_) segments_ = std::make_unique<FrameQueue>(OnsetSegmenter::kSegmentSize, kSegmentQueueSize);
+  segments_->clear();
+}
+
+void HybridStreamingChordAnalyzer::buildKeyEstimator() {
+  double hopSeconds = static_cast<double>(hopSize_) / sampleRate_;
+  key_ = std::make_unique<KeyEstimator>(static_cast<float>(std::exp2(-hopSeconds / keyHalfLife_)));
+}
+
+bool HybridStreamingChordAnalyzer::isStationary(double energy, double brightness) const {
+  if (changeTolerance_ <= 0.0f || !lastValid_ || heldHops_ >= maxHeldHops_) return false;
+  double tolerance = changeTolerance_;
+  return std::fabs(energy - lastEnergy_) <= tolerance * lastEnergy_ && std::fabs(brightness - lastBrightness_) <= tolerance * lastBrightness_;
+}
+
+size_t HybridStreamingChordAnalyzer::backlogHops(uint64_t end) const {
+  size_t hops = static_cast<size_t>((ring_->written() - end) / hopSize_);
+  if (queue_ && workerRunning_.load(std::memory_order_relaxed)) hops += queue_->size();
+  return hops;
+}
+
+double HybridStreamingChordAnalyzer::pullSegments(const std::shared_ptr<ArrayBuffer>& output) {
+  Float32View out = float32View(output, "output");
+  requireCapacity(out, OnsetSegmenter::kSegmentSize, "pullSegments");
+  if (!segments_) return 0.0;
+
+  size_t maxSegments = out.size / OnsetSegmenter::kSegmentSize;
+  size_t count = 0;
+  while (count < maxSegments && segments_->pop(out.data + count * OnsetSegmenter::kSegmentSize)) count++;
+  return static_cast<double>(count);
+}
+
+void HybridStreamingChordAnalyzer::foldLongBass(uint64_t end, float* frame) {
+  if (!lastValid_ || --bassCountdown_ <= 0) {
+    // Until a full long window was written, or when overtaken by the
+    // producer, keep the short bass and retry next fold
+    if (end < static_cast<uint64_t>(kBassWindowSize) || !ring_->read(end, bassWindow_.data(), kBassWindowSize)) return;
+    dsp_.analyzeBass(bassWindow_.data(), kBassWindowSize, sampleRate_, bass_);
+    bassCountdown_ = bassInterval_;
+  }
+  std::copy(bass_, bass_ + 12, frame + 12);
+}
+
+void HybridStreamingChordAnalyzer::readHistory(const std::shared_ptr<ArrayBuffer>& output) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before readHistory()");
+  }
+  Float32View out = float32View(output, "output");
+  size_t maxHistory = ring_->capacity() - kWindowSize;
+  if (out.size > maxHistory) {
+    throw std::invalid_argument("readHistory: output holds " + std::to_string(out.size) + " floats, history keeps at most " + std::to_string(maxHistory));
+  }
+
+  if (!ring_->read(ring_->written(), out.data, out.size)) {
+    std::fill(out.data, out.data + out.size, 0.0f);
+  }
+}
+
+void HybridStreamingChordAnalyzer::advanceMel() {
+  uint64_t written = ring_->written();
+
+  // Audio older than the ring is gone: restart the mel stream from the
+  // oldest sample still held
+  uint64_t maxLag = ring_->capacity() - kWindowSize;
+  if (written - melUpTo_ > maxLag) {
+    mel_->reset();
+    melUpTo_ = written - maxLag;
+  }
+
+  while (melUpTo_ < written) {
+    size_t n = static_cast<size_t>(std::min<uint64_t>(written - melUpTo_, melInput_.size()));
+    if (!ring_->read(melUpTo_ + n, melInput_.data(), n)) {
+      mel_->reset();
+      melUpTo_ = written;
+      return;
+    }
+    mel_->push(melInput_.data(), n);
+    melUpTo_ += n;
+  }
+}
+
+double HybridStreamingChordAnalyzer::readMelWindow(const std::shared_ptr<ArrayBuffer>& output) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before readMelWindow()");
+  }
+  Float32View out = float32View(output, "output");
+  int frames = static_cast<int>(out.size / ChordDSPCore::kMelBins);
+  if (frames > mel_->maxFrames()) {
+    throw std::invalid_argument("readMelWindow: output holds " + std::to_string(frames) + " mel frames, history keeps at most " + std::to_string(mel_->maxFrames()));
+  }
+
+  advanceMel();
+  mel_->latest(out.data, frames);
+  return static_cast<double>(frames);
+}
+
+double HybridStreamingChordAnalyzer::readMelWindowShared(double frames) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before readMelWindowShared()");
+  }
+  if (!std::isfinite(frames) || frames < 1.0 || frames > mel_->maxFrames()) {
+    throw std::invalid_argument("readMelWindowShared: frames must be in [1, " + std::to_string(mel_->maxFrames()) + "], got " + std::to_string(frames));
+  }
+  int count = static_cast<int>(frames);
+  size_t size = static_cast<size_t>(count) * ChordDSPCore::kMelBins;
+
+  // A consumer still reading the previous window keeps it: write a new buffer
+  SharedBufferRegistry& registry = SharedBufferRegistry::shared();
+  if (sharedMel_ && (sharedMelSize_ != size || registry.isRetained(sharedMel_))) {
+    registry.destroy(sharedMel_);
+    sharedMel_ = 0;
+  }
+  if (!sharedMel_) {
+    sharedMel_ = registry.create(size);
+    sharedMelSize_ = size;
+  }
+
+  advanceMel();
+  mel_->latest(registry.data(sharedMel_), count);
+  return static_cast<double>(sharedMel_);
+}
+
+void HybridStreamingChordAnalyzer::reset() {
+  // The worker owns the analysis state while it runs: pause it around the reset
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  if (ring_) ring_->reset();
+  if (preFilter_) preFilter_->reset();
+  if (mel_) mel_->reset();
+  if (queue_) queue_->clear();
+  analyzedUpTo_ = 0;
+  melUpTo_ = 0;
+  lastValid_ = false;
+  if (scheduler_) scheduler_->reset();
+  if (segmenter_) segmenter_->reset();
+  if (segments_) segments_->clear();
+  if (key_) key_->reset();
+  if (chords_) chords_->reset();
+  chordEvents_.clear();
+  dsp_.resetOnsetDetector();
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setHarmonicPercussive(bool enabled) {
+  // dsp_ belongs to the worker while it runs
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  dsp_.setHarmonicPercussive(enabled);
+  lastValid_ = false;
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setSpectralWhitening(bool enabled) {
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  dsp_.setSpectralWhitening(enabled);
+  lastValid_ = false;
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setTuningEstimation(bool enabled) {
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  dsp_.setTuningEstimation(enabled);
+  lastValid_ = false;
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+double HybridStreamingChordAnalyzer::getTuningOffset() {
+  // The estimator only changes while the worker is stopped; its value is atomic
+  return dsp_.tuningOffset();
+}
+
+void HybridStreamingChordAnalyzer::setSpectralFeatures(bool enabled, double noiseFlatness) {
+  if (!(noiseFlatness >= 0.0 && noiseFlatness <= 1.0)) {
+    throw std::invalid_argument("setSpectralFeatures: noiseFlatness must be in [0, 1], got " + std::to_string(noiseFlatness));
+  }
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  dsp_.setSpectralFeatures(enabled);
+  noiseFlatness_ = enabled ? static_cast<float>(noiseFlatness) : 0.0f;
+  noisyHop_ = false;
+  latestFeatures_ = FeatureSnapshot();
+  FeatureSnapshot stale;
+  features_.take(stale);
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+std::vector<double> HybridStreamingChordAnalyzer::getSpectralFeatures() {
+  // Enabling only changes while the worker is stopped; the values come
+  // through features_
+  if (!dsp_.spectralFeatures()) return {};
+  features_.take(latestFeatures_);
+  return std::vector<double>(latestFeatures_.values, latestFeatures_.values + SpectralFeatures::kNumFeatures);
+}
+
+void HybridStreamingChordAnalyzer::setPeakChroma(bool enabled) {
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  dsp_.setChromaAssignment(enabled ? ChromaAssignment::Peaks : ChromaAssignment::Nearest);
+  lastValid_ = false;
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setChangeGate(double tolerance, double maxHeldHops) {
+  if (!std::isfinite(tolerance) || tolerance < 0.0) {
+    throw std::invalid_argument("setChangeGate: tolerance must be finite and >= 0");
+  }
+  if (!std::isfinite(maxHeldHops) || maxHeldHops < 0.0) {
+    throw std::invalid_argument("setChangeGate: maxHeldHops must be finite and >= 0");
+  }
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  changeTolerance_ = static_cast<float>(tolerance);
+  maxHeldHops_ = static_cast<int>(maxHeldHops);
+  lastValid_ = false;
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setAdaptiveScheduling(bool enabled) {
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  adaptive_ = enabled;
+  if (scheduler_) scheduler_->reset();
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setThermalState(double state) {
+  if (!std::isfinite(state) || state < 0.0 || state > AnalysisScheduler::kMaxLevel) {
+    throw std::invalid_argument("setThermalState: state must be in [0, " + std::to_string(AnalysisScheduler::kMaxLevel) + "], got " + std::to_string(state));
+  }
+  // Only an atomic floor: no need to pause the worker
+  thermalState_ = static_cast<int>(state);
+  if (scheduler_) scheduler_->setFloor(thermalState_);
+}
+
+std::vector<double> HybridStreamingChordAnalyzer::getSchedule() {
+  int level = scheduler_ ? scheduler_->level() : thermalState_;
+  float load = scheduler_ ? scheduler_->load() : 0.0f;
+  return {static_cast<double>(level), static_cast<double>(AnalysisScheduler::chromaStride(level)), static_cast<double>(AnalysisScheduler::melStride(level)),
+          static_cast<double>(load)};
+}
+
+void HybridStreamingChordAnalyzer::setBassInterval(double hops) {
+  if (!std::isfinite(hops) || hops < 0.0 || hops > kMaxBassInterval) {
+    throw std::invalid_argument("setBassInterval: hops must be in [0, " + std::to_string(kMaxBassInterval) + "], got " + std::to_string(hops));
+  }
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  bassInterval_ = static_cast<int>(hops);
+  if (bassInterval_ > 0) {
+    bassWindow_.assign(kBassWindowSize, 0.0f);
+    // Builds the long plan and bass table before the worker needs them
+    if (sampleRate_ > 0.0) dsp_.analyzeBass(bassWindow_.data(), kBassWindowSize, sampleRate_, bass_);
+  } else {
+    bassWindow_ = std::vector<float>();
+  }
+  lastValid_ = false;
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setOnsetParameters(double threshold, double silenceDb, double minIoiMs) {
+  // Leaves the worker running: dsp_ hands the values to the analysis side
+  // lock-free and applies them between hops
+  dsp_.setOnsetParams(onsetParams(threshold, silenceDb, minIoiMs));
+}
+
+void HybridStreamingChordAnalyzer::setKeyEstimation(bool enabled, double halfLifeSeconds) {
+  if (enabled && !(std::isfinite(halfLifeSeconds) && halfLifeSeconds > 0.0)) {
+    throw std::invalid_argument("setKeyEstimation: halfLifeSeconds must be positive, got " + std::to_string(halfLifeSeconds));
+  }
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  keyHalfLife_ = enabled ? halfLifeSeconds : 0.0;
+  if (!enabled) {
+    key_.reset();
+  } else if (ring_) {
+    buildKeyEstimator();
+  }
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+std::vector<double> HybridStreamingChordAnalyzer::getKey() {
+  // key_ only changes while the worker is stopped; its estimate is atomic
+  KeyEstimator::Estimate estimate = key_ ? key_->estimate() : KeyEstimator::Estimate();
+  if (estimate.key < 0) return {-1.0, 0.0, 0.0, 0.0};
+  return {static_cast<double>(estimate.key % 12), static_cast<double>(estimate.key / 12), static_cast<double>(estimate.correlation),
+          static_cast<double>(estimate.margin)};
+}
+
+void HybridStreamingChordAnalyzer::setPreFilter(double dcCutoffHz, double highPassHz, double preEmphasis) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before setPreFilter()");
+  }
+  // Ingest runs on this thread, not the worker's
+  preFilter_ = makePreFilter(designPreFilter(sampleRate_, dcCutoffHz, highPassHz, preEmphasis, "setPreFilter"), "setPreFilter");
+  preFilterDesigned_ = preFilter_ != nullptr;
+  preFilterDcHz_ = dcCutoffHz;
+  preFilterHighPassHz_ = highPassHz;
+  preFilterEmphasis_ = preEmphasis;
+}
+
+void HybridStreamingChordAnalyzer::setPreFilterSections(const std::vector<double>& coefficients) {
+  if (coefficients.size() % 5 != 0) {
+    throw std::invalid_argument("setPreFilterSections: expected 5 coefficients per section, got " + std::to_string(coefficients.size()));
+  }
+  std::vector<BiquadCascade::Section> sections(coefficients.size() / 5);
+  for (size_t i = 0; i < sections.size(); i++) {
+    const double* c = coefficients.data() + 5 * i;
+    sections[i] = {static_cast<float>(c[0]), static_cast<float>(c[1]), static_cast<float>(c[2]), static_cast<float>(c[3]), static_cast<float>(c[4])};
+  }
+  preFilter_ = makePreFilter(sections, "setPreFilterSections");
+  preFilterDesigned_ = false;
+}
+
+void HybridStreamingChordAnalyzer::setOnsetSegments(bool enabled, double minSeconds, double maxSeconds) {
+  if (enabled && !(std::isfinite(minSeconds) && std::isfinite(maxSeconds) && minSeconds >= 0.0 && maxSeconds > 0.0 && maxSeconds >= minSeconds)) {
+    throw std::invalid_argument("setOnsetSegments: need 0 <= minSeconds <= maxSeconds and maxSeconds > 0");
+  }
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  segmentsEnabled_ = enabled;
+  segmentMinSeconds_ = minSeconds;
+  segmentMaxSeconds_ = maxSeconds;
+  if (!enabled) {
+    segmenter_.reset();
+    segments_.reset();
+  } else if (ring_) {
+    buildSegmenter();
+  }
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::startWorker(double callbackIntervalMs, const std::function<void(double)>& onFrames) {
+  if (!ring_) {
+    throw std::invalid_argument("StreamingChordAnalyzer: configure() must be called before startWorker()");
+  }
+  if (!std::isfinite(callbackIntervalMs) || callbackIntervalMs < 0.0) {
+    throw std::invalid_argument("startWorker: callbackIntervalMs must be finite and >= 0");
+  }
+  // Copy first: reset() passes our own members back in
+  std::function<void(double)> callback = onFrames;
+  stopWorker();
+
+  onFrames_ = std::move(callback);
+  callbackIntervalMs_ = callbackIntervalMs;
+  if (!queue_) {
+    size_t capacity = static_cast<size_t>(std::ceil(kWorkerQueueSeconds * sampleRate_ / static_cast<double>(hopSize_)));
+    queue_ = std::make_unique<FrameQueue>(kFrameSize, capacity);
+  }
+  notifyPending_.store(false, std::memory_order_relaxed);
+  workerRunning_.store(true, std::memory_order_release);
+  worker_ = std::thread([this] { workerLoop(); });
+}
+
+void HybridStreamingChordAnalyzer::stopWorker() {
+  if (!worker_.joinable()) return;
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex_);
+    workerRunning_.store(false, std::memory_order_release);
+  }
+  wake_.notify_one();
+  worker_.join();
+}
+
+void HybridStreamingChordAnalyzer::startChordEvents(double minHoldMs, double minFramesToConfirm, double hysteresisMargin, double confidenceBand,
+                                                    double frameIntervalMs, const std::function<void(const std::vector<double>&)>& onEvents) {
+  if (!(std::isfinite(minHoldMs) && minHoldMs >= 0.0)) {
+    throw std::invalid_argument("startChordEvents: minHoldMs must be finite and >= 0");
+  }
+  if (!(minFramesToConfirm >= 1.0 && minFramesToConfirm <= 64.0)) {
+    throw std::invalid_argument("startChordEvents: minFramesToConfirm must be in [1, 64], got " + std::to_string(minFramesToConfirm));
+  }
+  if (!(std::isfinite(hysteresisMargin) && hysteresisMargin >= 0.0)) {
+    throw std::invalid_argument("startChordEvents: hysteresisMargin must be finite and >= 0");
+  }
+  if (!(confidenceBand > 0.0 && confidenceBand <= 1.0)) {
+    throw std::invalid_argument("startChordEvents: confidenceBand must be in (0, 1], got " + std::to_string(confidenceBand));
+  }
+  if (!(std::isfinite(frameIntervalMs) && frameIntervalMs >= 0.0)) {
+    throw std::invalid_argument("startChordEvents: frameIntervalMs must be finite and >= 0");
+  }
+  ChordChangeTracker::Params params;
+  params.minHoldMs = minHoldMs;
+  params.minFramesToConfirm = static_cast<int>(minFramesToConfirm);
+  params.hysteresisMargin = static_cast<float>(hysteresisMargin);
+  params.confidenceBand = static_cast<float>(confidenceBand);
+
+  // The tracker belongs to the worker while it runs
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  chords_ = std::make_unique<ChordChangeTracker>(params);
+  chordEvents_.clear();
+  // Room for a second of per-hop events, so queuing does not allocate
+  chordEvents_.reserve(static_cast<size_t>(kChordEventReserve) * ChordChangeTracker::kEventSize);
+  onChordEvents_ = onEvents;
+  chordEventIntervalMs_ = frameIntervalMs;
+  // The first batch goes out as soon as it exists
+  lastChordFlush_ = std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(frameIntervalMs));
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::stopChordEvents() {
+  bool restart = workerRunning_.load(std::memory_order_relaxed);
+  stopWorker();
+
+  chords_.reset();
+  chordEvents_.clear();
+  onChordEvents_ = nullptr;
+
+  if (restart) {
+    startWorker(callbackIntervalMs_, onFrames_);
+  }
+}
+
+void HybridStreamingChordAnalyzer::setChordHint(double root, double quality, double confidence) {
+  int chord = -1;
+  if (root >= 0.0) {
+    if (root >= 12.0 || quality < 0.0 || quality >= static_cast<double>(kNumChordQualities)) {
+      throw std::invalid_argument("setChordHint: root must be -1 or in [0, 12) and quality in [0, " + std::to_string(kNumChordQualities) + ")");
+    }
+    chord = ChordCandidate{static_cast<int>(root), static_cast<int>(quality)}.index();
+  }
+  // chords_ only changes on this thread; the hint itself is handed over lock-free
+  if (chords_) chords_->setHint(chord, static_cast<float>(confidence));
+}
+
+void HybridStreamingChordAnalyzer::workerLoop() {
+  using Clock = std::chrono::steady_clock;
+  raiseWorkerPriority();
+
+  std::vector<float> frame(kFrameSize);
+  auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(callbackIntervalMs_));
+  auto hop = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(static_cast<double>(hopSize_) / sampleRate_));
+  // Poll at least once per hop in case a wake-up from pushSamples() is missed
+  auto maxWait = std::max(std::min(hop, interval), Clock::duration(std::chrono::milliseconds(1)));
+  auto lastNotify = Clock::now() - interval;
+
+  while (workerRunning_.load(std::memory_order_acquire)) {
+    while (queue_->size() < queue_->capacity() && analyzeNextHop(frame.data())) {
+      queue_->push(frame.data());
+    }
+
+    size_t available = queue_->size();
+    auto now = Clock::now();
+    if (available > 0 && onFrames_ && now - lastNotify >= interval && !notifyPending_.exchange(true, std::memory_order_relaxed)) {
+      lastNotify = now;
+      onFrames_(static_cast<double>(available));
+    }
+    flushChordEvents();
+
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    wake_.wait_for(lock, maxWait, [this] {
+      return !workerRunning_.load(std::memory_order_relaxed) ||
+             (queue_->size() < queue_->capacity() && analyzedUpTo_ + hopSize_ <= ring_->written());
+    });
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
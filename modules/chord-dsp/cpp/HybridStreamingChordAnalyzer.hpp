@@ -0,0 +1,244 @@
+#pragma once
+
+#include "HybridStreamingChordAnalyzerSpec.hpp"
+#include "dsp/AnalysisScheduler.hpp"
+#include "dsp/BiquadCascade.hpp"
+#include "dsp/ChordChangeTracker.hpp"
+#include "dsp/ChordDSPCore.hpp"
+#include "dsp/FrameQueue.hpp"
+#include "dsp/KeyEstimator.hpp"
+#include "dsp/OnsetSegmenter.hpp"
+#include "dsp/SampleRing.hpp"
+#include "dsp/SnapshotExchange.hpp"
+#include "dsp/SpectralFeatures.hpp"
+#include "dsp/StreamingMel.hpp"
+#include "dsp/VectorOps.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Keeps the live audio history natively. pushSamples() and pushPcm() are the
+// producer side of a lock-free SPSC ring: they convert, downmix, gain,
+// pre-filter and clamp each chunk in one pass straight into it.
+// pullFrames() consumes it one hop at a time and runs the RMS gate, change
+// gate and ChordDSPCore::analyzeFrame() per hop, folding chroma as often as
+// the AnalysisScheduler level allows.
+// With startWorker() that consumer is a native thread instead, which hands
+// finished frames to pullFrames() through a second SPSC queue; dsp_ and the
+// analysis position then belong to the worker until stopWorker().
+//
+// The ring also feeds a dual-resolution front end: every hop gets the short
+// kFFTSize transform (onsets and chroma), and with setBassInterval() every
+// few folding hops also a ChordDSPCore::kBassFFTSize one whose bass chroma
+// replaces the short one until the next.
+//
+// startChordEvents() moves the chord decision itself onto the analysis
+// side: a ChordChangeTracker judges every segment (or active hop) and its
+// change events are handed to JS in batches, so the UI hears about chords
+// only when they change.
+class HybridStreamingChordAnalyzer : public HybridStreamingChordAnalyzerSpec {
+public:
+  HybridStreamingChordAnalyzer() : HybridObject(TAG) {}
+  ~HybridStreamingChordAnalyzer() override;
+
+  void configure(double sampleRate, double hopSize, double historySize, double inputGain, double minRms) override;
+  void pushSamples(const std::shared_ptr<ArrayBuffer>& samples) override;
+  std::vector<double> pushPcm(const std::shared_ptr<ArrayBuffer>& samples, const std::string& format, double channels) override;
+  double pullFrames(const std::shared_ptr<ArrayBuffer>& output) override;
+  double pullSegments(const std::shared_ptr<ArrayBuffer>& output) override;
+  void readHistory(const std::shared_ptr<ArrayBuffer>& output) override;
+  double readMelWindow(const std::shared_ptr<ArrayBuffer>& output) override;
+  double readMelWindowShared(double frames) override;
+  void reset() override;
+  void setHarmonicPercussive(bool enabled) override;
+  void setSpectralWhitening(bool enabled) override;
+  void setTuningEstimation(bool enabled) override;
+  double getTuningOffset() override;
+  void setSpectralFeatures(bool enabled, double noiseFlatness) override;
+  std::vector<double> getSpectralFeatures() override;
+  void setPeakChroma(bool enabled) override;
+  void setChangeGate(double tolerance, double maxHeldHops) override;
+  void setAdaptiveScheduling(bool enabled) override;
+  void setThermalState(double state) override;
+  std::vector<double> getSchedule() override;
+  void setOnsetSegments(bool enabled, double minSeconds, double maxSeconds) override;
+  void setBassInterval(double hops) override;
+  void setOnsetParameters(double threshold, double silenceDb, double minIoiMs) override;
+  void setKeyEstimation(bool enabled, double halfLifeSeconds) override;
+  std::vector<double> getKey() override;
+  void setPreFilter(double dcCutoffHz, double highPassHz, double preEmphasis) override;
+  void setPreFilterSections(const std::vector<double>& coefficients) override;
+  void startWorker(double callbackIntervalMs, const std::function<void(double)>& onFrames) override;
+  void stopWorker() override;
+  void startChordEvents(double minHoldMs, double minFramesToConfirm, double hysteresisMargin, double confidenceBand, double frameIntervalMs,
+                        const std::function<void(const std::vector<double>&)>& onEvents) override;
+  void stopChordEvents() override;
+  void setChordHint(double root, double quality, double confidence) override;
+
+  // pullFrames() layout: analyzeFrame() values followed by [rms, active]
+  static constexpr int kFrameSize = ChordDSPCore::kAnalyzeFrameSize + 2;
+  // `active` values: below minRms, analyzed, or repeated by the change gate
+  static constexpr float kInactive = 0.0f;
+  static constexpr float kAnalyzed = 1.0f;
+  static constexpr float kHeld = 2.0f;
+
+private:
+  static constexpr int kWindowSize = ChordDSPCore::kFFTSize;
+  static constexpr int kBassWindowSize = ChordDSPCore::kBassFFTSize;
+  // Worker queue length, in seconds of hops
+  static constexpr double kWorkerQueueSeconds = 2.0;
+  // Finished onset segments waiting for pullSegments()
+  static constexpr size_t kSegmentQueueSize = 64;
+  // setBassInterval() limit, ~4 s of 1024-sample hops at 16 kHz
+  static constexpr int kMaxBassInterval = 64;
+  // pushPcm() channel limit
+  static constexpr int kMaxChannels = 8;
+  // Chord events reserved up front, a second of 1024-sample hops at 48 kHz
+  static constexpr int kChordEventReserve = 48;
+
+  // Conditions `frames` interleaved frames into the ring and wakes the worker
+  PcmLevels ingest(const void* data, PcmFormat format, int channels, size_t frames);
+
+  // Analyzes the next completed hop into frame, first dropping hops the ring
+  // no longer holds. Returns false if no hop is complete.
+  bool analyzeNextHop(float* frame);
+
+  // Gates the window ending at `end`, then analyzes it into frame
+  void analyzeHop(uint64_t end, float* frame);
+  // Change gate test against the last analyzed window
+  bool isStationary(double energy, double brightness) const;
+  // Hops waiting behind the one ending at `end`: unread ring audio plus
+  // frames the worker queued
+  size_t backlogHops(uint64_t end) const;
+  // Feeds the audio written since the last call into mel_
+  void advanceMel();
+  // Writes the long-window bass chroma into frame's bass range, recomputing
+  // it from the window ending at `end` when due
+  void foldLongBass(uint64_t end, float* frame);
+
+  ChordDSPCore dsp_;
+  std::unique_ptr<SampleRing> ring_;
+  std::vector<float> window_;
+
+  // Incremental mel for the ML window, advanced lazily by readMelWindow()
+  std::unique_ptr<StreamingMel> mel_;
+  std::vector<float> melInput_;
+  // Absolute ring position already fed into mel_
+  uint64_t melUpTo_ = 0;
+  // SharedBufferRegistry handle readMelWindowShared() writes into, 0 until
+  // first use
+  int64_t sharedMel_ = 0;
+  size_t sharedMelSize_ = 0;
+
+  double sampleRate_ = 0.0;
+  uint64_t hopSize_ = 0;
+  float inputGain_ = 1.0f;
+  float minRms_ = 0.0f;
+
+  // Pre-filter of the ingest pass, null while off. Producer side, like the
+  // ring's write position, so setting it never pauses the worker. Designed
+  // filters keep their parameters for configure() to redesign at the new
+  // sample rate; custom sections are kept as given.
+  std::unique_ptr<BiquadCascade> preFilter_;
+  bool preFilterDesigned_ = false;
+  double preFilterDcHz_ = 0.0;
+  double preFilterHighPassHz_ = 0.0;
+  double preFilterEmphasis_ = 0.0;
+
+  // Last analyzed frame, its window energy and brightness (first-difference
+  // energy over energy, a cheap stand-in for the spectral centroid); cleared
+  // by silence and by anything that changes the analysis
+  bool lastValid_ = false;
+  float lastAnalysis_[ChordDSPCore::kAnalyzeFrameSize] = {};
+  double lastEnergy_ = 0.0;
+  double lastBrightness_ = 0.0;
+
+  // Change gate: a hop whose energy and brightness are both within
+  // changeTolerance_ of the last analyzed window's repeats that analysis, at
+  // most maxHeldHops_ times in a row. Off while the tolerance is 0.
+  float changeTolerance_ = 0.0f;
+  int maxHeldHops_ = 0;
+  int heldHops_ = 0;
+
+  // Spectral features of the analyzed hops while dsp_ computes them, handed
+  // from the analysis side to getSpectralFeatures(). Hops whose flatness
+  // reaches noiseFlatness_ (0 = off), and the held hops repeating them, skip
+  // finishHop() and count as no chord for the tracker.
+  struct FeatureSnapshot {
+    float values[SpectralFeatures::kNumFeatures];
+  };
+  SnapshotExchange<FeatureSnapshot> features_;
+  FeatureSnapshot latestFeatures_ = {};
+  float noiseFlatness_ = 0.0f;
+  bool noisyHop_ = false;
+
+  // Onset segments of the analyzed hops, null while disabled or before
+  // configure(), which rebuilds them for the new hop duration
+  bool segmentsEnabled_ = false;
+  std::unique_ptr<OnsetSegmenter> segmenter_;
+  std::unique_ptr<FrameQueue> segments_;
+  double segmentMinSeconds_ = 0.0;
+  double segmentMaxSeconds_ = 0.0;
+  void buildSegmenter();
+  // Feeds a finished active frame to the segmenter, the key estimate and
+  // the chord tracker, and queues the segment it closes
+  void finishHop(uint64_t end, const float* frame);
+
+  // Key of the active hops' chroma, null while disabled or before
+  // configure(), which rebuilds it for the new hop duration
+  double keyHalfLife_ = 0.0;
+  std::unique_ptr<KeyEstimator> key_;
+  void buildKeyEstimator();
+
+  // Chord decisions for startChordEvents(), null while off. Analysis side
+  // like dsp_: events wait in chordEvents_ until flushChordEvents() hands
+  // them to onChordEvents_, at most once per chordEventIntervalMs_.
+  std::unique_ptr<ChordChangeTracker> chords_;
+  std::vector<double> chordEvents_;
+  std::function<void(const std::vector<double>&)> onChordEvents_;
+  double chordEventIntervalMs_ = 0.0;
+  std::chrono::steady_clock::time_point lastChordFlush_;
+  // Runs the tracker on [chroma x12, bassChroma x12] of the hop ending at `end`
+  void trackChord(uint64_t end, const float* values, bool isOnset);
+  // Tells the tracker the hop ending at `end` was silent or noise
+  void trackNoChord(uint64_t end, bool silent);
+  void flushChordEvents();
+
+  // Long bass transform every bassInterval_ folding hops (0 = off), reused
+  // in between and recomputed first thing after lastValid_ was cleared
+  int bassInterval_ = 0;
+  int bassCountdown_ = 0;
+  float bass_[12] = {};
+  std::vector<float> bassWindow_;
+
+  // Chroma stride from load and backlog (when adaptive_) or the thermal floor
+  std::unique_ptr<AnalysisScheduler> scheduler_;
+  bool adaptive_ = false;
+  int thermalState_ = 0;
+
+  // Absolute ring position of the last analyzed hop (consumer side)
+  uint64_t analyzedUpTo_ = 0;
+
+  void workerLoop();
+
+  // Analyzed frames from the worker, drained by pullFrames()
+  std::unique_ptr<FrameQueue> queue_;
+  std::thread worker_;
+  std::atomic<bool> workerRunning_{false};
+  // Set when onFrames_ fired, cleared by pullFrames()
+  std::atomic<bool> notifyPending_{false};
+  std::mutex wakeMutex_;
+  std::condition_variable wake_;
+  std::function<void(double)> onFrames_;
+  double callbackIntervalMs_ = 0.0;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -1,12 +1,15 @@
 /*
- * Minimal config.h for aubio 0.4.9 — iOS/Accelerate onset detection only.
+ * Minimal config.h for aubio 0.4.9 — onset detection only.
  * Generated for the chord-dsp Nitro module.
+ *
+ * Apple builds use Accelerate; everything else (Android) falls through to
+ * aubio's bundled Ooura FFT and plain C loops.
  */
 
 #ifndef AUBIO_CONFIG_H
 #define AUBIO_CONFIG_H
 
-/* Standard library headers — always available on iOS */
+/* Standard library headers — available on iOS and the Android NDK */
 #define HAVE_STDLIB_H 1
 #define HAVE_STDIO_H 1
 #define HAVE_MATH_H 1
@@ -19,10 +22,15 @@
 #define HAVE_C99_VARARGS_MACROS 1
 
 /* Accelerate framework for FFT + BLAS on iOS/macOS */
-#ifndef HAVE_ACCELERATE
+#if defined(__APPLE__) && !defined(HAVE_ACCELERATE)
 #define HAVE_ACCELERATE 1
 #endif
 
+/* Plain memcpy/memset for vector copies instead of element loops */
+#define HAVE_MEMCPY_HACKS 1
+
+/* NEON / SSE2 kernels for the non-Accelerate vector utilities, see simd.h */
+
 /* We do NOT use double precision — aubio defaults to float (smpl_t = float) */
 /* #undef HAVE_AUBIO_DOUBLE */
 
@@ -20,6 +20,7 @@
 
 #include "aubio_priv.h"
 #include "cvec.h"
+#include "simd.h"
 
 cvec_t * new_cvec(uint_t length) {
   cvec_t * s;
@@ -103,6 +104,8 @@ void cvec_copy(const cvec_t *s, cvec_t *t) {
 void cvec_norm_set_all(cvec_t *s, smpl_t val) {
 #if defined(HAVE_INTEL_IPP)
   aubio_ippsSet(val, s->norm, (int)s->length);
+#elif defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vfill(val, s->norm, s->length);
 #else
   uint_t j;
   for (j=0; j< s->length; j++) {
@@ -128,6 +131,8 @@ void cvec_norm_ones(cvec_t *s) {
 void cvec_phas_set_all (cvec_t *s, smpl_t val) {
 #if defined(HAVE_INTEL_IPP)
   aubio_ippsSet(val, s->phas, (int)s->length);
+#elif defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vfill(val, s->phas, s->length);
 #else
   uint_t j;
   for (j=0; j< s->length; j++) {
@@ -160,6 +165,8 @@ void cvec_logmag(cvec_t *s, smpl_t lambda) {
   aubio_ippsMulC(s->norm, lambda, s->norm, (int)s->length);
   aubio_ippsAddC(s->norm, 1.0, s->norm, (int)s->length);
   aubio_ippsLn(s->norm, s->norm, (int)s->length);
+#elif defined(HAVE_AUBIO_SIMD)
+  aubio_simd_logmag(s->norm, lambda, s->length);
 #else
   uint_t j;
   for (j=0; j< s->length; j++) {
@@ -20,6 +20,7 @@
 
 #include "aubio_priv.h"
 #include "fvec.h"
+#include "simd.h"
 
 fvec_t * new_fvec(uint_t length) {
   fvec_t * s;
@@ -66,6 +67,8 @@ void fvec_set_all (fvec_t *s, smpl_t val) {
   aubio_catlas_set(s->length, val, s->data, 1);
 #elif defined(HAVE_ACCELERATE)
   aubio_vDSP_vfill(&val, s->data, 1, s->length);
+#elif defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vfill(val, s->data, s->length);
 #else
   uint_t j;
   for ( j = 0; j< s->length; j++ )
@@ -104,6 +107,8 @@ void fvec_weight(fvec_t *s, const fvec_t *weight) {
   aubio_ippsMul(s->data, weight->data, s->data, (int)length);
 #elif defined(HAVE_ACCELERATE)
   aubio_vDSP_vmul( s->data, 1, weight->data, 1, s->data, 1, length );
+#elif defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vmul(s->data, weight->data, s->data, length);
 #else
   uint_t j;
   for (j = 0; j < length; j++) {
@@ -118,6 +123,8 @@ void fvec_weighted_copy(const fvec_t *in, const fvec_t *weight, fvec_t *out) {
   aubio_ippsMul(in->data, weight->data, out->data, (int)length);
 #elif defined(HAVE_ACCELERATE)
   aubio_vDSP_vmul(in->data, 1, weight->data, 1, out->data, 1, length);
+#elif defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vmul(in->data, weight->data, out->data, length);
 #else
   uint_t j;
   for (j = 0; j < length; j++) {
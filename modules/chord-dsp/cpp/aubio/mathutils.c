@@ -24,6 +24,7 @@
 #include "fvec.h"
 #include "mathutils.h"
 #include "musicutils.h"
+#include "simd.h"
 
 /** Window types */
 typedef enum
@@ -165,6 +166,9 @@ fvec_mean (fvec_t * s)
 #elif defined(HAVE_ACCELERATE)
   aubio_vDSP_meanv(s->data, 1, &tmp, s->length);
   return tmp;
+#elif defined(HAVE_AUBIO_SIMD)
+  tmp = aubio_simd_sum(s->data, s->length);
+  return tmp / (smpl_t)(s->length);
 #else
   uint_t j;
   for (j = 0; j < s->length; j++) {
@@ -182,6 +186,8 @@ fvec_sum (fvec_t * s)
   aubio_ippsSum(s->data, (int)s->length, &tmp);
 #elif defined(HAVE_ACCELERATE)
   aubio_vDSP_sve(s->data, 1, &tmp, s->length);
+#elif defined(HAVE_AUBIO_SIMD)
+  tmp = aubio_simd_sum(s->data, s->length);
 #else
   uint_t j;
   for (j = 0; j < s->length; j++) {
@@ -200,6 +206,8 @@ fvec_max (fvec_t * s)
 #elif defined(HAVE_ACCELERATE)
   smpl_t tmp = 0.;
   aubio_vDSP_maxv( s->data, 1, &tmp, s->length );
+#elif defined(HAVE_AUBIO_SIMD)
+  smpl_t tmp = aubio_simd_max(s->data, s->length);
 #else
   uint_t j;
   smpl_t tmp = s->data[0];
@@ -219,6 +227,8 @@ fvec_min (fvec_t * s)
 #elif defined(HAVE_ACCELERATE)
   smpl_t tmp = 0.;
   aubio_vDSP_minv(s->data, 1, &tmp, s->length);
+#elif defined(HAVE_AUBIO_SIMD)
+  smpl_t tmp = aubio_simd_min(s->data, s->length);
 #else
   uint_t j;
   smpl_t tmp = s->data[0];
@@ -381,19 +391,27 @@ fvec_alpha_normalise (fvec_t * o, smpl_t alpha)
 void
 fvec_add (fvec_t * o, smpl_t val)
 {
+#if defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vsadd(o->data, val, o->data, o->length);
+#else
   uint_t j;
   for (j = 0; j < o->length; j++) {
     o->data[j] += val;
   }
+#endif
 }
 
 void
 fvec_mul (fvec_t *o, smpl_t val)
 {
+#if defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vsmul(o->data, val, o->data, o->length);
+#else
   uint_t j;
   for (j = 0; j < o->length; j++) {
     o->data[j] *= val;
   }
+#endif
 }
 
 void fvec_adapt_thres(fvec_t * vec, fvec_t * tmp,
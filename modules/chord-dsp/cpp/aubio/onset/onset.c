@@ -30,6 +30,20 @@
 
 void aubio_onset_default_parameters (aubio_onset_t *o, const char_t * method);
 
+static void aubio_onset_do_fftgrain (aubio_onset_t *o, const fvec_t * input,
+    fvec_t * onset);
+
+/** maximum number of descriptors added with aubio_onset_add_descriptor */
+#define AUBIO_ONSET_MAX_EXTRA 7
+
+/** extra novelty function computed from the same fftgrain as od */
+typedef struct {
+  aubio_specdesc_t * od;        /**< spectral descriptor */
+  aubio_spectral_whitening_t * whitening; /**< NULL if not whitened */
+  smpl_t lambda_compression;    /**< log compression, 0 if disabled */
+  fvec_t * desc;                /**< raw descriptor value */
+} aubio_onset_novelty_t;
+
 /** structure to store object state */
 struct _aubio_onset_t {
   aubio_pvoc_t * pv;            /**< phase vocoder */
@@ -50,24 +64,102 @@ struct _aubio_onset_t {
   smpl_t lambda_compression;
   uint_t apply_awhitening;      /**< apply adaptive spectral whitening */
   aubio_spectral_whitening_t *spectral_whitening;
+
+  /* descriptor fusion, only used once aubio_onset_add_descriptor was called */
+  uint_t n_extra;               /**< number of extra descriptors */
+  aubio_onset_novelty_t extra[AUBIO_ONSET_MAX_EXTRA];
+  smpl_t weight[AUBIO_ONSET_MAX_EXTRA + 1]; /**< fusion weights, od first */
+  smpl_t scale[AUBIO_ONSET_MAX_EXTRA + 1];  /**< running means, < 0 until set */
+  smpl_t raw;                   /**< od value before fusion */
+  cvec_t * scratch;             /**< fftgrain copy for extra descriptors */
+  uint_t input_whitened;        /**< fftgrain came whitened, skip whitening */
 };
 
 /* execute onset detection function on iput buffer */
 void aubio_onset_do (aubio_onset_t *o, const fvec_t * input, fvec_t * onset)
 {
-  smpl_t isonset = 0;
   aubio_pvoc_do (o->pv,input, o->fftgrain);
+  aubio_onset_do_fftgrain (o, input, onset);
+}
+
+void aubio_onset_do_spectrum (aubio_onset_t *o, const fvec_t * input,
+    const cvec_t * fftgrain, fvec_t * onset)
+{
+  cvec_copy (fftgrain, o->fftgrain);
+  aubio_onset_do_fftgrain (o, input, onset);
+}
+
+void aubio_onset_do_whitened_spectrum (aubio_onset_t *o, const fvec_t * input,
+    const cvec_t * fftgrain, fvec_t * onset)
+{
+  cvec_copy (fftgrain, o->fftgrain);
+  o->input_whitened = 1;
+  aubio_onset_do_fftgrain (o, input, onset);
+  o->input_whitened = 0;
+}
+
+/* extra descriptors, each from its own preprocessed copy of the raw grain */
+static void aubio_onset_do_extra (aubio_onset_t *o)
+{
+  uint_t i;
+  for (i = 0; i < o->n_extra; i++) {
+    aubio_onset_novelty_t *n = &o->extra[i];
+    cvec_copy(o->fftgrain, o->scratch);
+    if (n->whitening && !o->input_whitened) {
+      aubio_spectral_whitening_do(n->whitening, o->scratch);
+    }
+    if (n->lambda_compression > 0.) {
+      cvec_logmag(o->scratch, n->lambda_compression);
+    }
+    aubio_specdesc_do (n->od, o->scratch, n->desc);
+  }
+}
+
+/* replace o->desc with the weighted sum of all descriptors, each divided by
+ * its running mean so that their different ranges become comparable */
+static void aubio_onset_fuse (aubio_onset_t *o)
+{
+  /* running mean time constant of about two seconds */
+  smpl_t alpha = (smpl_t)o->hop_size / (2. * o->samplerate);
+  smpl_t fused = 0., total = 0.;
+  uint_t i;
+  o->raw = o->desc->data[0];
+  for (i = 0; i <= o->n_extra; i++) {
+    smpl_t value = i == 0 ? o->raw : o->extra[i - 1].desc->data[0];
+    if (o->scale[i] < 0.) {
+      o->scale[i] = value;
+    } else {
+      o->scale[i] += alpha * (value - o->scale[i]);
+    }
+    fused += o->weight[i] * value / MAX(o->scale[i], 1.e-6);
+    total += o->weight[i];
+  }
+  o->desc->data[0] = total > 0. ? fused / total : 0.;
+}
+
+/* everything after the phase vocoder: whitening, descriptor, peak picking */
+static void aubio_onset_do_fftgrain (aubio_onset_t *o, const fvec_t * input,
+    fvec_t * onset)
+{
+  smpl_t isonset = 0;
   /*
   if (apply_filtering) {
   }
   */
-  if (o->apply_awhitening) {
+  if (o->n_extra) {
+    /* before od's whitening and compression modify fftgrain in place */
+    aubio_onset_do_extra(o);
+  }
+  if (o->apply_awhitening && !o->input_whitened) {
     aubio_spectral_whitening_do(o->spectral_whitening, o->fftgrain);
   }
   if (o->apply_compression) {
     cvec_logmag(o->fftgrain, o->lambda_compression);
   }
   aubio_specdesc_do (o->od, o->fftgrain, o->desc);
+  if (o->n_extra) {
+    aubio_onset_fuse(o);
+  }
   aubio_peakpicker_do(o->pp, o->desc, onset);
   isonset = onset->data[0];
   if (isonset > 0.) {
@@ -168,6 +260,104 @@ smpl_t aubio_onset_get_threshold(const aubio_onset_t * o) {
   return aubio_peakpicker_get_threshold(o->pp);
 }
 
+/* whitening and compression an extra descriptor gets, following
+ * aubio_onset_set_default_parameters for the same method */
+static void aubio_onset_novelty_defaults (aubio_onset_t *o,
+    aubio_onset_novelty_t *n, const char_t * method)
+{
+  uint_t buf_size = (o->fftgrain->length - 1) * 2;
+  uint_t whiten = 0;
+  n->lambda_compression = 0.;
+  if (strcmp (method, "hfc") == 0 || strcmp (method, "default") == 0) {
+    n->lambda_compression = 1.;
+  } else if (strcmp (method, "complexdomain") == 0
+             || strcmp (method, "complex") == 0) {
+    whiten = 1;
+    n->lambda_compression = 1.;
+  } else if (strcmp (method, "mkl") == 0 || strcmp (method, "kl") == 0) {
+    whiten = 1;
+    n->lambda_compression = 0.02;
+  } else if (strcmp (method, "specflux") == 0) {
+    whiten = 1;
+    n->lambda_compression = 10.;
+  }
+  n->whitening = NULL;
+  if (whiten) {
+    n->whitening = new_aubio_spectral_whitening(buf_size, o->hop_size,
+        o->samplerate);
+    if (n->whitening && strcmp (method, "specflux") == 0) {
+      aubio_spectral_whitening_set_relax_time(n->whitening, 100);
+      aubio_spectral_whitening_set_floor(n->whitening, 1.);
+    }
+  }
+}
+
+uint_t aubio_onset_add_descriptor(aubio_onset_t * o, const char_t * method,
+    smpl_t weight) {
+  aubio_onset_novelty_t *n;
+  if (o->n_extra >= AUBIO_ONSET_MAX_EXTRA) {
+    AUBIO_ERR("onset: can not add more than %d descriptors\n",
+        AUBIO_ONSET_MAX_EXTRA);
+    return AUBIO_FAIL;
+  }
+  if (!(weight >= 0.)) {
+    AUBIO_ERR("onset: descriptor weight should be >= 0, got %f\n", weight);
+    return AUBIO_FAIL;
+  }
+  n = &o->extra[o->n_extra];
+  n->od = new_aubio_specdesc(method, (o->fftgrain->length - 1) * 2);
+  if (!n->od) return AUBIO_FAIL;
+  if (!o->scratch) {
+    o->scratch = new_cvec((o->fftgrain->length - 1) * 2);
+  }
+  aubio_onset_novelty_defaults(o, n, method);
+  n->desc = new_fvec(1);
+  o->n_extra++;
+  o->weight[o->n_extra] = weight;
+  o->scale[o->n_extra] = -1.;
+  aubio_pvoc_set_phase(o->pv, aubio_onset_uses_phase(o));
+  return AUBIO_OK;
+}
+
+uint_t aubio_onset_set_descriptor_weight(aubio_onset_t * o, uint_t index,
+    smpl_t weight) {
+  if (index > o->n_extra || !(weight >= 0.)) {
+    AUBIO_ERR("onset: invalid weight %f for descriptor %d\n", weight, index);
+    return AUBIO_FAIL;
+  }
+  o->weight[index] = weight;
+  return AUBIO_OK;
+}
+
+uint_t aubio_onset_get_descriptor_count(const aubio_onset_t * o) {
+  return o->n_extra + 1;
+}
+
+smpl_t aubio_onset_get_descriptor_value(const aubio_onset_t * o, uint_t index) {
+  if (index == 0) {
+    return o->n_extra ? o->raw : o->desc->data[0];
+  }
+  if (index > o->n_extra) return 0.;
+  return o->extra[index - 1].desc->data[0];
+}
+
+uint_t aubio_onset_uses_phase(const aubio_onset_t * o) {
+  uint_t i;
+  if (aubio_specdesc_uses_phase(o->od)) return 1;
+  for (i = 0; i < o->n_extra; i++) {
+    if (aubio_specdesc_uses_phase(o->extra[i].od)) return 1;
+  }
+  return 0;
+}
+
+uint_t aubio_onset_set_incremental_threshold(aubio_onset_t * o, uint_t incremental) {
+  return aubio_peakpicker_set_incremental(o->pp, incremental);
+}
+
+uint_t aubio_onset_set_threshold_window(aubio_onset_t * o, uint_t win_post, uint_t win_pre) {
+  return aubio_peakpicker_set_window(o->pp, win_post, win_pre);
+}
+
 uint_t aubio_onset_set_minioi(aubio_onset_t * o, uint_t minioi) {
   o->minioi = minioi;
   return AUBIO_OK;
@@ -264,6 +454,10 @@ aubio_onset_t * new_aubio_onset (const char_t * onset_mode,
       || !o->desc || !o->spectral_whitening)
     goto beach;
 
+  /* skip the phase computation when the descriptor only reads the norm */
+  aubio_pvoc_set_phase(o->pv, aubio_specdesc_uses_phase(o->od));
+  o->weight[0] = 1.;
+
   /* initialize internal variables */
   aubio_onset_set_default_parameters (o, onset_mode);
 
@@ -276,8 +470,21 @@ beach:
 }
 
 void aubio_onset_reset (aubio_onset_t *o) {
+  uint_t i;
   o->last_onset = 0;
   o->total_frames = 0;
+  aubio_pvoc_reset(o->pv);
+  aubio_specdesc_reset(o->od);
+  aubio_peakpicker_reset(o->pp);
+  aubio_spectral_whitening_reset(o->spectral_whitening);
+  for (i = 0; i < o->n_extra; i++) {
+    aubio_specdesc_reset(o->extra[i].od);
+    if (o->extra[i].whitening)
+      aubio_spectral_whitening_reset(o->extra[i].whitening);
+  }
+  for (i = 0; i <= o->n_extra; i++) {
+    o->scale[i] = -1.;
+  }
 }
 
 uint_t aubio_onset_set_default_parameters (aubio_onset_t * o, const char_t * onset_mode)
@@ -339,6 +546,15 @@ uint_t aubio_onset_set_default_parameters (aubio_onset_t * o, const char_t * ons
 
 void del_aubio_onset (aubio_onset_t *o)
 {
+  uint_t i;
+  for (i = 0; i < o->n_extra; i++) {
+    del_aubio_specdesc(o->extra[i].od);
+    if (o->extra[i].whitening)
+      del_aubio_spectral_whitening(o->extra[i].whitening);
+    del_fvec(o->extra[i].desc);
+  }
+  if (o->scratch)
+    del_cvec(o->scratch);
   if (o->spectral_whitening)
     del_aubio_spectral_whitening(o->spectral_whitening);
   if (o->od)
@@ -90,6 +90,41 @@ aubio_onset_t * new_aubio_onset (const char_t * method,
 */
 void aubio_onset_do (aubio_onset_t *o, const fvec_t * input, fvec_t * onset);
 
+/** execute onset detection on a spectrum computed by the caller
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \param input latest audio vector of length hop_size, used for silence
+  detection
+  \param fftgrain spectrum of the current buf_size window, as aubio_pvoc_do()
+  would have produced it; it is copied, not modified
+  \param onset output vector of length 1, see aubio_onset_do()
+
+  This skips the internal phase vocoder, so callers that already have the
+  spectrum of the current window do not pay for a second FFT. The phase
+  vocoder history is not updated, so do not interleave this with
+  aubio_onset_do() on the same object.
+
+*/
+void aubio_onset_do_spectrum (aubio_onset_t *o, const fvec_t * input,
+    const cvec_t * fftgrain, fvec_t * onset);
+
+/** execute onset detection on a spectrum the caller already whitened
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \param input latest audio vector of length hop_size, used for silence
+  detection
+  \param fftgrain whitened spectrum of the current buf_size window
+  \param onset output vector of length 1, see aubio_onset_do()
+
+  Same as aubio_onset_do_spectrum(), but the adaptive whitening of the
+  detector and of its added descriptors is skipped for this frame, so a
+  spectrum shared with other analyses is not whitened twice. Compression
+  and the descriptors themselves are unchanged.
+
+*/
+void aubio_onset_do_whitened_spectrum (aubio_onset_t *o, const fvec_t * input,
+    const cvec_t * fftgrain, fvec_t * onset);
+
 /** get the time of the latest onset detected, in samples
 
   \param o onset detection object as returned by new_aubio_onset()
@@ -312,6 +347,79 @@ smpl_t aubio_onset_get_delay_ms(const aubio_onset_t * o);
 */
 smpl_t aubio_onset_get_threshold(const aubio_onset_t * o);
 
+/** set incremental adaptive thresholding in the peak picker
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \param incremental 1 to update a running median and mean per hop
+  (O(log window)), 0 to re-filter the whole window every hop (default)
+  \return 0 if successful, 1 otherwise
+
+*/
+uint_t aubio_onset_set_incremental_threshold(aubio_onset_t * o, uint_t incremental);
+
+/** add a spectral descriptor fused with the one given to new_aubio_onset()
+
+  All descriptors are computed from the same phase vocoder frame, each with
+  the whitening and compression aubio_onset_set_default_parameters() would
+  pick for it (the first descriptor keeps the object's own settings). The
+  value peak-picked, and returned by aubio_onset_get_descriptor(), becomes
+  the weighted mean of every descriptor divided by its running mean (about
+  two seconds), so methods with different ranges can be mixed.
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \param method spectral descriptor name, see new_aubio_specdesc()
+  \param weight fusion weight, >= 0
+  \return 0 if successful, 1 otherwise (unknown method or too many)
+
+*/
+uint_t aubio_onset_add_descriptor(aubio_onset_t * o, const char_t * method, smpl_t weight);
+
+/** set the fusion weight of a descriptor
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \param index 0 for the descriptor given to new_aubio_onset(), then the
+  added ones in order
+  \param weight fusion weight, >= 0 (the first descriptor defaults to 1)
+  \return 0 if successful, 1 otherwise
+
+*/
+uint_t aubio_onset_set_descriptor_weight(aubio_onset_t * o, uint_t index, smpl_t weight);
+
+/** get the number of fused descriptors, including the first one
+
+  \param o onset detection object as returned by new_aubio_onset()
+
+*/
+uint_t aubio_onset_get_descriptor_count(const aubio_onset_t * o);
+
+/** get the raw value of one descriptor for the last frame
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \param index descriptor index, see aubio_onset_set_descriptor_weight()
+  \return the descriptor value before fusion
+
+*/
+smpl_t aubio_onset_get_descriptor_value(const aubio_onset_t * o, uint_t index);
+
+/** check whether any fused descriptor reads the phase of the spectrum
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \return 1 if spectra passed to aubio_onset_do_spectrum() need their phase
+
+*/
+uint_t aubio_onset_uses_phase(const aubio_onset_t * o);
+
+/** set the peak picker's adaptive threshold window
+
+  \param o onset detection object as returned by new_aubio_onset()
+  \param win_post number of past novelty values, at least 1 (default 5)
+  \param win_pre number of look-ahead values (default 1), which adds as
+  many hops of detection delay
+  \return 0 if successful, 1 otherwise
+
+*/
+uint_t aubio_onset_set_threshold_window(aubio_onset_t * o, uint_t win_post, uint_t win_pre);
+
 /** set default parameters
 
   \param o onset detection object as returned by new_aubio_onset()
@@ -326,7 +434,9 @@ uint_t aubio_onset_set_default_parameters (aubio_onset_t * o, const char_t * ons
 
   \param o onset detection object as returned by new_aubio_onset()
 
-  Reset current time and last onset to 0.
+  Reset current time and last onset to 0, and clear the past frames held
+  by the phase vocoder, spectral descriptors, whitening and peak picker, so
+  that a detector can be reused for an unrelated stream.
 
   This function is called at the end of new_aubio_onset().
 
@@ -24,6 +24,7 @@
 #include "lvec.h"
 #include "temporal/filter.h"
 #include "temporal/biquad.h"
+#include "utils/runmedian.h"
 #include "onset/peakpicker.h"
 
 /** function pointer to thresholding function */
@@ -68,6 +69,13 @@ struct _aubio_peakpicker_t
         /** scratch pad for biquad and median */
   fvec_t *scratch;
 
+        /** incremental mode: causal biquad and running median/mean [0] */
+  uint_t incremental;
+        /** filtered onsets, sliding median and mean (incremental mode) */
+  aubio_runmedian_t *runmedian;
+        /** one-sample buffer for the causal biquad (incremental mode) */
+  fvec_t *sample;
+
         /** \bug should be used to calculate filter coefficients */
   /* cutoff: low-pass filter cutoff [0.34, 1] */
   /* smpl_t cutoff; */
@@ -91,30 +99,41 @@ aubio_peakpicker_do (aubio_peakpicker_t * p, fvec_t * onset, fvec_t * out)
   fvec_t *onset_peek = p->onset_peek;
   fvec_t *thresholded = p->thresholded;
   fvec_t *scratch = p->scratch;
-  smpl_t mean = 0., median = 0.;
+  smpl_t mean = 0., median = 0., current = 0.;
   uint_t j = 0;
 
-  /* push new novelty to the end */
-  fvec_push(onset_keep, onset->data[0]);
-  /* store a copy */
-  fvec_copy(onset_keep, onset_proc);
+  if (p->incremental) {
+    /* filter only the new novelty value, keeping the biquad state, and
+     * update the running median and mean of the filtered window */
+    p->sample->data[0] = onset->data[0];
+    aubio_filter_do (p->biquad, p->sample);
+    aubio_runmedian_push (p->runmedian, p->sample->data[0]);
+    mean = aubio_runmedian_mean (p->runmedian);
+    median = aubio_runmedian_median (p->runmedian);
+    current = aubio_runmedian_get (p->runmedian, p->win_pre);
+  } else {
+    /* push new novelty to the end */
+    fvec_push(onset_keep, onset->data[0]);
+    /* store a copy */
+    fvec_copy(onset_keep, onset_proc);
 
-  /* filter this copy */
-  aubio_filter_do_filtfilt (p->biquad, onset_proc, scratch);
+    /* filter this copy */
+    aubio_filter_do_filtfilt (p->biquad, onset_proc, scratch);
 
-  /* calculate mean and median for onset_proc */
-  mean = fvec_mean (onset_proc);
+    /* calculate mean and median for onset_proc */
+    mean = fvec_mean (onset_proc);
 
-  /* copy to scratch and compute its median */
-  fvec_copy(onset_proc, scratch);
-  median = p->thresholdfn (scratch);
+    /* copy to scratch and compute its median */
+    fvec_copy(onset_proc, scratch);
+    median = p->thresholdfn (scratch);
+    current = onset_proc->data[p->win_post];
+  }
 
   /* shift peek array */
   for (j = 0; j < 3 - 1; j++)
     onset_peek->data[j] = onset_peek->data[j + 1];
   /* calculate new tresholded value */
-  thresholded->data[0] =
-      onset_proc->data[p->win_post] - median - mean * p->threshold;
+  thresholded->data[0] = current - median - mean * p->threshold;
   onset_peek->data[2] = thresholded->data[0];
   out->data[0] = (p->pickerfn) (onset_peek, 1);
   if (out->data[0]) {
@@ -158,6 +177,56 @@ aubio_peakpicker_get_thresholdfn (aubio_peakpicker_t * p)
   return (aubio_thresholdfn_t) (p->thresholdfn);
 }
 
+uint_t
+aubio_peakpicker_set_incremental (aubio_peakpicker_t * p, uint_t incremental)
+{
+  p->incremental = incremental ? 1 : 0;
+  aubio_peakpicker_reset (p);
+  return AUBIO_OK;
+}
+
+uint_t
+aubio_peakpicker_get_incremental (aubio_peakpicker_t * p)
+{
+  return p->incremental;
+}
+
+uint_t
+aubio_peakpicker_set_window (aubio_peakpicker_t * p, uint_t win_post,
+    uint_t win_pre)
+{
+  uint_t length = win_post + win_pre + 1;
+  aubio_runmedian_t *runmedian;
+  if ((sint_t)win_post <= 0) {
+    AUBIO_ERR ("peakpicker: win_post should be > 0, got %d\n", win_post);
+    return AUBIO_FAIL;
+  }
+  runmedian = new_aubio_runmedian (length);
+  if (!runmedian) return AUBIO_FAIL;
+
+  del_aubio_runmedian (p->runmedian);
+  del_fvec (p->scratch);
+  del_fvec (p->onset_keep);
+  del_fvec (p->onset_proc);
+  p->win_post = win_post;
+  p->win_pre = win_pre;
+  p->runmedian = runmedian;
+  p->scratch = new_fvec (length);
+  p->onset_keep = new_fvec (length);
+  p->onset_proc = new_fvec (length);
+  aubio_peakpicker_reset (p);
+  return AUBIO_OK;
+}
+
+void
+aubio_peakpicker_reset (aubio_peakpicker_t * p)
+{
+  fvec_zeros (p->onset_keep);
+  fvec_zeros (p->onset_peek);
+  aubio_runmedian_reset (p->runmedian);
+  aubio_filter_do_reset (p->biquad);
+}
+
 aubio_peakpicker_t *
 new_aubio_peakpicker (void)
 {
@@ -174,6 +243,8 @@ new_aubio_peakpicker (void)
   t->onset_proc = new_fvec (t->win_post + t->win_pre + 1);
   t->onset_peek = new_fvec (3);
   t->thresholded = new_fvec (1);
+  t->runmedian = new_aubio_runmedian (t->win_post + t->win_pre + 1);
+  t->sample = new_fvec (1);
 
   /* cutoff: low-pass filter with cutoff reduced frequency at 0.34
      generated with octave butter function: [b,a] = butter(2, 0.34);
@@ -195,5 +266,7 @@ del_aubio_peakpicker (aubio_peakpicker_t * p)
   del_fvec (p->onset_peek);
   del_fvec (p->thresholded);
   del_fvec (p->scratch);
+  del_aubio_runmedian (p->runmedian);
+  del_fvec (p->sample);
   AUBIO_FREE (p);
 }
@@ -49,6 +49,22 @@ fvec_t *aubio_peakpicker_get_thresholded_input (aubio_peakpicker_t * p);
 uint_t aubio_peakpicker_set_threshold(aubio_peakpicker_t * p, smpl_t threshold);
 /** get peak picking threshold */
 smpl_t aubio_peakpicker_get_threshold(aubio_peakpicker_t * p);
+/** enable incremental thresholding
+
+  Instead of re-filtering the whole window forwards and backwards and
+  running quickselect on it every hop, each new novelty value goes through
+  the (causal) biquad once and into a running median and mean, so the cost
+  per hop is O(log window) and longer windows become affordable.
+
+*/
+uint_t aubio_peakpicker_set_incremental(aubio_peakpicker_t * p, uint_t incremental);
+/** get incremental thresholding mode */
+uint_t aubio_peakpicker_get_incremental(aubio_peakpicker_t * p);
+/** set adaptive threshold window: win_post past values (> 0) and win_pre
+ * values of look-ahead, which is also the detection delay in hops */
+uint_t aubio_peakpicker_set_window(aubio_peakpicker_t * p, uint_t win_post, uint_t win_pre);
+/** clear the novelty history and filter state */
+void aubio_peakpicker_reset(aubio_peakpicker_t * p);
 
 #ifdef __cplusplus
 }
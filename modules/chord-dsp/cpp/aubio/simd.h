@@ -0,0 +1,307 @@
+/*
+ * SIMD kernels for aubio's vector utilities on builds without Accelerate.
+ * Generated for the chord-dsp Nitro module.
+ *
+ * HAVE_AUBIO_SIMD is defined when the compiler targets NEON (Android arm64,
+ * armeabi-v7a with -mfpu=neon) or SSE2 (x86-64 emulators and desktop
+ * builds), and only for single precision; AUBIO_NO_SIMD turns it off to
+ * measure the scalar path. Callers keep their scalar loop as the fallback
+ * branch. Every kernel handles any length, including a tail that is not a
+ * multiple of the vector width.
+ *
+ * In cvec.c the set_all fills and cvec_logmag, the per-hop compression of
+ * most onset methods, use these kernels; the copies and zeros are
+ * memcpy/memset (HAVE_MEMCPY_HACKS). In vecutils.c fvec_abs and fvec_sqrt
+ * do. vecutils' exp, cos, sin, log, log10, pow and rounding ops stay
+ * scalar: nothing in this module calls them, and only log has a vector
+ * version here.
+ */
+
+#ifndef AUBIO_SIMD_H
+#define AUBIO_SIMD_H
+
+#include "aubio_priv.h"
+
+#if !HAVE_AUBIO_DOUBLE && !defined(HAVE_ACCELERATE) && !defined(AUBIO_NO_SIMD)
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define HAVE_AUBIO_SIMD 1
+#define HAVE_AUBIO_NEON 1
+#include <arm_neon.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define HAVE_AUBIO_SIMD 1
+#define HAVE_AUBIO_SSE 1
+#include <emmintrin.h>
+#endif
+#endif
+
+#ifdef HAVE_AUBIO_SIMD
+
+#ifdef HAVE_AUBIO_NEON
+typedef float32x4_t aubio_v4;
+#define aubio_v4_load(p)       vld1q_f32(p)
+#define aubio_v4_store(p, v)   vst1q_f32(p, v)
+#define aubio_v4_set1(x)       vdupq_n_f32(x)
+#define aubio_v4_add(a, b)     vaddq_f32(a, b)
+#define aubio_v4_sub(a, b)     vsubq_f32(a, b)
+#define aubio_v4_mul(a, b)     vmulq_f32(a, b)
+#define aubio_v4_max(a, b)     vmaxq_f32(a, b)
+#define aubio_v4_min(a, b)     vminq_f32(a, b)
+#define aubio_v4_sqrt(a)       aubio_neon_sqrt(a)
+#define aubio_v4_abs(a)        vabsq_f32(a)
+
+/* a = m * 2^e with m in [sqrt(1/2), sqrt(2)), for a > 0 and normal; returns
+ * m - 1 */
+static inline float32x4_t aubio_v4_split_log2(float32x4_t a, float32x4_t *e) {
+  int32x4_t bits = vreinterpretq_s32_f32(a);
+  float32x4_t exponent = vcvtq_f32_s32(vsubq_s32(vshrq_n_s32(bits, 23), vdupq_n_s32(126)));
+  float32x4_t m = vreinterpretq_f32_s32(vorrq_s32(vandq_s32(bits, vdupq_n_s32(0x007fffff)), vdupq_n_s32(0x3f000000)));
+  uint32x4_t small = vcltq_f32(m, vdupq_n_f32(0.707106781186547524f));
+  *e = vsubq_f32(exponent, vreinterpretq_f32_u32(vandq_u32(small, vreinterpretq_u32_f32(vdupq_n_f32(1.f)))));
+  return vaddq_f32(vsubq_f32(m, vdupq_n_f32(1.f)), vreinterpretq_f32_u32(vandq_u32(small, vreinterpretq_u32_f32(m))));
+}
+/* [a0 a1 a2 a3] -> [a3 a2 a1 a0] */
+#define aubio_v4_reverse(a)    vcombine_f32(vrev64_f32(vget_high_f32(a)), vrev64_f32(vget_low_f32(a)))
+
+static inline float32x4_t aubio_neon_sqrt(float32x4_t a) {
+#if defined(__aarch64__)
+  return vsqrtq_f32(a);
+#else
+  /* armv7 has no vector sqrt: two Newton steps on the reciprocal estimate */
+  float32x4_t r = vrsqrteq_f32(a);
+  r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(a, r), r));
+  r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(a, r), r));
+  /* a * 1/sqrt(a), with 0 mapped to 0 instead of 0 * inf */
+  uint32x4_t zero = vceqq_f32(a, vdupq_n_f32(0.f));
+  return vbslq_f32(zero, a, vmulq_f32(a, r));
+#endif
+}
+
+static inline float aubio_v4_hsum(float32x4_t v) {
+#if defined(__aarch64__)
+  return vaddvq_f32(v);
+#else
+  float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif
+}
+
+static inline float aubio_v4_hmax(float32x4_t v) {
+#if defined(__aarch64__)
+  return vmaxvq_f32(v);
+#else
+  float32x2_t m = vmax_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpmax_f32(m, m), 0);
+#endif
+}
+
+static inline float aubio_v4_hmin(float32x4_t v) {
+#if defined(__aarch64__)
+  return vminvq_f32(v);
+#else
+  float32x2_t m = vmin_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpmin_f32(m, m), 0);
+#endif
+}
+#endif /* HAVE_AUBIO_NEON */
+
+#ifdef HAVE_AUBIO_SSE
+typedef __m128 aubio_v4;
+#define aubio_v4_load(p)       _mm_loadu_ps(p)
+#define aubio_v4_store(p, v)   _mm_storeu_ps(p, v)
+#define aubio_v4_set1(x)       _mm_set1_ps(x)
+#define aubio_v4_add(a, b)     _mm_add_ps(a, b)
+#define aubio_v4_sub(a, b)     _mm_sub_ps(a, b)
+#define aubio_v4_mul(a, b)     _mm_mul_ps(a, b)
+#define aubio_v4_max(a, b)     _mm_max_ps(a, b)
+#define aubio_v4_min(a, b)     _mm_min_ps(a, b)
+#define aubio_v4_sqrt(a)       _mm_sqrt_ps(a)
+#define aubio_v4_abs(a)        _mm_andnot_ps(_mm_set1_ps(-0.f), a)
+
+static inline __m128 aubio_v4_split_log2(__m128 a, __m128 *e) {
+  __m128i bits = _mm_castps_si128(a);
+  __m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+  __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+  __m128 small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+  *e = _mm_sub_ps(exponent, _mm_and_ps(small, _mm_set1_ps(1.f)));
+  return _mm_add_ps(_mm_sub_ps(m, _mm_set1_ps(1.f)), _mm_and_ps(small, m));
+}
+#define aubio_v4_reverse(a)    _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3))
+
+static inline float aubio_v4_hsum(__m128 v) {
+  __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return _mm_cvtss_f32(s);
+}
+
+static inline float aubio_v4_hmax(__m128 v) {
+  __m128 m = _mm_max_ps(v, _mm_movehl_ps(v, v));
+  m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+  return _mm_cvtss_f32(m);
+}
+
+static inline float aubio_v4_hmin(__m128 v) {
+  __m128 m = _mm_min_ps(v, _mm_movehl_ps(v, v));
+  m = _mm_min_ss(m, _mm_shuffle_ps(m, m, 1));
+  return _mm_cvtss_f32(m);
+}
+#endif /* HAVE_AUBIO_SSE */
+
+/* natural log for a > 0 and normal, Cephes' logf polynomial (within 1
+ * ulp of logf); chord-dsp's logScaled() uses it too */
+static inline aubio_v4 aubio_v4_log(aubio_v4 a) {
+  aubio_v4 e;
+  aubio_v4 x = aubio_v4_split_log2(a, &e);
+  aubio_v4 z = aubio_v4_mul(x, x);
+  aubio_v4 y = aubio_v4_set1(7.0376836292e-2f);
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(-1.1514610310e-1f));
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(1.1676998740e-1f));
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(-1.2420140846e-1f));
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(1.4249322787e-1f));
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(-1.6668057665e-1f));
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(2.0000714765e-1f));
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(-2.4999993993e-1f));
+  y = aubio_v4_add(aubio_v4_mul(y, x), aubio_v4_set1(3.3333331174e-1f));
+  y = aubio_v4_mul(aubio_v4_mul(y, x), z);
+  /* ln 2 split in two, so e * ln 2 adds without rounding the result */
+  y = aubio_v4_add(y, aubio_v4_mul(e, aubio_v4_set1(-2.12194440e-4f)));
+  y = aubio_v4_sub(y, aubio_v4_mul(z, aubio_v4_set1(0.5f)));
+  return aubio_v4_add(aubio_v4_add(x, y), aubio_v4_mul(e, aubio_v4_set1(0.693359375f)));
+}
+
+/* out[i] = val */
+static inline void aubio_simd_vfill(smpl_t val, smpl_t *out, uint_t n) {
+  uint_t i = 0;
+  aubio_v4 v = aubio_v4_set1(val);
+  for (; i + 4 <= n; i += 4) aubio_v4_store(out + i, v);
+  for (; i < n; i++) out[i] = val;
+}
+
+/* out[i] = a[i] * b[i]; out may alias a */
+static inline void aubio_simd_vmul(const smpl_t *a, const smpl_t *b, smpl_t *out, uint_t n) {
+  uint_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    aubio_v4_store(out + i, aubio_v4_mul(aubio_v4_load(a + i), aubio_v4_load(b + i)));
+  }
+  for (; i < n; i++) out[i] = a[i] * b[i];
+}
+
+/* out[i] = a[i] * s; out may alias a */
+static inline void aubio_simd_vsmul(const smpl_t *a, smpl_t s, smpl_t *out, uint_t n) {
+  uint_t i = 0;
+  aubio_v4 vs = aubio_v4_set1(s);
+  for (; i + 4 <= n; i += 4) aubio_v4_store(out + i, aubio_v4_mul(aubio_v4_load(a + i), vs));
+  for (; i < n; i++) out[i] = a[i] * s;
+}
+
+/* out[i] = a[i] + s; out may alias a */
+static inline void aubio_simd_vsadd(const smpl_t *a, smpl_t s, smpl_t *out, uint_t n) {
+  uint_t i = 0;
+  aubio_v4 vs = aubio_v4_set1(s);
+  for (; i + 4 <= n; i += 4) aubio_v4_store(out + i, aubio_v4_add(aubio_v4_load(a + i), vs));
+  for (; i < n; i++) out[i] = a[i] + s;
+}
+
+/* a[i] = |a[i]| */
+static inline void aubio_simd_vabs(smpl_t *a, uint_t n) {
+  uint_t i = 0;
+  for (; i + 4 <= n; i += 4) aubio_v4_store(a + i, aubio_v4_abs(aubio_v4_load(a + i)));
+  for (; i < n; i++) a[i] = ABS(a[i]);
+}
+
+/* a[i] = sqrt(a[i]) */
+static inline void aubio_simd_vsqrt(smpl_t *a, uint_t n) {
+  uint_t i = 0;
+  for (; i + 4 <= n; i += 4) aubio_v4_store(a + i, aubio_v4_sqrt(aubio_v4_load(a + i)));
+  for (; i < n; i++) a[i] = SQRT(a[i]);
+}
+
+/* a[i] = log(lambda * a[i] + 1), for a[i] >= 0 and lambda > 0 */
+static inline void aubio_simd_logmag(smpl_t *a, smpl_t lambda, uint_t n) {
+  uint_t i = 0;
+  aubio_v4 vl = aubio_v4_set1(lambda);
+  aubio_v4 one = aubio_v4_set1(1.f);
+  for (; i + 4 <= n; i += 4) {
+    aubio_v4_store(a + i, aubio_v4_log(aubio_v4_add(aubio_v4_mul(aubio_v4_load(a + i), vl), one)));
+  }
+  for (; i < n; i++) a[i] = LOG(lambda * a[i] + 1);
+}
+
+/* sum of a[i] */
+static inline smpl_t aubio_simd_sum(const smpl_t *a, uint_t n) {
+  uint_t i = 0;
+  aubio_v4 acc = aubio_v4_set1(0.f);
+  for (; i + 4 <= n; i += 4) acc = aubio_v4_add(acc, aubio_v4_load(a + i));
+  smpl_t sum = aubio_v4_hsum(acc);
+  for (; i < n; i++) sum += a[i];
+  return sum;
+}
+
+/* sum of (i + 1) * a[i], the high frequency content weighting */
+static inline smpl_t aubio_simd_ramp_sum(const smpl_t *a, uint_t n) {
+  uint_t i = 0;
+  const smpl_t first[4] = {1.f, 2.f, 3.f, 4.f};
+  aubio_v4 idx = aubio_v4_load(first);
+  aubio_v4 step = aubio_v4_set1(4.f);
+  aubio_v4 acc = aubio_v4_set1(0.f);
+  for (; i + 4 <= n; i += 4) {
+    acc = aubio_v4_add(acc, aubio_v4_mul(idx, aubio_v4_load(a + i)));
+    idx = aubio_v4_add(idx, step);
+  }
+  smpl_t sum = aubio_v4_hsum(acc);
+  for (; i < n; i++) sum += (smpl_t)(i + 1) * a[i];
+  return sum;
+}
+
+/* max of a[i], n >= 1 */
+static inline smpl_t aubio_simd_max(const smpl_t *a, uint_t n) {
+  uint_t i = 0;
+  smpl_t m = a[0];
+  if (n >= 4) {
+    aubio_v4 acc = aubio_v4_load(a);
+    for (i = 4; i + 4 <= n; i += 4) acc = aubio_v4_max(acc, aubio_v4_load(a + i));
+    m = aubio_v4_hmax(acc);
+  }
+  for (; i < n; i++) m = (m > a[i]) ? m : a[i];
+  return m;
+}
+
+/* min of a[i], n >= 1 */
+static inline smpl_t aubio_simd_min(const smpl_t *a, uint_t n) {
+  uint_t i = 0;
+  smpl_t m = a[0];
+  if (n >= 4) {
+    aubio_v4 acc = aubio_v4_load(a);
+    for (i = 4; i + 4 <= n; i += 4) acc = aubio_v4_min(acc, aubio_v4_load(a + i));
+    m = aubio_v4_hmin(acc);
+  }
+  for (; i < n; i++) m = (m < a[i]) ? m : a[i];
+  return m;
+}
+
+/* norm[i] = sqrt(re[i]^2 + im[-i]^2) for i in [1, n), where re and im point
+ * at the start and one past the end of aubio's [ r0, r1, ..., rN, iN-1, .., i1]
+ * layout, so bin i's imaginary part is im[-i] */
+static inline void aubio_simd_norm_reversed(const smpl_t *re, const smpl_t *im, smpl_t *norm, uint_t n) {
+  uint_t i = 1;
+  for (; i + 4 <= n; i += 4) {
+    aubio_v4 r = aubio_v4_load(re + i);
+    aubio_v4 m = aubio_v4_reverse(aubio_v4_load(im - i - 3));
+    aubio_v4_store(norm + i, aubio_v4_sqrt(aubio_v4_add(aubio_v4_mul(r, r), aubio_v4_mul(m, m))));
+  }
+  for (; i < n; i++) norm[i] = SQRT(SQR(re[i]) + SQR(im[-(sint_t)i]));
+}
+
+/* norm[i] = sqrt(re[i]^2 + im[i]^2) for i in [0, n), split complex */
+static inline void aubio_simd_norm(const smpl_t *re, const smpl_t *im, smpl_t *norm, uint_t n) {
+  uint_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    aubio_v4 r = aubio_v4_load(re + i);
+    aubio_v4 m = aubio_v4_load(im + i);
+    aubio_v4_store(norm + i, aubio_v4_sqrt(aubio_v4_add(aubio_v4_mul(r, r), aubio_v4_mul(m, m))));
+  }
+  for (; i < n; i++) norm[i] = SQRT(SQR(re[i]) + SQR(im[i]));
+}
+
+#endif /* HAVE_AUBIO_SIMD */
+
+#endif /* AUBIO_SIMD_H */
@@ -23,6 +23,8 @@
 #include "cvec.h"
 #include "mathutils.h"
 #include "spectral/fft.h"
+#include "simd.h"
+#include "spectral/simd_fft.h"
 
 #ifdef HAVE_FFTW3             // using FFTW3
 /* note that <complex.h> is not included here but only in aubio_priv.h, so that
@@ -87,6 +89,7 @@ pthread_mutex_t aubio_fftw_mutex = PTHREAD_MUTEX_INITIALIZER;
 #define aubio_vDSP_ztoc                vDSP_ztoc
 #define aubio_vDSP_zvmags              vDSP_zvmags
 #define aubio_vDSP_zvphas              vDSP_zvphas
+#define aubio_vDSP_zvabs               vDSP_zvabs
 #define aubio_vDSP_vsadd               vDSP_vsadd
 #define aubio_vDSP_vsmul               vDSP_vsmul
 #define aubio_DSPComplex               DSPComplex
@@ -102,6 +105,7 @@ pthread_mutex_t aubio_fftw_mutex = PTHREAD_MUTEX_INITIALIZER;
 #define aubio_vDSP_ztoc                vDSP_ztocD
 #define aubio_vDSP_zvmags              vDSP_zvmagsD
 #define aubio_vDSP_zvphas              vDSP_zvphasD
+#define aubio_vDSP_zvabs               vDSP_zvabsD
 #define aubio_vDSP_vsadd               vDSP_vsaddD
 #define aubio_vDSP_vsmul               vDSP_vsmulD
 #define aubio_DSPComplex               DSPDoubleComplex
@@ -170,6 +174,8 @@ struct _aubio_fft_t {
   smpl_t *in, *out;
   smpl_t *w;
   int *ip;
+  /* NEON/SSE2 transform, or NULL to run Ooura */
+  aubio_simd_fft_t *simd;
 #endif /* using OOURA */
 
   fvec_t * compspec;
@@ -290,6 +296,7 @@ aubio_fft_t * new_aubio_fft (uint_t winsize) {
   s->ip    = AUBIO_ARRAY(int   , s->fft_size);
   s->w     = AUBIO_ARRAY(smpl_t, s->fft_size);
   s->ip[0] = 0;
+  s->simd = new_aubio_simd_fft(winsize);
 #endif /* using OOURA */
 
   return s;
@@ -323,6 +330,7 @@ void del_aubio_fft(aubio_fft_t * s) {
 #else                         // using OOURA
   AUBIO_FREE(s->w);
   AUBIO_FREE(s->ip);
+  if (s->simd) del_aubio_simd_fft(s->simd);
 #endif
 
   del_fvec(s->compspec);
@@ -336,6 +344,107 @@ void aubio_fft_do(aubio_fft_t * s, const fvec_t * input, cvec_t * spectrum) {
   aubio_fft_get_spectrum(s->compspec, spectrum);
 }
 
+void aubio_fft_do_windowed(aubio_fft_t * s, const fvec_t * input,
+    const fvec_t * window, uint_t shift, cvec_t * spectrum, uint_t phase) {
+#if defined HAVE_ACCELERATE || !(defined HAVE_FFTW3 || defined HAVE_INTEL_IPP)
+  uint_t n = s->winsize, half = n / 2;
+  uint_t rot = shift ? half : 0;
+#endif
+#if defined HAVE_ACCELERATE  // using ACCELERATE
+  if (n % 4 == 0) {
+    uint_t q = half / 2;
+    smpl_t scale = 1./2.;
+    aubio_DSPSplitComplex bins;
+    /* window the rotated input straight into the split-complex buffer,
+       even samples to realp and odd samples to imagp */
+    if (rot) {
+      aubio_vDSP_vmul(input->data + rot, 2, window->data + rot, 2,
+          s->spec.realp, 1, q);
+      aubio_vDSP_vmul(input->data + rot + 1, 2, window->data + rot + 1, 2,
+          s->spec.imagp, 1, q);
+      aubio_vDSP_vmul(input->data, 2, window->data, 2, s->spec.realp + q, 1, q);
+      aubio_vDSP_vmul(input->data + 1, 2, window->data + 1, 2,
+          s->spec.imagp + q, 1, q);
+    } else {
+      aubio_vDSP_vmul(input->data, 2, window->data, 2, s->spec.realp, 1, half);
+      aubio_vDSP_vmul(input->data + 1, 2, window->data + 1, 2,
+          s->spec.imagp, 1, half);
+    }
+    aubio_vDSP_DFT_Execute(s->fftSetupFwd, s->spec.realp, s->spec.imagp,
+        s->spec.realp, s->spec.imagp);
+    /* DC and Nyquist are packed in realp[0] and imagp[0] */
+    spectrum->norm[0] = ABS(s->spec.realp[0]) * scale;
+    spectrum->norm[half] = ABS(s->spec.imagp[0]) * scale;
+    if (phase) {
+      spectrum->phas[0] = s->spec.realp[0] < 0 ? PI : 0.;
+      spectrum->phas[half] = s->spec.imagp[0] < 0 ? PI : 0.;
+    }
+    bins.realp = s->spec.realp + 1;
+    bins.imagp = s->spec.imagp + 1;
+    aubio_vDSP_zvabs(&bins, 1, spectrum->norm + 1, 1, half - 1);
+    aubio_vDSP_vsmul(spectrum->norm + 1, 1, &scale, spectrum->norm + 1, 1,
+        half - 1);
+    if (phase) {
+      aubio_vDSP_zvphas(&bins, 1, spectrum->phas + 1, 1, half - 1);
+    }
+    return;
+  }
+#elif !(defined HAVE_FFTW3 || defined HAVE_INTEL_IPP)  // using OOURA
+  uint_t i;
+  /* window the rotated input straight into the transform buffer */
+#if defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vmul(input->data + rot, window->data + rot, s->in, n - rot);
+  aubio_simd_vmul(input->data, window->data, s->in + n - rot, rot);
+#else
+  for (i = 0; i < n - rot; i++) {
+    s->in[i] = input->data[i + rot] * window->data[i + rot];
+  }
+  for (i = 0; i < rot; i++) {
+    s->in[n - rot + i] = input->data[i] * window->data[i];
+  }
+#endif
+#if defined(HAVE_AUBIO_SIMD)
+  if (s->simd) {
+    /* split spectrum: real parts in compspec, imaginary parts in s->out */
+    smpl_t *re = s->compspec->data, *im = s->out;
+    aubio_simd_fft_forward(s->simd, s->in, re, im);
+    aubio_simd_norm(re, im, spectrum->norm, half + 1);
+    if (phase) {
+      spectrum->phas[0] = re[0] < 0 ? PI : 0.;
+      spectrum->phas[half] = re[half] < 0 ? PI : 0.;
+      for (i = 1; i < half; i++) {
+        spectrum->phas[i] = ATAN2(im[i], re[i]);
+      }
+    }
+    return;
+  }
+#endif
+  aubio_ooura_rdft(n, 1, s->in, s->ip, s->w);
+  /* [ r0, rN, r1, -i1, r2, -i2, ... ] */
+  spectrum->norm[0] = ABS(s->in[0]);
+  spectrum->norm[half] = ABS(s->in[1]);
+  for (i = 1; i < half; i++) {
+    spectrum->norm[i] = SQRT(SQR(s->in[2 * i]) + SQR(s->in[2 * i + 1]));
+  }
+  if (phase) {
+    spectrum->phas[0] = s->in[0] < 0 ? PI : 0.;
+    spectrum->phas[half] = s->in[1] < 0 ? PI : 0.;
+    for (i = 1; i < half; i++) {
+      spectrum->phas[i] = ATAN2(- s->in[2 * i + 1], s->in[2 * i]);
+    }
+  }
+#endif
+#if defined HAVE_ACCELERATE || defined HAVE_FFTW3 || defined HAVE_INTEL_IPP
+  /* generic path, with compspec as scratch: do_complex copies its input
+     before writing compspec */
+  fvec_weighted_copy(input, window, s->compspec);
+  if (shift) fvec_shift(s->compspec);
+  aubio_fft_do_complex(s, s->compspec, s->compspec);
+  if (phase) aubio_fft_get_phas(s->compspec, spectrum);
+  aubio_fft_get_norm(s->compspec, spectrum);
+#endif
+}
+
 void aubio_fft_rdo(aubio_fft_t * s, const cvec_t * spectrum, fvec_t * output) {
   aubio_fft_get_realimag(spectrum, s->compspec);
   aubio_fft_rdo_complex(s, s->compspec, output);
@@ -396,6 +505,16 @@ void aubio_fft_do_complex(aubio_fft_t * s, const fvec_t * input, fvec_t * compsp
   }
 
 #else                         // using OOURA
+#if defined(HAVE_AUBIO_SIMD)
+  if (s->simd) {
+    /* real parts land in place; imaginary parts go through s->out */
+    aubio_simd_fft_forward(s->simd, s->in, compspec->data, s->out);
+    for (i = 1; i < s->fft_size - 1; i++) {
+      compspec->data[s->winsize - i] = s->out[i];
+    }
+    return;
+  }
+#endif
   aubio_ooura_rdft(s->winsize, 1, s->in, s->ip, s->w);
   compspec->data[0] = s->in[0];
   compspec->data[s->winsize / 2] = s->in[1];
@@ -464,6 +583,17 @@ void aubio_fft_rdo_complex(aubio_fft_t * s, const fvec_t * compspec, fvec_t * ou
   aubio_ippsMulC(output->data, 1.0 / s->winsize, output->data, s->fft_size);
 
 #else                         // using OOURA
+#if defined(HAVE_AUBIO_SIMD)
+  if (s->simd) {
+    /* compspec already starts with the real parts */
+    for (i = 1; i < s->fft_size - 1; i++) {
+      s->out[i] = compspec->data[s->winsize - i];
+    }
+    aubio_simd_fft_inverse(s->simd, compspec->data, s->out, output->data);
+    aubio_simd_vsmul(output->data, 1. / s->winsize, output->data, s->winsize);
+    return;
+  }
+#endif
   smpl_t scale = 2.0 / s->winsize;
   s->out[0] = compspec->data[0];
   s->out[1] = compspec->data[s->winsize / 2];
@@ -534,12 +664,17 @@ void aubio_fft_get_phas(const fvec_t * compspec, cvec_t * spectrum) {
 }
 
 void aubio_fft_get_norm(const fvec_t * compspec, cvec_t * spectrum) {
-  uint_t i = 0;
+  uint_t i UNUSED = 0;
   spectrum->norm[0] = ABS(compspec->data[0]);
+#if defined(HAVE_AUBIO_SIMD)
+  aubio_simd_norm_reversed(compspec->data, compspec->data + compspec->length,
+      spectrum->norm, spectrum->length - 1);
+#else
   for (i=1; i < spectrum->length - 1; i++) {
     spectrum->norm[i] = SQRT(SQR(compspec->data[i])
         + SQR(compspec->data[compspec->length - i]) );
   }
+#endif
 #ifdef HAVE_FFTW3
   // for even length, make sure last element is > 0
   if (2 * (compspec->length / 2) == compspec->length) {
@@ -66,6 +66,23 @@ void del_aubio_fft(aubio_fft_t * s);
 
 */
 void aubio_fft_do (aubio_fft_t *s, const fvec_t * input, cvec_t * spectrum);
+/** compute forward FFT of a windowed input in one pass
+
+  Equivalent to fvec_weighted_copy(), fvec_shift() when shift is set, and
+  aubio_fft_do(), but windows directly into the transform buffer and
+  computes norm (and phase) straight from it without going through
+  compspec.
+
+  \param s fft object as returned by new_aubio_fft
+  \param input input signal
+  \param window window weights, same length as input
+  \param shift 1 to rotate the windowed input by half its length
+  \param spectrum output spectrum
+  \param phase 0 to skip computing spectrum->phas, which is left untouched
+
+*/
+void aubio_fft_do_windowed (aubio_fft_t *s, const fvec_t * input,
+    const fvec_t * window, uint_t shift, cvec_t * spectrum, uint_t phase);
 /** compute backward (inverse) FFT
 
   \param s fft object as returned by new_aubio_fft
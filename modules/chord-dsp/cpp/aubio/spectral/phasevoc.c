@@ -40,6 +40,7 @@ struct _aubio_pvoc_t {
   smpl_t scale;       /** scaling factor for synthesis */
   uint_t end_datasize;  /** size of memory to end */
   uint_t hop_datasize;  /** size of memory to hop_s */
+  uint_t phase;       /** compute fftgrain->phas in aubio_pvoc_do */
 };
 
 
@@ -52,12 +53,8 @@ static void aubio_pvoc_addsynth(aubio_pvoc_t *pv, fvec_t * synthnew);
 void aubio_pvoc_do(aubio_pvoc_t *pv, const fvec_t * datanew, cvec_t *fftgrain) {
   /* slide  */
   aubio_pvoc_swapbuffers(pv, datanew);
-  /* windowing */
-  fvec_weight(pv->data, pv->w);
-  /* shift */
-  fvec_shift(pv->data);
-  /* calculate fft */
-  aubio_fft_do (pv->fft,pv->data,fftgrain);
+  /* window, shift and calculate fft in one pass */
+  aubio_fft_do_windowed (pv->fft, pv->data, pv->w, 1, fftgrain, pv->phase);
 }
 
 void aubio_pvoc_rdo(aubio_pvoc_t *pv,cvec_t * fftgrain, fvec_t * synthnew) {
@@ -113,6 +110,7 @@ aubio_pvoc_t * new_aubio_pvoc (uint_t win_s, uint_t hop_s) {
 
   pv->hop_s    = hop_s;
   pv->win_s    = win_s;
+  pv->phase    = 1;
 
   /* more than 50% overlap, overlap anyway */
   if (win_s < 2 * hop_s) pv->start = 0;
@@ -143,6 +141,18 @@ beach:
   return NULL;
 }
 
+uint_t aubio_pvoc_set_phase(aubio_pvoc_t *pv, uint_t phase) {
+  pv->phase = phase ? 1 : 0;
+  return AUBIO_OK;
+}
+
+void aubio_pvoc_reset(aubio_pvoc_t *pv) {
+  fvec_zeros(pv->data);
+  fvec_zeros(pv->dataold);
+  fvec_zeros(pv->synth);
+  fvec_zeros(pv->synthold);
+}
+
 uint_t aubio_pvoc_set_window(aubio_pvoc_t *pv, const char_t *window) {
   return fvec_set_window(pv->w, (char_t*)window);
 }
@@ -106,6 +106,24 @@ uint_t aubio_pvoc_get_hop(aubio_pvoc_t* pv);
  */
 uint_t aubio_pvoc_set_window(aubio_pvoc_t *pv, const char_t *window_type);
 
+/** choose whether aubio_pvoc_do() computes the phase of fftgrain
+
+  \param pv phase vocoder object as returned by new_aubio_pvoc()
+  \param phase 0 to only compute the norm, leaving fftgrain->phas
+  untouched; 1 to compute both (default)
+
+  \return 0 if successful, non-zero otherwise
+
+ */
+uint_t aubio_pvoc_set_phase(aubio_pvoc_t *pv, uint_t phase);
+
+/** clear the analysis and synthesis memories of a phase vocoder
+
+  \param pv phase vocoder object as returned by new_aubio_pvoc()
+
+ */
+void aubio_pvoc_reset(aubio_pvoc_t *pv);
+
 #ifdef __cplusplus
 }
 #endif
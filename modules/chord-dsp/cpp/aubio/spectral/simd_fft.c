@@ -0,0 +1,356 @@
+/*
+ * NEON/SSE2 real FFT for builds without Accelerate.
+ * Generated for the chord-dsp Nitro module; see simd_fft.h.
+ */
+
+#include "aubio_priv.h"
+#include "simd.h"
+#include "spectral/simd_fft.h"
+
+#if defined(HAVE_AUBIO_SIMD) && !defined(AUBIO_NO_SIMD_FFT)
+
+#ifdef HAVE_AUBIO_NEON
+/* rows r0..r3 become columns */
+#define SIMD_FFT_TRANSPOSE(r0, r1, r2, r3) do { \
+    float32x4x2_t t01 = vtrnq_f32(r0, r1); \
+    float32x4x2_t t23 = vtrnq_f32(r2, r3); \
+    r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])); \
+    r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])); \
+    r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])); \
+    r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])); \
+  } while (0)
+
+/* [p0 p1 ... p7] -> [p0 p2 p4 p6], [p1 p3 p5 p7] */
+static inline void simd_fft_load_pairs(const smpl_t *p, aubio_v4 *even, aubio_v4 *odd) {
+  float32x4x2_t v = vld2q_f32(p);
+  *even = v.val[0];
+  *odd = v.val[1];
+}
+
+/* the reverse of simd_fft_load_pairs() */
+static inline void simd_fft_store_pairs(smpl_t *p, aubio_v4 even, aubio_v4 odd) {
+  float32x4x2_t v;
+  v.val[0] = even;
+  v.val[1] = odd;
+  vst2q_f32(p, v);
+}
+#else
+#define SIMD_FFT_TRANSPOSE(r0, r1, r2, r3) _MM_TRANSPOSE4_PS(r0, r1, r2, r3)
+
+static inline void simd_fft_load_pairs(const smpl_t *p, aubio_v4 *even, aubio_v4 *odd) {
+  __m128 lo = _mm_loadu_ps(p);
+  __m128 hi = _mm_loadu_ps(p + 4);
+  *even = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+  *odd = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static inline void simd_fft_store_pairs(smpl_t *p, aubio_v4 even, aubio_v4 odd) {
+  _mm_storeu_ps(p, _mm_unpacklo_ps(even, odd));
+  _mm_storeu_ps(p + 4, _mm_unpackhi_ps(even, odd));
+}
+#endif
+
+struct _aubio_simd_fft_t {
+  uint_t size;        /* real points */
+  uint_t half;        /* complex points, size / 2 */
+  uint_t stages;      /* radix-4 stages */
+  uint_t radix2;      /* 1 when a radix-2 stage follows them */
+  /* per radix-4 stage of length len, for p < len / 4:
+     re(w^p), im(w^p), re(w^2p), im(w^2p), re(w^3p), im(w^3p) blocks with
+     w = exp(-2 pi i / len) */
+  smpl_t *twiddles;
+  /* exp(-2 pi i k / size) for k < half */
+  smpl_t *split_re;
+  smpl_t *split_im;
+  /* two work buffers of half complex values */
+  smpl_t *ar, *ai, *br, *bi;
+};
+
+/* (x * w) for split complex vectors, w given by its parts */
+#define SIMD_FFT_CMUL_RE(xr, xi, wr, wi) \
+  aubio_v4_sub(aubio_v4_mul(xr, wr), aubio_v4_mul(xi, wi))
+#define SIMD_FFT_CMUL_IM(xr, xi, wr, wi) \
+  aubio_v4_add(aubio_v4_mul(xr, wi), aubio_v4_mul(xi, wr))
+
+/* first radix-4 stage (stride 1): butterfly p reads x[p + k * q] and
+   writes y[4 p + k], so four butterflies in a register leave as a 4 x 4
+   block to transpose */
+static void simd_fft_first_stage(uint_t len, const smpl_t *tw,
+    const smpl_t *xr, const smpl_t *xi, smpl_t *yr, smpl_t *yi) {
+  uint_t q = len / 4, p, k;
+  for (p = 0; p < q; p += 4) {
+    aubio_v4 w1r = aubio_v4_load(tw + p), w1i = aubio_v4_load(tw + q + p);
+    aubio_v4 w2r = aubio_v4_load(tw + 2 * q + p), w2i = aubio_v4_load(tw + 3 * q + p);
+    aubio_v4 w3r = aubio_v4_load(tw + 4 * q + p), w3i = aubio_v4_load(tw + 5 * q + p);
+    aubio_v4 ar = aubio_v4_load(xr + p), ai = aubio_v4_load(xi + p);
+    aubio_v4 br = aubio_v4_load(xr + p + q), bi = aubio_v4_load(xi + p + q);
+    aubio_v4 cr = aubio_v4_load(xr + p + 2 * q), ci = aubio_v4_load(xi + p + 2 * q);
+    aubio_v4 dr = aubio_v4_load(xr + p + 3 * q), di = aubio_v4_load(xi + p + 3 * q);
+
+    aubio_v4 t0r = aubio_v4_add(ar, cr), t0i = aubio_v4_add(ai, ci);
+    aubio_v4 t1r = aubio_v4_sub(ar, cr), t1i = aubio_v4_sub(ai, ci);
+    aubio_v4 t2r = aubio_v4_add(br, dr), t2i = aubio_v4_add(bi, di);
+    aubio_v4 t3r = aubio_v4_sub(br, dr), t3i = aubio_v4_sub(bi, di);
+    /* t1 - i t3 and t1 + i t3 */
+    aubio_v4 u1r = aubio_v4_add(t1r, t3i), u1i = aubio_v4_sub(t1i, t3r);
+    aubio_v4 u3r = aubio_v4_sub(t1r, t3i), u3i = aubio_v4_add(t1i, t3r);
+    aubio_v4 u2r = aubio_v4_sub(t0r, t2r), u2i = aubio_v4_sub(t0i, t2i);
+
+    aubio_v4 y0r = aubio_v4_add(t0r, t2r), y0i = aubio_v4_add(t0i, t2i);
+    aubio_v4 y1r = SIMD_FFT_CMUL_RE(u1r, u1i, w1r, w1i), y1i = SIMD_FFT_CMUL_IM(u1r, u1i, w1r, w1i);
+    aubio_v4 y2r = SIMD_FFT_CMUL_RE(u2r, u2i, w2r, w2i), y2i = SIMD_FFT_CMUL_IM(u2r, u2i, w2r, w2i);
+    aubio_v4 y3r = SIMD_FFT_CMUL_RE(u3r, u3i, w3r, w3i), y3i = SIMD_FFT_CMUL_IM(u3r, u3i, w3r, w3i);
+
+    SIMD_FFT_TRANSPOSE(y0r, y1r, y2r, y3r);
+    SIMD_FFT_TRANSPOSE(y0i, y1i, y2i, y3i);
+    k = 4 * p;
+    aubio_v4_store(yr + k, y0r);
+    aubio_v4_store(yr + k + 4, y1r);
+    aubio_v4_store(yr + k + 8, y2r);
+    aubio_v4_store(yr + k + 12, y3r);
+    aubio_v4_store(yi + k, y0i);
+    aubio_v4_store(yi + k + 4, y1i);
+    aubio_v4_store(yi + k + 8, y2i);
+    aubio_v4_store(yi + k + 12, y3i);
+  }
+}
+
+/* later radix-4 stages (stride >= 4): butterfly (p, j) reads
+   x[j + stride (p + k q)] and writes y[j + stride (4 p + k)], four j at a
+   time with the twiddles of p broadcast */
+static void simd_fft_stage(uint_t len, uint_t stride, const smpl_t *tw,
+    const smpl_t *xr, const smpl_t *xi, smpl_t *yr, smpl_t *yi) {
+  uint_t q = len / 4, p, j;
+  uint_t step = q * stride;
+  for (p = 0; p < q; p++) {
+    aubio_v4 w1r = aubio_v4_set1(tw[p]), w1i = aubio_v4_set1(tw[q + p]);
+    aubio_v4 w2r = aubio_v4_set1(tw[2 * q + p]), w2i = aubio_v4_set1(tw[3 * q + p]);
+    aubio_v4 w3r = aubio_v4_set1(tw[4 * q + p]), w3i = aubio_v4_set1(tw[5 * q + p]);
+    const smpl_t *inr = xr + stride * p, *ini = xi + stride * p;
+    smpl_t *outr = yr + 4 * stride * p, *outi = yi + 4 * stride * p;
+    for (j = 0; j < stride; j += 4) {
+      aubio_v4 ar = aubio_v4_load(inr + j), ai = aubio_v4_load(ini + j);
+      aubio_v4 br = aubio_v4_load(inr + j + step), bi = aubio_v4_load(ini + j + step);
+      aubio_v4 cr = aubio_v4_load(inr + j + 2 * step), ci = aubio_v4_load(ini + j + 2 * step);
+      aubio_v4 dr = aubio_v4_load(inr + j + 3 * step), di = aubio_v4_load(ini + j + 3 * step);
+
+      aubio_v4 t0r = aubio_v4_add(ar, cr), t0i = aubio_v4_add(ai, ci);
+      aubio_v4 t1r = aubio_v4_sub(ar, cr), t1i = aubio_v4_sub(ai, ci);
+      aubio_v4 t2r = aubio_v4_add(br, dr), t2i = aubio_v4_add(bi, di);
+      aubio_v4 t3r = aubio_v4_sub(br, dr), t3i = aubio_v4_sub(bi, di);
+      aubio_v4 u1r = aubio_v4_add(t1r, t3i), u1i = aubio_v4_sub(t1i, t3r);
+      aubio_v4 u3r = aubio_v4_sub(t1r, t3i), u3i = aubio_v4_add(t1i, t3r);
+      aubio_v4 u2r = aubio_v4_sub(t0r, t2r), u2i = aubio_v4_sub(t0i, t2i);
+
+      aubio_v4_store(outr + j, aubio_v4_add(t0r, t2r));
+      aubio_v4_store(outi + j, aubio_v4_add(t0i, t2i));
+      aubio_v4_store(outr + j + stride, SIMD_FFT_CMUL_RE(u1r, u1i, w1r, w1i));
+      aubio_v4_store(outi + j + stride, SIMD_FFT_CMUL_IM(u1r, u1i, w1r, w1i));
+      aubio_v4_store(outr + j + 2 * stride, SIMD_FFT_CMUL_RE(u2r, u2i, w2r, w2i));
+      aubio_v4_store(outi + j + 2 * stride, SIMD_FFT_CMUL_IM(u2r, u2i, w2r, w2i));
+      aubio_v4_store(outr + j + 3 * stride, SIMD_FFT_CMUL_RE(u3r, u3i, w3r, w3i));
+      aubio_v4_store(outi + j + 3 * stride, SIMD_FFT_CMUL_IM(u3r, u3i, w3r, w3i));
+    }
+  }
+}
+
+/* last stage when log2(half) is odd: length 2, stride half / 2, twiddle 1 */
+static void simd_fft_radix2_stage(uint_t stride,
+    const smpl_t *xr, const smpl_t *xi, smpl_t *yr, smpl_t *yi) {
+  uint_t j;
+  for (j = 0; j < stride; j += 4) {
+    aubio_v4 ar = aubio_v4_load(xr + j), ai = aubio_v4_load(xi + j);
+    aubio_v4 br = aubio_v4_load(xr + j + stride), bi = aubio_v4_load(xi + j + stride);
+    aubio_v4_store(yr + j, aubio_v4_add(ar, br));
+    aubio_v4_store(yi + j, aubio_v4_add(ai, bi));
+    aubio_v4_store(yr + j + stride, aubio_v4_sub(ar, br));
+    aubio_v4_store(yi + j + stride, aubio_v4_sub(ai, bi));
+  }
+}
+
+/* forward complex DFT of (xr, xi), half points, using (yr, yi) as the
+   other buffer; returns through outr/outi whichever holds the result */
+static void simd_fft_complex(aubio_simd_fft_t *s, smpl_t *xr, smpl_t *xi,
+    smpl_t *yr, smpl_t *yi, smpl_t **outr, smpl_t **outi) {
+  uint_t len = s->half, stride = 1, stage;
+  const smpl_t *tw = s->twiddles;
+  smpl_t *t;
+  for (stage = 0; stage < s->stages; stage++) {
+    if (stride == 1) {
+      simd_fft_first_stage(len, tw, xr, xi, yr, yi);
+    } else {
+      simd_fft_stage(len, stride, tw, xr, xi, yr, yi);
+    }
+    tw += 6 * (len / 4);
+    t = xr; xr = yr; yr = t;
+    t = xi; xi = yi; yi = t;
+    len /= 4;
+    stride *= 4;
+  }
+  if (s->radix2) {
+    simd_fft_radix2_stage(stride, xr, xi, yr, yi);
+    xr = yr;
+    xi = yi;
+  }
+  *outr = xr;
+  *outi = xi;
+}
+
+aubio_simd_fft_t * new_aubio_simd_fft (uint_t size) {
+  aubio_simd_fft_t *s;
+  uint_t order = 0, len, p, i;
+  smpl_t *tw;
+  if (size < 32 || size > 65536 || (size & (size - 1)) != 0) {
+    return NULL;
+  }
+  while ((1u << order) < size / 2) order++;
+
+  s = AUBIO_NEW(aubio_simd_fft_t);
+  s->size = size;
+  s->half = size / 2;
+  s->stages = order / 2;
+  s->radix2 = order % 2;
+  /* the stage lengths' quarters sum to less than half */
+  s->twiddles = AUBIO_ARRAY(smpl_t, 6 * s->half / 2);
+  s->split_re = AUBIO_ARRAY(smpl_t, s->half);
+  s->split_im = AUBIO_ARRAY(smpl_t, s->half);
+  s->ar = AUBIO_ARRAY(smpl_t, s->half);
+  s->ai = AUBIO_ARRAY(smpl_t, s->half);
+  s->br = AUBIO_ARRAY(smpl_t, s->half);
+  s->bi = AUBIO_ARRAY(smpl_t, s->half);
+
+  tw = s->twiddles;
+  len = s->half;
+  for (i = 0; i < s->stages; i++) {
+    uint_t q = len / 4;
+    for (p = 0; p < q; p++) {
+      double a = -2. * M_PI * p / len;
+      tw[p] = (smpl_t)cos(a);
+      tw[q + p] = (smpl_t)sin(a);
+      tw[2 * q + p] = (smpl_t)cos(2. * a);
+      tw[3 * q + p] = (smpl_t)sin(2. * a);
+      tw[4 * q + p] = (smpl_t)cos(3. * a);
+      tw[5 * q + p] = (smpl_t)sin(3. * a);
+    }
+    tw += 6 * q;
+    len /= 4;
+  }
+  for (i = 0; i < s->half; i++) {
+    double a = -2. * M_PI * i / size;
+    s->split_re[i] = (smpl_t)cos(a);
+    s->split_im[i] = (smpl_t)sin(a);
+  }
+  return s;
+}
+
+void del_aubio_simd_fft (aubio_simd_fft_t * s) {
+  AUBIO_FREE(s->twiddles);
+  AUBIO_FREE(s->split_re);
+  AUBIO_FREE(s->split_im);
+  AUBIO_FREE(s->ar);
+  AUBIO_FREE(s->ai);
+  AUBIO_FREE(s->br);
+  AUBIO_FREE(s->bi);
+  AUBIO_FREE(s);
+}
+
+void aubio_simd_fft_forward (aubio_simd_fft_t * s, const smpl_t * input,
+    smpl_t * re, smpl_t * im) {
+  uint_t m = s->half, k;
+  smpl_t *zr, *zi;
+  aubio_v4 half = aubio_v4_set1(0.5f);
+
+  /* z[k] = x[2k] + i x[2k+1] */
+  for (k = 0; k < m; k += 4) {
+    aubio_v4 even, odd;
+    simd_fft_load_pairs(input + 2 * k, &even, &odd);
+    aubio_v4_store(s->ar + k, even);
+    aubio_v4_store(s->ai + k, odd);
+  }
+  simd_fft_complex(s, s->ar, s->ai, s->br, s->bi, &zr, &zi);
+
+  /* X[k] = E[k] + w^k O[k], with E and O, the spectra of the even and odd
+     samples, from Z[k] and conj(Z[m - k]) */
+  re[0] = zr[0] + zi[0];
+  im[0] = 0.;
+  re[m] = zr[0] - zi[0];
+  im[m] = 0.;
+  for (k = 1; k + 4 <= m; k += 4) {
+    aubio_v4 ar = aubio_v4_load(zr + k), ai = aubio_v4_load(zi + k);
+    aubio_v4 br = aubio_v4_reverse(aubio_v4_load(zr + m - k - 3));
+    aubio_v4 bi = aubio_v4_reverse(aubio_v4_load(zi + m - k - 3));
+    aubio_v4 wr = aubio_v4_load(s->split_re + k), wi = aubio_v4_load(s->split_im + k);
+    aubio_v4 er = aubio_v4_mul(aubio_v4_add(ar, br), half);
+    aubio_v4 ei = aubio_v4_mul(aubio_v4_sub(ai, bi), half);
+    aubio_v4 dr = aubio_v4_mul(aubio_v4_sub(ar, br), half);
+    aubio_v4 di = aubio_v4_mul(aubio_v4_add(ai, bi), half);
+    /* O = -i D */
+    aubio_v4_store(re + k, aubio_v4_add(er,
+          aubio_v4_add(aubio_v4_mul(wr, di), aubio_v4_mul(wi, dr))));
+    aubio_v4_store(im + k, aubio_v4_add(ei,
+          aubio_v4_sub(aubio_v4_mul(wi, di), aubio_v4_mul(wr, dr))));
+  }
+  for (; k < m; k++) {
+    smpl_t ar = zr[k], ai = zi[k], br = zr[m - k], bi = zi[m - k];
+    smpl_t wr = s->split_re[k], wi = s->split_im[k];
+    smpl_t dr = 0.5f * (ar - br), di = 0.5f * (ai + bi);
+    re[k] = 0.5f * (ar + br) + wr * di + wi * dr;
+    im[k] = 0.5f * (ai - bi) + wi * di - wr * dr;
+  }
+}
+
+void aubio_simd_fft_inverse (aubio_simd_fft_t * s, const smpl_t * re,
+    const smpl_t * im, smpl_t * output) {
+  uint_t m = s->half, k;
+  smpl_t *zr, *zi;
+
+  /* 2 Z[k] = (X[k] + conj(X[m - k])) + i w^-k (X[k] - conj(X[m - k])) */
+  s->ar[0] = re[0] + re[m];
+  s->ai[0] = re[0] - re[m];
+  for (k = 1; k + 4 <= m; k += 4) {
+    aubio_v4 ar = aubio_v4_load(re + k), ai = aubio_v4_load(im + k);
+    aubio_v4 br = aubio_v4_reverse(aubio_v4_load(re + m - k - 3));
+    aubio_v4 bi = aubio_v4_reverse(aubio_v4_load(im + m - k - 3));
+    aubio_v4 wr = aubio_v4_load(s->split_re + k), wi = aubio_v4_load(s->split_im + k);
+    aubio_v4 dr = aubio_v4_sub(ar, br), di = aubio_v4_add(ai, bi);
+    aubio_v4_store(s->ar + k, aubio_v4_add(aubio_v4_add(ar, br),
+          aubio_v4_sub(aubio_v4_mul(wi, dr), aubio_v4_mul(wr, di))));
+    aubio_v4_store(s->ai + k, aubio_v4_add(aubio_v4_sub(ai, bi),
+          aubio_v4_add(aubio_v4_mul(wr, dr), aubio_v4_mul(wi, di))));
+  }
+  for (; k < m; k++) {
+    smpl_t ar = re[k], ai = im[k], br = re[m - k], bi = im[m - k];
+    smpl_t wr = s->split_re[k], wi = s->split_im[k];
+    smpl_t dr = ar - br, di = ai + bi;
+    s->ar[k] = ar + br + wi * dr - wr * di;
+    s->ai[k] = ai - bi + wr * dr + wi * di;
+  }
+
+  /* the inverse DFT is the forward one with real and imaginary parts
+     swapped on the way in and out */
+  simd_fft_complex(s, s->ai, s->ar, s->bi, s->br, &zi, &zr);
+  for (k = 0; k < m; k += 4) {
+    simd_fft_store_pairs(output + 2 * k, aubio_v4_load(zr + k),
+        aubio_v4_load(zi + k));
+  }
+}
+
+#else /* HAVE_AUBIO_SIMD && !AUBIO_NO_SIMD_FFT */
+
+aubio_simd_fft_t * new_aubio_simd_fft (uint_t size UNUSED) {
+  return NULL;
+}
+
+void del_aubio_simd_fft (aubio_simd_fft_t * s UNUSED) {
+}
+
+void aubio_simd_fft_forward (aubio_simd_fft_t * s UNUSED,
+    const smpl_t * input UNUSED, smpl_t * re UNUSED, smpl_t * im UNUSED) {
+}
+
+void aubio_simd_fft_inverse (aubio_simd_fft_t * s UNUSED,
+    const smpl_t * re UNUSED, const smpl_t * im UNUSED,
+    smpl_t * output UNUSED) {
+}
+
+#endif /* HAVE_AUBIO_SIMD && !AUBIO_NO_SIMD_FFT */
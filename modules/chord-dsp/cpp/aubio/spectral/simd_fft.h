@@ -0,0 +1,48 @@
+/*
+ * NEON/SSE2 real FFT for builds without Accelerate.
+ * Generated for the chord-dsp Nitro module.
+ *
+ * A real transform of n points runs as a complex transform of n / 2 points
+ * on the even and odd samples, followed by one pass that splits the
+ * result into the spectrum of the real signal. The complex transform is a
+ * Stockham autosort FFT (no bit reversal) over separate real and
+ * imaginary arrays: radix-4 stages, plus one radix-2 stage when log2(n / 2)
+ * is odd. Every stage works on four butterflies per register; the first
+ * one, whose butterflies sit in adjacent elements, transposes 4 x 4 blocks
+ * on the way out so the rest need no shuffles at all.
+ *
+ * new_aubio_simd_fft() returns NULL when HAVE_AUBIO_SIMD is off (or
+ * AUBIO_NO_SIMD_FFT is defined) and for sizes it does not handle, so
+ * callers keep Ooura as the fallback. Like the other aubio headers, it
+ * expects types.h to be included first.
+ */
+
+#ifndef AUBIO_SIMD_FFT_H
+#define AUBIO_SIMD_FFT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _aubio_simd_fft_t aubio_simd_fft_t;
+
+/** plan for a real FFT of `size` points, a power of two from 32 to 65536,
+  or NULL */
+aubio_simd_fft_t * new_aubio_simd_fft (uint_t size);
+void del_aubio_simd_fft (aubio_simd_fft_t * s);
+
+/** unscaled DFT of `input` (size samples) into `re` and `im`, size / 2 + 1
+  bins each; the DC and Nyquist imaginary parts are zero */
+void aubio_simd_fft_forward (aubio_simd_fft_t * s, const smpl_t * input,
+    smpl_t * re, smpl_t * im);
+
+/** unscaled inverse: `output` (size samples) is size times the signal whose
+  spectrum is re/im; im[0] and im[size / 2] are ignored */
+void aubio_simd_fft_inverse (aubio_simd_fft_t * s, const smpl_t * re,
+    const smpl_t * im, smpl_t * output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUBIO_SIMD_FFT_H */
@@ -24,6 +24,7 @@
 #include "spectral/fft.h"
 #include "spectral/specdesc.h"
 #include "mathutils.h"
+#include "simd.h"
 #include "utils/hist.h"
 
 void aubio_specdesc_energy(aubio_specdesc_t *o, const cvec_t * fftgrain, fvec_t * onset);
@@ -100,11 +101,15 @@ void aubio_specdesc_energy  (aubio_specdesc_t *o UNUSED,
 /* High Frequency Content onset detection function */
 void aubio_specdesc_hfc(aubio_specdesc_t *o UNUSED,
     const cvec_t * fftgrain, fvec_t * onset){
+#if defined(HAVE_AUBIO_SIMD)
+  onset->data[0] = aubio_simd_ramp_sum(fftgrain->norm, fftgrain->length);
+#else
   uint_t j;
   onset->data[0] = 0.;
   for (j=0;j<fftgrain->length;j++) {
     onset->data[0] += (j+1)*fftgrain->norm[j];
   }
+#endif
 }
 
 
@@ -393,6 +398,24 @@ new_aubio_specdesc (const char_t * onset_mode, uint_t size){
   return o;
 }
 
+uint_t aubio_specdesc_uses_phase (const aubio_specdesc_t *o) {
+  switch(o->onset_type) {
+    case aubio_onset_complex:
+    case aubio_onset_phase:
+    case aubio_onset_wphase:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+void aubio_specdesc_reset (aubio_specdesc_t *o) {
+  /* dev1 and histog are rewritten every frame */
+  if (o->oldmag) fvec_zeros(o->oldmag);
+  if (o->theta1) fvec_zeros(o->theta1);
+  if (o->theta2) fvec_zeros(o->theta2);
+}
+
 void del_aubio_specdesc (aubio_specdesc_t *o){
   switch(o->onset_type) {
     case aubio_onset_energy:
@@ -190,6 +190,23 @@ void aubio_specdesc_do (aubio_specdesc_t * o, const cvec_t * fftgrain,
 */
 aubio_specdesc_t *new_aubio_specdesc (const char_t * method, uint_t buf_size);
 
+/** check whether a spectral description reads the phase of its input
+
+  \param o spectral descriptor object as returned by new_aubio_specdesc()
+
+  \return 1 for `complex`, `phase` and `wphase`, 0 for methods that only
+  read the norm
+
+*/
+uint_t aubio_specdesc_uses_phase (const aubio_specdesc_t * o);
+
+/** forget the previous frames a spectral description compares against
+
+  \param o spectral descriptor object as returned by new_aubio_specdesc()
+
+*/
+void aubio_specdesc_reset (aubio_specdesc_t * o);
+
 /** deletion of a spectral descriptor
 
   \param o spectral descriptor object as returned by new_aubio_specdesc()
@@ -0,0 +1,150 @@
+/*
+  This file is part of the chord-dsp fork of aubio.
+
+  aubio is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  aubio is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with aubio.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "aubio_priv.h"
+#include "utils/runmedian.h"
+
+/* heap slots [0, nlo) hold the lower half as a max-heap, slots [nlo, n)
+ * the upper half as a min-heap; heap[] stores window indices and where[]
+ * maps each window index back to its slot */
+struct _aubio_runmedian_t {
+  uint_t length;
+  uint_t nlo;
+  uint_t write;         /* window index of the oldest value */
+  smpl_t *data;         /* window, circular */
+  uint_t *heap;
+  uint_t *where;
+  lsmp_t sum;
+};
+
+#define RM_VAL(s, slot) ((s)->data[(s)->heap[(slot)]])
+
+static void aubio_runmedian_swap (aubio_runmedian_t *s, uint_t a, uint_t b)
+{
+  uint_t tmp = s->heap[a];
+  s->heap[a] = s->heap[b];
+  s->heap[b] = tmp;
+  s->where[s->heap[a]] = a;
+  s->where[s->heap[b]] = b;
+}
+
+/* sift within one heap; base is its first slot, count its size and
+ * sign +1 for the max-heap, -1 for the min-heap */
+static void aubio_runmedian_sift (aubio_runmedian_t *s, uint_t base,
+    uint_t count, sint_t sign, uint_t k)
+{
+  /* up */
+  while (k > 0) {
+    uint_t parent = (k - 1) / 2;
+    if (sign * (RM_VAL(s, base + k) - RM_VAL(s, base + parent)) <= 0) break;
+    aubio_runmedian_swap (s, base + k, base + parent);
+    k = parent;
+  }
+  /* down */
+  for (;;) {
+    uint_t child = 2 * k + 1, best = k;
+    if (child < count && sign * (RM_VAL(s, base + child) - RM_VAL(s, base + best)) > 0)
+      best = child;
+    if (child + 1 < count && sign * (RM_VAL(s, base + child + 1) - RM_VAL(s, base + best)) > 0)
+      best = child + 1;
+    if (best == k) break;
+    aubio_runmedian_swap (s, base + k, base + best);
+    k = best;
+  }
+}
+
+aubio_runmedian_t * new_aubio_runmedian (uint_t length)
+{
+  aubio_runmedian_t *s;
+  if ((sint_t)length <= 0) {
+    return NULL;
+  }
+  s = AUBIO_NEW (aubio_runmedian_t);
+  s->length = length;
+  s->nlo = (length + 1) / 2;
+  s->data = AUBIO_ARRAY (smpl_t, length);
+  s->heap = AUBIO_ARRAY (uint_t, length);
+  s->where = AUBIO_ARRAY (uint_t, length);
+  aubio_runmedian_reset (s);
+  return s;
+}
+
+void del_aubio_runmedian (aubio_runmedian_t *s)
+{
+  AUBIO_FREE (s->data);
+  AUBIO_FREE (s->heap);
+  AUBIO_FREE (s->where);
+  AUBIO_FREE (s);
+}
+
+void aubio_runmedian_reset (aubio_runmedian_t *s)
+{
+  uint_t j;
+  for (j = 0; j < s->length; j++) {
+    s->data[j] = 0.;
+    s->heap[j] = j;
+    s->where[j] = j;
+  }
+  s->write = 0;
+  s->sum = 0.;
+}
+
+void aubio_runmedian_push (aubio_runmedian_t *s, smpl_t value)
+{
+  uint_t idx = s->write, slot = s->where[idx];
+  uint_t nlo = s->nlo, nhi = s->length - nlo;
+
+  s->sum += (lsmp_t)value - s->data[idx];
+  s->data[idx] = value;
+
+  if (slot < nlo) {
+    aubio_runmedian_sift (s, 0, nlo, 1, slot);
+  } else {
+    aubio_runmedian_sift (s, nlo, nhi, -1, slot - nlo);
+  }
+  /* one exchange of the two tops restores max(lower) <= min(upper) */
+  if (nhi > 0 && RM_VAL(s, 0) > RM_VAL(s, nlo)) {
+    aubio_runmedian_swap (s, 0, nlo);
+    aubio_runmedian_sift (s, 0, nlo, 1, 0);
+    aubio_runmedian_sift (s, nlo, nhi, -1, 0);
+  }
+
+  s->write++;
+  if (s->write == s->length) {
+    uint_t j;
+    s->write = 0;
+    /* resum once per lap so the running sum does not drift */
+    s->sum = 0.;
+    for (j = 0; j < s->length; j++) s->sum += s->data[j];
+  }
+}
+
+smpl_t aubio_runmedian_median (const aubio_runmedian_t *s)
+{
+  return RM_VAL(s, 0);
+}
+
+smpl_t aubio_runmedian_mean (const aubio_runmedian_t *s)
+{
+  return (smpl_t)(s->sum / s->length);
+}
+
+smpl_t aubio_runmedian_get (const aubio_runmedian_t *s, uint_t age)
+{
+  return s->data[(s->write + s->length - 1 - age % s->length) % s->length];
+}
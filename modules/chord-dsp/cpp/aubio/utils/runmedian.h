@@ -0,0 +1,61 @@
+/*
+  This file is part of the chord-dsp fork of aubio.
+
+  aubio is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  aubio is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with aubio.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+/** @file
+ *
+ * Running median and mean over a fixed-length sliding window
+ *
+ * The window is kept as two indexed heaps (a max-heap holding the lower
+ * half, a min-heap holding the upper half), so pushing a value costs
+ * O(log n) instead of the O(n) copy and quickselect of fvec_median().
+ */
+
+#ifndef AUBIO_RUNMEDIAN_H
+#define AUBIO_RUNMEDIAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** running median object */
+typedef struct _aubio_runmedian_t aubio_runmedian_t;
+
+/** running median creation
+
+  \param length window length; the window starts filled with zeros
+
+*/
+aubio_runmedian_t * new_aubio_runmedian(uint_t length);
+/** running median deletion */
+void del_aubio_runmedian(aubio_runmedian_t *s);
+/** replace the oldest value of the window with a new one */
+void aubio_runmedian_push(aubio_runmedian_t *s, smpl_t value);
+/** median of the window, the lower one for even lengths like fvec_median() */
+smpl_t aubio_runmedian_median(const aubio_runmedian_t *s);
+/** mean of the window */
+smpl_t aubio_runmedian_mean(const aubio_runmedian_t *s);
+/** value pushed `age` calls ago, 0 being the newest */
+smpl_t aubio_runmedian_get(const aubio_runmedian_t *s, uint_t age);
+/** refill the window with zeros */
+void aubio_runmedian_reset(aubio_runmedian_t *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUBIO_RUNMEDIAN_H */
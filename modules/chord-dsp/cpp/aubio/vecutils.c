@@ -3,6 +3,7 @@
 #include "fvec.h"
 #include "cvec.h"
 #include "vecutils.h"
+#include "simd.h"
 
 #define AUBIO_OP(OPNAME, OP, TYPE, OBJ) \
 void TYPE ## _ ## OPNAME (TYPE ## _t *o) \
@@ -19,14 +20,36 @@ void TYPE ## _ ## OPNAME (TYPE ## _t *o) \
 AUBIO_OP_C(exp, EXP)
 AUBIO_OP_C(cos, COS)
 AUBIO_OP_C(sin, SIN)
-AUBIO_OP_C(abs, ABS)
-AUBIO_OP_C(sqrt, SQRT)
 AUBIO_OP_C(log10, SAFE_LOG10)
 AUBIO_OP_C(log, SAFE_LOG)
 AUBIO_OP_C(floor, FLOOR)
 AUBIO_OP_C(ceil, CEIL)
 AUBIO_OP_C(round, ROUND)
 
+void fvec_abs (fvec_t *s)
+{
+#if defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vabs(s->data, s->length);
+#else
+  uint_t j;
+  for (j = 0; j < s->length; j++) {
+    s->data[j] = ABS(s->data[j]);
+  }
+#endif
+}
+
+void fvec_sqrt (fvec_t *s)
+{
+#if defined(HAVE_AUBIO_SIMD)
+  aubio_simd_vsqrt(s->data, s->length);
+#else
+  uint_t j;
+  for (j = 0; j < s->length; j++) {
+    s->data[j] = SQRT(s->data[j]);
+  }
+#endif
+}
+
 void fvec_pow (fvec_t *s, smpl_t power)
 {
   uint_t j;
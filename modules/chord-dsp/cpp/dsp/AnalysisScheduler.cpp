@@ -0,0 +1,84 @@
+#include "AnalysisScheduler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// Smoothing of the per-hop load, about 10 hops
+constexpr float kLoadSmoothing = 0.1f;
+
+constexpr int kChromaStrides[AnalysisScheduler::kMaxLevel + 1] = {1, 1, 2, 4};
+constexpr int kMelStrides[AnalysisScheduler::kMaxLevel + 1] = {1, 2, 4, 8};
+
+} // namespace
+
+int AnalysisScheduler::chromaStride(int level) {
+  return kChromaStrides[std::clamp(level, 0, kMaxLevel)];
+}
+
+int AnalysisScheduler::melStride(int level) {
+  return kMelStrides[std::clamp(level, 0, kMaxLevel)];
+}
+
+AnalysisScheduler::AnalysisScheduler(double hopSeconds) : hopSeconds_(hopSeconds) {
+  if (!(hopSeconds > 0.0)) {
+    throw std::invalid_argument("AnalysisScheduler: hopSeconds must be positive, got " + std::to_string(hopSeconds));
+  }
+  budgetNanos_ = static_cast<uint64_t>(hopSeconds * 1e9);
+  raiseHops_ = std::max(1, static_cast<int>(std::ceil(kRaiseSeconds / hopSeconds)));
+  lowerHops_ = std::max(1, static_cast<int>(std::ceil(kLowerSeconds / hopSeconds)));
+}
+
+void AnalysisScheduler::record(uint64_t nanos, size_t backlogHops) {
+  float hopLoad = static_cast<float>(static_cast<double>(nanos) / static_cast<double>(budgetNanos_));
+  smoothedLoad_ = smoothedLoad_ < 0.0f ? hopLoad : smoothedLoad_ + kLoadSmoothing * (hopLoad - smoothedLoad_);
+  float load = smoothedLoad_;
+  load_.store(load, std::memory_order_relaxed);
+
+  double backlog = static_cast<double>(backlogHops) * hopSeconds_;
+  if (load > kRaiseLoad || backlog > kRaiseBacklogSeconds) {
+    calmHops_ = 0;
+    if (++pressureHops_ >= raiseHops_ && adaptive_ < kMaxLevel) {
+      adaptive_++;
+      pressureHops_ = 0;
+    }
+  } else if (load < kLowerLoad && backlog < kLowerBacklogSeconds) {
+    pressureHops_ = 0;
+    if (++calmHops_ >= lowerHops_ && adaptive_ > 0) {
+      adaptive_--;
+      calmHops_ = 0;
+    }
+  } else {
+    pressureHops_ = 0;
+    calmHops_ = 0;
+  }
+  level_.store(adaptive_, std::memory_order_relaxed);
+}
+
+bool AnalysisScheduler::nextHopFoldsChroma() {
+  return hop_++ % static_cast<uint64_t>(chromaStride(level())) == 0;
+}
+
+void AnalysisScheduler::setFloor(int level) {
+  floor_.store(std::clamp(level, 0, kMaxLevel), std::memory_order_relaxed);
+}
+
+void AnalysisScheduler::reset() {
+  adaptive_ = 0;
+  pressureHops_ = 0;
+  calmHops_ = 0;
+  hop_ = 0;
+  smoothedLoad_ = -1.0f;
+  load_.store(0.0f, std::memory_order_relaxed);
+  level_.store(0, std::memory_order_relaxed);
+}
+
+int AnalysisScheduler::level() const {
+  return std::max(level_.load(std::memory_order_relaxed), floor_.load(std::memory_order_relaxed));
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::chorddsp {
+
+// Degrades the streaming analysis gracefully on slow devices. Each hop
+// reports how long its analysis took and how far behind the consumer is;
+// load (analysis time over the hop's real-time budget) and backlog pick a
+// level with hysteresis: raised after kRaiseSeconds of pressure, lowered
+// after kLowerSeconds of calm. Higher levels fold chroma every few hops and
+// stretch the mel/ML cadence; onset detection always runs every hop.
+// record() and setFloor() may run on different threads, and level() and
+// load() may be read from any thread.
+class AnalysisScheduler {
+public:
+  static constexpr int kMaxLevel = 3;
+
+  // Pressure: smoothed load above kRaiseLoad or backlog above kRaiseBacklogSeconds
+  static constexpr float kRaiseLoad = 0.5f;
+  static constexpr double kRaiseBacklogSeconds = 0.5;
+  static constexpr double kRaiseSeconds = 0.25;
+  // Calm: load below kLowerLoad and backlog below kLowerBacklogSeconds
+  static constexpr float kLowerLoad = 0.2f;
+  static constexpr double kLowerBacklogSeconds = 0.3;
+  static constexpr double kLowerSeconds = 3.0;
+
+  // Hops between chroma folds and multiplier of the mel/ML period, per level
+  static int chromaStride(int level);
+  static int melStride(int level);
+
+  explicit AnalysisScheduler(double hopSeconds);
+
+  AnalysisScheduler(const AnalysisScheduler&) = delete;
+  AnalysisScheduler& operator=(const AnalysisScheduler&) = delete;
+
+  // One analyzed hop: its analysis time and the hops still waiting after it
+  void record(uint64_t nanos, size_t backlogHops);
+  // Whether the hop about to be analyzed folds chroma at the current level
+  bool nextHopFoldsChroma();
+  // Lowest level to use whatever the load, e.g. from the device's thermal state
+  void setFloor(int level);
+  // Back to level 0 with no history; the floor is kept
+  void reset();
+
+  int level() const;
+  float load() const { return load_.load(std::memory_order_relaxed); }
+
+private:
+  double hopSeconds_;
+  uint64_t budgetNanos_;
+  int raiseHops_;
+  int lowerHops_;
+
+  // Recording side; level_ and load_ publish them
+  int adaptive_ = 0;
+  float smoothedLoad_ = -1.0f; // < 0 until the first hop
+  int pressureHops_ = 0;
+  int calmHops_ = 0;
+  uint64_t hop_ = 0;
+
+  std::atomic<int> level_{0};
+  std::atomic<int> floor_{0};
+  std::atomic<float> load_{0.0f};
+};
+
+} // namespace margelo::nitro::chorddsp
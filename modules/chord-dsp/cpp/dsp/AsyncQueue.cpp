@@ -0,0 +1,107 @@
+#include "AsyncQueue.hpp"
+#include <algorithm>
+#include <utility>
+
+#ifdef __APPLE__
+#include <pthread.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+AsyncQueue::AsyncQueue(int threads, size_t maxWaiting) : maxWaiting_(std::max<size_t>(maxWaiting, 1)) {
+  int count = std::max(threads, 1);
+  running_.resize(count);
+  threads_.reserve(count);
+  for (int i = 0; i < count; i++) {
+    threads_.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+AsyncQueue::~AsyncQueue() {
+  std::deque<Waiting> dropped;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+    dropped.swap(waiting_);
+    for (Running& running : running_) {
+      if (running.cancelled) running.cancelled->store(true, std::memory_order_relaxed);
+    }
+  }
+  wake_.notify_all();
+  for (Waiting& job : dropped) job.dropped();
+  for (std::thread& thread : threads_) thread.join();
+}
+
+AsyncQueue& AsyncQueue::shared() {
+  static AsyncQueue* queue = new AsyncQueue(kSharedThreads, kSharedMaxWaiting);
+  return *queue;
+}
+
+bool AsyncQueue::post(const std::string& lane, Job job, Dropped dropped) {
+  Dropped replaced;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(waiting_.begin(), waiting_.end(), [&](const Waiting& w) { return w.lane == lane; });
+    if (it == waiting_.end() && waiting_.size() >= maxWaiting_) return false;
+    cancelRunning(lane);
+    if (it != waiting_.end()) {
+      replaced = std::move(it->dropped);
+      it->job = std::move(job);
+      it->dropped = std::move(dropped);
+    } else {
+      waiting_.push_back({lane, std::move(job), std::move(dropped)});
+    }
+  }
+  wake_.notify_one();
+  // Outside the lock: it may resolve a promise or post again
+  if (replaced) replaced();
+  return true;
+}
+
+void AsyncQueue::cancel(const std::string& lane) {
+  Dropped dropped;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelRunning(lane);
+    auto it = std::find_if(waiting_.begin(), waiting_.end(), [&](const Waiting& w) { return w.lane == lane; });
+    if (it != waiting_.end()) {
+      dropped = std::move(it->dropped);
+      waiting_.erase(it);
+    }
+  }
+  if (dropped) dropped();
+}
+
+void AsyncQueue::cancelRunning(const std::string& lane) {
+  for (Running& running : running_) {
+    if (running.cancelled && running.lane == lane) running.cancelled->store(true, std::memory_order_relaxed);
+  }
+}
+
+void AsyncQueue::workerLoop(int worker) {
+#ifdef __APPLE__
+  // Work the user is waiting on, below the audio and analysis threads
+  pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+#endif
+  for (;;) {
+    Waiting next;
+    std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [this] { return stopping_ || !waiting_.empty(); });
+      if (stopping_) return;
+      next = std::move(waiting_.front());
+      waiting_.pop_front();
+      running_[worker] = {next.lane, cancelled};
+    }
+
+    next.job(*cancelled);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_[worker] = Running();
+    }
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Bounded background threads for the JS-facing async calls. Each job is
+// posted under a lane, a caller-chosen name for one stream of requests (the
+// inference window, a file import): at most one job waits per lane, so
+// posting to a lane replaces the job still waiting there instead of
+// queueing behind it, and flags the lane's running job as cancelled. A
+// replaced job never runs; its `dropped` callback runs instead. Lanes wait
+// in the order they were first posted, so a lane that keeps replacing its
+// job does not lose its turn.
+class AsyncQueue {
+public:
+  // Long jobs check `cancelled` at convenient points and may stop early.
+  // Jobs must not throw.
+  using Job = std::function<void(const std::atomic<bool>& cancelled)>;
+  using Dropped = std::function<void()>;
+
+  AsyncQueue(int threads, size_t maxWaiting);
+  // Drops waiting jobs and joins the threads after their running jobs
+  ~AsyncQueue();
+
+  AsyncQueue(const AsyncQueue&) = delete;
+  AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+  // The process-wide queue: kSharedThreads threads, kSharedMaxWaiting
+  // lanes. Never destroyed, as its jobs may still run at exit.
+  static AsyncQueue& shared();
+  static constexpr int kSharedThreads = 2;
+  static constexpr size_t kSharedMaxWaiting = 16;
+
+  // Returns false, changing nothing, when `lane` has no
+  // waiting job and maxWaiting lanes already wait
+  bool post(const std::string& lane, Job job, Dropped dropped);
+  // Drops the lane's waiting job and flags its running ones
+  void cancel(const std::string& lane);
+
+  int threads() const { return static_cast<int>(threads_.size()); }
+
+private:
+  struct Waiting {
+    std::string lane;
+    Job job;
+    Dropped dropped;
+  };
+  struct Running {
+    std::string lane;
+    std::shared_ptr<std::atomic<bool>> cancelled;
+  };
+
+  void workerLoop(int worker);
+  // Flags the running jobs of `lane`; mutex_ held
+  void cancelRunning(const std::string& lane);
+
+  size_t maxWaiting_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;
+  std::deque<Waiting> waiting_;
+  // One slot per thread, lane empty while idle
+  std::vector<Running> running_;
+  std::vector<std::thread> threads_;
+};
+
+} // namespace margelo::nitro::chorddsp
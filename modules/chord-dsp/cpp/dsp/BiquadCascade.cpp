@@ -0,0 +1,211 @@
+#include "BiquadCascade.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#ifdef __APPLE__
+// Accelerate comes with the header
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CHORD_DSP_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CHORD_DSP_SSE2 1
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+#ifdef CHORD_DSP_NEON
+using V4 = float32x4_t;
+inline V4 load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, V4 v) { vst1q_f32(p, v); }
+inline V4 add(V4 a, V4 b) { return vaddq_f32(a, b); }
+inline V4 sub(V4 a, V4 b) { return vsubq_f32(a, b); }
+inline V4 mul(V4 a, V4 b) { return vmulq_f32(a, b); }
+// [x, v0, v1, v2]: the newest sample into section 0, each section's last
+// output into the next
+inline V4 shiftIn(V4 v, float x) { return vextq_f32(vdupq_n_f32(x), v, 3); }
+#elif defined(CHORD_DSP_SSE2)
+using V4 = __m128;
+inline V4 load(const float* p) { return _mm_load_ps(p); }
+inline void store(float* p, V4 v) { _mm_store_ps(p, v); }
+inline V4 add(V4 a, V4 b) { return _mm_add_ps(a, b); }
+inline V4 sub(V4 a, V4 b) { return _mm_sub_ps(a, b); }
+inline V4 mul(V4 a, V4 b) { return _mm_mul_ps(a, b); }
+inline V4 shiftIn(V4 v, float x) { return _mm_move_ss(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)), _mm_set_ss(x)); }
+#endif
+
+// Both poles inside the unit circle (the stability triangle)
+bool isStable(const BiquadCascade::Section& s) {
+  return std::fabs(s.a2) < 1.0f && std::fabs(s.a1) < 1.0f + s.a2;
+}
+
+} // namespace
+
+BiquadCascade::Section BiquadCascade::dcBlocker(double cutoffHz, double sampleRate) {
+  Section s;
+  s.b1 = -1.0f;
+  s.a1 = static_cast<float>(-std::exp(-2.0 * kPi * cutoffHz / sampleRate));
+  return s;
+}
+
+BiquadCascade::Section BiquadCascade::highPass(double cutoffHz, double sampleRate, double q) {
+  double w0 = 2.0 * kPi * cutoffHz / sampleRate;
+  double cosw = std::cos(w0);
+  double alpha = std::sin(w0) / (2.0 * q);
+  double a0 = 1.0 + alpha;
+  Section s;
+  s.b0 = static_cast<float>((1.0 + cosw) / 2.0 / a0);
+  s.b1 = static_cast<float>(-(1.0 + cosw) / a0);
+  s.b2 = s.b0;
+  s.a1 = static_cast<float>(-2.0 * cosw / a0);
+  s.a2 = static_cast<float>((1.0 - alpha) / a0);
+  return s;
+}
+
+BiquadCascade::Section BiquadCascade::preEmphasis(double coefficient) {
+  Section s;
+  s.b1 = static_cast<float>(-coefficient);
+  return s;
+}
+
+std::vector<BiquadCascade::Section> BiquadCascade::design(double sampleRate, double dcCutoffHz, double highPassHz, double preEmphasis) {
+  double nyquist = sampleRate / 2.0;
+  if (!(dcCutoffHz >= 0.0 && dcCutoffHz < nyquist)) {
+    throw std::invalid_argument("BiquadCascade: dcCutoffHz must be in [0, " + std::to_string(nyquist) + "), got " + std::to_string(dcCutoffHz));
+  }
+  if (!(highPassHz >= 0.0 && highPassHz < nyquist)) {
+    throw std::invalid_argument("BiquadCascade: highPassHz must be in [0, " + std::to_string(nyquist) + "), got " + std::to_string(highPassHz));
+  }
+  if (!(preEmphasis >= 0.0 && preEmphasis < 1.0)) {
+    throw std::invalid_argument("BiquadCascade: preEmphasis must be in [0, 1), got " + std::to_string(preEmphasis));
+  }
+
+  std::vector<Section> sections;
+  if (dcCutoffHz > 0.0) sections.push_back(dcBlocker(dcCutoffHz, sampleRate));
+  if (highPassHz > 0.0) {
+    // 4th-order Butterworth: Q = 1 / (2 cos(pi / 8)) and 1 / (2 cos(3 pi / 8))
+    sections.push_back(highPass(highPassHz, sampleRate, 0.54119610));
+    sections.push_back(highPass(highPassHz, sampleRate, 1.30656296));
+  }
+  if (preEmphasis > 0.0) sections.push_back(BiquadCascade::preEmphasis(preEmphasis));
+  return sections;
+}
+
+BiquadCascade::BiquadCascade(const std::vector<Section>& sections) : sections_(sections) {
+  if (sections_.size() > static_cast<size_t>(kMaxSections)) {
+    throw std::invalid_argument("BiquadCascade: at most " + std::to_string(kMaxSections) + " sections, got " + std::to_string(sections_.size()));
+  }
+  for (size_t i = 0; i < sections_.size(); i++) {
+    const Section& s = sections_[i];
+    if (!std::isfinite(s.b0) || !std::isfinite(s.b1) || !std::isfinite(s.b2)) {
+      throw std::invalid_argument("BiquadCascade: section " + std::to_string(i) + " has a non-finite coefficient");
+    }
+    if (!isStable(s)) {
+      throw std::invalid_argument("BiquadCascade: section " + std::to_string(i) + " has a pole on or outside the unit circle");
+    }
+  }
+
+#ifdef __APPLE__
+  if (!sections_.empty()) {
+    std::vector<double> coefficients;
+    for (const Section& s : sections_) coefficients.insert(coefficients.end(), {s.b0, s.b1, s.b2, s.a1, s.a2});
+    setup_ = vDSP_biquad_CreateSetup(coefficients.data(), sections_.size());
+  }
+  delay_.assign(2 * sections_.size() + 2, 0.0f);
+#else
+  for (int lane = 0; lane < kMaxSections; lane++) {
+    Section s = lane < static_cast<int>(sections_.size()) ? sections_[lane] : Section();
+    coefficients_[0][lane] = s.b0;
+    coefficients_[1][lane] = s.b1;
+    coefficients_[2][lane] = s.b2;
+    coefficients_[3][lane] = s.a1;
+    coefficients_[4][lane] = s.a2;
+  }
+#endif
+}
+
+BiquadCascade::~BiquadCascade() {
+#ifdef __APPLE__
+  if (setup_) vDSP_biquad_DestroySetup(setup_);
+#endif
+}
+
+void BiquadCascade::reset() {
+#ifdef __APPLE__
+  std::fill(delay_.begin(), delay_.end(), 0.0f);
+#else
+  std::fill(z1_, z1_ + kMaxSections, 0.0f);
+  std::fill(z2_, z2_ + kMaxSections, 0.0f);
+  std::fill(last_, last_ + kMaxSections, 0.0f);
+#endif
+}
+
+void BiquadCascade::process(float* samples, size_t count) {
+  if (sections_.empty() || count == 0) return;
+
+#ifdef __APPLE__
+  vDSP_biquad(setup_, delay_.data(), samples, 1, samples, 1, count);
+#elif defined(CHORD_DSP_NEON) || defined(CHORD_DSP_SSE2)
+  const V4 b0 = load(coefficients_[0]);
+  const V4 b1 = load(coefficients_[1]);
+  const V4 b2 = load(coefficients_[2]);
+  const V4 a1 = load(coefficients_[3]);
+  const V4 a2 = load(coefficients_[4]);
+  V4 z1 = load(z1_);
+  V4 z2 = load(z2_);
+  V4 y = load(last_);
+  alignas(16) float out[kMaxSections];
+
+  auto step = [&](float x) {
+    V4 in = shiftIn(y, x);
+    y = add(mul(b0, in), z1);
+    z1 = add(sub(mul(b1, in), mul(a1, y)), z2);
+    z2 = sub(mul(b2, in), mul(a2, y));
+  };
+
+  // Step i finishes sample i - lag; the first lag steps of a call finish
+  // samples the previous call's drain already wrote (or that precede the
+  // stream)
+  const size_t lag = static_cast<size_t>(sections() - 1);
+  for (size_t i = 0; i < count; i++) {
+    step(samples[i]);
+    if (i >= lag) {
+      store(out, y);
+      samples[i - lag] = out[lag];
+    }
+  }
+  store(z1_, z1);
+  store(z2_, z2);
+  store(last_, y);
+
+  // Drain the last lag samples on the copy in registers: the zeros fed to
+  // section 0 reach the last section only after them
+  for (size_t j = 1; j <= lag; j++) {
+    step(0.0f);
+    if (count + j > lag) {
+      store(out, y);
+      samples[count + j - 1 - lag] = out[lag];
+    }
+  }
+#else
+  const int n = sections();
+  for (size_t i = 0; i < count; i++) {
+    float x = samples[i];
+    for (int s = 0; s < n; s++) {
+      float y = coefficients_[0][s] * x + z1_[s];
+      z1_[s] = coefficients_[1][s] * x - coefficients_[3][s] * y + z2_[s];
+      z2_[s] = coefficients_[2][s] * x - coefficients_[4][s] * y;
+      x = y;
+    }
+    samples[i] = x;
+  }
+#endif
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+// Up to kMaxSections second-order sections in series with their state kept
+// across process() calls, for DC, rumble and pre-emphasis filtering in the
+// ingest pass. vDSP_biquad on Apple. Elsewhere, on NEON and SSE2, the
+// sections run in the four lanes of one register as a pipeline: each step
+// feeds the next input sample to section 0 while section s works on the
+// output section s - 1 produced one step earlier, so one vector update
+// (transposed direct form II) advances every section. The last section
+// finishes a sample sections() - 1 steps after it entered; each call
+// drains those on a copy of the state, so the output has no added latency
+// and does not depend on how the stream is chunked. Plain per-sample loops
+// otherwise.
+class BiquadCascade {
+public:
+  static constexpr int kMaxSections = 4;
+
+  // y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+  struct Section {
+    float b0 = 1.0f;
+    float b1 = 0.0f;
+    float b2 = 0.0f;
+    float a1 = 0.0f;
+    float a2 = 0.0f;
+  };
+
+  // Pole/zero pair at DC with its pole at exp(-2 pi cutoffHz / sampleRate)
+  static Section dcBlocker(double cutoffHz, double sampleRate);
+  // RBJ cookbook high-pass
+  static Section highPass(double cutoffHz, double sampleRate, double q);
+  // y[n] = x[n] - coefficient * x[n-1]
+  static Section preEmphasis(double coefficient);
+  // The app's pre-filter: DC blocker, 4th-order Butterworth high-pass (two
+  // sections) and pre-emphasis, each left out when its value is 0
+  static std::vector<Section> design(double sampleRate, double dcCutoffHz, double highPassHz, double preEmphasis);
+
+  // Throws std::invalid_argument for more than kMaxSections sections or an
+  // unstable one
+  explicit BiquadCascade(const std::vector<Section>& sections);
+  ~BiquadCascade();
+
+  BiquadCascade(const BiquadCascade&) = delete;
+  BiquadCascade& operator=(const BiquadCascade&) = delete;
+
+  int sections() const { return static_cast<int>(sections_.size()); }
+
+  // Filters `count` samples in place, continuing from the previous call
+  void process(float* samples, size_t count);
+  // Clears the filter memory, as for a new stream
+  void reset();
+
+private:
+  std::vector<Section> sections_;
+
+#ifdef __APPLE__
+  vDSP_biquad_Setup setup_ = nullptr;
+  // 2 * sections + 2 floats of vDSP_biquad() state
+  std::vector<float> delay_;
+#else
+  // Lane s: section s's coefficients, then its two state values and the
+  // output it produced on the last step; unused lanes pass samples through
+  alignas(16) float coefficients_[5][kMaxSections];
+  alignas(16) float z1_[kMaxSections] = {};
+  alignas(16) float z2_[kMaxSections] = {};
+  alignas(16) float last_[kMaxSections] = {};
+#endif
+};
+
+} // namespace margelo::nitro::chorddsp
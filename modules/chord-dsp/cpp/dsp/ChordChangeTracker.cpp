@@ -0,0 +1,100 @@
+#include "ChordChangeTracker.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// isDiatonic() in ChordDetection.tsx: major-type chords on I, IV and V,
+// minor-type ones on ii, iii and vi of the key or its relative major; sus
+// chords are left out
+bool isDiatonic(const ChordCandidate& chord, int key) {
+  int tonic = key % 12;
+  int major = key / 12 == 0 ? tonic : (tonic + 3) % 12;
+  int degree = (chord.root - major + 12) % 12;
+  switch (chord.quality) {
+    case kChordMaj:
+    case kChordDom7:
+    case kChordMaj7:
+      return degree == 0 || degree == 5 || degree == 7;
+    case kChordMin:
+    case kChordMin7:
+      return degree == 2 || degree == 4 || degree == 9;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+ChordChangeTracker::ChordChangeTracker(const Params& params)
+    : params_(params), smoother_(params.minHoldMs, params.minFramesToConfirm, params.hysteresisMargin) {}
+
+void ChordChangeTracker::setHint(int chord, float confidence) {
+  hints_.publish({chord, confidence});
+}
+
+bool ChordChangeTracker::push(const float* chroma, const float* bassChroma, bool isOnset, double nowMs, const KeyEstimator::Estimate* key, float* event) {
+  noiseSinceMs_ = -1.0;
+  hints_.take(hint_);
+  ChordCandidate raw = classifier_.classifyTwoStage(chroma, bassChroma, smoother_.currentRoot());
+
+  // ML agreement boosts the chroma result; a confident ML chord replaces an
+  // uncertain one
+  if (hint_.chord >= 0) {
+    if (hint_.chord == raw.index()) {
+      raw.confidence = std::min(1.0f, raw.confidence * 1.15f);
+    } else if (hint_.confidence > 0.8f && raw.confidence < 0.5f) {
+      raw.root = hint_.chord % 12;
+      raw.quality = hint_.chord / 12;
+      raw.confidence = hint_.confidence;
+    }
+  }
+  if (key && key->key >= 0 && key->margin >= kKeyMinMargin && isDiatonic(raw, key->key)) {
+    raw.confidence = std::min(1.0f, raw.confidence * kKeyPriorBoost);
+  }
+
+  ChordSmoother::Result smoothed = smoother_.process(raw.index(), raw.confidence, isOnset, nowMs);
+  bool changed = smoothed.chord != reportedChord_;
+  if (!changed && (smoothed.chord < 0 || std::fabs(smoothed.confidence - reportedConfidence_) < params_.confidenceBand)) {
+    return false;
+  }
+
+  reportedChord_ = smoothed.chord;
+  reportedConfidence_ = smoothed.confidence;
+  event[0] = static_cast<float>(nowMs / 1000.0);
+  event[1] = smoothed.chord < 0 ? -1.0f : static_cast<float>(smoothed.chord % 12);
+  event[2] = smoothed.chord < 0 ? 0.0f : static_cast<float>(smoothed.chord / 12);
+  event[3] = smoothed.confidence;
+  event[4] = changed ? 1.0f : 0.0f;
+  return true;
+}
+
+bool ChordChangeTracker::pushNoChord(bool silent, double nowMs, float* event) {
+  if (!silent) {
+    if (noiseSinceMs_ < 0.0) noiseSinceMs_ = nowMs;
+    if (nowMs - noiseSinceMs_ < params_.minHoldMs) return false;
+  }
+  bool wasChord = reportedChord_ >= 0;
+  reset();
+  if (!wasChord) return false;
+  event[0] = static_cast<float>(nowMs / 1000.0);
+  event[1] = -1.0f;
+  event[2] = 0.0f;
+  event[3] = 0.0f;
+  event[4] = 1.0f;
+  return true;
+}
+
+void ChordChangeTracker::reset() {
+  smoother_.reset();
+  Hint stale;
+  hints_.take(stale);
+  hint_ = Hint();
+  reportedChord_ = -1;
+  reportedConfidence_ = 0.0f;
+  noiseSinceMs_ = -1.0;
+}
+
+} // namespace margelo::nitro::chorddsp
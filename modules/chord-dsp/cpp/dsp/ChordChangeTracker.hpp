@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ChordClassifier.hpp"
+#include "ChordSmoother.hpp"
+#include "KeyEstimator.hpp"
+#include "SnapshotExchange.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+// The live chord decision of ChordDetection.tsx on the analysis thread:
+// classifyChromaTwoStage() with the smoothed root as previous root, fused
+// with the latest ML hint, a diatonic boost once the running key is clear,
+// then ChordSmoother. push() reports only what the UI has to redraw: a new
+// smoothed chord, or the same chord whose confidence left a band of
+// +-confidenceBand around the one last reported, so the small frame-to-
+// frame wobble of a held chord produces no events at all.
+class ChordChangeTracker {
+public:
+  // Event layout: [seconds, root, quality, confidence, changed], root -1
+  // for N/C and changed 0 for a confidence-only update
+  static constexpr int kEventSize = 5;
+
+  struct Params {
+    double minHoldMs = 100.0;
+    int minFramesToConfirm = 2;
+    float hysteresisMargin = 0.1f;
+    float confidenceBand = 0.1f;
+  };
+
+  // Key prior of ChordDetection.tsx: applied once the key estimate's margin
+  // over the runner-up reaches kKeyMinMargin
+  static constexpr float kKeyMinMargin = 0.05f;
+  static constexpr float kKeyPriorBoost = 1.1f;
+
+  explicit ChordChangeTracker(const Params& params);
+
+  ChordChangeTracker(const ChordChangeTracker&) = delete;
+  ChordChangeTracker& operator=(const ChordChangeTracker&) = delete;
+
+  const Params& params() const { return params_; }
+
+  // ML chord (ChordCandidate::index(), -1 to clear) kept until the next
+  // hint or reset(). Safe from any thread; the analysis thread picks it up
+  // at its next push().
+  void setHint(int chord, float confidence);
+
+  // Feeds one hop or segment, [chroma x12, bassChroma x12] max-normalized,
+  // at stream time `nowMs`; `key` is the running key estimate or nullptr.
+  // Writes kEventSize values and returns true when the UI needs an update.
+  bool push(const float* chroma, const float* bassChroma, bool isOnset, double nowMs, const KeyEstimator::Estimate* key, float* event);
+
+  // A hop with no chord in it. Silence ends the chord at once, noise once it
+  // has lasted minHoldMs (a strum's noisy attack does not); the reported
+  // chord then drops to N/C with one [seconds, -1, 0, 0, 1] event and the
+  // tracker starts over, its hint included. Returns true when it wrote one.
+  bool pushNoChord(bool silent, double nowMs, float* event);
+
+  // Forgets the smoothed chord, the hint and the last report
+  void reset();
+
+private:
+  struct Hint {
+    int chord = -1;
+    float confidence = 0.0f;
+  };
+
+  Params params_;
+  ChordClassifier classifier_;
+  ChordSmoother smoother_;
+  SnapshotExchange<Hint> hints_;
+  Hint hint_;
+  int reportedChord_ = -1;
+  float reportedConfidence_ = 0.0f;
+  // Start of the current run of noisy hops, negative outside one
+  double noiseSinceMs_ = -1.0;
+};
+
+} // namespace margelo::nitro::chorddsp
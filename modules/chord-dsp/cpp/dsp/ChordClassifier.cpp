@@ -0,0 +1,387 @@
+#include "ChordClassifier.hpp"
+#include <algorithm>
+#include <cmath>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// Intervals of each quality above the root
+constexpr int kIntervals[kNumChordQualities][4] = {
+    {0, 4, 7, -1},  // maj
+    {0, 3, 7, -1},  // min
+    {0, 4, 7, 10},  // 7
+    {0, 4, 7, 11},  // maj7
+    {0, 3, 7, 10},  // min7
+    {0, 2, 7, -1},  // sus2
+    {0, 5, 7, -1},  // sus4
+};
+
+// Simplicity bias: extended chords must overcome this with a clear 7th
+constexpr float kComplexityPenalty[kNumChordQualities] = {0.0f, 0.0f, 0.08f, 0.10f, 0.08f, 0.0f, 0.0f};
+// 7th degree above the root for the 7th chords
+constexpr int kSeventh[kNumChordQualities] = {0, 0, 10, 11, 10, 0, 0};
+
+inline float at(const float* chroma, int root, int interval) {
+  return chroma[(root + interval) % 12];
+}
+
+inline bool isMinor(int quality) {
+  return quality == kChordMin || quality == kChordMin7;
+}
+
+inline bool isSus(int quality) {
+  return quality == kChordSus2 || quality == kChordSus4;
+}
+
+// Full penalty for a weak 7th (< 0.2), half for a moderate one, none above 0.4
+float seventhPenalty(const float* chroma, int root, int quality) {
+  float penalty = kComplexityPenalty[quality];
+  if (penalty <= 0.0f) return 0.0f;
+  float energy = at(chroma, root, kSeventh[quality]);
+  if (energy > 0.4f) return 0.0f;
+  return energy > 0.2f ? penalty * 0.5f : penalty;
+}
+
+// Pitch class of the bass peak, or -1 unless it is > 0.3 and > 2x the average
+int dominantBassNote(const float* bassChroma) {
+  float maxVal = 0.0f;
+  int maxIdx = -1;
+  float sum = 0.0f;
+  for (int i = 0; i < 12; i++) {
+    sum += bassChroma[i];
+    if (bassChroma[i] > maxVal) {
+      maxVal = bassChroma[i];
+      maxIdx = i;
+    }
+  }
+  float avg = sum / 12.0f;
+  return maxVal > 0.3f && maxVal > 2.0f * avg ? maxIdx : -1;
+}
+
+// 0-1, conservative: only a single clear bass peak scores high
+float bassReliability(const float* bassChroma) {
+  float max = 0.0f;
+  float secondMax = 0.0f;
+  float sum = 0.0f;
+  int nonZeroCount = 0;
+  for (int i = 0; i < 12; i++) {
+    sum += bassChroma[i];
+    if (bassChroma[i] > 0.1f) nonZeroCount++;
+    if (bassChroma[i] > max) {
+      secondMax = max;
+      max = bassChroma[i];
+    } else if (bassChroma[i] > secondMax) {
+      secondMax = bassChroma[i];
+    }
+  }
+
+  float avg = sum / 12.0f;
+  if (max < 0.4f) return 0.0f;
+  if (nonZeroCount > 6) return 0.1f;
+
+  float peakRatio = max / (avg + 0.01f);
+  float separation = (max - secondMax) / (max + 0.01f);
+  if (separation < 0.3f) return 0.2f;
+  return std::min(1.0f, (peakRatio - 2.0f) * 0.15f + separation * 0.4f);
+}
+
+// Sus chords replace the 3rd: penalize a clear 3rd or a sus note weaker than it
+float susThirdFactor(const float* chroma, int root, int quality) {
+  float minor3rd = at(chroma, root, 3);
+  float major3rd = at(chroma, root, 4);
+  float susNote = at(chroma, root, quality == kChordSus4 ? 5 : 2);
+  float factor = 1.0f;
+  if (minor3rd > 0.3f || major3rd > 0.3f) {
+    factor *= 0.5f;
+  } else if (minor3rd > 0.15f || major3rd > 0.15f) {
+    factor *= 0.7f;
+  }
+  float strongerThird = std::max(minor3rd, major3rd);
+  if (susNote < strongerThird && strongerThird > 0.2f) {
+    factor *= 0.6f;
+  }
+  return factor;
+}
+
+} // namespace
+
+float transitionPlausibility(int previousRoot, int root) {
+  if (previousRoot < 0) return 1.0f;
+  return kTransitionPlausibility[((root - previousRoot) % 12 + 12) % 12];
+}
+
+ChordClassifier::ChordClassifier() {
+  std::fill(templates_, templates_ + 12 * kNumChords, 0.0f);
+  for (int quality = 0; quality < kNumChordQualities; quality++) {
+    int notes = kIntervals[quality][3] < 0 ? 3 : 4;
+    float weight = 1.0f / std::sqrt(static_cast<float>(notes));
+    for (int root = 0; root < 12; root++) {
+      int chord = quality * 12 + root;
+      for (int n = 0; n < notes; n++) {
+        templates_[((root + kIntervals[quality][n]) % 12) * kNumChords + chord] = weight;
+      }
+    }
+  }
+}
+
+void ChordClassifier::score(const float* chroma, float* scores) const {
+  float norm = 0.0f;
+  for (int i = 0; i < 12; i++) norm += chroma[i] * chroma[i];
+  if (norm <= 0.0f) {
+    std::fill(scores, scores + kNumChords, 0.0f);
+    return;
+  }
+
+#ifdef __APPLE__
+  // (1 x 12) * (12 x kNumChords)
+  vDSP_mmul(chroma, 1, templates_, 1, scores, 1, 1, kNumChords, 12);
+#else
+  // One axpy per pitch class over all chords; vectorizes across the 84 columns
+  std::fill(scores, scores + kNumChords, 0.0f);
+  for (int pc = 0; pc < 12; pc++) {
+    float c = chroma[pc];
+    if (c == 0.0f) continue;
+    const float* row = templates_ + pc * kNumChords;
+    for (int k = 0; k < kNumChords; k++) {
+      scores[k] += row[k] * c;
+    }
+  }
+#endif
+
+  float scale = 1.0f / std::sqrt(norm);
+  for (int k = 0; k < kNumChords; k++) scores[k] *= scale;
+}
+
+void ChordClassifier::biasedScore(const float* chroma, float* scores) const {
+  score(chroma, scores);
+  for (int quality = 0; quality < kNumChordQualities; quality++) {
+    for (int root = 0; root < 12; root++) {
+      scores[quality * 12 + root] -= seventhPenalty(chroma, root, quality);
+    }
+  }
+}
+
+ChordCandidate ChordClassifier::classify(const float* chroma) const {
+  alignas(16) float scores[kNumChords];
+  biasedScore(chroma, scores);
+
+  ChordCandidate best;
+  for (int quality = 0; quality < kNumChordQualities; quality++) {
+    for (int root = 0; root < 12; root++) {
+      float similarity = scores[quality * 12 + root];
+      if (similarity > best.confidence) {
+        best = {root, quality, similarity};
+      }
+    }
+  }
+  return best;
+}
+
+ChordCandidate ChordClassifier::classifyWithBass(const float* chroma, const float* bassChroma, int previousRoot) const {
+  alignas(16) float scores[kNumChords];
+  score(chroma, scores);
+
+  int dominantBass = dominantBassNote(bassChroma);
+  float bassMax = *std::max_element(bassChroma, bassChroma + 12);
+  bassMax = std::max(bassMax, 0.0f);
+
+  ChordCandidate best;
+  for (int quality = 0; quality < kNumChordQualities; quality++) {
+    for (int root = 0; root < 12; root++) {
+      float similarity = scores[quality * 12 + root] - seventhPenalty(chroma, root, quality);
+
+      // Bass 3rd: only when the 3rd is near-dominant in the bass and above
+      // the chord's own 5th (G under C is the 5th of C, not the 3rd of E)
+      float bassFifth = at(bassChroma, root, 7);
+      if (isMinor(quality)) {
+        float third = at(bassChroma, root, 3);
+        if (third > 0.5f && third > bassMax * 0.7f && third > bassFifth) similarity *= 1.10f;
+      } else if (!isSus(quality)) {
+        float third = at(bassChroma, root, 4);
+        if (third > 0.5f && third > bassMax * 0.7f && third > bassFifth) similarity *= 1.10f;
+      } else {
+        similarity *= susThirdFactor(chroma, root, quality);
+        if (at(chroma, root, 7) < 0.2f && chroma[root] > 0.5f) similarity *= 0.8f;
+      }
+
+      // Bass anchoring: a clear bass note strongly suggests the root
+      if (dominantBass >= 0) {
+        if (root == dominantBass) {
+          similarity *= 1.25f;
+        } else {
+          float bassStrength = bassChroma[dominantBass];
+          if (bassStrength > 0.7f) {
+            similarity *= 0.85f;
+          } else if (bassStrength > 0.5f) {
+            similarity *= 0.92f;
+          }
+        }
+      }
+
+      similarity *= transitionPlausibility(previousRoot, root);
+
+      if (similarity > best.confidence) {
+        best = {root, quality, similarity};
+      }
+    }
+  }
+  best.confidence = std::min(1.0f, best.confidence);
+  return best;
+}
+
+ChordCandidate ChordClassifier::classifyWithPenalties(const float* chroma, int previousRoot) const {
+  alignas(16) float scores[kNumChords];
+  score(chroma, scores);
+
+  ChordCandidate best;
+  for (int quality = 0; quality < kNumChordQualities; quality++) {
+    for (int root = 0; root < 12; root++) {
+      float similarity = scores[quality * 12 + root] * transitionPlausibility(previousRoot, root);
+      similarity -= seventhPenalty(chroma, root, quality);
+
+      if (isSus(quality)) {
+        similarity *= susThirdFactor(chroma, root, quality);
+        if (at(chroma, root, quality == kChordSus4 ? 5 : 2) < 0.2f) similarity *= 0.7f;
+      }
+      if (quality == kChordMaj || quality == kChordMin) {
+        if (at(chroma, root, quality == kChordMin ? 3 : 4) > 0.3f) similarity *= 1.08f;
+      }
+
+      if (similarity > best.confidence) {
+        best = {root, quality, similarity};
+      }
+    }
+  }
+  best.confidence = std::min(1.0f, best.confidence);
+  return best;
+}
+
+ChordCandidate ChordClassifier::classifyTwoStage(const float* chroma, const float* bassChroma, int previousRoot) const {
+  float reliability = bassReliability(bassChroma);
+  ChordCandidate chromaResult = classifyWithPenalties(chroma, previousRoot);
+  if (reliability < 0.3f) return chromaResult;
+
+  // Stage 1: roots from bass and chroma blended by reliability, plus the 5th
+  // in the bass for inversions
+  float rootScores[12];
+  int roots[12];
+  for (int root = 0; root < 12; root++) {
+    float s = bassChroma[root] * reliability + chroma[root] * (1.0f - reliability * 0.5f);
+    s += at(bassChroma, root, 7) * 0.2f * reliability;
+    rootScores[root] = s * transitionPlausibility(previousRoot, root);
+    roots[root] = root;
+  }
+  // Stable insertion sort, best first: std::stable_sort may allocate
+  for (int i = 1; i < 12; i++) {
+    int root = roots[i];
+    int j = i;
+    for (; j > 0 && rootScores[roots[j - 1]] < rootScores[root]; j--) roots[j] = roots[j - 1];
+    roots[j] = root;
+  }
+  int numCandidates = reliability > 0.6f ? 3 : 5;
+
+  // Stage 2: best quality for each candidate root
+  alignas(16) float scores[kNumChords];
+  score(chroma, scores);
+
+  ChordCandidate best;
+  for (int c = 0; c < numCandidates; c++) {
+    int root = roots[c];
+    for (int quality = 0; quality < kNumChordQualities; quality++) {
+      float similarity = scores[quality * 12 + root] - seventhPenalty(chroma, root, quality);
+
+      if (isSus(quality)) {
+        similarity *= susThirdFactor(chroma, root, quality);
+        if (at(chroma, root, quality == kChordSus4 ? 5 : 2) < 0.2f) similarity *= 0.7f;
+      } else if (at(chroma, root, isMinor(quality) ? 3 : 4) > 0.3f) {
+        similarity *= 1.08f;
+      }
+
+      if (reliability > 0.5f && bassChroma[root] > 0.5f) {
+        similarity *= 1.0f + reliability * 0.1f;
+      }
+
+      if (similarity > best.confidence) {
+        best = {root, quality, similarity};
+      }
+    }
+  }
+
+  // Prefer the two-stage result unless chroma alone is clearly better
+  if (chromaResult.confidence > best.confidence + 0.05f * reliability) {
+    return chromaResult;
+  }
+  best.confidence = std::min(1.0f, best.confidence);
+  return best;
+}
+
+int ChordClassifier::topN(const float* chroma, int n, ChordCandidate* out) const {
+  alignas(16) float scores[kNumChords];
+  biasedScore(chroma, scores);
+
+  ChordCandidate all[kNumChords];
+  for (int quality = 0; quality < kNumChordQualities; quality++) {
+    for (int root = 0; root < 12; root++) {
+      int chord = quality * 12 + root;
+      all[chord] = {root, quality, scores[chord]};
+    }
+  }
+
+  // Ties keep template order, like the stable sort in JS
+  int count = std::clamp(n, 0, kNumChords);
+  std::partial_sort(all, all + count, all + kNumChords, [](const ChordCandidate& a, const ChordCandidate& b) {
+    return a.confidence > b.confidence || (a.confidence == b.confidence && a.index() < b.index());
+  });
+  std::copy(all, all + count, out);
+  return count;
+}
+
+void ChordClassifier::poolActivations(const float* notes, int frames, float* pooled) {
+  std::fill(pooled, pooled + kNumPianoKeys, 0.0f);
+  if (frames <= 0) return;
+
+  // Weights (f + 1) / frames sum to (frames + 1) / 2
+  float totalWeight = 0.5f * static_cast<float>(frames + 1);
+  for (int f = 0; f < frames; f++) {
+    float weight = static_cast<float>(f + 1) / static_cast<float>(frames);
+    const float* frame = notes + static_cast<size_t>(f) * kNumPianoKeys;
+#ifdef __APPLE__
+    vDSP_vsma(frame, 1, &weight, pooled, 1, pooled, 1, kNumPianoKeys);
+#else
+    // Vectorizes across the 88 keys
+    for (int i = 0; i < kNumPianoKeys; i++) pooled[i] += frame[i] * weight;
+#endif
+  }
+#ifdef __APPLE__
+  vDSP_vsdiv(pooled, 1, &totalWeight, pooled, 1, kNumPianoKeys);
+#else
+  for (int i = 0; i < kNumPianoKeys; i++) pooled[i] /= totalWeight;
+#endif
+}
+
+void ChordClassifier::foldActivations(const float* activations, float threshold, float* chroma) {
+  std::fill(chroma, chroma + 12, 0.0f);
+  for (int i = 0; i < kNumPianoKeys; i++) {
+    if (activations[i] < threshold) continue;
+    chroma[(i + kLowestPianoMidi) % 12] += activations[i];
+  }
+  float maxVal = *std::max_element(chroma, chroma + 12);
+  if (maxVal > 0.0f) {
+    for (int i = 0; i < 12; i++) chroma[i] /= maxVal;
+  }
+}
+
+ChordCandidate ChordClassifier::classifyActivations(const float* notes, int frames, float threshold) const {
+  alignas(16) float pooled[kNumPianoKeys];
+  float chroma[12];
+  poolActivations(notes, frames, pooled);
+  foldActivations(pooled, threshold, chroma);
+  return classify(chroma);
+}
+
+} // namespace margelo::nitro::chorddsp
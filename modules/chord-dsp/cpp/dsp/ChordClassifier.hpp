@@ -0,0 +1,87 @@
+#pragma once
+
+namespace margelo::nitro::chorddsp {
+
+// Chord qualities in template order (root = C)
+enum ChordQuality {
+  kChordMaj,  // 0 4 7
+  kChordMin,  // 0 3 7
+  kChordDom7, // 0 4 7 10
+  kChordMaj7, // 0 4 7 11
+  kChordMin7, // 0 3 7 10
+  kChordSus2, // 0 2 7
+  kChordSus4, // 0 5 7
+  kNumChordQualities,
+};
+
+// Chords are indexed quality * 12 + root
+constexpr int kNumChords = kNumChordQualities * 12;
+
+// BasicPitch note activations: one value per piano key, MIDI 21 (A0) up
+constexpr int kNumPianoKeys = 88;
+constexpr int kLowestPianoMidi = 21;
+
+// Plausibility of a root movement, indexed by ascending interval
+constexpr float kTransitionPlausibility[12] = {1.0f, 0.70f, 0.80f, 0.90f, 0.80f, 0.95f, 0.60f, 0.95f, 0.80f, 0.85f, 0.80f, 0.65f};
+
+// getTransitionPlausibility(): 1 when previousRoot is -1
+float transitionPlausibility(int previousRoot, int root);
+
+struct ChordCandidate {
+  int root = 0; // pitch class, 0 = C
+  int quality = kChordMaj;
+  float confidence = -1.0f;
+
+  int index() const { return quality * 12 + root; }
+};
+
+// Native port of src/utils/chordClassification.ts. All 84 rotated binary
+// templates are normalized once and stored as a 12 x 84 column-per-pitch-
+// class matrix, so the cosine similarity against every chord is a single
+// matrix-vector product; the JS heuristics (7th simplicity bias, bass
+// anchoring, sus validation, transition priors) are then applied per chord
+// in the same order, so ties resolve the same way.
+//
+// `chroma` and `bassChroma` are 12 values, max-normalized like
+// HybridChordDSP produces them. `previousRoot` is a pitch class or -1.
+class ChordClassifier {
+public:
+  ChordClassifier();
+
+  // scores[quality * 12 + root] = cosine similarity of chroma and the template
+  void score(const float* chroma, float* scores) const;
+  // score() minus the 7th simplicity bias: classify()'s similarities, and
+  // ChordDecoder's emissions
+  void biasedScore(const float* chroma, float* scores) const;
+
+  // classifyChroma(): template match with the 7th simplicity bias
+  ChordCandidate classify(const float* chroma) const;
+  // classifyChromaWithBass(): adds bass 3rd checks, bass root anchoring and
+  // transition priors
+  ChordCandidate classifyWithBass(const float* chroma, const float* bassChroma, int previousRoot) const;
+  // classifyChromaTwoStage(): root candidates from bass when it is reliable,
+  // then the best quality per candidate, compared with a chroma-only result
+  ChordCandidate classifyTwoStage(const float* chroma, const float* bassChroma, int previousRoot) const;
+  // classifyChromaTopN(): the n best chords by biased similarity, best
+  // first. Returns the number written (min(n, kNumChords)).
+  int topN(const float* chroma, int n, ChordCandidate* out) const;
+
+  // Recency-weighted mean of `frames` activation frames (kNumPianoKeys
+  // each, oldest first), frame f weighted (f + 1) / frames so the latest
+  // counts most
+  static void poolActivations(const float* notes, int frames, float* pooled);
+  // buildChromaFromActivations(): keys at or above threshold summed per
+  // pitch class, then max-normalized
+  static void foldActivations(const float* activations, float threshold, float* chroma);
+  // classifyFrame() on the pooled frames
+  ChordCandidate classifyActivations(const float* notes, int frames, float threshold) const;
+
+private:
+  // classifyChromaWithPenalties(): chroma-only path of classifyTwoStage()
+  ChordCandidate classifyWithPenalties(const float* chroma, int previousRoot) const;
+
+  // templates_[pc * kNumChords + chord], each chord's column of unit norm
+  alignas(16) float templates_[12 * kNumChords];
+};
+
+} // namespace margelo::nitro::chorddsp
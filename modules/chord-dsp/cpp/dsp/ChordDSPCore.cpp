@@ -0,0 +1,581 @@
+#include "ChordDSPCore.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// aubio headers (aubio.h has its own extern "C" guards)
+#include "aubio/aubio.h"
+
+namespace margelo::nitro::chorddsp {
+
+ChordDSPCore::ChordDSPCore() {
+  scratch_.reserve(kScratchFloats);
+  // Points at the precomputed DSPTables filterbank, no math at startup
+  initMelFilterbank();
+}
+
+void ChordDSPCore::initMelFilterbank() {
+  if (melFilterbank_) return;
+  melFilterbank_ = std::make_unique<MelFilterbank>(kMelBins, kFFTSize, kTargetSampleRate, kMinFreq, kMaxFreq);
+}
+
+PolyphaseResampler& ChordDSPCore::resampler(double sourceSampleRate) {
+  int rate = static_cast<int>(std::lround(sourceSampleRate));
+  if (!resampler_ || resampler_->sourceRate() != rate) {
+    resampler_ = std::make_unique<PolyphaseResampler>(rate, kTargetSampleRate);
+  }
+  return *resampler_;
+}
+
+size_t ChordDSPCore::resampledLength(size_t count, double sourceSampleRate) {
+  return resampler(sourceSampleRate).outputLength(count);
+}
+
+const std::vector<float>& ChordDSPCore::resampleToTarget(const float* samples, size_t count, double sourceSampleRate) {
+  PerfStats::Timer timer(perf_, PerfStats::kStageResample);
+  PolyphaseResampler& rs = resampler(sourceSampleRate);
+
+  rs.reset();
+  resampled_.clear();
+  size_t capacity = resampled_.capacity();
+  resampled_.reserve(rs.outputLength(count));
+  rs.process(samples, count, resampled_);
+  rs.flush(resampled_);
+  if (resampled_.capacity() != capacity) resampleGrowths_++;
+  return resampled_;
+}
+
+int ChordDSPCore::melFrameCount(size_t numSamples) {
+  if (numSamples < static_cast<size_t>(kFFTSize)) return 0;
+  return static_cast<int>((numSamples - kFFTSize) / kHopSize + 1);
+}
+
+void ChordDSPCore::computeMelBatch(const float* audio, int frames, SpectrumPlan& plan, float* windowed, float* power, PerfStats& perf, MelScale scale, float* out) const {
+  // Power scale matches the original vDSP path: |2X|^2 / (2N) = 2|X|^2 / N
+  const float powerScale = 2.0f / kFFTSize;
+  const int fftBins = kFFTSize / 2 + 1;
+  for (int f = 0; f < frames; f++) {
+    PerfStats::Timer timer(perf, PerfStats::kStageFFT);
+    const float* frame = audio + static_cast<size_t>(f) * kHopSize;
+    for (int i = 0; i < kFFTSize; i++) {
+      windowed[i] = frame[i] * plan.window[i];
+    }
+    plan.fft.powerSpectrum(windowed, power + static_cast<size_t>(f) * fftBins, powerScale);
+  }
+
+  PerfStats::Timer timer(perf, PerfStats::kStageMel, static_cast<uint32_t>(frames));
+  melFilterbank_->applyBatch(power, frames, out);
+  applyMelScale(out, static_cast<size_t>(frames) * kMelBins, 1e-10f, scale);
+}
+
+int ChordDSPCore::computeMelFrames(const float* audio, size_t count, float* result, MelScale scale) {
+  initMelFilterbank();
+
+  int numFrames = melFrameCount(count);
+  if (numFrames == 0) return 0;
+
+  if (melPool_ && numFrames >= kParallelMelMinFrames) {
+    computeMelFramesParallel(audio, numFrames, scale, result);
+    return numFrames;
+  }
+
+  int fftBins = kFFTSize / 2 + 1;
+  SpectrumPlan& plan = plans_.get(kFFTSize, WindowType::Hann);
+
+  ScratchArena::Scope scratch(scratch_);
+  float* windowed = scratch.take(kFFTSize);
+  float* power = scratch.take(static_cast<size_t>(kMelBatchFrames) * fftBins);
+
+  for (int frame = 0; frame < numFrames; frame += kMelBatchFrames) {
+    int frames = std::min(kMelBatchFrames, numFrames - frame);
+    computeMelBatch(audio + static_cast<size_t>(frame) * kHopSize, frames, plan, windowed, power, perf_, scale, result + static_cast<size_t>(frame) * kMelBins);
+  }
+
+  perf_.addFrames(numFrames);
+  return numFrames;
+}
+
+void ChordDSPCore::computeMelFramesParallel(const float* audio, int numFrames, MelScale scale, float* result) {
+  // A few tasks per participant so a thread that gets descheduled (or lands
+  // on a little core) does not hold up the rest
+  int participants = melPool_->size();
+  int framesPerTask = std::max(kMelBatchFrames, (numFrames + participants * 4 - 1) / (participants * 4));
+  int numTasks = (numFrames + framesPerTask - 1) / framesPerTask;
+
+  // Every frame writes its own kMelBins slice of `result`, so no locking
+  auto task = [&](int index, int participant) {
+    MelWorker& worker = *melWorkers_[participant];
+    int begin = index * framesPerTask;
+    int end = std::min(numFrames, begin + framesPerTask);
+    for (int frame = begin; frame < end; frame += kMelBatchFrames) {
+      int frames = std::min(kMelBatchFrames, end - frame);
+      computeMelBatch(audio + static_cast<size_t>(frame) * kHopSize, frames, worker.plan, worker.windowed.data(), worker.power.data(), worker.perf, scale,
+                      result + static_cast<size_t>(frame) * kMelBins);
+    }
+  };
+
+  uint64_t start = PerfStats::now();
+  melPool_->run(numTasks, task);
+  perf_.exclude(PerfStats::now() - start);
+
+  for (const std::unique_ptr<MelWorker>& worker : melWorkers_) {
+    perf_.merge(worker->perf);
+    worker->perf.reset();
+  }
+  perf_.addFrames(numFrames);
+}
+
+ChordDSPCore::MelWorker::MelWorker()
+    : plan(kFFTSize, WindowType::Hann), windowed(kFFTSize), power(static_cast<size_t>(kMelBatchFrames) * (kFFTSize / 2 + 1)) {}
+
+void ChordDSPCore::setMelThreads(int threads) {
+  if (threads <= 0) {
+    threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  threads = std::clamp(threads, 1, kMaxMelThreads);
+  if (threads == melThreads()) return;
+
+  melPool_.reset();
+  melWorkers_.clear();
+  if (threads == 1) return;
+
+  initMelFilterbank();
+  melWorkers_.reserve(threads);
+  for (int i = 0; i < threads; i++) melWorkers_.push_back(std::make_unique<MelWorker>());
+  melPool_ = std::make_unique<WorkerPool>(threads);
+}
+
+template <typename Visit>
+int ChordDSPCore::forEachPowerFrame(const float* samples, size_t count, Visit&& visit) {
+  int numFrames = chromaFrameCount(count);
+  if (numFrames == 0) return 0;
+
+  SpectrumPlan& plan = plans_.get(kFFTSize, WindowType::Hann);
+  const std::vector<float>& window = plan.window;
+
+  int fftBins = kFFTSize / 2 + 1;
+  const float powerScale = 2.0f / kFFTSize;
+  ScratchArena::Scope scratch(scratch_);
+  float* magnitudes = scratch.take(fftBins);
+  float* windowed = scratch.take(kFFTSize);
+
+  // Offline passes separate with their own history, so a recording never
+  // sees the live stream's past frames
+  HarmonicPercussive* hpss = batchHarmonic_.get();
+  float* mask = hpss ? scratch.take(fftBins) : nullptr;
+  if (hpss) hpss->reset();
+
+  for (int frame = 0; frame < numFrames; frame++) {
+    int offset = frame * kHopSize;
+
+    {
+      PerfStats::Timer timer(perf_, PerfStats::kStageFFT);
+      for (int i = 0; i < kFFTSize; i++) {
+        windowed[i] = samples[offset + i] * window[i];
+      }
+      plan.fft.powerSpectrum(windowed, magnitudes, powerScale);
+    }
+
+    PerfStats::Timer timer(perf_, PerfStats::kStageChroma);
+    if (hpss) {
+      hpss->process(magnitudes, mask);
+      for (int k = 0; k < fftBins; k++) magnitudes[k] *= mask[k] * mask[k];
+    }
+    visit(frame, magnitudes);
+  }
+
+  perf_.addFrames(numFrames);
+  return numFrames;
+}
+
+int ChordDSPCore::chromaFrameCount(size_t numSamples) {
+  if (numSamples < static_cast<size_t>(kFFTSize)) return 0;
+  return static_cast<int>((numSamples - kFFTSize) / kHopSize + 1);
+}
+
+void ChordDSPCore::computeChromagram(const float* samples, size_t count, double sampleRate, float minFreq, float maxFreq, float* chroma, Normalization norm) {
+  std::fill(chroma, chroma + 12, 0.0f);
+  if (count < static_cast<size_t>(kFFTSize)) return;
+
+  // The aggregate is the sum of the raw per-frame chroma, normalized once
+  const ChromaMap& map = chromaMap(static_cast<int>(sampleRate), minFreq, maxFreq);
+  forEachPowerFrame(samples, count, [&](int, const float* power) { map.accumulate(power, chroma); });
+  normalize(chroma, 12, norm);
+}
+
+int ChordDSPCore::computeChromaFrames(const float* samples, size_t count, double sampleRate, float* output, Normalization norm) {
+  if (count < static_cast<size_t>(kFFTSize)) return 0;
+
+  int sr = static_cast<int>(sampleRate);
+  const ChromaMap& chromaRange = chromaMap(sr, kChromaMinFreq, kChromaMaxFreq);
+  const ChromaMap& bassRange = chromaMap(sr, kBassMinFreq, kBassMaxFreq);
+  return forEachPowerFrame(samples, count, [&](int frame, const float* power) {
+    float* row = output + static_cast<size_t>(frame) * kChromaFrameSize;
+    std::fill(row, row + kChromaFrameSize, 0.0f);
+    chromaRange.accumulate(power, row);
+    bassRange.accumulate(power, row + 12);
+    normalize(row, 12, norm);
+    normalize(row + 12, 12, norm);
+  });
+}
+
+const ChromaMap& ChordDSPCore::chromaMap(int sampleRate, float minFreq, float maxFreq, int fftSize) {
+  auto key = std::make_tuple(fftSize, sampleRate, minFreq, maxFreq, chromaAssignment_);
+  auto it = chromaMaps_.find(key);
+  if (it != chromaMaps_.end()) {
+    return *it->second;
+  }
+  auto map = std::make_unique<ChromaMap>(fftSize, sampleRate, minFreq, maxFreq, chromaAssignment_);
+  const ChromaMap& ref = *map;
+  chromaMaps_.emplace(key, std::move(map));
+  return ref;
+}
+
+void ChordDSPCore::setChromaAssignment(ChromaAssignment assignment) {
+  chromaAssignment_ = assignment;
+}
+
+void ChordDSPCore::setHarmonicPercussive(bool enabled) {
+  if (!enabled) {
+    harmonic_.reset();
+    batchHarmonic_.reset();
+    return;
+  }
+  if (harmonic_) {
+    harmonic_->reset();
+    return;
+  }
+  int fftBins = kFFTSize / 2 + 1;
+  harmonic_ = std::make_unique<HarmonicPercussive>(fftBins);
+  batchHarmonic_ = std::make_unique<HarmonicPercussive>(fftBins);
+}
+
+void ChordDSPCore::setSpectralWhitening(bool enabled) {
+  whiten_ = enabled;
+  if (!enabled) {
+    whitening_.reset();
+  } else if (whitening_) {
+    whitening_->reset();
+  }
+}
+
+void ChordDSPCore::setTuningEstimation(bool enabled) {
+  if (!enabled) {
+    tuning_.reset();
+  } else if (tuning_) {
+    tuning_->reset();
+  } else {
+    tuning_ = std::make_unique<TuningEstimator>(kChromaMaxFreq);
+  }
+}
+
+float ChordDSPCore::tuningOffset() const {
+  return tuning_ ? tuning_->offset() * 100.0f : 0.0f;
+}
+
+void ChordDSPCore::setSpectralFeatures(bool enabled) {
+  if (!enabled) {
+    features_.reset();
+  } else if (features_) {
+    features_->reset();
+  } else {
+    features_ = std::make_unique<SpectralFeatures>(kFFTSize / 2 + 1);
+  }
+  std::fill(frameFeatures_, frameFeatures_ + SpectralFeatures::kNumFeatures, 0.0f);
+}
+
+SpectralWhitening& ChordDSPCore::whitening(int sampleRate) {
+  // The decay per frame follows the hop analyzeFrame() is called at
+  int hop = onset_ ? static_cast<int>(onset_->config().hopSize) : kHopSize;
+  if (!whitening_ || whitening_->sampleRate() != sampleRate || whitening_->hopSize() != hop) {
+    whitening_ = std::make_unique<SpectralWhitening>(kFFTSize, hop, sampleRate);
+  }
+  return *whitening_;
+}
+
+void ChordDSPCore::analyzeFrame(const float* samples, size_t count, double sampleRate, float* result, Normalization norm, bool foldChroma) {
+  std::fill(result, result + kAnalyzeFrameSize, 0.0f);
+  if (count < static_cast<size_t>(kFFTSize)) return;
+
+  SpectrumPlan& plan = plans_.get(kFFTSize, WindowType::Hann);
+  int fftBins = kFFTSize / 2 + 1;
+  size_t offset = count - kFFTSize;
+
+  ScratchArena::Scope scratch(scratch_);
+  float* windowed = scratch.take(kFFTSize);
+  float* re = scratch.take(fftBins);
+  float* im = scratch.take(fftBins);
+  float* power = scratch.take(fftBins);
+  // Harmonic share per bin, when separating
+  float* mask = harmonic_ ? scratch.take(fftBins) : nullptr;
+  // Unscaled magnitudes (whitened when whitening), shared by chroma, onset
+  // and the spectral features
+  float* magnitude = whiten_ || features_ ? scratch.take(fftBins) : nullptr;
+
+  perf_.addFrames(1);
+  {
+    PerfStats::Timer timer(perf_, PerfStats::kStageFFT);
+    for (int i = 0; i < kFFTSize; i++) {
+      windowed[i] = samples[offset + i] * plan.window[i];
+    }
+
+    plan.fft.forward(windowed, re, im);
+
+    const float powerScale = 2.0f / kFFTSize;
+    if (magnitude) {
+      for (int k = 0; k < fftBins; k++) {
+        magnitude[k] = std::sqrt(re[k] * re[k] + im[k] * im[k]);
+      }
+      if (whiten_) whitening(static_cast<int>(sampleRate)).process(magnitude);
+      if (features_) features_->compute(magnitude, frameFeatures_);
+      for (int k = 0; k < fftBins; k++) {
+        power[k] = powerScale * magnitude[k] * magnitude[k];
+      }
+    } else {
+      for (int k = 0; k < fftBins; k++) {
+        power[k] = powerScale * (re[k] * re[k] + im[k] * im[k]);
+      }
+    }
+  }
+
+  {
+    PerfStats::Timer timer(perf_, PerfStats::kStageChroma);
+    // The separation and tuning histories need every frame, folded or not
+    if (mask) harmonic_->process(power, mask);
+    if (tuning_) tuning_->update(power, fftBins, sampleRate / kFFTSize);
+    if (foldChroma) {
+      if (mask) {
+        // Chroma folds only the harmonic part, mask * X
+        for (int k = 0; k < fftBins; k++) power[k] *= mask[k] * mask[k];
+      }
+      int sr = static_cast<int>(sampleRate);
+      float* chroma = result;
+      float* bassChroma = result + 12;
+      const ChromaMap& chromaRange = chromaMap(sr, kChromaMinFreq, kChromaMaxFreq);
+      const ChromaMap& bassRange = chromaMap(sr, kBassMinFreq, kBassMaxFreq);
+      if (tuning_) {
+        int shift = static_cast<int>(std::lround(tuning_->offset() * ChromaMap::kTuningSteps));
+        chromaRange.accumulateTuned(power, shift, chroma);
+        bassRange.accumulateTuned(power, shift, bassChroma);
+      } else {
+        chromaRange.accumulate(power, chroma);
+        bassRange.accumulate(power, bassChroma);
+      }
+      normalize(chroma, 12, norm);
+      normalize(bassChroma, 12, norm);
+    }
+  }
+
+  if (!onset_) return;
+
+  PerfStats::Timer timer(perf_, PerfStats::kStageOnset);
+  takeOnsetParams();
+
+  size_t hop = std::min<size_t>(count, onset_->config().hopSize);
+  onset_->fillInput(samples + count - hop, hop);
+
+  if (onset_->config().bufferSize == static_cast<uint_t>(kFFTSize)) {
+    // aubio expects unscaled magnitudes; phase only if a descriptor reads it.
+    // When separating, the detector sees the percussive part, (1 - mask) * X.
+    cvec_t* grain = onset_->grain();
+    if (magnitude) {
+      std::copy(magnitude, magnitude + fftBins, grain->norm);
+    } else {
+      for (int k = 0; k < fftBins; k++) {
+        grain->norm[k] = std::sqrt(re[k] * re[k] + im[k] * im[k]);
+      }
+    }
+    if (mask) {
+      for (int k = 0; k < fftBins; k++) grain->norm[k] *= 1.0f - mask[k];
+    }
+    if (aubio_onset_uses_phase(onset_->onset())) {
+      for (int k = 0; k < fftBins; k++) {
+        grain->phas[k] = std::atan2(im[k], re[k]);
+      }
+    }
+    if (whiten_) {
+      aubio_onset_do_whitened_spectrum(onset_->onset(), onset_->input(), grain, onset_->output());
+    } else {
+      aubio_onset_do_spectrum(onset_->onset(), onset_->input(), grain, onset_->output());
+    }
+  } else {
+    // Detector window differs from kFFTSize, let it run its own phase vocoder
+    aubio_onset_do(onset_->onset(), onset_->input(), onset_->output());
+  }
+
+  result[24] = onset_->isOnset() ? 1.0f : 0.0f;
+  result[25] = aubio_onset_get_descriptor(onset_->onset());
+}
+
+ConstantQ& ChordDSPCore::constantQ(int sampleRate, int numBins) {
+  if (numBins != 36 && numBins != 84) {
+    throw std::invalid_argument("constantQ: numBins must be 36 or 84, got " + std::to_string(numBins));
+  }
+  auto key = std::make_pair(sampleRate, numBins);
+  auto it = constantQs_.find(key);
+  if (it != constantQs_.end()) {
+    return *it->second;
+  }
+  auto cq = std::make_unique<ConstantQ>(sampleRate, kConstantQMinFreq, kConstantQBinsPerOctave, numBins);
+  ConstantQ& ref = *cq;
+  constantQs_.emplace(key, std::move(cq));
+  return ref;
+}
+
+void ChordDSPCore::computeConstantQ(ConstantQ& cq, const float* samples, size_t count, float* output, Normalization norm) {
+  PerfStats::Timer timer(perf_, PerfStats::kStageConstantQ);
+  perf_.addFrames(1);
+  int bins = cq.numBins();
+  constantQBins_.resize(bins);
+  cq.compute(samples, count, constantQBins_.data());
+
+  // Bin 0 is C, so folding is bin % 12; energy like the FFT chroma path
+  float chroma[12] = {};
+  for (int b = 0; b < bins; b++) {
+    output[b] = constantQBins_[b];
+    chroma[b % 12] += constantQBins_[b] * constantQBins_[b];
+  }
+  normalize(chroma, 12, norm);
+  std::copy(chroma, chroma + 12, output + bins);
+}
+
+uint64_t ChordDSPCore::scratchAllocations() const {
+  return scratch_.allocations() + resampleGrowths_;
+}
+
+void ChordDSPCore::analyzeBass(const float* samples, size_t count, double sampleRate, float* bassChroma, Normalization norm) {
+  std::fill(bassChroma, bassChroma + 12, 0.0f);
+  if (count < static_cast<size_t>(kBassFFTSize)) return;
+
+  SpectrumPlan& plan = plans_.get(kBassFFTSize, WindowType::Hann);
+  int fftBins = kBassFFTSize / 2 + 1;
+  const float* audio = samples + count - kBassFFTSize;
+
+  ScratchArena::Scope scratch(scratch_);
+  float* windowed = scratch.take(kBassFFTSize);
+  float* re = scratch.take(fftBins);
+  float* im = scratch.take(fftBins);
+  float* power = scratch.take(fftBins);
+
+  {
+    PerfStats::Timer timer(perf_, PerfStats::kStageFFT);
+    for (int i = 0; i < kBassFFTSize; i++) {
+      windowed[i] = audio[i] * plan.window[i];
+    }
+    plan.fft.forward(windowed, re, im);
+    const float powerScale = 2.0f / kBassFFTSize;
+    for (int k = 0; k < fftBins; k++) {
+      power[k] = powerScale * (re[k] * re[k] + im[k] * im[k]);
+    }
+  }
+
+  PerfStats::Timer timer(perf_, PerfStats::kStageChroma);
+  const ChromaMap& bassRange = chromaMap(static_cast<int>(sampleRate), kBassMinFreq, kBassMaxFreq, kBassFFTSize);
+  if (tuning_) {
+    bassRange.accumulateTuned(power, static_cast<int>(std::lround(tuning_->offset() * ChromaMap::kTuningSteps)), bassChroma);
+  } else {
+    bassRange.accumulate(power, bassChroma);
+  }
+  normalize(bassChroma, 12, norm);
+}
+
+void ChordDSPCore::warmup() {
+  plans_.get(kFFTSize, WindowType::Hann);
+  initMelFilterbank();
+}
+
+// --- aubio onset detection ---
+
+OnsetConfig ChordDSPCore::onsetConfig(double sampleRate, double bufferSize, double hopSize) const {
+  OnsetConfig config;
+  config.sampleRate = static_cast<uint_t>(sampleRate);
+  config.bufferSize = static_cast<uint_t>(bufferSize);
+  config.hopSize = static_cast<uint_t>(hopSize);
+  config.methods = onsetMethods_;
+  config.weights = onsetWeights_;
+  return config;
+}
+
+void ChordDSPCore::initOnsetDetector(double sampleRate, double bufferSize, double hopSize) {
+  // Hand the previous detector back first so an identical config reuses it
+  onset_.reset();
+  onset_ = OnsetDetectorPool::shared().acquire(onsetConfig(sampleRate, bufferSize, hopSize));
+  onsetParamsExchange_.take(appliedOnsetParams_);
+  onset_->setParams(appliedOnsetParams_);
+}
+
+void ChordDSPCore::setOnsetParams(const OnsetParams& params) {
+  validateOnsetParams(params, "setOnsetParameters");
+  publishedOnsetParams_ = params;
+  onsetParamsExchange_.publish(params);
+}
+
+void ChordDSPCore::takeOnsetParams() {
+  if (onsetParamsExchange_.take(appliedOnsetParams_) && onset_) {
+    onset_->setParams(appliedOnsetParams_);
+  }
+}
+
+void ChordDSPCore::resetOnsetDetector() {
+  if (onset_) {
+    onset_->reset();
+  }
+  if (harmonic_) {
+    harmonic_->reset();
+  }
+  if (whitening_) {
+    whitening_->reset();
+  }
+  if (tuning_) {
+    tuning_->reset();
+  }
+  if (features_) {
+    features_->reset();
+  }
+}
+
+void ChordDSPCore::detectOnset(const float* samples, size_t count, float* result) {
+  if (!onset_) {
+    std::fill(result, result + onsetResultSize(), 0.0f);
+    return;
+  }
+  PerfStats::Timer timer(perf_, PerfStats::kStageOnset);
+  perf_.addFrames(1);
+  takeOnsetParams();
+  onset_->process(samples, count);
+  onset_->writeResult(result);
+}
+
+void ChordDSPCore::setOnsetDescriptors(const std::vector<std::string>& methods, const std::vector<double>& weights) {
+  validateOnsetDescriptors(methods, weights, "setOnsetDescriptors");
+  onsetMethods_ = methods;
+  onsetWeights_ = weights;
+  if (onset_) {
+    const OnsetConfig& current = onset_->config();
+    initOnsetDetector(current.sampleRate, current.bufferSize, current.hopSize);
+  }
+}
+
+void ChordDSPCore::detectOnsetsBatch(const float* samples, size_t count, double sampleRate, std::vector<float>& times, std::vector<float>& curve) {
+  OnsetDetectorPool::Handle onset = OnsetDetectorPool::shared().acquire(onsetConfig(sampleRate, kBatchOnsetBufferSize, kBatchOnsetHopSize));
+  takeOnsetParams();
+  onset->setParams(appliedOnsetParams_);
+
+  size_t numHops = (count + kBatchOnsetHopSize - 1) / kBatchOnsetHopSize;
+  curve.resize(numHops);
+  times.clear();
+  perf_.addFrames(numHops);
+  for (size_t h = 0; h < numHops; h++) {
+    size_t start = h * kBatchOnsetHopSize;
+    PerfStats::Timer timer(perf_, PerfStats::kStageOnset);
+    onset->process(samples + start, count - start);
+    curve[h] = aubio_onset_get_descriptor(onset->onset());
+    if (onset->isOnset()) {
+      times.push_back(aubio_onset_get_last_s(onset->onset()));
+    }
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
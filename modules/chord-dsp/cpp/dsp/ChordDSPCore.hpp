@@ -0,0 +1,313 @@
+#pragma once
+
+#include "ChromaMap.hpp"
+#include "ConstantQ.hpp"
+#include "FFTPlanCache.hpp"
+#include "HarmonicPercussive.hpp"
+#include "MelFilterbank.hpp"
+#include "OnsetDetectorPool.hpp"
+#include "PerfStats.hpp"
+#include "PolyphaseResampler.hpp"
+#include "ScratchArena.hpp"
+#include "SnapshotExchange.hpp"
+#include "SpectralFeatures.hpp"
+#include "SpectralWhitening.hpp"
+#include "TuningEstimator.hpp"
+#include "VectorOps.hpp"
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Everything HybridChordDSP computes, without Nitro: resampling, log-mel,
+// FFT and constant-Q chroma, the single-FFT frame analysis and the aubio
+// onset detector, with the plans, tables and scratch they reuse. Samples,
+// spectra and results are float32 end to end, so Float32 ArrayBuffers pass
+// straight through; only the number[] API converts, once per call, at the
+// hybrid boundary. The core can be built and benchmarked on its own.
+class ChordDSPCore {
+public:
+  ChordDSPCore();
+
+  // analyzeFrame() window length and layout: [chroma x12, bass chroma x12, isOnset, fused onset descriptor]
+  static constexpr int kFFTSize = 2048;
+  static constexpr int kAnalyzeFrameSize = 26;
+  // analyzeBass() window: 4x the frequency resolution of kFFTSize for the
+  // bass range, where semitones are only a few Hz apart
+  static constexpr int kBassFFTSize = 8192;
+
+  // Mel spectrogram parameters (BasicPitch input): kFFTSize frames every
+  // kHopSize samples at kTargetSampleRate
+  static constexpr int kTargetSampleRate = 22050;
+  static constexpr int kHopSize = 512;
+  static constexpr int kMelBins = 229;
+  static constexpr float kMinFreq = 30.0f;
+  static constexpr float kMaxFreq = 11025.0f;
+
+  // Chroma frequency ranges
+  static constexpr float kChromaMinFreq = 60.0f;
+  static constexpr float kChromaMaxFreq = 2000.0f;
+  // Bass range covers fundamentals of bass guitar and low piano (E1=41Hz to B3=247Hz)
+  static constexpr float kBassMinFreq = 40.0f;
+  static constexpr float kBassMaxFreq = 250.0f;
+
+  // detectOnsetsBatch() detector window and hop
+  static constexpr int kBatchOnsetBufferSize = kFFTSize;
+  static constexpr int kBatchOnsetHopSize = 1024;
+
+  // Resamples a whole buffer to kTargetSampleRate into a buffer reused
+  // across calls (the returned reference is valid until the next call)
+  const std::vector<float>& resampleToTarget(const float* samples, size_t count, double sourceSampleRate);
+  // Samples resampleToTarget() returns for `count` input samples
+  size_t resampledLength(size_t count, double sourceSampleRate);
+
+  // Number of kFFTSize/kHopSize frames in numSamples samples at kTargetSampleRate
+  static int melFrameCount(size_t numSamples);
+  // Writes melFrameCount(count) * kMelBins mel values into result, floored
+  // and compressed with `scale` (natural log by default);
+  // `audio` must already be at kTargetSampleRate. With setMelThreads() above
+  // 1, inputs of at least kParallelMelMinFrames frames are split across the
+  // worker pool.
+  int computeMelFrames(const float* audio, size_t count, float* result, MelScale scale = MelScale::Log);
+
+  // Threads computeMelFrames() may use, including the caller: 1 (default)
+  // stays sequential, 0 picks the core count up to kMaxMelThreads. Each
+  // thread gets its own FFT plan and scratch, built here.
+  void setMelThreads(int threads);
+  int melThreads() const { return melPool_ ? melPool_->size() : 1; }
+
+  static constexpr int kMaxMelThreads = 8;
+  // About 1.5 s at kTargetSampleRate; shorter inputs are not worth waking the pool
+  static constexpr int kParallelMelMinFrames = 64;
+  // Power spectra stacked per MelFilterbank::applyBatch() call
+  static constexpr int kMelBatchFrames = 16;
+
+  // 12-bin chromagram summed over every kFFTSize/kHopSize frame, folding
+  // only bins in [minFreq, maxFreq], normalized with `norm`
+  void computeChromagram(const float* samples, size_t count, double sampleRate, float minFreq, float maxFreq, float* chroma,
+                         Normalization norm = Normalization::Max);
+
+  // computeChromaFrames() row layout: [chroma x12, bass chroma x12]
+  static constexpr int kChromaFrameSize = 24;
+  // Number of kFFTSize/kHopSize frames in numSamples samples (any rate)
+  static int chromaFrameCount(size_t numSamples);
+  // Chromagram timeline from the same single STFT pass as
+  // computeChromagram(): row f covers samples [f * kHopSize, f * kHopSize +
+  // kFFTSize) and holds both ranges, each normalized with `norm`. Writes
+  // chromaFrameCount(count) * kChromaFrameSize values and returns the frame
+  // count. With Normalization::None, summing the rows and normalizing gives
+  // computeChromagram().
+  int computeChromaFrames(const float* samples, size_t count, double sampleRate, float* output, Normalization norm = Normalization::Max);
+
+  // Single-pass analysis of the latest kFFTSize samples: one windowed FFT
+  // feeds both chroma ranges (each normalized with `norm`) and the onset
+  // detector. Writes kAnalyzeFrameSize values. With setHarmonicPercussive()
+  // the chroma ranges fold only the harmonic part of that spectrum and the
+  // onset detector (when its window is kFFTSize) sees only the percussive part.
+  // With setSpectralWhitening() the magnitudes are whitened first, once, and
+  // both chroma and the onset detector read the whitened spectrum.
+  // foldChroma = false leaves both chroma ranges zero and only runs the FFT,
+  // separation and onset detection, for callers that reuse older chroma.
+  void analyzeFrame(const float* samples, size_t count, double sampleRate, float* result, Normalization norm = Normalization::Max,
+                    bool foldChroma = true);
+  // Bass chroma of the latest kBassFFTSize samples from one long windowed
+  // FFT, normalized with `norm`: the long half of a dual-resolution front
+  // end whose short half is analyzeFrame(), for callers that replace its
+  // bass range every few hops. Follows the chroma assignment and tuning
+  // estimate but not the separation or whitening, whose histories run at
+  // the short frame rate. Shorter inputs leave the 12 values zero.
+  void analyzeBass(const float* samples, size_t count, double sampleRate, float* bassChroma, Normalization norm = Normalization::Max);
+
+  // Constant-Q kernels for (sample rate, numBins), built on first use;
+  // numBins must be 36 or 84
+  ConstantQ& constantQ(int sampleRate, int numBins);
+  // Writes cq.numBins() magnitudes followed by their folded chroma, normalized with `norm`
+  void computeConstantQ(ConstantQ& cq, const float* samples, size_t count, float* output, Normalization norm = Normalization::Max);
+
+  // How FFT bins reach chroma (Nearest by default), for every chroma path
+  void setChromaAssignment(ChromaAssignment assignment);
+  // Median-filter harmonic/percussive separation on the FFT the chroma paths
+  // already compute (off by default). analyzeFrame() calls form one stream
+  // whose history enabling or resetOnsetDetector() clears; computeChromagram() and
+  // computeChromaFrames() separate each input on its own.
+  void setHarmonicPercussive(bool enabled);
+  // Adaptive spectral whitening of the analyzeFrame() spectrum (off by
+  // default), run once per frame before harmonic separation, chroma folding
+  // and the onset descriptors, which then skip aubio's own whitening. The
+  // peaks decay per onset hop (kHopSize without a detector) and are cleared
+  // by enabling or resetOnsetDetector(); the whole-buffer chroma methods
+  // stay unwhitened.
+  void setSpectralWhitening(bool enabled);
+  // Running tuning estimate from the analyzeFrame() spectra (off by
+  // default); while enabled, analyzeFrame() folds chroma around semitones
+  // shifted by it, in ChromaMap::kTuningSteps steps. Cleared by enabling or
+  // resetOnsetDetector(); the whole-buffer chroma methods stay at A440.
+  void setTuningEstimation(bool enabled);
+  bool tuningEstimation() const { return tuning_ != nullptr; }
+  // Current estimate in cents, 0 while disabled; safe from any thread
+  float tuningOffset() const;
+  // SpectralFeatures of every analyzeFrame() magnitude spectrum (off by
+  // default), the whitened one while whitening and before any separation.
+  // The flux history is cleared by enabling or resetOnsetDetector().
+  void setSpectralFeatures(bool enabled);
+  bool spectralFeatures() const { return features_ != nullptr; }
+  // SpectralFeatures::kNumFeatures values of the last analyzeFrame(), zeros
+  // before the first one; null while disabled
+  const float* frameFeatures() const { return features_ ? frameFeatures_ : nullptr; }
+  ChromaAssignment chromaAssignment() const { return chromaAssignment_; }
+  bool harmonicPercussive() const { return harmonic_ != nullptr; }
+  bool spectralWhitening() const { return whiten_; }
+  // Builds everything the first live frame would otherwise build lazily
+  void warmup();
+
+  // Heap allocations the analysis paths made after construction: scratch
+  // that did not fit the arena plus resample buffer growth. Constant in
+  // steady state for the pointer chroma, onset and mel paths.
+  uint64_t scratchAllocations() const;
+
+  // Per-stage timings of every call above since the last perf().reset()
+  PerfStats& perf() { return perf_; }
+
+  // --- aubio onset detection ---
+
+  // Takes a detector for these sizes from the pool with the current descriptors
+  void initOnsetDetector(double sampleRate, double bufferSize, double hopSize);
+  // Also clears the analyzeFrame() harmonic/percussive, whitening, tuning and
+  // spectral flux history
+  void resetOnsetDetector();
+  // Streaming detector, null before initOnsetDetector()
+  PooledOnset* onsetDetector() const { return onset_.get(); }
+  // Values detectOnset() writes: isOnset, fused and, for several
+  // descriptors, one per descriptor
+  size_t onsetResultSize() const { return PooledOnset::resultSize(onsetMethods_.size()); }
+  // One hop through the streaming detector; zeros if there is none
+  void detectOnset(const float* samples, size_t count, float* result);
+
+  // Validated descriptors for every detector acquired from now on; the
+  // current detector is re-acquired with them
+  void setOnsetDescriptors(const std::vector<std::string>& methods, const std::vector<double>& weights);
+  const std::vector<std::string>& onsetMethods() const { return onsetMethods_; }
+  const std::vector<double>& onsetWeights() const { return onsetWeights_; }
+  // Threshold, silence gate and minimum inter-onset interval of the
+  // detectors (throws std::invalid_argument for invalid values). Safe to
+  // call from one thread while another runs analyzeFrame() or
+  // detectOnset(): the values are published lock-free and applied to the
+  // streaming detector at its next hop, keeping its state and buffers.
+  // Detectors acquired later start with them too.
+  void setOnsetParams(const OnsetParams& params);
+  // Last values passed to setOnsetParams(), for the calling thread
+  const OnsetParams& onsetParams() const { return publishedOnsetParams_; }
+
+  // Pool config for the given sizes with the current descriptors
+  OnsetConfig onsetConfig(double sampleRate, double bufferSize, double hopSize) const;
+
+  // Runs a fresh kBatchOnsetBufferSize / kBatchOnsetHopSize detector over a
+  // whole recording: onset times in seconds and the fused descriptor per hop
+  void detectOnsetsBatch(const float* samples, size_t count, double sampleRate, std::vector<float>& times, std::vector<float>& curve);
+
+private:
+  // Constant-Q bins start at C1 with 12 bins per octave
+  static constexpr float kConstantQMinFreq = 32.7032f;
+  static constexpr int kConstantQBinsPerOctave = 12;
+
+  // computeMelFrames() needs the most scratch: windowed input plus a batch of
+  // power spectra (rounded up to four floats), or analyzeBass() its long
+  // window and three spectra
+  static constexpr size_t kScratchFloats =
+      std::max<size_t>(kFFTSize + kMelBatchFrames * (kFFTSize / 2 + 1) + 4, kBassFFTSize + 3 * (kBassFFTSize / 2 + 4));
+
+  // Per-frame buffers for the chroma, onset and mel paths
+  ScratchArena scratch_;
+  uint64_t resampleGrowths_ = 0;
+
+  PerfStats perf_;
+
+  // Built by initMelFilterbank() at construction (from DSPTables)
+  std::unique_ptr<MelFilterbank> melFilterbank_;
+
+  // FFT plans and analysis windows, reused across calls
+  FFTPlanCache plans_;
+
+  // Chroma folding tables keyed by (FFT size, sample rate, min freq, max freq, assignment)
+  std::map<std::tuple<int, int, float, float, ChromaAssignment>, std::unique_ptr<ChromaMap>> chromaMaps_;
+  ChromaAssignment chromaAssignment_ = ChromaAssignment::Nearest;
+
+  // Harmonic/percussive separation for the analyzeFrame() stream and for
+  // offline chroma passes, null while disabled
+  std::unique_ptr<HarmonicPercussive> harmonic_;
+  std::unique_ptr<HarmonicPercussive> batchHarmonic_;
+
+  // analyzeFrame() whitening, built on the first frame after enabling and
+  // rebuilt when the sample rate or onset hop changes
+  bool whiten_ = false;
+  std::unique_ptr<SpectralWhitening> whitening_;
+  SpectralWhitening& whitening(int sampleRate);
+
+  // analyzeFrame() tuning estimate, null while disabled
+  std::unique_ptr<TuningEstimator> tuning_;
+
+  // analyzeFrame() spectral features, null while disabled
+  std::unique_ptr<SpectralFeatures> features_;
+  float frameFeatures_[SpectralFeatures::kNumFeatures] = {};
+
+  // Constant-Q kernels keyed by (sample rate, numBins), plus output scratch
+  std::map<std::pair<int, int>, std::unique_ptr<ConstantQ>> constantQs_;
+  std::vector<float> constantQBins_;
+
+  // Resampler for the last source rate seen, plus its reusable output
+  std::unique_ptr<PolyphaseResampler> resampler_;
+  std::vector<float> resampled_;
+
+  void initMelFilterbank();
+  PolyphaseResampler& resampler(double sourceSampleRate);
+
+  // FFT plan, scratch and timings for one parallel mel participant
+  struct MelWorker {
+    MelWorker();
+
+    SpectrumPlan plan;
+    std::vector<float> windowed;
+    std::vector<float> power; // kMelBatchFrames spectra
+    PerfStats perf;
+  };
+  std::unique_ptr<WorkerPool> melPool_;
+  std::vector<std::unique_ptr<MelWorker>> melWorkers_;
+
+  // `frames` (<= kMelBatchFrames) log-mel frames starting at `audio`: the
+  // power spectra are stacked in `power`, then projected and logged in one
+  // batch
+  void computeMelBatch(const float* audio, int frames, SpectrumPlan& plan, float* windowed, float* power, PerfStats& perf, MelScale scale, float* out) const;
+  void computeMelFramesParallel(const float* audio, int numFrames, MelScale scale, float* result);
+
+  // Windows and transforms every kFFTSize/kHopSize frame, calling
+  // visit(frame, power) with its kFFTSize / 2 + 1 power bins; returns the
+  // frame count
+  template <typename Visit>
+  int forEachPowerFrame(const float* samples, size_t count, Visit&& visit);
+
+  // Bin -> pitch class table for fftSize at sampleRate over [minFreq, maxFreq],
+  // built on first use for the current assignment mode
+  const ChromaMap& chromaMap(int sampleRate, float minFreq, float maxFreq, int fftSize = kFFTSize);
+
+  // Streaming onset detector, owned until the next initOnsetDetector()
+  OnsetDetectorPool::Handle onset_;
+  // Fused descriptors, applied by initOnsetDetector()
+  std::vector<std::string> onsetMethods_ = {"default"};
+  std::vector<double> onsetWeights_ = {1.0};
+  // setOnsetParams() values: the writer's copy, the handoff, and the ones
+  // the analysis side applied last
+  OnsetParams publishedOnsetParams_;
+  SnapshotExchange<OnsetParams> onsetParamsExchange_;
+  OnsetParams appliedOnsetParams_;
+  // Analysis side, at a hop boundary: applies newly published values
+  void takeOnsetParams();
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,218 @@
+#include "ChordDecoder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+ChordDecoder::ChordDecoder() {
+  configure(Params(), 0);
+}
+
+ChordDecoder::ChordDecoder(Params params, int lag) {
+  configure(params, lag);
+}
+
+void ChordDecoder::configure(Params params, int lag) {
+  if (!(params.selfTransition > 0.0f && params.selfTransition < 1.0f)) {
+    throw std::invalid_argument("ChordDecoder: selfTransition must be in (0, 1)");
+  }
+  if (!(params.temperature > 0.0f) || !std::isfinite(params.temperature)) {
+    throw std::invalid_argument("ChordDecoder: temperature must be positive and finite");
+  }
+  if (!std::isfinite(params.noChordScore)) {
+    throw std::invalid_argument("ChordDecoder: noChordScore must be finite");
+  }
+  if (lag < 0 || lag > kMaxLag) {
+    throw std::invalid_argument("ChordDecoder: lag must be in [0, " + std::to_string(kMaxLag) + "], got " + std::to_string(lag));
+  }
+  params_ = params;
+  lag_ = lag;
+
+  // A chord leaves to every other chord in proportion to the plausibility
+  // of the root interval, and to N/C with plausibility 1
+  float plausibilitySum = 0.0f;
+  for (int i = 0; i < 12; i++) {
+    logPlausibility_[i] = std::log(kTransitionPlausibility[i]);
+    plausibilitySum += kTransitionPlausibility[i];
+  }
+  float fromChord = static_cast<float>(kNumChordQualities) * plausibilitySum - kTransitionPlausibility[0] + 1.0f;
+  logStay_ = std::log(params.selfTransition);
+  logFromChord_ = std::log((1.0f - params.selfTransition) / fromChord);
+  logFromNoChord_ = std::log((1.0f - params.selfTransition) / kNumChords);
+
+  streamBack_.assign(static_cast<size_t>(lag + 1) * kNumStates, 0);
+  streamScores_.assign(static_cast<size_t>(lag + 1) * kNumChords, 0.0f);
+  reset();
+}
+
+void ChordDecoder::reset() {
+  pushed_ = 0;
+}
+
+void ChordDecoder::step(const float* previous, const float* scores, float* delta, uint8_t* back) const {
+  const float invTemperature = 1.0f / params_.temperature;
+  const float noChordEmission = params_.noChordScore * invTemperature;
+
+  if (!previous) {
+    for (int s = 0; s < kNumChords; s++) {
+      delta[s] = scores[s] * invTemperature;
+      back[s] = static_cast<uint8_t>(s);
+    }
+    delta[kNoChordState] = noChordEmission;
+    back[kNoChordState] = kNoChordState;
+  } else {
+    // The two best chords of each root: a chord's best same-root
+    // predecessor other than itself is the runner-up when it is the best
+    float best[12];
+    float second[12];
+    int bestArg[12];
+    int secondArg[12];
+    std::fill(best, best + 12, -INFINITY);
+    std::fill(second, second + 12, -INFINITY);
+    std::fill(bestArg, bestArg + 12, 0);
+    std::fill(secondArg, secondArg + 12, 0);
+    for (int s = 0; s < kNumChords; s++) {
+      int root = s % 12;
+      float value = previous[s];
+      if (value > best[root]) {
+        second[root] = best[root];
+        secondArg[root] = bestArg[root];
+        best[root] = value;
+        bestArg[root] = s;
+      } else if (value > second[root]) {
+        second[root] = value;
+        secondArg[root] = s;
+      }
+    }
+
+    // Best move into each root from a different root
+    float across[12];
+    int acrossArg[12];
+    float bestChord = -INFINITY;
+    int bestChordArg = 0;
+    for (int to = 0; to < 12; to++) {
+      across[to] = -INFINITY;
+      acrossArg[to] = 0;
+      for (int from = 0; from < 12; from++) {
+        if (from == to) continue;
+        float value = best[from] + logPlausibility_[(to - from + 12) % 12];
+        if (value > across[to]) {
+          across[to] = value;
+          acrossArg[to] = bestArg[from];
+        }
+      }
+      if (best[to] > bestChord) {
+        bestChord = best[to];
+        bestChordArg = bestArg[to];
+      }
+    }
+
+    float fromNoChord = previous[kNoChordState] + logFromNoChord_;
+    for (int s = 0; s < kNumChords; s++) {
+      int root = s % 12;
+      // Staying wins ties
+      float value = previous[s] + logStay_;
+      int arg = s;
+
+      bool isBest = bestArg[root] == s;
+      float move = (isBest ? second[root] : best[root]) + logPlausibility_[0];
+      int moveArg = isBest ? secondArg[root] : bestArg[root];
+      if (across[root] > move) {
+        move = across[root];
+        moveArg = acrossArg[root];
+      }
+      move += logFromChord_;
+      if (move > value) {
+        value = move;
+        arg = moveArg;
+      }
+      if (fromNoChord > value) {
+        value = fromNoChord;
+        arg = kNoChordState;
+      }
+      delta[s] = value + scores[s] * invTemperature;
+      back[s] = static_cast<uint8_t>(arg);
+    }
+
+    float stay = previous[kNoChordState] + logStay_;
+    float enter = bestChord + logFromChord_;
+    delta[kNoChordState] = std::max(stay, enter) + noChordEmission;
+    back[kNoChordState] = static_cast<uint8_t>(enter > stay ? bestChordArg : kNoChordState);
+  }
+
+  // Only differences matter; keeping the best at 0 keeps long runs precise
+  float top = delta[bestState(delta)];
+  for (int s = 0; s < kNumStates; s++) delta[s] -= top;
+}
+
+int ChordDecoder::bestState(const float* delta) {
+  return static_cast<int>(std::max_element(delta, delta + kNumStates) - delta);
+}
+
+ChordDecoder::Decision ChordDecoder::decisionAt(int state, const float* scores) const {
+  Decision decision;
+  if (state != kNoChordState) {
+    decision.chord = state;
+    decision.confidence = scores[state];
+  }
+  return decision;
+}
+
+void ChordDecoder::decode(const float* scores, int frames, Decision* out) {
+  if (frames <= 0) return;
+  size_t needed = static_cast<size_t>(frames) * kNumStates;
+  if (back_.size() < needed) back_.resize(needed);
+  delta_.resize(2 * kNumStates);
+
+  float* current = delta_.data();
+  float* next = delta_.data() + kNumStates;
+  for (int f = 0; f < frames; f++) {
+    step(f == 0 ? nullptr : current, scores + static_cast<size_t>(f) * kNumChords, next, back_.data() + static_cast<size_t>(f) * kNumStates);
+    std::swap(current, next);
+  }
+
+  int state = bestState(current);
+  for (int f = frames - 1; f >= 0; f--) {
+    out[f] = decisionAt(state, scores + static_cast<size_t>(f) * kNumChords);
+    state = back_[static_cast<size_t>(f) * kNumStates + state];
+  }
+}
+
+bool ChordDecoder::push(const float* scores, Decision& out) {
+  const int rows = lag_ + 1;
+  int row = static_cast<int>(pushed_ % rows);
+  std::copy(scores, scores + kNumChords, streamScores_.data() + static_cast<size_t>(row) * kNumChords);
+  step(pushed_ == 0 ? nullptr : streamDelta_, scores, nextDelta_, streamBack_.data() + static_cast<size_t>(row) * kNumStates);
+  std::copy(nextDelta_, nextDelta_ + kNumStates, streamDelta_);
+  pushed_++;
+  if (pushed_ <= lag_) return false;
+
+  // Trace the latest path back `lag` frames
+  int state = bestState(streamDelta_);
+  for (int64_t t = pushed_ - 1; t > pushed_ - 1 - lag_; t--) {
+    state = streamBack_[static_cast<size_t>(t % rows) * kNumStates + state];
+  }
+  int decided = static_cast<int>((pushed_ - 1 - lag_) % rows);
+  out = decisionAt(state, streamScores_.data() + static_cast<size_t>(decided) * kNumChords);
+  return true;
+}
+
+int ChordDecoder::flush(Decision* out) {
+  const int rows = lag_ + 1;
+  int pending = static_cast<int>(std::min<int64_t>(pushed_, lag_));
+  if (pending > 0) {
+    int state = bestState(streamDelta_);
+    for (int i = pending - 1; i >= 0; i--) {
+      int64_t t = pushed_ - pending + i;
+      size_t row = static_cast<size_t>(t % rows);
+      out[i] = decisionAt(state, streamScores_.data() + row * kNumChords);
+      state = streamBack_[row * kNumStates + state];
+    }
+  }
+  reset();
+  return pending;
+}
+
+} // namespace margelo::nitro::chorddsp
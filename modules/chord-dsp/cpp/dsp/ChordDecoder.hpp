@@ -0,0 +1,96 @@
+#pragma once
+
+#include "ChordClassifier.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Viterbi decoder over per-frame chord scores, the globally optimal
+// counterpart of ChordSequenceContext + ChordSmoother's greedy per-hop
+// smoothing. States are the kNumChords chords plus N/C. Emissions are
+// exp(score / temperature) with the template similarities from
+// ChordClassifier::biasedScore() and a constant score for N/C; a chord stays with
+// probability selfTransition and otherwise moves to chord j with
+// probability proportional to transitionPlausibility() of the root
+// interval (1 to and from N/C).
+//
+// That transition matrix factors through the 12 roots, so each frame costs
+// one pass over the states plus a 12 x 12 root pass instead of the dense
+// 85 x 85 product, and the back pointers are one byte per state per frame,
+// stored frame by frame with the states of a frame contiguous.
+//
+// decode() runs over a whole recording. push() is the fixed-lag online mode:
+// the decision for frame t is the Viterbi path at frame t + lag traced back,
+// so latency is bounded by `lag` frames and each step costs O(states + lag).
+class ChordDecoder {
+public:
+  static constexpr int kNumStates = kNumChords + 1;
+  // State index of N/C
+  static constexpr int kNoChordState = kNumChords;
+  static constexpr int kMaxLag = 1024;
+
+  struct Params {
+    float selfTransition = 0.9f;
+    float temperature = 0.05f;
+    float noChordScore = 0.6f;
+  };
+
+  struct Decision {
+    // ChordCandidate::index(), -1 for N/C
+    int chord = -1;
+    // The chord's score in its frame, 0 for N/C
+    float confidence = 0.0f;
+  };
+
+  ChordDecoder();
+  ChordDecoder(Params params, int lag);
+
+  // Params and lag; resets the online stream
+  void configure(Params params, int lag);
+  const Params& params() const { return params_; }
+  int lag() const { return lag_; }
+
+  // Offline: `scores` holds `frames` rows of kNumChords values, and one
+  // Decision per frame is written to `out`. The online stream is untouched.
+  void decode(const float* scores, int frames, Decision* out);
+
+  // Online: feeds one score row. Returns true and writes the decision for
+  // the frame `lag` rows back once that many rows have been pushed.
+  bool push(const float* scores, Decision& out);
+  // Decisions for the frames push() has not decided yet, oldest first, from
+  // the path ending at the latest frame. Returns the number written (at
+  // most lag); the stream is reset.
+  int flush(Decision* out);
+  void reset();
+
+private:
+  // delta = the best log probability of each state after `emission`, from
+  // `previous` (null for the first frame); back pointers go to `back`.
+  // Rescaled so the best state is 0.
+  void step(const float* previous, const float* scores, float* delta, uint8_t* back) const;
+  static int bestState(const float* delta);
+  Decision decisionAt(int state, const float* scores) const;
+
+  Params params_;
+  int lag_ = 0;
+  // Log transition terms
+  float logStay_ = 0.0f;
+  float logFromChord_ = 0.0f;
+  float logFromNoChord_ = 0.0f;
+  float logPlausibility_[12] = {};
+
+  // Offline path
+  std::vector<float> delta_;
+  std::vector<uint8_t> back_;
+
+  // Online stream: the latest delta and rings of lag + 1 back pointer and
+  // score rows
+  float streamDelta_[kNumStates] = {};
+  float nextDelta_[kNumStates] = {};
+  std::vector<uint8_t> streamBack_;
+  std::vector<float> streamScores_;
+  int64_t pushed_ = 0;
+};
+
+} // namespace margelo::nitro::chorddsp
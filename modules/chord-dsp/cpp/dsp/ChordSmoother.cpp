@@ -0,0 +1,87 @@
+#include "ChordSmoother.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+ChordSmoother::ChordSmoother(double minHoldMs, int minFramesToConfirm, float hysteresisMargin)
+    : minHoldMs_(minHoldMs), minFramesToConfirm_(minFramesToConfirm), hysteresisMargin_(hysteresisMargin) {}
+
+void ChordSmoother::configure(double minHoldMs, int minFramesToConfirm, float hysteresisMargin) {
+  minHoldMs_ = minHoldMs;
+  minFramesToConfirm_ = minFramesToConfirm;
+  hysteresisMargin_ = hysteresisMargin;
+}
+
+ChordSmoother::Result ChordSmoother::process(int chord, float confidence, bool isOnset, double nowMs) {
+  double timeSinceChange = nowMs - lastChangeMs_;
+  if (isOnset) {
+    lastOnsetMs_ = nowMs;
+  }
+
+  // On an onset switch instantly, between onsets hold longer
+  bool recentOnset = isOnset || nowMs - lastOnsetMs_ < 30.0;
+  double holdMs = recentOnset ? 0.0 : minHoldMs_ * 1.5;
+  int framesToConfirm = recentOnset ? 1 : minFramesToConfirm_;
+
+  if (chord == currentChord_) {
+    clearCandidate();
+    currentConfidence_ = confidence;
+    return {currentChord_, confidence};
+  }
+
+  // A chord that is not re-confirmed loses ~5% per frame so it cannot block
+  // a switch indefinitely
+  currentConfidence_ *= 0.95f;
+
+  if (timeSinceChange < holdMs) {
+    return {currentChord_, currentConfidence_};
+  }
+
+  // Hysteresis against arpeggio flicker
+  if (currentChord_ >= 0 && !recentOnset && confidence < currentConfidence_ + hysteresisMargin_) {
+    clearCandidate();
+    return {currentChord_, currentConfidence_};
+  }
+
+  // Clearly dominant: skip frame confirmation
+  if (confidence > 0.7f && confidence > currentConfidence_ + 0.1f) {
+    return switchTo(chord, confidence, nowMs);
+  }
+
+  if (chord == candidateChord_) {
+    candidateCount_++;
+    candidateConfidenceSum_ += confidence;
+  } else {
+    candidateChord_ = chord;
+    candidateCount_ = 1;
+    candidateConfidenceSum_ = confidence;
+  }
+
+  if (candidateCount_ >= framesToConfirm) {
+    return switchTo(chord, candidateConfidenceSum_ / static_cast<float>(candidateCount_), nowMs);
+  }
+  return {currentChord_, currentConfidence_};
+}
+
+void ChordSmoother::reset() {
+  currentChord_ = -1;
+  currentConfidence_ = 0.0f;
+  lastChangeMs_ = 0.0;
+  lastOnsetMs_ = 0.0;
+  clearCandidate();
+}
+
+void ChordSmoother::clearCandidate() {
+  candidateChord_ = -1;
+  candidateCount_ = 0;
+  candidateConfidenceSum_ = 0.0f;
+}
+
+ChordSmoother::Result ChordSmoother::switchTo(int chord, float confidence, double nowMs) {
+  currentChord_ = chord;
+  currentConfidence_ = confidence;
+  lastChangeMs_ = nowMs;
+  clearCandidate();
+  return {chord, confidence};
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,47 @@
+#pragma once
+
+namespace margelo::nitro::chorddsp {
+
+// Native port of ChordSmoother in src/utils/chordClassification.ts: minimum
+// hold, hysteresis with a decaying stored confidence, multi-frame
+// confirmation and onset-aware instant switching. Chords are identified by
+// ChordCandidate::index(), -1 for N/C, and the caller supplies the clock so
+// the same input always gives the same output.
+class ChordSmoother {
+public:
+  struct Result {
+    int chord = -1;
+    float confidence = 0.0f;
+  };
+
+  explicit ChordSmoother(double minHoldMs = 100.0, int minFramesToConfirm = 2, float hysteresisMargin = 0.1f);
+
+  void configure(double minHoldMs, int minFramesToConfirm, float hysteresisMargin);
+
+  // Feeds one classified frame at `nowMs` and returns the smoothed chord
+  Result process(int chord, float confidence, bool isOnset, double nowMs);
+
+  int currentChord() const { return currentChord_; }
+  // Pitch class of the current chord, -1 for N/C
+  int currentRoot() const { return currentChord_ < 0 ? -1 : currentChord_ % 12; }
+
+  void reset();
+
+private:
+  void clearCandidate();
+  Result switchTo(int chord, float confidence, double nowMs);
+
+  double minHoldMs_;
+  int minFramesToConfirm_;
+  float hysteresisMargin_;
+
+  int currentChord_ = -1;
+  float currentConfidence_ = 0.0f;
+  double lastChangeMs_ = 0.0;
+  double lastOnsetMs_ = 0.0;
+  int candidateChord_ = -1;
+  int candidateCount_ = 0;
+  float candidateConfidenceSum_ = 0.0f;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,188 @@
+#include "ChromaMap.hpp"
+#include "VectorOps.hpp"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr float kSemitonesPerLn = 17.312340490667561f; // 12 / ln(2)
+constexpr float kLogFloor = 1e-20f;
+// Ten octaves, above any note a bin of the range can reach below MIDI 0
+constexpr float kNoteBias = 120.0f;
+
+// Folds `count` peaks gathered by accumulatePeaks(): `logs` holds the
+// powers around each one, [below, peak, above], and is turned into log
+// power in one batch, as are the peaks' frequencies over 440 Hz afterwards
+void foldPeaks(const int* bins, float* logs, int count, float binHz, float shift, float* chroma) {
+  float levels[ChromaMap::kMaxPeaks];
+  float ratios[ChromaMap::kMaxPeaks];
+  logFloor(logs, 3 * static_cast<size_t>(count), kLogFloor);
+  for (int i = 0; i < count; i++) {
+    // Parabola through the three log powers around the maximum, as aubio's
+    // fvec_quadratic_peak_pos() and fvec_quadratic_peak_mag(): its vertex
+    // is the partial's fractional bin and interpolated level. A strict
+    // maximum keeps the vertex within half a bin; one flattened by the log
+    // floor stays on the bin.
+    const float* l = logs + 3 * i;
+    float curvature = l[0] - 2.0f * l[1] + l[2];
+    float offset = curvature < 0.0f ? 0.5f * (l[0] - l[2]) / curvature : 0.0f;
+    levels[i] = std::exp(l[1] - 0.25f * (l[0] - l[2]) * offset);
+    ratios[i] = (bins[i] + offset) * binHz / 440.0f;
+  }
+  logFloor(ratios, static_cast<size_t>(count), kLogFloor);
+  for (int i = 0; i < count; i++) {
+    // Rounded to the nearest semitone; the octaves of the bias keep the
+    // truncation on positive notes without changing the pitch class
+    float note = 69.0f + kSemitonesPerLn * ratios[i] - shift;
+    chroma[static_cast<int>(note + kNoteBias + 0.5f) % 12] += levels[i];
+  }
+}
+
+} // namespace
+
+ChromaMap::ChromaMap(int fftSize, int sampleRate, float minFreq, float maxFreq, ChromaAssignment assignment) : assignment_(assignment) {
+  int fftBins = fftSize / 2 + 1;
+  if (assignment == ChromaAssignment::Peaks) {
+    // A peak needs both neighbours
+    binHz_ = static_cast<float>(sampleRate) / fftSize;
+    firstBin_ = std::max(1, static_cast<int>(std::ceil(minFreq / binHz_)));
+    lastBin_ = std::min(fftBins - 2, static_cast<int>(std::floor(maxFreq / binHz_)));
+    return;
+  }
+
+  // MIDI note -> (bin, weight) in increasing bin order
+  std::map<int, std::vector<std::pair<int, float>>> notes;
+
+  for (int k = 1; k < fftBins; k++) {
+    float freq = static_cast<float>(k) * sampleRate / fftSize;
+    if (freq < minFreq || freq > maxFreq) continue;
+
+    float midiNote = 69.0f + 12.0f * std::log2(freq / 440.0f);
+    int fine = static_cast<int>(std::round(midiNote * kTuningSteps));
+    int fineClass = ((fine % kFineClasses) + kFineClasses) % kFineClasses;
+    if (!fineSpans_.empty() && fineSpans_.back().pitchClass == fineClass && fineSpans_.back().start + fineSpans_.back().length == k) {
+      fineSpans_.back().length++;
+    } else {
+      fineSpans_.push_back({fineClass, k, 1, 0});
+    }
+
+    if (assignment == ChromaAssignment::Nearest) {
+      notes[static_cast<int>(std::round(midiNote))].emplace_back(k, 1.0f);
+    } else {
+      float lower = std::floor(midiNote);
+      float frac = midiNote - lower;
+      notes[static_cast<int>(lower)].emplace_back(k, 1.0f - frac);
+      notes[static_cast<int>(lower) + 1].emplace_back(k, frac);
+    }
+  }
+
+  // Bins of one note are contiguous because frequency grows with the bin index
+  for (const auto& [note, bins] : notes) {
+    int pitchClass = ((note % 12) + 12) % 12;
+    spans_.push_back({pitchClass, bins.front().first, static_cast<int>(bins.size()), static_cast<int>(weights_.size())});
+    for (const auto& bin : bins) weights_.push_back(bin.second);
+  }
+}
+
+void ChromaMap::accumulate(const float* power, float* chroma) const {
+  if (assignment_ == ChromaAssignment::Peaks) {
+    accumulatePeaks(power, 0.0f, chroma);
+    return;
+  }
+  const float* weights = weights_.data();
+  for (const Span& span : spans_) {
+    float sum = 0.0f;
+#ifdef __APPLE__
+    vDSP_dotpr(power + span.start, 1, weights + span.offset, 1, &sum, span.length);
+#else
+    const float* p = power + span.start;
+    const float* w = weights + span.offset;
+    for (int k = 0; k < span.length; k++) {
+      sum += p[k] * w[k];
+    }
+#endif
+    chroma[span.pitchClass] += sum;
+  }
+}
+
+void ChromaMap::accumulateTuned(const float* power, int shift, float* chroma) const {
+  shift = std::clamp(shift, -kTuningSteps / 2, kTuningSteps / 2);
+  if (assignment_ == ChromaAssignment::Peaks) {
+    accumulatePeaks(power, static_cast<float>(shift) / kTuningSteps, chroma);
+    return;
+  }
+
+  float fine[kFineClasses] = {};
+  for (const Span& span : fineSpans_) {
+    float sum = 0.0f;
+#ifdef __APPLE__
+    vDSP_sve(power + span.start, 1, &sum, span.length);
+#else
+    const float* p = power + span.start;
+    for (int k = 0; k < span.length; k++) sum += p[k];
+#endif
+    fine[span.pitchClass] += sum;
+  }
+
+  if (assignment_ == ChromaAssignment::Nearest) {
+    // Pitch class pc collects the fine classes within half a semitone of
+    // pc * kTuningSteps + shift; the upper edge goes to the next semitone,
+    // like std::round() on the exact note
+    int first = shift - kTuningSteps / 2;
+    for (int pc = 0; pc < 12; pc++) {
+      float sum = 0.0f;
+      for (int i = 0; i < kTuningSteps; i++) {
+        int j = pc * kTuningSteps + first + i;
+        sum += fine[(j + kFineClasses) % kFineClasses];
+      }
+      chroma[pc] += sum;
+    }
+  } else {
+    for (int j = 0; j < kFineClasses; j++) {
+      if (fine[j] == 0.0f) continue;
+      int position = j - shift;
+      int lower = position >= 0 ? position / kTuningSteps : (position - kTuningSteps + 1) / kTuningSteps;
+      float frac = static_cast<float>(position - lower * kTuningSteps) / kTuningSteps;
+      chroma[((lower % 12) + 12) % 12] += fine[j] * (1.0f - frac);
+      chroma[((lower + 1) % 12 + 12) % 12] += fine[j] * frac;
+    }
+  }
+}
+
+void ChromaMap::accumulatePeaks(const float* power, float shift, float* chroma) const {
+  // The floor comes from the range's strongest bin, so it is found first;
+  // the second scan folds the strict maxima at or above it kMaxPeaks at a
+  // time, and the rest of the bins cost a few compares
+  float strongest = 0.0f;
+  for (int k = firstBin_; k <= lastBin_; k++) strongest = std::max(strongest, power[k]);
+  if (!(strongest > 0.0f)) return;
+  const float floor = strongest * kPeakFloor;
+
+  int bins[kMaxPeaks];
+  float logs[3 * kMaxPeaks];
+  int count = 0;
+  for (int k = firstBin_; k <= lastBin_; k++) {
+    float p = power[k];
+    if (p < floor || p <= power[k - 1] || p <= power[k + 1]) continue;
+    if (count == kMaxPeaks) {
+      foldPeaks(bins, logs, count, binHz_, shift, chroma);
+      count = 0;
+    }
+    bins[count] = k;
+    logs[3 * count] = power[k - 1];
+    logs[3 * count + 1] = p;
+    logs[3 * count + 2] = power[k + 1];
+    count++;
+  }
+  foldPeaks(bins, logs, count, binHz_, shift, chroma);
+}
+
+} // namespace margelo::nitro::chorddsp
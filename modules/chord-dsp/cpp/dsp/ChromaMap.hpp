@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+enum class ChromaAssignment {
+  Nearest, // each bin goes to the pitch class of its nearest semitone
+  Soft,    // each bin is split linearly between its two nearest semitones
+  Peaks,   // only interpolated spectral peaks, each to its nearest semitone
+};
+
+// Precomputed FFT bin -> pitch class table for one (FFT size, sample rate,
+// frequency range). Bins are grouped per semitone into contiguous spans with
+// their weights, so folding a power spectrum is one short dot product per
+// semitone instead of a log2/round/modulo per bin.
+//
+// A second table maps each bin to the nearest of kTuningSteps steps per
+// semitone. accumulateTuned() folds into those 12 * kTuningSteps fine
+// classes and then regroups them around semitone centers shifted by the
+// tuning offset, so an out-of-tune instrument costs one pass over the fine
+// classes instead of rebuilt tables.
+//
+// With Peaks assignment there are no tables: each fold scans the range for
+// its strongest bin, then again for the local maxima above the floor it
+// sets, refines them with the parabola of aubio's
+// fvec_quadratic_peak_pos()/fvec_quadratic_peak_mag() on log power, and
+// adds each peak's interpolated power to the pitch class of its exact
+// fractional frequency, so the noise floor between partials no longer
+// reaches chroma. This is not cheaper than the Nearest tables: every bin
+// is read twice, and each peak pays for its logs, taken kMaxPeaks at a
+// time with the vectorized logFloor(), and one exp. A noisy spectrum,
+// with a maximum every few bins, costs the most.
+class ChromaMap {
+public:
+  // Tuning resolution: 10 cent steps
+  static constexpr int kTuningSteps = 10;
+  static constexpr int kFineClasses = 12 * kTuningSteps;
+  // Peaks below this share of the range's strongest bin are ignored
+  // (-30 dB, just above the Hann window's first side lobe)
+  static constexpr float kPeakFloor = 0.001f;
+  // Peaks folded per batch
+  static constexpr int kMaxPeaks = 64;
+
+  ChromaMap(int fftSize, int sampleRate, float minFreq, float maxFreq, ChromaAssignment assignment);
+
+  // chroma[pc] += sum of weight * power[bin] over the bins mapped to pc
+  void accumulate(const float* power, float* chroma) const;
+  // accumulate() for semitones `shift` tuning steps above A440-relative
+  // ones, shift in [-kTuningSteps / 2, kTuningSteps / 2]. With Soft
+  // assignment each fine class is split between its two nearest shifted
+  // semitones.
+  void accumulateTuned(const float* power, int shift, float* chroma) const;
+
+private:
+  // Peaks assignment: folds around semitones `shift` semitones above A440's
+  void accumulatePeaks(const float* power, float shift, float* chroma) const;
+
+  struct Span {
+    int pitchClass;
+    int start;  // first FFT bin
+    int length; // number of contiguous bins
+    int offset; // index of the first weight in weights_
+  };
+
+  std::vector<Span> spans_;
+  std::vector<float> weights_;
+
+  ChromaAssignment assignment_;
+  // Contiguous runs of bins with the same fine class (weight 1), pitchClass
+  // holding the fine class
+  std::vector<Span> fineSpans_;
+
+  // Peaks assignment: bins whose interior maxima are read, and their width
+  int firstBin_ = 1;
+  int lastBin_ = 0;
+  float binHz_ = 0.0f;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,171 @@
+#include "ConstantQ.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr int kLowpassTaps = 31;
+// Decimation low-pass cutoff in cycles per input sample. Everything above the
+// next octave's band (a quarter of the input Nyquist) is allowed to alias
+// only into frequencies that octave does not use.
+constexpr double kLowpassCutoff = 0.2;
+// Spectral kernel entries below this fraction of the bin's peak are dropped
+constexpr double kSparsityThreshold = 0.0054;
+
+int nextPowerOfTwo(int n) {
+  int p = 1;
+  while (p < n) p <<= 1;
+  return p;
+}
+
+} // namespace
+
+ConstantQ::ConstantQ(int sampleRate, float minFreq, int binsPerOctave, int numBins) : numBins_(numBins), binsPerOctave_(binsPerOctave) {
+  if (sampleRate <= 0 || minFreq <= 0.0f || binsPerOctave <= 0 || numBins <= 0) {
+    throw std::invalid_argument("ConstantQ: sampleRate, minFreq, binsPerOctave and numBins must be positive");
+  }
+  double maxFreq = minFreq * std::pow(2.0, static_cast<double>(numBins - 1) / binsPerOctave);
+  if (maxFreq >= sampleRate / 2.0) {
+    throw std::invalid_argument("ConstantQ: highest bin (" + std::to_string(maxFreq) + " Hz) is above Nyquist for " + std::to_string(sampleRate) + " Hz");
+  }
+
+  numOctaves_ = (numBins + binsPerOctave - 1) / binsPerOctave;
+  double topOctaveMin = minFreq * std::pow(2.0, numOctaves_ - 1);
+  double topOctaveMax = topOctaveMin * std::pow(2.0, static_cast<double>(binsPerOctave - 1) / binsPerOctave);
+
+  // Decimate up front while the whole top octave stays below rate / 4
+  double rate = sampleRate;
+  initialDecimations_ = 0;
+  while (rate / 2.0 >= 4.0 * topOctaveMax) {
+    rate /= 2.0;
+    initialDecimations_++;
+  }
+
+  // Kernels for the top octave at the working rate, right-aligned in the
+  // FFT frame so every bin ends on the newest sample
+  double q = 1.0 / (std::pow(2.0, 1.0 / binsPerOctave) - 1.0);
+  int longest = static_cast<int>(std::ceil(q * rate / topOctaveMin));
+  int fftSize = std::max(16, nextPowerOfTwo(longest));
+  fft_ = std::make_unique<RealFFT>(fftSize);
+  int fftBins = fft_->numBins();
+
+  std::vector<double> specRe(fftBins);
+  std::vector<double> specIm(fftBins);
+  for (int j = 0; j < binsPerOctave; j++) {
+    double freq = topOctaveMin * std::pow(2.0, static_cast<double>(j) / binsPerOctave);
+    int length = static_cast<int>(std::ceil(q * rate / freq));
+    int start = fftSize - length;
+
+    // S[k] = conj(DFT(t))[k] / fftSize with t[n] = hamming(n) / N * e^(2 pi i Q n / N)
+    double peak = 0.0;
+    for (int k = 0; k < fftBins; k++) {
+      double re = 0.0;
+      double im = 0.0;
+      for (int n = 0; n < length; n++) {
+        double w = (0.54 - 0.46 * std::cos(2.0 * M_PI * n / (length - 1))) / length;
+        double phase = 2.0 * M_PI * (q * n / length - static_cast<double>(k) * (start + n) / fftSize);
+        re += w * std::cos(phase);
+        im += w * std::sin(phase);
+      }
+      specRe[k] = re / fftSize;
+      specIm[k] = -im / fftSize;
+      peak = std::max(peak, std::hypot(specRe[k], specIm[k]));
+    }
+
+    int first = fftBins;
+    int last = -1;
+    for (int k = 0; k < fftBins; k++) {
+      if (std::hypot(specRe[k], specIm[k]) >= kSparsityThreshold * peak) {
+        first = std::min(first, k);
+        last = k;
+      }
+    }
+    kernels_.push_back({first, last - first + 1, static_cast<int>(kernelRe_.size())});
+    for (int k = first; k <= last; k++) {
+      kernelRe_.push_back(static_cast<float>(specRe[k]));
+      kernelIm_.push_back(static_cast<float>(specIm[k]));
+    }
+  }
+
+  lowpass_.resize(kLowpassTaps);
+  double sum = 0.0;
+  for (int t = 0; t < kLowpassTaps; t++) {
+    double x = t - (kLowpassTaps - 1) / 2.0;
+    double sinc = x == 0.0 ? 1.0 : std::sin(2.0 * M_PI * kLowpassCutoff * x) / (2.0 * M_PI * kLowpassCutoff * x);
+    double blackman = 0.42 - 0.5 * std::cos(2.0 * M_PI * t / (kLowpassTaps - 1)) + 0.08 * std::cos(4.0 * M_PI * t / (kLowpassTaps - 1));
+    lowpass_[t] = static_cast<float>(sinc * blackman);
+    sum += lowpass_[t];
+  }
+  for (float& h : lowpass_) h = static_cast<float>(h / sum);
+
+  // The lowest octave runs at the working rate / 2^(numOctaves - 1); allow
+  // one filter length per stage of extra history for the decimators
+  size_t factor = static_cast<size_t>(1) << (initialDecimations_ + numOctaves_ - 1);
+  windowSize_ = static_cast<size_t>(longest + kLowpassTaps) * factor;
+
+  stage_.reserve(windowSize_);
+  decimated_.reserve(windowSize_ / 2 + 1);
+  frame_.resize(fftSize);
+  re_.resize(fftBins);
+  im_.resize(fftBins);
+}
+
+void ConstantQ::decimate(std::vector<float>& buffer) {
+  size_t n = buffer.size();
+  size_t m = n / 2;
+  decimated_.resize(m);
+  for (size_t i = 0; i < m; i++) {
+    size_t center = n - 1 - 2 * (m - 1 - i);
+    float sum = 0.0f;
+    int taps = static_cast<int>(std::min<size_t>(kLowpassTaps, center + 1));
+    for (int t = 0; t < taps; t++) {
+      sum += lowpass_[t] * buffer[center - t];
+    }
+    decimated_[i] = sum;
+  }
+  buffer.swap(decimated_);
+}
+
+void ConstantQ::compute(const float* input, size_t count, float* magnitudes) {
+  size_t take = std::min(count, windowSize_);
+  stage_.assign(windowSize_ - take, 0.0f);
+  stage_.insert(stage_.end(), input + count - take, input + count);
+
+  for (int i = 0; i < initialDecimations_; i++) decimate(stage_);
+
+  int fftSize = fft_->size();
+  for (int o = 0; o < numOctaves_; o++) {
+    int octave = numOctaves_ - 1 - o; // counted from the lowest
+
+    size_t have = std::min<size_t>(stage_.size(), fftSize);
+    std::fill(frame_.begin(), frame_.end() - have, 0.0f);
+    std::copy(stage_.end() - have, stage_.end(), frame_.end() - have);
+    fft_->forward(frame_.data(), re_.data(), im_.data());
+
+    for (int j = 0; j < binsPerOctave_; j++) {
+      int bin = octave * binsPerOctave_ + j;
+      if (bin >= numBins_) break;
+
+      const Kernel& kernel = kernels_[j];
+      const float* kr = kernelRe_.data() + kernel.offset;
+      const float* ki = kernelIm_.data() + kernel.offset;
+      const float* xr = re_.data() + kernel.start;
+      const float* xi = im_.data() + kernel.start;
+      float sumRe = 0.0f;
+      float sumIm = 0.0f;
+      for (int k = 0; k < kernel.length; k++) {
+        sumRe += xr[k] * kr[k] - xi[k] * ki[k];
+        sumIm += xr[k] * ki[k] + xi[k] * kr[k];
+      }
+      magnitudes[bin] = std::sqrt(sumRe * sumRe + sumIm * sumIm);
+    }
+
+    if (o + 1 < numOctaves_) decimate(stage_);
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
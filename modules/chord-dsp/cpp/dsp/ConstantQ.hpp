@@ -0,0 +1,68 @@
+#pragma once
+
+#include "RealFFT.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Constant-Q transform of the latest audio using precomputed sparse spectral
+// kernels (Brown & Puckette 1992) on top of RealFFT.
+//
+// A single-FFT CQT would need an FFT longer than the lowest bin's window
+// (about 0.5 s for C1 at 12 bins per octave). Instead one octave's kernel is
+// built once for a small FFT and reused for every octave: after each octave
+// the signal is low-passed and decimated by two, which halves every
+// frequency relative to the sample rate. Input is first decimated until the
+// highest requested bin sits below a quarter of the working rate.
+class ConstantQ {
+public:
+  ConstantQ(int sampleRate, float minFreq, int binsPerOctave, int numBins);
+
+  ConstantQ(const ConstantQ&) = delete;
+  ConstantQ& operator=(const ConstantQ&) = delete;
+
+  int numBins() const { return numBins_; }
+  int binsPerOctave() const { return binsPerOctave_; }
+
+  // Source samples the lowest bin's kernel spans; shorter input is treated
+  // as preceded by silence
+  size_t windowSize() const { return windowSize_; }
+
+  // Writes numBins() magnitudes (lowest frequency first) for the most recent
+  // windowSize() samples of input
+  void compute(const float* input, size_t count, float* magnitudes);
+
+private:
+  struct Kernel {
+    int start;  // first FFT bin
+    int length; // number of contiguous bins
+    int offset; // index into kernelRe_ / kernelIm_
+  };
+
+  // Low-pass filters `buffer` and keeps every other sample, aligned so the
+  // newest input sample maps to the newest output sample
+  void decimate(std::vector<float>& buffer);
+
+  int numBins_;
+  int binsPerOctave_;
+  int numOctaves_;
+  int initialDecimations_;
+  size_t windowSize_;
+
+  std::unique_ptr<RealFFT> fft_;
+  std::vector<Kernel> kernels_; // one per bin of an octave, lowest first
+  std::vector<float> kernelRe_;
+  std::vector<float> kernelIm_;
+  std::vector<float> lowpass_;
+
+  // Scratch
+  std::vector<float> stage_;
+  std::vector<float> decimated_;
+  std::vector<float> frame_;
+  std::vector<float> re_;
+  std::vector<float> im_;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,25 @@
+#include "DSPTables.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+const MelTable* findMelTable(int numBands, int fftSize, int sampleRate, float minHz, float maxHz) {
+  for (int i = 0; i < kNumMelTables; i++) {
+    const MelTable& t = kMelTables[i];
+    if (t.numBands == numBands && t.fftSize == fftSize && t.sampleRate == sampleRate && t.minHz == minHz && t.maxHz == maxHz) {
+      return &t;
+    }
+  }
+  return nullptr;
+}
+
+const ResamplerTable* findResamplerTable(int sourceRate, int targetRate) {
+  for (int i = 0; i < kNumResamplerTables; i++) {
+    const ResamplerTable& t = kResamplerTables[i];
+    if (t.sourceRate == sourceRate && t.targetRate == targetRate) {
+      return &t;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace margelo::nitro::chorddsp
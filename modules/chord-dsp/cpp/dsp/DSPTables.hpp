@@ -0,0 +1,45 @@
+#pragma once
+
+#include "MelFilterbank.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+// Tables computed ahead of time by tools/GenerateDSPTables.cpp into
+// DSPTablesData.cpp. They are const data in the library's read-only segment,
+// which the loader maps straight from the binary: building a covered
+// MelFilterbank or PolyphaseResampler does no math and no allocation, and
+// every instance (and every process using the library) shares the same
+// pages. Configurations without a table are computed at construction as
+// before.
+
+struct MelTable {
+  int numBands;
+  int fftSize;
+  int sampleRate;
+  float minHz;
+  float maxHz;
+  const MelFilterbank::Band* bands; // numBands spans
+  const float* weights;
+  int numWeights;
+};
+
+struct ResamplerTable {
+  int sourceRate;
+  int targetRate;
+  int up;   // reduced ratio, as PolyphaseResampler computes it
+  int down;
+  int taps; // per polyphase row
+  const float* data; // up rows of taps
+};
+
+// Null when no table was generated for these parameters
+const MelTable* findMelTable(int numBands, int fftSize, int sampleRate, float minHz, float maxHz);
+const ResamplerTable* findResamplerTable(int sourceRate, int targetRate);
+
+// Defined in DSPTablesData.cpp
+extern const MelTable kMelTables[];
+extern const int kNumMelTables;
+extern const ResamplerTable kResamplerTables[];
+extern const int kNumResamplerTables;
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,2882 @@
+// Generated by tools/GenerateDSPTables.cpp, do not edit. Regenerate with
+//   cmake -S modules/chord-dsp/tools -B build/tools
+//   cmake --build build/tools --target dsp_tables
+#include "DSPTables.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// 229 mel bands, 2048-point FFT at 22050 Hz, 30-11025 Hz
+const MelFilterbank::Band kMelBands[] = {
+    {3, 2, 0},
+    {4, 2, 2},
+    {5, 2, 4},
+    {6, 2, 6},
+    {7, 1, 8},
+    {8, 1, 9},
+    {8, 2, 10},
+    {9, 2, 12},
+    {10, 2, 14},
+    {11, 2, 16},
+    {12, 2, 18},
+    {13, 2, 20},
+    {14, 2, 22},
+    {15, 2, 24},
+    {16, 2, 26},
+    {17, 2, 28},
+    {18, 2, 30},
+    {19, 2, 32},
+    {20, 2, 34},
+    {21, 2, 36},
+    {22, 2, 38},
+    {23, 2, 40},
+    {24, 2, 42},
+    {25, 2, 44},
+    {26, 2, 46},
+    {27, 2, 48},
+    {28, 3, 50},
+    {29, 3, 53},
+    {31, 2, 56},
+    {32, 2, 58},
+    {33, 2, 60},
+    {34, 2, 62},
+    {35, 3, 64},
+    {36, 3, 67},
+    {38, 2, 70},
+    {39, 2, 72},
+    {40, 3, 74},
+    {41, 3, 77},
+    {43, 2, 80},
+    {44, 3, 82},
+    {45, 3, 85},
+    {47, 2, 88},
+    {48, 3, 90},
+    {49, 3, 93},
+    {51, 3, 96},
+    {52, 3, 99},
+    {54, 3, 102},
+    {55, 3, 105},
+    {57, 2, 108},
+    {58, 3, 110},
+    {59, 3, 113},
+    {61, 3, 116},
+    {62, 4, 119},
+    {64, 3, 123},
+    {66, 3, 126},
+    {67, 3, 129},
+    {69, 3, 132},
+    {70, 4, 135},
+    {72, 3, 139},
+    {74, 3, 142},
+    {75, 4, 145},
+    {77, 4, 149},
+    {79, 3, 153},
+    {81, 3, 156},
+    {82, 4, 159},
+    {84, 4, 163},
+    {86, 4, 167},
+    {88, 3, 171},
+    {90, 3, 174},
+    {91, 4, 177},
+    {93, 4, 181},
+    {95, 4, 185},
+    {97, 4, 189},
+    {99, 4, 193},
+    {101, 4, 197},
+    {103, 4, 201},
+    {105, 4, 205},
+    {107, 4, 209},
+    {109, 5, 213},
+    {111, 5, 218},
+    {114, 4, 223},
+    {116, 4, 227},
+    {118, 4, 231},
+    {120, 5, 235},
+    {122, 5, 240},
+    {125, 4, 245},
+    {127, 5, 249},
+    {129, 5, 254},
+    {132, 4, 259},
+    {134, 5, 263},
+    {136, 5, 268},
+    {139, 5, 273},
+    {141, 5, 278},
+    {144, 5, 283},
+    {146, 6, 288},
+    {149, 5, 294},
+    {152, 5, 299},
+    {154, 5, 304},
+    {157, 5, 309},
+    {159, 6, 314},
+    {162, 6, 320},
+    {165, 6, 326},
+    {168, 5, 332},
+    {171, 5, 337},
+    {173, 6, 342},
+    {176, 6, 348},
+    {179, 6, 354},
+    {182, 6, 360},
+    {185, 6, 366},
+    {188, 6, 372},
+    {191, 7, 378},
+    {194, 7, 385},
+    {198, 6, 392},
+    {201, 6, 398},
+    {204, 7, 404},
+    {207, 7, 411},
+    {211, 6, 418},
+    {214, 7, 424},
+    {217, 7, 431},
+    {221, 7, 438},
+    {224, 7, 445},
+    {228, 7, 452},
+    {231, 7, 459},
+    {235, 7, 466},
+    {238, 8, 473},
+    {242, 8, 481},
+    {246, 7, 489},
+    {250, 7, 496},
+    {253, 8, 503},
+    {257, 8, 511},
+    {261, 8, 519},
+    {265, 8, 527},
+    {269, 8, 535},
+    {273, 8, 543},
+    {277, 9, 551},
+    {281, 9, 560},
+    {286, 8, 569},
+    {290, 9, 577},
+    {294, 9, 586},
+    {299, 8, 595},
+    {303, 9, 603},
+    {307, 9, 612},
+    {312, 9, 621},
+    {316, 10, 630},
+    {321, 10, 640},
+    {326, 9, 650},
+    {331, 9, 659},
+    {335, 10, 668},
+    {340, 10, 678},
+    {345, 10, 688},
+    {350, 10, 698},
+    {355, 10, 708},
+    {360, 11, 718},
+    {365, 11, 729},
+    {371, 10, 740},
+    {376, 11, 750},
+    {381, 11, 761},
+    {387, 11, 772},
+    {392, 11, 783},
+    {398, 11, 794},
+    {403, 12, 805},
+    {409, 12, 817},
+    {415, 11, 829},
+    {421, 11, 840},
+    {426, 12, 851},
+    {432, 13, 863},
+    {438, 13, 876},
+    {445, 12, 889},
+    {451, 12, 901},
+    {457, 13, 913},
+    {463, 13, 926},
+    {470, 13, 939},
+    {476, 13, 952},
+    {483, 13, 965},
+    {489, 14, 978},
+    {496, 14, 992},
+    {503, 14, 1006},
+    {510, 14, 1020},
+    {517, 14, 1034},
+    {524, 14, 1048},
+    {531, 15, 1062},
+    {538, 15, 1077},
+    {546, 14, 1092},
+    {553, 15, 1106},
+    {560, 16, 1121},
+    {568, 16, 1137},
+    {576, 15, 1153},
+    {584, 15, 1168},
+    {591, 16, 1183},
+    {599, 17, 1199},
+    {607, 17, 1216},
+    {616, 16, 1233},
+    {624, 17, 1249},
+    {632, 17, 1266},
+    {641, 17, 1283},
+    {649, 18, 1300},
+    {658, 18, 1318},
+    {667, 18, 1336},
+    {676, 18, 1354},
+    {685, 18, 1372},
+    {694, 18, 1390},
+    {703, 19, 1408},
+    {712, 19, 1427},
+    {722, 19, 1446},
+    {731, 20, 1465},
+    {741, 19, 1485},
+    {751, 20, 1504},
+    {760, 21, 1524},
+    {771, 20, 1545},
+    {781, 20, 1565},
+    {791, 21, 1585},
+    {801, 21, 1606},
+    {812, 21, 1627},
+    {822, 22, 1648},
+    {833, 22, 1670},
+    {844, 22, 1692},
+    {855, 23, 1714},
+    {866, 23, 1737},
+    {878, 23, 1760},
+    {889, 23, 1783},
+    {901, 23, 1806},
+    {912, 24, 1829},
+    {924, 24, 1853},
+    {936, 25, 1877},
+    {948, 25, 1902},
+    {961, 25, 1927},
+    {973, 26, 1952},
+    {986, 25, 1978},
+    {999, 25, 2003},
+};
+
+alignas(16) const float kMelWeights[] = {
+    0.259407789f, 0.531846225f, 0.468153805f, 0.340006739f, 0.659993291f, 0.16468747f, 0.835312545f, 0.00553329708f,
+    0.994466722f, 0.863818765f, 0.136181265f, 0.737427354f, 0.262572616f, 0.625945449f, 0.374054521f, 0.529032648f,
+    0.470967323f, 0.446352184f, 0.553647816f, 0.377576739f, 0.622423291f, 0.322386652f, 0.677613378f, 0.280470192f,
+    0.719529808f, 0.25150454f, 0.74849546f, 0.235195547f, 0.764804423f, 0.231241465f, 0.768758535f, 0.239345431f,
+    0.760654569f, 0.25922516f, 0.74077487f, 0.290590554f, 0.709409416f, 0.33316049f, 0.66683954f, 0.386670381f,
+    0.613329589f, 0.45084843f, 0.54915154f, 0.525424361f, 0.474575639f, 0.610147059f, 0.389852941f, 0.704764009f,
+    0.295235991f, 0.809014559f, 0.190985426f, 0.92266506f, 0.0460187159f, 0.0773349181f, 0.95398128f, 0.179342732f,
+    0.820657253f, 0.321458131f, 0.678541899f, 0.47213766f, 0.52786237f, 0.631153107f, 0.368846864f, 0.798282325f,
+    0.20171769f, 0.97331208f, 0.15791896f, 0.0266879015f, 0.84208101f, 0.350413948f, 0.649586022f, 0.55026567f,
+    0.44973433f, 0.757268667f, 0.242731318f, 0.971220911f, 0.19426316f, 0.028779069f, 0.80573684f, 0.42429781f,
+    0.57570219f, 0.6607849f, 0.3392151f, 0.903535366f, 0.154205665f, 0.0964646488f, 0.84579432f, 0.412019044f,
+    0.587980926f, 0.675627053f, 0.324372977f, 0.944853187f, 0.222177804f, 0.0551467836f, 0.777822196f, 0.505511403f,
+    0.494488627f, 0.794010818f, 0.0885678753f, 0.205989197f, 0.911432147f, 0.390538186f, 0.609461844f, 0.697247326f,
+    0.0086396439f, 0.302752644f, 0.991360366f, 0.32818681f, 0.67181319f, 0.652068138f, 0.347931892f, 0.980132937f,
+    0.316013217f, 0.0198670458f, 0.683986783f, 0.656071424f, 0.343928576f, 0.999923348f, 0.351650566f, 7.66618905e-05f,
+    0.648349404f, 0.706935585f, 0.0664383024f, 0.293064445f, 0.933561683f, 0.432831079f, 0.567168951f, 0.802419364f,
+    0.177198157f, 0.197580621f, 0.822801828f, 0.55735898f, 0.44264102f, 0.940371752f, 0.330064625f, 0.0596282445f,
+    0.669935346f, 0.723122358f, 0.12014316f, 0.276877642f, 0.879856825f, 0.522957623f, 0.477042377f, 0.928086758f,
+    0.339488506f, 0.0719132423f, 0.660511494f, 0.753879964f, 0.172345713f, 0.246120065f, 0.827654302f, 0.595720828f,
+    0.0211636499f, 0.404279202f, 0.978836358f, 0.453245372f, 0.546754599f, 0.886953831f, 0.326100439f, 0.113046154f,
+    0.673899531f, 0.768065572f, 0.213946f, 0.231934428f, 0.786054015f, 0.663907111f, 0.116434783f, 0.33609286f,
+    0.883565247f, 0.574129879f, 0.033220809f, 0.42587015f, 0.966779172f, 0.498409867f, 0.501590133f, 0.964430034f,
+    0.436431229f, 0.0355699845f, 0.563568771f, 0.909530163f, 0.387860924f, 0.0904698446f, 0.612139046f, 0.86779809f,
+    0.352391601f, 0.132201895f, 0.647608399f, 0.838940799f, 0.329717636f, 0.161059231f, 0.670282364f, 0.822647035f,
+    0.319530159f, 0.17735298f, 0.680469811f, 0.818618953f, 0.321546674f, 0.181381032f, 0.678453326f, 0.826577663f,
+    0.335461587f, 0.173422366f, 0.664538443f, 0.846215904f, 0.361001283f, 0.153784081f, 0.638998687f, 0.877276361f,
+    0.397880852f, 0.122723669f, 0.602119148f, 0.919463873f, 0.445823222f, 0.0805361122f, 0.554176748f, 0.97251606f,
+    0.504553854f, 0.0365916789f, 0.0274839252f, 0.495446116f, 0.963408291f, 0.573804557f, 0.111456409f, 0.426195443f,
+    0.888543606f, 0.653319895f, 0.196521178f, 0.346680105f, 0.803478837f, 0.74284482f, 0.291526079f, 0.25715515f,
+    0.708473921f, 0.842125654f, 0.396225184f, 0.157874331f, 0.603774786f, 0.950920641f, 0.510369122f, 0.069817625f,
+    0.0490793847f, 0.489630878f, 0.930182397f, 0.633716643f, 0.198453844f, 0.366283327f, 0.801546156f, 0.766030073f,
+    0.335985452f, 0.233969957f, 0.664014518f, 0.907069921f, 0.48218742f, 0.0573049374f, 0.0929300785f, 0.51781255f,
+    0.942695081f, 0.636834741f, 0.21705237f, 0.363165289f, 0.7829476f, 0.799700022f, 0.384949327f, 0.200299978f,
+    0.615050673f, 0.970556617f, 0.560787559f, 0.151018545f, 0.0294433963f, 0.439212412f, 0.84898144f, 0.744348943f,
+    0.339488357f, 0.255651027f, 0.660511613f, 0.935413778f, 0.535421133f, 0.135428429f, 0.0645862222f, 0.464578897f,
+    0.864571571f, 0.738608956f, 0.34341383f, 0.261391044f, 0.65658617f, 0.948839068f, 0.558378935f, 0.167918831f,
+    0.0511609055f, 0.441621035f, 0.832081199f, 0.780131042f, 0.394359648f, 0.00858826376f, 0.219868973f, 0.605640352f,
+    0.991411746f, 0.627346635f, 0.246208161f, 0.372653365f, 0.753791869f, 0.866687715f, 0.490119815f, 0.11355187f,
+    0.13331227f, 0.509880185f, 0.886448145f, 0.740140438f, 0.368091792f, 0.259859562f, 0.631908238f, 0.996090591f,
+    0.628507674f, 0.260924667f, 0.00390938297f, 0.371492356f, 0.739075303f, 0.89462018f, 0.531443238f, 0.168266356f,
+    0.105379827f, 0.468556732f, 0.831733644f, 0.807428658f, 0.448610425f, 0.0897921622f, 0.192571342f, 0.551389575f,
+    0.910207808f, 0.734201729f, 0.379688621f, 0.0251755361f, 0.265798271f, 0.620311379f, 0.974824488f, 0.674617469f,
+    0.324361742f, 0.325382531f, 0.675638258f, 0.974416494f, 0.628360987f, 0.282305419f, 0.0255834833f, 0.371639043f,
+    0.717694581f, 0.937014163f, 0.595107436f, 0.25320068f, 0.0629858375f, 0.404892594f, 0.74679929f, 0.912360191f,
+    0.574563146f, 0.236766145f, 0.0876398161f, 0.425436825f, 0.76323384f, 0.90018028f, 0.566432774f, 0.232685223f,
+    0.0998197198f, 0.433567256f, 0.767314792f, 0.900150955f, 0.570410073f, 0.240669176f, 0.0998490602f, 0.429589927f,
+    0.759330809f, 0.911996305f, 0.586209118f, 0.260421962f, 0.088003695f, 0.413790882f, 0.739578068f, 0.935418427f,
+    0.613537133f, 0.291655809f, 0.0645815656f, 0.386462867f, 0.708344162f, 0.970137835f, 0.652125359f, 0.334112972f,
+    0.0161005426f, 0.0298621897f, 0.347874612f, 0.665887058f, 0.983899474f, 0.701706767f, 0.387505978f, 0.0733052045f,
+    0.298293233f, 0.612493992f, 0.92669481f, 0.761995912f, 0.451566458f, 0.141137019f, 0.238004118f, 0.548433542f,
+    0.858862996f, 0.832738996f, 0.526034474f, 0.219330013f, 0.167261019f, 0.473965496f, 0.780669987f, 0.91367352f,
+    0.610647678f, 0.307621896f, 0.00459606433f, 0.0863264799f, 0.389352292f, 0.692378104f, 0.995403945f, 0.70515573f,
+    0.40577063f, 0.106385507f, 0.29484427f, 0.5942294f, 0.893614471f, 0.809314013f, 0.513517916f, 0.217721775f,
+    0.190685958f, 0.486482084f, 0.78227824f, 0.92286253f, 0.63061595f, 0.338369399f, 0.0461228378f, 0.0771374702f,
+    0.369384021f, 0.661630571f, 0.953877151f, 0.756830096f, 0.468090922f, 0.179351732f, 0.243169889f, 0.531909108f,
+    0.820648253f, 0.891923904f, 0.606646121f, 0.321368396f, 0.0360906646f, 0.10807611f, 0.39335385f, 0.678631604f,
+    0.963909328f, 0.75380826f, 0.471959651f, 0.190111041f, 0.246191755f, 0.528040349f, 0.809888959f, 0.90936172f,
+    0.630890369f, 0.352419019f, 0.0739477053f, 0.0906383023f, 0.369109631f, 0.647580981f, 0.926052272f, 0.797932029f,
+    0.522804201f, 0.247676343f, 0.202067986f, 0.477195829f, 0.752323687f, 0.972877562f, 0.701047719f, 0.429217905f,
+    0.157388046f, 0.0271224268f, 0.298952281f, 0.570782125f, 0.842611969f, 0.886930943f, 0.618361712f, 0.349792421f,
+    0.0812231824f, 0.113069065f, 0.381638318f, 0.650207579f, 0.91877681f, 0.814905226f, 0.549563348f, 0.284221441f,
+    0.0188795365f, 0.185094759f, 0.450436652f, 0.715778589f, 0.981120467f, 0.756490469f, 0.494327605f, 0.232164711f,
+    0.243509531f, 0.505672395f, 0.767835259f, 0.970362127f, 0.711348057f, 0.452333987f, 0.193319917f, 0.0296378564f,
+    0.288651943f, 0.547666013f, 0.806680083f, 0.935094655f, 0.679190636f, 0.423286587f, 0.167382538f, 0.0649053454f,
+    0.320809394f, 0.576713443f, 0.832617462f, 0.912539244f, 0.659701705f, 0.406864136f, 0.154026583f, 0.0874607414f,
+    0.340298295f, 0.593135834f, 0.845973432f, 0.90237546f, 0.652573645f, 0.40277186f, 0.152970061f, 0.0976245627f,
+    0.347426355f, 0.597228169f, 0.847029924f, 0.904330075f, 0.65752548f, 0.410720885f, 0.163916275f, 0.0956699252f,
+    0.34247452f, 0.589279115f, 0.83608371f, 0.918106616f, 0.674264431f, 0.430422217f, 0.186580047f, 0.0818934068f,
+    0.325735599f, 0.569577754f, 0.813419938f, 0.94342494f, 0.702508569f, 0.461592197f, 0.220675811f, 0.0565750599f,
+    0.297491431f, 0.538407803f, 0.779324174f, 0.980001867f, 0.741971314f, 0.503940761f, 0.265910238f, 0.0278796777f,
+    0.0199981108f, 0.258028656f, 0.496059209f, 0.734089792f, 0.972120345f, 0.792373896f, 0.557203054f, 0.322032183f,
+    0.0868613496f, 0.207626119f, 0.442796946f, 0.677967787f, 0.913138628f, 0.853470922f, 0.621123195f, 0.388775438f,
+    0.156427711f, 0.146529108f, 0.378876835f, 0.611224592f, 0.843572319f, 0.924990535f, 0.695429504f, 0.465868503f,
+    0.236307457f, 0.0067464374f, 0.0750094578f, 0.304570496f, 0.534131527f, 0.763692558f, 0.993253589f, 0.779859602f,
+    0.553053796f, 0.32624796f, 0.0994421244f, 0.220140368f, 0.446946204f, 0.673752069f, 0.900557876f, 0.874163985f,
+    0.650078654f, 0.425993294f, 0.201907948f, 0.125836015f, 0.349921346f, 0.574006677f, 0.798092067f, 0.978088737f,
+    0.75669229f, 0.535295844f, 0.313899428f, 0.0925030038f, 0.0219112746f, 0.24330771f, 0.464704126f, 0.686100543f,
+    0.907496989f, 0.872652769f, 0.653912127f, 0.435171515f, 0.216430917f, 0.127347246f, 0.346087873f, 0.564828455f,
+    0.783569098f, 0.997718036f, 0.781603038f, 0.5654881f, 0.349373102f, 0.133258149f, 0.0022819757f, 0.218396947f,
+    0.4345119f, 0.650626898f, 0.866741836f, 0.91813767f, 0.704616666f, 0.491095692f, 0.277574688f, 0.0640536919f,
+    0.0818623155f, 0.295383304f, 0.508904338f, 0.722425282f, 0.935946286f, 0.852324426f, 0.641363084f, 0.430401683f,
+    0.219440281f, 0.00847888645f, 0.147675544f, 0.358636945f, 0.569598317f, 0.780559719f, 0.99152112f, 0.799945295f,
+    0.591513395f, 0.383081436f, 0.174649522f, 0.200054705f, 0.408486634f, 0.616918564f, 0.825350463f, 0.966623485f,
+    0.760696054f, 0.554768622f, 0.348841161f, 0.142913699f, 0.0333764851f, 0.239303946f, 0.445231378f, 0.651158869f,
+    0.857086301f, 0.937742949f, 0.734288275f, 0.530833602f, 0.327378958f, 0.1239243f, 0.0622570738f, 0.265711725f,
+    0.469166398f, 0.672621071f, 0.876075685f, 0.921422958f, 0.720407069f, 0.519391239f, 0.318375349f, 0.117359459f,
+    0.0785770342f, 0.279592901f, 0.480608791f, 0.681624651f, 0.882640541f, 0.917346001f, 0.718738854f, 0.520131648f,
+    0.321524471f, 0.122917287f, 0.0826539919f, 0.281261176f, 0.479868352f, 0.678475559f, 0.877082705f, 0.925219774f,
+    0.728999496f, 0.532779217f, 0.336558968f, 0.140338689f, 0.0747802332f, 0.271000504f, 0.467220783f, 0.663441062f,
+    0.859661281f, 0.944788933f, 0.750922918f, 0.557056963f, 0.363191038f, 0.169325069f, 0.0552110933f, 0.249077052f,
+    0.442943007f, 0.636808991f, 0.830674946f, 0.975753725f, 0.784215391f, 0.592676997f, 0.401138663f, 0.2096003f,
+    0.0180619359f, 0.0242462493f, 0.215784609f, 0.407322973f, 0.598861337f, 0.79039973f, 0.981938064f, 0.828603446f,
+    0.639361501f, 0.450119555f, 0.260877609f, 0.0716356561f, 0.171396554f, 0.360638499f, 0.549880445f, 0.739122391f,
+    0.928364336f, 0.883805573f, 0.696835518f, 0.509865463f, 0.322895378f, 0.135925323f, 0.116194412f, 0.303164482f,
+    0.490134537f, 0.677104592f, 0.864074707f, 0.949567318f, 0.764839172f, 0.580111086f, 0.395382911f, 0.210654795f,
+    0.025926657f, 0.0504326746f, 0.235160813f, 0.419888943f, 0.604617059f, 0.789345205f, 0.97407335f, 0.843105495f,
+    0.660595655f, 0.478085786f, 0.295575947f, 0.1130661f, 0.15689452f, 0.339404374f, 0.521914244f, 0.704424083f,
+    0.886933923f, 0.931388557f, 0.751066208f, 0.570743859f, 0.39042148f, 0.210099116f, 0.0297767427f, 0.0686114281f,
+    0.248933792f, 0.429256171f, 0.60957855f, 0.789900899f, 0.970223248f, 0.851261616f, 0.673103988f, 0.494946361f,
+    0.316788733f, 0.138631091f, 0.148738354f, 0.326895982f, 0.505053639f, 0.683211267f, 0.861368895f, 0.960947573f,
+    0.784926951f, 0.608906329f, 0.432885677f, 0.256865054f, 0.0808444321f, 0.0390524268f, 0.215073049f, 0.391093671f,
+    0.567114294f, 0.743134916f, 0.919155538f, 0.905965924f, 0.732057452f, 0.55814904f, 0.384240597f, 0.210332185f,
+    0.0364237539f, 0.0940341055f, 0.267942548f, 0.44185096f, 0.615759373f, 0.789667845f, 0.963576257f, 0.86416477f,
+    0.692342758f, 0.520520806f, 0.348698795f, 0.176876813f, 0.00505482173f, 0.13583523f, 0.307657212f, 0.479479194f,
+    0.651301205f, 0.823123217f, 0.994945168f, 0.835235476f, 0.665476859f, 0.495718211f, 0.325959593f, 0.156200945f,
+    0.164764509f, 0.334523141f, 0.504281759f, 0.674040437f, 0.843799055f, 0.986604929f, 0.818882108f, 0.651159346f,
+    0.483436555f, 0.315713763f, 0.147990987f, 0.0133950962f, 0.181117877f, 0.348840654f, 0.516563416f, 0.684286237f,
+    0.852008998f, 0.980504811f, 0.81479311f, 0.649081349f, 0.483369648f, 0.317657948f, 0.151946232f, 0.0194951985f,
+    0.185206905f, 0.350918621f, 0.516630352f, 0.682342052f, 0.848053753f, 0.98639977f, 0.822677672f, 0.658955574f,
+    0.495233446f, 0.331511319f, 0.167789191f, 0.00406707171f, 0.0136002079f, 0.177322328f, 0.341044456f, 0.504766583f,
+    0.668488681f, 0.832210779f, 0.995932937f, 0.842261672f, 0.680505097f, 0.518748522f, 0.356991947f, 0.195235372f,
+    0.0334787928f, 0.157738328f, 0.319494903f, 0.481251478f, 0.643008053f, 0.804764628f, 0.966521204f, 0.873261929f,
+    0.713446856f, 0.553631783f, 0.393816739f, 0.234001666f, 0.0741866082f, 0.126738101f, 0.286553144f, 0.446368217f,
+    0.60618329f, 0.765998304f, 0.925813377f, 0.915398121f, 0.757499099f, 0.599600077f, 0.441700995f, 0.283801943f,
+    0.125902906f, 0.0846018568f, 0.242500901f, 0.400399953f, 0.558299005f, 0.716198027f, 0.874097109f, 0.9683882f,
+    0.812385738f, 0.656383276f, 0.500380874f, 0.344378442f, 0.188375995f, 0.0323735513f, 0.0316118225f, 0.187614262f,
+    0.343616694f, 0.499619126f, 0.655621588f, 0.811623991f, 0.967626452f, 0.877852857f, 0.723720133f, 0.569587409f,
+    0.415454656f, 0.261321932f, 0.107189223f, 0.122147173f, 0.276279896f, 0.43041262f, 0.584545314f, 0.738678038f,
+    0.892810762f, 0.953620195f, 0.801338434f, 0.649056613f, 0.496774793f, 0.344492972f, 0.192211166f, 0.0399293602f,
+    0.0463797748f, 0.198661581f, 0.350943387f, 0.503225207f, 0.655507028f, 0.807788849f, 0.96007061f, 0.888992429f,
+    0.738533497f, 0.588074565f, 0.437615663f, 0.287156731f, 0.136697784f, 0.111007541f, 0.261466473f, 0.411925405f,
+    0.562384367f, 0.712843299f, 0.863302231f, 0.986404359f, 0.837754846f, 0.689105332f, 0.540455818f, 0.391806304f,
+    0.243156806f, 0.0945072994f, 0.0135956593f, 0.162245169f, 0.310894668f, 0.459544182f, 0.608193696f, 0.756843209f,
+    0.905492723f, 0.946507156f, 0.799640536f, 0.652773917f, 0.505907297f, 0.359040678f, 0.212174043f, 0.0653074235f,
+    0.0534928329f, 0.200359464f, 0.347226083f, 0.494092703f, 0.640959322f, 0.787825942f, 0.934692562f, 0.919419169f,
+    0.774314404f, 0.629209578f, 0.484104812f, 0.339000016f, 0.193895221f, 0.0487904251f, 0.0805808082f, 0.225685596f,
+    0.370790392f, 0.515895188f, 0.661000013f, 0.806104779f, 0.951209605f, 0.904842317f, 0.761480153f, 0.618118048f,
+    0.474755883f, 0.331393719f, 0.188031569f, 0.0446694195f, 0.0951576754f, 0.238519832f, 0.381881982f, 0.525244117f,
+    0.668606281f, 0.811968446f, 0.955330551f, 0.902489007f, 0.760843456f, 0.619197905f, 0.477552325f, 0.335906774f,
+    0.194261208f, 0.0526156537f, 0.0975110009f, 0.239156559f, 0.380802125f, 0.522447646f, 0.664093256f, 0.805738807f,
+    0.947384357f, 0.91204232f, 0.772102594f, 0.632162869f, 0.492223203f, 0.352283508f, 0.212343797f, 0.0724041015f,
+    0.0879577026f, 0.227897406f, 0.367837101f, 0.507776797f, 0.647716522f, 0.787656188f, 0.927595913f, 0.933270872f,
+    0.795002282f, 0.656733692f, 0.518465042f, 0.380196452f, 0.241927862f, 0.103659257f, 0.0667291135f, 0.204997718f,
+    0.343266338f, 0.481534928f, 0.619803548f, 0.758072138f, 0.896340728f, 0.965807915f, 0.829206288f, 0.692604661f,
+    0.556002975f, 0.419401377f, 0.282799721f, 0.146198094f, 0.00959646516f, 0.0341920964f, 0.170793727f, 0.307395369f,
+    0.443996996f, 0.580598652f, 0.717200279f, 0.853801906f, 0.990403533f, 0.874512911f, 0.739544094f, 0.604575276f,
+    0.469606489f, 0.334637672f, 0.19966884f, 0.0647000223f, 0.125487059f, 0.260455877f, 0.395424694f, 0.530393541f,
+    0.665362358f, 0.800331175f, 0.935299993f, 0.930574775f, 0.79722625f, 0.663877726f, 0.530529201f, 0.397180676f,
+    0.263832152f, 0.130483612f, 0.0694252253f, 0.20277375f, 0.336122274f, 0.469470799f, 0.602819324f, 0.736167848f,
+    0.869516373f, 0.997169554f, 0.865426183f, 0.733682871f, 0.601939499f, 0.470196128f, 0.338452756f, 0.206709385f,
+    0.0749660283f, 0.00283042388f, 0.134573787f, 0.266317159f, 0.39806053f, 0.529803872f, 0.661547244f, 0.793290615f,
+    0.925033987f, 0.943901539f, 0.813733459f, 0.683565319f, 0.553397238f, 0.423229098f, 0.293060988f, 0.162892878f,
+    0.0327247605f, 0.0560984537f, 0.186266571f, 0.316434681f, 0.446602792f, 0.576770902f, 0.706939042f, 0.837107122f,
+    0.967275262f, 0.903729141f, 0.775127351f, 0.646525562f, 0.517923713f, 0.389321893f, 0.260720074f, 0.13211827f,
+    0.00351645588f, 0.0962708294f, 0.224872649f, 0.353474468f, 0.482076287f, 0.610678077f, 0.739279926f, 0.867881715f,
+    0.996483564f, 0.876409531f, 0.749344647f, 0.622279763f, 0.495214909f, 0.368150026f, 0.241085142f, 0.114020258f,
+    0.123590454f, 0.250655323f, 0.377720207f, 0.50478512f, 0.631850004f, 0.758914888f, 0.885979772f, 0.987112284f,
+    0.861575961f, 0.736039579f, 0.610503256f, 0.484966904f, 0.359430552f, 0.233894199f, 0.108357854f, 0.0128877042f,
+    0.138424054f, 0.263960391f, 0.389496744f, 0.515033126f, 0.640569448f, 0.766105771f, 0.891642153f, 0.983027756f,
+    0.858998597f, 0.734969497f, 0.610940337f, 0.486911237f, 0.362882107f, 0.238852978f, 0.114823841f, 0.0169722475f,
+    0.141001374f, 0.265030503f, 0.389059633f, 0.513088763f, 0.637117922f, 0.761147022f, 0.885176182f, 0.990905106f,
+    0.868362963f, 0.74582088f, 0.623278797f, 0.500736713f, 0.37819463f, 0.255652547f, 0.133110449f, 0.010568358f,
+    0.00909492094f, 0.131637007f, 0.25417909f, 0.376721203f, 0.499263287f, 0.62180537f, 0.744347453f, 0.866889536f,
+    0.98943162f, 0.88936758f, 0.768293381f, 0.647219241f, 0.526145041f, 0.405070871f, 0.283996701f, 0.162922516f,
+    0.0418483317f, 0.11063242f, 0.231706589f, 0.352780789f, 0.473854959f, 0.594929159f, 0.716003299f, 0.837077498f,
+    0.958151639f, 0.921729088f, 0.802114308f, 0.682499468f, 0.562884629f, 0.443269849f, 0.323655039f, 0.204040214f,
+    0.0844253972f, 0.0782708973f, 0.197885722f, 0.317500532f, 0.437115341f, 0.556730151f, 0.676344991f, 0.795959771f,
+    0.91557461f, 0.965230942f, 0.847045004f, 0.728859067f, 0.61067307f, 0.492487133f, 0.374301195f, 0.256115258f,
+    0.137929291f, 0.0197433438f, 0.0347690582f, 0.152955011f, 0.271140963f, 0.3893269f, 0.507512867f, 0.625698805f,
+    0.743884742f, 0.86207068f, 0.980256677f, 0.902742326f, 0.785978973f, 0.66921562f, 0.552452266f, 0.435688943f,
+    0.318925589f, 0.202162236f, 0.0853988826f, 0.0972576588f, 0.214021012f, 0.330784351f, 0.447547704f, 0.564311087f,
+    0.68107444f, 0.797837794f, 0.914601147f, 0.96901077f, 0.853644311f, 0.738277793f, 0.622911334f, 0.507544875f,
+    0.392178386f, 0.276811928f, 0.161445454f, 0.0460789911f, 0.0309892483f, 0.146355718f, 0.261722177f, 0.377088666f,
+    0.492455125f, 0.607821584f, 0.723188043f, 0.838554561f, 0.95392102f, 0.931544006f, 0.817562044f, 0.703580022f,
+    0.589598f, 0.475616038f, 0.361634046f, 0.247652039f, 0.133670047f, 0.0196880531f, 0.0684559867f, 0.182437986f,
+    0.296419978f, 0.41040197f, 0.524383962f, 0.638365984f, 0.752347946f, 0.866329968f, 0.98031193f, 0.906841516f,
+    0.79423207f, 0.681622624f, 0.569013178f, 0.456403702f, 0.343794256f, 0.231184795f, 0.118575335f, 0.00596588198f,
+    0.0931584835f, 0.20576793f, 0.318377376f, 0.430986851f, 0.543596327f, 0.656205773f, 0.768815219f, 0.881424665f,
+    0.994034111f, 0.894631028f, 0.783367515f, 0.672104001f, 0.560840428f, 0.449576914f, 0.338313401f, 0.227049857f,
+    0.115786329f, 0.00452279719f, 0.105368957f, 0.216632485f, 0.327896029f, 0.439159542f, 0.550423086f, 0.661686599f,
+    0.772950113f, 0.884213686f, 0.9954772f, 0.894545436f, 0.78462261f, 0.674699783f, 0.564776897f, 0.454854071f,
+    0.344931245f, 0.235008389f, 0.125085548f, 0.0151626971f, 0.105454542f, 0.21537739f, 0.325300246f, 0.435223073f,
+    0.545145929f, 0.655068755f, 0.764991641f, 0.874914467f, 0.984837294f, 0.906371176f, 0.797760725f, 0.689150214f,
+    0.580539763f, 0.471929252f, 0.363318771f, 0.25470829f, 0.146097809f, 0.0374873206f, 0.0936288089f, 0.20223929f,
+    0.310849786f, 0.419460267f, 0.528070748f, 0.636681199f, 0.74529171f, 0.853902221f, 0.962512672f, 0.929732502f,
+    0.822428763f, 0.715124965f, 0.607821167f, 0.500517368f, 0.3932136f, 0.285909832f, 0.178606048f, 0.0713022649f,
+    0.0702674761f, 0.177571252f, 0.284875035f, 0.392178833f, 0.499482602f, 0.60678637f, 0.714090168f, 0.821393967f,
+    0.928697765f, 0.96443063f, 0.858414829f, 0.752399027f, 0.646383226f, 0.540367424f, 0.434351593f, 0.328335792f,
+    0.222320005f, 0.116304196f, 0.0102883987f, 0.0355693884f, 0.141585186f, 0.247600988f, 0.353616804f, 0.459632605f,
+    0.565648377f, 0.671664178f, 0.77767998f, 0.883695781f, 0.989711583f, 0.905420721f, 0.800676405f, 0.69593209f,
+    0.591187775f, 0.48644346f, 0.381699145f, 0.276954859f, 0.172210544f, 0.0674662292f, 0.0945793018f, 0.199323609f,
+    0.30406791f, 0.408812225f, 0.51355654f, 0.618300855f, 0.72304517f, 0.827789485f, 0.932533801f, 0.963169277f,
+    0.859682024f, 0.75619477f, 0.652707517f, 0.549220264f, 0.445732981f, 0.342245728f, 0.23875846f, 0.135271192f,
+    0.031783931f, 0.0368307009f, 0.140317962f, 0.24380523f, 0.347292483f, 0.450779766f, 0.554266989f, 0.657754302f,
+    0.761241555f, 0.864728808f, 0.968216062f, 0.929155409f, 0.826907456f, 0.724659562f, 0.622411668f, 0.520163774f,
+    0.417915851f, 0.315667957f, 0.213420033f, 0.111172132f, 0.00892422535f, 0.0708446205f, 0.173092529f, 0.275340438f,
+    0.377588332f, 0.479836255f, 0.582084179f, 0.684332073f, 0.786579967f, 0.88882786f, 0.991075754f, 0.90779835f,
+    0.806779802f, 0.705761194f, 0.604742646f, 0.503724098f, 0.402705491f, 0.301686943f, 0.200668365f, 0.0996497869f,
+    0.0922016427f, 0.193220213f, 0.294238776f, 0.395257354f, 0.496275932f, 0.597294509f, 0.698313057f, 0.799331665f,
+    0.900350213f, 0.99864763f, 0.898840725f, 0.79903388f, 0.699226975f, 0.599420071f, 0.499613166f, 0.399806291f,
+    0.299999386f, 0.200192496f, 0.100385606f, 0.000578714302f, 0.00135236385f, 0.10115926f, 0.20096615f, 0.300773054f,
+    0.400579929f, 0.500386834f, 0.600193739f, 0.700000584f, 0.799807489f, 0.899614394f, 0.999421299f, 0.901962698f,
+    0.803353548f, 0.704744458f, 0.606135368f, 0.507526278f, 0.408917189f, 0.310308099f, 0.211698994f, 0.113089897f,
+    0.0144808032f, 0.0980373248f, 0.196646422f, 0.295255512f, 0.393864632f, 0.492473722f, 0.591082811f, 0.689691901f,
+    0.788300991f, 0.886910081f, 0.985519171f, 0.916881204f, 0.819455445f, 0.722029626f, 0.624603808f, 0.527177989f,
+    0.429752201f, 0.332326412f, 0.234900609f, 0.137474805f, 0.0400489978f, 0.0831187665f, 0.18054457f, 0.277970374f,
+    0.375396192f, 0.472821981f, 0.570247769f, 0.667673588f, 0.765099406f, 0.862525225f, 0.959950984f, 0.943311512f,
+    0.847054541f, 0.75079751f, 0.654540539f, 0.558283567f, 0.462026536f, 0.365769535f, 0.269512534f, 0.173255548f,
+    0.0769985467f, 0.0566884615f, 0.152945459f, 0.24920246f, 0.345459461f, 0.441716462f, 0.537973464f, 0.634230435f,
+    0.730487466f, 0.826744437f, 0.923001468f, 0.98097229f, 0.885868549f, 0.790764749f, 0.695661008f, 0.600557268f,
+    0.505453467f, 0.410349727f, 0.315245986f, 0.220142215f, 0.12503846f, 0.0299346969f, 0.0190277174f, 0.114131473f,
+    0.209235236f, 0.304338992f, 0.399442762f, 0.494546503f, 0.589650273f, 0.684754014f, 0.779857814f, 0.874961555f,
+    0.970065296f, 0.935615003f, 0.841655552f, 0.747696042f, 0.653736532f, 0.559777021f, 0.465817541f, 0.371858031f,
+    0.27789852f, 0.183939025f, 0.0899795294f, 0.0643849671f, 0.158344463f, 0.252303958f, 0.346263468f, 0.440222979f,
+    0.534182489f, 0.628141999f, 0.72210145f, 0.81606096f, 0.910020471f, 0.996067643f, 0.903232574f, 0.810397506f,
+    0.717562377f, 0.624727309f, 0.53189224f, 0.439057142f, 0.346222073f, 0.253386974f, 0.160551891f, 0.0677167997f,
+    0.00393234566f, 0.096767433f, 0.189602509f, 0.282437593f, 0.375272691f, 0.46810776f, 0.560942829f, 0.653777957f,
+    0.746613026f, 0.839448094f, 0.932283223f, 0.975183606f, 0.883464336f, 0.791745067f, 0.700025737f, 0.608306468f,
+    0.516587198f, 0.424867898f, 0.333148599f, 0.241429314f, 0.149710014f, 0.0579907298f, 0.0248163827f, 0.116535671f,
+    0.208254963f, 0.299974263f, 0.391693532f, 0.483412832f, 0.575132132f, 0.666851401f, 0.758570671f, 0.85029f,
+    0.94200927f, 0.966676056f, 0.876057088f, 0.78543812f, 0.694819152f, 0.604200184f, 0.513581216f, 0.422962248f,
+    0.33234328f, 0.241724327f, 0.151105359f, 0.0604863912f, 0.0333239324f, 0.123942897f, 0.214561865f, 0.305180848f,
+    0.395799816f, 0.486418784f, 0.577037752f, 0.66765672f, 0.758275688f, 0.848894656f, 0.939513624f, 0.970228374f,
+    0.880694866f, 0.791161418f, 0.70162791f, 0.612094462f, 0.522560954f, 0.433027506f, 0.343494028f, 0.25396052f,
+    0.164427057f, 0.0748935789f, 0.0297716297f, 0.119305111f, 0.208838582f, 0.29837206f, 0.387905538f, 0.477439016f,
+    0.566972494f, 0.656506002f, 0.74603945f, 0.835572958f, 0.925106406f, 0.985536337f, 0.897080839f, 0.808625281f,
+    0.720169723f, 0.631714225f, 0.543258667f, 0.454803139f, 0.366347581f, 0.277892053f, 0.18943651f, 0.100980982f,
+    0.0125254421f, 0.0144636463f, 0.102919184f, 0.191374719f, 0.279830247f, 0.368285805f, 0.456741333f, 0.545196891f,
+    0.633652389f, 0.722107947f, 0.810563505f, 0.899019003f, 0.987474561f, 0.924977601f, 0.837579489f, 0.750181377f,
+    0.662783265f, 0.575385153f, 0.487987041f, 0.4005889f, 0.313190788f, 0.225792691f, 0.138394564f, 0.0509964563f,
+    0.0750224069f, 0.162420511f, 0.249818638f, 0.337216735f, 0.424614847f, 0.512012959f, 0.59941107f, 0.686809182f,
+    0.774207294f, 0.861605406f, 0.949003518f, 0.964035928f, 0.877688468f, 0.791341007f, 0.704993546f, 0.618646085f,
+    0.532298625f, 0.445951134f, 0.359603673f, 0.273256212f, 0.186908752f, 0.100561276f, 0.0142138135f, 0.0359640568f,
+    0.122311525f, 0.208658993f, 0.295006454f, 0.381353915f, 0.467701375f, 0.554048836f, 0.640396297f, 0.726743817f,
+    0.813091278f, 0.899438739f, 0.9857862f, 0.928732097f, 0.843420982f, 0.758109868f, 0.672798753f, 0.587487638f,
+    0.502176523f, 0.416865408f, 0.331554294f, 0.246243164f, 0.160932049f, 0.0756209344f, 0.0712678954f, 0.156579018f,
+    0.241890132f, 0.327201247f, 0.412512362f, 0.497823477f, 0.583134592f, 0.668445706f, 0.753756821f, 0.839067936f,
+    0.924379051f, 0.990425766f, 0.906135559f, 0.821845293f, 0.737555027f, 0.653264821f, 0.568974555f, 0.484684318f,
+    0.400394082f, 0.316103846f, 0.231813595f, 0.147523358f, 0.0632331148f, 0.00957422704f, 0.0938644707f, 0.178154707f,
+    0.262444943f, 0.346735179f, 0.431025445f, 0.515315652f, 0.599605918f, 0.683896184f, 0.76818639f, 0.852476656f,
+    0.936766863f, 0.97919631f, 0.895920575f, 0.812644839f, 0.729369104f, 0.646093428f, 0.562817693f, 0.479541957f,
+    0.396266222f, 0.312990487f, 0.229714751f, 0.146439031f, 0.0631632954f, 0.0208036844f, 0.10407941f, 0.187355146f,
+    0.270630866f, 0.353906602f, 0.437182337f, 0.520458043f, 0.603733778f, 0.687009513f, 0.770285249f, 0.853560984f,
+    0.93683672f, 0.980128765f, 0.897851706f, 0.815574586f, 0.733297527f, 0.651020408f, 0.568743348f, 0.486466259f,
+    0.404189169f, 0.32191211f, 0.23963502f, 0.157357931f, 0.0750808492f, 0.0198712405f, 0.102148324f, 0.184425414f,
+    0.266702503f, 0.348979563f, 0.431256652f, 0.513533711f, 0.595810831f, 0.67808789f, 0.760365009f, 0.842642069f,
+    0.924919128f, 0.99289012f, 0.91160053f, 0.830310941f, 0.749021351f, 0.667731762f, 0.586442113f, 0.505152524f,
+    0.423862934f, 0.342573345f, 0.261283755f, 0.179994151f, 0.0987045467f, 0.017414948f, 0.00710986322f, 0.0883994624f,
+    0.169689059f, 0.250978649f, 0.332268268f, 0.413557857f, 0.494847447f, 0.576137066f, 0.657426655f, 0.738716245f,
+    0.820005834f, 0.901295483f, 0.982585073f, 0.936891556f, 0.856577039f, 0.776262522f, 0.695948005f, 0.615633488f,
+    0.535318971f, 0.455004454f, 0.374689937f, 0.294375449f, 0.214060917f, 0.133746415f, 0.0534318946f, 0.0631084591f,
+    0.143422976f, 0.223737493f, 0.304051995f, 0.384366512f, 0.464681029f, 0.544995546f, 0.625310063f, 0.70562458f,
+    0.785939097f, 0.866253614f, 0.946568131f, 0.973439217f, 0.894086301f, 0.814733386f, 0.735380471f, 0.656027496f,
+    0.576674581f, 0.497321635f, 0.41796872f, 0.338615775f, 0.25926286f, 0.179909915f, 0.100556985f, 0.0212040488f,
+    0.0265607592f, 0.105913691f, 0.185266629f, 0.264619559f, 0.343972504f, 0.423325419f, 0.502678335f, 0.58203131f,
+    0.661384225f, 0.74073714f, 0.820090115f, 0.89944303f, 0.978795946f, 0.9425506f, 0.864152253f, 0.785753906f,
+    0.707355559f, 0.628957212f, 0.550558865f, 0.472160548f, 0.393762201f, 0.315363854f, 0.236965507f, 0.15856716f,
+    0.0801688135f, 0.00177047052f, 0.0574493743f, 0.135847718f, 0.214246064f, 0.292644411f, 0.371042758f, 0.449441105f,
+    0.527839422f, 0.606237769f, 0.684636116f, 0.763034463f, 0.84143281f, 0.919831157f, 0.998229504f, 0.924291193f,
+    0.846833169f, 0.769375145f, 0.691917121f, 0.614459097f, 0.537001073f, 0.45954302f, 0.382084996f, 0.304626971f,
+    0.227168933f, 0.149710909f, 0.0722528696f, 0.0757087916f, 0.153166831f, 0.230624855f, 0.308082879f, 0.385540903f,
+    0.462998956f, 0.540456951f, 0.617915034f, 0.695373058f, 0.772831082f, 0.850289106f, 0.92774713f, 0.994857371f,
+    0.918329477f, 0.841801643f, 0.765273809f, 0.688745975f, 0.612218142f, 0.535690248f, 0.459162414f, 0.38263458f,
+    0.306106716f, 0.229578868f, 0.153051019f, 0.0765231773f,
+};
+
+// 16000 -> 22050 Hz: 441 phases of 32 taps
+alignas(16) const float kResampler16000[] = {
+    4.23958663e-05f, -0.00019005721f, 0.000573369151f, -0.00137901714f, 0.00284263561f, -0.00521868607f, 0.00873187464f, -0.0135170007f,
+    0.0195595231f, -0.0266520549f, 0.0343811437f, -0.0421536639f, 0.0492635667f, -0.0549901016f, 0.0587097444f, 0.939992666f,
+    0.0587097444f, -0.0549901016f, 0.0492635667f, -0.0421536639f, 0.0343811437f, -0.0266520549f, 0.0195595231f, -0.0135170007f,
+    0.00873187464f, -0.00521868607f, 0.00284263561f, -0.00137901714f, 0.000573369151f, -0.00019005721f, 4.23958663e-05f, -0.0f,
+    4.31473673e-05f, -0.000191969215f, 0.000577021565f, -0.00138463057f, 0.00284944335f, -0.00522405049f, 0.0087301787f, -0.0134983761f,
+    0.0195083972f, -0.0265452806f, 0.0341848582f, -0.0418161973f, 0.0486953445f, -0.0539899766f, 0.0565154776f, 0.939988494f,
+    0.0609120056f, -0.0559906326f, 0.0498309694f, -0.0424900576f, 0.0345764086f, -0.0267579611f, 0.0196099691f, -0.0135351242f,
+    0.00873322506f, -0.00521310046f, 0.00283569493f, -0.00137333095f, 0.000569680182f, -0.000188128848f, 4.16380535e-05f, -3.16327714e-06f,
+    4.38921379e-05f, -0.000193863059f, 0.000580631837f, -0.00139015762f, 0.0028560916f, -0.00522914343f, 0.00872805621f, -0.0134791248f,
+    0.0194564052f, -0.0264373869f, 0.0339872316f, -0.0414772779f, 0.0481258593f, -0.0529897809f, 0.0543286875f, 0.939967036f,
+    0.0631216466f, -0.0569910072f, 0.0503970534f, -0.0428249612f, 0.0347703062f, -0.0268627368f, 0.0196595397f, -0.0135526154f,
+    0.008734148f, -0.00520724244f, 0.00282859476f, -0.00136755861f, 0.000565949187f, -0.000186182369f, 4.08735286e-05f, -3.00204647e-06f,
+    4.46303093e-05f, -0.000195739281f, 0.000584201887f, -0.00139560283f, 0.00286258967f, -0.00523398258f, 0.00872553512f, -0.0134592894f,
+    0.0194036141f, -0.0263284687f, 0.033788383f, -0.0411370546f, 0.0475552976f, -0.0519897267f, 0.0521495976f, 0.939931393f,
+    0.0653388277f, -0.0579913482f, 0.0509619489f, -0.0431584939f, 0.0349629372f, -0.02696646f, 0.0197082963f, -0.0135695161f,
+    0.00873466767f, -0.00520112971f, 0.00282134418f, -0.00136170455f, 0.000562178204f, -0.000184218399f, 4.01024408e-05f, -2.83881513e-06f,
+    4.53618704e-05f, -0.000197597896f, 0.000587731542f, -0.00140096631f, 0.00286893756f, -0.00523856841f, 0.00872261822f, -0.0134388758f,
+    0.0193500314f, -0.0262185335f, 0.0335883312f, -0.0407955535f, 0.0469836891f, -0.05098987f, 0.0499782637f, 0.939881563f,
+    0.067563504f, -0.0589916334f, 0.0515256338f, -0.0434906408f, 0.0351543017f, -0.0270691253f, 0.0197562389f, -0.0135858264f,
+    0.00873478781f, -0.00519476179f, 0.00281394296f, -0.001355769f, 0.000558367115f, -0.000182236996f, 3.9324801e-05f, -2.67358155e-06f,
+    4.60868177e-05f, -0.000199438873f, 0.000591220916f, -0.00140624808f, 0.00287513528f, -0.00524290139f, 0.00871930551f, -0.0134178838f,
+    0.0192956552f, -0.0261075888f, 0.0333870836f, -0.0404527858f, 0.0464110635f, -0.0499902442f, 0.0478147157f, 0.939817488f,
+    0.0697956309f, -0.059991803f, 0.0520880781f, -0.043821387f, 0.0353443809f, -0.0271707308f, 0.019803362f, -0.0136015434f,
+    0.00873450283f, -0.00518813776f, 0.0028063911f, -0.00134975195f, 0.000554516097f, -0.000180238159f, 3.85406238e-05f, -2.50634389e-06f,
+    4.68051439e-05f, -0.000201262184f, 0.000594669953f, -0.001411448f, 0.00288118282f, -0.00524698198f, 0.00871559791f, -0.0133963162f,
+    0.0192404948f, -0.0259956401f, 0.0331846476f, -0.0401087739f, 0.0458374433f, -0.0489908978f, 0.0456590019f, 0.939739287f,
+    0.0720351785f, -0.0609918162f, 0.0526492558f, -0.0441507064f, 0.0355331674f, -0.027271267f, 0.0198496599f, -0.0136166662f,
+    0.00873381644f, -0.00518125901f, 0.00279868906f, -0.00134365354f, 0.000550625206f, -0.000178221992f, 3.774992e-05f, -2.33710102e-06f,
+    4.75168417e-05f, -0.000203067786f, 0.000598078477f, -0.0014165662f, 0.00288708066f, -0.00525080971f, 0.0087114973f, -0.0133741749f,
+    0.0191845521f, -0.0258826949f, 0.0329810381f, -0.0397635289f, 0.0452628583f, -0.0479918681f, 0.043511156f, 0.93964684f,
+    0.0742820725f, -0.0619916357f, 0.0532091372f, -0.0444785878f, 0.0357206464f, -0.0273707267f, 0.0198951308f, -0.0136311902f,
+    0.00873272493f, -0.00517412322f, 0.00279083615f, -0.00133747386f, 0.000546694384f, -0.000176188449f, 3.69526933e-05f, -2.16585181e-06f,
+    4.82219039e-05f, -0.000204855693f, 0.000601446605f, -0.00142160244f, 0.00289282855f, -0.00525438506f, 0.00870700181f, -0.0133514628f,
+    0.0191278327f, -0.0257687625f, 0.0327762701f, -0.0394170769f, 0.0446873382f, -0.0469932035f, 0.0413712189f, 0.939540207f,
+    0.0765362978f, -0.0629912168f, 0.0537676997f, -0.0448050126f, 0.0359068103f, -0.0274691042f, 0.0199397728f, -0.0136451162f,
+    0.00873122737f, -0.00516673131f, 0.00278283306f, -0.00133121281f, 0.000542723923f, -0.000174137633f, 3.61489656e-05f, -1.99259489e-06f,
+    4.8920323e-05f, -0.00020662586f, 0.000604774221f, -0.00142655685f, 0.00289842673f, -0.00525770988f, 0.00870211702f, -0.0133281806f,
+    0.0190703366f, -0.0256538447f, 0.0325703509f, -0.0390694365f, 0.0441109128f, -0.0459949374f, 0.0392392389f, 0.939419389f,
+    0.0787978023f, -0.063990511f, 0.05432491f, -0.045129966f, 0.036091648f, -0.027566392f, 0.0199835785f, -0.0136584416f,
+    0.00872932468f, -0.00515908329f, 0.0027746791f, -0.00132487051f, 0.000538713706f, -0.000172069529f, 3.53387441e-05f, -1.81732923e-06f,
+    4.9612092e-05f, -0.00020837826f, 0.000608061324f, -0.00143142941f, 0.00290387496f, -0.00526078325f, 0.00869683921f, -0.0133043295f,
+    0.0190120712f, -0.0255379491f, 0.0323632844f, -0.0387206078f, 0.0435335971f, -0.0449971184f, 0.0371152461f, 0.939284384f,
+    0.0810665339f, -0.0649894699f, 0.054880742f, -0.0454534255f, 0.0362751484f, -0.0276625846f, 0.020026546f, -0.0136711644f,
+    0.008727015f, -0.00515117822f, 0.00276637473f, -0.00131844706f, 0.000534663792f, -0.000169984181f, 3.45220469e-05f, -1.64005417e-06f,
+    5.02972143e-05f, -0.000210112892f, 0.000611307914f, -0.00143622013f, 0.00290917419f, -0.00526360562f, 0.00869117305f, -0.0132799158f,
+    0.0189530384f, -0.0254210886f, 0.0321550965f, -0.0383706279f, 0.0429554321f, -0.0439997874f, 0.0349992886f, 0.939135194f,
+    0.0833424553f, -0.0659880713f, 0.0554351695f, -0.04577538f, 0.0364573039f, -0.0277576782f, 0.0200686734f, -0.0136832837f,
+    0.00872429833f, -0.00514301611f, 0.00275791995f, -0.0013119427f, 0.000530574354f, -0.000167881677f, 3.36988815e-05f, -1.460769e-06f,
+    5.09756792e-05f, -0.000211829727f, 0.000614513934f, -0.00144092902f, 0.00291432394f, -0.00526617793f, 0.00868511852f, -0.0132549386f,
+    0.0188932456f, -0.0253032614f, 0.0319457911f, -0.0380195118f, 0.0423764363f, -0.0430029854f, 0.0328913927f, 0.938971817f,
+    0.0856255218f, -0.0669862479f, 0.0559881665f, -0.0460958071f, 0.036638096f, -0.0278516635f, 0.0201099571f, -0.0136947976f,
+    0.00872117467f, -0.00513459742f, 0.00274931476f, -0.00130535744f, 0.000526445394f, -0.000165762001f, 3.28692659e-05f, -1.27947305e-06f,
+    5.16474756e-05f, -0.000213528765f, 0.000617679267f, -0.00144555606f, 0.00291932421f, -0.00526850019f, 0.00867867563f, -0.0132293999f,
+    0.0188326929f, -0.0251844823f, 0.0317353755f, -0.037667267f, 0.0417966433f, -0.0420067534f, 0.0307916105f, 0.938794255f,
+    0.0879156739f, -0.0679839626f, 0.0565397032f, -0.046414692f, 0.0368175209f, -0.027944535f, 0.0201503932f, -0.0137057044f,
+    0.0087176403f, -0.00512592075f, 0.00274055894f, -0.00129869115f, 0.000522276969f, -0.000163625227f, 3.2033211e-05f, -1.09616633e-06f,
+    5.23126109e-05f, -0.000215209962f, 0.000620804029f, -0.00145010115f, 0.00292417547f, -0.00527057331f, 0.00867184624f, -0.0132033033f,
+    0.0187713858f, -0.0250647534f, 0.0315238684f, -0.0373139195f, 0.0412160791f, -0.0410111323f, 0.0286999736f, 0.938602567f,
+    0.0902128816f, -0.0689811781f, 0.0570897534f, -0.0467320196f, 0.0369955674f, -0.0280362871f, 0.0201899763f, -0.013716002f,
+    0.00871369801f, -0.00511698658f, 0.00273165246f, -0.00129194406f, 0.000518069253f, -0.000161471398f, 3.11907352e-05f, -9.108482e-07f,
+    5.29710778e-05f, -0.000216873319f, 0.00062388822f, -0.00145456451f, 0.00292887772f, -0.00527239777f, 0.00866463128f, -0.0131766507f,
+    0.0187093299f, -0.0249440838f, 0.0313112773f, -0.0369594842f, 0.0406347662f, -0.0400161706f, 0.026616523f, 0.938396692f,
+    0.0925171003f, -0.0699778497f, 0.0576382875f, -0.0470477678f, 0.0371722281f, -0.0281269141f, 0.0202287082f, -0.0137256887f,
+    0.00870934501f, -0.00510779535f, 0.00272259605f, -0.00128511642f, 0.00051382219f, -0.000159300529f, 3.03418528e-05f, -7.23519008e-07f,
+    5.36228654e-05f, -0.000218518806f, 0.000626931724f, -0.00145894603f, 0.00293343118f, -0.0052739731f, 0.00865703262f, -0.0131494431f,
+    0.0186465289f, -0.0248224791f, 0.0310976151f, -0.0366039798f, 0.040052738f, -0.0390218981f, 0.0245412905f, 0.938176632f,
+    0.0948282704f, -0.0709739104f, 0.0581852756f, -0.0473619215f, 0.0373474881f, -0.0282164086f, 0.0202665795f, -0.0137347635f,
+    0.0087045813f, -0.00509834616f, 0.00271338923f, -0.00127820799f, 0.000509536068f, -0.000157112692f, 2.94865804e-05f, -5.34178639e-07f,
+    5.42679845e-05f, -0.000220146452f, 0.00062993454f, -0.00146324595f, 0.00293783587f, -0.0052753007f, 0.00864905119f, -0.013121685f,
+    0.0185829848f, -0.0246999487f, 0.0308828913f, -0.0362474285f, 0.039470017f, -0.0380283594f, 0.0224743206f, 0.937942445f,
+    0.0971463621f, -0.0719693452f, 0.0587306991f, -0.0476744696f, 0.0375213325f, -0.0283047669f, 0.0203035884f, -0.0137432246f,
+    0.00869940687f, -0.00508863898f, 0.002704032f, -0.00127121911f, 0.000505210715f, -0.000154907932f, 2.86249324e-05f, -3.42827491e-07f,
+    5.4906428e-05f, -0.0002217562f, 0.00063289667f, -0.00146746391f, 0.00294209225f, -0.0052763815f, 0.00864068605f, -0.0130933765f,
+    0.0185187031f, -0.0245764963f, 0.0306671206f, -0.0358898416f, 0.0388866365f, -0.0370356031f, 0.020415647f, 0.937694132f,
+    0.0994713157f, -0.072964102f, 0.0592745282f, -0.0479853898f, 0.0376937613f, -0.0283919815f, 0.0203397367f, -0.01375107f,
+    0.0086938208f, -0.00507867429f, 0.00269452482f, -0.00126414991f, 0.000500846305f, -0.000152686276f, 2.77569252e-05f, -1.49465976e-07f,
+    5.55381885e-05f, -0.000223348063f, 0.000635818171f, -0.00147160026f, 0.00294620031f, -0.00527721504f, 0.00863194279f, -0.0130645214f,
+    0.0184536893f, -0.024452135f, 0.0304503143f, -0.0355312414f, 0.038302619f, -0.0360436663f, 0.0183653086f, 0.937431693f,
+    0.101803094f, -0.0739581287f, 0.0598167293f, -0.0482946672f, 0.0378647596f, -0.0284780469f, 0.0203750152f, -0.0137583008f,
+    0.00868782122f, -0.00506845117f, 0.00268486748f, -0.00125700061f, 0.00049644307f, -0.000150447799f, 2.68825825e-05f, 4.59052991e-08f,
+    5.6163266e-05f, -0.000224922012f, 0.000638698868f, -0.00147565478f, 0.00295016007f, -0.00527780131f, 0.00862281676f, -0.0130351214f,
+    0.0183879472f, -0.0243268646f, 0.0302324779f, -0.0351716392f, 0.0377179906f, -0.0350525826f, 0.0163233392f, 0.937155068f,
+    0.104141638f, -0.0749513805f, 0.0603572801f, -0.0486022756f, 0.0380343162f, -0.0285629556f, 0.0204094257f, -0.0137649104f,
+    0.00868140999f, -0.00505796913f, 0.00267506018f, -0.00124977087f, 0.000492000894f, -0.000148192514f, 2.60019115e-05f, 2.43285569e-07f,
+    5.67816678e-05f, -0.000226478063f, 0.000641538994f, -0.0014796278f, 0.00295397197f, -0.00527814263f, 0.00861331448f, -0.0130051803f,
+    0.0183214787f, -0.0242006984f, 0.030013632f, -0.0348110609f, 0.0371327847f, -0.0340624005f, 0.0142897777f, 0.936864376f,
+    0.106486909f, -0.0759438202f, 0.0608961508f, -0.048908215f, 0.0382024236f, -0.0286467057f, 0.0204429608f, -0.0137709025f,
+    0.00867458433f, -0.00504722958f, 0.00266510295f, -0.00124246127f, 0.000487520039f, -0.000145920509f, 2.51149377e-05f, 4.42673979e-07f,
+    5.73933867e-05f, -0.000228016172f, 0.000644338317f, -0.00148351921f, 0.00295763626f, -0.0052782381f, 0.00860343408f, -0.0129746972f,
+    0.0182542913f, -0.0240736417f, 0.0297937803f, -0.0344495215f, 0.0365470238f, -0.0330731608f, 0.0122646587f, 0.936559498f,
+    0.108838856f, -0.076935403f, 0.0614333153f, -0.0492124557f, 0.038369067f, -0.0287292879f, 0.0204756204f, -0.0137762735f,
+    0.00866734516f, -0.0050362316f, 0.00265499577f, -0.00123507169f, 0.000483000476f, -0.000143631813f, 2.42216774e-05f, 6.44069303e-07f,
+    5.79984226e-05f, -0.000229536367f, 0.000647096953f, -0.0014873289f, 0.00296115247f, -0.00527808908f, 0.00859317742f, -0.0129436785f,
+    0.0181863885f, -0.0239457004f, 0.0295729395f, -0.0340870395f, 0.0359607339f, -0.0320849009f, 0.0102480175f, 0.936240554f,
+    0.111197434f, -0.0779260695f, 0.0619687438f, -0.0495149828f, 0.0385342427f, -0.0288106948f, 0.0205073971f, -0.0137810204f,
+    0.00865969062f, -0.0050249747f, 0.00264473888f, -0.00122760236f, 0.000478442351f, -0.000141326469f, 2.3322149e-05f, 8.47470403e-07f,
+    5.85967719e-05f, -0.000231038619f, 0.000649814843f, -0.00149105722f, 0.00296452153f, -0.00527769513f, 0.00858254638f, -0.0129121235f,
+    0.0181177724f, -0.0238168798f, 0.0293511171f, -0.0337236263f, 0.0353739411f, -0.0310976561f, 0.00823989045f, 0.935907543f,
+    0.113562591f, -0.0789157897f, 0.062502414f, -0.0498157851f, 0.0386979319f, -0.0288909245f, 0.0205382928f, -0.0137851434f,
+    0.00865162164f, -0.00501345936f, 0.00263433252f, -0.00122005341f, 0.000473845721f, -0.000139004565f, 2.24163741e-05f, 1.05287575e-06f,
+    5.91884418e-05f, -0.000232522929f, 0.000652492046f, -0.00149470405f, 0.00296774344f, -0.00527705764f, 0.00857154187f, -0.0128800357f,
+    0.0180484504f, -0.0236871932f, 0.0291283317f, -0.0333593115f, 0.0347866789f, -0.0301114749f, 0.00624031201f, 0.935560405f,
+    0.115934275f, -0.0799045116f, 0.063034296f, -0.050114844f, 0.0388601385f, -0.0289699715f, 0.0205683056f, -0.0137886424f,
+    0.00864313729f, -0.00500168605f, 0.00262377644f, -0.00121242495f, 0.000469210761f, -0.000136666116f, 2.15043692e-05f, 1.26028385e-06f,
+    5.97734324e-05f, -0.000233989311f, 0.000655128504f, -0.0014982695f, 0.00297081843f, -0.00527617708f, 0.00856016483f, -0.012847418f,
+    0.0179784242f, -0.0235566441f, 0.028904587f, -0.0329941027f, 0.0341989771f, -0.0291263945f, 0.00424931757f, 0.935199201f,
+    0.118312441f, -0.0808921978f, 0.0635643601f, -0.0504121445f, 0.0390208401f, -0.02904783f, 0.0205974262f, -0.0137915146f,
+    0.00863423757f, -0.00498965383f, 0.00261307112f, -0.00120471709f, 0.00046453753f, -0.000134311209f, 2.05861579e-05f, 1.46969296e-06f,
+    6.03517401e-05f, -0.000235437721f, 0.000657724333f, -0.00150175358f, 0.00297374674f, -0.0052750539f, 0.00854841713f, -0.0128142731f,
+    0.0179077014f, -0.0234252419f, 0.028679898f, -0.0326280259f, 0.0336108506f, -0.028142456f, 0.00226694113f, 0.93482393f,
+    0.120697051f, -0.0818787962f, 0.064092584f, -0.0507076606f, 0.0391800329f, -0.0291244909f, 0.0206256565f, -0.0137937581f,
+    0.00862492062f, -0.00497736316f, 0.00260221679f, -0.00119693007f, 0.000459826115f, -0.000131939887f, 1.96617621e-05f, 1.68110103e-06f,
+    6.09233757e-05f, -0.000236868204f, 0.000660279416f, -0.0015051564f, 0.00297652837f, -0.00527368905f, 0.00853629969f, -0.0127806021f,
+    0.0178362839f, -0.0232929923f, 0.0284542795f, -0.0322610885f, 0.0330223329f, -0.0271596946f, 0.000293216581f, 0.934434593f,
+    0.123088039f, -0.0828642622f, 0.0646189302f, -0.0510013886f, 0.0393377021f, -0.0291999523f, 0.0206529927f, -0.013795373f,
+    0.00861518644f, -0.00496481359f, 0.00259121298f, -0.00118906389f, 0.000455076661f, -0.000129552209f, 1.87311998e-05f, 1.894506e-06f,
+    6.1488332e-05f, -0.000238280729f, 0.000662793871f, -0.00150847819f, 0.00297916401f, -0.00527208298f, 0.00852381345f, -0.0127464095f,
+    0.0177641753f, -0.0231599044f, 0.0282277409f, -0.0318933241f, 0.0324334502f, -0.0261781551f, -0.00167182169f, 0.934031188f,
+    0.125485376f, -0.0838485509f, 0.0651433915f, -0.0512933061f, 0.0394938476f, -0.0292742085f, 0.020679431f, -0.0137963584f,
+    0.00860503688f, -0.00495200604f, 0.00258006062f, -0.00118111901f, 0.000450289284f, -0.000127148232f, 1.7794493e-05f, 2.10990584e-06f,
+    6.20466162e-05f, -0.000239675312f, 0.000665267638f, -0.00151171861f, 0.00298165367f, -0.00527023617f, 0.0085109612f, -0.0127116973f,
+    0.0176913869f, -0.0230259858f, 0.0280002914f, -0.0315247439f, 0.0318442322f, -0.0251978748f, -0.00362814101f, 0.933613777f,
+    0.127888978f, -0.0848316252f, 0.0656659231f, -0.0515833981f, 0.0396484546f, -0.029347254f, 0.0207049716f, -0.0137967113f,
+    0.00859446824f, -0.00493893959f, 0.00256875926f, -0.00117309543f, 0.000445464073f, -0.000124728031f, 1.68516672e-05f, 2.32729803e-06f,
+    6.25982284e-05f, -0.000241051923f, 0.000667700719f, -0.00151487801f, 0.00298399734f, -0.00526814908f, 0.008497742f, -0.0126764672f,
+    0.017617913f, -0.0228912383f, 0.027771946f, -0.0311553571f, 0.0312547013f, -0.0242188908f, -0.00557570718f, 0.933182359f,
+    0.130298823f, -0.085813418f, 0.0661865026f, -0.0518716462f, 0.0398015082f, -0.0294190794f, 0.0207296088f, -0.0137964319f,
+    0.00858348235f, -0.00492561515f, 0.00255730934f, -0.00116499304f, 0.000440601085f, -0.000122291633f, 1.59027422e-05f, 2.54667975e-06f,
+    6.31431758e-05f, -0.000242410591f, 0.000670093112f, -0.00151795649f, 0.0029861955f, -0.00526582263f, 0.00848415866f, -0.0126407221f,
+    0.0175437666f, -0.0227556787f, 0.0275427178f, -0.0307851918f, 0.0306648873f, -0.0232412424f, -0.00751448842f, 0.932736874f,
+    0.132714853f, -0.086793907f, 0.0667051077f, -0.0521580353f, 0.0399530008f, -0.0294896848f, 0.0207533389f, -0.0137955183f,
+    0.00857207831f, -0.00491203181f, 0.00254571112f, -0.0011568123f, 0.000435700553f, -0.000119839126f, 1.49477419e-05f, 2.76804826e-06f,
+    6.36814657e-05f, -0.000243751318f, 0.000672444934f, -0.00152095419f, 0.0029882486f, -0.00526325731f, 0.00847021397f, -0.0126044648f,
+    0.0174689479f, -0.022619307f, 0.027312614f, -0.0304142646f, 0.0300748181f, -0.0222649742f, -0.00944445096f, 0.932277381f,
+    0.135137022f, -0.0877730325f, 0.0672217086f, -0.0524425507f, 0.0401029326f, -0.0295590647f, 0.0207761619f, -0.0137939705f,
+    0.0085602561f, -0.00489819003f, 0.00253396458f, -0.00114855345f, 0.000430762535f, -0.000117370568f, 1.39866906e-05f, 2.99140106e-06f,
+    6.42130908e-05f, -0.000245074101f, 0.000674756127f, -0.00152387097f, 0.00299015664f, -0.00526045356f, 0.00845590606f, -0.012567698f,
+    0.0173934624f, -0.0224821344f, 0.0270816498f, -0.0300425906f, 0.029484516f, -0.0212901179f, -0.0113655636f, 0.931803942f,
+    0.13756527f, -0.0887507573f, 0.067736268f, -0.0527251698f, 0.0402512811f, -0.0296272095f, 0.0207980741f, -0.0137917846f,
+    0.00854801387f, -0.00488409027f, 0.00252206996f, -0.00114021637f, 0.000425787148f, -0.000114886017f, 1.30196122e-05f, 3.21673451e-06f,
+    6.47380657e-05f, -0.000246378942f, 0.000677026808f, -0.00152670697f, 0.00299191987f, -0.00525741233f, 0.0084412396f, -0.0125304237f,
+    0.0173173137f, -0.0223441683f, 0.026849838f, -0.0296701901f, 0.0288940128f, -0.0203167144f, -0.0132777933f, 0.931316555f,
+    0.139999554f, -0.0897270292f, 0.0682487786f, -0.0530058891f, 0.0403980426f, -0.0296941176f, 0.0208190735f, -0.0137889627f,
+    0.00853535347f, -0.00486973207f, 0.00251002773f, -0.00113180152f, 0.000420774508f, -0.000112385547f, 1.2046532e-05f, 3.44404543e-06f,
+    6.52563831e-05f, -0.000247665856f, 0.00067925686f, -0.00152946252f, 0.00299353898f, -0.00525413407f, 0.00842621271f, -0.0124926455f,
+    0.0172405113f, -0.0222054143f, 0.0266171861f, -0.029297078f, 0.0283033308f, -0.0193448067f, -0.0151811102f, 0.93081516f,
+    0.142439812f, -0.0907018036f, 0.068759203f, -0.0532846786f, 0.0405432098f, -0.0297597814f, 0.0208391566f, -0.0137855019f,
+    0.00852227397f, -0.0048551159f, 0.00249783765f, -0.0011233089f, 0.000415724789f, -0.000109869223f, 1.10674746e-05f, 3.67333041e-06f,
+    6.57680721e-05f, -0.000248934841f, 0.000681446458f, -0.00153213751f, 0.00299501373f, -0.00525062112f, 0.00841082912f, -0.0124543663f,
+    0.017163055f, -0.0220658835f, 0.0263837129f, -0.0289232787f, 0.0277125034f, -0.0183744263f, -0.0170754828f, 0.930299819f,
+    0.144886002f, -0.0916750506f, 0.0692675114f, -0.053561531f, 0.040686775f, -0.0298241992f, 0.0208583232f, -0.0137814023f,
+    0.00850877445f, -0.00484024175f, 0.00248550018f, -0.00111473887f, 0.000410638109f, -0.000107337124f, 1.00824664e-05f, 3.90458626e-06f,
+    6.62731109e-05f, -0.000250185898f, 0.000683595426f, -0.00153473206f, 0.00299634458f, -0.00524687162f, 0.00839508977f, -0.0124155879f,
+    0.0170849506f, -0.0219255835f, 0.0261494238f, -0.028548805f, 0.0271215495f, -0.0174056161f, -0.0189608783f, 0.929770529f,
+    0.147338077f, -0.0926466957f, 0.069773674f, -0.0538364314f, 0.0408287272f, -0.0298873633f, 0.0208765659f, -0.0137766628f,
+    0.0084948549f, -0.00482510962f, 0.00247301534f, -0.00110609154f, 0.000405514525f, -0.000104789287f, 9.09153096e-06f, 4.13780845e-06f,
+    6.6771514e-05f, -0.000251419056f, 0.000685703999f, -0.00153724628f, 0.00299753202f, -0.00524288695f, 0.00837899558f, -0.0123763122f,
+    0.0170062035f, -0.0217845161f, 0.0259143338f, -0.0281736739f, 0.0265304986f, -0.0164384115f, -0.0208372679f, 0.929227352f,
+    0.149795964f, -0.0936167091f, 0.070277676f, -0.0541093573f, 0.0409690477f, -0.0299492683f, 0.0208938867f, -0.0137712816f,
+    0.00848051533f, -0.00480971951f, 0.00246038358f, -0.00109736703f, 0.000400354242f, -0.000102225807f, 8.09469748e-06f, 4.37299377e-06f,
+    6.72633032e-05f, -0.000252634287f, 0.000687772059f, -0.00153968029f, 0.00299857627f, -0.00523866899f, 0.00836254936f, -0.0123365447f,
+    0.0169268157f, -0.0216426942f, 0.025678454f, -0.0277979076f, 0.025939377f, -0.0154728526f, -0.0227046199f, 0.928670228f,
+    0.152259633f, -0.0945850462f, 0.07077948f, -0.0543803014f, 0.0411077403f, -0.0300099105f, 0.0209102817f, -0.0137652569f,
+    0.00846575573f, -0.00479407236f, 0.0024476049f, -0.00108856568f, 0.000395157345f, -9.96467497e-05f, 7.09199185e-06f, 4.61013724e-06f,
+    6.77484641e-05f, -0.000253831648f, 0.000689799839f, -0.00154203433f, 0.00299947732f, -0.00523421774f, 0.00834575109f, -0.0122962855f,
+    0.0168467984f, -0.0215001255f, 0.0254417975f, -0.0274215229f, 0.0253482144f, -0.0145089747f, -0.0245629046f, 0.928099275f,
+    0.154729009f, -0.0955516547f, 0.0712790713f, -0.0546492413f, 0.04124479f, -0.030069286f, 0.020925751f, -0.0137585895f,
+    0.0084505761f, -0.0047781677f, 0.00243468001f, -0.00107968762f, 0.00038992404f, -9.70521869e-05f, 6.0834418e-06f, 4.84923521e-06f,
+    6.82270183e-05f, -0.000255011109f, 0.000691787107f, -0.00154430827f, 0.00300023612f, -0.00522953412f, 0.00832860358f, -0.0122555392f,
+    0.0167661496f, -0.0213568173f, 0.0252043772f, -0.0270445365f, 0.0247570332f, -0.013546817f, -0.026412094f, 0.927514374f,
+    0.157204077f, -0.0965164974f, 0.0717764124f, -0.0549161658f, 0.0413801894f, -0.0301273875f, 0.020940287f, -0.0137512796f,
+    0.00843497645f, -0.00476200553f, 0.00242160866f, -0.00107073307f, 0.000384654413f, -9.44421845e-05f, 5.06907645e-06f, 5.09028268e-06f,
+    6.86989661e-05f, -0.000256172701f, 0.000693734095f, -0.00154650246f, 0.00300085242f, -0.00522461766f, 0.00831110682f, -0.0122143077f,
+    0.0166848786f, -0.0212127753f, 0.0249662008f, -0.0266669672f, 0.0241658632f, -0.0125864167f, -0.0282521546f, 0.926915646f,
+    0.159684747f, -0.0974795073f, 0.0722714812f, -0.0551810488f, 0.041513931f, -0.0301842131f, 0.0209538899f, -0.0137433233f,
+    0.00841895584f, -0.00474558631f, 0.00240839133f, -0.00106170226f, 0.00037934861f, -9.18168298e-05f, 4.04892216e-06f, 5.33327511e-06f,
+    6.91643072e-05f, -0.000257316453f, 0.000695640862f, -0.00154861691f, 0.00300132693f, -0.00521947164f, 0.00829326268f, -0.0121725947f,
+    0.0166029856f, -0.0210680086f, 0.0247272849f, -0.0262888353f, 0.0235747267f, -0.0116278119f, -0.030083064f, 0.926303089f,
+    0.162170976f, -0.0984406695f, 0.0727642551f, -0.0554438904f, 0.0416460037f, -0.0302397553f, 0.0209665615f, -0.0137347216f,
+    0.00840251427f, -0.00472891098f, 0.00239502848f, -0.00105259544f, 0.000374006806f, -8.91761883e-05f, 3.02300919e-06f, 5.57820795e-06f,
+    6.96230709e-05f, -0.000258442364f, 0.000697507232f, -0.00155065174f, 0.00300165988f, -0.00521409418f, 0.00827507395f, -0.0121304002f,
+    0.0165204816f, -0.0209225249f, 0.0244876388f, -0.0259101521f, 0.0229836497f, -0.0106710363f, -0.0319047868f, 0.925676703f,
+    0.164662719f, -0.0993999168f, 0.0732546896f, -0.0557046644f, 0.0417763963f, -0.0302940123f, 0.0209782943f, -0.0137254735f,
+    0.00838565174f, -0.00471197814f, 0.00238151988f, -0.00104341272f, 0.000368629087f, -8.65203328e-05f, 1.99136662e-06f, 5.82507573e-06f,
+    7.00752571e-05f, -0.000259550405f, 0.000699333497f, -0.00155260717f, 0.00300185126f, -0.00520848762f, 0.0082565425f, -0.0120877307f,
+    0.0164373647f, -0.0207763352f, 0.0242472775f, -0.0255309436f, 0.0223926641f, -0.00971612986f, -0.0337173007f, 0.92503655f,
+    0.167159915f, -0.100357205f, 0.0737427771f, -0.0559633598f, 0.0419051088f, -0.0303469747f, 0.0209890846f, -0.0137155782f,
+    0.00836836826f, -0.00469478918f, 0.00236786623f, -0.00103415444f, 0.000363215659f, -8.38493506e-05f, 9.54024472e-07f, 6.07387301e-06f,
+    7.05208658e-05f, -0.000260640692f, 0.000701119541f, -0.0015544832f, 0.00300190202f, -0.00520265289f, 0.00823766738f, -0.0120445881f,
+    0.0163536463f, -0.0206294432f, 0.0240062103f, -0.0251512248f, 0.0218017939f, -0.00876312982f, -0.0355205722f, 0.924382567f,
+    0.169662505f, -0.101312503f, 0.0742284879f, -0.0562199615f, 0.0420321226f, -0.0303986445f, 0.0209989399f, -0.0137050347f,
+    0.00835066475f, -0.00467734411f, 0.00235406775f, -0.00102482084f, 0.000357766665f, -8.11633217e-05f, -8.8986873e-08f, 6.32459569e-06f,
+    7.09599044e-05f, -0.00026171311f, 0.000702865422f, -0.00155628007f, 0.00300181238f, -0.00519658905f, 0.0082184514f, -0.0120009733f,
+    0.0162693262f, -0.0204818565f, 0.023764452f, -0.0247710105f, 0.0212110635f, -0.00781207113f, -0.0373145714f, 0.923714817f,
+    0.172170445f, -0.102265738f, 0.0747117922f, -0.056474451f, 0.0421574302f, -0.0304490104f, 0.021007847f, -0.0136938421f,
+    0.00833254028f, -0.00465964293f, 0.00234012445f, -0.00101541204f, 0.000352282223f, -7.84623116e-05f, -1.13763667e-06f, 6.57723649e-06f,
+    7.13924092e-05f, -0.000262767804f, 0.000704571372f, -0.00155799801f, 0.00300158234f, -0.00519029936f, 0.00819889735f, -0.011956891f,
+    0.0161844119f, -0.0203335863f, 0.0235220138f, -0.024390325f, 0.0206204988f, -0.00686299102f, -0.0390992872f, 0.923033297f,
+    0.17468369f, -0.103216879f, 0.0751926675f, -0.056726817f, 0.0422810316f, -0.0304980744f, 0.0210158098f, -0.0136820003f,
+    0.00831399485f, -0.0046416861f, 0.00232603704f, -0.0010059285f, 0.000346762536f, -7.5746415e-05f, -2.1918936e-06f, 6.83179132e-06f,
+    7.18183583e-05f, -0.000263804715f, 0.000706237159f, -0.0015596369f, 0.00300121214f, -0.00518378196f, 0.00817900524f, -0.0119123431f,
+    0.0160989072f, -0.0201846361f, 0.0232789032f, -0.0240091812f, 0.020030126f, -0.00591592444f, -0.0408746712f, 0.922338009f,
+    0.177202165f, -0.104165882f, 0.0756710768f, -0.0569770411f, 0.0424029119f, -0.030545827f, 0.0210228227f, -0.0136695076f,
+    0.00829502661f, -0.00462347362f, 0.00231180526f, -0.000996370101f, 0.00034120772f, -7.30157044e-05f, -3.25172527e-06f, 7.088252e-06f,
+    7.22377808e-05f, -0.000264823902f, 0.000707863073f, -0.0015611971f, 0.00300070294f, -0.00517704012f, 0.00815877691f, -0.0118673341f,
+    0.0160128195f, -0.0200350191f, 0.0230351407f, -0.0236275978f, 0.0194399729f, -0.0049709091f, -0.0426407084f, 0.921629071f,
+    0.179725811f, -0.105112702f, 0.076147005f, -0.0572251156f, 0.0425230637f, -0.0305922683f, 0.0210288893f, -0.0136563657f,
+    0.0082756402f, -0.00460500689f, 0.0022974303f, -0.000986737548f, 0.00033561798f, -7.02702673e-05f, -4.31710032e-06f, 7.34661444e-06f,
+    7.26506842e-05f, -0.000265825336f, 0.000709448999f, -0.00156267884f, 0.00300005451f, -0.00517007336f, 0.00813821517f, -0.011821866f,
+    0.0159261506f, -0.0198847409f, 0.02279073f, -0.0232455954f, 0.0188500639f, -0.00402798085f, -0.044397369f, 0.920906425f,
+    0.182254598f, -0.106057286f, 0.0766204298f, -0.0574710146f, 0.0426414832f, -0.030637389f, 0.0210340042f, -0.0136425719f,
+    0.0082558319f, -0.00458628451f, 0.00228291168f, -0.000977030839f, 0.000329993403f, -6.7510191e-05f, -5.38798531e-06f, 7.6068718e-06f,
+    7.30570755e-05f, -0.000266809075f, 0.000710995111f, -0.00156408187f, 0.00299926708f, -0.00516288262f, 0.00811732002f, -0.0117759407f,
+    0.015838908f, -0.0197338089f, 0.0225456897f, -0.0228631888f, 0.0182604268f, -0.00308717415f, -0.0461446308f, 0.920170128f,
+    0.184788451f, -0.106999584f, 0.0770913139f, -0.0577147305f, 0.0427581482f, -0.0306811873f, 0.0210381653f, -0.0136281261f,
+    0.00823560264f, -0.00456730835f, 0.00226825033f, -0.000967250147f, 0.000324334251f, -6.47355555e-05f, -6.46434728e-06f, 7.86901728e-06f,
+    7.34569621e-05f, -0.000267775147f, 0.000712501409f, -0.0015654068f, 0.00299834181f, -0.00515546836f, 0.00809609424f, -0.0117295627f,
+    0.0157510936f, -0.0195822325f, 0.0223000292f, -0.0224803966f, 0.017671084f, -0.00214852556f, -0.0478824601f, 0.919420123f,
+    0.18732731f, -0.107939556f, 0.0775596276f, -0.0579562411f, 0.0428730659f, -0.0307236593f, 0.0210413709f, -0.0136130266f,
+    0.00821495336f, -0.00454807747f, 0.0022534458f, -0.00095739594f, 0.00031864061f, -6.19464408e-05f, -7.54615257e-06f, 8.1330445e-06f,
+    7.38503732e-05f, -0.000268723554f, 0.000713968009f, -0.00156665361f, 0.00299727824f, -0.00514783291f, 0.00807453971f, -0.0116827358f,
+    0.0156627167f, -0.019430019f, 0.0220537633f, -0.0220972393f, 0.0170820635f, -0.0012120707f, -0.049610842f, 0.918656528f,
+    0.189871147f, -0.10887716f, 0.0780253559f, -0.0581955425f, 0.0429862216f, -0.0307648014f, 0.0210436191f, -0.0135972761f,
+    0.00819388218f, -0.00452859327f, 0.00223849947f, -0.00094746839f, 0.000312912685f, -5.91429525e-05f, -8.63336663e-06f, 8.39894528e-06f,
+    7.42373013e-05f, -0.000269654323f, 0.000715394912f, -0.00156782242f, 0.00299607753f, -0.00513997581f, 0.00805265736f, -0.01163546f,
+    0.0155737791f, -0.019277174f, 0.0218068995f, -0.0217137337f, 0.0164933912f, -0.000277844229f, -0.0513297468f, 0.917879283f,
+    0.192419887f, -0.109812334f, 0.0784884766f, -0.05843262f, 0.0430976078f, -0.0308046099f, 0.02104491f, -0.0135808708f,
+    0.00817239285f, -0.00450885529f, 0.00222341088f, -0.000937467848f, 0.000307150651f, -5.6325167e-05f, -9.72595535e-06f, 8.66671508e-06f,
+    7.46177684e-05f, -0.000270567485f, 0.000716782175f, -0.00156891334f, 0.00299473922f, -0.00513189798f, 0.00803044904f, -0.0115877409f,
+    0.0154842865f, -0.0191237088f, 0.0215594508f, -0.0213298965f, 0.0159050934f, 0.000654118485f, -0.053039141f, 0.917088449f,
+    0.194973484f, -0.11074505f, 0.0789489523f, -0.0586674437f, 0.0432072133f, -0.0308430754f, 0.0210452396f, -0.0135638127f,
+    0.00815048162f, -0.00448886398f, 0.00220818096f, -0.000927394431f, 0.000301354652f, -5.34931678e-05f, -1.08238828e-05f, 8.93634478e-06f,
+    7.4991789e-05f, -0.000271463068f, 0.000718129915f, -0.00156992686f, 0.0029932647f, -0.00512360083f, 0.00800791662f, -0.0115395812f,
+    0.0153942453f, -0.0189696308f, 0.0213114358f, -0.0209457465f, 0.0153171932f, 0.00158378272f, -0.054739017f, 0.916284025f,
+    0.197531864f, -0.111675255f, 0.0794067681f, -0.0589000136f, 0.0433150381f, -0.0308802016f, 0.0210446082f, -0.0135460999f,
+    0.0081281513f, -0.00446862075f, 0.00219280971f, -0.000917248544f, 0.000295524893f, -5.06470569e-05f, -1.19271144e-05f, 9.20782804e-06f,
+    7.53593704e-05f, -0.000272341043f, 0.000719438132f, -0.00157086295f, 0.00299165351f, -0.00511508482f, 0.00798506103f, -0.011490982f,
+    0.0153036583f, -0.0188149475f, 0.0210628584f, -0.0205613002f, 0.0147297159f, 0.00251111365f, -0.0564293377f, 0.91546613f,
+    0.200094968f, -0.112602882f, 0.0798618793f, -0.0591303073f, 0.0434210673f, -0.0309159793f, 0.0210430119f, -0.0135277314f,
+    0.00810540002f, -0.00444812421f, 0.0021772976f, -0.000907030364f, 0.000289661548f, -4.77869216e-05f, -1.3035612e-05f, 9.48115576e-06f,
+    7.57205198e-05f, -0.000273201556f, 0.000720707001f, -0.00157172163f, 0.00298990682f, -0.0051063518f, 0.00796188507f, -0.0114419488f,
+    0.0152125331f, -0.0186596662f, 0.0208137371f, -0.0201765765f, 0.0141426902f, 0.00343607645f, -0.0581100844f, 0.914634645f,
+    0.202662766f, -0.113527924f, 0.0803142861f, -0.0593583174f, 0.0435252972f, -0.0309504084f, 0.0210404508f, -0.0135087091f,
+    0.00808223058f, -0.0044273762f, 0.00216164486f, -0.000896740356f, 0.000283764792f, -4.49128529e-05f, -1.4149341e-05f, 9.75632247e-06f,
+    7.60752737e-05f, -0.00027404452f, 0.000721936463f, -0.00157250324f, 0.00298802438f, -0.00509740133f, 0.0079383906f, -0.0113924844f,
+    0.0151208732f, -0.0185037963f, 0.0205640811f, -0.0197915938f, 0.0135561386f, 0.00435863715f, -0.059781231f, 0.91378963f,
+    0.205235183f, -0.114450306f, 0.0807639435f, -0.0595840216f, 0.0436277203f, -0.0309834797f, 0.0210369211f, -0.0134890312f,
+    0.00805864017f, -0.00440637674f, 0.0021458522f, -0.000886378693f, 0.000277834828f, -4.20249489e-05f, -1.52682624e-05f, 1.00333173e-05f,
+    7.64236174e-05f, -0.000274870021f, 0.000723126694f, -0.00157320802f, 0.00298600714f, -0.00508823479f, 0.00791457761f, -0.0113425897f,
+    0.0150286835f, -0.0183473453f, 0.0203139018f, -0.019406369f, 0.012970088f, 0.0052787615f, -0.0614427589f, 0.912931204f,
+    0.207812175f, -0.115369983f, 0.0812108293f, -0.0598074161f, 0.0437283218f, -0.031015195f, 0.0210324246f, -0.0134686967f,
+    0.00803463161f, -0.00438512582f, 0.00212991959f, -0.000875945669f, 0.000271871773f, -3.91233007e-05f, -1.63923414e-05f, 1.03121347e-05f,
+    7.67655947e-05f, -0.000275678089f, 0.00072427775f, -0.00157383608f, 0.00298385532f, -0.00507885311f, 0.00789045077f, -0.0112922695f,
+    0.0149359703f, -0.0181903224f, 0.020063214f, -0.0190209206f, 0.0123845618f, 0.00619641505f, -0.0630946383f, 0.912059307f,
+    0.210393652f, -0.116286919f, 0.0816549286f, -0.0600284785f, 0.0438271016f, -0.0310455468f, 0.0210269578f, -0.0134477066f,
+    0.00801020302f, -0.00436362484f, 0.00211384823f, -0.000865441631f, 0.000265875889f, -3.62080063e-05f, -1.75215391e-05f, 1.05927638e-05f,
+    7.71011983e-05f, -0.000276468723f, 0.000725389691f, -0.00157438777f, 0.00298156962f, -0.00506925816f, 0.00786600914f, -0.0112415282f,
+    0.0148427384f, -0.0180327352f, 0.0198120289f, -0.0186352674f, 0.0117995879f, 0.00711156521f, -0.064736858f, 0.91117394f,
+    0.2129796f, -0.117201068f, 0.0820962042f, -0.0602472015f, 0.0439240523f, -0.0310745351f, 0.0210205186f, -0.0134260617f,
+    0.0079853572f, -0.00434187381f, 0.00209763786f, -0.000854866928f, 0.000259847351f, -3.32791606e-05f, -1.86558154e-05f, 1.08752001e-05f,
+    7.74304499e-05f, -0.000277241983f, 0.000726462516f, -0.00157486298f, 0.00297914958f, -0.005059449f, 0.00784125552f, -0.011190366f,
+    0.0147489933f, -0.0178745911f, 0.0195603557f, -0.0182494242f, 0.0112151876f, 0.00802417658f, -0.0663693771f, 0.910275221f,
+    0.215569928f, -0.118112355f, 0.0825346336f, -0.0604635589f, 0.0440191589f, -0.0311021507f, 0.0210131072f, -0.0134037593f,
+    0.00796009321f, -0.00431987271f, 0.00208128919f, -0.000844221679f, 0.000253786304f, -3.03368652e-05f, -1.97951322e-05f, 1.11594309e-05f,
+    7.77533569e-05f, -0.000277997839f, 0.000727496459f, -0.00157526217f, 0.00297659682f, -0.00504942797f, 0.00781619176f, -0.0111387875f,
+    0.0146547398f, -0.0177158974f, 0.0193082113f, -0.0178634115f, 0.0106313899f, 0.00893421657f, -0.0679921955f, 0.909363031f,
+    0.218164593f, -0.119020782f, 0.082970202f, -0.060677547f, 0.0441124253f, -0.0311283953f, 0.0210047215f, -0.0133807994f,
+    0.00793441013f, -0.00429762201f, 0.00206480222f, -0.000833506405f, 0.000247693009f, -2.73812184e-05f, -2.09394493e-05f, 1.14454479e-05f,
+    7.80699556e-05f, -0.000278736406f, 0.000728491403f, -0.00157558545f, 0.00297391112f, -0.00503919646f, 0.00779081974f, -0.0110867964f,
+    0.0145599823f, -0.0175566655f, 0.0190556068f, -0.0174772441f, 0.0100482181f, 0.00984165259f, -0.069605276f, 0.90843755f,
+    0.220763534f, -0.119926251f, 0.0834028721f, -0.0608891472f, 0.0442038327f, -0.0311532654f, 0.0209953617f, -0.013357183f,
+    0.00790831074f, -0.00427512266f, 0.00204817788f, -0.000822721398f, 0.000241567628f, -2.44123166e-05f, -2.20887268e-05f, 1.17332429e-05f,
+    7.83802461e-05f, -0.000279457687f, 0.000729447696f, -0.00157583295f, 0.00297109317f, -0.00502875354f, 0.00776514132f, -0.0110343965f,
+    0.0144647276f, -0.0173968989f, 0.0188025534f, -0.0170909427f, 0.00946569536f, 0.0107464502f, -0.0712086111f, 0.907498717f,
+    0.223366693f, -0.120828763f, 0.0838326141f, -0.0610983558f, 0.0442933813f, -0.0311767533f, 0.020985024f, -0.0133329108f,
+    0.00788179319f, -0.00425237557f, 0.0020314164f, -0.000811866892f, 0.000235410349f, -2.14302672e-05f, -2.32429265e-05f, 1.20228078e-05f,
+    7.86842502e-05f, -0.000280161708f, 0.000730365224f, -0.0015760049f, 0.00296814367f, -0.00501810154f, 0.00773915788f, -0.0109815877f,
+    0.0143689811f, -0.0172366127f, 0.0185490642f, -0.0167045239f, 0.00888384879f, 0.0116485767f, -0.0728021562f, 0.906546593f,
+    0.225974008f, -0.121728234f, 0.0842594206f, -0.0613051467f, 0.0443810634f, -0.0311988592f, 0.0209737085f, -0.0133079803f,
+    0.00785485934f, -0.00422938028f, 0.00201451848f, -0.000800943293f, 0.000229221376f, -1.84351684e-05f, -2.44020048e-05f, 1.23141308e-05f,
+    7.89819824e-05f, -0.00028084853f, 0.000731244101f, -0.00157610176f, 0.00296506262f, -0.00500724185f, 0.00771287177f, -0.0109283766f,
+    0.0142727457f, -0.0170758087f, 0.0182951503f, -0.0163180046f, 0.00830270257f, 0.0125480006f, -0.0743859261f, 0.905581176f,
+    0.228585422f, -0.122624636f, 0.0846832544f, -0.0615095124f, 0.044466868f, -0.0312195774f, 0.0209614132f, -0.0132823931f,
+    0.00782750919f, -0.0042061382f, 0.00199748459f, -0.000789950893f, 0.000223000927f, -1.54271274e-05f, -2.55659234e-05f, 1.26072036e-05f,
+    7.92734572e-05f, -0.000281518151f, 0.000732084503f, -0.00157612353f, 0.00296185073f, -0.00499617448f, 0.00768628484f, -0.0108747669f,
+    0.0141760306f, -0.0169144981f, 0.0180408247f, -0.015931407f, 0.00772228092f, 0.0134446882f, -0.0759598762f, 0.904602528f,
+    0.231200889f, -0.123517931f, 0.085104093f, -0.0617114417f, 0.0445507951f, -0.0312389079f, 0.0209481418f, -0.0132561503f,
+    0.00779974321f, -0.00418264931f, 0.0019803145f, -0.00077889004f, 0.000216749206f, -1.24062444e-05f, -2.67346368e-05f, 1.29020173e-05f,
+    7.95586893e-05f, -0.000282170629f, 0.00073288643f, -0.00157607021f, 0.00295850844f, -0.00498490036f, 0.00765939802f, -0.0108207576f,
+    0.0140788369f, -0.0167526864f, 0.0177860986f, -0.0155447396f, 0.00714260805f, 0.014338607f, -0.077523984f, 0.903610587f,
+    0.233820334f, -0.124408044f, 0.0855219141f, -0.0619109124f, 0.044632826f, -0.0312568434f, 0.0209338851f, -0.013229249f,
+    0.00777156139f, -0.00415891455f, 0.00196300936f, -0.000767761085f, 0.000210466402f, -9.37262848e-06f, -2.79081032e-05f, 1.31985589e-05f,
+    7.98377077e-05f, -0.000282805995f, 0.000733649998f, -0.0015759425f, 0.00295503624f, -0.00497342041f, 0.00763221411f, -0.0107663553f,
+    0.0139811719f, -0.0165903848f, 0.017530987f, -0.0151580274f, 0.00656370912f, 0.0152297262f, -0.0790782347f, 0.902605534f,
+    0.236443698f, -0.125294954f, 0.0859366879f, -0.0621079206f, 0.0447129644f, -0.0312733836f, 0.0209186468f, -0.0132016903f,
+    0.0077429642f, -0.00413493393f, 0.00194556976f, -0.000756564317f, 0.000204152748f, -6.32638603e-06f, -2.90862827e-05f, 1.34968213e-05f,
+    8.01105125e-05f, -0.000283424277f, 0.000734375266f, -0.00157574029f, 0.00295143505f, -0.00496173697f, 0.00760473497f, -0.0107115619f,
+    0.0138830403f, -0.0164276026f, 0.0172754992f, -0.0147712855f, 0.00598560786f, 0.0161180124f, -0.0806226209f, 0.901587248f,
+    0.239070937f, -0.126178578f, 0.0863483995f, -0.0623024479f, 0.044791203f, -0.0312885232f, 0.0209024251f, -0.0131734749f,
+    0.00771395303f, -0.00411070837f, 0.00192799582f, -0.000745300204f, 0.000197808447f, -3.26762347e-06f, -3.02691296e-05f, 1.37967909e-05f,
+    8.037714e-05f, -0.000284025533f, 0.000735062349f, -0.00157546392f, 0.0029477044f, -0.00494984956f, 0.00757696154f, -0.010656382f,
+    0.0137844495f, -0.0162643436f, 0.0170196481f, -0.0143845314f, 0.00540832942f, 0.0170034338f, -0.0821571127f, 0.900555789f,
+    0.241701961f, -0.127058923f, 0.0867570043f, -0.0624944828f, 0.0448675305f, -0.0313022658f, 0.0208852198f, -0.0131446039f,
+    0.0076845279f, -0.0040862388f, 0.001910288f, -0.000733968918f, 0.00019143369f, -1.96451069e-07f, -3.14565987e-05f, 1.40984594e-05f,
+    8.06376047e-05f, -0.000284609792f, 0.000735711423f, -0.00157511362f, 0.0029438457f, -0.00493776007f, 0.00754889753f, -0.0106008183f,
+    0.0136854015f, -0.0161006209f, 0.0167634469f, -0.0139977839f, 0.00483189756f, 0.0178859606f, -0.0836816952f, 0.899511278f,
+    0.244336739f, -0.127935916f, 0.0871625096f, -0.062684007f, 0.0449419394f, -0.0313145965f, 0.0208670292f, -0.0131150745f,
+    0.00765468925f, -0.00406152522f, 0.00189244724f, -0.000722571043f, 0.000185028723f, 2.88702154e-06f, -3.26486515e-05f, 1.44018159e-05f,
+    8.0891914e-05f, -0.000285177084f, 0.000736322487f, -0.00157468952f, 0.00293985894f, -0.00492546987f, 0.00752054295f, -0.0105448728f,
+    0.0135859046f, -0.015936438f, 0.0165069066f, -0.0136110578f, 0.00425633695f, 0.0187655594f, -0.085196346f, 0.898453653f,
+    0.246975198f, -0.128809497f, 0.0875648558f, -0.0628710166f, 0.0450144298f, -0.0313255228f, 0.0208478514f, -0.0130848894f,
+    0.00762443803f, -0.00403656857f, 0.00187447353f, -0.000711106812f, 0.000178593749f, 5.98268298e-06f, -3.38452373e-05f, 1.47068486e-05f,
+    8.11400969e-05f, -0.000285727496f, 0.000736895716f, -0.00157419196f, 0.00293574505f, -0.00491297804f, 0.00749190059f, -0.0104885511f,
+    0.0134859625f, -0.0157718062f, 0.0162500422f, -0.0132243726f, 0.00368167041f, 0.0196421985f, -0.0867010579f, 0.897382975f,
+    0.249617279f, -0.12967965f, 0.087964043f, -0.0630555004f, 0.0450849868f, -0.0313350409f, 0.0208276883f, -0.0130540468f,
+    0.00759377377f, -0.00401136978f, 0.0018563678f, -0.000699576631f, 0.000172128988f, 9.09042228e-06f, -3.50463124e-05f, 1.50135475e-05f,
+    8.1382168e-05f, -0.000286260998f, 0.000737431168f, -0.0015736213f, 0.00293150428f, -0.00490028784f, 0.00746297278f, -0.0104318541f,
+    0.0133855809f, -0.015606734f, 0.0159928612f, -0.0128377462f, 0.00310792308f, 0.0205158498f, -0.0881958008f, 0.896299243f,
+    0.25226292f, -0.130546287f, 0.0883600488f, -0.0632374287f, 0.0451536104f, -0.0313431397f, 0.0208065361f, -0.0130225485f,
+    0.00756269833f, -0.00398592884f, 0.00183813041f, -0.000687980733f, 0.000165634672f, 1.22101246e-05f, -3.62518331e-05f, 1.53218989e-05f,
+    8.16181564e-05f, -0.000286777708f, 0.000737928902f, -0.00157297752f, 0.00292713684f, -0.00488739926f, 0.00743376045f, -0.0103747873f,
+    0.0132847661f, -0.0154412277f, 0.0157353804f, -0.0124511942f, 0.00253511826f, 0.0213864818f, -0.0896805674f, 0.895202518f,
+    0.254912078f, -0.131409392f, 0.0887528285f, -0.0634168088f, 0.0452202931f, -0.0313498229f, 0.0207843967f, -0.0129903946f,
+    0.00753121171f, -0.00396024669f, 0.00181976194f, -0.000676319702f, 0.000159111019f, 1.53416768e-05f, -3.74617521e-05f, 1.56318929e-05f,
+    8.18480621e-05f, -0.000287277624f, 0.000738389092f, -0.00157226087f, 0.00292264391f, -0.00487431372f, 0.00740426593f, -0.0103173517f,
+    0.0131835211f, -0.0152752968f, 0.015477608f, -0.0120647345f, 0.00196327991f, 0.022254061f, -0.0911553279f, 0.894092858f,
+    0.257564664f, -0.132268906f, 0.0891423672f, -0.0635936186f, 0.0452850275f, -0.0313550942f, 0.0207612682f, -0.0129575841f,
+    0.00749931438f, -0.00393432425f, 0.00180126296f, -0.000664593768f, 0.000152558277f, 1.84849632e-05f, -3.86760221e-05f, 1.59435185e-05f,
+    8.20719215e-05f, -0.000287760777f, 0.000738811796f, -0.0015714718f, 0.00291802594f, -0.00486103119f, 0.00737449201f, -0.0102595529f,
+    0.0130818533f, -0.0151089495f, 0.0152195599f, -0.0116783855f, 0.00139243214f, 0.0231185574f, -0.0926200747f, 0.892970204f,
+    0.260220647f, -0.133124799f, 0.0895286575f, -0.0637678429f, 0.0453478061f, -0.0313589349f, 0.0207371488f, -0.0129241189f,
+    0.00746700726f, -0.00390816154f, 0.00178263395f, -0.000652803457f, 0.000145976635f, 2.16398657e-05f, -3.98945922e-05f, 1.62567612e-05f,
+    8.22897564e-05f, -0.000288227253f, 0.000739197189f, -0.00157061056f, 0.00291328295f, -0.00484755449f, 0.00734443963f, -0.0102013946f,
+    0.0129797682f, -0.0149421953f, 0.0149612464f, -0.0112921633f, 0.000822598173f, 0.0239799451f, -0.0940748006f, 0.891834736f,
+    0.262879908f, -0.133977026f, 0.0899116546f, -0.0639394745f, 0.0454086252f, -0.0313613527f, 0.0207120385f, -0.012889999f,
+    0.0074342913f, -0.00388176041f, 0.00176387548f, -0.000640949002f, 0.00013936637f, 2.48062715e-05f, -4.1117426e-05f, 1.65716119e-05f,
+    8.25015741e-05f, -0.000288677111f, 0.000739545329f, -0.00156967738f, 0.00290841609f, -0.00483388407f, 0.00731411064f, -0.0101428777f,
+    0.0128772715f, -0.0147750406f, 0.0147026805f, -0.0109060854f, 0.000253801642f, 0.0248381924f, -0.0955194831f, 0.890686333f,
+    0.265542448f, -0.134825513f, 0.0902913436f, -0.0641085058f, 0.0454674773f, -0.031362351f, 0.0206859391f, -0.0128552243f,
+    0.00740116742f, -0.00385512062f, 0.00174498826f, -0.000629030867f, 0.000132727684f, 2.79840569e-05f, -4.2344469e-05f, 1.68880561e-05f,
+    8.27074109e-05f, -0.000289110321f, 0.000739856332f, -0.00156867225f, 0.00290342537f, -0.0048200204f, 0.00728350785f, -0.010084006f,
+    0.012774366f, -0.0146074947f, 0.0144438725f, -0.0105201686f, -0.000313934026f, 0.0256932639f, -0.0969540924f, 0.889525056f,
+    0.268208206f, -0.135670215f, 0.0906677023f, -0.0642749146f, 0.0455243587f, -0.0313619152f, 0.0206588488f, -0.0128197949f,
+    0.00736763515f, -0.00382824335f, 0.00172597275f, -0.00061704946f, 0.000126060797f, 3.11731055e-05f, -4.35756665e-05f, 1.72060827e-05f,
+    8.29072669e-05f, -0.000289526943f, 0.000740130257f, -0.00156759552f, 0.00289831171f, -0.00480596488f, 0.00725263264f, -0.0100247851f,
+    0.0126710599f, -0.0144395642f, 0.0141848363f, -0.0101344297f, -0.000880585343f, 0.0265451353f, -0.0983786285f, 0.888350964f,
+    0.270877063f, -0.136511102f, 0.0910407007f, -0.0644386783f, 0.0455792584f, -0.0313600488f, 0.0206307638f, -0.0127837108f,
+    0.00733369589f, -0.00380112859f, 0.00170682953f, -0.000605005189f, 0.000119365985f, 3.43732936e-05f, -4.48109786e-05f, 1.75256791e-05f,
+    8.31011857e-05f, -0.00028992712f, 0.000740367337f, -0.00156644778f, 0.00289307558f, -0.00479171891f, 0.00722148735f, -0.00996521581f,
+    0.0125673581f, -0.0142712602f, 0.013925584f, -0.0097488882f, -0.00144612917f, 0.0273937769f, -0.0997930765f, 0.887164116f,
+    0.27354905f, -0.137348145f, 0.0914103165f, -0.0645998195f, 0.0456321798f, -0.0313567445f, 0.020601688f, -0.0127469748f,
+    0.00729935104f, -0.00377377821f, 0.00168755918f, -0.000592898461f, 0.00011264348f, 3.75845084e-05f, -4.60503543e-05f, 1.7846829e-05f,
+    8.32891747e-05f, -0.000290310796f, 0.000740567571f, -0.00156522891f, 0.00288771768f, -0.00477728341f, 0.00719007384f, -0.00990530383f,
+    0.012463266f, -0.0141025893f, 0.0136661278f, -0.00936355907f, -0.0020105422f, 0.0282391589f, -0.101197422f, 0.885964513f,
+    0.276224017f, -0.138181269f, 0.0917765349f, -0.0647583008f, 0.0456831083f, -0.0313520096f, 0.0205716193f, -0.0127095841f,
+    0.0072646006f, -0.0037461922f, 0.00166816229f, -0.000580729567f, 0.000105893509f, 4.08066153e-05f, -4.7293739e-05f, 1.8169525e-05f,
+    8.34712628e-05f, -0.000290678086f, 0.000740731193f, -0.00156393962f, 0.00288223801f, -0.00476265932f, 0.00715839444f, -0.00984505191f,
+    0.0123587884f, -0.0139335608f, 0.0134064788f, -0.00897845998f, -0.00257380144f, 0.0290812533f, -0.102591641f, 0.884752214f,
+    0.278901905f, -0.139010414f, 0.092139326f, -0.0649141073f, 0.04573204f, -0.0313458331f, 0.0205405578f, -0.0126715424f,
+    0.00722944597f, -0.00371837174f, 0.00164863968f, -0.00056849909f, 9.91163324e-05f, 4.40394979e-05f, -4.85410892e-05f, 1.84937489e-05f,
+    8.36474719e-05f, -0.000291028991f, 0.000740858144f, -0.00156257953f, 0.0028766375f, -0.00474784756f, 0.00712645054f, -0.00978446193f,
+    0.0122539308f, -0.0137641812f, 0.0131466482f, -0.00859360769f, -0.00313588372f, 0.0299200267f, -0.103975728f, 0.88352716f,
+    0.281582713f, -0.139835581f, 0.0924986601f, -0.0650672391f, 0.0457789674f, -0.0313382149f, 0.0205085035f, -0.0126328478f,
+    0.00719388714f, -0.00369031704f, 0.00162899168f, -0.00055620732f, 9.23121843e-05f, 4.72830288e-05f, -4.97923465e-05f, 1.88194863e-05f,
+    8.38178166e-05f, -0.000291363569f, 0.000740948773f, -0.00156114949f, 0.00287091709f, -0.00473285001f, 0.00709424447f, -0.00972353853f,
+    0.0121486997f, -0.0135944607f, 0.0128866527f, -0.00820901897f, -0.00369676622f, 0.0307554565f, -0.105349675f, 0.882289529f,
+    0.284266323f, -0.140656695f, 0.0928545371f, -0.0652176887f, 0.0458238982f, -0.0313291624f, 0.0204754528f, -0.0125935031f,
+    0.00715792505f, -0.00366202975f, 0.00160921924f, -0.000543854781f, 8.54813188e-05f, 5.05370845e-05f, -5.10474674e-05f, 1.91467298e-05f,
+    8.39823333e-05f, -0.000291681936f, 0.000741003023f, -0.00155964959f, 0.00286507723f, -0.00471766712f, 0.00706177903f, -0.00966228638f,
+    0.0120430999f, -0.0134244077f, 0.0126264999f, -0.0078247115f, -0.00425642682f, 0.0315875113f, -0.106713466f, 0.881039262f,
+    0.286952734f, -0.141473696f, 0.0932069048f, -0.0653654337f, 0.0458668135f, -0.0313186608f, 0.0204414111f, -0.0125535084f,
+    0.00712156203f, -0.00363351009f, 0.0015893227f, -0.000531441881f, 7.86239907e-05f, 5.38015411e-05f, -5.23063973e-05f, 1.94754612e-05f,
+    8.41410292e-05f, -0.000291984063f, 0.000741021126f, -0.00155807997f, 0.00285911793f, -0.0047023003f, 0.00702905422f, -0.00960070547f,
+    0.0119371377f, -0.0132540287f, 0.0123662027f, -0.00744070206f, -0.00481484085f, 0.0324161611f, -0.108067065f, 0.879776418f,
+    0.289641798f, -0.142286569f, 0.0935557559f, -0.0655104667f, 0.0459077097f, -0.0313067101f, 0.0204063728f, -0.0125128618f,
+    0.00708479667f, -0.00360475876f, 0.00156930264f, -0.000518968911f, 7.174044e-05f, 5.70762568e-05f, -5.35690742e-05f, 1.98056659e-05f,
+    8.42939335e-05f, -0.000292270037f, 0.000741003081f, -0.00155644096f, 0.00285304035f, -0.00468675094f, 0.00699607423f, -0.00953880232f,
+    0.011830816f, -0.0130833341f, 0.0121057741f, -0.00705700694f, -0.00537198735f, 0.0332413837f, -0.109410495f, 0.878500998f,
+    0.292333513f, -0.14309524f, 0.093901068f, -0.0656527653f, 0.0459465869f, -0.031293314f, 0.0203703437f, -0.012471566f,
+    0.00704763131f, -0.00357577694f, 0.00154916011f, -0.000506436452f, 6.48309287e-05f, 6.03611188e-05f, -5.48354583e-05f, 2.01373314e-05f,
+    8.44410679e-05f, -0.000292539917f, 0.000740949123f, -0.00155473303f, 0.00284684449f, -0.0046710195f, 0.00696283998f, -0.00947657973f,
+    0.0117241433f, -0.0129123311f, 0.0118452264f, -0.0066736429f, -0.00592784397f, 0.0340631418f, -0.110743716f, 0.877213061f,
+    0.295027822f, -0.143899694f, 0.0942428187f, -0.0657923371f, 0.0459834337f, -0.0312784687f, 0.020333318f, -0.0124296229f,
+    0.00701006688f, -0.00354656554f, 0.00152889523f, -0.000493844971f, 5.78957261e-05f, 6.36559926e-05f, -5.61054949e-05f, 2.04704429e-05f,
+    8.45824761e-05f, -0.00029279376f, 0.000740859366f, -0.0015529563f, 0.00284053199f, -0.00465510832f, 0.00692935474f, -0.00941404141f,
+    0.011617125f, -0.0127410283f, 0.0115845716f, -0.00629062811f, -0.00648238789f, 0.0348814204f, -0.112066738f, 0.875912666f,
+    0.297724634f, -0.144699872f, 0.0945809856f, -0.0659291595f, 0.0460182503f, -0.0312621705f, 0.0202953015f, -0.0123870317f,
+    0.00697210478f, -0.00351712527f, 0.00150850927f, -0.000481194787f, 5.09350757e-05f, 6.69607398e-05f, -5.73791294e-05f, 2.08049878e-05f,
+    8.47181509e-05f, -0.000293031568f, 0.000740733871f, -0.00155111111f, 0.00283410237f, -0.00463901693f, 0.00689561898f, -0.00935119018f,
+    0.011509764f, -0.012569434f, 0.0113238208f, -0.005907977f, -0.00703559583f, 0.0356961824f, -0.113379546f, 0.874599874f,
+    0.30042389f, -0.145495698f, 0.0949155465f, -0.0660632253f, 0.0460510291f, -0.0312444195f, 0.0202562865f, -0.0123437922f,
+    0.00693374453f, -0.00348745706f, 0.00148800237f, -0.000468486367f, 4.39492396e-05f, 7.02752441e-05f, -5.86563037e-05f, 2.1140946e-05f,
+    8.48481359e-05f, -0.000293253455f, 0.00074057281f, -0.00154919759f, 0.00282755704f, -0.00462274766f, 0.00686163502f, -0.00928802881f,
+    0.0114020687f, -0.0123975547f, 0.0110629862f, -0.00552570773f, -0.00758744683f, 0.0365074016f, -0.114682108f, 0.873274624f,
+    0.30312553f, -0.146287173f, 0.095246464f, -0.0661945269f, 0.0460817628f, -0.0312252138f, 0.0202162806f, -0.0122999074f,
+    0.00689498801f, -0.00345756183f, 0.00146737543f, -0.000455720205f, 3.69384907e-05f, 7.35993526e-05f, -5.99369669e-05f, 2.14783067e-05f,
+    8.49724456e-05f, -0.000293459452f, 0.000740376359f, -0.00154721644f, 0.00282089575f, -0.00460630143f, 0.00682740659f, -0.00922456291f,
+    0.0112940427f, -0.0122254035f, 0.0108020809f, -0.00514383661f, -0.00813791808f, 0.037315052f, -0.115974441f, 0.871936977f,
+    0.305829465f, -0.147074223f, 0.0955737457f, -0.0663230494f, 0.0461104549f, -0.0312045496f, 0.0201752782f, -0.0122553771f,
+    0.0068558366f, -0.0034274403f, 0.00144662918f, -0.000442896795f, 2.99030871e-05f, 7.6932949e-05f, -6.12210642e-05f, 2.18170535e-05f,
+    8.50911092e-05f, -0.000293649646f, 0.000740144576f, -0.00154516764f, 0.00281411991f, -0.00458967919f, 0.00679293368f, -0.00916079432f,
+    0.0111856926f, -0.012052983f, 0.010541115f, -0.00476238085f, -0.00868698768f, 0.0381191149f, -0.117256515f, 0.870587051f,
+    0.308535695f, -0.147856802f, 0.0958973467f, -0.0664487779f, 0.0461370945f, -0.0311824288f, 0.020133283f, -0.0122102024f,
+    0.00681628985f, -0.00339709339f, 0.00142576417f, -0.000430016458f, 2.28432946e-05f, 8.0275895e-05f, -6.25085377e-05f, 2.21571718e-05f,
+    8.52041485e-05f, -0.000293824036f, 0.000739877578f, -0.00154305133f, 0.00280722999f, -0.00457288232f, 0.00675822049f, -0.00909672771f,
+    0.011077024f, -0.0118803075f, 0.0102801025f, -0.00438135583f, -0.00923463423f, 0.0389195494f, -0.118528329f, 0.869224846f,
+    0.311244071f, -0.148634881f, 0.0962172523f, -0.0665717125f, 0.046161674f, -0.0311588515f, 0.020090295f, -0.0121643841f,
+    0.00677635102f, -0.00336652226f, 0.00140478124f, -0.000417079806f, 1.57593895e-05f, 8.36280451e-05f, -6.37993289e-05f, 2.24986452e-05f,
+    8.53115926e-05f, -0.00029398271f, 0.000739575655f, -0.00154086831f, 0.00280022621f, -0.00455591222f, 0.00672326703f, -0.00903236493f,
+    0.0109680407f, -0.0117073804f, 0.0100190537f, -0.00400077878f, -0.00978083443f, 0.0397163369f, -0.119789869f, 0.867850304f,
+    0.313954622f, -0.1494084f, 0.0965334401f, -0.0666918382f, 0.0461841933f, -0.0311338101f, 0.0200463142f, -0.0121179223f,
+    0.00673601916f, -0.00333572784f, 0.00138368097f, -0.000404087245f, 8.65163838e-06f, 8.69892756e-05f, -6.50933944e-05f, 2.28414574e-05f,
+    8.54134705e-05f, -0.000294125784f, 0.000739238749f, -0.00153861847f, 0.00279310951f, -0.00453876983f, 0.00668807654f, -0.00896771159f,
+    0.0108587518f, -0.0115342112f, 0.00975798257f, -0.00362066599f, -0.0103255687f, 0.0405094549f, -0.121041134f, 0.866463602f,
+    0.316667199f, -0.150177315f, 0.0968458876f, -0.0668091327f, 0.0462046526f, -0.0311073083f, 0.0200013407f, -0.0120708197f,
+    0.00669529662f, -0.00330471108f, 0.00136246416f, -0.000391039212f, 1.52031726e-06f, 9.03594409e-05f, -6.63906612e-05f, 2.31855938e-05f,
+    8.55097896e-05f, -0.000294253201f, 0.000738867035f, -0.00153630215f, 0.00278588035f, -0.00452145608f, 0.00665265135f, -0.00890276954f,
+    0.0107491594f, -0.0113608092f, 0.00949689746f, -0.00324103376f, -0.0108688148f, 0.0412988663f, -0.122282103f, 0.865064681f,
+    0.319381803f, -0.150941581f, 0.0971545726f, -0.0669236034f, 0.0462230369f, -0.0310793407f, 0.0199553706f, -0.0120230755f,
+    0.00665418338f, -0.00327347266f, 0.00134113152f, -0.000377936201f, -5.63429921e-06f, 9.37383884e-05f, -6.76910786e-05f, 2.35310363e-05f,
+    8.56006154e-05f, -0.000294365105f, 0.000738460862f, -0.00153391983f, 0.0027785399f, -0.00450397329f, 0.00661699381f, -0.00883754436f,
+    0.0106392717f, -0.0111871837f, 0.00923581421f, -0.00286189863f, -0.0114105502f, 0.0420845635f, -0.12351279f, 0.86365366f,
+    0.322098345f, -0.151701167f, 0.0974594802f, -0.0670352355f, 0.0462393537f, -0.0310499128f, 0.0199084133f, -0.0119746923f,
+    0.00661268225f, -0.00324201374f, 0.00131968374f, -0.000364778738f, -1.28119336e-05f, 9.7126016e-05f, -6.89946028e-05f, 2.38777702e-05f,
+    8.56859187e-05f, -0.000294461526f, 0.000738020113f, -0.00153147161f, 0.00277108769f, -0.00448632101f, 0.00658110483f, -0.00877203699f,
+    0.0105290907f, -0.0110133402f, 0.00897474308f, -0.00248327642f, -0.0119507536f, 0.0428664982f, -0.12473315f, 0.86223048f,
+    0.324816763f, -0.152456015f, 0.0977605805f, -0.0671440065f, 0.0462535881f, -0.0310190171f, 0.0198604614f, -0.0119256703f,
+    0.00657079276f, -0.00321033527f, 0.00129812164f, -0.000351567258f, -2.0012305e-05f, 0.000100522142f, -7.03011465e-05f, 2.42257775e-05f,
+    8.57657578e-05f, -0.000294542551f, 0.000737544964f, -0.00152895809f, 0.00276352535f, -0.00446850155f, 0.00654498721f, -0.00870625116f,
+    0.0104186265f, -0.0108392891f, 0.00871369429f, -0.0021051839f, -0.0124894045f, 0.0436446629f, -0.125943199f, 0.8607952f,
+    0.32753697f, -0.15320605f, 0.0980578586f, -0.0672499165f, 0.0462657362f, -0.0309866536f, 0.0198115185f, -0.0118760103f,
+    0.00652851723f, -0.0031784384f, 0.00127644581f, -0.000338302227f, -2.72351317e-05f, 0.000103926657f, -7.16106733e-05f, 2.45750434e-05f,
+    8.58401545e-05f, -0.00029460821f, 0.000737035647f, -0.00152637938f, 0.00275585335f, -0.00445051584f, 0.00650864281f, -0.00864019338f,
+    0.010307881f, -0.0106650367f, 0.00845268182f, -0.00172763714f, -0.0130264806f, 0.0444190241f, -0.127142921f, 0.859347999f,
+    0.330258876f, -0.153951287f, 0.0983512849f, -0.067352958f, 0.046275802f, -0.0309528243f, 0.0197615847f, -0.0118257133f,
+    0.00648585567f, -0.00314632407f, 0.00125465705f, -0.000324984139f, -3.44801301e-05f, 0.000107339401f, -7.29231178e-05f, 2.49255481e-05f,
+    8.59091451e-05f, -0.000294658559f, 0.000736492337f, -0.00152373582f, 0.00274807215f, -0.00443236483f, 0.00647207489f, -0.00857386459f,
+    0.0101968609f, -0.0104905935f, 0.00819171779f, -0.00135065219f, -0.0135619631f, 0.0451895595f, -0.128332332f, 0.857888699f,
+    0.33298251f, -0.154691622f, 0.0986408442f, -0.0674531236f, 0.0462837778f, -0.0309175272f, 0.01971066f, -0.0117747812f,
+    0.00644281041f, -0.00311399321f, 0.00123275619f, -0.000311613578f, -4.17470146e-05f, 0.000110760229f, -7.42384218e-05f, 2.52772788e-05f,
+    8.5972737e-05f, -0.000294693687f, 0.000735915091f, -0.00152102776f, 0.00274018222f, -0.00441405037f, 0.00643528486f, -0.00850726943f,
+    0.0100855725f, -0.0103159677f, 0.00793081243f, -0.000974245078f, -0.0140958279f, 0.0459562428f, -0.129511386f, 0.856417537f,
+    0.335707754f, -0.155427068f, 0.0989265218f, -0.0675503984f, 0.04628966f, -0.0308807585f, 0.0196587481f, -0.0117232157f,
+    0.00639938191f, -0.00308144721f, 0.00121074403f, -0.00029819092f, -4.90355014e-05f, 0.000114189002f, -7.5556527e-05f, 2.56302137e-05f,
+    8.60309665e-05f, -0.000294713653f, 0.000735304027f, -0.00151825557f, 0.00273218472f, -0.0043955734f, 0.0063982741f, -0.00844041072f,
+    0.00997402146f, -0.0101411669f, 0.00766997784f, -0.000598431972f, -0.0146280574f, 0.0467190519f, -0.130680099f, 0.854934454f,
+    0.338434517f, -0.156157538f, 0.0992082879f, -0.0676447675f, 0.0462934449f, -0.0308425203f, 0.0196058434f, -0.0116710169f,
+    0.00635557203f, -0.00304868654f, 0.00118862116f, -0.000284716749f, -5.63452923e-05f, 0.000117625568f, -7.68773752e-05f, 2.59843382e-05f,
+    8.608387e-05f, -0.000294718513f, 0.000734659436f, -0.00151541946f, 0.00272407988f, -0.00437693484f, 0.00636104634f, -0.00837329309f,
+    0.0098622134f, -0.00996619835f, 0.00740922615f, -0.000223228824f, -0.015158629f, 0.0474779643f, -0.131838486f, 0.85343945f,
+    0.341162801f, -0.156882986f, 0.0994861349f, -0.0677362308f, 0.0462951288f, -0.0308028162f, 0.0195519552f, -0.0116181867f,
+    0.00631138217f, -0.00301571283f, 0.00116638863f, -0.000271191559f, -6.3676096e-05f, 0.000121069796f, -7.82008938e-05f, 2.6339636e-05f,
+    8.6131462e-05f, -0.000294708356f, 0.000733981375f, -0.0015125199f, 0.00271586841f, -0.00435813703f, 0.00632360252f, -0.00830592029f,
+    0.00975015294f, -0.00979107153f, 0.00714856945f, 0.000151348489f, -0.0156875215f, 0.0482329503f, -0.132986486f, 0.851932645f,
+    0.343892485f, -0.157603398f, 0.0997600257f, -0.0678247809f, 0.0462947041f, -0.0307616387f, 0.0194970779f, -0.0115647269f,
+    0.00626681279f, -0.00298252678f, 0.00114404701f, -0.000257615815f, -7.10276363e-05f, 0.000124521524f, -7.95270389e-05f, 2.66960851e-05f,
+    8.61737644e-05f, -0.000294683181f, 0.000733269902f, -0.0015095569f, 0.00270755123f, -0.00433917949f, 0.00628594542f, -0.00823829323f,
+    0.00963784661f, -0.00961579476f, 0.00688801892f, 0.000525284035f, -0.0162147153f, 0.0489839911f, -0.134124145f, 0.850414038f,
+    0.34662351f, -0.158318698f, 0.100029945f, -0.0679103956f, 0.0462921783f, -0.0307189859f, 0.0194412116f, -0.0115106367f,
+    0.0062218653f, -0.00294912932f, 0.00112159702f, -0.000243990056f, -7.83995929e-05f, 0.000127980617f, -8.08557234e-05f, 2.70536675e-05f,
+    8.62108209e-05f, -0.000294643134f, 0.00073252531f, -0.00150653115f, 0.00269912882f, -0.00432006503f, 0.00624807738f, -0.00817041844f,
+    0.00952529814f, -0.00944037642f, 0.0066275862f, 0.000898562022f, -0.0167401899f, 0.0497310609f, -0.135251433f, 0.848883688f,
+    0.349355847f, -0.159028858f, 0.100295879f, -0.0679930747f, 0.0462875329f, -0.0306748617f, 0.0193843599f, -0.0114559187f,
+    0.00617654203f, -0.00291552232f, 0.00109903957f, -0.000230314807f, -8.57916821e-05f, 0.000131446912f, -8.2186918e-05f, 2.74123686e-05f,
+    8.62426459e-05f, -0.000294588215f, 0.000731747656f, -0.00150344288f, 0.00269060163f, -0.00430079363f, 0.00620999979f, -0.00810229871f,
+    0.00941251591f, -0.00926482398f, 0.00636728294f, 0.00127116672f, -0.0172639266f, 0.0504741333f, -0.136368349f, 0.847341657f,
+    0.352089375f, -0.159733832f, 0.100557797f, -0.0680728108f, 0.0462807789f, -0.0306292661f, 0.0193265267f, -0.0114005739f,
+    0.00613084342f, -0.00288170599f, 0.0010763756f, -0.00021659059f, -9.32036055e-05f, 0.000134920265f, -8.35205283e-05f, 2.77721665e-05f,
+    8.62692759e-05f, -0.000294518512f, 0.000730937172f, -0.00150029233f, 0.00268197083f, -0.00428136764f, 0.00617171545f, -0.00803393684f,
+    0.00929950364f, -0.00908914581f, 0.00610712124f, 0.00164308236f, -0.0177858993f, 0.05121319f, -0.137474865f, 0.845787942f,
+    0.354824036f, -0.160433546f, 0.100815684f, -0.068149589f, 0.0462718979f, -0.030582197f, 0.0192677062f, -0.0113446051f,
+    0.0060847709f, -0.00284768199f, 0.00105360569f, -0.00020281793f, -0.000100635043f, 0.000138400501f, -8.48565105e-05f, 2.81330449e-05f,
+    8.629074e-05f, -0.00029443411f, 0.000730094034f, -0.00149707997f, 0.00267323689f, -0.00426178845f, 0.00613322714f, -0.00796533842f,
+    0.00918626692f, -0.00891335122f, 0.00584711228f, 0.00201429334f, -0.0183060952f, 0.0519482084f, -0.138571039f, 0.844222605f,
+    0.35755983f, -0.161128014f, 0.101069532f, -0.0682234094f, 0.0462609008f, -0.0305336546f, 0.0192079041f, -0.0112880124f,
+    0.00603832677f, -0.00281345169f, 0.0010307309f, -0.000188997335f, -0.000108085726f, 0.000141887518f, -8.61948065e-05f, 2.84949838e-05f,
+    8.630706e-05f, -0.000294335099f, 0.000729218358f, -0.00149380602f, 0.00266440026f, -0.00424205605f, 0.00609453581f, -0.00789650436f,
+    0.00907281321f, -0.00873744674f, 0.00558726722f, 0.00238478393f, -0.0188244916f, 0.0526791662f, -0.139656812f, 0.842645705f,
+    0.360296637f, -0.161817148f, 0.101319306f, -0.0682942569f, 0.046247784f, -0.0304836389f, 0.0191471204f, -0.0112307975f,
+    0.00599151151f, -0.00277901557f, 0.00100775203f, -0.000175129375f, -0.000115555311f, 0.000145381127f, -8.75353435e-05f, 2.88579668e-05f,
+    8.63182795e-05f, -0.000294221478f, 0.00072831026f, -0.00149047107f, 0.00265546236f, -0.00422217278f, 0.00605564518f, -0.00782744121f,
+    0.00895914622f, -0.00856144354f, 0.00532759912f, 0.00275453902f, -0.0193410683f, 0.0534060374f, -0.140732214f, 0.841057241f,
+    0.363034397f, -0.162500918f, 0.101565003f, -0.0683621317f, 0.0462325364f, -0.0304321498f, 0.0190853588f, -0.0111729633f,
+    0.00594432652f, -0.0027443755f, 0.000984669663f, -0.000161214542f, -0.00012304353f, 0.000148881183f, -8.8878056e-05f, 2.9221972e-05f,
+    8.63244059e-05f, -0.000294093334f, 0.000727369916f, -0.00148707489f, 0.00264642248f, -0.0042021391f, 0.00601655617f, -0.00775814988f,
+    0.00884527154f, -0.00838534627f, 0.00506811775f, 0.00312354253f, -0.0198558047f, 0.0541287921f, -0.141797185f, 0.839457273f,
+    0.365773022f, -0.163179263f, 0.101806581f, -0.0684270039f, 0.0462151542f, -0.0303791836f, 0.0190226138f, -0.0111145088f,
+    0.00589677412f, -0.00270953192f, 0.000961484737f, -0.000147253391f, -0.000130550034f, 0.00015238754f, -9.02228785e-05f, 2.95869777e-05f,
+    8.63254681e-05f, -0.000293950783f, 0.00072639744f, -0.0014836184f, 0.00263728271f, -0.00418195734f, 0.00597727112f, -0.00768863503f,
+    0.00873119477f, -0.00820916425f, 0.00480883522f, 0.00349177956f, -0.0203686822f, 0.0548474304f, -0.142851785f, 0.837845922f,
+    0.368512481f, -0.16385217f, 0.102044031f, -0.068488881f, 0.0461956412f, -0.0303247459f, 0.0189588927f, -0.0110554378f,
+    0.00584885478f, -0.00267448649f, 0.000938198296f, -0.000133246489f, -0.000138074538f, 0.000155900008f, -9.15697528e-05f, 2.99529693e-05f,
+    8.63215173e-05f, -0.000293793855f, 0.000725393125f, -0.00148010184f, 0.00262804329f, -0.00416162796f, 0.00593779329f, -0.00761890132f,
+    0.00861692335f, -0.0080329068f, 0.00454976363f, 0.00385923451f, -0.0208796822f, 0.0555619076f, -0.143895984f, 0.836223125f,
+    0.371252686f, -0.164519563f, 0.102277339f, -0.0685477629f, 0.0461739935f, -0.0302688349f, 0.0188941918f, -0.0109957503f,
+    0.00580057036f, -0.00263924035f, 0.000914810982f, -0.000119194359f, -0.000145616723f, 0.000159418472f, -9.2918599e-05f, 3.03199249e-05f,
+    8.63125679e-05f, -0.000293622608f, 0.000724357029f, -0.00147652533f, 0.00261870469f, -0.00414115237f, 0.00589812314f, -0.00754895154f,
+    0.00850246102f, -0.00785658229f, 0.0042909137f, 0.00422589201f, -0.0213887841f, 0.0562722161f, -0.144929782f, 0.834589005f,
+    0.373993605f, -0.165181398f, 0.102506489f, -0.0686036274f, 0.0461502075f, -0.0302114487f, 0.0188285168f, -0.0109354481f,
+    0.00575192273f, -0.00260379468f, 0.000891323667f, -0.000105097555f, -0.000153176268f, 0.000162942742f, -9.42693659e-05f, 3.06878246e-05f,
+    8.6298649e-05f, -0.000293437159f, 0.000723289384f, -0.00147288933f, 0.0026092676f, -0.00412053242f, 0.00585826486f, -0.00747878943f,
+    0.00838781521f, -0.00768019678f, 0.00403229753f, 0.00459173741f, -0.0218959674f, 0.05697833f, -0.145953193f, 0.832943499f,
+    0.376735151f, -0.16583766f, 0.102731451f, -0.0686564744f, 0.0461242869f, -0.0301525909f, 0.0187618677f, -0.010874535f,
+    0.00570291374f, -0.00256815087f, 0.000867737399f, -9.0956637e-05f, -0.000160752868f, 0.000166472717f, -9.56219956e-05f, 3.10566465e-05f,
+    8.6279797e-05f, -0.000293237565f, 0.000722190307f, -0.00146919431f, 0.00259973318f, -0.00409976859f, 0.00581821986f, -0.00740841823f,
+    0.00827298965f, -0.00750376051f, 0.00377392536f, 0.00495675486f, -0.0224012174f, 0.0576802306f, -0.146966189f, 0.831286788f,
+    0.379477262f, -0.16648832f, 0.102952205f, -0.0687062964f, 0.0460962132f, -0.030092258f, 0.0186942462f, -0.0108130099f,
+    0.00565354386f, -0.00253230962f, 0.000844052876f, -7.67721576e-05f, -0.000168346189f, 0.000170008163f, -9.69764005e-05f, 3.14263743e-05f,
+    8.62560337e-05f, -0.000293023855f, 0.000721059914f, -0.00146544049f, 0.00259010168f, -0.00407886319f, 0.00577799045f, -0.00733784214f,
+    0.00815798994f, -0.00732728047f, 0.00351580954f, 0.00532092899f, -0.0229045097f, 0.0583778918f, -0.147968784f, 0.829618812f,
+    0.382219851f, -0.167133257f, 0.103168748f, -0.0687530711f, 0.0460660011f, -0.0300304517f, 0.0186256506f, -0.0107508749f,
+    0.00560381496f, -0.00249627279f, 0.000820271089f, -6.25446773e-05f, -0.000175955924f, 0.000173548964f, -9.83325153e-05f, 3.17969825e-05f,
+    8.62273882e-05f, -0.000292796118f, 0.00071989838f, -0.00146162824f, 0.00258037401f, -0.0040578167f, 0.0057375785f, -0.00726706395f,
+    0.00804282259f, -0.00715076504f, 0.00325796101f, 0.00568424584f, -0.0234058294f, 0.059071295f, -0.148960963f, 0.827939689f,
+    0.384962827f, -0.167772487f, 0.103381045f, -0.0687968135f, 0.0460336357f, -0.0299671721f, 0.0185560845f, -0.0106881326f,
+    0.0055537289f, -0.00246004132f, 0.000796392851f, -4.82747746e-05f, -0.000183581753f, 0.000177094931f, -9.96902963e-05f, 3.21684565e-05f,
+    8.61939043e-05f, -0.000292554469f, 0.000718705996f, -0.00145775802f, 0.00257055066f, -0.00403663004f, 0.0056969868f, -0.00719608832f,
+    0.00792749319f, -0.00697422307f, 0.00300039095f, 0.00604668958f, -0.0239051543f, 0.0597604215f, -0.149942756f, 0.826249421f,
+    0.38770619f, -0.168405965f, 0.103589088f, -0.0688375011f, 0.0459991246f, -0.0299024209f, 0.0184855517f, -0.0106247859f,
+    0.005503288f, -0.00242361659f, 0.000772419036f, -3.3963006e-05f, -0.000191223342f, 0.000180645933f, -0.000101049642f, 3.25407709e-05f,
+    8.61555964e-05f, -0.000292298937f, 0.000717482879f, -0.00145383005f, 0.00256063254f, -0.00401530648f, 0.00565621769f, -0.00712491898f,
+    0.0078120064f, -0.00679766154f, 0.00274311122f, 0.00640824577f, -0.0244024694f, 0.0604452565f, -0.150914118f, 0.824548006f,
+    0.390449822f, -0.169033632f, 0.103792861f, -0.068875134f, 0.0459624603f, -0.0298361983f, 0.0184140503f, -0.0105608348f,
+    0.00545249274f, -0.00238699978f, 0.000748350692f, -1.96099445e-05f, -0.000198880371f, 0.000184201795f, -0.000102410515f, 3.29139039e-05f,
+    8.61125081e-05f, -0.000292029639f, 0.000716229086f, -0.0014498448f, 0.00255062059f, -0.00399384508f, 0.00561527256f, -0.00705355871f,
+    0.0076963692f, -0.00662108976f, 0.00248613232f, 0.00676889904f, -0.0248977561f, 0.0611257702f, -0.151875094f, 0.822835624f,
+    0.393193722f, -0.169655442f, 0.103992335f, -0.0689096898f, 0.0459236428f, -0.0297685061f, 0.018341586f, -0.010496282f,
+    0.00540134497f, -0.00235019252f, 0.000724188634f, -5.21617267e-06f, -0.000206552504f, 0.000187762344f, -0.000103772822f, 3.32878371e-05f,
+    8.60646542e-05f, -0.000291746575f, 0.000714944908f, -0.00144580263f, 0.00254051504f, -0.00397224864f, 0.00557415467f, -0.00698201219f,
+    0.00758058624f, -0.00644451473f, 0.00222946587f, 0.00712863496f, -0.0253909919f, 0.0618019402f, -0.152825654f, 0.821112216f,
+    0.395937741f, -0.170271367f, 0.104187496f, -0.0689411908f, 0.0458826683f, -0.0296993405f, 0.0182681549f, -0.0104311286f,
+    0.00534984702f, -0.00231319573f, 0.000699933735f, 9.21773426e-06f, -0.000214239422f, 0.000191327446f, -0.000105136511f, 3.3662549e-05f,
+    8.60120781e-05f, -0.000291449862f, 0.000713630521f, -0.00144170376f, 0.00253031729f, -0.00395051716f, 0.00553286588f, -0.00691028219f,
+    0.00746466313f, -0.00626794528f, 0.00197312259f, 0.00748743908f, -0.0258821603f, 0.0624737628f, -0.153765813f, 0.81937784f,
+    0.398681879f, -0.170881346f, 0.104378343f, -0.0689696074f, 0.0458395407f, -0.029628709f, 0.0181937609f, -0.0103653772f,
+    0.00529799983f, -0.00227601081f, 0.000675586984f, 2.36911928e-05f, -0.000221940791f, 0.0001948969f, -0.000106501502f, 3.40380175e-05f,
+    8.5954809e-05f, -0.000291139615f, 0.000712285982f, -0.00143754866f, 0.0025200271f, -0.0039286539f, 0.00549140852f, -0.00683837244f,
+    0.00734860543f, -0.00609138934f, 0.00171711436f, 0.00784529652f, -0.0263712462f, 0.0631412044f, -0.15469557f, 0.817632556f,
+    0.401426017f, -0.17148535f, 0.104564831f, -0.0689949319f, 0.0457942523f, -0.0295566041f, 0.0181184094f, -0.0102990298f,
+    0.00524580572f, -0.0022386394f, 0.000651149312f, 3.82036123e-05f, -0.000229656289f, 0.000198470545f, -0.000107867738f, 3.44142209e-05f,
+    8.58928688e-05f, -0.000290815864f, 0.000710911525f, -0.00143333769f, 0.00250964588f, -0.00390665792f, 0.00544978445f, -0.00676628714f,
+    0.00723241922f, -0.00591485435f, 0.00146145164f, 0.00820219144f, -0.0268582273f, 0.0638042465f, -0.155614927f, 0.815876484f,
+    0.404170096f, -0.172083318f, 0.10474696f, -0.0690171793f, 0.0457468033f, -0.0294830333f, 0.0180420987f, -0.0102320882f,
+    0.00519326609f, -0.00220108218f, 0.000626621535f, 5.27544071e-05f, -0.000237385568f, 0.000202048221f, -0.000109235138f, 3.47911373e-05f,
+    8.58263011e-05f, -0.000290478667f, 0.000709507382f, -0.00142907142f, 0.00249917433f, -0.00388453272f, 0.00540799694f, -0.00669402955f,
+    0.00711611006f, -0.00573834917f, 0.00120614585f, 0.0085581122f, -0.0273430869f, 0.0644628853f, -0.156523883f, 0.814109504f,
+    0.406914085f, -0.172675252f, 0.104924709f, -0.0690363199f, 0.0456971936f, -0.0294079948f, 0.0179648325f, -0.0101645542f,
+    0.0051403828f, -0.00216334104f, 0.000602004817f, 6.73429822e-05f, -0.000245128293f, 0.000205629767f, -0.000110603636f, 3.51687449e-05f,
+    8.57551277e-05f, -0.000290128111f, 0.00070807361f, -0.00142474973f, 0.00248861313f, -0.00386227784f, 0.00536604738f, -0.00662160385f,
+    0.00699968217f, -0.00556188123f, 0.00095120765f, 0.00891304109f, -0.02782581f, 0.065117076f, -0.157422423f, 0.812331796f,
+    0.409657866f, -0.173261046f, 0.105098054f, -0.0690523461f, 0.0456454158f, -0.0293314885f, 0.017886607f, -0.0100964298f,
+    0.00508715771f, -0.00212541712f, 0.000577299914f, 8.19687339e-05f, -0.000252884085f, 0.000209214995f, -0.000111973146f, 3.55470183e-05f,
+    8.56793849e-05f, -0.000289764343f, 0.000706610561f, -0.00142037356f, 0.00247796276f, -0.00383989583f, 0.00532393809f, -0.00654901285f,
+    0.00688314298f, -0.00538545894f, 0.000696648436f, 0.00926696695f, -0.0283063743f, 0.0657668263f, -0.158310577f, 0.810543418f,
+    0.412401438f, -0.173840702f, 0.105267003f, -0.0690652803f, 0.0455914773f, -0.0292535182f, 0.0178074315f, -0.0100277169f,
+    0.00503359223f, -0.00208731228f, 0.000552507874f, 9.66310763e-05f, -0.000260652712f, 0.000212803774f, -0.000113343624f, 3.59259393e-05f,
+    8.55990947e-05f, -0.000289387302f, 0.000705118233f, -0.00141594291f, 0.00246722414f, -0.00381738762f, 0.00528167188f, -0.00647626119f,
+    0.00676649716f, -0.00520909019f, 0.000442478864f, 0.00961987209f, -0.0287847687f, 0.0664120987f, -0.15918833f, 0.808744371f,
+    0.415144652f, -0.174414173f, 0.105431512f, -0.0690750778f, 0.0455353744f, -0.0291740838f, 0.0177273043f, -0.00995841902f,
+    0.00497968867f, -0.00204902701f, 0.000527629629f, 0.000111329398f, -0.000268433709f, 0.0002163959f, -0.000114714981f, 3.63054824e-05f,
+    8.55143153e-05f, -0.000288997224f, 0.000703596859f, -0.00141145824f, 0.00245639822f, -0.00379475462f, 0.00523925107f, -0.00640335213f,
+    0.00664975028f, -0.00503278244f, 0.000188710037f, 0.00997174531f, -0.0292609688f, 0.0670528933f, -0.160055712f, 0.806934655f,
+    0.417887509f, -0.174981415f, 0.10559158f, -0.0690817684f, 0.0454771072f, -0.0290931873f, 0.0176462308f, -0.0098885363f,
+    0.00492544891f, -0.00201056385f, 0.000502666226f, 0.000126063082f, -0.000276226841f, 0.000219991212f, -0.000116087147f, 3.66856293e-05f,
+    8.54250393e-05f, -0.000288594048f, 0.000702046615f, -0.00140692003f, 0.00244548544f, -0.00377199799f, 0.00519667752f, -0.00633028895f,
+    0.00653290749f, -0.00485654455f, -6.46472326e-05f, 0.0103225699f, -0.0297349636f, 0.0676891729f, -0.160912693f, 0.805114388f,
+    0.420629919f, -0.175542355f, 0.105747178f, -0.0690853223f, 0.0454166681f, -0.0290108286f, 0.0175642073f, -0.00981807243f,
+    0.00487087388f, -0.00197192305f, 0.000477618451f, 0.000140831529f, -0.000284031703f, 0.000223589523f, -0.000117460055f, 3.70663511e-05f,
+    8.5331325e-05f, -0.000288177951f, 0.000700467732f, -0.00140232849f, 0.00243448652f, -0.00374911912f, 0.00515395356f, -0.00625707535f,
+    0.00641597528f, -0.00468038395f, -0.000317582046f, 0.0106723337f, -0.0302067287f, 0.06832093f, -0.161759272f, 0.803283632f,
+    0.423371792f, -0.176096976f, 0.105898291f, -0.069085747f, 0.0453540646f, -0.0289270077f, 0.0174812414f, -0.00974702928f,
+    0.00481596682f, -0.0019331068f, 0.000452487468f, 0.00015563413f, -0.000291847944f, 0.0002271907f, -0.000118833625f, 3.74476258e-05f,
+    8.52332014e-05f, -0.000287748931f, 0.000698860327f, -0.0013976841f, 0.00242340262f, -0.00372611964f, 0.00511108199f, -0.00618371554f,
+    0.00629895832f, -0.00450430857f, -0.000570083677f, 0.0110210227f, -0.0306762531f, 0.0689481571f, -0.162595496f, 0.801442385f,
+    0.426113069f, -0.176645249f, 0.106044918f, -0.0690830275f, 0.0452892892f, -0.0288417321f, 0.0173973311f, -0.00967540778f,
+    0.00476072868f, -0.00189411629f, 0.000427274208f, 0.000170470259f, -0.000299675216f, 0.000230794525f, -0.000120207784f, 3.78294317e-05f,
+    8.51306977e-05f, -0.000287307135f, 0.000697224634f, -0.00139298732f, 0.00241223397f, -0.00370300049f, 0.0050680642f, -0.00611021323f,
+    0.00618186267f, -0.00432832632f, -0.000822141243f, 0.0113686202f, -0.0311435182f, 0.0695708171f, -0.163421333f, 0.799590707f,
+    0.42885372f, -0.177187115f, 0.106187031f, -0.0690771639f, 0.045222342f, -0.0287549961f, 0.0173124839f, -0.00960321166f,
+    0.00470516132f, -0.00185495312f, 0.000401979632f, 0.000185339304f, -0.000307513226f, 0.000234400854f, -0.000121582467f, 3.82117469e-05f,
+    8.50238357e-05f, -0.000286852621f, 0.000695560768f, -0.00138823839f, 0.0024009815f, -0.00367976353f, 0.00502490345f, -0.00603657169f,
+    0.00606469344f, -0.00415244559f, -0.00107374403f, 0.011715116f, -0.031608507f, 0.0701889098f, -0.164236799f, 0.797728717f,
+    0.431593627f, -0.177722529f, 0.106324613f, -0.0690681487f, 0.045153223f, -0.0286668036f, 0.017226696f, -0.00953044277f,
+    0.00464926753f, -0.00181561837f, 0.000376604788f, 0.000200240611f, -0.000315361569f, 0.000238009496f, -0.000122957586f, 3.85945423e-05f,
+    8.49126736e-05f, -0.000286385446f, 0.00069386902f, -0.00138343789f, 0.00238964614f, -0.00365640991f, 0.00498160161f, -0.00596279465f,
+    0.00594745623f, -0.00397667335f, -0.00132488133f, 0.0120604942f, -0.032071203f, 0.0708024129f, -0.165041909f, 0.795856416f,
+    0.434332728f, -0.178251475f, 0.106457658f, -0.0690559819f, 0.0450819358f, -0.0285771582f, 0.0171399731f, -0.00945710298f,
+    0.00459304824f, -0.00177611399f, 0.000351150637f, 0.000215173597f, -0.000323219894f, 0.000241620291f, -0.000124333092f, 3.89778033e-05f,
+    8.47972115e-05f, -0.000285905699f, 0.00069214945f, -0.00137858605f, 0.00237822859f, -0.00363294082f, 0.004938161f, -0.00588888582f,
+    0.00583015708f, -0.003801018f, -0.00157554261f, 0.0124047417f, -0.0325315893f, 0.0714112967f, -0.165836647f, 0.793973804f,
+    0.437070996f, -0.17877388f, 0.106586143f, -0.0690406412f, 0.0450084843f, -0.02848606f, 0.017052317f, -0.00938319508f,
+    0.00453650625f, -0.00173644116f, 0.000325618224f, 0.000230137593f, -0.000331087853f, 0.000245233037f, -0.000125708888f, 3.93614973e-05f,
+    8.46775074e-05f, -0.000285413495f, 0.000690402288f, -0.0013736831f, 0.00236672955f, -0.00360935763f, 0.00489458442f, -0.0058148494f,
+    0.00571280112f, -0.00362548744f, -0.00182571716f, 0.0127478447f, -0.032989651f, 0.0720155686f, -0.166621029f, 0.792080939f,
+    0.439808369f, -0.179289714f, 0.106710061f, -0.0690221488f, 0.0449328534f, -0.0283935107f, 0.0169637296f, -0.00930872187f,
+    0.00447964296f, -0.00169660151f, 0.000300008571f, 0.000245132018f, -0.000338965125f, 0.000248847587f, -0.000127084888f, 3.97456024e-05f,
+    8.4553576e-05f, -0.000284908863f, 0.00068862777f, -0.00136872975f, 0.00235514971f, -0.00358566223f, 0.00485087326f, -0.00574068818f,
+    0.00559539394f, -0.00345008913f, -0.00207539438f, 0.0130897881f, -0.0334453695f, 0.0726151988f, -0.16739507f, 0.790177941f,
+    0.442544699f, -0.179798931f, 0.10682939f, -0.0690004826f, 0.0448550545f, -0.0282995123f, 0.0168742165f, -0.00923368428f,
+    0.00442246022f, -0.00165659632f, 0.000274322665f, 0.000260156172f, -0.000346851302f, 0.000252463738f, -0.000128461048f, 4.01300967e-05f,
+    8.4425461e-05f, -0.000284391892f, 0.00068682601f, -0.00136372633f, 0.00234349002f, -0.00356185529f, 0.00480703032f, -0.00566640589f,
+    0.00547794066f, -0.00327483146f, -0.00232456392f, 0.0134305619f, -0.0338987336f, 0.0732101798f, -0.168158755f, 0.788264871f,
+    0.445279986f, -0.180301517f, 0.106944114f, -0.0689756423f, 0.0447750799f, -0.0282040685f, 0.0167837739f, -0.00915808696f,
+    0.00436496129f, -0.00161642744f, 0.000248561584f, 0.00027520943f, -0.000354746036f, 0.000256081345f, -0.000129837295f, 4.05149513e-05f,
+    8.42931913e-05f, -0.000283862697f, 0.000684997183f, -0.00135867298f, 0.0023317507f, -0.00353793846f, 0.00476305792f, -0.00559200672f,
+    0.00536044734f, -0.00309972139f, -0.0025732147f, 0.0137701491f, -0.0343497172f, 0.0738004744f, -0.168912113f, 0.786341667f,
+    0.44801414f, -0.180797383f, 0.107054219f, -0.0689476207f, 0.0446929373f, -0.0281071756f, 0.0166924074f, -0.00908192992f,
+    0.00430714665f, -0.00157609605f, 0.000222726332f, 0.000290291151f, -0.000362648978f, 0.000259700144f, -0.000131213514f, 4.09001404e-05f,
+    8.41568035e-05f, -0.000283321366f, 0.000683141581f, -0.00135357049f, 0.00231993338f, -0.0035139136f, 0.0047189584f, -0.0055174944f,
+    0.00524291862f, -0.00292476756f, -0.00282133697f, 0.0141085377f, -0.0347983167f, 0.07438609f, -0.169655144f, 0.78440851f,
+    0.450747073f, -0.181286529f, 0.107159689f, -0.0689164102f, 0.0446086191f, -0.0280088428f, 0.0166001245f, -0.00900521874f,
+    0.00424901955f, -0.00153560401f, 0.000196817971f, 0.000305400754f, -0.000370559777f, 0.000263320078f, -0.000132589659f, 4.12856498e-05f,
+    8.40163266e-05f, -0.000282767898f, 0.000681259262f, -0.00134841877f, 0.00230803806f, -0.00348978117f, 0.00467473408f, -0.00544287171f,
+    0.00512536103f, -0.00274997717f, -0.00306891976f, 0.0144457147f, -0.0352445096f, 0.0749670118f, -0.170387849f, 0.782465398f,
+    0.453478754f, -0.181768909f, 0.107260518f, -0.0688820109f, 0.0445221327f, -0.0279090684f, 0.0165069215f, -0.0089279525f,
+    0.00419058139f, -0.00149495259f, 0.00017083752f, 0.000320537511f, -0.000378478027f, 0.000266940886f, -0.00013396563f, 4.16714429e-05f,
+    8.3871797e-05f, -0.000282202498f, 0.000679350458f, -0.00134321873f, 0.00229606614f, -0.00346554327f, 0.00463038683f, -0.00536814379f,
+    0.00500777923f, -0.00257535814f, -0.00331595307f, 0.0147816679f, -0.0356882811f, 0.0755432174f, -0.171110228f, 0.780512333f,
+    0.456209093f, -0.182244465f, 0.107356675f, -0.0688444227f, 0.0444334708f, -0.0278078523f, 0.0164128039f, -0.00885013584f,
+    0.00413183449f, -0.00145414355f, 0.00014478607f, 0.000335700781f, -0.000386403408f, 0.000270562392f, -0.000135341383f, 4.20575016e-05f,
+    8.37232365e-05f, -0.000281625136f, 0.000677415461f, -0.00133797037f, 0.00228401762f, -0.00344120106f, 0.00458592037f, -0.00529331248f,
+    0.0048901788f, -0.00240091793f, -0.00356242643f, 0.0151163805f, -0.0361296125f, 0.0761146918f, -0.171822295f, 0.778549492f,
+    0.458938032f, -0.182713166f, 0.107448176f, -0.0688036382f, 0.0443426408f, -0.0277052037f, 0.0163177717f, -0.0087717697f,
+    0.00407278072f, -0.00141317816f, 0.000118664684f, 0.000350889924f, -0.00039433554f, 0.000274184451f, -0.000136716815f, 4.24437967e-05f,
+    8.3570696e-05f, -0.000281035958f, 0.000675454328f, -0.00133267441f, 0.00227189413f, -0.0034167557f, 0.00454133516f, -0.00521838339f,
+    0.00477256533f, -0.00222666422f, -0.00380832958f, 0.0154498443f, -0.0365684964f, 0.0766814128f, -0.172524065f, 0.776576757f,
+    0.461665511f, -0.183174968f, 0.107534975f, -0.06875965f, 0.0442496426f, -0.0276011191f, 0.0162218325f, -0.00869285874f,
+    0.00401342241f, -0.00137205841f, 9.24743872e-05f, 0.000366104272f, -0.000402274047f, 0.00027780683f, -0.000138091869f, 4.28303028e-05f,
+    8.34141902e-05f, -0.000280435022f, 0.000673467293f, -0.00132733083f, 0.00225969614f, -0.00339220907f, 0.00449663494f, -0.00514335837f,
+    0.00465494441f, -0.00205260515f, -0.00405365229f, 0.0157820433f, -0.0370049104f, 0.0772433877f, -0.173215553f, 0.774594307f,
+    0.46439144f, -0.183629841f, 0.107617073f, -0.068712458f, 0.0441544726f, -0.0274956003f, 0.0161249824f, -0.00861340482f,
+    0.00395376235f, -0.00133078569f, 6.62162856e-05f, 0.000381343183f, -0.000410218578f, 0.000281429384f, -0.000139466443f, 4.32169982e-05f,
+    8.32537698e-05f, -0.000279822445f, 0.000671454589f, -0.00132194045f, 0.00224742386f, -0.00336756231f, 0.00445182109f, -0.00506824255f,
+    0.00453732116f, -0.00187874807f, -0.0042983843f, 0.0161129627f, -0.0374388471f, 0.0778005868f, -0.17389676f, 0.772602141f,
+    0.46711579f, -0.18407774f, 0.107694454f, -0.0686620623f, 0.0440571345f, -0.0273886546f, 0.0160272326f, -0.00853341166f,
+    0.00389380194f, -0.00128936151f, 3.98914526e-05f, 0.000396605988f, -0.000418168755f, 0.000285051909f, -0.000140840479f, 4.36038536e-05f,
+    8.30894569e-05f, -0.000279198255f, 0.000669416273f, -0.00131650351f, 0.00223507895f, -0.00334281661f, 0.00440689642f, -0.00499303825f,
+    0.00441970071f, -0.00170510018f, -0.00454251468f, 0.016442595f, -0.0378702804f, 0.0783529952f, -0.174567685f, 0.770600379f,
+    0.469838411f, -0.184518605f, 0.107767105f, -0.0686084479f, 0.0439576246f, -0.0272802804f, 0.0159285795f, -0.00845287926f,
+    0.00383354304f, -0.00124778773f, 1.35009641e-05f, 0.00041189199f, -0.00042612417f, 0.00028867423f, -0.000142213874f, 4.39908363e-05f,
+    8.29212877e-05f, -0.000278562569f, 0.000667352753f, -0.00131102034f, 0.00222266186f, -0.00331797358f, 0.00436186371f, -0.00491775014f,
+    0.00430208957f, -0.00153166964f, -0.00478603458f, 0.0167709254f, -0.0382992066f, 0.0789006129f, -0.175228342f, 0.76858902f,
+    0.472559333f, -0.184952453f, 0.107835025f, -0.0685516298f, 0.043855954f, -0.027170483f, 0.0158290286f, -0.00837181229f,
+    0.00377298915f, -0.00120606576f, -1.29540858e-05f, 0.000427200575f, -0.000434084504f, 0.000292296172f, -0.000143586571f, 4.4377939e-05f,
+    8.27492986e-05f, -0.000277915475f, 0.00066526403f, -0.00130549143f, 0.00221017282f, -0.00329303462f, 0.00431672391f, -0.00484238099f,
+    0.00418449193f, -0.00135846389f, -0.00502893375f, 0.0170979388f, -0.0387256071f, 0.07944341f, -0.175878748f, 0.766568124f,
+    0.475278378f, -0.185379177f, 0.107898176f, -0.0684915856f, 0.0437521115f, -0.0270592626f, 0.0157285817f, -0.0082902126f,
+    0.00371214119f, -0.00116419722f, -3.94726012e-05f, 0.000442531018f, -0.000442049321f, 0.000295917533f, -0.000144958482f, 4.47651146e-05f,
+    8.2573526e-05f, -0.000277257088f, 0.000663150451f, -0.00129991723f, 0.00219761371f, -0.00326800114f, 0.00427148072f, -0.00476693548f,
+    0.00406691432f, -0.0011854904f, -0.00527120195f, 0.0174236242f, -0.0391494669f, 0.0799813941f, -0.176518932f, 0.764537752f,
+    0.477995604f, -0.185798794f, 0.107956573f, -0.0684283301f, 0.0436461121f, -0.0269466247f, 0.0156272445f, -0.00820808485f,
+    0.00365100196f, -0.00112218386f, -6.60534861e-05f, 0.000457882677f, -0.000450018328f, 0.000299538136f, -0.000146329548f, 4.51523556e-05f,
+    8.23939918e-05f, -0.000276587409f, 0.000661012076f, -0.00129429798f, 0.00218498404f, -0.00324287429f, 0.00422613602f, -0.0046914164f,
+    0.00394936046f, -0.00101275661f, -0.00551282801f, 0.0177479684f, -0.0395707712f, 0.0805145279f, -0.177148849f, 0.762497962f,
+    0.480710864f, -0.186211213f, 0.10801018f, -0.0683618411f, 0.0435379408f, -0.0268325675f, 0.0155250179f, -0.00812542904f,
+    0.00358957378f, -0.00108002732f, -9.269562e-05f, 0.000473254826f, -0.00045799106f, 0.000303157751f, -0.000147699669f, 4.55396148e-05f,
+    8.22107322e-05f, -0.000275906583f, 0.000658849196f, -0.00128863438f, 0.00217228546f, -0.00321765593f, 0.00418069214f, -0.00461582793f,
+    0.00383183733f, -0.000840270135f, -0.005753804f, 0.0180709641f, -0.039989505f, 0.0810428113f, -0.177768573f, 0.760448754f,
+    0.483424097f, -0.186616436f, 0.108058996f, -0.0682921335f, 0.0434276089f, -0.0267171003f, 0.0154219065f, -0.00804225076f,
+    0.00352785923f, -0.00103772921f, -0.000119397904f, 0.000488646852f, -0.000465967198f, 0.000306776259f, -0.000149068743f, 4.59268849e-05f,
+    8.2023791e-05f, -0.000275214697f, 0.000656661927f, -0.00128292653f, 0.00215951866f, -0.00319234701f, 0.00413515046f, -0.00454017334f,
+    0.00371434982f, -0.000668038381f, -0.00599411875f, 0.0183925889f, -0.0404056571f, 0.0815662369f, -0.17837806f, 0.758390307f,
+    0.486135244f, -0.187014416f, 0.108103007f, -0.0682191923f, 0.0433151126f, -0.0266002212f, 0.0153179104f, -0.00795855094f,
+    0.00346585969f, -0.000995291281f, -0.000146159218f, 0.000504057971f, -0.000473946333f, 0.000310393429f, -0.000150436739f, 4.63141259e-05f,
+    8.18332046e-05f, -0.00027451184f, 0.000654450501f, -0.00127717492f, 0.0021466841f, -0.00316694914f, 0.00408951519f, -0.00446445681f,
+    0.00359690282f, -0.000496068795f, -0.00623376248f, 0.0187128391f, -0.0408192091f, 0.0820847899f, -0.178977326f, 0.756322563f,
+    0.488844216f, -0.187405095f, 0.108142197f, -0.0681430101f, 0.0432004631f, -0.0264819339f, 0.015213035f, -0.0078743333f,
+    0.00340357819f, -0.000952715112f, -0.000172978442f, 0.000519487599f, -0.000481928088f, 0.000314009056f, -0.000151803528f, 4.67013124e-05f,
+    8.16389875e-05f, -0.000273798039f, 0.000652215094f, -0.00127138011f, 0.00213378295f, -0.00314146373f, 0.00404378679f, -0.00438868115f,
+    0.00347950193f, -0.000324368884f, -0.00647272589f, 0.0190316997f, -0.041230157f, 0.0825984553f, -0.179566443f, 0.754245579f,
+    0.491551012f, -0.187788442f, 0.108176567f, -0.0680636168f, 0.0430836529f, -0.026362244f, 0.0151072852f, -0.00778960157f,
+    0.00334101683f, -0.000910002447f, -0.000199854432f, 0.000534935039f, -0.000489912054f, 0.000317623024f, -0.00015316908f, 4.70884261e-05f,
+    8.14411833e-05f, -0.000273073441f, 0.000649955997f, -0.00126554235f, 0.00212081568f, -0.00311589218f, 0.00399796898f, -0.00431285007f,
+    0.00336215249f, -0.000152946013f, -0.00671099918f, 0.0193491597f, -0.0416384749f, 0.0831072256f, -0.180145368f, 0.752159536f,
+    0.494255483f, -0.188164443f, 0.108206086f, -0.0679809749f, 0.042964682f, -0.0262411516f, 0.0150006628f, -0.00770435669f,
+    0.0032781784f, -0.000867155031f, -0.000226786069f, 0.000550399534f, -0.000497897912f, 0.000321235071f, -0.000154533263f, 4.74754306e-05f,
+    8.1239843e-05f, -0.000272338133f, 0.000647673267f, -0.00125966198f, 0.00210778345f, -0.00309023564f, 0.00395206315f, -0.00423696777f,
+    0.0032448601f, 1.81924825e-05f, -0.00694857212f, 0.019665204f, -0.0420441553f, 0.083611086f, -0.180714116f, 0.750064313f,
+    0.4969576f, -0.188533038f, 0.108230755f, -0.0678950921f, 0.0428435653f, -0.0261186603f, 0.0148931714f, -0.0076186033f,
+    0.00321506453f, -0.000824174553f, -0.000253772188f, 0.000565880386f, -0.000505885226f, 0.000324845023f, -0.000155896036f, 4.78623006e-05f,
+    8.10349666e-05f, -0.000271592173f, 0.000645367196f, -0.0012537397f, 0.0020946865f, -0.00306449598f, 0.00390607258f, -0.0041610375f,
+    0.0031276294f, 0.00018903923f, -0.00718543539f, 0.0199798252f, -0.042447187f, 0.0841100141f, -0.181272715f, 0.747960091f,
+    0.499657273f, -0.188894168f, 0.108250558f, -0.0678059757f, 0.042720288f, -0.025994774f, 0.0147848129f, -0.00753234373f,
+    0.00315167825f, -0.000781062641f, -0.000280811713f, 0.000581376953f, -0.000513873587f, 0.000328452676f, -0.00015725728f, 4.82490104e-05f,
+    8.08266122e-05f, -0.000270835619f, 0.000643037958f, -0.00124777574f, 0.00208152598f, -0.00303867436f, 0.00385999843f, -0.004085063f,
+    0.00301046623f, 0.000359586906f, -0.00742157968f, 0.0202930067f, -0.0428475514f, 0.0846040249f, -0.181821182f, 0.745846927f,
+    0.502354443f, -0.189247847f, 0.108265489f, -0.0677136108f, 0.042594865f, -0.0258694962f, 0.014675593f, -0.00744558172f,
+    0.00308802165f, -0.000737821218f, -0.000307903421f, 0.000596888596f, -0.000521862705f, 0.000332057854f, -0.000158616953f, 4.86355275e-05f,
+    8.06148091e-05f, -0.000270068616f, 0.000640685728f, -0.00124177046f, 0.00206830283f, -0.00301277172f, 0.00381384371f, -0.00400904799f,
+    0.00289337547f, 0.00052982819f, -0.00765699428f, 0.0206047371f, -0.043245241f, 0.0850930884f, -0.182359502f, 0.743724763f,
+    0.505049109f, -0.189594001f, 0.108275533f, -0.067618005f, 0.0424672849f, -0.0257428307f, 0.0145655135f, -0.00735831959f,
+    0.00302409707f, -0.000694451854f, -0.000335046177f, 0.000612414442f, -0.000529852055f, 0.000335660385f, -0.000159974923f, 4.90218299e-05f,
+    8.03995936e-05f, -0.000269291224f, 0.000638310798f, -0.00123572454f, 0.00205501751f, -0.00298679038f, 0.00376761076f, -0.00393299526f,
+    0.0027763627f, 0.000699755794f, -0.00789167173f, 0.0209150091f, -0.043640241f, 0.0855771974f, -0.182887718f, 0.741593778f,
+    0.507741094f, -0.1899326f, 0.108280681f, -0.0675191581f, 0.0423375666f, -0.0256147813f, 0.014454579f, -0.00727056013f,
+    0.00295990705f, -0.00065095647f, -0.000362238818f, 0.00062795385f, -0.000537841348f, 0.000339260034f, -0.000161331162f, 4.94078886e-05f,
+    8.0181002e-05f, -0.000268503587f, 0.00063591334f, -0.00122963812f, 0.00204167119f, -0.00296073128f, 0.00372130191f, -0.00385690969f,
+    0.00265943306f, 0.000869362673f, -0.00812560041f, 0.0212238114f, -0.0440325364f, 0.0860563517f, -0.183405846f, 0.739454031f,
+    0.510430396f, -0.190263614f, 0.108280927f, -0.0674170628f, 0.0422057062f, -0.0254853517f, 0.0143427942f, -0.00718230894f,
+    0.00289545464f, -0.000607336638f, -0.000389480236f, 0.000643506239f, -0.000545830233f, 0.000342856656f, -0.000162685566f, 4.97936708e-05f,
+    7.99590634e-05f, -0.000267705735f, 0.000633493357f, -0.00122351164f, 0.00202826434f, -0.0029345958f, 0.00367491902f, -0.00378079386f,
+    0.00254259189f, 0.00103864132f, -0.00835877191f, 0.0215311274f, -0.0444221161f, 0.0865305364f, -0.183913872f, 0.737305462f,
+    0.513116896f, -0.190586999f, 0.108276255f, -0.0673117191f, 0.0420716964f, -0.0253545418f, 0.014230161f, -0.007093566f,
+    0.00283074146f, -0.00056359428f, -0.000416769151f, 0.000659070676f, -0.000553818187f, 0.000346450048f, -0.000164038036f, 5.0179151e-05f,
+    7.97338071e-05f, -0.000266897725f, 0.000631051371f, -0.00121734559f, 0.00201479788f, -0.00290838513f, 0.00362846488f, -0.00370465149f,
+    0.00242584385f, 0.00120758475f, -0.00859117694f, 0.0218369476f, -0.0448089652f, 0.0869997218f, -0.184411824f, 0.735148191f,
+    0.515800595f, -0.19090271f, 0.108266644f, -0.0672031268f, 0.0419355556f, -0.0252223592f, 0.014116683f, -0.00700433552f,
+    0.00276577007f, -0.000519731082f, -0.000444104458f, 0.000674646639f, -0.000561804802f, 0.000350039918f, -0.000165388497f, 5.05643002e-05f,
+    7.95052692e-05f, -0.000266079674f, 0.000628587266f, -0.00121114054f, 0.00200127228f, -0.00288210111f, 0.00358194136f, -0.00362848677f,
+    0.00230919477f, 0.00137618568f, -0.00882280618f, 0.022141261f, -0.0451930724f, 0.0874639302f, -0.184899747f, 0.732982337f,
+    0.518481374f, -0.191210717f, 0.108252101f, -0.0670912862f, 0.0417972691f, -0.0250888076f, 0.0140023651f, -0.00691462168f,
+    0.0027005435f, -0.000475748908f, -0.000471484993f, 0.000690233253f, -0.000569789845f, 0.000353626208f, -0.000166736863f, 5.09490892e-05f,
+    7.92734936e-05f, -0.0002652517f, 0.000626101508f, -0.0012048966f, 0.00198768894f, -0.00285574491f, 0.00353535125f, -0.00355230249f,
+    0.00219264952f, 0.00154443702f, -0.00905365031f, 0.0224440563f, -0.0455744304f, 0.0879231393f, -0.185377598f, 0.730807841f,
+    0.521159172f, -0.191511005f, 0.10823261f, -0.0669762045f, 0.0416568555f, -0.0249538887f, 0.0138872107f, -0.00682442775f,
+    0.0026350636f, -0.000431649503f, -0.000498909503f, 0.000705829938f, -0.000577772793f, 0.000357208657f, -0.000168083046f, 5.13334926e-05f,
+    7.90385093e-05f, -0.000264413888f, 0.000623594213f, -0.00119861448f, 0.00197404833f, -0.00282931817f, 0.00348869688f, -0.0034761026f,
+    0.00207621371f, 0.00171233166f, -0.0092836991f, 0.0227453224f, -0.0459530205f, 0.0883773342f, -0.18584542f, 0.72862488f,
+    0.523833871f, -0.1918035f, 0.108208165f, -0.0668578595f, 0.0415143073f, -0.0248176083f, 0.0137712229f, -0.00673375558f,
+    0.00256933365f, -0.000387434702f, -0.000526376825f, 0.000721435936f, -0.000585753354f, 0.00036078706f, -0.000169426989f, 5.17174776e-05f,
+    7.88003454e-05f, -0.000263566297f, 0.000621065497f, -0.00119229429f, 0.00196035113f, -0.00280282181f, 0.00344198011f, -0.00339989061f,
+    0.00195989176f, 0.00187986251f, -0.00951294508f, 0.0230450481f, -0.0463288352f, 0.0888265073f, -0.186303228f, 0.726433456f,
+    0.52650553f, -0.192088187f, 0.108178742f, -0.066736266f, 0.0413696319f, -0.0246799681f, 0.0136544071f, -0.00664260937f,
+    0.00250335573f, -0.000343106338f, -0.000553885824f, 0.00073705049f, -0.000593730947f, 0.000364361244f, -0.000170768573f, 5.21010152e-05f,
+    7.85590455e-05f, -0.000262709043f, 0.000618515653f, -0.00118593685f, 0.00194659852f, -0.00277625793f, 0.0033952035f, -0.00332367024f,
+    0.00184368936f, 0.00204702257f, -0.00974137895f, 0.0233432241f, -0.0467018671f, 0.0892706662f, -0.186751053f, 0.724233627f,
+    0.52917397f, -0.19236505f, 0.108144358f, -0.0666114241f, 0.0412228331f, -0.0245409776f, 0.0135367652f, -0.00655099284f,
+    0.00243713288f, -0.000298666186f, -0.000581435277f, 0.000752672902f, -0.000601705397f, 0.000367931003f, -0.000172107757f, 5.24840761e-05f,
+    7.83146315e-05f, -0.000261842157f, 0.000615944795f, -0.00117954216f, 0.00193279097f, -0.00274962699f, 0.00334836938f, -0.00324744452f,
+    0.00172761141f, 0.00221380475f, -0.00996898953f, 0.0236398373f, -0.0470720902f, 0.0897097811f, -0.187188879f, 0.722025394f,
+    0.531839192f, -0.192634016f, 0.108104974f, -0.0664833263f, 0.0410739109f, -0.0244006328f, 0.0134183038f, -0.00645890832f,
+    0.00237066695f, -0.000254116138f, -0.000609023904f, 0.000768302416f, -0.000609676063f, 0.000371496106f, -0.000173444409f, 5.28666351e-05f,
+    7.80671617e-05f, -0.000260965811f, 0.000613353273f, -0.00117311091f, 0.00191892951f, -0.00272293156f, 0.00330148009f, -0.00317121763f,
+    0.00161166326f, 0.00238020229f, -0.0101957703f, 0.0239348784f, -0.0474395044f, 0.0901438519f, -0.187616765f, 0.719808936f,
+    0.534501135f, -0.192895085f, 0.108060613f, -0.0663519874f, 0.0409228727f, -0.0242589433f, 0.0132990247f, -0.00636636093f,
+    0.00230396097f, -0.000209458056f, -0.00063665054f, 0.000783938391f, -0.000617642771f, 0.000375056436f, -0.000174778485f, 5.32486592e-05f,
+    7.78166432e-05f, -0.000260080036f, 0.000610741205f, -0.00116664357f, 0.00190501474f, -0.0026961721f, 0.0032545377f, -0.0030949926f,
+    0.00149584981f, 0.00254620775f, -0.010421712f, 0.0242283344f, -0.0478040949f, 0.0905728787f, -0.188034669f, 0.717584193f,
+    0.537159622f, -0.193148166f, 0.108011231f, -0.0662173852f, 0.0407697149f, -0.0241159108f, 0.0131789325f, -0.00627335208f,
+    0.00223701773f, -0.00016469376f, -0.000664314022f, 0.000799579953f, -0.000625605055f, 0.000378611701f, -0.000176109854f, 5.36301195e-05f,
+    7.7563127e-05f, -0.000259184948f, 0.000608108763f, -0.00116014038f, 0.00189104746f, -0.00266935048f, 0.0032075448f, -0.00301877339f,
+    0.00138017617f, 0.00271181483f, -0.0106468033f, 0.0245201979f, -0.0481658503f, 0.0909968391f, -0.188442662f, 0.715351284f,
+    0.539814711f, -0.19339329f, 0.107956842f, -0.0660795346f, 0.0406144485f, -0.0239715409f, 0.0130580319f, -0.00617988594f,
+    0.0021698398f, -0.000119825097f, -0.000692013069f, 0.000815226464f, -0.000633562333f, 0.000382161757f, -0.000177438458f, 5.40109831e-05f,
+    7.73066349e-05f, -0.000258280634f, 0.00060545624f, -0.0011536018f, 0.00187702873f, -0.00264246808f, 0.00316050346f, -0.00294256327f,
+    0.00126464746f, 0.00287701585f, -0.0108710388f, 0.0248104576f, -0.0485247672f, 0.0914157405f, -0.188840747f, 0.713110328f,
+    0.542466223f, -0.193630368f, 0.107897438f, -0.0659384355f, 0.0404570699f, -0.023825841f, 0.0129363285f, -0.00608596718f,
+    0.00210242975f, -7.48539824e-05f, -0.000719746458f, 0.000830877107f, -0.000641514489f, 0.0003857064f, -0.000178764225f, 5.43912247e-05f,
+    7.70472179e-05f, -0.000257367181f, 0.000602783752f, -0.00114702841f, 0.00186295912f, -0.00261552632f, 0.00311341626f, -0.00286636525f,
+    0.0011492687f, 0.00304180454f, -0.0110944072f, 0.0250991005f, -0.0488808192f, 0.0918295681f, -0.189228922f, 0.710861325f,
+    0.54511416f, -0.193859398f, 0.107833005f, -0.0657940805f, 0.0402975902f, -0.0236788094f, 0.0128138224f, -0.00599159766f,
+    0.00203479012f, -2.97822771e-05f, -0.000747513026f, 0.000846531242f, -0.000649460824f, 0.000389245397f, -0.000180087023f, 5.4770815e-05f,
+    7.67848978e-05f, -0.000256444677f, 0.000600091531f, -0.00114042021f, 0.00184883934f, -0.00258852611f, 0.00306628505f, -0.00279018353f,
+    0.00103404489f, 0.00320617389f, -0.0113169001f, 0.0253861174f, -0.0492340066f, 0.092238307f, -0.189607218f, 0.708604276f,
+    0.54775846f, -0.194080323f, 0.107763536f, -0.0656464845f, 0.040136002f, -0.0235304534f, 0.0126905208f, -0.00589678157f,
+    0.00196692371f, 1.53881192e-05f, -0.000775311375f, 0.000862188113f, -0.000657401164f, 0.000392778602f, -0.000181406809f, 5.51497178e-05f,
+    7.65197183e-05f, -0.00025551318f, 0.000597379869f, -0.00113377825f, 0.00183467043f, -0.00256146933f, 0.00301911216f, -0.00271402183f,
+    0.000918981212f, 0.00337011716f, -0.0115385111f, 0.0256714988f, -0.049584318f, 0.0926419646f, -0.189975664f, 0.706339359f,
+    0.550399005f, -0.194293141f, 0.10768903f, -0.0654956326f, 0.0399723239f, -0.0233807787f, 0.0125664277f, -0.00580152264f,
+    0.0018988332f, 6.06553076e-05f, -0.000803140516f, 0.000877846905f, -0.000665334985f, 0.000396305753f, -0.000182723481f, 5.55279075e-05f,
+    7.62517011e-05f, -0.000254572835f, 0.000594648882f, -0.00112710253f, 0.00182045321f, -0.0025343576f, 0.00297190039f, -0.00263788272f,
+    0.000804082549f, 0.00353362737f, -0.011759229f, 0.0259552337f, -0.0499317385f, 0.0930405334f, -0.19033426f, 0.704066515f,
+    0.553035796f, -0.194497779f, 0.107609466f, -0.0653415322f, 0.0398065485f, -0.023229789f, 0.0124415476f, -0.00570582412f,
+    0.00183052127f, 0.000106017382f, -0.000830998993f, 0.00089350692f, -0.000673261937f, 0.000399826677f, -0.000184036937f, 5.59053551e-05f,
+    7.598089e-05f, -0.00025362373f, 0.000591898686f, -0.00112039351f, 0.00180618837f, -0.00250719185f, 0.00292465161f, -0.00256177038f,
+    0.000689353852f, 0.00369669776f, -0.0119790444f, 0.0262373127f, -0.0502762608f, 0.0934339985f, -0.190683022f, 0.701785862f,
+    0.555668712f, -0.194694251f, 0.107524842f, -0.0651841834f, 0.0396386869f, -0.0230774879f, 0.0123158833f, -0.00560968975f,
+    0.00176199095f, 0.000151472414f, -0.000858885644f, 0.0009091674f, -0.000681181496f, 0.000403341197f, -0.000185347119f, 5.62820242e-05f,
+    7.57073285e-05f, -0.000252665894f, 0.00058912969f, -0.00111365179f, 0.00179187674f, -0.00247997371f, 0.00287736836f, -0.00248568784f,
+    0.000574800186f, 0.00385932205f, -0.0121979527f, 0.0265177265f, -0.0506178737f, 0.09382236f, -0.191021994f, 0.699497521f,
+    0.558297694f, -0.194882467f, 0.107435159f, -0.0650235936f, 0.0394687392f, -0.0229238849f, 0.0121894404f, -0.0055131237f,
+    0.00169324467f, 0.000197018482f, -0.000886799186f, 0.000924827647f, -0.000689093431f, 0.000406849053f, -0.000186653924f, 5.66578856e-05f,
+    7.54310313e-05f, -0.000251699472f, 0.000586342008f, -0.00110687769f, 0.00177751912f, -0.00245270459f, 0.00283005275f, -0.0024096393f,
+    0.000460426556f, 0.00402149325f, -0.0124159418f, 0.0267964657f, -0.0509565733f, 0.0942056105f, -0.19135119f, 0.697201431f,
+    0.560922742f, -0.195062429f, 0.107340403f, -0.0648597628f, 0.039296709f, -0.022768978f, 0.0120622246f, -0.00541612925f,
+    0.00162428536f, 0.000242653681f, -0.000914738572f, 0.000940486905f, -0.000696997275f, 0.000410350156f, -0.000187957296f, 5.70329175e-05f,
+    7.5152042e-05f, -0.000250724523f, 0.000583535875f, -0.00110007171f, 0.00176311634f, -0.00242538587f, 0.00278270687f, -0.00233362732f,
+    0.000346237706f, 0.00418320438f, -0.0126330052f, 0.0270735174f, -0.0512923412f, 0.0945837423f, -0.191670597f, 0.694897711f,
+    0.563543677f, -0.195234105f, 0.107240565f, -0.0646926835f, 0.0391226001f, -0.0226127766f, 0.0119342385f, -0.00531870965f,
+    0.0015551158f, 0.000288376032f, -0.000942702172f, 0.0009561443f, -0.000704892445f, 0.000413844129f, -0.000189257102f, 5.740708e-05f,
+    7.48704042e-05f, -0.000249741192f, 0.000580711407f, -0.00109323417f, 0.00174866919f, -0.00239801896f, 0.00273533328f, -0.00225765607f,
+    0.000232238715f, 0.00434444938f, -0.0128491344f, 0.027348876f, -0.0516251735f, 0.0949567556f, -0.191980273f, 0.692586482f,
+    0.56616044f, -0.195397452f, 0.107135646f, -0.0645223707f, 0.0389464237f, -0.0224552844f, 0.0118054878f, -0.00522086909f,
+    0.00148573867f, 0.000334183598f, -0.000970689056f, 0.000971799192f, -0.000712778769f, 0.000417330943f, -0.000190553255f, 5.77803476e-05f,
+    7.45861398e-05f, -0.000248749508f, 0.000577868952f, -0.00108636555f, 0.00173417851f, -0.00237060501f, 0.00268793432f, -0.00218172814f,
+    0.000118434429f, 0.00450522173f, -0.0130643202f, 0.0276225265f, -0.0519550592f, 0.095324643f, -0.192280233f, 0.690267742f,
+    0.568773031f, -0.195552438f, 0.107025638f, -0.0643488094f, 0.038768176f, -0.0222965069f, 0.0116759762f, -0.0051226113f,
+    0.001416157f, 0.000380074431f, -0.000998697709f, 0.000987450825f, -0.00072065572f, 0.000420810276f, -0.000191845713f, 5.81526838e-05f,
+    7.42992779e-05f, -0.000247749587f, 0.000575008511f, -0.00107946608f, 0.00171964488f, -0.00234314566f, 0.00264051161f, -0.0021058477f,
+    4.82974065e-06f, 0.00466551399f, -0.0132785533f, 0.0278944615f, -0.0522819757f, 0.0956873894f, -0.192570448f, 0.687941551f,
+    0.57138139f, -0.195699021f, 0.106910519f, -0.0641720071f, 0.0385878645f, -0.022136448f, 0.0115457084f, -0.00502393954f,
+    0.00134637312f, 0.000426046492f, -0.00102672691f, 0.00100309832f, -0.000728522718f, 0.000424281898f, -0.000193134329f, 5.85240523e-05f,
+    7.40098694e-05f, -0.000246741489f, 0.000572130491f, -0.00107253669f, 0.00170506944f, -0.00231564254f, 0.00259306817f, -0.00203001802f,
+    -0.000108570479f, 0.00482532009f, -0.0134918289f, 0.0281646773f, -0.0526059382f, 0.0960450023f, -0.192851007f, 0.68560791f,
+    0.573985398f, -0.195837185f, 0.106790312f, -0.0639919788f, 0.0384054966f, -0.0219751131f, 0.011414689f, -0.00492485892f,
+    0.00127639051f, 0.00047209792f, -0.00105477567f, 0.00101874117f, -0.000736379705f, 0.000427745748f, -0.000194419059f, 5.88944349e-05f,
+    7.37179435e-05f, -0.000245725387f, 0.000569235068f, -0.00106557738f, 0.00169045292f, -0.00228809658f, 0.00254560588f, -0.00195424235f,
+    -0.000221761366f, 0.00498463493f, -0.013704136f, 0.0284331571f, -0.0529269166f, 0.0963974819f, -0.193121895f, 0.683266997f,
+    0.576585054f, -0.195966884f, 0.106664985f, -0.0638087168f, 0.0382210761f, -0.0218125097f, 0.0112829246f, -0.00482537132f,
+    0.00120621175f, 0.000518226647f, -0.00108284235f, 0.00103437819f, -0.000744226039f, 0.000431201508f, -0.000195699802f, 5.92637989e-05f,
+    7.34235291e-05f, -0.00024470131f, 0.000566322415f, -0.00105858862f, 0.001675796f, -0.00226050941f, 0.00249812729f, -0.00187852408f,
+    -0.000334738084f, 0.00514344918f, -0.013915468f, 0.0286998935f, -0.0532449186f, 0.096744813f, -0.193383142f, 0.680918872f,
+    0.579180181f, -0.196088091f, 0.106534548f, -0.0636222214f, 0.0380346067f, -0.0216486398f, 0.0111504169f, -0.00472548278f,
+    0.0011358395f, 0.000564430724f, -0.00111092592f, 0.00105000916f, -0.000752061314f, 0.000434649031f, -0.000196976471f, 5.96321042e-05f,
+    7.31266628e-05f, -0.000243669318f, 0.000563392707f, -0.00105157099f, 0.00166109949f, -0.00223288243f, 0.00245063426f, -0.00180286693f,
+    -0.000447495899f, 0.00530175958f, -0.0141258175f, 0.0289648809f, -0.0535599217f, 0.0970869958f, -0.193634778f, 0.678563535f,
+    0.581770778f, -0.196200803f, 0.106399f, -0.0634325072f, 0.0378460921f, -0.0214835126f, 0.0110171735f, -0.00462519564f,
+    0.00106527703f, 0.000610708143f, -0.00113902497f, 0.00106563291f, -0.000759885181f, 0.000438088115f, -0.000198248978f, 5.99993255e-05f,
+    7.28273808e-05f, -0.000242629554f, 0.000560446118f, -0.00104452472f, 0.00164636422f, -0.00220521702f, 0.00240312913f, -0.0017272738f,
+    -0.000560029875f, 0.00545955682f, -0.0143351741f, 0.0292281024f, -0.0538719222f, 0.0974240229f, -0.193876773f, 0.676201046f,
+    0.584356785f, -0.196304917f, 0.10625831f, -0.0632395595f, 0.0376555361f, -0.02131713f, 0.0108831972f, -0.00452451361f,
+    0.000994527014f, 0.000657056924f, -0.00116713799f, 0.00108124875f, -0.000767697056f, 0.000441518467f, -0.000199517192f, 6.03654262e-05f,
+    7.25257269e-05f, -0.000241582122f, 0.000557482999f, -0.00103745062f, 0.00163159124f, -0.0021775146f, 0.00235561444f, -0.00165174855f,
+    -0.000672335445f, 0.00561683718f, -0.0145435324f, 0.0294895601f, -0.0541809164f, 0.0977559015f, -0.194109231f, 0.673831463f,
+    0.586938143f, -0.196400478f, 0.10611251f, -0.0630433932f, 0.0374629535f, -0.0211494993f, 0.0107484953f, -0.0044234423f,
+    0.000923592423f, 0.000703475031f, -0.00119526417f, 0.00109685597f, -0.000775496825f, 0.00044494f, -0.000200781127f, 6.07303809e-05f,
+    7.2221701e-05f, -0.000240527035f, 0.000554503466f, -0.00103034859f, 0.00161678076f, -0.00214977632f, 0.00230809185f, -0.00157629396f,
+    -0.000784407544f, 0.00577359181f, -0.0147508811f, 0.0297492333f, -0.0544868819f, 0.098082602f, -0.194332093f, 0.671454906f,
+    0.589514732f, -0.196487397f, 0.105961561f, -0.0628440008f, 0.0372683369f, -0.0209806245f, 0.0106130689f, -0.00432198402f,
+    0.000852476107f, 0.000749960309f, -0.00122340175f, 0.00111245376f, -0.000783283671f, 0.000448352337f, -0.000202040566f, 6.10941424e-05f,
+    7.19153904e-05f, -0.000239464498f, 0.000551507808f, -0.00102321955f, 0.00160193432f, -0.00212200405f, 0.00226056459f, -0.00150091411f,
+    -0.000896241749f, 0.00592981651f, -0.0149572175f, 0.0300071258f, -0.05478983f, 0.0984041691f, -0.194545478f, 0.669071376f,
+    0.592086554f, -0.196565703f, 0.105805479f, -0.0626414046f, 0.0370717049f, -0.0208105147f, 0.0104769282f, -0.00422014343f,
+    0.00078118121f, 0.000796510954f, -0.00125154993f, 0.00112804142f, -0.000791057595f, 0.000451755506f, -0.000203295524f, 6.14567034e-05f,
+    7.1606788e-05f, -0.00023839451f, 0.000548496144f, -0.00101606373f, 0.00158705225f, -0.00209419895f, 0.00221303361f, -0.00142561167f,
+    -0.00100783317f, 0.00608550431f, -0.0151625304f, 0.0302632172f, -0.0550897419f, 0.0987205505f, -0.194749326f, 0.666680992f,
+    0.594653487f, -0.196635306f, 0.105644263f, -0.062435586f, 0.0368730538f, -0.0206391718f, 0.0103400731f, -0.00411792472f,
+    0.000709710468f, 0.000843124872f, -0.00127970683f, 0.00114361814f, -0.000798817899f, 0.000455149129f, -0.000204545868f, 6.18180202e-05f,
+    7.129593e-05f, -0.000237317188f, 0.000545468705f, -0.00100888137f, 0.00157213537f, -0.00206636218f, 0.00216550217f, -0.00135039049f,
+    -0.00111917709f, 0.00624064822f, -0.0153668122f, 0.0305175073f, -0.0553866029f, 0.0990317687f, -0.194943681f, 0.664283812f,
+    0.597215474f, -0.196696207f, 0.105477884f, -0.06222656f, 0.0366723835f, -0.0204666033f, 0.0102025112f, -0.00401533116f,
+    0.000638067024f, 0.000889799907f, -0.00130787154f, 0.00115918298f, -0.000806564232f, 0.000458533032f, -0.000205791497f, 6.21780491e-05f,
+    7.09828746e-05f, -0.000236232619f, 0.000542425609f, -0.00100167328f, 0.00155718473f, -0.00203849515f, 0.00211797166f, -0.00127525348f,
+    -0.00123026886f, 0.00639524311f, -0.0155700557f, 0.0307699796f, -0.0556804202f, 0.0993378162f, -0.19512856f, 0.661879838f,
+    0.599772453f, -0.196748361f, 0.105306365f, -0.0620143302f, 0.0364697166f, -0.0202928148f, 0.0100642471f, -0.00391236739f,
+    0.00056625373f, 0.000936534023f, -0.00133604254f, 0.00117473549f, -0.000814296072f, 0.00046190701f, -0.000207032339f, 6.25367684e-05f,
+    7.06676365e-05f, -0.000235140906f, 0.000539367262f, -0.00099443947f, 0.0015422008f, -0.00201059948f, 0.00207044487f, -0.00120020425f,
+    -0.00134110393f, 0.006549282f, -0.0157722533f, 0.031020632f, -0.0559711717f, 0.099638693f, -0.195304006f, 0.659469128f,
+    0.602324426f, -0.196791753f, 0.105129682f, -0.0617988929f, 0.0362650454f, -0.0201178119f, 0.00992528629f, -0.00380903739f,
+    0.000494273729f, 0.000983325299f, -0.00136421877f, 0.0011902746f, -0.000822013186f, 0.000465270889f, -0.000208268291f, 6.28941489e-05f,
+    7.03502592e-05f, -0.000234042149f, 0.000536293781f, -0.000987180742f, 0.00152718474f, -0.00198267656f, 0.0020229239f, -0.00112524594f,
+    -0.00145167753f, 0.00670276023f, -0.0159733985f, 0.0312694535f, -0.0562588573f, 0.0999343917f, -0.195470035f, 0.657051861f,
+    0.604871213f, -0.196826339f, 0.10494785f, -0.0615802631f, 0.0360583812f, -0.0199416f, 0.00978563447f, -0.00370534556f,
+    0.000422129873f, 0.00103017152f, -0.00139239861f, 0.00120579975f, -0.000829715107f, 0.000468624406f, -0.000209499281f, 6.32501542e-05f,
+    7.00307719e-05f, -0.000232936422f, 0.000533205341f, -0.000979897333f, 0.00151213724f, -0.00195472757f, 0.00197541108f, -0.0010503818f,
+    -0.00156198523f, 0.00685567036f, -0.0161734838f, 0.0315164402f, -0.0565434769f, 0.10022492f, -0.195626676f, 0.654627979f,
+    0.607412875f, -0.196852118f, 0.104760855f, -0.0613584444f, 0.0358497314f, -0.0197641905f, 0.00964529626f, -0.00360129541f,
+    0.000349825335f, 0.00107707083f, -0.00142058101f, 0.00122131011f, -0.000837401312f, 0.000471967447f, -0.000210725237f, 6.36047553e-05f,
+    6.97092109e-05f, -0.000231823826f, 0.000530102232f, -0.000972589711f, 0.0014970589f, -0.00192675425f, 0.00192790828f, -0.000975615403f,
+    -0.00167202228f, 0.0070080068f, -0.0163725f, 0.0317615792f, -0.056825012f, 0.100510269f, -0.195773959f, 0.652197659f,
+    0.609949172f, -0.196869016f, 0.104568698f, -0.0611334294f, 0.0356390998f, -0.0195855815f, 0.00950427633f, -0.00349689159f,
+    0.000277363026f, 0.0011240209f, -0.00144876447f, 0.00123680464f, -0.000845071452f, 0.000475299719f, -0.000211946026f, 6.39579084e-05f,
+    6.93856055e-05f, -0.000230704434f, 0.000526984571f, -0.000965258281f, 0.00148195075f, -0.00189875741f, 0.00188041793f, -0.000900949817f,
+    -0.001781784f, 0.00715976348f, -0.0165704452f, 0.0320048667f, -0.0571034551f, 0.100790434f, -0.195911884f, 0.649760842f,
+    0.612480164f, -0.196877047f, 0.104371376f, -0.0609052293f, 0.03542649f, -0.0194057841f, 0.00936258025f, -0.00339213829f,
+    0.000204746131f, 0.00117101974f, -0.00147694768f, 0.00125228288f, -0.000852725061f, 0.000478621048f, -0.000213161562f, 6.43095991e-05f,
+    6.90599991e-05f, -0.000229578349f, 0.000523852592f, -0.00095790351f, 0.00146681338f, -0.00187073881f, 0.00183294201f, -0.000826388248f,
+    -0.00189126586f, 0.00731093436f, -0.0167673044f, 0.0322462916f, -0.0573788062f, 0.10106542f, -0.196040481f, 0.647317648f,
+    0.615005791f, -0.196876124f, 0.104168884f, -0.0606738478f, 0.0352119133f, -0.019224802f, 0.00922021456f, -0.00328703923f,
+    0.00013197762f, 0.00121806527f, -0.00150512927f, 0.00126774388f, -0.00086036179f, 0.000481931202f, -0.000214371787f, 6.46597764e-05f,
+    6.87324209e-05f, -0.000228445686f, 0.000520706584f, -0.000950525864f, 0.00145164796f, -0.00184269983f, 0.00178548298f, -0.000751934014f,
+    -0.00200046366f, 0.00746151339f, -0.016963074f, 0.0324858427f, -0.0576510541f, 0.101335235f, -0.19615981f, 0.644868195f,
+    0.617525935f, -0.196866304f, 0.103961229f, -0.0604392961f, 0.0349953733f, -0.0190426446f, 0.00907718297f, -0.00318159885f,
+    5.90606287e-05f, 0.0012651555f, -0.00153330818f, 0.00128318695f, -0.000867981114f, 0.000485230004f, -0.000215576583f, 6.50084185e-05f,
+    6.84029001e-05f, -0.000227306504f, 0.000517546665f, -0.000943125691f, 0.00143645483f, -0.00181464164f, 0.00173804269f, -0.000677590433f,
+    -0.00210937252f, 0.00761149544f, -0.0171577465f, 0.03272352f, -0.0579201989f, 0.101599865f, -0.196269855f, 0.642412484f,
+    0.620040536f, -0.196847498f, 0.103748389f, -0.0602015704f, 0.0347768776f, -0.0188593157f, 0.008933492f, -0.00307582179f,
+    -1.40017873e-05f, 0.00131228811f, -0.00156148267f, 0.00129861129f, -0.000875582686f, 0.000488517224f, -0.000216775865f, 6.53554816e-05f,
+    6.80714729e-05f, -0.00022616089f, 0.000514373067f, -0.000935703516f, 0.00142123515f, -0.00178656587f, 0.00169062358f, -0.000603360531f,
+    -0.00221798825f, 0.00776087446f, -0.0173513182f, 0.0329593085f, -0.0581862256f, 0.101859316f, -0.196370661f, 0.639950573f,
+    0.622549593f, -0.196819678f, 0.103530385f, -0.0599606819f, 0.0345564336f, -0.0186748225f, 0.00878914539f, -0.00296971179f,
+    -8.72065066e-05f, 0.00135946111f, -0.00158965169f, 0.00131401606f, -0.000883166038f, 0.000491792685f, -0.000217969558f, 6.57009514e-05f,
+    6.77381686e-05f, -0.000225008946f, 0.000511185906f, -0.000928259571f, 0.00140598929f, -0.00175847334f, 0.00164322765f, -0.000529247685f,
+    -0.00232630572f, 0.00790964253f, -0.017543776f, 0.0331932046f, -0.0584491268f, 0.102113575f, -0.196462229f, 0.637482524f,
+    0.625052929f, -0.196782842f, 0.103307188f, -0.0597166233f, 0.0343340449f, -0.018489169f, 0.0086441515f, -0.00286327326f,
+    -0.000160550408f, 0.00140667218f, -0.00161781372f, 0.00132940034f, -0.000890730706f, 0.00049505604f, -0.000219157533f, 6.60447695e-05f,
+    6.74030307e-05f, -0.000223850788f, 0.000507985649f, -0.000920794497f, 0.00139071862f, -0.00173036614f, 0.00159585709f, -0.000455255067f,
+    -0.00243432145f, 0.00805779733f, -0.017735118f, 0.0334252007f, -0.0587089062f, 0.102362663f, -0.196544632f, 0.635008454f,
+    0.627550602f, -0.196736947f, 0.103078827f, -0.059469413f, 0.0341097191f, -0.018302368f, 0.00849851407f, -0.00275651063f,
+    -0.000234030362f, 0.00145391969f, -0.00164596771f, 0.00134476367f, -0.000898276339f, 0.000498307345f, -0.00022033976f, 6.63869359e-05f,
+    6.70660957e-05f, -0.00022268646f, 0.000504772353f, -0.000913308701f, 0.00137542363f, -0.00170224509f, 0.00154851424f, -0.000381385878f,
+    -0.0025420303f, 0.00820533093f, -0.0179253351f, 0.0336552896f, -0.0589655489f, 0.102606565f, -0.196617857f, 0.632528424f,
+    0.630042374f, -0.196681961f, 0.102845289f, -0.0592190549f, 0.0338834673f, -0.0181144197f, 0.00835223868f, -0.00264942809f,
+    -0.000307643233f, 0.00150120107f, -0.00167411193f, 0.001360105f, -0.000905802473f, 0.000501546136f, -0.000221516093f, 6.6727378e-05f,
+    6.6727378e-05f, -0.000221516093f, 0.000501546136f, -0.000905802473f, 0.001360105f, -0.00167411193f, 0.00150120107f, -0.000307643233f,
+    -0.00264942809f, 0.00835223868f, -0.0181144197f, 0.0338834673f, -0.0592190549f, 0.102845289f, -0.196681961f, 0.630042374f,
+    0.632528424f, -0.196617857f, 0.102606565f, -0.0589655489f, 0.0336552896f, -0.0179253351f, 0.00820533093f, -0.0025420303f,
+    -0.000381385878f, 0.00154851424f, -0.00170224509f, 0.00137542363f, -0.000913308701f, 0.000504772353f, -0.00022268646f, 6.70660957e-05f,
+    6.63869359e-05f, -0.00022033976f, 0.000498307345f, -0.000898276339f, 0.00134476367f, -0.00164596771f, 0.00145391969f, -0.000234030362f,
+    -0.00275651063f, 0.00849851407f, -0.018302368f, 0.0341097191f, -0.059469413f, 0.103078827f, -0.196736947f, 0.627550602f,
+    0.635008454f, -0.196544632f, 0.102362663f, -0.0587089062f, 0.0334252007f, -0.017735118f, 0.00805779733f, -0.00243432145f,
+    -0.000455255067f, 0.00159585709f, -0.00173036614f, 0.00139071862f, -0.000920794497f, 0.000507985649f, -0.000223850788f, 6.74030307e-05f,
+    6.60447695e-05f, -0.000219157533f, 0.00049505604f, -0.000890730706f, 0.00132940034f, -0.00161781372f, 0.00140667218f, -0.000160550408f,
+    -0.00286327326f, 0.0086441515f, -0.018489169f, 0.0343340449f, -0.0597166233f, 0.103307188f, -0.196782842f, 0.625052929f,
+    0.637482524f, -0.196462229f, 0.102113575f, -0.0584491268f, 0.0331932046f, -0.017543776f, 0.00790964253f, -0.00232630572f,
+    -0.000529247685f, 0.00164322765f, -0.00175847334f, 0.00140598929f, -0.000928259571f, 0.000511185906f, -0.000225008946f, 6.77381686e-05f,
+    6.57009514e-05f, -0.000217969558f, 0.000491792685f, -0.000883166038f, 0.00131401606f, -0.00158965169f, 0.00135946111f, -8.72065066e-05f,
+    -0.00296971179f, 0.00878914539f, -0.0186748225f, 0.0345564336f, -0.0599606819f, 0.103530385f, -0.196819678f, 0.622549593f,
+    0.639950573f, -0.196370661f, 0.101859316f, -0.0581862256f, 0.0329593085f, -0.0173513182f, 0.00776087446f, -0.00221798825f,
+    -0.000603360531f, 0.00169062358f, -0.00178656587f, 0.00142123515f, -0.000935703516f, 0.000514373067f, -0.00022616089f, 6.80714729e-05f,
+    6.53554816e-05f, -0.000216775865f, 0.000488517224f, -0.000875582686f, 0.00129861129f, -0.00156148267f, 0.00131228811f, -1.40017873e-05f,
+    -0.00307582179f, 0.008933492f, -0.0188593157f, 0.0347768776f, -0.0602015704f, 0.103748389f, -0.196847498f, 0.620040536f,
+    0.642412484f, -0.196269855f, 0.101599865f, -0.0579201989f, 0.03272352f, -0.0171577465f, 0.00761149544f, -0.00210937252f,
+    -0.000677590433f, 0.00173804269f, -0.00181464164f, 0.00143645483f, -0.000943125691f, 0.000517546665f, -0.000227306504f, 6.84029001e-05f,
+    6.50084185e-05f, -0.000215576583f, 0.000485230004f, -0.000867981114f, 0.00128318695f, -0.00153330818f, 0.0012651555f, 5.90606287e-05f,
+    -0.00318159885f, 0.00907718297f, -0.0190426446f, 0.0349953733f, -0.0604392961f, 0.103961229f, -0.196866304f, 0.617525935f,
+    0.644868195f, -0.19615981f, 0.101335235f, -0.0576510541f, 0.0324858427f, -0.016963074f, 0.00746151339f, -0.00200046366f,
+    -0.000751934014f, 0.00178548298f, -0.00184269983f, 0.00145164796f, -0.000950525864f, 0.000520706584f, -0.000228445686f, 6.87324209e-05f,
+    6.46597764e-05f, -0.000214371787f, 0.000481931202f, -0.00086036179f, 0.00126774388f, -0.00150512927f, 0.00121806527f, 0.00013197762f,
+    -0.00328703923f, 0.00922021456f, -0.019224802f, 0.0352119133f, -0.0606738478f, 0.104168884f, -0.196876124f, 0.615005791f,
+    0.647317648f, -0.196040481f, 0.10106542f, -0.0573788062f, 0.0322462916f, -0.0167673044f, 0.00731093436f, -0.00189126586f,
+    -0.000826388248f, 0.00183294201f, -0.00187073881f, 0.00146681338f, -0.00095790351f, 0.000523852592f, -0.000229578349f, 6.90599991e-05f,
+    6.43095991e-05f, -0.000213161562f, 0.000478621048f, -0.000852725061f, 0.00125228288f, -0.00147694768f, 0.00117101974f, 0.000204746131f,
+    -0.00339213829f, 0.00936258025f, -0.0194057841f, 0.03542649f, -0.0609052293f, 0.104371376f, -0.196877047f, 0.612480164f,
+    0.649760842f, -0.195911884f, 0.100790434f, -0.0571034551f, 0.0320048667f, -0.0165704452f, 0.00715976348f, -0.001781784f,
+    -0.000900949817f, 0.00188041793f, -0.00189875741f, 0.00148195075f, -0.000965258281f, 0.000526984571f, -0.000230704434f, 6.93856055e-05f,
+    6.39579084e-05f, -0.000211946026f, 0.000475299719f, -0.000845071452f, 0.00123680464f, -0.00144876447f, 0.0011240209f, 0.000277363026f,
+    -0.00349689159f, 0.00950427633f, -0.0195855815f, 0.0356390998f, -0.0611334294f, 0.104568698f, -0.196869016f, 0.609949172f,
+    0.652197659f, -0.195773959f, 0.100510269f, -0.056825012f, 0.0317615792f, -0.0163725f, 0.0070080068f, -0.00167202228f,
+    -0.000975615403f, 0.00192790828f, -0.00192675425f, 0.0014970589f, -0.000972589711f, 0.000530102232f, -0.000231823826f, 6.97092109e-05f,
+    6.36047553e-05f, -0.000210725237f, 0.000471967447f, -0.000837401312f, 0.00122131011f, -0.00142058101f, 0.00107707083f, 0.000349825335f,
+    -0.00360129541f, 0.00964529626f, -0.0197641905f, 0.0358497314f, -0.0613584444f, 0.104760855f, -0.196852118f, 0.607412875f,
+    0.654627979f, -0.195626676f, 0.10022492f, -0.0565434769f, 0.0315164402f, -0.0161734838f, 0.00685567036f, -0.00156198523f,
+    -0.0010503818f, 0.00197541108f, -0.00195472757f, 0.00151213724f, -0.000979897333f, 0.000533205341f, -0.000232936422f, 7.00307719e-05f,
+    6.32501542e-05f, -0.000209499281f, 0.000468624406f, -0.000829715107f, 0.00120579975f, -0.00139239861f, 0.00103017152f, 0.000422129873f,
+    -0.00370534556f, 0.00978563447f, -0.0199416f, 0.0360583812f, -0.0615802631f, 0.10494785f, -0.196826339f, 0.604871213f,
+    0.657051861f, -0.195470035f, 0.0999343917f, -0.0562588573f, 0.0312694535f, -0.0159733985f, 0.00670276023f, -0.00145167753f,
+    -0.00112524594f, 0.0020229239f, -0.00198267656f, 0.00152718474f, -0.000987180742f, 0.000536293781f, -0.000234042149f, 7.03502592e-05f,
+    6.28941489e-05f, -0.000208268291f, 0.000465270889f, -0.000822013186f, 0.0011902746f, -0.00136421877f, 0.000983325299f, 0.000494273729f,
+    -0.00380903739f, 0.00992528629f, -0.0201178119f, 0.0362650454f, -0.0617988929f, 0.105129682f, -0.196791753f, 0.602324426f,
+    0.659469128f, -0.195304006f, 0.099638693f, -0.0559711717f, 0.031020632f, -0.0157722533f, 0.006549282f, -0.00134110393f,
+    -0.00120020425f, 0.00207044487f, -0.00201059948f, 0.0015422008f, -0.00099443947f, 0.000539367262f, -0.000235140906f, 7.06676365e-05f,
+    6.25367684e-05f, -0.000207032339f, 0.00046190701f, -0.000814296072f, 0.00117473549f, -0.00133604254f, 0.000936534023f, 0.00056625373f,
+    -0.00391236739f, 0.0100642471f, -0.0202928148f, 0.0364697166f, -0.0620143302f, 0.105306365f, -0.196748361f, 0.599772453f,
+    0.661879838f, -0.19512856f, 0.0993378162f, -0.0556804202f, 0.0307699796f, -0.0155700557f, 0.00639524311f, -0.00123026886f,
+    -0.00127525348f, 0.00211797166f, -0.00203849515f, 0.00155718473f, -0.00100167328f, 0.000542425609f, -0.000236232619f, 7.09828746e-05f,
+    6.21780491e-05f, -0.000205791497f, 0.000458533032f, -0.000806564232f, 0.00115918298f, -0.00130787154f, 0.000889799907f, 0.000638067024f,
+    -0.00401533116f, 0.0102025112f, -0.0204666033f, 0.0366723835f, -0.06222656f, 0.105477884f, -0.196696207f, 0.597215474f,
+    0.664283812f, -0.194943681f, 0.0990317687f, -0.0553866029f, 0.0305175073f, -0.0153668122f, 0.00624064822f, -0.00111917709f,
+    -0.00135039049f, 0.00216550217f, -0.00206636218f, 0.00157213537f, -0.00100888137f, 0.000545468705f, -0.000237317188f, 7.129593e-05f,
+    6.18180202e-05f, -0.000204545868f, 0.000455149129f, -0.000798817899f, 0.00114361814f, -0.00127970683f, 0.000843124872f, 0.000709710468f,
+    -0.00411792472f, 0.0103400731f, -0.0206391718f, 0.0368730538f, -0.062435586f, 0.105644263f, -0.196635306f, 0.594653487f,
+    0.666680992f, -0.194749326f, 0.0987205505f, -0.0550897419f, 0.0302632172f, -0.0151625304f, 0.00608550431f, -0.00100783317f,
+    -0.00142561167f, 0.00221303361f, -0.00209419895f, 0.00158705225f, -0.00101606373f, 0.000548496144f, -0.00023839451f, 7.1606788e-05f,
+    6.14567034e-05f, -0.000203295524f, 0.000451755506f, -0.000791057595f, 0.00112804142f, -0.00125154993f, 0.000796510954f, 0.00078118121f,
+    -0.00422014343f, 0.0104769282f, -0.0208105147f, 0.0370717049f, -0.0626414046f, 0.105805479f, -0.196565703f, 0.592086554f,
+    0.669071376f, -0.194545478f, 0.0984041691f, -0.05478983f, 0.0300071258f, -0.0149572175f, 0.00592981651f, -0.000896241749f,
+    -0.00150091411f, 0.00226056459f, -0.00212200405f, 0.00160193432f, -0.00102321955f, 0.000551507808f, -0.000239464498f, 7.19153904e-05f,
+    6.10941424e-05f, -0.000202040566f, 0.000448352337f, -0.000783283671f, 0.00111245376f, -0.00122340175f, 0.000749960309f, 0.000852476107f,
+    -0.00432198402f, 0.0106130689f, -0.0209806245f, 0.0372683369f, -0.0628440008f, 0.105961561f, -0.196487397f, 0.589514732f,
+    0.671454906f, -0.194332093f, 0.098082602f, -0.0544868819f, 0.0297492333f, -0.0147508811f, 0.00577359181f, -0.000784407544f,
+    -0.00157629396f, 0.00230809185f, -0.00214977632f, 0.00161678076f, -0.00103034859f, 0.000554503466f, -0.000240527035f, 7.2221701e-05f,
+    6.07303809e-05f, -0.000200781127f, 0.00044494f, -0.000775496825f, 0.00109685597f, -0.00119526417f, 0.000703475031f, 0.000923592423f,
+    -0.0044234423f, 0.0107484953f, -0.0211494993f, 0.0374629535f, -0.0630433932f, 0.10611251f, -0.196400478f, 0.586938143f,
+    0.673831463f, -0.194109231f, 0.0977559015f, -0.0541809164f, 0.0294895601f, -0.0145435324f, 0.00561683718f, -0.000672335445f,
+    -0.00165174855f, 0.00235561444f, -0.0021775146f, 0.00163159124f, -0.00103745062f, 0.000557482999f, -0.000241582122f, 7.25257269e-05f,
+    6.03654262e-05f, -0.000199517192f, 0.000441518467f, -0.000767697056f, 0.00108124875f, -0.00116713799f, 0.000657056924f, 0.000994527014f,
+    -0.00452451361f, 0.0108831972f, -0.02131713f, 0.0376555361f, -0.0632395595f, 0.10625831f, -0.196304917f, 0.584356785f,
+    0.676201046f, -0.193876773f, 0.0974240229f, -0.0538719222f, 0.0292281024f, -0.0143351741f, 0.00545955682f, -0.000560029875f,
+    -0.0017272738f, 0.00240312913f, -0.00220521702f, 0.00164636422f, -0.00104452472f, 0.000560446118f, -0.000242629554f, 7.28273808e-05f,
+    5.99993255e-05f, -0.000198248978f, 0.000438088115f, -0.000759885181f, 0.00106563291f, -0.00113902497f, 0.000610708143f, 0.00106527703f,
+    -0.00462519564f, 0.0110171735f, -0.0214835126f, 0.0378460921f, -0.0634325072f, 0.106399f, -0.196200803f, 0.581770778f,
+    0.678563535f, -0.193634778f, 0.0970869958f, -0.0535599217f, 0.0289648809f, -0.0141258175f, 0.00530175958f, -0.000447495899f,
+    -0.00180286693f, 0.00245063426f, -0.00223288243f, 0.00166109949f, -0.00105157099f, 0.000563392707f, -0.000243669318f, 7.31266628e-05f,
+    5.96321042e-05f, -0.000196976471f, 0.000434649031f, -0.000752061314f, 0.00105000916f, -0.00111092592f, 0.000564430724f, 0.0011358395f,
+    -0.00472548278f, 0.0111504169f, -0.0216486398f, 0.0380346067f, -0.0636222214f, 0.106534548f, -0.196088091f, 0.579180181f,
+    0.680918872f, -0.193383142f, 0.096744813f, -0.0532449186f, 0.0286998935f, -0.013915468f, 0.00514344918f, -0.000334738084f,
+    -0.00187852408f, 0.00249812729f, -0.00226050941f, 0.001675796f, -0.00105858862f, 0.000566322415f, -0.00024470131f, 7.34235291e-05f,
+    5.92637989e-05f, -0.000195699802f, 0.000431201508f, -0.000744226039f, 0.00103437819f, -0.00108284235f, 0.000518226647f, 0.00120621175f,
+    -0.00482537132f, 0.0112829246f, -0.0218125097f, 0.0382210761f, -0.0638087168f, 0.106664985f, -0.195966884f, 0.576585054f,
+    0.683266997f, -0.193121895f, 0.0963974819f, -0.0529269166f, 0.0284331571f, -0.013704136f, 0.00498463493f, -0.000221761366f,
+    -0.00195424235f, 0.00254560588f, -0.00228809658f, 0.00169045292f, -0.00106557738f, 0.000569235068f, -0.000245725387f, 7.37179435e-05f,
+    5.88944349e-05f, -0.000194419059f, 0.000427745748f, -0.000736379705f, 0.00101874117f, -0.00105477567f, 0.00047209792f, 0.00127639051f,
+    -0.00492485892f, 0.011414689f, -0.0219751131f, 0.0384054966f, -0.0639919788f, 0.106790312f, -0.195837185f, 0.573985398f,
+    0.68560791f, -0.192851007f, 0.0960450023f, -0.0526059382f, 0.0281646773f, -0.0134918289f, 0.00482532009f, -0.000108570479f,
+    -0.00203001802f, 0.00259306817f, -0.00231564254f, 0.00170506944f, -0.00107253669f, 0.000572130491f, -0.000246741489f, 7.40098694e-05f,
+    5.85240523e-05f, -0.000193134329f, 0.000424281898f, -0.000728522718f, 0.00100309832f, -0.00102672691f, 0.000426046492f, 0.00134637312f,
+    -0.00502393954f, 0.0115457084f, -0.022136448f, 0.0385878645f, -0.0641720071f, 0.106910519f, -0.195699021f, 0.57138139f,
+    0.687941551f, -0.192570448f, 0.0956873894f, -0.0522819757f, 0.0278944615f, -0.0132785533f, 0.00466551399f, 4.82974065e-06f,
+    -0.0021058477f, 0.00264051161f, -0.00234314566f, 0.00171964488f, -0.00107946608f, 0.000575008511f, -0.000247749587f, 7.42992779e-05f,
+    5.81526838e-05f, -0.000191845713f, 0.000420810276f, -0.00072065572f, 0.000987450825f, -0.000998697709f, 0.000380074431f, 0.001416157f,
+    -0.0051226113f, 0.0116759762f, -0.0222965069f, 0.038768176f, -0.0643488094f, 0.107025638f, -0.195552438f, 0.568773031f,
+    0.690267742f, -0.192280233f, 0.095324643f, -0.0519550592f, 0.0276225265f, -0.0130643202f, 0.00450522173f, 0.000118434429f,
+    -0.00218172814f, 0.00268793432f, -0.00237060501f, 0.00173417851f, -0.00108636555f, 0.000577868952f, -0.000248749508f, 7.45861398e-05f,
+    5.77803476e-05f, -0.000190553255f, 0.000417330943f, -0.000712778769f, 0.000971799192f, -0.000970689056f, 0.000334183598f, 0.00148573867f,
+    -0.00522086909f, 0.0118054878f, -0.0224552844f, 0.0389464237f, -0.0645223707f, 0.107135646f, -0.195397452f, 0.56616044f,
+    0.692586482f, -0.191980273f, 0.0949567556f, -0.0516251735f, 0.027348876f, -0.0128491344f, 0.00434444938f, 0.000232238715f,
+    -0.00225765607f, 0.00273533328f, -0.00239801896f, 0.00174866919f, -0.00109323417f, 0.000580711407f, -0.000249741192f, 7.48704042e-05f,
+    5.740708e-05f, -0.000189257102f, 0.000413844129f, -0.000704892445f, 0.0009561443f, -0.000942702172f, 0.000288376032f, 0.0015551158f,
+    -0.00531870965f, 0.0119342385f, -0.0226127766f, 0.0391226001f, -0.0646926835f, 0.107240565f, -0.195234105f, 0.563543677f,
+    0.694897711f, -0.191670597f, 0.0945837423f, -0.0512923412f, 0.0270735174f, -0.0126330052f, 0.00418320438f, 0.000346237706f,
+    -0.00233362732f, 0.00278270687f, -0.00242538587f, 0.00176311634f, -0.00110007171f, 0.000583535875f, -0.000250724523f, 7.5152042e-05f,
+    5.70329175e-05f, -0.000187957296f, 0.000410350156f, -0.000696997275f, 0.000940486905f, -0.000914738572f, 0.000242653681f, 0.00162428536f,
+    -0.00541612925f, 0.0120622246f, -0.022768978f, 0.039296709f, -0.0648597628f, 0.107340403f, -0.195062429f, 0.560922742f,
+    0.697201431f, -0.19135119f, 0.0942056105f, -0.0509565733f, 0.0267964657f, -0.0124159418f, 0.00402149325f, 0.000460426556f,
+    -0.0024096393f, 0.00283005275f, -0.00245270459f, 0.00177751912f, -0.00110687769f, 0.000586342008f, -0.000251699472f, 7.54310313e-05f,
+    5.66578856e-05f, -0.000186653924f, 0.000406849053f, -0.000689093431f, 0.000924827647f, -0.000886799186f, 0.000197018482f, 0.00169324467f,
+    -0.0055131237f, 0.0121894404f, -0.0229238849f, 0.0394687392f, -0.0650235936f, 0.107435159f, -0.194882467f, 0.558297694f,
+    0.699497521f, -0.191021994f, 0.09382236f, -0.0506178737f, 0.0265177265f, -0.0121979527f, 0.00385932205f, 0.000574800186f,
+    -0.00248568784f, 0.00287736836f, -0.00247997371f, 0.00179187674f, -0.00111365179f, 0.00058912969f, -0.000252665894f, 7.57073285e-05f,
+    5.62820242e-05f, -0.000185347119f, 0.000403341197f, -0.000681181496f, 0.0009091674f, -0.000858885644f, 0.000151472414f, 0.00176199095f,
+    -0.00560968975f, 0.0123158833f, -0.0230774879f, 0.0396386869f, -0.0651841834f, 0.107524842f, -0.194694251f, 0.555668712f,
+    0.701785862f, -0.190683022f, 0.0934339985f, -0.0502762608f, 0.0262373127f, -0.0119790444f, 0.00369669776f, 0.000689353852f,
+    -0.00256177038f, 0.00292465161f, -0.00250719185f, 0.00180618837f, -0.00112039351f, 0.000591898686f, -0.00025362373f, 7.598089e-05f,
+    5.59053551e-05f, -0.000184036937f, 0.000399826677f, -0.000673261937f, 0.00089350692f, -0.000830998993f, 0.000106017382f, 0.00183052127f,
+    -0.00570582412f, 0.0124415476f, -0.023229789f, 0.0398065485f, -0.0653415322f, 0.107609466f, -0.194497779f, 0.553035796f,
+    0.704066515f, -0.19033426f, 0.0930405334f, -0.0499317385f, 0.0259552337f, -0.011759229f, 0.00353362737f, 0.000804082549f,
+    -0.00263788272f, 0.00297190039f, -0.0025343576f, 0.00182045321f, -0.00112710253f, 0.000594648882f, -0.000254572835f, 7.62517011e-05f,
+    5.55279075e-05f, -0.000182723481f, 0.000396305753f, -0.000665334985f, 0.000877846905f, -0.000803140516f, 6.06553076e-05f, 0.0018988332f,
+    -0.00580152264f, 0.0125664277f, -0.0233807787f, 0.0399723239f, -0.0654956326f, 0.10768903f, -0.194293141f, 0.550399005f,
+    0.706339359f, -0.189975664f, 0.0926419646f, -0.049584318f, 0.0256714988f, -0.0115385111f, 0.00337011716f, 0.000918981212f,
+    -0.00271402183f, 0.00301911216f, -0.00256146933f, 0.00183467043f, -0.00113377825f, 0.000597379869f, -0.00025551318f, 7.65197183e-05f,
+    5.51497178e-05f, -0.000181406809f, 0.000392778602f, -0.000657401164f, 0.000862188113f, -0.000775311375f, 1.53881192e-05f, 0.00196692371f,
+    -0.00589678157f, 0.0126905208f, -0.0235304534f, 0.040136002f, -0.0656464845f, 0.107763536f, -0.194080323f, 0.54775846f,
+    0.708604276f, -0.189607218f, 0.092238307f, -0.0492340066f, 0.0253861174f, -0.0113169001f, 0.00320617389f, 0.00103404489f,
+    -0.00279018353f, 0.00306628505f, -0.00258852611f, 0.00184883934f, -0.00114042021f, 0.000600091531f, -0.000256444677f, 7.67848978e-05f,
+    5.4770815e-05f, -0.000180087023f, 0.000389245397f, -0.000649460824f, 0.000846531242f, -0.000747513026f, -2.97822771e-05f, 0.00203479012f,
+    -0.00599159766f, 0.0128138224f, -0.0236788094f, 0.0402975902f, -0.0657940805f, 0.107833005f, -0.193859398f, 0.54511416f,
+    0.710861325f, -0.189228922f, 0.0918295681f, -0.0488808192f, 0.0250991005f, -0.0110944072f, 0.00304180454f, 0.0011492687f,
+    -0.00286636525f, 0.00311341626f, -0.00261552632f, 0.00186295912f, -0.00114702841f, 0.000602783752f, -0.000257367181f, 7.70472179e-05f,
+    5.43912247e-05f, -0.000178764225f, 0.0003857064f, -0.000641514489f, 0.000830877107f, -0.000719746458f, -7.48539824e-05f, 0.00210242975f,
+    -0.00608596718f, 0.0129363285f, -0.023825841f, 0.0404570699f, -0.0659384355f, 0.107897438f, -0.193630368f, 0.542466223f,
+    0.713110328f, -0.188840747f, 0.0914157405f, -0.0485247672f, 0.0248104576f, -0.0108710388f, 0.00287701585f, 0.00126464746f,
+    -0.00294256327f, 0.00316050346f, -0.00264246808f, 0.00187702873f, -0.0011536018f, 0.00060545624f, -0.000258280634f, 7.73066349e-05f,
+    5.40109831e-05f, -0.000177438458f, 0.000382161757f, -0.000633562333f, 0.000815226464f, -0.000692013069f, -0.000119825097f, 0.0021698398f,
+    -0.00617988594f, 0.0130580319f, -0.0239715409f, 0.0406144485f, -0.0660795346f, 0.107956842f, -0.19339329f, 0.539814711f,
+    0.715351284f, -0.188442662f, 0.0909968391f, -0.0481658503f, 0.0245201979f, -0.0106468033f, 0.00271181483f, 0.00138017617f,
+    -0.00301877339f, 0.0032075448f, -0.00266935048f, 0.00189104746f, -0.00116014038f, 0.000608108763f, -0.000259184948f, 7.7563127e-05f,
+    5.36301195e-05f, -0.000176109854f, 0.000378611701f, -0.000625605055f, 0.000799579953f, -0.000664314022f, -0.00016469376f, 0.00223701773f,
+    -0.00627335208f, 0.0131789325f, -0.0241159108f, 0.0407697149f, -0.0662173852f, 0.108011231f, -0.193148166f, 0.537159622f,
+    0.717584193f, -0.188034669f, 0.0905728787f, -0.0478040949f, 0.0242283344f, -0.010421712f, 0.00254620775f, 0.00149584981f,
+    -0.0030949926f, 0.0032545377f, -0.0026961721f, 0.00190501474f, -0.00116664357f, 0.000610741205f, -0.000260080036f, 7.78166432e-05f,
+    5.32486592e-05f, -0.000174778485f, 0.000375056436f, -0.000617642771f, 0.000783938391f, -0.00063665054f, -0.000209458056f, 0.00230396097f,
+    -0.00636636093f, 0.0132990247f, -0.0242589433f, 0.0409228727f, -0.0663519874f, 0.108060613f, -0.192895085f, 0.534501135f,
+    0.719808936f, -0.187616765f, 0.0901438519f, -0.0474395044f, 0.0239348784f, -0.0101957703f, 0.00238020229f, 0.00161166326f,
+    -0.00317121763f, 0.00330148009f, -0.00272293156f, 0.00191892951f, -0.00117311091f, 0.000613353273f, -0.000260965811f, 7.80671617e-05f,
+    5.28666351e-05f, -0.000173444409f, 0.000371496106f, -0.000609676063f, 0.000768302416f, -0.000609023904f, -0.000254116138f, 0.00237066695f,
+    -0.00645890832f, 0.0134183038f, -0.0244006328f, 0.0410739109f, -0.0664833263f, 0.108104974f, -0.192634016f, 0.531839192f,
+    0.722025394f, -0.187188879f, 0.0897097811f, -0.0470720902f, 0.0236398373f, -0.00996898953f, 0.00221380475f, 0.00172761141f,
+    -0.00324744452f, 0.00334836938f, -0.00274962699f, 0.00193279097f, -0.00117954216f, 0.000615944795f, -0.000261842157f, 7.83146315e-05f,
+    5.24840761e-05f, -0.000172107757f, 0.000367931003f, -0.000601705397f, 0.000752672902f, -0.000581435277f, -0.000298666186f, 0.00243713288f,
+    -0.00655099284f, 0.0135367652f, -0.0245409776f, 0.0412228331f, -0.0666114241f, 0.108144358f, -0.19236505f, 0.52917397f,
+    0.724233627f, -0.186751053f, 0.0892706662f, -0.0467018671f, 0.0233432241f, -0.00974137895f, 0.00204702257f, 0.00184368936f,
+    -0.00332367024f, 0.0033952035f, -0.00277625793f, 0.00194659852f, -0.00118593685f, 0.000618515653f, -0.000262709043f, 7.85590455e-05f,
+    5.21010152e-05f, -0.000170768573f, 0.000364361244f, -0.000593730947f, 0.00073705049f, -0.000553885824f, -0.000343106338f, 0.00250335573f,
+    -0.00664260937f, 0.0136544071f, -0.0246799681f, 0.0413696319f, -0.066736266f, 0.108178742f, -0.192088187f, 0.52650553f,
+    0.726433456f, -0.186303228f, 0.0888265073f, -0.0463288352f, 0.0230450481f, -0.00951294508f, 0.00187986251f, 0.00195989176f,
+    -0.00339989061f, 0.00344198011f, -0.00280282181f, 0.00196035113f, -0.00119229429f, 0.000621065497f, -0.000263566297f, 7.88003454e-05f,
+    5.17174776e-05f, -0.000169426989f, 0.00036078706f, -0.000585753354f, 0.000721435936f, -0.000526376825f, -0.000387434702f, 0.00256933365f,
+    -0.00673375558f, 0.0137712229f, -0.0248176083f, 0.0415143073f, -0.0668578595f, 0.108208165f, -0.1918035f, 0.523833871f,
+    0.72862488f, -0.18584542f, 0.0883773342f, -0.0459530205f, 0.0227453224f, -0.0092836991f, 0.00171233166f, 0.00207621371f,
+    -0.0034761026f, 0.00348869688f, -0.00282931817f, 0.00197404833f, -0.00119861448f, 0.000623594213f, -0.000264413888f, 7.90385093e-05f,
+    5.13334926e-05f, -0.000168083046f, 0.000357208657f, -0.000577772793f, 0.000705829938f, -0.000498909503f, -0.000431649503f, 0.0026350636f,
+    -0.00682442775f, 0.0138872107f, -0.0249538887f, 0.0416568555f, -0.0669762045f, 0.10823261f, -0.191511005f, 0.521159172f,
+    0.730807841f, -0.185377598f, 0.0879231393f, -0.0455744304f, 0.0224440563f, -0.00905365031f, 0.00154443702f, 0.00219264952f,
+    -0.00355230249f, 0.00353535125f, -0.00285574491f, 0.00198768894f, -0.0012048966f, 0.000626101508f, -0.0002652517f, 7.92734936e-05f,
+    5.09490892e-05f, -0.000166736863f, 0.000353626208f, -0.000569789845f, 0.000690233253f, -0.000471484993f, -0.000475748908f, 0.0027005435f,
+    -0.00691462168f, 0.0140023651f, -0.0250888076f, 0.0417972691f, -0.0670912862f, 0.108252101f, -0.191210717f, 0.518481374f,
+    0.732982337f, -0.184899747f, 0.0874639302f, -0.0451930724f, 0.022141261f, -0.00882280618f, 0.00137618568f, 0.00230919477f,
+    -0.00362848677f, 0.00358194136f, -0.00288210111f, 0.00200127228f, -0.00121114054f, 0.000628587266f, -0.000266079674f, 7.95052692e-05f,
+    5.05643002e-05f, -0.000165388497f, 0.000350039918f, -0.000561804802f, 0.000674646639f, -0.000444104458f, -0.000519731082f, 0.00276577007f,
+    -0.00700433552f, 0.014116683f, -0.0252223592f, 0.0419355556f, -0.0672031268f, 0.108266644f, -0.19090271f, 0.515800595f,
+    0.735148191f, -0.184411824f, 0.0869997218f, -0.0448089652f, 0.0218369476f, -0.00859117694f, 0.00120758475f, 0.00242584385f,
+    -0.00370465149f, 0.00362846488f, -0.00290838513f, 0.00201479788f, -0.00121734559f, 0.000631051371f, -0.000266897725f, 7.97338071e-05f,
+    5.0179151e-05f, -0.000164038036f, 0.000346450048f, -0.000553818187f, 0.000659070676f, -0.000416769151f, -0.00056359428f, 0.00283074146f,
+    -0.007093566f, 0.014230161f, -0.0253545418f, 0.0420716964f, -0.0673117191f, 0.108276255f, -0.190586999f, 0.513116896f,
+    0.737305462f, -0.183913872f, 0.0865305364f, -0.0444221161f, 0.0215311274f, -0.00835877191f, 0.00103864132f, 0.00254259189f,
+    -0.00378079386f, 0.00367491902f, -0.0029345958f, 0.00202826434f, -0.00122351164f, 0.000633493357f, -0.000267705735f, 7.99590634e-05f,
+    4.97936708e-05f, -0.000162685566f, 0.000342856656f, -0.000545830233f, 0.000643506239f, -0.000389480236f, -0.000607336638f, 0.00289545464f,
+    -0.00718230894f, 0.0143427942f, -0.0254853517f, 0.0422057062f, -0.0674170628f, 0.108280927f, -0.190263614f, 0.510430396f,
+    0.739454031f, -0.183405846f, 0.0860563517f, -0.0440325364f, 0.0212238114f, -0.00812560041f, 0.000869362673f, 0.00265943306f,
+    -0.00385690969f, 0.00372130191f, -0.00296073128f, 0.00204167119f, -0.00122963812f, 0.00063591334f, -0.000268503587f, 8.0181002e-05f,
+    4.94078886e-05f, -0.000161331162f, 0.000339260034f, -0.000537841348f, 0.00062795385f, -0.000362238818f, -0.00065095647f, 0.00295990705f,
+    -0.00727056013f, 0.014454579f, -0.0256147813f, 0.0423375666f, -0.0675191581f, 0.108280681f, -0.1899326f, 0.507741094f,
+    0.741593778f, -0.182887718f, 0.0855771974f, -0.043640241f, 0.0209150091f, -0.00789167173f, 0.000699755794f, 0.0027763627f,
+    -0.00393299526f, 0.00376761076f, -0.00298679038f, 0.00205501751f, -0.00123572454f, 0.000638310798f, -0.000269291224f, 8.03995936e-05f,
+    4.90218299e-05f, -0.000159974923f, 0.000335660385f, -0.000529852055f, 0.000612414442f, -0.000335046177f, -0.000694451854f, 0.00302409707f,
+    -0.00735831959f, 0.0145655135f, -0.0257428307f, 0.0424672849f, -0.067618005f, 0.108275533f, -0.189594001f, 0.505049109f,
+    0.743724763f, -0.182359502f, 0.0850930884f, -0.043245241f, 0.0206047371f, -0.00765699428f, 0.00052982819f, 0.00289337547f,
+    -0.00400904799f, 0.00381384371f, -0.00301277172f, 0.00206830283f, -0.00124177046f, 0.000640685728f, -0.000270068616f, 8.06148091e-05f,
+    4.86355275e-05f, -0.000158616953f, 0.000332057854f, -0.000521862705f, 0.000596888596f, -0.000307903421f, -0.000737821218f, 0.00308802165f,
+    -0.00744558172f, 0.014675593f, -0.0258694962f, 0.042594865f, -0.0677136108f, 0.108265489f, -0.189247847f, 0.502354443f,
+    0.745846927f, -0.181821182f, 0.0846040249f, -0.0428475514f, 0.0202930067f, -0.00742157968f, 0.000359586906f, 0.00301046623f,
+    -0.004085063f, 0.00385999843f, -0.00303867436f, 0.00208152598f, -0.00124777574f, 0.000643037958f, -0.000270835619f, 8.08266122e-05f,
+    4.82490104e-05f, -0.00015725728f, 0.000328452676f, -0.000513873587f, 0.000581376953f, -0.000280811713f, -0.000781062641f, 0.00315167825f,
+    -0.00753234373f, 0.0147848129f, -0.025994774f, 0.042720288f, -0.0678059757f, 0.108250558f, -0.188894168f, 0.499657273f,
+    0.747960091f, -0.181272715f, 0.0841100141f, -0.042447187f, 0.0199798252f, -0.00718543539f, 0.00018903923f, 0.0031276294f,
+    -0.0041610375f, 0.00390607258f, -0.00306449598f, 0.0020946865f, -0.0012537397f, 0.000645367196f, -0.000271592173f, 8.10349666e-05f,
+    4.78623006e-05f, -0.000155896036f, 0.000324845023f, -0.000505885226f, 0.000565880386f, -0.000253772188f, -0.000824174553f, 0.00321506453f,
+    -0.0076186033f, 0.0148931714f, -0.0261186603f, 0.0428435653f, -0.0678950921f, 0.108230755f, -0.188533038f, 0.4969576f,
+    0.750064313f, -0.180714116f, 0.083611086f, -0.0420441553f, 0.019665204f, -0.00694857212f, 1.81924825e-05f, 0.0032448601f,
+    -0.00423696777f, 0.00395206315f, -0.00309023564f, 0.00210778345f, -0.00125966198f, 0.000647673267f, -0.000272338133f, 8.1239843e-05f,
+    4.74754306e-05f, -0.000154533263f, 0.000321235071f, -0.000497897912f, 0.000550399534f, -0.000226786069f, -0.000867155031f, 0.0032781784f,
+    -0.00770435669f, 0.0150006628f, -0.0262411516f, 0.042964682f, -0.0679809749f, 0.108206086f, -0.188164443f, 0.494255483f,
+    0.752159536f, -0.180145368f, 0.0831072256f, -0.0416384749f, 0.0193491597f, -0.00671099918f, -0.000152946013f, 0.00336215249f,
+    -0.00431285007f, 0.00399796898f, -0.00311589218f, 0.00212081568f, -0.00126554235f, 0.000649955997f, -0.000273073441f, 8.14411833e-05f,
+    4.70884261e-05f, -0.00015316908f, 0.000317623024f, -0.000489912054f, 0.000534935039f, -0.000199854432f, -0.000910002447f, 0.00334101683f,
+    -0.00778960157f, 0.0151072852f, -0.026362244f, 0.0430836529f, -0.0680636168f, 0.108176567f, -0.187788442f, 0.491551012f,
+    0.754245579f, -0.179566443f, 0.0825984553f, -0.041230157f, 0.0190316997f, -0.00647272589f, -0.000324368884f, 0.00347950193f,
+    -0.00438868115f, 0.00404378679f, -0.00314146373f, 0.00213378295f, -0.00127138011f, 0.000652215094f, -0.000273798039f, 8.16389875e-05f,
+    4.67013124e-05f, -0.000151803528f, 0.000314009056f, -0.000481928088f, 0.000519487599f, -0.000172978442f, -0.000952715112f, 0.00340357819f,
+    -0.0078743333f, 0.015213035f, -0.0264819339f, 0.0432004631f, -0.0681430101f, 0.108142197f, -0.187405095f, 0.488844216f,
+    0.756322563f, -0.178977326f, 0.0820847899f, -0.0408192091f, 0.0187128391f, -0.00623376248f, -0.000496068795f, 0.00359690282f,
+    -0.00446445681f, 0.00408951519f, -0.00316694914f, 0.0021466841f, -0.00127717492f, 0.000654450501f, -0.00027451184f, 8.18332046e-05f,
+    4.63141259e-05f, -0.000150436739f, 0.000310393429f, -0.000473946333f, 0.000504057971f, -0.000146159218f, -0.000995291281f, 0.00346585969f,
+    -0.00795855094f, 0.0153179104f, -0.0266002212f, 0.0433151126f, -0.0682191923f, 0.108103007f, -0.187014416f, 0.486135244f,
+    0.758390307f, -0.17837806f, 0.0815662369f, -0.0404056571f, 0.0183925889f, -0.00599411875f, -0.000668038381f, 0.00371434982f,
+    -0.00454017334f, 0.00413515046f, -0.00319234701f, 0.00215951866f, -0.00128292653f, 0.000656661927f, -0.000275214697f, 8.2023791e-05f,
+    4.59268849e-05f, -0.000149068743f, 0.000306776259f, -0.000465967198f, 0.000488646852f, -0.000119397904f, -0.00103772921f, 0.00352785923f,
+    -0.00804225076f, 0.0154219065f, -0.0267171003f, 0.0434276089f, -0.0682921335f, 0.108058996f, -0.186616436f, 0.483424097f,
+    0.760448754f, -0.177768573f, 0.0810428113f, -0.039989505f, 0.0180709641f, -0.005753804f, -0.000840270135f, 0.00383183733f,
+    -0.00461582793f, 0.00418069214f, -0.00321765593f, 0.00217228546f, -0.00128863438f, 0.000658849196f, -0.000275906583f, 8.22107322e-05f,
+    4.55396148e-05f, -0.000147699669f, 0.000303157751f, -0.00045799106f, 0.000473254826f, -9.269562e-05f, -0.00108002732f, 0.00358957378f,
+    -0.00812542904f, 0.0155250179f, -0.0268325675f, 0.0435379408f, -0.0683618411f, 0.10801018f, -0.186211213f, 0.480710864f,
+    0.762497962f, -0.177148849f, 0.0805145279f, -0.0395707712f, 0.0177479684f, -0.00551282801f, -0.00101275661f, 0.00394936046f,
+    -0.0046914164f, 0.00422613602f, -0.00324287429f, 0.00218498404f, -0.00129429798f, 0.000661012076f, -0.000276587409f, 8.23939918e-05f,
+    4.51523556e-05f, -0.000146329548f, 0.000299538136f, -0.000450018328f, 0.000457882677f, -6.60534861e-05f, -0.00112218386f, 0.00365100196f,
+    -0.00820808485f, 0.0156272445f, -0.0269466247f, 0.0436461121f, -0.0684283301f, 0.107956573f, -0.185798794f, 0.477995604f,
+    0.764537752f, -0.176518932f, 0.0799813941f, -0.0391494669f, 0.0174236242f, -0.00527120195f, -0.0011854904f, 0.00406691432f,
+    -0.00476693548f, 0.00427148072f, -0.00326800114f, 0.00219761371f, -0.00129991723f, 0.000663150451f, -0.000277257088f, 8.2573526e-05f,
+    4.47651146e-05f, -0.000144958482f, 0.000295917533f, -0.000442049321f, 0.000442531018f, -3.94726012e-05f, -0.00116419722f, 0.00371214119f,
+    -0.0082902126f, 0.0157285817f, -0.0270592626f, 0.0437521115f, -0.0684915856f, 0.107898176f, -0.185379177f, 0.475278378f,
+    0.766568124f, -0.175878748f, 0.07944341f, -0.0387256071f, 0.0170979388f, -0.00502893375f, -0.00135846389f, 0.00418449193f,
+    -0.00484238099f, 0.00431672391f, -0.00329303462f, 0.00221017282f, -0.00130549143f, 0.00066526403f, -0.000277915475f, 8.27492986e-05f,
+    4.4377939e-05f, -0.000143586571f, 0.000292296172f, -0.000434084504f, 0.000427200575f, -1.29540858e-05f, -0.00120606576f, 0.00377298915f,
+    -0.00837181229f, 0.0158290286f, -0.027170483f, 0.043855954f, -0.0685516298f, 0.107835025f, -0.184952453f, 0.472559333f,
+    0.76858902f, -0.175228342f, 0.0789006129f, -0.0382992066f, 0.0167709254f, -0.00478603458f, -0.00153166964f, 0.00430208957f,
+    -0.00491775014f, 0.00436186371f, -0.00331797358f, 0.00222266186f, -0.00131102034f, 0.000667352753f, -0.000278562569f, 8.29212877e-05f,
+    4.39908363e-05f, -0.000142213874f, 0.00028867423f, -0.00042612417f, 0.00041189199f, 1.35009641e-05f, -0.00124778773f, 0.00383354304f,
+    -0.00845287926f, 0.0159285795f, -0.0272802804f, 0.0439576246f, -0.0686084479f, 0.107767105f, -0.184518605f, 0.469838411f,
+    0.770600379f, -0.174567685f, 0.0783529952f, -0.0378702804f, 0.016442595f, -0.00454251468f, -0.00170510018f, 0.00441970071f,
+    -0.00499303825f, 0.00440689642f, -0.00334281661f, 0.00223507895f, -0.00131650351f, 0.000669416273f, -0.000279198255f, 8.30894569e-05f,
+    4.36038536e-05f, -0.000140840479f, 0.000285051909f, -0.000418168755f, 0.000396605988f, 3.98914526e-05f, -0.00128936151f, 0.00389380194f,
+    -0.00853341166f, 0.0160272326f, -0.0273886546f, 0.0440571345f, -0.0686620623f, 0.107694454f, -0.18407774f, 0.46711579f,
+    0.772602141f, -0.17389676f, 0.0778005868f, -0.0374388471f, 0.0161129627f, -0.0042983843f, -0.00187874807f, 0.00453732116f,
+    -0.00506824255f, 0.00445182109f, -0.00336756231f, 0.00224742386f, -0.00132194045f, 0.000671454589f, -0.000279822445f, 8.32537698e-05f,
+    4.32169982e-05f, -0.000139466443f, 0.000281429384f, -0.000410218578f, 0.000381343183f, 6.62162856e-05f, -0.00133078569f, 0.00395376235f,
+    -0.00861340482f, 0.0161249824f, -0.0274956003f, 0.0441544726f, -0.068712458f, 0.107617073f, -0.183629841f, 0.46439144f,
+    0.774594307f, -0.173215553f, 0.0772433877f, -0.0370049104f, 0.0157820433f, -0.00405365229f, -0.00205260515f, 0.00465494441f,
+    -0.00514335837f, 0.00449663494f, -0.00339220907f, 0.00225969614f, -0.00132733083f, 0.000673467293f, -0.000280435022f, 8.34141902e-05f,
+    4.28303028e-05f, -0.000138091869f, 0.00027780683f, -0.000402274047f, 0.000366104272f, 9.24743872e-05f, -0.00137205841f, 0.00401342241f,
+    -0.00869285874f, 0.0162218325f, -0.0276011191f, 0.0442496426f, -0.06875965f, 0.107534975f, -0.183174968f, 0.461665511f,
+    0.776576757f, -0.172524065f, 0.0766814128f, -0.0365684964f, 0.0154498443f, -0.00380832958f, -0.00222666422f, 0.00477256533f,
+    -0.00521838339f, 0.00454133516f, -0.0034167557f, 0.00227189413f, -0.00133267441f, 0.000675454328f, -0.000281035958f, 8.3570696e-05f,
+    4.24437967e-05f, -0.000136716815f, 0.000274184451f, -0.00039433554f, 0.000350889924f, 0.000118664684f, -0.00141317816f, 0.00407278072f,
+    -0.0087717697f, 0.0163177717f, -0.0277052037f, 0.0443426408f, -0.0688036382f, 0.107448176f, -0.182713166f, 0.458938032f,
+    0.778549492f, -0.171822295f, 0.0761146918f, -0.0361296125f, 0.0151163805f, -0.00356242643f, -0.00240091793f, 0.0048901788f,
+    -0.00529331248f, 0.00458592037f, -0.00344120106f, 0.00228401762f, -0.00133797037f, 0.000677415461f, -0.000281625136f, 8.37232365e-05f,
+    4.20575016e-05f, -0.000135341383f, 0.000270562392f, -0.000386403408f, 0.000335700781f, 0.00014478607f, -0.00145414355f, 0.00413183449f,
+    -0.00885013584f, 0.0164128039f, -0.0278078523f, 0.0444334708f, -0.0688444227f, 0.107356675f, -0.182244465f, 0.456209093f,
+    0.780512333f, -0.171110228f, 0.0755432174f, -0.0356882811f, 0.0147816679f, -0.00331595307f, -0.00257535814f, 0.00500777923f,
+    -0.00536814379f, 0.00463038683f, -0.00346554327f, 0.00229606614f, -0.00134321873f, 0.000679350458f, -0.000282202498f, 8.3871797e-05f,
+    4.16714429e-05f, -0.00013396563f, 0.000266940886f, -0.000378478027f, 0.000320537511f, 0.00017083752f, -0.00149495259f, 0.00419058139f,
+    -0.0089279525f, 0.0165069215f, -0.0279090684f, 0.0445221327f, -0.0688820109f, 0.107260518f, -0.181768909f, 0.453478754f,
+    0.782465398f, -0.170387849f, 0.0749670118f, -0.0352445096f, 0.0144457147f, -0.00306891976f, -0.00274997717f, 0.00512536103f,
+    -0.00544287171f, 0.00467473408f, -0.00348978117f, 0.00230803806f, -0.00134841877f, 0.000681259262f, -0.000282767898f, 8.40163266e-05f,
+    4.12856498e-05f, -0.000132589659f, 0.000263320078f, -0.000370559777f, 0.000305400754f, 0.000196817971f, -0.00153560401f, 0.00424901955f,
+    -0.00900521874f, 0.0166001245f, -0.0280088428f, 0.0446086191f, -0.0689164102f, 0.107159689f, -0.181286529f, 0.450747073f,
+    0.78440851f, -0.169655144f, 0.07438609f, -0.0347983167f, 0.0141085377f, -0.00282133697f, -0.00292476756f, 0.00524291862f,
+    -0.0055174944f, 0.0047189584f, -0.0035139136f, 0.00231993338f, -0.00135357049f, 0.000683141581f, -0.000283321366f, 8.41568035e-05f,
+    4.09001404e-05f, -0.000131213514f, 0.000259700144f, -0.000362648978f, 0.000290291151f, 0.000222726332f, -0.00157609605f, 0.00430714665f,
+    -0.00908192992f, 0.0166924074f, -0.0281071756f, 0.0446929373f, -0.0689476207f, 0.107054219f, -0.180797383f, 0.44801414f,
+    0.786341667f, -0.168912113f, 0.0738004744f, -0.0343497172f, 0.0137701491f, -0.0025732147f, -0.00309972139f, 0.00536044734f,
+    -0.00559200672f, 0.00476305792f, -0.00353793846f, 0.0023317507f, -0.00135867298f, 0.000684997183f, -0.000283862697f, 8.42931913e-05f,
+    4.05149513e-05f, -0.000129837295f, 0.000256081345f, -0.000354746036f, 0.00027520943f, 0.000248561584f, -0.00161642744f, 0.00436496129f,
+    -0.00915808696f, 0.0167837739f, -0.0282040685f, 0.0447750799f, -0.0689756423f, 0.106944114f, -0.180301517f, 0.445279986f,
+    0.788264871f, -0.168158755f, 0.0732101798f, -0.0338987336f, 0.0134305619f, -0.00232456392f, -0.00327483146f, 0.00547794066f,
+    -0.00566640589f, 0.00480703032f, -0.00356185529f, 0.00234349002f, -0.00136372633f, 0.00068682601f, -0.000284391892f, 8.4425461e-05f,
+    4.01300967e-05f, -0.000128461048f, 0.000252463738f, -0.000346851302f, 0.000260156172f, 0.000274322665f, -0.00165659632f, 0.00442246022f,
+    -0.00923368428f, 0.0168742165f, -0.0282995123f, 0.0448550545f, -0.0690004826f, 0.10682939f, -0.179798931f, 0.442544699f,
+    0.790177941f, -0.16739507f, 0.0726151988f, -0.0334453695f, 0.0130897881f, -0.00207539438f, -0.00345008913f, 0.00559539394f,
+    -0.00574068818f, 0.00485087326f, -0.00358566223f, 0.00235514971f, -0.00136872975f, 0.00068862777f, -0.000284908863f, 8.4553576e-05f,
+    3.97456024e-05f, -0.000127084888f, 0.000248847587f, -0.000338965125f, 0.000245132018f, 0.000300008571f, -0.00169660151f, 0.00447964296f,
+    -0.00930872187f, 0.0169637296f, -0.0283935107f, 0.0449328534f, -0.0690221488f, 0.106710061f, -0.179289714f, 0.439808369f,
+    0.792080939f, -0.166621029f, 0.0720155686f, -0.032989651f, 0.0127478447f, -0.00182571716f, -0.00362548744f, 0.00571280112f,
+    -0.0058148494f, 0.00489458442f, -0.00360935763f, 0.00236672955f, -0.0013736831f, 0.000690402288f, -0.000285413495f, 8.46775074e-05f,
+    3.93614973e-05f, -0.000125708888f, 0.000245233037f, -0.000331087853f, 0.000230137593f, 0.000325618224f, -0.00173644116f, 0.00453650625f,
+    -0.00938319508f, 0.017052317f, -0.02848606f, 0.0450084843f, -0.0690406412f, 0.106586143f, -0.17877388f, 0.437070996f,
+    0.793973804f, -0.165836647f, 0.0714112967f, -0.0325315893f, 0.0124047417f, -0.00157554261f, -0.003801018f, 0.00583015708f,
+    -0.00588888582f, 0.004938161f, -0.00363294082f, 0.00237822859f, -0.00137858605f, 0.00069214945f, -0.000285905699f, 8.47972115e-05f,
+    3.89778033e-05f, -0.000124333092f, 0.000241620291f, -0.000323219894f, 0.000215173597f, 0.000351150637f, -0.00177611399f, 0.00459304824f,
+    -0.00945710298f, 0.0171399731f, -0.0285771582f, 0.0450819358f, -0.0690559819f, 0.106457658f, -0.178251475f, 0.434332728f,
+    0.795856416f, -0.165041909f, 0.0708024129f, -0.032071203f, 0.0120604942f, -0.00132488133f, -0.00397667335f, 0.00594745623f,
+    -0.00596279465f, 0.00498160161f, -0.00365640991f, 0.00238964614f, -0.00138343789f, 0.00069386902f, -0.000286385446f, 8.49126736e-05f,
+    3.85945423e-05f, -0.000122957586f, 0.000238009496f, -0.000315361569f, 0.000200240611f, 0.000376604788f, -0.00181561837f, 0.00464926753f,
+    -0.00953044277f, 0.017226696f, -0.0286668036f, 0.045153223f, -0.0690681487f, 0.106324613f, -0.177722529f, 0.431593627f,
+    0.797728717f, -0.164236799f, 0.0701889098f, -0.031608507f, 0.011715116f, -0.00107374403f, -0.00415244559f, 0.00606469344f,
+    -0.00603657169f, 0.00502490345f, -0.00367976353f, 0.0024009815f, -0.00138823839f, 0.000695560768f, -0.000286852621f, 8.50238357e-05f,
+    3.82117469e-05f, -0.000121582467f, 0.000234400854f, -0.000307513226f, 0.000185339304f, 0.000401979632f, -0.00185495312f, 0.00470516132f,
+    -0.00960321166f, 0.0173124839f, -0.0287549961f, 0.045222342f, -0.0690771639f, 0.106187031f, -0.177187115f, 0.42885372f,
+    0.799590707f, -0.163421333f, 0.0695708171f, -0.0311435182f, 0.0113686202f, -0.000822141243f, -0.00432832632f, 0.00618186267f,
+    -0.00611021323f, 0.0050680642f, -0.00370300049f, 0.00241223397f, -0.00139298732f, 0.000697224634f, -0.000287307135f, 8.51306977e-05f,
+    3.78294317e-05f, -0.000120207784f, 0.000230794525f, -0.000299675216f, 0.000170470259f, 0.000427274208f, -0.00189411629f, 0.00476072868f,
+    -0.00967540778f, 0.0173973311f, -0.0288417321f, 0.0452892892f, -0.0690830275f, 0.106044918f, -0.176645249f, 0.426113069f,
+    0.801442385f, -0.162595496f, 0.0689481571f, -0.0306762531f, 0.0110210227f, -0.000570083677f, -0.00450430857f, 0.00629895832f,
+    -0.00618371554f, 0.00511108199f, -0.00372611964f, 0.00242340262f, -0.0013976841f, 0.000698860327f, -0.000287748931f, 8.52332014e-05f,
+    3.74476258e-05f, -0.000118833625f, 0.0002271907f, -0.000291847944f, 0.00015563413f, 0.000452487468f, -0.0019331068f, 0.00481596682f,
+    -0.00974702928f, 0.0174812414f, -0.0289270077f, 0.0453540646f, -0.069085747f, 0.105898291f, -0.176096976f, 0.423371792f,
+    0.803283632f, -0.161759272f, 0.06832093f, -0.0302067287f, 0.0106723337f, -0.000317582046f, -0.00468038395f, 0.00641597528f,
+    -0.00625707535f, 0.00515395356f, -0.00374911912f, 0.00243448652f, -0.00140232849f, 0.000700467732f, -0.000288177951f, 8.5331325e-05f,
+    3.70663511e-05f, -0.000117460055f, 0.000223589523f, -0.000284031703f, 0.000140831529f, 0.000477618451f, -0.00197192305f, 0.00487087388f,
+    -0.00981807243f, 0.0175642073f, -0.0290108286f, 0.0454166681f, -0.0690853223f, 0.105747178f, -0.175542355f, 0.420629919f,
+    0.805114388f, -0.160912693f, 0.0676891729f, -0.0297349636f, 0.0103225699f, -6.46472326e-05f, -0.00485654455f, 0.00653290749f,
+    -0.00633028895f, 0.00519667752f, -0.00377199799f, 0.00244548544f, -0.00140692003f, 0.000702046615f, -0.000288594048f, 8.54250393e-05f,
+    3.66856293e-05f, -0.000116087147f, 0.000219991212f, -0.000276226841f, 0.000126063082f, 0.000502666226f, -0.00201056385f, 0.00492544891f,
+    -0.0098885363f, 0.0176462308f, -0.0290931873f, 0.0454771072f, -0.0690817684f, 0.10559158f, -0.174981415f, 0.417887509f,
+    0.806934655f, -0.160055712f, 0.0670528933f, -0.0292609688f, 0.00997174531f, 0.000188710037f, -0.00503278244f, 0.00664975028f,
+    -0.00640335213f, 0.00523925107f, -0.00379475462f, 0.00245639822f, -0.00141145824f, 0.000703596859f, -0.000288997224f, 8.55143153e-05f,
+    3.63054824e-05f, -0.000114714981f, 0.0002163959f, -0.000268433709f, 0.000111329398f, 0.000527629629f, -0.00204902701f, 0.00497968867f,
+    -0.00995841902f, 0.0177273043f, -0.0291740838f, 0.0455353744f, -0.0690750778f, 0.105431512f, -0.174414173f, 0.415144652f,
+    0.808744371f, -0.15918833f, 0.0664120987f, -0.0287847687f, 0.00961987209f, 0.000442478864f, -0.00520909019f, 0.00676649716f,
+    -0.00647626119f, 0.00528167188f, -0.00381738762f, 0.00246722414f, -0.00141594291f, 0.000705118233f, -0.000289387302f, 8.55990947e-05f,
+    3.59259393e-05f, -0.000113343624f, 0.000212803774f, -0.000260652712f, 9.66310763e-05f, 0.000552507874f, -0.00208731228f, 0.00503359223f,
+    -0.0100277169f, 0.0178074315f, -0.0292535182f, 0.0455914773f, -0.0690652803f, 0.105267003f, -0.173840702f, 0.412401438f,
+    0.810543418f, -0.158310577f, 0.0657668263f, -0.0283063743f, 0.00926696695f, 0.000696648436f, -0.00538545894f, 0.00688314298f,
+    -0.00654901285f, 0.00532393809f, -0.00383989583f, 0.00247796276f, -0.00142037356f, 0.000706610561f, -0.000289764343f, 8.56793849e-05f,
+    3.55470183e-05f, -0.000111973146f, 0.000209214995f, -0.000252884085f, 8.19687339e-05f, 0.000577299914f, -0.00212541712f, 0.00508715771f,
+    -0.0100964298f, 0.017886607f, -0.0293314885f, 0.0456454158f, -0.0690523461f, 0.105098054f, -0.173261046f, 0.409657866f,
+    0.812331796f, -0.157422423f, 0.065117076f, -0.02782581f, 0.00891304109f, 0.00095120765f, -0.00556188123f, 0.00699968217f,
+    -0.00662160385f, 0.00536604738f, -0.00386227784f, 0.00248861313f, -0.00142474973f, 0.00070807361f, -0.000290128111f, 8.57551277e-05f,
+    3.51687449e-05f, -0.000110603636f, 0.000205629767f, -0.000245128293f, 6.73429822e-05f, 0.000602004817f, -0.00216334104f, 0.0051403828f,
+    -0.0101645542f, 0.0179648325f, -0.0294079948f, 0.0456971936f, -0.0690363199f, 0.104924709f, -0.172675252f, 0.406914085f,
+    0.814109504f, -0.156523883f, 0.0644628853f, -0.0273430869f, 0.0085581122f, 0.00120614585f, -0.00573834917f, 0.00711611006f,
+    -0.00669402955f, 0.00540799694f, -0.00388453272f, 0.00249917433f, -0.00142907142f, 0.000709507382f, -0.000290478667f, 8.58263011e-05f,
+    3.47911373e-05f, -0.000109235138f, 0.000202048221f, -0.000237385568f, 5.27544071e-05f, 0.000626621535f, -0.00220108218f, 0.00519326609f,
+    -0.0102320882f, 0.0180420987f, -0.0294830333f, 0.0457468033f, -0.0690171793f, 0.10474696f, -0.172083318f, 0.404170096f,
+    0.815876484f, -0.155614927f, 0.0638042465f, -0.0268582273f, 0.00820219144f, 0.00146145164f, -0.00591485435f, 0.00723241922f,
+    -0.00676628714f, 0.00544978445f, -0.00390665792f, 0.00250964588f, -0.00143333769f, 0.000710911525f, -0.000290815864f, 8.58928688e-05f,
+    3.44142209e-05f, -0.000107867738f, 0.000198470545f, -0.000229656289f, 3.82036123e-05f, 0.000651149312f, -0.0022386394f, 0.00524580572f,
+    -0.0102990298f, 0.0181184094f, -0.0295566041f, 0.0457942523f, -0.0689949319f, 0.104564831f, -0.17148535f, 0.401426017f,
+    0.817632556f, -0.15469557f, 0.0631412044f, -0.0263712462f, 0.00784529652f, 0.00171711436f, -0.00609138934f, 0.00734860543f,
+    -0.00683837244f, 0.00549140852f, -0.0039286539f, 0.0025200271f, -0.00143754866f, 0.000712285982f, -0.000291139615f, 8.5954809e-05f,
+    3.40380175e-05f, -0.000106501502f, 0.0001948969f, -0.000221940791f, 2.36911928e-05f, 0.000675586984f, -0.00227601081f, 0.00529799983f,
+    -0.0103653772f, 0.0181937609f, -0.029628709f, 0.0458395407f, -0.0689696074f, 0.104378343f, -0.170881346f, 0.398681879f,
+    0.81937784f, -0.153765813f, 0.0624737628f, -0.0258821603f, 0.00748743908f, 0.00197312259f, -0.00626794528f, 0.00746466313f,
+    -0.00691028219f, 0.00553286588f, -0.00395051716f, 0.00253031729f, -0.00144170376f, 0.000713630521f, -0.000291449862f, 8.60120781e-05f,
+    3.3662549e-05f, -0.000105136511f, 0.000191327446f, -0.000214239422f, 9.21773426e-06f, 0.000699933735f, -0.00231319573f, 0.00534984702f,
+    -0.0104311286f, 0.0182681549f, -0.0296993405f, 0.0458826683f, -0.0689411908f, 0.104187496f, -0.170271367f, 0.395937741f,
+    0.821112216f, -0.152825654f, 0.0618019402f, -0.0253909919f, 0.00712863496f, 0.00222946587f, -0.00644451473f, 0.00758058624f,
+    -0.00698201219f, 0.00557415467f, -0.00397224864f, 0.00254051504f, -0.00144580263f, 0.000714944908f, -0.000291746575f, 8.60646542e-05f,
+    3.32878371e-05f, -0.000103772822f, 0.000187762344f, -0.000206552504f, -5.21617267e-06f, 0.000724188634f, -0.00235019252f, 0.00540134497f,
+    -0.010496282f, 0.018341586f, -0.0297685061f, 0.0459236428f, -0.0689096898f, 0.103992335f, -0.169655442f, 0.393193722f,
+    0.822835624f, -0.151875094f, 0.0611257702f, -0.0248977561f, 0.00676889904f, 0.00248613232f, -0.00662108976f, 0.0076963692f,
+    -0.00705355871f, 0.00561527256f, -0.00399384508f, 0.00255062059f, -0.0014498448f, 0.000716229086f, -0.000292029639f, 8.61125081e-05f,
+    3.29139039e-05f, -0.000102410515f, 0.000184201795f, -0.000198880371f, -1.96099445e-05f, 0.000748350692f, -0.00238699978f, 0.00545249274f,
+    -0.0105608348f, 0.0184140503f, -0.0298361983f, 0.0459624603f, -0.068875134f, 0.103792861f, -0.169033632f, 0.390449822f,
+    0.824548006f, -0.150914118f, 0.0604452565f, -0.0244024694f, 0.00640824577f, 0.00274311122f, -0.00679766154f, 0.0078120064f,
+    -0.00712491898f, 0.00565621769f, -0.00401530648f, 0.00256063254f, -0.00145383005f, 0.000717482879f, -0.000292298937f, 8.61555964e-05f,
+    3.25407709e-05f, -0.000101049642f, 0.000180645933f, -0.000191223342f, -3.3963006e-05f, 0.000772419036f, -0.00242361659f, 0.005503288f,
+    -0.0106247859f, 0.0184855517f, -0.0299024209f, 0.0459991246f, -0.0688375011f, 0.103589088f, -0.168405965f, 0.38770619f,
+    0.826249421f, -0.149942756f, 0.0597604215f, -0.0239051543f, 0.00604668958f, 0.00300039095f, -0.00697422307f, 0.00792749319f,
+    -0.00719608832f, 0.0056969868f, -0.00403663004f, 0.00257055066f, -0.00145775802f, 0.000718705996f, -0.000292554469f, 8.61939043e-05f,
+    3.21684565e-05f, -9.96902963e-05f, 0.000177094931f, -0.000183581753f, -4.82747746e-05f, 0.000796392851f, -0.00246004132f, 0.0055537289f,
+    -0.0106881326f, 0.0185560845f, -0.0299671721f, 0.0460336357f, -0.0687968135f, 0.103381045f, -0.167772487f, 0.384962827f,
+    0.827939689f, -0.148960963f, 0.059071295f, -0.0234058294f, 0.00568424584f, 0.00325796101f, -0.00715076504f, 0.00804282259f,
+    -0.00726706395f, 0.0057375785f, -0.0040578167f, 0.00258037401f, -0.00146162824f, 0.00071989838f, -0.000292796118f, 8.62273882e-05f,
+    3.17969825e-05f, -9.83325153e-05f, 0.000173548964f, -0.000175955924f, -6.25446773e-05f, 0.000820271089f, -0.00249627279f, 0.00560381496f,
+    -0.0107508749f, 0.0186256506f, -0.0300304517f, 0.0460660011f, -0.0687530711f, 0.103168748f, -0.167133257f, 0.382219851f,
+    0.829618812f, -0.147968784f, 0.0583778918f, -0.0229045097f, 0.00532092899f, 0.00351580954f, -0.00732728047f, 0.00815798994f,
+    -0.00733784214f, 0.00577799045f, -0.00407886319f, 0.00259010168f, -0.00146544049f, 0.000721059914f, -0.000293023855f, 8.62560337e-05f,
+    3.14263743e-05f, -9.69764005e-05f, 0.000170008163f, -0.000168346189f, -7.67721576e-05f, 0.000844052876f, -0.00253230962f, 0.00565354386f,
+    -0.0108130099f, 0.0186942462f, -0.030092258f, 0.0460962132f, -0.0687062964f, 0.102952205f, -0.16648832f, 0.379477262f,
+    0.831286788f, -0.146966189f, 0.0576802306f, -0.0224012174f, 0.00495675486f, 0.00377392536f, -0.00750376051f, 0.00827298965f,
+    -0.00740841823f, 0.00581821986f, -0.00409976859f, 0.00259973318f, -0.00146919431f, 0.000722190307f, -0.000293237565f, 8.6279797e-05f,
+    3.10566465e-05f, -9.56219956e-05f, 0.000166472717f, -0.000160752868f, -9.0956637e-05f, 0.000867737399f, -0.00256815087f, 0.00570291374f,
+    -0.010874535f, 0.0187618677f, -0.0301525909f, 0.0461242869f, -0.0686564744f, 0.102731451f, -0.16583766f, 0.376735151f,
+    0.832943499f, -0.145953193f, 0.05697833f, -0.0218959674f, 0.00459173741f, 0.00403229753f, -0.00768019678f, 0.00838781521f,
+    -0.00747878943f, 0.00585826486f, -0.00412053242f, 0.0026092676f, -0.00147288933f, 0.000723289384f, -0.000293437159f, 8.6298649e-05f,
+    3.06878246e-05f, -9.42693659e-05f, 0.000162942742f, -0.000153176268f, -0.000105097555f, 0.000891323667f, -0.00260379468f, 0.00575192273f,
+    -0.0109354481f, 0.0188285168f, -0.0302114487f, 0.0461502075f, -0.0686036274f, 0.102506489f, -0.165181398f, 0.373993605f,
+    0.834589005f, -0.144929782f, 0.0562722161f, -0.0213887841f, 0.00422589201f, 0.0042909137f, -0.00785658229f, 0.00850246102f,
+    -0.00754895154f, 0.00589812314f, -0.00414115237f, 0.00261870469f, -0.00147652533f, 0.000724357029f, -0.000293622608f, 8.63125679e-05f,
+    3.03199249e-05f, -9.2918599e-05f, 0.000159418472f, -0.000145616723f, -0.000119194359f, 0.000914810982f, -0.00263924035f, 0.00580057036f,
+    -0.0109957503f, 0.0188941918f, -0.0302688349f, 0.0461739935f, -0.0685477629f, 0.102277339f, -0.164519563f, 0.371252686f,
+    0.836223125f, -0.143895984f, 0.0555619076f, -0.0208796822f, 0.00385923451f, 0.00454976363f, -0.0080329068f, 0.00861692335f,
+    -0.00761890132f, 0.00593779329f, -0.00416162796f, 0.00262804329f, -0.00148010184f, 0.000725393125f, -0.000293793855f, 8.63215173e-05f,
+    2.99529693e-05f, -9.15697528e-05f, 0.000155900008f, -0.000138074538f, -0.000133246489f, 0.000938198296f, -0.00267448649f, 0.00584885478f,
+    -0.0110554378f, 0.0189588927f, -0.0303247459f, 0.0461956412f, -0.068488881f, 0.102044031f, -0.16385217f, 0.368512481f,
+    0.837845922f, -0.142851785f, 0.0548474304f, -0.0203686822f, 0.00349177956f, 0.00480883522f, -0.00820916425f, 0.00873119477f,
+    -0.00768863503f, 0.00597727112f, -0.00418195734f, 0.00263728271f, -0.0014836184f, 0.00072639744f, -0.000293950783f, 8.63254681e-05f,
+    2.95869777e-05f, -9.02228785e-05f, 0.00015238754f, -0.000130550034f, -0.000147253391f, 0.000961484737f, -0.00270953192f, 0.00589677412f,
+    -0.0111145088f, 0.0190226138f, -0.0303791836f, 0.0462151542f, -0.0684270039f, 0.101806581f, -0.163179263f, 0.365773022f,
+    0.839457273f, -0.141797185f, 0.0541287921f, -0.0198558047f, 0.00312354253f, 0.00506811775f, -0.00838534627f, 0.00884527154f,
+    -0.00775814988f, 0.00601655617f, -0.0042021391f, 0.00264642248f, -0.00148707489f, 0.000727369916f, -0.000294093334f, 8.63244059e-05f,
+    2.9221972e-05f, -8.8878056e-05f, 0.000148881183f, -0.00012304353f, -0.000161214542f, 0.000984669663f, -0.0027443755f, 0.00594432652f,
+    -0.0111729633f, 0.0190853588f, -0.0304321498f, 0.0462325364f, -0.0683621317f, 0.101565003f, -0.162500918f, 0.363034397f,
+    0.841057241f, -0.140732214f, 0.0534060374f, -0.0193410683f, 0.00275453902f, 0.00532759912f, -0.00856144354f, 0.00895914622f,
+    -0.00782744121f, 0.00605564518f, -0.00422217278f, 0.00265546236f, -0.00149047107f, 0.00072831026f, -0.000294221478f, 8.63182795e-05f,
+    2.88579668e-05f, -8.75353435e-05f, 0.000145381127f, -0.000115555311f, -0.000175129375f, 0.00100775203f, -0.00277901557f, 0.00599151151f,
+    -0.0112307975f, 0.0191471204f, -0.0304836389f, 0.046247784f, -0.0682942569f, 0.101319306f, -0.161817148f, 0.360296637f,
+    0.842645705f, -0.139656812f, 0.0526791662f, -0.0188244916f, 0.00238478393f, 0.00558726722f, -0.00873744674f, 0.00907281321f,
+    -0.00789650436f, 0.00609453581f, -0.00424205605f, 0.00266440026f, -0.00149380602f, 0.000729218358f, -0.000294335099f, 8.630706e-05f,
+    2.84949838e-05f, -8.61948065e-05f, 0.000141887518f, -0.000108085726f, -0.000188997335f, 0.0010307309f, -0.00281345169f, 0.00603832677f,
+    -0.0112880124f, 0.0192079041f, -0.0305336546f, 0.0462609008f, -0.0682234094f, 0.101069532f, -0.161128014f, 0.35755983f,
+    0.844222605f, -0.138571039f, 0.0519482084f, -0.0183060952f, 0.00201429334f, 0.00584711228f, -0.00891335122f, 0.00918626692f,
+    -0.00796533842f, 0.00613322714f, -0.00426178845f, 0.00267323689f, -0.00149707997f, 0.000730094034f, -0.00029443411f, 8.629074e-05f,
+    2.81330449e-05f, -8.48565105e-05f, 0.000138400501f, -0.000100635043f, -0.00020281793f, 0.00105360569f, -0.00284768199f, 0.0060847709f,
+    -0.0113446051f, 0.0192677062f, -0.030582197f, 0.0462718979f, -0.068149589f, 0.100815684f, -0.160433546f, 0.354824036f,
+    0.845787942f, -0.137474865f, 0.05121319f, -0.0177858993f, 0.00164308236f, 0.00610712124f, -0.00908914581f, 0.00929950364f,
+    -0.00803393684f, 0.00617171545f, -0.00428136764f, 0.00268197083f, -0.00150029233f, 0.000730937172f, -0.000294518512f, 8.62692759e-05f,
+    2.77721665e-05f, -8.35205283e-05f, 0.000134920265f, -9.32036055e-05f, -0.00021659059f, 0.0010763756f, -0.00288170599f, 0.00613084342f,
+    -0.0114005739f, 0.0193265267f, -0.0306292661f, 0.0462807789f, -0.0680728108f, 0.100557797f, -0.159733832f, 0.352089375f,
+    0.847341657f, -0.136368349f, 0.0504741333f, -0.0172639266f, 0.00127116672f, 0.00636728294f, -0.00926482398f, 0.00941251591f,
+    -0.00810229871f, 0.00620999979f, -0.00430079363f, 0.00269060163f, -0.00150344288f, 0.000731747656f, -0.000294588215f, 8.62426459e-05f,
+    2.74123686e-05f, -8.2186918e-05f, 0.000131446912f, -8.57916821e-05f, -0.000230314807f, 0.00109903957f, -0.00291552232f, 0.00617654203f,
+    -0.0114559187f, 0.0193843599f, -0.0306748617f, 0.0462875329f, -0.0679930747f, 0.100295879f, -0.159028858f, 0.349355847f,
+    0.848883688f, -0.135251433f, 0.0497310609f, -0.0167401899f, 0.000898562022f, 0.0066275862f, -0.00944037642f, 0.00952529814f,
+    -0.00817041844f, 0.00624807738f, -0.00432006503f, 0.00269912882f, -0.00150653115f, 0.00073252531f, -0.000294643134f, 8.62108209e-05f,
+    2.70536675e-05f, -8.08557234e-05f, 0.000127980617f, -7.83995929e-05f, -0.000243990056f, 0.00112159702f, -0.00294912932f, 0.0062218653f,
+    -0.0115106367f, 0.0194412116f, -0.0307189859f, 0.0462921783f, -0.0679103956f, 0.100029945f, -0.158318698f, 0.34662351f,
+    0.850414038f, -0.134124145f, 0.0489839911f, -0.0162147153f, 0.000525284035f, 0.00688801892f, -0.00961579476f, 0.00963784661f,
+    -0.00823829323f, 0.00628594542f, -0.00433917949f, 0.00270755123f, -0.0015095569f, 0.000733269902f, -0.000294683181f, 8.61737644e-05f,
+    2.66960851e-05f, -7.95270389e-05f, 0.000124521524f, -7.10276363e-05f, -0.000257615815f, 0.00114404701f, -0.00298252678f, 0.00626681279f,
+    -0.0115647269f, 0.0194970779f, -0.0307616387f, 0.0462947041f, -0.0678247809f, 0.0997600257f, -0.157603398f, 0.343892485f,
+    0.851932645f, -0.132986486f, 0.0482329503f, -0.0156875215f, 0.000151348489f, 0.00714856945f, -0.00979107153f, 0.00975015294f,
+    -0.00830592029f, 0.00632360252f, -0.00435813703f, 0.00271586841f, -0.0015125199f, 0.000733981375f, -0.000294708356f, 8.6131462e-05f,
+    2.6339636e-05f, -7.82008938e-05f, 0.000121069796f, -6.3676096e-05f, -0.000271191559f, 0.00116638863f, -0.00301571283f, 0.00631138217f,
+    -0.0116181867f, 0.0195519552f, -0.0308028162f, 0.0462951288f, -0.0677362308f, 0.0994861349f, -0.156882986f, 0.341162801f,
+    0.85343945f, -0.131838486f, 0.0474779643f, -0.015158629f, -0.000223228824f, 0.00740922615f, -0.00996619835f, 0.0098622134f,
+    -0.00837329309f, 0.00636104634f, -0.00437693484f, 0.00272407988f, -0.00151541946f, 0.000734659436f, -0.000294718513f, 8.608387e-05f,
+    2.59843382e-05f, -7.68773752e-05f, 0.000117625568f, -5.63452923e-05f, -0.000284716749f, 0.00118862116f, -0.00304868654f, 0.00635557203f,
+    -0.0116710169f, 0.0196058434f, -0.0308425203f, 0.0462934449f, -0.0676447675f, 0.0992082879f, -0.156157538f, 0.338434517f,
+    0.854934454f, -0.130680099f, 0.0467190519f, -0.0146280574f, -0.000598431972f, 0.00766997784f, -0.0101411669f, 0.00997402146f,
+    -0.00844041072f, 0.0063982741f, -0.0043955734f, 0.00273218472f, -0.00151825557f, 0.000735304027f, -0.000294713653f, 8.60309665e-05f,
+    2.56302137e-05f, -7.5556527e-05f, 0.000114189002f, -4.90355014e-05f, -0.00029819092f, 0.00121074403f, -0.00308144721f, 0.00639938191f,
+    -0.0117232157f, 0.0196587481f, -0.0308807585f, 0.04628966f, -0.0675503984f, 0.0989265218f, -0.155427068f, 0.335707754f,
+    0.856417537f, -0.129511386f, 0.0459562428f, -0.0140958279f, -0.000974245078f, 0.00793081243f, -0.0103159677f, 0.0100855725f,
+    -0.00850726943f, 0.00643528486f, -0.00441405037f, 0.00274018222f, -0.00152102776f, 0.000735915091f, -0.000294693687f, 8.5972737e-05f,
+    2.52772788e-05f, -7.42384218e-05f, 0.000110760229f, -4.17470146e-05f, -0.000311613578f, 0.00123275619f, -0.00311399321f, 0.00644281041f,
+    -0.0117747812f, 0.01971066f, -0.0309175272f, 0.0462837778f, -0.0674531236f, 0.0986408442f, -0.154691622f, 0.33298251f,
+    0.857888699f, -0.128332332f, 0.0451895595f, -0.0135619631f, -0.00135065219f, 0.00819171779f, -0.0104905935f, 0.0101968609f,
+    -0.00857386459f, 0.00647207489f, -0.00443236483f, 0.00274807215f, -0.00152373582f, 0.000736492337f, -0.000294658559f, 8.59091451e-05f,
+    2.49255481e-05f, -7.29231178e-05f, 0.000107339401f, -3.44801301e-05f, -0.000324984139f, 0.00125465705f, -0.00314632407f, 0.00648585567f,
+    -0.0118257133f, 0.0197615847f, -0.0309528243f, 0.046275802f, -0.067352958f, 0.0983512849f, -0.153951287f, 0.330258876f,
+    0.859347999f, -0.127142921f, 0.0444190241f, -0.0130264806f, -0.00172763714f, 0.00845268182f, -0.0106650367f, 0.010307881f,
+    -0.00864019338f, 0.00650864281f, -0.00445051584f, 0.00275585335f, -0.00152637938f, 0.000737035647f, -0.00029460821f, 8.58401545e-05f,
+    2.45750434e-05f, -7.16106733e-05f, 0.000103926657f, -2.72351317e-05f, -0.000338302227f, 0.00127644581f, -0.0031784384f, 0.00652851723f,
+    -0.0118760103f, 0.0198115185f, -0.0309866536f, 0.0462657362f, -0.0672499165f, 0.0980578586f, -0.15320605f, 0.32753697f,
+    0.8607952f, -0.125943199f, 0.0436446629f, -0.0124894045f, -0.0021051839f, 0.00871369429f, -0.0108392891f, 0.0104186265f,
+    -0.00870625116f, 0.00654498721f, -0.00446850155f, 0.00276352535f, -0.00152895809f, 0.000737544964f, -0.000294542551f, 8.57657578e-05f,
+    2.42257775e-05f, -7.03011465e-05f, 0.000100522142f, -2.0012305e-05f, -0.000351567258f, 0.00129812164f, -0.00321033527f, 0.00657079276f,
+    -0.0119256703f, 0.0198604614f, -0.0310190171f, 0.0462535881f, -0.0671440065f, 0.0977605805f, -0.152456015f, 0.324816763f,
+    0.86223048f, -0.12473315f, 0.0428664982f, -0.0119507536f, -0.00248327642f, 0.00897474308f, -0.0110133402f, 0.0105290907f,
+    -0.00877203699f, 0.00658110483f, -0.00448632101f, 0.00277108769f, -0.00153147161f, 0.000738020113f, -0.000294461526f, 8.56859187e-05f,
+    2.38777702e-05f, -6.89946028e-05f, 9.7126016e-05f, -1.28119336e-05f, -0.000364778738f, 0.00131968374f, -0.00324201374f, 0.00661268225f,
+    -0.0119746923f, 0.0199084133f, -0.0310499128f, 0.0462393537f, -0.0670352355f, 0.0974594802f, -0.151701167f, 0.322098345f,
+    0.86365366f, -0.12351279f, 0.0420845635f, -0.0114105502f, -0.00286189863f, 0.00923581421f, -0.0111871837f, 0.0106392717f,
+    -0.00883754436f, 0.00661699381f, -0.00450397329f, 0.0027785399f, -0.00153391983f, 0.000738460862f, -0.000294365105f, 8.56006154e-05f,
+    2.35310363e-05f, -6.76910786e-05f, 9.37383884e-05f, -5.63429921e-06f, -0.000377936201f, 0.00134113152f, -0.00327347266f, 0.00665418338f,
+    -0.0120230755f, 0.0199553706f, -0.0310793407f, 0.0462230369f, -0.0669236034f, 0.0971545726f, -0.150941581f, 0.319381803f,
+    0.865064681f, -0.122282103f, 0.0412988663f, -0.0108688148f, -0.00324103376f, 0.00949689746f, -0.0113608092f, 0.0107491594f,
+    -0.00890276954f, 0.00665265135f, -0.00452145608f, 0.00278588035f, -0.00153630215f, 0.000738867035f, -0.000294253201f, 8.55097896e-05f,
+    2.31855938e-05f, -6.63906612e-05f, 9.03594409e-05f, 1.52031726e-06f, -0.000391039212f, 0.00136246416f, -0.00330471108f, 0.00669529662f,
+    -0.0120708197f, 0.0200013407f, -0.0311073083f, 0.0462046526f, -0.0668091327f, 0.0968458876f, -0.150177315f, 0.316667199f,
+    0.866463602f, -0.121041134f, 0.0405094549f, -0.0103255687f, -0.00362066599f, 0.00975798257f, -0.0115342112f, 0.0108587518f,
+    -0.00896771159f, 0.00668807654f, -0.00453876983f, 0.00279310951f, -0.00153861847f, 0.000739238749f, -0.000294125784f, 8.54134705e-05f,
+    2.28414574e-05f, -6.50933944e-05f, 8.69892756e-05f, 8.65163838e-06f, -0.000404087245f, 0.00138368097f, -0.00333572784f, 0.00673601916f,
+    -0.0121179223f, 0.0200463142f, -0.0311338101f, 0.0461841933f, -0.0666918382f, 0.0965334401f, -0.1494084f, 0.313954622f,
+    0.867850304f, -0.119789869f, 0.0397163369f, -0.00978083443f, -0.00400077878f, 0.0100190537f, -0.0117073804f, 0.0109680407f,
+    -0.00903236493f, 0.00672326703f, -0.00455591222f, 0.00280022621f, -0.00154086831f, 0.000739575655f, -0.00029398271f, 8.53115926e-05f,
+    2.24986452e-05f, -6.37993289e-05f, 8.36280451e-05f, 1.57593895e-05f, -0.000417079806f, 0.00140478124f, -0.00336652226f, 0.00677635102f,
+    -0.0121643841f, 0.020090295f, -0.0311588515f, 0.046161674f, -0.0665717125f, 0.0962172523f, -0.148634881f, 0.311244071f,
+    0.869224846f, -0.118528329f, 0.0389195494f, -0.00923463423f, -0.00438135583f, 0.0102801025f, -0.0118803075f, 0.011077024f,
+    -0.00909672771f, 0.00675822049f, -0.00457288232f, 0.00280722999f, -0.00154305133f, 0.000739877578f, -0.000293824036f, 8.52041485e-05f,
+    2.21571718e-05f, -6.25085377e-05f, 8.0275895e-05f, 2.28432946e-05f, -0.000430016458f, 0.00142576417f, -0.00339709339f, 0.00681628985f,
+    -0.0122102024f, 0.020133283f, -0.0311824288f, 0.0461370945f, -0.0664487779f, 0.0958973467f, -0.147856802f, 0.308535695f,
+    0.870587051f, -0.117256515f, 0.0381191149f, -0.00868698768f, -0.00476238085f, 0.010541115f, -0.012052983f, 0.0111856926f,
+    -0.00916079432f, 0.00679293368f, -0.00458967919f, 0.00281411991f, -0.00154516764f, 0.000740144576f, -0.000293649646f, 8.50911092e-05f,
+    2.18170535e-05f, -6.12210642e-05f, 7.6932949e-05f, 2.99030871e-05f, -0.000442896795f, 0.00144662918f, -0.0034274403f, 0.0068558366f,
+    -0.0122553771f, 0.0201752782f, -0.0312045496f, 0.0461104549f, -0.0663230494f, 0.0955737457f, -0.147074223f, 0.305829465f,
+    0.871936977f, -0.115974441f, 0.037315052f, -0.00813791808f, -0.00514383661f, 0.0108020809f, -0.0122254035f, 0.0112940427f,
+    -0.00922456291f, 0.00682740659f, -0.00460630143f, 0.00282089575f, -0.00154721644f, 0.000740376359f, -0.000293459452f, 8.49724456e-05f,
+    2.14783067e-05f, -5.99369669e-05f, 7.35993526e-05f, 3.69384907e-05f, -0.000455720205f, 0.00146737543f, -0.00345756183f, 0.00689498801f,
+    -0.0122999074f, 0.0202162806f, -0.0312252138f, 0.0460817628f, -0.0661945269f, 0.095246464f, -0.146287173f, 0.30312553f,
+    0.873274624f, -0.114682108f, 0.0365074016f, -0.00758744683f, -0.00552570773f, 0.0110629862f, -0.0123975547f, 0.0114020687f,
+    -0.00928802881f, 0.00686163502f, -0.00462274766f, 0.00282755704f, -0.00154919759f, 0.00074057281f, -0.000293253455f, 8.48481359e-05f,
+    2.1140946e-05f, -5.86563037e-05f, 7.02752441e-05f, 4.39492396e-05f, -0.000468486367f, 0.00148800237f, -0.00348745706f, 0.00693374453f,
+    -0.0123437922f, 0.0202562865f, -0.0312444195f, 0.0460510291f, -0.0660632253f, 0.0949155465f, -0.145495698f, 0.30042389f,
+    0.874599874f, -0.113379546f, 0.0356961824f, -0.00703559583f, -0.005907977f, 0.0113238208f, -0.012569434f, 0.011509764f,
+    -0.00935119018f, 0.00689561898f, -0.00463901693f, 0.00283410237f, -0.00155111111f, 0.000740733871f, -0.000293031568f, 8.47181509e-05f,
+    2.08049878e-05f, -5.73791294e-05f, 6.69607398e-05f, 5.09350757e-05f, -0.000481194787f, 0.00150850927f, -0.00351712527f, 0.00697210478f,
+    -0.0123870317f, 0.0202953015f, -0.0312621705f, 0.0460182503f, -0.0659291595f, 0.0945809856f, -0.144699872f, 0.297724634f,
+    0.875912666f, -0.112066738f, 0.0348814204f, -0.00648238789f, -0.00629062811f, 0.0115845716f, -0.0127410283f, 0.011617125f,
+    -0.00941404141f, 0.00692935474f, -0.00465510832f, 0.00284053199f, -0.0015529563f, 0.000740859366f, -0.00029279376f, 8.45824761e-05f,
+    2.04704429e-05f, -5.61054949e-05f, 6.36559926e-05f, 5.78957261e-05f, -0.000493844971f, 0.00152889523f, -0.00354656554f, 0.00701006688f,
+    -0.0124296229f, 0.020333318f, -0.0312784687f, 0.0459834337f, -0.0657923371f, 0.0942428187f, -0.143899694f, 0.295027822f,
+    0.877213061f, -0.110743716f, 0.0340631418f, -0.00592784397f, -0.0066736429f, 0.0118452264f, -0.0129123311f, 0.0117241433f,
+    -0.00947657973f, 0.00696283998f, -0.0046710195f, 0.00284684449f, -0.00155473303f, 0.000740949123f, -0.000292539917f, 8.44410679e-05f,
+    2.01373314e-05f, -5.48354583e-05f, 6.03611188e-05f, 6.48309287e-05f, -0.000506436452f, 0.00154916011f, -0.00357577694f, 0.00704763131f,
+    -0.012471566f, 0.0203703437f, -0.031293314f, 0.0459465869f, -0.0656527653f, 0.093901068f, -0.14309524f, 0.292333513f,
+    0.878500998f, -0.109410495f, 0.0332413837f, -0.00537198735f, -0.00705700694f, 0.0121057741f, -0.0130833341f, 0.011830816f,
+    -0.00953880232f, 0.00699607423f, -0.00468675094f, 0.00285304035f, -0.00155644096f, 0.000741003081f, -0.000292270037f, 8.42939335e-05f,
+    1.98056659e-05f, -5.35690742e-05f, 5.70762568e-05f, 7.174044e-05f, -0.000518968911f, 0.00156930264f, -0.00360475876f, 0.00708479667f,
+    -0.0125128618f, 0.0204063728f, -0.0313067101f, 0.0459077097f, -0.0655104667f, 0.0935557559f, -0.142286569f, 0.289641798f,
+    0.879776418f, -0.108067065f, 0.0324161611f, -0.00481484085f, -0.00744070206f, 0.0123662027f, -0.0132540287f, 0.0119371377f,
+    -0.00960070547f, 0.00702905422f, -0.0047023003f, 0.00285911793f, -0.00155807997f, 0.000741021126f, -0.000291984063f, 8.41410292e-05f,
+    1.94754612e-05f, -5.23063973e-05f, 5.38015411e-05f, 7.86239907e-05f, -0.000531441881f, 0.0015893227f, -0.00363351009f, 0.00712156203f,
+    -0.0125535084f, 0.0204414111f, -0.0313186608f, 0.0458668135f, -0.0653654337f, 0.0932069048f, -0.141473696f, 0.286952734f,
+    0.881039262f, -0.106713466f, 0.0315875113f, -0.00425642682f, -0.0078247115f, 0.0126264999f, -0.0134244077f, 0.0120430999f,
+    -0.00966228638f, 0.00706177903f, -0.00471766712f, 0.00286507723f, -0.00155964959f, 0.000741003023f, -0.000291681936f, 8.39823333e-05f,
+    1.91467298e-05f, -5.10474674e-05f, 5.05370845e-05f, 8.54813188e-05f, -0.000543854781f, 0.00160921924f, -0.00366202975f, 0.00715792505f,
+    -0.0125935031f, 0.0204754528f, -0.0313291624f, 0.0458238982f, -0.0652176887f, 0.0928545371f, -0.140656695f, 0.284266323f,
+    0.882289529f, -0.105349675f, 0.0307554565f, -0.00369676622f, -0.00820901897f, 0.0128866527f, -0.0135944607f, 0.0121486997f,
+    -0.00972353853f, 0.00709424447f, -0.00473285001f, 0.00287091709f, -0.00156114949f, 0.000740948773f, -0.000291363569f, 8.38178166e-05f,
+    1.88194863e-05f, -4.97923465e-05f, 4.72830288e-05f, 9.23121843e-05f, -0.00055620732f, 0.00162899168f, -0.00369031704f, 0.00719388714f,
+    -0.0126328478f, 0.0205085035f, -0.0313382149f, 0.0457789674f, -0.0650672391f, 0.0924986601f, -0.139835581f, 0.281582713f,
+    0.88352716f, -0.103975728f, 0.0299200267f, -0.00313588372f, -0.00859360769f, 0.0131466482f, -0.0137641812f, 0.0122539308f,
+    -0.00978446193f, 0.00712645054f, -0.00474784756f, 0.0028766375f, -0.00156257953f, 0.000740858144f, -0.000291028991f, 8.36474719e-05f,
+    1.84937489e-05f, -4.85410892e-05f, 4.40394979e-05f, 9.91163324e-05f, -0.00056849909f, 0.00164863968f, -0.00371837174f, 0.00722944597f,
+    -0.0126715424f, 0.0205405578f, -0.0313458331f, 0.04573204f, -0.0649141073f, 0.092139326f, -0.139010414f, 0.278901905f,
+    0.884752214f, -0.102591641f, 0.0290812533f, -0.00257380144f, -0.00897845998f, 0.0134064788f, -0.0139335608f, 0.0123587884f,
+    -0.00984505191f, 0.00715839444f, -0.00476265932f, 0.00288223801f, -0.00156393962f, 0.000740731193f, -0.000290678086f, 8.34712628e-05f,
+    1.8169525e-05f, -4.7293739e-05f, 4.08066153e-05f, 0.000105893509f, -0.000580729567f, 0.00166816229f, -0.0037461922f, 0.0072646006f,
+    -0.0127095841f, 0.0205716193f, -0.0313520096f, 0.0456831083f, -0.0647583008f, 0.0917765349f, -0.138181269f, 0.276224017f,
+    0.885964513f, -0.101197422f, 0.0282391589f, -0.0020105422f, -0.00936355907f, 0.0136661278f, -0.0141025893f, 0.012463266f,
+    -0.00990530383f, 0.00719007384f, -0.00477728341f, 0.00288771768f, -0.00156522891f, 0.000740567571f, -0.000290310796f, 8.32891747e-05f,
+    1.7846829e-05f, -4.60503543e-05f, 3.75845084e-05f, 0.00011264348f, -0.000592898461f, 0.00168755918f, -0.00377377821f, 0.00729935104f,
+    -0.0127469748f, 0.020601688f, -0.0313567445f, 0.0456321798f, -0.0645998195f, 0.0914103165f, -0.137348145f, 0.27354905f,
+    0.887164116f, -0.0997930765f, 0.0273937769f, -0.00144612917f, -0.0097488882f, 0.013925584f, -0.0142712602f, 0.0125673581f,
+    -0.00996521581f, 0.00722148735f, -0.00479171891f, 0.00289307558f, -0.00156644778f, 0.000740367337f, -0.00028992712f, 8.31011857e-05f,
+    1.75256791e-05f, -4.48109786e-05f, 3.43732936e-05f, 0.000119365985f, -0.000605005189f, 0.00170682953f, -0.00380112859f, 0.00733369589f,
+    -0.0127837108f, 0.0206307638f, -0.0313600488f, 0.0455792584f, -0.0644386783f, 0.0910407007f, -0.136511102f, 0.270877063f,
+    0.888350964f, -0.0983786285f, 0.0265451353f, -0.000880585343f, -0.0101344297f, 0.0141848363f, -0.0144395642f, 0.0126710599f,
+    -0.0100247851f, 0.00725263264f, -0.00480596488f, 0.00289831171f, -0.00156759552f, 0.000740130257f, -0.000289526943f, 8.29072669e-05f,
+    1.72060827e-05f, -4.35756665e-05f, 3.11731055e-05f, 0.000126060797f, -0.00061704946f, 0.00172597275f, -0.00382824335f, 0.00736763515f,
+    -0.0128197949f, 0.0206588488f, -0.0313619152f, 0.0455243587f, -0.0642749146f, 0.0906677023f, -0.135670215f, 0.268208206f,
+    0.889525056f, -0.0969540924f, 0.0256932639f, -0.000313934026f, -0.0105201686f, 0.0144438725f, -0.0146074947f, 0.012774366f,
+    -0.010084006f, 0.00728350785f, -0.0048200204f, 0.00290342537f, -0.00156867225f, 0.000739856332f, -0.000289110321f, 8.27074109e-05f,
+    1.68880561e-05f, -4.2344469e-05f, 2.79840569e-05f, 0.000132727684f, -0.000629030867f, 0.00174498826f, -0.00385512062f, 0.00740116742f,
+    -0.0128552243f, 0.0206859391f, -0.031362351f, 0.0454674773f, -0.0641085058f, 0.0902913436f, -0.134825513f, 0.265542448f,
+    0.890686333f, -0.0955194831f, 0.0248381924f, 0.000253801642f, -0.0109060854f, 0.0147026805f, -0.0147750406f, 0.0128772715f,
+    -0.0101428777f, 0.00731411064f, -0.00483388407f, 0.00290841609f, -0.00156967738f, 0.000739545329f, -0.000288677111f, 8.25015741e-05f,
+    1.65716119e-05f, -4.1117426e-05f, 2.48062715e-05f, 0.00013936637f, -0.000640949002f, 0.00176387548f, -0.00388176041f, 0.0074342913f,
+    -0.012889999f, 0.0207120385f, -0.0313613527f, 0.0454086252f, -0.0639394745f, 0.0899116546f, -0.133977026f, 0.262879908f,
+    0.891834736f, -0.0940748006f, 0.0239799451f, 0.000822598173f, -0.0112921633f, 0.0149612464f, -0.0149421953f, 0.0129797682f,
+    -0.0102013946f, 0.00734443963f, -0.00484755449f, 0.00291328295f, -0.00157061056f, 0.000739197189f, -0.000288227253f, 8.22897564e-05f,
+    1.62567612e-05f, -3.98945922e-05f, 2.16398657e-05f, 0.000145976635f, -0.000652803457f, 0.00178263395f, -0.00390816154f, 0.00746700726f,
+    -0.0129241189f, 0.0207371488f, -0.0313589349f, 0.0453478061f, -0.0637678429f, 0.0895286575f, -0.133124799f, 0.260220647f,
+    0.892970204f, -0.0926200747f, 0.0231185574f, 0.00139243214f, -0.0116783855f, 0.0152195599f, -0.0151089495f, 0.0130818533f,
+    -0.0102595529f, 0.00737449201f, -0.00486103119f, 0.00291802594f, -0.0015714718f, 0.000738811796f, -0.000287760777f, 8.20719215e-05f,
+    1.59435185e-05f, -3.86760221e-05f, 1.84849632e-05f, 0.000152558277f, -0.000664593768f, 0.00180126296f, -0.00393432425f, 0.00749931438f,
+    -0.0129575841f, 0.0207612682f, -0.0313550942f, 0.0452850275f, -0.0635936186f, 0.0891423672f, -0.132268906f, 0.257564664f,
+    0.894092858f, -0.0911553279f, 0.022254061f, 0.00196327991f, -0.0120647345f, 0.015477608f, -0.0152752968f, 0.0131835211f,
+    -0.0103173517f, 0.00740426593f, -0.00487431372f, 0.00292264391f, -0.00157226087f, 0.000738389092f, -0.000287277624f, 8.18480621e-05f,
+    1.56318929e-05f, -3.74617521e-05f, 1.53416768e-05f, 0.000159111019f, -0.000676319702f, 0.00181976194f, -0.00396024669f, 0.00753121171f,
+    -0.0129903946f, 0.0207843967f, -0.0313498229f, 0.0452202931f, -0.0634168088f, 0.0887528285f, -0.131409392f, 0.254912078f,
+    0.895202518f, -0.0896805674f, 0.0213864818f, 0.00253511826f, -0.0124511942f, 0.0157353804f, -0.0154412277f, 0.0132847661f,
+    -0.0103747873f, 0.00743376045f, -0.00488739926f, 0.00292713684f, -0.00157297752f, 0.000737928902f, -0.000286777708f, 8.16181564e-05f,
+    1.53218989e-05f, -3.62518331e-05f, 1.22101246e-05f, 0.000165634672f, -0.000687980733f, 0.00183813041f, -0.00398592884f, 0.00756269833f,
+    -0.0130225485f, 0.0208065361f, -0.0313431397f, 0.0451536104f, -0.0632374287f, 0.0883600488f, -0.130546287f, 0.25226292f,
+    0.896299243f, -0.0881958008f, 0.0205158498f, 0.00310792308f, -0.0128377462f, 0.0159928612f, -0.015606734f, 0.0133855809f,
+    -0.0104318541f, 0.00746297278f, -0.00490028784f, 0.00293150428f, -0.0015736213f, 0.000737431168f, -0.000286260998f, 8.1382168e-05f,
+    1.50135475e-05f, -3.50463124e-05f, 9.09042228e-06f, 0.000172128988f, -0.000699576631f, 0.0018563678f, -0.00401136978f, 0.00759377377f,
+    -0.0130540468f, 0.0208276883f, -0.0313350409f, 0.0450849868f, -0.0630555004f, 0.087964043f, -0.12967965f, 0.249617279f,
+    0.897382975f, -0.0867010579f, 0.0196421985f, 0.00368167041f, -0.0132243726f, 0.0162500422f, -0.0157718062f, 0.0134859625f,
+    -0.0104885511f, 0.00749190059f, -0.00491297804f, 0.00293574505f, -0.00157419196f, 0.000736895716f, -0.000285727496f, 8.11400969e-05f,
+    1.47068486e-05f, -3.38452373e-05f, 5.98268298e-06f, 0.000178593749f, -0.000711106812f, 0.00187447353f, -0.00403656857f, 0.00762443803f,
+    -0.0130848894f, 0.0208478514f, -0.0313255228f, 0.0450144298f, -0.0628710166f, 0.0875648558f, -0.128809497f, 0.246975198f,
+    0.898453653f, -0.085196346f, 0.0187655594f, 0.00425633695f, -0.0136110578f, 0.0165069066f, -0.015936438f, 0.0135859046f,
+    -0.0105448728f, 0.00752054295f, -0.00492546987f, 0.00293985894f, -0.00157468952f, 0.000736322487f, -0.000285177084f, 8.0891914e-05f,
+    1.44018159e-05f, -3.26486515e-05f, 2.88702154e-06f, 0.000185028723f, -0.000722571043f, 0.00189244724f, -0.00406152522f, 0.00765468925f,
+    -0.0131150745f, 0.0208670292f, -0.0313145965f, 0.0449419394f, -0.062684007f, 0.0871625096f, -0.127935916f, 0.244336739f,
+    0.899511278f, -0.0836816952f, 0.0178859606f, 0.00483189756f, -0.0139977839f, 0.0167634469f, -0.0161006209f, 0.0136854015f,
+    -0.0106008183f, 0.00754889753f, -0.00493776007f, 0.0029438457f, -0.00157511362f, 0.000735711423f, -0.000284609792f, 8.06376047e-05f,
+    1.40984594e-05f, -3.14565987e-05f, -1.96451069e-07f, 0.00019143369f, -0.000733968918f, 0.001910288f, -0.0040862388f, 0.0076845279f,
+    -0.0131446039f, 0.0208852198f, -0.0313022658f, 0.0448675305f, -0.0624944828f, 0.0867570043f, -0.127058923f, 0.241701961f,
+    0.900555789f, -0.0821571127f, 0.0170034338f, 0.00540832942f, -0.0143845314f, 0.0170196481f, -0.0162643436f, 0.0137844495f,
+    -0.010656382f, 0.00757696154f, -0.00494984956f, 0.0029477044f, -0.00157546392f, 0.000735062349f, -0.000284025533f, 8.037714e-05f,
+    1.37967909e-05f, -3.02691296e-05f, -3.26762347e-06f, 0.000197808447f, -0.000745300204f, 0.00192799582f, -0.00411070837f, 0.00771395303f,
+    -0.0131734749f, 0.0209024251f, -0.0312885232f, 0.044791203f, -0.0623024479f, 0.0863483995f, -0.126178578f, 0.239070937f,
+    0.901587248f, -0.0806226209f, 0.0161180124f, 0.00598560786f, -0.0147712855f, 0.0172754992f, -0.0164276026f, 0.0138830403f,
+    -0.0107115619f, 0.00760473497f, -0.00496173697f, 0.00295143505f, -0.00157574029f, 0.000734375266f, -0.000283424277f, 8.01105125e-05f,
+    1.34968213e-05f, -2.90862827e-05f, -6.32638603e-06f, 0.000204152748f, -0.000756564317f, 0.00194556976f, -0.00413493393f, 0.0077429642f,
+    -0.0132016903f, 0.0209186468f, -0.0312733836f, 0.0447129644f, -0.0621079206f, 0.0859366879f, -0.125294954f, 0.236443698f,
+    0.902605534f, -0.0790782347f, 0.0152297262f, 0.00656370912f, -0.0151580274f, 0.017530987f, -0.0165903848f, 0.0139811719f,
+    -0.0107663553f, 0.00763221411f, -0.00497342041f, 0.00295503624f, -0.0015759425f, 0.000733649998f, -0.000282805995f, 7.98377077e-05f,
+    1.31985589e-05f, -2.79081032e-05f, -9.37262848e-06f, 0.000210466402f, -0.000767761085f, 0.00196300936f, -0.00415891455f, 0.00777156139f,
+    -0.013229249f, 0.0209338851f, -0.0312568434f, 0.044632826f, -0.0619109124f, 0.0855219141f, -0.124408044f, 0.233820334f,
+    0.903610587f, -0.077523984f, 0.014338607f, 0.00714260805f, -0.0155447396f, 0.0177860986f, -0.0167526864f, 0.0140788369f,
+    -0.0108207576f, 0.00765939802f, -0.00498490036f, 0.00295850844f, -0.00157607021f, 0.00073288643f, -0.000282170629f, 7.95586893e-05f,
+    1.29020173e-05f, -2.67346368e-05f, -1.24062444e-05f, 0.000216749206f, -0.00077889004f, 0.0019803145f, -0.00418264931f, 0.00779974321f,
+    -0.0132561503f, 0.0209481418f, -0.0312389079f, 0.0445507951f, -0.0617114417f, 0.085104093f, -0.123517931f, 0.231200889f,
+    0.904602528f, -0.0759598762f, 0.0134446882f, 0.00772228092f, -0.015931407f, 0.0180408247f, -0.0169144981f, 0.0141760306f,
+    -0.0108747669f, 0.00768628484f, -0.00499617448f, 0.00296185073f, -0.00157612353f, 0.000732084503f, -0.000281518151f, 7.92734572e-05f,
+    1.26072036e-05f, -2.55659234e-05f, -1.54271274e-05f, 0.000223000927f, -0.000789950893f, 0.00199748459f, -0.0042061382f, 0.00782750919f,
+    -0.0132823931f, 0.0209614132f, -0.0312195774f, 0.044466868f, -0.0615095124f, 0.0846832544f, -0.122624636f, 0.228585422f,
+    0.905581176f, -0.0743859261f, 0.0125480006f, 0.00830270257f, -0.0163180046f, 0.0182951503f, -0.0170758087f, 0.0142727457f,
+    -0.0109283766f, 0.00771287177f, -0.00500724185f, 0.00296506262f, -0.00157610176f, 0.000731244101f, -0.00028084853f, 7.89819824e-05f,
+    1.23141308e-05f, -2.44020048e-05f, -1.84351684e-05f, 0.000229221376f, -0.000800943293f, 0.00201451848f, -0.00422938028f, 0.00785485934f,
+    -0.0133079803f, 0.0209737085f, -0.0311988592f, 0.0443810634f, -0.0613051467f, 0.0842594206f, -0.121728234f, 0.225974008f,
+    0.906546593f, -0.0728021562f, 0.0116485767f, 0.00888384879f, -0.0167045239f, 0.0185490642f, -0.0172366127f, 0.0143689811f,
+    -0.0109815877f, 0.00773915788f, -0.00501810154f, 0.00296814367f, -0.0015760049f, 0.000730365224f, -0.000280161708f, 7.86842502e-05f,
+    1.20228078e-05f, -2.32429265e-05f, -2.14302672e-05f, 0.000235410349f, -0.000811866892f, 0.0020314164f, -0.00425237557f, 0.00788179319f,
+    -0.0133329108f, 0.020985024f, -0.0311767533f, 0.0442933813f, -0.0610983558f, 0.0838326141f, -0.120828763f, 0.223366693f,
+    0.907498717f, -0.0712086111f, 0.0107464502f, 0.00946569536f, -0.0170909427f, 0.0188025534f, -0.0173968989f, 0.0144647276f,
+    -0.0110343965f, 0.00776514132f, -0.00502875354f, 0.00297109317f, -0.00157583295f, 0.000729447696f, -0.000279457687f, 7.83802461e-05f,
+    1.17332429e-05f, -2.20887268e-05f, -2.44123166e-05f, 0.000241567628f, -0.000822721398f, 0.00204817788f, -0.00427512266f, 0.00790831074f,
+    -0.013357183f, 0.0209953617f, -0.0311532654f, 0.0442038327f, -0.0608891472f, 0.0834028721f, -0.119926251f, 0.220763534f,
+    0.90843755f, -0.069605276f, 0.00984165259f, 0.0100482181f, -0.0174772441f, 0.0190556068f, -0.0175566655f, 0.0145599823f,
+    -0.0110867964f, 0.00779081974f, -0.00503919646f, 0.00297391112f, -0.00157558545f, 0.000728491403f, -0.000278736406f, 7.80699556e-05f,
+    1.14454479e-05f, -2.09394493e-05f, -2.73812184e-05f, 0.000247693009f, -0.000833506405f, 0.00206480222f, -0.00429762201f, 0.00793441013f,
+    -0.0133807994f, 0.0210047215f, -0.0311283953f, 0.0441124253f, -0.060677547f, 0.082970202f, -0.119020782f, 0.218164593f,
+    0.909363031f, -0.0679921955f, 0.00893421657f, 0.0106313899f, -0.0178634115f, 0.0193082113f, -0.0177158974f, 0.0146547398f,
+    -0.0111387875f, 0.00781619176f, -0.00504942797f, 0.00297659682f, -0.00157526217f, 0.000727496459f, -0.000277997839f, 7.77533569e-05f,
+    1.11594309e-05f, -1.97951322e-05f, -3.03368652e-05f, 0.000253786304f, -0.000844221679f, 0.00208128919f, -0.00431987271f, 0.00796009321f,
+    -0.0134037593f, 0.0210131072f, -0.0311021507f, 0.0440191589f, -0.0604635589f, 0.0825346336f, -0.118112355f, 0.215569928f,
+    0.910275221f, -0.0663693771f, 0.00802417658f, 0.0112151876f, -0.0182494242f, 0.0195603557f, -0.0178745911f, 0.0147489933f,
+    -0.011190366f, 0.00784125552f, -0.005059449f, 0.00297914958f, -0.00157486298f, 0.000726462516f, -0.000277241983f, 7.74304499e-05f,
+    1.08752001e-05f, -1.86558154e-05f, -3.32791606e-05f, 0.000259847351f, -0.000854866928f, 0.00209763786f, -0.00434187381f, 0.0079853572f,
+    -0.0134260617f, 0.0210205186f, -0.0310745351f, 0.0439240523f, -0.0602472015f, 0.0820962042f, -0.117201068f, 0.2129796f,
+    0.91117394f, -0.064736858f, 0.00711156521f, 0.0117995879f, -0.0186352674f, 0.0198120289f, -0.0180327352f, 0.0148427384f,
+    -0.0112415282f, 0.00786600914f, -0.00506925816f, 0.00298156962f, -0.00157438777f, 0.000725389691f, -0.000276468723f, 7.71011983e-05f,
+    1.05927638e-05f, -1.75215391e-05f, -3.62080063e-05f, 0.000265875889f, -0.000865441631f, 0.00211384823f, -0.00436362484f, 0.00801020302f,
+    -0.0134477066f, 0.0210269578f, -0.0310455468f, 0.0438271016f, -0.0600284785f, 0.0816549286f, -0.116286919f, 0.210393652f,
+    0.912059307f, -0.0630946383f, 0.00619641505f, 0.0123845618f, -0.0190209206f, 0.020063214f, -0.0181903224f, 0.0149359703f,
+    -0.0112922695f, 0.00789045077f, -0.00507885311f, 0.00298385532f, -0.00157383608f, 0.00072427775f, -0.000275678089f, 7.67655947e-05f,
+    1.03121347e-05f, -1.63923414e-05f, -3.91233007e-05f, 0.000271871773f, -0.000875945669f, 0.00212991959f, -0.00438512582f, 0.00803463161f,
+    -0.0134686967f, 0.0210324246f, -0.031015195f, 0.0437283218f, -0.0598074161f, 0.0812108293f, -0.115369983f, 0.207812175f,
+    0.912931204f, -0.0614427589f, 0.0052787615f, 0.012970088f, -0.019406369f, 0.0203139018f, -0.0183473453f, 0.0150286835f,
+    -0.0113425897f, 0.00791457761f, -0.00508823479f, 0.00298600714f, -0.00157320802f, 0.000723126694f, -0.000274870021f, 7.64236174e-05f,
+    1.00333173e-05f, -1.52682624e-05f, -4.20249489e-05f, 0.000277834828f, -0.000886378693f, 0.0021458522f, -0.00440637674f, 0.00805864017f,
+    -0.0134890312f, 0.0210369211f, -0.0309834797f, 0.0436277203f, -0.0595840216f, 0.0807639435f, -0.114450306f, 0.205235183f,
+    0.91378963f, -0.059781231f, 0.00435863715f, 0.0135561386f, -0.0197915938f, 0.0205640811f, -0.0185037963f, 0.0151208732f,
+    -0.0113924844f, 0.0079383906f, -0.00509740133f, 0.00298802438f, -0.00157250324f, 0.000721936463f, -0.00027404452f, 7.60752737e-05f,
+    9.75632247e-06f, -1.4149341e-05f, -4.49128529e-05f, 0.000283764792f, -0.000896740356f, 0.00216164486f, -0.0044273762f, 0.00808223058f,
+    -0.0135087091f, 0.0210404508f, -0.0309504084f, 0.0435252972f, -0.0593583174f, 0.0803142861f, -0.113527924f, 0.202662766f,
+    0.914634645f, -0.0581100844f, 0.00343607645f, 0.0141426902f, -0.0201765765f, 0.0208137371f, -0.0186596662f, 0.0152125331f,
+    -0.0114419488f, 0.00796188507f, -0.0051063518f, 0.00298990682f, -0.00157172163f, 0.000720707001f, -0.000273201556f, 7.57205198e-05f,
+    9.48115576e-06f, -1.3035612e-05f, -4.77869216e-05f, 0.000289661548f, -0.000907030364f, 0.0021772976f, -0.00444812421f, 0.00810540002f,
+    -0.0135277314f, 0.0210430119f, -0.0309159793f, 0.0434210673f, -0.0591303073f, 0.0798618793f, -0.112602882f, 0.200094968f,
+    0.91546613f, -0.0564293377f, 0.00251111365f, 0.0147297159f, -0.0205613002f, 0.0210628584f, -0.0188149475f, 0.0153036583f,
+    -0.011490982f, 0.00798506103f, -0.00511508482f, 0.00299165351f, -0.00157086295f, 0.000719438132f, -0.000272341043f, 7.53593704e-05f,
+    9.20782804e-06f, -1.19271144e-05f, -5.06470569e-05f, 0.000295524893f, -0.000917248544f, 0.00219280971f, -0.00446862075f, 0.0081281513f,
+    -0.0135460999f, 0.0210446082f, -0.0308802016f, 0.0433150381f, -0.0589000136f, 0.0794067681f, -0.111675255f, 0.197531864f,
+    0.916284025f, -0.054739017f, 0.00158378272f, 0.0153171932f, -0.0209457465f, 0.0213114358f, -0.0189696308f, 0.0153942453f,
+    -0.0115395812f, 0.00800791662f, -0.00512360083f, 0.0029932647f, -0.00156992686f, 0.000718129915f, -0.000271463068f, 7.4991789e-05f,
+    8.93634478e-06f, -1.08238828e-05f, -5.34931678e-05f, 0.000301354652f, -0.000927394431f, 0.00220818096f, -0.00448886398f, 0.00815048162f,
+    -0.0135638127f, 0.0210452396f, -0.0308430754f, 0.0432072133f, -0.0586674437f, 0.0789489523f, -0.11074505f, 0.194973484f,
+    0.917088449f, -0.053039141f, 0.000654118485f, 0.0159050934f, -0.0213298965f, 0.0215594508f, -0.0191237088f, 0.0154842865f,
+    -0.0115877409f, 0.00803044904f, -0.00513189798f, 0.00299473922f, -0.00156891334f, 0.000716782175f, -0.000270567485f, 7.46177684e-05f,
+    8.66671508e-06f, -9.72595535e-06f, -5.6325167e-05f, 0.000307150651f, -0.000937467848f, 0.00222341088f, -0.00450885529f, 0.00817239285f,
+    -0.0135808708f, 0.02104491f, -0.0308046099f, 0.0430976078f, -0.05843262f, 0.0784884766f, -0.109812334f, 0.192419887f,
+    0.917879283f, -0.0513297468f, -0.000277844229f, 0.0164933912f, -0.0217137337f, 0.0218068995f, -0.019277174f, 0.0155737791f,
+    -0.01163546f, 0.00805265736f, -0.00513997581f, 0.00299607753f, -0.00156782242f, 0.000715394912f, -0.000269654323f, 7.42373013e-05f,
+    8.39894528e-06f, -8.63336663e-06f, -5.91429525e-05f, 0.000312912685f, -0.00094746839f, 0.00223849947f, -0.00452859327f, 0.00819388218f,
+    -0.0135972761f, 0.0210436191f, -0.0307648014f, 0.0429862216f, -0.0581955425f, 0.0780253559f, -0.10887716f, 0.189871147f,
+    0.918656528f, -0.049610842f, -0.0012120707f, 0.0170820635f, -0.0220972393f, 0.0220537633f, -0.019430019f, 0.0156627167f,
+    -0.0116827358f, 0.00807453971f, -0.00514783291f, 0.00299727824f, -0.00156665361f, 0.000713968009f, -0.000268723554f, 7.38503732e-05f,
+    8.1330445e-06f, -7.54615257e-06f, -6.19464408e-05f, 0.00031864061f, -0.00095739594f, 0.0022534458f, -0.00454807747f, 0.00821495336f,
+    -0.0136130266f, 0.0210413709f, -0.0307236593f, 0.0428730659f, -0.0579562411f, 0.0775596276f, -0.107939556f, 0.18732731f,
+    0.919420123f, -0.0478824601f, -0.00214852556f, 0.017671084f, -0.0224803966f, 0.0223000292f, -0.0195822325f, 0.0157510936f,
+    -0.0117295627f, 0.00809609424f, -0.00515546836f, 0.00299834181f, -0.0015654068f, 0.000712501409f, -0.000267775147f, 7.34569621e-05f,
+    7.86901728e-06f, -6.46434728e-06f, -6.47355555e-05f, 0.000324334251f, -0.000967250147f, 0.00226825033f, -0.00456730835f, 0.00823560264f,
+    -0.0136281261f, 0.0210381653f, -0.0306811873f, 0.0427581482f, -0.0577147305f, 0.0770913139f, -0.106999584f, 0.184788451f,
+    0.920170128f, -0.0461446308f, -0.00308717415f, 0.0182604268f, -0.0228631888f, 0.0225456897f, -0.0197338089f, 0.015838908f,
+    -0.0117759407f, 0.00811732002f, -0.00516288262f, 0.00299926708f, -0.00156408187f, 0.000710995111f, -0.000266809075f, 7.30570755e-05f,
+    7.6068718e-06f, -5.38798531e-06f, -6.7510191e-05f, 0.000329993403f, -0.000977030839f, 0.00228291168f, -0.00458628451f, 0.0082558319f,
+    -0.0136425719f, 0.0210340042f, -0.030637389f, 0.0426414832f, -0.0574710146f, 0.0766204298f, -0.106057286f, 0.182254598f,
+    0.920906425f, -0.044397369f, -0.00402798085f, 0.0188500639f, -0.0232455954f, 0.02279073f, -0.0198847409f, 0.0159261506f,
+    -0.011821866f, 0.00813821517f, -0.00517007336f, 0.00300005451f, -0.00156267884f, 0.000709448999f, -0.000265825336f, 7.26506842e-05f,
+    7.34661444e-06f, -4.31710032e-06f, -7.02702673e-05f, 0.00033561798f, -0.000986737548f, 0.0022974303f, -0.00460500689f, 0.0082756402f,
+    -0.0136563657f, 0.0210288893f, -0.0305922683f, 0.0425230637f, -0.0572251156f, 0.076147005f, -0.105112702f, 0.179725811f,
+    0.921629071f, -0.0426407084f, -0.0049709091f, 0.0194399729f, -0.0236275978f, 0.0230351407f, -0.0200350191f, 0.0160128195f,
+    -0.0118673341f, 0.00815877691f, -0.00517704012f, 0.00300070294f, -0.0015611971f, 0.000707863073f, -0.000264823902f, 7.22377808e-05f,
+    7.088252e-06f, -3.25172527e-06f, -7.30157044e-05f, 0.00034120772f, -0.000996370101f, 0.00231180526f, -0.00462347362f, 0.00829502661f,
+    -0.0136695076f, 0.0210228227f, -0.030545827f, 0.0424029119f, -0.0569770411f, 0.0756710768f, -0.104165882f, 0.177202165f,
+    0.922338009f, -0.0408746712f, -0.00591592444f, 0.020030126f, -0.0240091812f, 0.0232789032f, -0.0201846361f, 0.0160989072f,
+    -0.0119123431f, 0.00817900524f, -0.00518378196f, 0.00300121214f, -0.0015596369f, 0.000706237159f, -0.000263804715f, 7.18183583e-05f,
+    6.83179132e-06f, -2.1918936e-06f, -7.5746415e-05f, 0.000346762536f, -0.0010059285f, 0.00232603704f, -0.0046416861f, 0.00831399485f,
+    -0.0136820003f, 0.0210158098f, -0.0304980744f, 0.0422810316f, -0.056726817f, 0.0751926675f, -0.103216879f, 0.17468369f,
+    0.923033297f, -0.0390992872f, -0.00686299102f, 0.0206204988f, -0.024390325f, 0.0235220138f, -0.0203335863f, 0.0161844119f,
+    -0.011956891f, 0.00819889735f, -0.00519029936f, 0.00300158234f, -0.00155799801f, 0.000704571372f, -0.000262767804f, 7.13924092e-05f,
+    6.57723649e-06f, -1.13763667e-06f, -7.84623116e-05f, 0.000352282223f, -0.00101541204f, 0.00234012445f, -0.00465964293f, 0.00833254028f,
+    -0.0136938421f, 0.021007847f, -0.0304490104f, 0.0421574302f, -0.056474451f, 0.0747117922f, -0.102265738f, 0.172170445f,
+    0.923714817f, -0.0373145714f, -0.00781207113f, 0.0212110635f, -0.0247710105f, 0.023764452f, -0.0204818565f, 0.0162693262f,
+    -0.0120009733f, 0.0082184514f, -0.00519658905f, 0.00300181238f, -0.00155628007f, 0.000702865422f, -0.00026171311f, 7.09599044e-05f,
+    6.32459569e-06f, -8.8986873e-08f, -8.11633217e-05f, 0.000357766665f, -0.00102482084f, 0.00235406775f, -0.00467734411f, 0.00835066475f,
+    -0.0137050347f, 0.0209989399f, -0.0303986445f, 0.0420321226f, -0.0562199615f, 0.0742284879f, -0.101312503f, 0.169662505f,
+    0.924382567f, -0.0355205722f, -0.00876312982f, 0.0218017939f, -0.0251512248f, 0.0240062103f, -0.0206294432f, 0.0163536463f,
+    -0.0120445881f, 0.00823766738f, -0.00520265289f, 0.00300190202f, -0.0015544832f, 0.000701119541f, -0.000260640692f, 7.05208658e-05f,
+    6.07387301e-06f, 9.54024472e-07f, -8.38493506e-05f, 0.000363215659f, -0.00103415444f, 0.00236786623f, -0.00469478918f, 0.00836836826f,
+    -0.0137155782f, 0.0209890846f, -0.0303469747f, 0.0419051088f, -0.0559633598f, 0.0737427771f, -0.100357205f, 0.167159915f,
+    0.92503655f, -0.0337173007f, -0.00971612986f, 0.0223926641f, -0.0255309436f, 0.0242472775f, -0.0207763352f, 0.0164373647f,
+    -0.0120877307f, 0.0082565425f, -0.00520848762f, 0.00300185126f, -0.00155260717f, 0.000699333497f, -0.000259550405f, 7.00752571e-05f,
+    5.82507573e-06f, 1.99136662e-06f, -8.65203328e-05f, 0.000368629087f, -0.00104341272f, 0.00238151988f, -0.00471197814f, 0.00838565174f,
+    -0.0137254735f, 0.0209782943f, -0.0302940123f, 0.0417763963f, -0.0557046644f, 0.0732546896f, -0.0993999168f, 0.164662719f,
+    0.925676703f, -0.0319047868f, -0.0106710363f, 0.0229836497f, -0.0259101521f, 0.0244876388f, -0.0209225249f, 0.0165204816f,
+    -0.0121304002f, 0.00827507395f, -0.00521409418f, 0.00300165988f, -0.00155065174f, 0.000697507232f, -0.000258442364f, 6.96230709e-05f,
+    5.57820795e-06f, 3.02300919e-06f, -8.91761883e-05f, 0.000374006806f, -0.00105259544f, 0.00239502848f, -0.00472891098f, 0.00840251427f,
+    -0.0137347216f, 0.0209665615f, -0.0302397553f, 0.0416460037f, -0.0554438904f, 0.0727642551f, -0.0984406695f, 0.162170976f,
+    0.926303089f, -0.030083064f, -0.0116278119f, 0.0235747267f, -0.0262888353f, 0.0247272849f, -0.0210680086f, 0.0166029856f,
+    -0.0121725947f, 0.00829326268f, -0.00521947164f, 0.00300132693f, -0.00154861691f, 0.000695640862f, -0.000257316453f, 6.91643072e-05f,
+    5.33327511e-06f, 4.04892216e-06f, -9.18168298e-05f, 0.00037934861f, -0.00106170226f, 0.00240839133f, -0.00474558631f, 0.00841895584f,
+    -0.0137433233f, 0.0209538899f, -0.0301842131f, 0.041513931f, -0.0551810488f, 0.0722714812f, -0.0974795073f, 0.159684747f,
+    0.926915646f, -0.0282521546f, -0.0125864167f, 0.0241658632f, -0.0266669672f, 0.0249662008f, -0.0212127753f, 0.0166848786f,
+    -0.0122143077f, 0.00831110682f, -0.00522461766f, 0.00300085242f, -0.00154650246f, 0.000693734095f, -0.000256172701f, 6.86989661e-05f,
+    5.09028268e-06f, 5.06907645e-06f, -9.44421845e-05f, 0.000384654413f, -0.00107073307f, 0.00242160866f, -0.00476200553f, 0.00843497645f,
+    -0.0137512796f, 0.020940287f, -0.0301273875f, 0.0413801894f, -0.0549161658f, 0.0717764124f, -0.0965164974f, 0.157204077f,
+    0.927514374f, -0.026412094f, -0.013546817f, 0.0247570332f, -0.0270445365f, 0.0252043772f, -0.0213568173f, 0.0167661496f,
+    -0.0122555392f, 0.00832860358f, -0.00522953412f, 0.00300023612f, -0.00154430827f, 0.000691787107f, -0.000255011109f, 6.82270183e-05f,
+    4.84923521e-06f, 6.0834418e-06f, -9.70521869e-05f, 0.00038992404f, -0.00107968762f, 0.00243468001f, -0.0047781677f, 0.0084505761f,
+    -0.0137585895f, 0.020925751f, -0.030069286f, 0.04124479f, -0.0546492413f, 0.0712790713f, -0.0955516547f, 0.154729009f,
+    0.928099275f, -0.0245629046f, -0.0145089747f, 0.0253482144f, -0.0274215229f, 0.0254417975f, -0.0215001255f, 0.0168467984f,
+    -0.0122962855f, 0.00834575109f, -0.00523421774f, 0.00299947732f, -0.00154203433f, 0.000689799839f, -0.000253831648f, 6.77484641e-05f,
+    4.61013724e-06f, 7.09199185e-06f, -9.96467497e-05f, 0.000395157345f, -0.00108856568f, 0.0024476049f, -0.00479407236f, 0.00846575573f,
+    -0.0137652569f, 0.0209102817f, -0.0300099105f, 0.0411077403f, -0.0543803014f, 0.07077948f, -0.0945850462f, 0.152259633f,
+    0.928670228f, -0.0227046199f, -0.0154728526f, 0.025939377f, -0.0277979076f, 0.025678454f, -0.0216426942f, 0.0169268157f,
+    -0.0123365447f, 0.00836254936f, -0.00523866899f, 0.00299857627f, -0.00153968029f, 0.000687772059f, -0.000252634287f, 6.72633032e-05f,
+    4.37299377e-06f, 8.09469748e-06f, -0.000102225807f, 0.000400354242f, -0.00109736703f, 0.00246038358f, -0.00480971951f, 0.00848051533f,
+    -0.0137712816f, 0.0208938867f, -0.0299492683f, 0.0409690477f, -0.0541093573f, 0.070277676f, -0.0936167091f, 0.149795964f,
+    0.929227352f, -0.0208372679f, -0.0164384115f, 0.0265304986f, -0.0281736739f, 0.0259143338f, -0.0217845161f, 0.0170062035f,
+    -0.0123763122f, 0.00837899558f, -0.00524288695f, 0.00299753202f, -0.00153724628f, 0.000685703999f, -0.000251419056f, 6.6771514e-05f,
+    4.13780845e-06f, 9.09153096e-06f, -0.000104789287f, 0.000405514525f, -0.00110609154f, 0.00247301534f, -0.00482510962f, 0.0084948549f,
+    -0.0137766628f, 0.0208765659f, -0.0298873633f, 0.0408287272f, -0.0538364314f, 0.069773674f, -0.0926466957f, 0.147338077f,
+    0.929770529f, -0.0189608783f, -0.0174056161f, 0.0271215495f, -0.028548805f, 0.0261494238f, -0.0219255835f, 0.0170849506f,
+    -0.0124155879f, 0.00839508977f, -0.00524687162f, 0.00299634458f, -0.00153473206f, 0.000683595426f, -0.000250185898f, 6.62731109e-05f,
+    3.90458626e-06f, 1.00824664e-05f, -0.000107337124f, 0.000410638109f, -0.00111473887f, 0.00248550018f, -0.00484024175f, 0.00850877445f,
+    -0.0137814023f, 0.0208583232f, -0.0298241992f, 0.040686775f, -0.053561531f, 0.0692675114f, -0.0916750506f, 0.144886002f,
+    0.930299819f, -0.0170754828f, -0.0183744263f, 0.0277125034f, -0.0289232787f, 0.0263837129f, -0.0220658835f, 0.017163055f,
+    -0.0124543663f, 0.00841082912f, -0.00525062112f, 0.00299501373f, -0.00153213751f, 0.000681446458f, -0.000248934841f, 6.57680721e-05f,
+    3.67333041e-06f, 1.10674746e-05f, -0.000109869223f, 0.000415724789f, -0.0011233089f, 0.00249783765f, -0.0048551159f, 0.00852227397f,
+    -0.0137855019f, 0.0208391566f, -0.0297597814f, 0.0405432098f, -0.0532846786f, 0.068759203f, -0.0907018036f, 0.142439812f,
+    0.93081516f, -0.0151811102f, -0.0193448067f, 0.0283033308f, -0.029297078f, 0.0266171861f, -0.0222054143f, 0.0172405113f,
+    -0.0124926455f, 0.00842621271f, -0.00525413407f, 0.00299353898f, -0.00152946252f, 0.00067925686f, -0.000247665856f, 6.52563831e-05f,
+    3.44404543e-06f, 1.2046532e-05f, -0.000112385547f, 0.000420774508f, -0.00113180152f, 0.00251002773f, -0.00486973207f, 0.00853535347f,
+    -0.0137889627f, 0.0208190735f, -0.0296941176f, 0.0403980426f, -0.0530058891f, 0.0682487786f, -0.0897270292f, 0.139999554f,
+    0.931316555f, -0.0132777933f, -0.0203167144f, 0.0288940128f, -0.0296701901f, 0.026849838f, -0.0223441683f, 0.0173173137f,
+    -0.0125304237f, 0.0084412396f, -0.00525741233f, 0.00299191987f, -0.00152670697f, 0.000677026808f, -0.000246378942f, 6.47380657e-05f,
+    3.21673451e-06f, 1.30196122e-05f, -0.000114886017f, 0.000425787148f, -0.00114021637f, 0.00252206996f, -0.00488409027f, 0.00854801387f,
+    -0.0137917846f, 0.0207980741f, -0.0296272095f, 0.0402512811f, -0.0527251698f, 0.067736268f, -0.0887507573f, 0.13756527f,
+    0.931803942f, -0.0113655636f, -0.0212901179f, 0.029484516f, -0.0300425906f, 0.0270816498f, -0.0224821344f, 0.0173934624f,
+    -0.012567698f, 0.00845590606f, -0.00526045356f, 0.00299015664f, -0.00152387097f, 0.000674756127f, -0.000245074101f, 6.42130908e-05f,
+    2.99140106e-06f, 1.39866906e-05f, -0.000117370568f, 0.000430762535f, -0.00114855345f, 0.00253396458f, -0.00489819003f, 0.0085602561f,
+    -0.0137939705f, 0.0207761619f, -0.0295590647f, 0.0401029326f, -0.0524425507f, 0.0672217086f, -0.0877730325f, 0.135137022f,
+    0.932277381f, -0.00944445096f, -0.0222649742f, 0.0300748181f, -0.0304142646f, 0.027312614f, -0.022619307f, 0.0174689479f,
+    -0.0126044648f, 0.00847021397f, -0.00526325731f, 0.0029882486f, -0.00152095419f, 0.000672444934f, -0.000243751318f, 6.36814657e-05f,
+    2.76804826e-06f, 1.49477419e-05f, -0.000119839126f, 0.000435700553f, -0.0011568123f, 0.00254571112f, -0.00491203181f, 0.00857207831f,
+    -0.0137955183f, 0.0207533389f, -0.0294896848f, 0.0399530008f, -0.0521580353f, 0.0667051077f, -0.086793907f, 0.132714853f,
+    0.932736874f, -0.00751448842f, -0.0232412424f, 0.0306648873f, -0.0307851918f, 0.0275427178f, -0.0227556787f, 0.0175437666f,
+    -0.0126407221f, 0.00848415866f, -0.00526582263f, 0.0029861955f, -0.00151795649f, 0.000670093112f, -0.000242410591f, 6.31431758e-05f,
+    2.54667975e-06f, 1.59027422e-05f, -0.000122291633f, 0.000440601085f, -0.00116499304f, 0.00255730934f, -0.00492561515f, 0.00858348235f,
+    -0.0137964319f, 0.0207296088f, -0.0294190794f, 0.0398015082f, -0.0518716462f, 0.0661865026f, -0.085813418f, 0.130298823f,
+    0.933182359f, -0.00557570718f, -0.0242188908f, 0.0312547013f, -0.0311553571f, 0.027771946f, -0.0228912383f, 0.017617913f,
+    -0.0126764672f, 0.008497742f, -0.00526814908f, 0.00298399734f, -0.00151487801f, 0.000667700719f, -0.000241051923f, 6.25982284e-05f,
+    2.32729803e-06f, 1.68516672e-05f, -0.000124728031f, 0.000445464073f, -0.00117309543f, 0.00256875926f, -0.00493893959f, 0.00859446824f,
+    -0.0137967113f, 0.0207049716f, -0.029347254f, 0.0396484546f, -0.0515833981f, 0.0656659231f, -0.0848316252f, 0.127888978f,
+    0.933613777f, -0.00362814101f, -0.0251978748f, 0.0318442322f, -0.0315247439f, 0.0280002914f, -0.0230259858f, 0.0176913869f,
+    -0.0127116973f, 0.0085109612f, -0.00527023617f, 0.00298165367f, -0.00151171861f, 0.000665267638f, -0.000239675312f, 6.20466162e-05f,
+    2.10990584e-06f, 1.7794493e-05f, -0.000127148232f, 0.000450289284f, -0.00118111901f, 0.00258006062f, -0.00495200604f, 0.00860503688f,
+    -0.0137963584f, 0.020679431f, -0.0292742085f, 0.0394938476f, -0.0512933061f, 0.0651433915f, -0.0838485509f, 0.125485376f,
+    0.934031188f, -0.00167182169f, -0.0261781551f, 0.0324334502f, -0.0318933241f, 0.0282277409f, -0.0231599044f, 0.0177641753f,
+    -0.0127464095f, 0.00852381345f, -0.00527208298f, 0.00297916401f, -0.00150847819f, 0.000662793871f, -0.000238280729f, 6.1488332e-05f,
+    1.894506e-06f, 1.87311998e-05f, -0.000129552209f, 0.000455076661f, -0.00118906389f, 0.00259121298f, -0.00496481359f, 0.00861518644f,
+    -0.013795373f, 0.0206529927f, -0.0291999523f, 0.0393377021f, -0.0510013886f, 0.0646189302f, -0.0828642622f, 0.123088039f,
+    0.934434593f, 0.000293216581f, -0.0271596946f, 0.0330223329f, -0.0322610885f, 0.0284542795f, -0.0232929923f, 0.0178362839f,
+    -0.0127806021f, 0.00853629969f, -0.00527368905f, 0.00297652837f, -0.0015051564f, 0.000660279416f, -0.000236868204f, 6.09233757e-05f,
+    1.68110103e-06f, 1.96617621e-05f, -0.000131939887f, 0.000459826115f, -0.00119693007f, 0.00260221679f, -0.00497736316f, 0.00862492062f,
+    -0.0137937581f, 0.0206256565f, -0.0291244909f, 0.0391800329f, -0.0507076606f, 0.064092584f, -0.0818787962f, 0.120697051f,
+    0.93482393f, 0.00226694113f, -0.028142456f, 0.0336108506f, -0.0326280259f, 0.028679898f, -0.0234252419f, 0.0179077014f,
+    -0.0128142731f, 0.00854841713f, -0.0052750539f, 0.00297374674f, -0.00150175358f, 0.000657724333f, -0.000235437721f, 6.03517401e-05f,
+    1.46969296e-06f, 2.05861579e-05f, -0.000134311209f, 0.00046453753f, -0.00120471709f, 0.00261307112f, -0.00498965383f, 0.00863423757f,
+    -0.0137915146f, 0.0205974262f, -0.02904783f, 0.0390208401f, -0.0504121445f, 0.0635643601f, -0.0808921978f, 0.118312441f,
+    0.935199201f, 0.00424931757f, -0.0291263945f, 0.0341989771f, -0.0329941027f, 0.028904587f, -0.0235566441f, 0.0179784242f,
+    -0.012847418f, 0.00856016483f, -0.00527617708f, 0.00297081843f, -0.0014982695f, 0.000655128504f, -0.000233989311f, 5.97734324e-05f,
+    1.26028385e-06f, 2.15043692e-05f, -0.000136666116f, 0.000469210761f, -0.00121242495f, 0.00262377644f, -0.00500168605f, 0.00864313729f,
+    -0.0137886424f, 0.0205683056f, -0.0289699715f, 0.0388601385f, -0.050114844f, 0.063034296f, -0.0799045116f, 0.115934275f,
+    0.935560405f, 0.00624031201f, -0.0301114749f, 0.0347866789f, -0.0333593115f, 0.0291283317f, -0.0236871932f, 0.0180484504f,
+    -0.0128800357f, 0.00857154187f, -0.00527705764f, 0.00296774344f, -0.00149470405f, 0.000652492046f, -0.000232522929f, 5.91884418e-05f,
+    1.05287575e-06f, 2.24163741e-05f, -0.000139004565f, 0.000473845721f, -0.00122005341f, 0.00263433252f, -0.00501345936f, 0.00865162164f,
+    -0.0137851434f, 0.0205382928f, -0.0288909245f, 0.0386979319f, -0.0498157851f, 0.062502414f, -0.0789157897f, 0.113562591f,
+    0.935907543f, 0.00823989045f, -0.0310976561f, 0.0353739411f, -0.0337236263f, 0.0293511171f, -0.0238168798f, 0.0181177724f,
+    -0.0129121235f, 0.00858254638f, -0.00527769513f, 0.00296452153f, -0.00149105722f, 0.000649814843f, -0.000231038619f, 5.85967719e-05f,
+    8.47470403e-07f, 2.3322149e-05f, -0.000141326469f, 0.000478442351f, -0.00122760236f, 0.00264473888f, -0.0050249747f, 0.00865969062f,
+    -0.0137810204f, 0.0205073971f, -0.0288106948f, 0.0385342427f, -0.0495149828f, 0.0619687438f, -0.0779260695f, 0.111197434f,
+    0.936240554f, 0.0102480175f, -0.0320849009f, 0.0359607339f, -0.0340870395f, 0.0295729395f, -0.0239457004f, 0.0181863885f,
+    -0.0129436785f, 0.00859317742f, -0.00527808908f, 0.00296115247f, -0.0014873289f, 0.000647096953f, -0.000229536367f, 5.79984226e-05f,
+    6.44069303e-07f, 2.42216774e-05f, -0.000143631813f, 0.000483000476f, -0.00123507169f, 0.00265499577f, -0.0050362316f, 0.00866734516f,
+    -0.0137762735f, 0.0204756204f, -0.0287292879f, 0.038369067f, -0.0492124557f, 0.0614333153f, -0.076935403f, 0.108838856f,
+    0.936559498f, 0.0122646587f, -0.0330731608f, 0.0365470238f, -0.0344495215f, 0.0297937803f, -0.0240736417f, 0.0182542913f,
+    -0.0129746972f, 0.00860343408f, -0.0052782381f, 0.00295763626f, -0.00148351921f, 0.000644338317f, -0.000228016172f, 5.73933867e-05f,
+    4.42673979e-07f, 2.51149377e-05f, -0.000145920509f, 0.000487520039f, -0.00124246127f, 0.00266510295f, -0.00504722958f, 0.00867458433f,
+    -0.0137709025f, 0.0204429608f, -0.0286467057f, 0.0382024236f, -0.048908215f, 0.0608961508f, -0.0759438202f, 0.106486909f,
+    0.936864376f, 0.0142897777f, -0.0340624005f, 0.0371327847f, -0.0348110609f, 0.030013632f, -0.0242006984f, 0.0183214787f,
+    -0.0130051803f, 0.00861331448f, -0.00527814263f, 0.00295397197f, -0.0014796278f, 0.000641538994f, -0.000226478063f, 5.67816678e-05f,
+    2.43285569e-07f, 2.60019115e-05f, -0.000148192514f, 0.000492000894f, -0.00124977087f, 0.00267506018f, -0.00505796913f, 0.00868140999f,
+    -0.0137649104f, 0.0204094257f, -0.0285629556f, 0.0380343162f, -0.0486022756f, 0.0603572801f, -0.0749513805f, 0.104141638f,
+    0.937155068f, 0.0163233392f, -0.0350525826f, 0.0377179906f, -0.0351716392f, 0.0302324779f, -0.0243268646f, 0.0183879472f,
+    -0.0130351214f, 0.00862281676f, -0.00527780131f, 0.00295016007f, -0.00147565478f, 0.000638698868f, -0.000224922012f, 5.6163266e-05f,
+    4.59052991e-08f, 2.68825825e-05f, -0.000150447799f, 0.00049644307f, -0.00125700061f, 0.00268486748f, -0.00506845117f, 0.00868782122f,
+    -0.0137583008f, 0.0203750152f, -0.0284780469f, 0.0378647596f, -0.0482946672f, 0.0598167293f, -0.0739581287f, 0.101803094f,
+    0.937431693f, 0.0183653086f, -0.0360436663f, 0.038302619f, -0.0355312414f, 0.0304503143f, -0.024452135f, 0.0184536893f,
+    -0.0130645214f, 0.00863194279f, -0.00527721504f, 0.00294620031f, -0.00147160026f, 0.000635818171f, -0.000223348063f, 5.55381885e-05f,
+    -1.49465976e-07f, 2.77569252e-05f, -0.000152686276f, 0.000500846305f, -0.00126414991f, 0.00269452482f, -0.00507867429f, 0.0086938208f,
+    -0.01375107f, 0.0203397367f, -0.0283919815f, 0.0376937613f, -0.0479853898f, 0.0592745282f, -0.072964102f, 0.0994713157f,
+    0.937694132f, 0.020415647f, -0.0370356031f, 0.0388866365f, -0.0358898416f, 0.0306671206f, -0.0245764963f, 0.0185187031f,
+    -0.0130933765f, 0.00864068605f, -0.0052763815f, 0.00294209225f, -0.00146746391f, 0.00063289667f, -0.0002217562f, 5.4906428e-05f,
+    -3.42827491e-07f, 2.86249324e-05f, -0.000154907932f, 0.000505210715f, -0.00127121911f, 0.002704032f, -0.00508863898f, 0.00869940687f,
+    -0.0137432246f, 0.0203035884f, -0.0283047669f, 0.0375213325f, -0.0476744696f, 0.0587306991f, -0.0719693452f, 0.0971463621f,
+    0.937942445f, 0.0224743206f, -0.0380283594f, 0.039470017f, -0.0362474285f, 0.0308828913f, -0.0246999487f, 0.0185829848f,
+    -0.013121685f, 0.00864905119f, -0.0052753007f, 0.00293783587f, -0.00146324595f, 0.00062993454f, -0.000220146452f, 5.42679845e-05f,
+    -5.34178639e-07f, 2.94865804e-05f, -0.000157112692f, 0.000509536068f, -0.00127820799f, 0.00271338923f, -0.00509834616f, 0.0087045813f,
+    -0.0137347635f, 0.0202665795f, -0.0282164086f, 0.0373474881f, -0.0473619215f, 0.0581852756f, -0.0709739104f, 0.0948282704f,
+    0.938176632f, 0.0245412905f, -0.0390218981f, 0.040052738f, -0.0366039798f, 0.0310976151f, -0.0248224791f, 0.0186465289f,
+    -0.0131494431f, 0.00865703262f, -0.0052739731f, 0.00293343118f, -0.00145894603f, 0.000626931724f, -0.000218518806f, 5.36228654e-05f,
+    -7.23519008e-07f, 3.03418528e-05f, -0.000159300529f, 0.00051382219f, -0.00128511642f, 0.00272259605f, -0.00510779535f, 0.00870934501f,
+    -0.0137256887f, 0.0202287082f, -0.0281269141f, 0.0371722281f, -0.0470477678f, 0.0576382875f, -0.0699778497f, 0.0925171003f,
+    0.938396692f, 0.026616523f, -0.0400161706f, 0.0406347662f, -0.0369594842f, 0.0313112773f, -0.0249440838f, 0.0187093299f,
+    -0.0131766507f, 0.00866463128f, -0.00527239777f, 0.00292887772f, -0.00145456451f, 0.00062388822f, -0.000216873319f, 5.29710778e-05f,
+    -9.108482e-07f, 3.11907352e-05f, -0.000161471398f, 0.000518069253f, -0.00129194406f, 0.00273165246f, -0.00511698658f, 0.00871369801f,
+    -0.013716002f, 0.0201899763f, -0.0280362871f, 0.0369955674f, -0.0467320196f, 0.0570897534f, -0.0689811781f, 0.0902128816f,
+    0.938602567f, 0.0286999736f, -0.0410111323f, 0.0412160791f, -0.0373139195f, 0.0315238684f, -0.0250647534f, 0.0187713858f,
+    -0.0132033033f, 0.00867184624f, -0.00527057331f, 0.00292417547f, -0.00145010115f, 0.000620804029f, -0.000215209962f, 5.23126109e-05f,
+    -1.09616633e-06f, 3.2033211e-05f, -0.000163625227f, 0.000522276969f, -0.00129869115f, 0.00274055894f, -0.00512592075f, 0.0087176403f,
+    -0.0137057044f, 0.0201503932f, -0.027944535f, 0.0368175209f, -0.046414692f, 0.0565397032f, -0.0679839626f, 0.0879156739f,
+    0.938794255f, 0.0307916105f, -0.0420067534f, 0.0417966433f, -0.037667267f, 0.0317353755f, -0.0251844823f, 0.0188326929f,
+    -0.0132293999f, 0.00867867563f, -0.00526850019f, 0.00291932421f, -0.00144555606f, 0.000617679267f, -0.000213528765f, 5.16474756e-05f,
+    -1.27947305e-06f, 3.28692659e-05f, -0.000165762001f, 0.000526445394f, -0.00130535744f, 0.00274931476f, -0.00513459742f, 0.00872117467f,
+    -0.0136947976f, 0.0201099571f, -0.0278516635f, 0.036638096f, -0.0460958071f, 0.0559881665f, -0.0669862479f, 0.0856255218f,
+    0.938971817f, 0.0328913927f, -0.0430029854f, 0.0423764363f, -0.0380195118f, 0.0319457911f, -0.0253032614f, 0.0188932456f,
+    -0.0132549386f, 0.00868511852f, -0.00526617793f, 0.00291432394f, -0.00144092902f, 0.000614513934f, -0.000211829727f, 5.09756792e-05f,
+    -1.460769e-06f, 3.36988815e-05f, -0.000167881677f, 0.000530574354f, -0.0013119427f, 0.00275791995f, -0.00514301611f, 0.00872429833f,
+    -0.0136832837f, 0.0200686734f, -0.0277576782f, 0.0364573039f, -0.04577538f, 0.0554351695f, -0.0659880713f, 0.0833424553f,
+    0.939135194f, 0.0349992886f, -0.0439997874f, 0.0429554321f, -0.0383706279f, 0.0321550965f, -0.0254210886f, 0.0189530384f,
+    -0.0132799158f, 0.00869117305f, -0.00526360562f, 0.00290917419f, -0.00143622013f, 0.000611307914f, -0.000210112892f, 5.02972143e-05f,
+    -1.64005417e-06f, 3.45220469e-05f, -0.000169984181f, 0.000534663792f, -0.00131844706f, 0.00276637473f, -0.00515117822f, 0.008727015f,
+    -0.0136711644f, 0.020026546f, -0.0276625846f, 0.0362751484f, -0.0454534255f, 0.054880742f, -0.0649894699f, 0.0810665339f,
+    0.939284384f, 0.0371152461f, -0.0449971184f, 0.0435335971f, -0.0387206078f, 0.0323632844f, -0.0255379491f, 0.0190120712f,
+    -0.0133043295f, 0.00869683921f, -0.00526078325f, 0.00290387496f, -0.00143142941f, 0.000608061324f, -0.00020837826f, 4.9612092e-05f,
+    -1.81732923e-06f, 3.53387441e-05f, -0.000172069529f, 0.000538713706f, -0.00132487051f, 0.0027746791f, -0.00515908329f, 0.00872932468f,
+    -0.0136584416f, 0.0199835785f, -0.027566392f, 0.036091648f, -0.045129966f, 0.05432491f, -0.063990511f, 0.0787978023f,
+    0.939419389f, 0.0392392389f, -0.0459949374f, 0.0441109128f, -0.0390694365f, 0.0325703509f, -0.0256538447f, 0.0190703366f,
+    -0.0133281806f, 0.00870211702f, -0.00525770988f, 0.00289842673f, -0.00142655685f, 0.000604774221f, -0.00020662586f, 4.8920323e-05f,
+    -1.99259489e-06f, 3.61489656e-05f, -0.000174137633f, 0.000542723923f, -0.00133121281f, 0.00278283306f, -0.00516673131f, 0.00873122737f,
+    -0.0136451162f, 0.0199397728f, -0.0274691042f, 0.0359068103f, -0.0448050126f, 0.0537676997f, -0.0629912168f, 0.0765362978f,
+    0.939540207f, 0.0413712189f, -0.0469932035f, 0.0446873382f, -0.0394170769f, 0.0327762701f, -0.0257687625f, 0.0191278327f,
+    -0.0133514628f, 0.00870700181f, -0.00525438506f, 0.00289282855f, -0.00142160244f, 0.000601446605f, -0.000204855693f, 4.82219039e-05f,
+    -2.16585181e-06f, 3.69526933e-05f, -0.000176188449f, 0.000546694384f, -0.00133747386f, 0.00279083615f, -0.00517412322f, 0.00873272493f,
+    -0.0136311902f, 0.0198951308f, -0.0273707267f, 0.0357206464f, -0.0444785878f, 0.0532091372f, -0.0619916357f, 0.0742820725f,
+    0.93964684f, 0.043511156f, -0.0479918681f, 0.0452628583f, -0.0397635289f, 0.0329810381f, -0.0258826949f, 0.0191845521f,
+    -0.0133741749f, 0.0087114973f, -0.00525080971f, 0.00288708066f, -0.0014165662f, 0.000598078477f, -0.000203067786f, 4.75168417e-05f,
+    -2.33710102e-06f, 3.774992e-05f, -0.000178221992f, 0.000550625206f, -0.00134365354f, 0.00279868906f, -0.00518125901f, 0.00873381644f,
+    -0.0136166662f, 0.0198496599f, -0.027271267f, 0.0355331674f, -0.0441507064f, 0.0526492558f, -0.0609918162f, 0.0720351785f,
+    0.939739287f, 0.0456590019f, -0.0489908978f, 0.0458374433f, -0.0401087739f, 0.0331846476f, -0.0259956401f, 0.0192404948f,
+    -0.0133963162f, 0.00871559791f, -0.00524698198f, 0.00288118282f, -0.001411448f, 0.000594669953f, -0.000201262184f, 4.68051439e-05f,
+    -2.50634389e-06f, 3.85406238e-05f, -0.000180238159f, 0.000554516097f, -0.00134975195f, 0.0028063911f, -0.00518813776f, 0.00873450283f,
+    -0.0136015434f, 0.019803362f, -0.0271707308f, 0.0353443809f, -0.043821387f, 0.0520880781f, -0.059991803f, 0.0697956309f,
+    0.939817488f, 0.0478147157f, -0.0499902442f, 0.0464110635f, -0.0404527858f, 0.0333870836f, -0.0261075888f, 0.0192956552f,
+    -0.0134178838f, 0.00871930551f, -0.00524290139f, 0.00287513528f, -0.00140624808f, 0.000591220916f, -0.000199438873f, 4.60868177e-05f,
+    -2.67358155e-06f, 3.9324801e-05f, -0.000182236996f, 0.000558367115f, -0.001355769f, 0.00281394296f, -0.00519476179f, 0.00873478781f,
+    -0.0135858264f, 0.0197562389f, -0.0270691253f, 0.0351543017f, -0.0434906408f, 0.0515256338f, -0.0589916334f, 0.067563504f,
+    0.939881563f, 0.0499782637f, -0.05098987f, 0.0469836891f, -0.0407955535f, 0.0335883312f, -0.0262185335f, 0.0193500314f,
+    -0.0134388758f, 0.00872261822f, -0.00523856841f, 0.00286893756f, -0.00140096631f, 0.000587731542f, -0.000197597896f, 4.53618704e-05f,
+    -2.83881513e-06f, 4.01024408e-05f, -0.000184218399f, 0.000562178204f, -0.00136170455f, 0.00282134418f, -0.00520112971f, 0.00873466767f,
+    -0.0135695161f, 0.0197082963f, -0.02696646f, 0.0349629372f, -0.0431584939f, 0.0509619489f, -0.0579913482f, 0.0653388277f,
+    0.939931393f, 0.0521495976f, -0.0519897267f, 0.0475552976f, -0.0411370546f, 0.033788383f, -0.0263284687f, 0.0194036141f,
+    -0.0134592894f, 0.00872553512f, -0.00523398258f, 0.00286258967f, -0.00139560283f, 0.000584201887f, -0.000195739281f, 4.46303093e-05f,
+    -3.00204647e-06f, 4.08735286e-05f, -0.000186182369f, 0.000565949187f, -0.00136755861f, 0.00282859476f, -0.00520724244f, 0.008734148f,
+    -0.0135526154f, 0.0196595397f, -0.0268627368f, 0.0347703062f, -0.0428249612f, 0.0503970534f, -0.0569910072f, 0.0631216466f,
+    0.939967036f, 0.0543286875f, -0.0529897809f, 0.0481258593f, -0.0414772779f, 0.0339872316f, -0.0264373869f, 0.0194564052f,
+    -0.0134791248f, 0.00872805621f, -0.00522914343f, 0.0028560916f, -0.00139015762f, 0.000580631837f, -0.000193863059f, 4.38921379e-05f,
+    -3.16327714e-06f, 4.16380535e-05f, -0.000188128848f, 0.000569680182f, -0.00137333095f, 0.00283569493f, -0.00521310046f, 0.00873322506f,
+    -0.0135351242f, 0.0196099691f, -0.0267579611f, 0.0345764086f, -0.0424900576f, 0.0498309694f, -0.0559906326f, 0.0609120056f,
+    0.939988494f, 0.0565154776f, -0.0539899766f, 0.0486953445f, -0.0418161973f, 0.0341848582f, -0.0265452806f, 0.0195083972f,
+    -0.0134983761f, 0.0087301787f, -0.00522405049f, 0.00284944335f, -0.00138463057f, 0.000577021565f, -0.000191969215f, 4.31473673e-05f,
+};
+
+// 44100 -> 22050 Hz: 1 phases of 32 taps
+alignas(16) const float kResampler44100[] = {
+    -2.14607462e-05f, 0.00038209153f, 0.000304677902f, -0.0016192965f, -0.00165116077f, 0.0044389856f, 0.00582000194f, -0.00927070342f,
+    -0.0159552954f, 0.0157819539f, 0.0378629789f, -0.0226672031f, -0.0882829279f, 0.0279889889f, 0.311905771f, 0.46996516f,
+    0.311905771f, 0.0279889889f, -0.0882829279f, -0.0226672031f, 0.0378629789f, 0.0157819539f, -0.0159552954f, -0.00927070342f,
+    0.00582000194f, 0.0044389856f, -0.00165116077f, -0.0016192965f, 0.000304677902f, 0.00038209153f, -2.14607462e-05f, -0.0f,
+};
+
+// 48000 -> 22050 Hz: 147 phases of 32 taps
+alignas(16) const float kResampler48000[] = {
+    0.000136849645f, 5.60496337e-05f, -0.000842904905f, -0.000967325061f, 0.00229432061f, 0.00461584004f, -0.00307718827f, -0.0134061761f,
+    -0.00143816567f, 0.0282643754f, 0.0203644037f, -0.0465431288f, -0.0736014768f, 0.0620618463f, 0.306168765f, 0.431827843f,
+    0.306168765f, 0.0620618463f, -0.0736014768f, -0.0465431288f, 0.0203644037f, 0.0282643754f, -0.00143816567f, -0.0134061761f,
+    -0.00307718827f, 0.00461584004f, 0.00229432061f, -0.000967325061f, -0.000842904905f, 5.60496337e-05f, 0.000136849645f, 0.0f,
+    0.000135782771f, 5.92797696e-05f, -0.000835706363f, -0.000976933283f, 0.00226444006f, 0.00462732045f, -0.00299175968f, -0.0133855743f,
+    -0.00161971385f, 0.0281155352f, 0.0206561759f, -0.0460494459f, -0.0738901198f, 0.0605723672f, 0.304629475f, 0.431818008f,
+    0.307697386f, 0.0635562167f, -0.073303327f, -0.0470344089f, 0.0200689957f, 0.0284109116f, -0.00125550269f, -0.0134254117f,
+    -0.00316279544f, 0.00460375007f, 0.00232415576f, -0.000957512937f, -0.000850064447f, 5.27705342e-05f, 0.000137907846f, 7.83547603e-06f,
+    0.000134710659f, 6.24623281e-05f, -0.000828489545f, -0.000986360712f, 0.00223457068f, 0.00463830074f, -0.00290658837f, -0.0133639267f,
+    -0.00180016877f, 0.0279650763f, 0.0209447704f, -0.0455545001f, -0.0741709992f, 0.0590892881f, 0.303086638f, 0.431798518f,
+    0.309222281f, 0.0650568679f, -0.0729973689f, -0.0475243218f, 0.0197704341f, 0.0285557806f, -0.00107177009f, -0.0134435846f,
+    -0.00324864523f, 0.00459115673f, 0.00235399557f, -0.000947519031f, -0.000857203442f, 4.94436899e-05f, 0.000138960255f, 8.20284913e-06f,
+    0.000133632566f, 6.55969779e-05f, -0.000821249094f, -0.000995600247f, 0.00220469851f, 0.00464874925f, -0.00282165804f, -0.01334114f,
+    -0.0019795082f, 0.027812805f, 0.0212300289f, -0.0450579859f, -0.0744435787f, 0.0576121844f, 0.30153808f, 0.431766152f,
+    0.310741097f, 0.0665632561f, -0.0726830065f, -0.0480124615f, 0.0194685776f, 0.0286987461f, -0.000886968686f, -0.0134605849f,
+    -0.00333470711f, 0.00457802089f, 0.00238381955f, -0.000937335484f, -0.000864314323f, 4.60685951e-05f, 0.000140005592f, 8.57823125e-06f,
+    0.000132548739f, 6.86838393e-05f, -0.000813986291f, -0.00100465259f, 0.0021748268f, 0.0046586683f, -0.00273697544f, -0.0133172236f,
+    -0.00215772167f, 0.0276587456f, 0.0215119421f, -0.0445599668f, -0.0747078881f, 0.0561411344f, 0.299983859f, 0.431720883f,
+    0.312253773f, 0.068075344f, -0.0723602325f, -0.0484987795f, 0.0191634353f, 0.0288397875f, -0.000701110635f, -0.0134764072f,
+    -0.00342097459f, 0.00456434209f, 0.00241362443f, -0.000926962064f, -0.000871395983f, 4.26451879e-05f, 0.000141043536f, 8.96166785e-06f,
+    0.000131459441f, 7.17229923e-05f, -0.000806702068f, -0.00101351819f, 0.00214495859f, 0.00466805976f, -0.00265254802f, -0.013292186f,
+    -0.00233479729f, 0.0275029205f, 0.0217904989f, -0.0440604836f, -0.0749639496f, 0.0546761751f, 0.298424095f, 0.431662768f,
+    0.313760221f, 0.0695930496f, -0.0720290095f, -0.04898322f, 0.0188550185f, 0.0289788786f, -0.000514208165f, -0.0134910392f,
+    -0.00350743928f, 0.00455011753f, 0.00244340673f, -0.000916398247f, -0.000878447318f, 3.91733847e-05f, 0.000142073841f, 9.35319895e-06f,
+    0.000130364962f, 7.47145823e-05f, -0.000799397589f, -0.00102219766f, 0.00211509713f, 0.00467692688f, -0.00256838207f, -0.0132660344f,
+    -0.00251072459f, 0.0273453519f, 0.0220656898f, -0.0435595885f, -0.0752117857f, 0.0532173812f, 0.296858817f, 0.431591749f,
+    0.315260381f, 0.0711163282f, -0.0716893375f, -0.0494657308f, 0.018543344f, 0.0291159973f, -0.000326273381f, -0.0135044772f,
+    -0.00359409419f, 0.00453534536f, 0.00247316295f, -0.000905643741f, -0.00088546722f, 3.56531455e-05f, 0.000143096215f, 9.75286548e-06f,
+    0.000129265565f, 7.7658704e-05f, -0.000792074017f, -0.00103069155f, 0.00208524545f, 0.00468527153f, -0.00248448504f, -0.0132387802f,
+    -0.00268549309f, 0.0271860678f, 0.0223375093f, -0.0430573411f, -0.0754514411f, 0.0517647974f, 0.295288146f, 0.431507885f,
+    0.316754103f, 0.0726451054f, -0.0713411793f, -0.0499462634f, 0.0182284173f, 0.0292511247f, -0.000137318944f, -0.0135167111f,
+    -0.0036809321f, 0.00452002324f, 0.0025028903f, -0.000894698256f, -0.000892454525f, 3.20844047e-05f, 0.000144110381f, 1.01607102e-05f,
+    0.000128161468f, 8.05554955e-05f, -0.000784732343f, -0.00103900046f, 0.0020554068f, 0.0046930965f, -0.00240086275f, -0.0132104289f,
+    -0.00285909185f, 0.0270250868f, 0.0226059463f, -0.042553775f, -0.0756829232f, 0.0503184795f, 0.293712169f, 0.431411117f,
+    0.318241388f, 0.0741793364f, -0.0709845126f, -0.0504247658f, 0.0179102551f, 0.0293842349f, 5.26425647e-05f, -0.0135277323f,
+    -0.00376794511f, 0.00450414931f, 0.00253258483f, -0.000883561326f, -0.000899407954f, 2.84671205e-05f, 0.00014511605f, 1.05767685e-05f,
+    0.00012705299f, 8.34050807e-05f, -0.000777373672f, -0.00104712497f, 0.00202558422f, 0.00470040459f, -0.00231752312f, -0.0131809926f,
+    -0.00303151109f, 0.026862435f, 0.022870997f, -0.0420489646f, -0.0759062767f, 0.0488784909f, 0.292130947f, 0.431301504f,
+    0.319722086f, 0.0757189468f, -0.0706193298f, -0.050901182f, 0.0175888687f, 0.0295153074f, 0.000243598362f, -0.0135375364f,
+    -0.00385512598f, 0.00448772218f, 0.00256224326f, -0.000872232718f, -0.000906326401f, 2.48012475e-05f, 0.000146112914f, 1.10010778e-05f,
+    0.000125940322f, 8.62075976e-05f, -0.000769999053f, -0.00105506554f, 0.00199578074f, 0.00470719859f, -0.0022344715f, -0.0131504769f,
+    -0.0032027401f, 0.026698133f, 0.0231326502f, -0.0415429436f, -0.0761215165f, 0.0474448763f, 0.290544569f, 0.431179047f,
+    0.321196169f, 0.0772638768f, -0.0702456012f, -0.0513754599f, 0.017264273f, 0.0296443198f, 0.000435535447f, -0.013546112f,
+    -0.00394246681f, 0.00447073858f, 0.00259186234f, -0.000860712084f, -0.000913208758f, 2.10867511e-05f, 0.000147100684f, 1.14336763e-05f,
+    0.000124823768f, 8.89631774e-05f, -0.000762609532f, -0.00106282288f, 0.0019659996f, 0.00471348083f, -0.00215171464f, -0.0131188929f,
+    -0.00337276887f, 0.0265322067f, 0.0233909003f, -0.0410357676f, -0.0763286799f, 0.0460176952f, 0.288953155f, 0.431043684f,
+    0.322663516f, 0.0788140595f, -0.0698633045f, -0.0518475473f, 0.0169364791f, 0.0297712497f, 0.000628440757f, -0.0135534545f,
+    -0.00402995991f, 0.00445319759f, 0.00262143835f, -0.000848999247f, -0.000920053746f, 1.73236022e-05f, 0.000148079096f, 1.18745947e-05f,
+    0.000123703561f, 9.16719728e-05f, -0.000755206158f, -0.00107039744f, 0.00193624338f, 0.0047192541f, -0.00206925953f, -0.0130862482f,
+    -0.00354158762f, 0.0263646767f, 0.02364574f, -0.0405274816f, -0.0765277818f, 0.0445969924f, 0.287356704f, 0.430895537f,
+    0.324124098f, 0.0803694353f, -0.0694724098f, -0.0523173921f, 0.016605502f, 0.029896073f, 0.000822300965f, -0.0135595528f,
+    -0.00411759689f, 0.00443509687f, 0.0026509678f, -0.000837093859f, -0.000926860201f, 1.35117825e-05f, 0.000149047846f, 1.23238697e-05f,
+    0.000122579935f, 9.43341292e-05f, -0.000747789978f, -0.0010777904f, 0.00190651556f, 0.00472452119f, -0.00198711222f, -0.0130525529f,
+    -0.00370918703f, 0.0261955708f, 0.0238971673f, -0.0400181487f, -0.0767188743f, 0.0431828313f, 0.285755396f, 0.430734545f,
+    0.325577766f, 0.0819299296f, -0.0690729395f, -0.0527849384f, 0.0162713565f, 0.0300187711f, 0.00101710262f, -0.0135644041f,
+    -0.00420537125f, 0.00441643503f, 0.00268044788f, -0.000824995746f, -0.000933626958f, 9.65127401e-06f, 0.000150006614f, 1.2781531e-05f,
+    0.000121453129f, 9.69498142e-05f, -0.000740362098f, -0.00108500186f, 0.00187681871f, 0.0047292849f, -0.001905279f, -0.0130178146f,
+    -0.00387555687f, 0.0260249078f, 0.0241451673f, -0.0395078063f, -0.0769019723f, 0.0417752601f, 0.284149289f, 0.430560708f,
+    0.32702449f, 0.0834954977f, -0.0686648339f, -0.0532501414f, 0.0159340557f, 0.0301393159f, 0.00121283217f, -0.0135679962f,
+    -0.00429327367f, 0.0043972102f, 0.00270987395f, -0.000812704617f, -0.000940352795f, 5.74206842e-06f, 0.000150955108f, 1.32476107e-05f,
+    0.000120323413f, 9.95191731e-05f, -0.000732923392f, -0.00109203288f, 0.00184715597f, 0.00473354757f, -0.00182376616f, -0.0129820444f,
+    -0.00404068828f, 0.0258527137f, 0.0243897438f, -0.0389965065f, -0.0770770982f, 0.0403743312f, 0.282538444f, 0.430374056f,
+    0.32846421f, 0.0850660503f, -0.0682480857f, -0.053712938f, 0.0155936172f, 0.0302576926f, 0.00140947592f, -0.0135703254f,
+    -0.00438129716f, 0.00437742006f, 0.00273924344f, -0.000800220354f, -0.000947036489f, 1.78416462e-06f, 0.000151893051f, 1.37221377e-05f,
+    0.00011919102f, 0.000102042388f, -0.000725474965f, -0.00109888404f, 0.00181753037f, 0.00473731337f, -0.00174257986f, -0.0129452515f,
+    -0.00420457171f, 0.0256790128f, 0.0246308856f, -0.0384843089f, -0.0772443041f, 0.0389800966f, 0.280922979f, 0.430174619f,
+    0.329896808f, 0.0866415426f, -0.0678226873f, -0.0541732796f, 0.0152500542f, 0.0303738788f, 0.0016070198f, -0.0135713834f,
+    -0.00446943333f, 0.00435706461f, 0.00276855263f, -0.000787542784f, -0.000953676878f, -2.22243307e-06f, 0.000152820096f, 1.42051404e-05f,
+    0.000118056189f, 0.000104519619f, -0.000718017865f, -0.00110555603f, 0.0017879447f, 0.00474058418f, -0.00166172604f, -0.0129074436f,
+    -0.0043671988f, 0.0255038273f, 0.0248685908f, -0.0379712507f, -0.0774036124f, 0.0375926085f, 0.279302925f, 0.429962397f,
+    0.331322193f, 0.0882219076f, -0.067388624f, -0.054631114f, 0.0149033843f, 0.0304878484f, 0.00180544995f, -0.0135711636f,
+    -0.00455767382f, 0.00433614058f, 0.00279779756f, -0.000774671789f, -0.000960272795f, -6.27771306e-06f, 0.000153735993f, 1.46966431e-05f,
+    0.000116919138f, 0.000106951033f, -0.000710553024f, -0.00111204956f, 0.00175840175f, 0.00474336278f, -0.00158121088f, -0.0128686298f,
+    -0.00452855974f, 0.0253271796f, 0.0251028519f, -0.0374573879f, -0.0775550455f, 0.0362119041f, 0.27767843f, 0.429737359f,
+    0.332740337f, 0.0898070559f, -0.0669458658f, -0.0550863855f, 0.0145536195f, 0.0305995811f, 0.00200475194f, -0.0135696577f,
+    -0.0046460107f, 0.00431464706f, 0.00282697473f, -0.000761607138f, -0.000966822845f, -1.03816556e-05f, 0.000154640409f, 1.51966715e-05f,
+    0.000115780131f, 0.000109336834f, -0.000703081547f, -0.00111836556f, 0.00172890443f, 0.00474565243f, -0.00150104053f, -0.0128288204f,
+    -0.00468864711f, 0.0251490977f, 0.0253336672f, -0.0369427726f, -0.077698648f, 0.0348380506f, 0.276049554f, 0.429499567f,
+    0.334151119f, 0.0913969427f, -0.0664944127f, -0.0555390529f, 0.0142007815f, 0.0307090618f, 0.00220491178f, -0.0135668609f,
+    -0.00473443605f, 0.00429258263f, 0.00285608089f, -0.000748348946f, -0.000973325979f, -1.45342374e-05f, 0.000155533038f, 1.57052509e-05f,
+    0.00011463937f, 0.000111677189f, -0.000695604249f, -0.0011245046f, 0.00169945566f, 0.00474745687f, -0.00142122072f, -0.0127880247f,
+    -0.00484745111f, 0.024969602f, 0.025561031f, -0.036427442f, -0.0778344497f, 0.0334710889f, 0.274416387f, 0.429249048f,
+    0.335554481f, 0.0929914936f, -0.0660342276f, -0.0559890419f, 0.013844884f, 0.0308162589f, 0.00240591448f, -0.013562765f,
+    -0.0048229415f, 0.0042699459f, 0.00288511207f, -0.000734896807f, -0.000979780918f, -1.87354235e-05f, 0.000156413575f, 1.62224005e-05f,
+    0.000113497088f, 0.000113972281f, -0.000688122236f, -0.00113046751f, 0.001670058f, 0.00474877749f, -0.00134175713f, -0.0127462512f,
+    -0.00500496384f, 0.0247887131f, 0.0257849395f, -0.0359114595f, -0.0779624805f, 0.0321110636f, 0.272778988f, 0.428985775f,
+    0.336950332f, 0.0945906416f, -0.0655653104f, -0.0564363152f, 0.0134859439f, 0.0309211574f, 0.00260774535f, -0.0135573624f,
+    -0.00491151866f, 0.00424673455f, 0.00291406503f, -0.000721250894f, -0.000986186322f, -2.29851739e-05f, 0.000157281684f, 1.6748143e-05f,
+    0.000112353518f, 0.000116222327f, -0.00068063644f, -0.0011362551f, 0.00164071436f, 0.00474961894f, -0.0012626556f, -0.0127035119f,
+    -0.00516117737f, 0.0246064607f, 0.0260053892f, -0.0353948586f, -0.0780827701f, 0.0307580307f, 0.271137506f, 0.428709745f,
+    0.338338614f, 0.096194312f, -0.0650876611f, -0.0568808131f, 0.0131239789f, 0.0310237333f, 0.00281038973f, -0.0135506485f,
+    -0.00500015868f, 0.00422294857f, 0.00294293533f, -0.000707411033f, -0.000992541085f, -2.72834441e-05f, 0.000158137103f, 1.72824948e-05f,
+    0.000111208894f, 0.000118427502f, -0.000673147792f, -0.00114186818f, 0.00161142752f, 0.00474998308f, -0.00118392182f, -0.0126598133f,
+    -0.00531608285f, 0.0244228654f, 0.0262223762f, -0.0348777026f, -0.0781953484f, 0.029412033f, 0.269491941f, 0.428421021f,
+    0.339719266f, 0.0978024453f, -0.0646012351f, -0.0573224835f, 0.0127590075f, 0.0311239697f, 0.00301383296f, -0.0135426149f,
+    -0.00508885412f, 0.0041985861f, 0.00297172042f, -0.00069337734f, -0.000998843927f, -3.16301775e-05f, 0.00015897947f, 1.78254777e-05f,
+    0.000110063411f, 0.000120588033f, -0.000665657339f, -0.00114730757f, 0.00158220029f, 0.00474987458f, -0.0011055615f, -0.0126151666f,
+    -0.00546967331f, 0.0242379513f, 0.0264359023f, -0.0343600325f, -0.0783002675f, 0.0280731171f, 0.267842442f, 0.42811963f,
+    0.341092169f, 0.099414967f, -0.0641060472f, -0.0577612743f, 0.0123910476f, 0.0312218424f, 0.0032180592f, -0.013533256f,
+    -0.00517759565f, 0.00417364622f, 0.00300041586f, -0.000679149758f, -0.00100509368f, -3.6025318e-05f, 0.000159808493f, 1.83771008e-05f,
+    0.000108917317f, 0.000122704107f, -0.000658165955f, -0.00115257397f, 0.00155303511f, 0.0047492953f, -0.00102758012f, -0.0125695802f,
+    -0.00562194036f, 0.0240517445f, 0.0266459621f, -0.0338419005f, -0.0783975646f, 0.0267413314f, 0.266189098f, 0.427805543f,
+    0.342457294f, 0.10103181f, -0.063602075f, -0.0581971332f, 0.0120201167f, 0.0313173309f, 0.003423054f, -0.0135225663f,
+    -0.00526637537f, 0.00414812705f, 0.00302901817f, -0.000664728228f, -0.00101128884f, -4.04687853e-05f, 0.000160623851f, 1.89373841e-05f,
+    0.0001077708f, 0.000124775936f, -0.000650674512f, -0.00115766842f, 0.00152393465f, 0.00474824803f, -0.000949983078f, -0.0125230644f,
+    -0.00577287702f, 0.0238642618f, 0.0268525518f, -0.0333233476f, -0.0784872398f, 0.0254167207f, 0.26453197f, 0.42747879f,
+    0.343814522f, 0.1026529f, -0.0630892888f, -0.0586300008f, 0.0116462354f, 0.0314104185f, 0.00362880109f, -0.0135105383f,
+    -0.00535518397f, 0.0041220272f, 0.0030575234f, -0.000650112925f, -0.00101742835f, -4.49605141e-05f, 0.00016142524f, 1.95063367e-05f,
+    0.000106624095f, 0.00012680373f, -0.000643184176f, -0.00116259174f, 0.00149490195f, 0.00474673742f, -0.000872775854f, -0.0124756312f,
+    -0.00592247583f, 0.0236755367f, 0.0270556714f, -0.0328044295f, -0.0785693675f, 0.0240993295f, 0.262871146f, 0.427139401f,
+    0.345163792f, 0.104278177f, -0.0625677183f, -0.0590598322f, 0.0112694232f, 0.0315010771f, 0.00383528555f, -0.0134971673f,
+    -0.00544401398f, 0.00409534713f, 0.0030859285f, -0.000635303964f, -0.00102351105f, -4.95004242e-05f, 0.000162212309f, 2.00839731e-05f,
+    0.000105477397f, 0.000128787739f, -0.000635695586f, -0.00116734486f, 0.00146593922f, 0.00474476581f, -0.000795963744f, -0.0124272862f,
+    -0.00607072935f, 0.0234855842f, 0.0272553209f, -0.0322851874f, -0.0786439627f, 0.0227892026f, 0.261206716f, 0.426787406f,
+    0.346505046f, 0.105907559f, -0.0620373078f, -0.059486568f, 0.0108896969f, 0.031589292f, 0.00404249085f, -0.0134824449f,
+    -0.00553285517f, 0.00406808499f, 0.00311422907f, -0.000620301289f, -0.00102953543f, -5.40884103e-05f, 0.000162984768f, 2.06702971e-05f,
+    0.000104330924f, 0.000130728149f, -0.000628209847f, -0.0011719286f, 0.00143704936f, 0.00474233693f, -0.000719552045f, -0.0123780426f,
+    -0.00621763058f, 0.0232944358f, 0.0274514984f, -0.0317656733f, -0.0787110627f, 0.0214863848f, 0.2595388f, 0.426422805f,
+    0.347838193f, 0.10754098f, -0.0614980832f, -0.0599101558f, 0.0105070779f, 0.0316750407f, 0.00425040256f, -0.0134663684f,
+    -0.00562170055f, 0.00404023891f, 0.00314242137f, -0.000605105073f, -0.00103550043f, -5.87243849e-05f, 0.000163742283f, 2.12653213e-05f,
+    0.000103184873f, 0.00013262521f, -0.000620727718f, -0.00117634377f, 0.00140823447f, 0.00473945355f, -0.000643545878f, -0.0123279067f,
+    -0.00636317302f, 0.0231021065f, 0.0276442003f, -0.031245932f, -0.0787707046f, 0.0201909151f, 0.257867426f, 0.426045626f,
+    0.349163204f, 0.109178357f, -0.0609500073f, -0.0603305437f, 0.0101215867f, 0.0317583047f, 0.00445900299f, -0.0134489285f,
+    -0.00571054034f, 0.00401180936f, 0.00317050214f, -0.000589715492f, -0.00104140455f, -6.34082389e-05f, 0.000164484503f, 2.18690493e-05f,
+    0.000102039456f, 0.000134479153f, -0.000613250188f, -0.00118059129f, 0.00137949758f, 0.00473611942f, -0.000567950367f, -0.0122768916f,
+    -0.0065073492f, 0.022908628f, 0.0278334282f, -0.0307260081f, -0.0788229257f, 0.018902842f, 0.256192744f, 0.425655872f,
+    0.350479901f, 0.110819638f, -0.0603930876f, -0.0607476719f, 0.00973324291f, 0.0318390653f, 0.00466827722f, -0.0134301223f,
+    -0.00579936523f, 0.00398279447f, 0.00319846673f, -0.00057413266f, -0.00104724686f, -6.81398524e-05f, 0.000165211139f, 2.2481483e-05f,
+    0.000100894875f, 0.000136290211f, -0.000605778128f, -0.00118467223f, 0.0013508409f, 0.00473233778f, -0.000492770574f, -0.0122250058f,
+    -0.00665015355f, 0.0227140188f, 0.0280191861f, -0.0302059539f, -0.0788677633f, 0.0176222064f, 0.254514754f, 0.42525363f,
+    0.351788312f, 0.112464741f, -0.0598273166f, -0.0611615032f, 0.00934206974f, 0.0319172964f, 0.00487820804f, -0.0134099424f,
+    -0.00588816777f, 0.00395319425f, 0.00322631258f, -0.000558356813f, -0.00105302571f, -7.29191161e-05f, 0.000165921883f, 2.31026315e-05f,
+    9.97513125e-05f, 0.000138058604f, -0.000598312356f, -0.00118858751f, 0.00132226699f, 0.0047281119f, -0.000418011448f, -0.0121722585f,
+    -0.00679157861f, 0.0225183032f, 0.0282014664f, -0.0296858121f, -0.0789052621f, 0.0163490493f, 0.252833664f, 0.424838811f,
+    0.353088349f, 0.114113584f, -0.0592526682f, -0.0615719631f, 0.00894808583f, 0.0319929868f, 0.00508877914f, -0.0133883841f,
+    -0.00597693725f, 0.00392300729f, 0.00325403456f, -0.000542388181f, -0.00105874008f, -7.77458918e-05f, 0.000166616344f, 2.37324875e-05f,
+    9.86089799e-05f, 0.000139784592f, -0.000590853859f, -0.00119233807f, 0.00129377854f, 0.00472344505f, -0.000343677908f, -0.0121186618f,
+    -0.00693161879f, 0.0223215092f, 0.0283802729f, -0.0291656293f, -0.0789354593f, 0.0150834126f, 0.251149446f, 0.424411565f,
+    0.354379922f, 0.115766108f, -0.0586691611f, -0.0619790144f, 0.0085513154f, 0.0320661031f, 0.0052999747f, -0.0133654419f,
+    -0.00606566574f, 0.00389223313f, 0.00328162988f, -0.000526226941f, -0.00106438855f, -8.26200485e-05f, 0.000167294245f, 2.43710565e-05f,
+    9.74680515e-05f, 0.000141468423f, -0.000583403453f, -0.00119592482f, 0.00126537762f, 0.00471834093f, -0.000269774813f, -0.0120642241f,
+    -0.00707026804f, 0.0221236553f, 0.0285556074f, -0.028645454f, -0.0789583772f, 0.0138253355f, 0.249462262f, 0.423971802f,
+    0.355662912f, 0.117422231f, -0.0580767654f, -0.0623825938f, 0.00815177709f, 0.0321366452f, 0.00551177701f, -0.0133411093f,
+    -0.00615434488f, 0.00386087154f, 0.00330909435f, -0.000509873324f, -0.00106996985f, -8.75414335e-05f, 0.000167955237f, 2.50183293e-05f,
+    9.63287457e-05f, 0.000143110345f, -0.000575961953f, -0.00119934871f, 0.00123706681f, 0.00471280329f, -0.000196306835f, -0.0120089548f,
+    -0.00720752031f, 0.0219247676f, 0.02872747f, -0.0281253308f, -0.0789740682f, 0.012574859f, 0.247772157f, 0.423519641f,
+    0.356937349f, 0.119081885f, -0.0574754886f, -0.0627826527f, 0.00774949603f, 0.0322045796f, 0.00572416931f, -0.0133153833f,
+    -0.00624296395f, 0.00382892136f, 0.00333642378f, -0.000493327738f, -0.00107548293f, -9.25099012e-05f, 0.000168598985f, 2.56743078e-05f,
+    9.51912225e-05f, 0.000144710604f, -0.000568530173f, -0.00120261067f, 0.00120884832f, 0.00470683444f, -0.000123278689f, -0.011952864f,
+    -0.00734337f, 0.0217248704f, 0.0288958643f, -0.0276053045f, -0.0789825767f, 0.0113320211f, 0.246079251f, 0.423055053f,
+    0.358203083f, 0.120744996f, -0.0568653196f, -0.0631791428f, 0.00734449411f, 0.0322698914f, 0.00593713531f, -0.0132882567f,
+    -0.0063315155f, 0.00379638211f, 0.0033636149f, -0.000476590445f, -0.00108092604f, -9.75252915e-05f, 0.000169225168f, 2.63389793e-05f,
+    9.40556856e-05f, 0.000146269478f, -0.000561108987f, -0.00120571209f, 0.00118072482f, 0.00470043952f, -5.06949982e-05f, -0.011895963f,
+    -0.00747781154f, 0.021523986f, 0.0290607885f, -0.0270854216f, -0.0789839178f, 0.0100968629f, 0.244383618f, 0.422578067f,
+    0.359460086f, 0.122411475f, -0.0562462546f, -0.063571997f, 0.00693679461f, 0.0323325619f, 0.00615065731f, -0.0132597266f,
+    -0.00641998881f, 0.0037632538f, 0.0033906633f, -0.000459661736f, -0.00108629814f, -0.00010258743f, 0.000169833453f, 2.70123383e-05f,
+    9.29223097e-05f, 0.000147787185f, -0.00055369921f, -0.00120865344f, 0.00115269842f, 0.00469362084f, 2.14397205e-05f, -0.011838262f,
+    -0.00761083979f, 0.0213221386f, 0.0292222463f, -0.0265657268f, -0.0789781585f, 0.00886941981f, 0.242685333f, 0.422088712f,
+    0.360708266f, 0.124081261f, -0.0556182861f, -0.0639611706f, 0.00652642036f, 0.0323925689f, 0.00636471761f, -0.0132297864f,
+    -0.00650837598f, 0.00372953573f, 0.00341756549f, -0.000442541961f, -0.00109159818f, -0.000107696142f, 0.000170423504f, 2.76943756e-05f,
+    9.17912694e-05f, 0.000149264015f, -0.000546301773f, -0.001211436f, 0.00112477143f, 0.00468638213f, 9.31210016e-05f, -0.0117797693f,
+    -0.00774244918f, 0.0211193506f, 0.0293802395f, -0.0260462649f, -0.0789653212f, 0.00764973089f, 0.240984514f, 0.42158705f,
+    0.361947566f, 0.125754282f, -0.0549814142f, -0.0643466115f, 0.00611339509f, 0.0324499011f, 0.00657929946f, -0.0131984316f,
+    -0.00659666676f, 0.00369522744f, 0.00344431726f, -0.000425231556f, -0.00109682442f, -0.00011285123f, 0.000170994987f, 2.8385075e-05f,
+    9.06627465e-05f, 0.00015070026f, -0.000538917258f, -0.00121406082f, 0.00109694607f, 0.00467872713f, 0.000164344456f, -0.0117204972f,
+    -0.00787263457f, 0.0209156461f, 0.029534772f, -0.0255270824f, -0.0789454579f, 0.00643783389f, 0.239281207f, 0.421073049f,
+    0.363177925f, 0.127430439f, -0.0543356352f, -0.0647282675f, 0.0056977435f, 0.0325045325f, 0.00679438515f, -0.0131656583f,
+    -0.00668485323f, 0.00366032892f, 0.00347091537f, -0.000407730899f, -0.00110197579f, -0.000118052536f, 0.000171547552f, 2.90844255e-05f,
+    8.95369158e-05f, 0.000152096138f, -0.000531546655f, -0.00121652894f, 0.00106922456f, 0.00467065955f, 0.000235105763f, -0.0116604539f,
+    -0.00800139178f, 0.0207110494f, 0.0296858456f, -0.0250082202f, -0.0789185986f, 0.00523376418f, 0.237575546f, 0.4205468f,
+    0.364399254f, 0.129109696f, -0.0536809415f, -0.065106079f, 0.00527948933f, 0.0325564481f, 0.00700995652f, -0.0131314611f,
+    -0.00677292421f, 0.00362483971f, 0.00349735492f, -0.000390040455f, -0.00110705092f, -0.000123299804f, 0.00017208088f, 2.97924107e-05f,
+    8.84139517e-05f, 0.00015345194f, -0.000524190662f, -0.00121884141f, 0.00104160933f, 0.00466218311f, 0.000305400696f, -0.0115996515f,
+    -0.00812871475f, 0.0205055848f, 0.0298334621f, -0.0244897269f, -0.0788847879f, 0.0040375581f, 0.23586759f, 0.420008332f,
+    0.365611464f, 0.130791932f, -0.0530173369f, -0.0654800013f, 0.00485865818f, 0.0326056294f, 0.00722599588f, -0.0130958362f,
+    -0.00686087133f, 0.00358875981f, 0.00352363265f, -0.000372160663f, -0.00111204863f, -0.000128592888f, 0.000172594635f, 3.05090125e-05f,
+    8.72940218e-05f, 0.000154767971f, -0.000516850094f, -0.00122099917f, 0.00101410248f, 0.00465330062f, 0.000375225034f, -0.0115380976f,
+    -0.00825459883f, 0.0202992726f, 0.0299776271f, -0.0239716414f, -0.0788440779f, 0.00284925103f, 0.234157428f, 0.419457614f,
+    0.366814554f, 0.132477105f, -0.0523448177f, -0.0658499748f, 0.00443527475f, 0.0326520577f, 0.00744248601f, -0.0130587798f,
+    -0.00694868574f, 0.00355208921f, 0.00354974461f, -0.000354091986f, -0.00111696741f, -0.00013393152f, 0.000173088469f, 3.12342054e-05f,
+    8.61772933e-05f, 0.000156044465f, -0.000509525649f, -0.00122300338f, 0.000986705883f, 0.00464401674f, 0.000444574718f, -0.0114758043f,
+    -0.00837904215f, 0.020092139f, 0.0301183462f, -0.0234540142f, -0.078796491f, 0.00166887755f, 0.232445151f, 0.418894708f,
+    0.368008435f, 0.134165123f, -0.0516633764f, -0.0662159473f, 0.00400936417f, 0.0326957181f, 0.0076594078f, -0.0130202854f,
+    -0.00703635672f, 0.00351482746f, 0.00357568706f, -0.00033583492f, -0.00112180621f, -0.000139315511f, 0.000173562046f, 3.19679784e-05f,
+    8.50639262e-05f, 0.000157281742f, -0.000502218201f, -0.00122485519f, 0.00095942209f, 0.00463433424f, 0.000513445702f, -0.0114127817f,
+    -0.0085020382f, 0.0198842064f, 0.0302556194f, -0.0229368843f, -0.0787420869f, 0.000496471359f, 0.230730847f, 0.418319672f,
+    0.369192988f, 0.135855913f, -0.0509730279f, -0.0665778667f, 0.00358095253f, 0.0327365883f, 0.00787674356f, -0.0129803522f,
+    -0.0071238759f, 0.00347697479f, 0.00360145536f, -0.000317390077f, -0.00112656341f, -0.000144744597f, 0.000174015033f, 3.27102971e-05f,
+    8.39540808e-05f, 0.000158480048f, -0.000494928448f, -0.00122655556f, 0.000932252966f, 0.0046242578f, 0.000581834116f, -0.0113490392f,
+    -0.00862358231f, 0.0196754988f, 0.0303894542f, -0.0224202927f, -0.0786808953f, -0.000667933666f, 0.229014605f, 0.417732507f,
+    0.370368183f, 0.137549385f, -0.0502737537f, -0.0669356808f, 0.00315006636f, 0.0327746533f, 0.00809447374f, -0.0129389754f,
+    -0.00721123302f, 0.00343853142f, 0.00362704601f, -0.00029875795f, -0.00113123807f, -0.000150218548f, 0.000174447094f, 3.34611432e-05f,
+    8.28479242e-05f, 0.000159639705f, -0.000487657089f, -0.00122810574f, 0.000905200548f, 0.00461379066f, 0.000649735972f, -0.0112845879f,
+    -0.00874367356f, 0.0194660388f, 0.0305198524f, -0.0219042897f, -0.0786129683f, -0.00182430469f, 0.227296516f, 0.417133242f,
+    0.37153399f, 0.139245465f, -0.0495655611f, -0.0672893375f, 0.00271673175f, 0.0328098908f, 0.00831258297f, -0.0128961494f,
+    -0.00729841925f, 0.0033994976f, 0.00365245505f, -0.000279939151f, -0.00113582856f, -0.0001557371f, 0.00017485788f, 3.42204839e-05f,
+    8.17456021e-05f, 0.000160760974f, -0.000480404909f, -0.00122950668f, 0.00087826699f, 0.0046029361f, 0.000717147544f, -0.0112194372f,
+    -0.00886230543f, 0.0192558486f, 0.0306468215f, -0.0213889107f, -0.0785383284f, -0.00297260936f, 0.225576654f, 0.416521937f,
+    0.37269029f, 0.140944093f, -0.0488484576f, -0.0676387846f, 0.00228097546f, 0.0328422971f, 0.00853104796f, -0.0128518706f,
+    -0.00738542434f, 0.00335987308f, 0.00367767853f, -0.000260934234f, -0.00114033371f, -0.00016130002f, 0.000175247042f, 3.4988283e-05f,
+    8.06472672e-05f, 0.000161844175f, -0.000473172608f, -0.00123075955f, 0.00085145433f, 0.00459169783f, 0.000784064992f, -0.0111535983f,
+    -0.00897947419f, 0.0190449543f, 0.0307703633f, -0.0208742023f, -0.07845705f, -0.00411281642f, 0.223855138f, 0.415898621f,
+    0.373837024f, 0.142645165f, -0.0481224395f, -0.0679839626f, 0.00184282486f, 0.0328718387f, 0.00874985475f, -0.0128061371f,
+    -0.00747223804f, 0.00331965857f, 0.00370271201f, -0.000241743925f, -0.00114475226f, -0.000166907019f, 0.000175614259f, 3.57645222e-05f,
+    7.95530868e-05f, 0.00016288957f, -0.00046596094f, -0.00123186538f, 0.000824764487f, 0.00458008051f, 0.000850484706f, -0.0110870805f,
+    -0.00909517799f, 0.0188333765f, 0.030890489f, -0.020360209f, -0.0783691555f, -0.00524489349f, 0.222132012f, 0.415263355f,
+    0.374974191f, 0.144348606f, -0.0473875068f, -0.0683248341f, 0.00140230753f, 0.032898508f, 0.00896898005f, -0.0127589451f,
+    -0.00755885243f, 0.00327885407f, 0.00372755225f, -0.000222368835f, -0.00114908279f, -0.000172557804f, 0.000175959169f, 3.65491578e-05f,
+    7.8463192e-05f, 0.000163897479f, -0.000458770577f, -0.00123282545f, 0.000798199326f, 0.00456808694f, 0.000916403194f, -0.0110198958f,
+    -0.00920941308f, 0.0186211392f, 0.0310071986f, -0.0198469665f, -0.0782746822f, -0.00636881171f, 0.220407397f, 0.414616108f,
+    0.376101643f, 0.146054342f, -0.0466436669f, -0.0686613172f, 0.000959451194f, 0.0329222865f, 0.0091884071f, -0.01271029f,
+    -0.00764525589f, 0.00323746027f, 0.00375219458f, -0.00020280965f, -0.00115332392f, -0.000178252143f, 0.000176281435f, 3.73421535e-05f,
+    7.73777429e-05f, 0.000164868194f, -0.000451602216f, -0.00123364094f, 0.000771760999f, 0.00455572177f, 0.000981816789f, -0.0109520517f,
+    -0.00932217576f, 0.018408265f, 0.0311205033f, -0.0193345193f, -0.0781737044f, -0.00748454034f, 0.21868135f, 0.41395694f,
+    0.377219379f, 0.147762328f, -0.0458909236f, -0.0689934045f, 0.000514284126f, 0.0329431593f, 0.0094081182f, -0.01266017f,
+    -0.00773144048f, 0.00319547742f, 0.00377663551f, -0.00018306711f, -0.00115747459f, -0.000183989672f, 0.000176580739f, 3.81434729e-05f,
+    7.6296863e-05f, 0.000165802019f, -0.000444456557f, -0.00123431277f, 0.000745451252f, 0.00454298826f, 0.00104672206f, -0.0108835613f,
+    -0.00943346322f, 0.0181947779f, 0.0312304031f, -0.0188229121f, -0.0780662373f, -0.00859204959f, 0.216953993f, 0.413285941f,
+    0.37832728f, 0.14947243f, -0.0451292731f, -0.0693209991f, 6.6834873e-05f, 0.0329611041f, 0.00962809194f, -0.0126085812f,
+    -0.00781739503f, 0.0031529062f, 0.00380087132f, -0.000163141944f, -0.00116153329f, -0.000189770159f, 0.000176856702f, 3.8953076e-05f,
+    7.52207125e-05f, 0.000166699261f, -0.000437334296f, -0.00123484246f, 0.000719272066f, 0.0045298906f, 0.00111111579f, -0.0108144339f,
+    -0.0095432736f, 0.0179807022f, 0.031336911f, -0.0183121823f, -0.0779523402f, -0.00969131198f, 0.215225399f, 0.41260308f,
+    0.379425317f, 0.151184589f, -0.0443587303f, -0.0696440861f, -0.000382867729f, 0.0329761133f, 0.00984830875f, -0.0125555219f,
+    -0.00790311024f, 0.00310974708f, 0.00382489711f, -0.000143034937f, -0.00116549875f, -0.000195593238f, 0.000177109032f, 3.97709191e-05f,
+    7.41494223e-05f, 0.000167560225f, -0.000430236047f, -0.00123523083f, 0.000693225185f, 0.00451643206f, 0.00117499451f, -0.0107446788f,
+    -0.00965160318f, 0.0177660566f, 0.0314400345f, -0.0178023688f, -0.0778320506f, -0.0107822986f, 0.213495657f, 0.411908448f,
+    0.380513459f, 0.152898714f, -0.043579299f, -0.0699625835f, -0.000834794482f, 0.0329881646f, 0.01006875f, -0.0125009874f,
+    -0.00798857678f, 0.00306600076f, 0.0038487094f, -0.00012274686f, -0.00116936967f, -0.000201458606f, 0.000177337322f, 4.05969549e-05f,
+    7.30831234e-05f, 0.000168385202f, -0.000423162535f, -0.00123547914f, 0.000667312474f, 0.00450261682f, 0.00123835518f, -0.0106743081f,
+    -0.00975844916f, 0.0175508671f, 0.0315397754f, -0.0172935184f, -0.0777054131f, -0.0118649816f, 0.211764842f, 0.411202043f,
+    0.381591588f, 0.154614747f, -0.0427909754f, -0.0702764541f, -0.00128891575f, 0.0329972468f, 0.0102893962f, -0.0124449767f,
+    -0.00807378348f, 0.00302166794f, 0.00387230422f, -0.000102278529f, -0.00117314479f, -0.000207365942f, 0.000177541253f, 4.14311398e-05f,
+    7.20219468e-05f, 0.000169174513f, -0.000416114373f, -0.0012355888f, 0.000641535735f, 0.00448844861f, 0.00130119454f, -0.010603331f,
+    -0.00986381061f, 0.017335156f, 0.0316361412f, -0.0167856682f, -0.0775724798f, -0.0129393358f, 0.210033059f, 0.410483927f,
+    0.382659674f, 0.156332612f, -0.0419937819f, -0.0705856383f, -0.00174520188f, 0.0330033414f, 0.0105102286f, -0.0123874871f,
+    -0.00815872196f, 0.00297674956f, 0.00389567739f, -8.16308166e-05f, -0.0011768227f, -0.000213314896f, 0.000177720518f, 4.22734192e-05f,
+    7.09660308e-05f, 0.000169928477f, -0.000409092172f, -0.00123556063f, 0.000615896774f, 0.00447393116f, 0.00136350933f, -0.0105317589f,
+    -0.00996768381f, 0.0171189439f, 0.0317291394f, -0.0162788574f, -0.0774332955f, -0.0140053313f, 0.208300382f, 0.409754127f,
+    0.383717686f, 0.158052191f, -0.0411877073f, -0.0708900914f, -0.00220362237f, 0.0330064334f, 0.010731223f, -0.0123285139f,
+    -0.00824338105f, 0.0029312463f, 0.00391882518f, -6.08045739e-05f, -0.00118040212f, -0.000219305133f, 0.000177874725f, 4.31237422e-05f,
+    6.99154916e-05f, 0.000170647414f, -0.000402096659f, -0.00123539602f, 0.000590397278f, 0.00445906864f, 0.00142529688f, -0.0104596f,
+    -0.0100700678f, 0.0169022586f, 0.0318187848f, -0.0157731269f, -0.0772879049f, -0.0150629468f, 0.2065669f, 0.409012705f,
+    0.384765506f, 0.159773409f, -0.0403727703f, -0.0711897612f, -0.00266414671f, 0.0330065079f, 0.0109523656f, -0.0122680571f,
+    -0.00832775142f, 0.00288515911f, 0.00394174317f, -3.98007287e-05f, -0.00118388189f, -0.000225336291f, 0.000178003582f, 4.39820578e-05f,
+    6.88704677e-05f, 0.000171331631f, -0.000395128358f, -0.00123509625f, 0.000565038878f, 0.00444386527f, 0.00148655393f, -0.0103868674f,
+    -0.0101709608f, 0.0166851189f, 0.0319050811f, -0.0152685167f, -0.0771363527f, -0.0161121543f, 0.204832703f, 0.40825969f,
+    0.385803103f, 0.161496207f, -0.0395489782f, -0.0714845955f, -0.00312674441f, 0.03300355f, 0.011173632f, -0.0122061139f,
+    -0.00841182377f, 0.0028384889f, 0.00396442786f, -1.86201887e-05f, -0.0011872605f, -0.00023140799f, 0.000178106682f, 4.48483115e-05f,
+    6.7831068e-05f, 0.000171981432f, -0.000388187909f, -0.00123466225f, 0.000539823377f, 0.00442832429f, 0.00154727779f, -0.0103135696f,
+    -0.0102703599f, 0.0164675452f, 0.0319880396f, -0.0147650652f, -0.076978676f, -0.0171529297f, 0.20309788f, 0.407495141f,
+    0.386830389f, 0.16322051f, -0.0387163348f, -0.0717745423f, -0.00359138357f, 0.0329975486f, 0.0113950036f, -0.0121426824f,
+    -0.00849558599f, 0.00279123685f, 0.00398687413f, 2.73608339e-06f, -0.00119053666f, -0.000237519882f, 0.00017818372f, 4.57224378e-05f,
+    6.67974236e-05f, 0.000172597152f, -0.000381275982f, -0.00123409543f, 0.000514752348f, 0.0044124499f, 0.00160746567f, -0.0102397176f,
+    -0.0103682643f, 0.0162495635f, 0.032067664f, -0.0142628103f, -0.0768149421f, -0.0181852505f, 0.201362491f, 0.406719059f,
+    0.387847364f, 0.164946213f, -0.0378748588f, -0.0720595494f, -0.00405803323f, 0.0329884812f, 0.0116164591f, -0.01207776f,
+    -0.00857903063f, 0.00274340413f, 0.00400907919f, 2.42671013e-05f, -0.00119370921f, -0.000243671559f, 0.000178234375f, 4.66043784e-05f,
+    6.5769651e-05f, 0.000173179113f, -0.000374393043f, -0.00123339717f, 0.000489827537f, 0.00439624628f, 0.00166711491f, -0.0101653207f,
+    -0.010464672f, 0.0160311982f, 0.0321439654f, -0.0137617933f, -0.0766451806f, -0.0192090906f, 0.199626669f, 0.405931532f,
+    0.388853937f, 0.166673228f, -0.0370245539f, -0.0723395646f, -0.00452666171f, 0.0329763442f, 0.0118379807f, -0.0120113464f,
+    -0.00866214558f, 0.00269499165f, 0.00403103838f, 4.59718613e-05f, -0.00119677675f, -0.000249862642f, 0.000178258255f, 4.74940716e-05f,
+    6.47478519e-05f, 0.000173727633f, -0.000367539818f, -0.00123256829f, 0.00046505034f, 0.0043797167f, 0.00172622257f, -0.0100903902f,
+    -0.0105595831f, 0.0158124641f, 0.032216955f, -0.0132620521f, -0.0764694437f, -0.0202244315f, 0.19789046f, 0.405132622f,
+    0.38985005f, 0.168401495f, -0.0361654274f, -0.0726145506f, -0.00499723619f, 0.0329611115f, 0.0120595442f, -0.011943439f,
+    -0.00874492154f, 0.00264600106f, 0.00405274797f, 6.78493161e-05f, -0.00119973801f, -0.000256092753f, 0.000178255068f, 4.83914519e-05f,
+    6.37321573e-05f, 0.000174243032f, -0.000360716804f, -0.00123161043f, 0.000440422475f, 0.00436286535f, 0.00178478647f, -0.0100149382f,
+    -0.0106529957f, 0.0155933918f, 0.0322866403f, -0.0127636222f, -0.0762877762f, -0.0212312471f, 0.196153983f, 0.404322296f,
+    0.390835673f, 0.170130908f, -0.0352974981f, -0.072884433f, -0.00546972407f, 0.0329427794f, 0.0122811319f, -0.0118740369f,
+    -0.00882734824f, 0.00259643351f, 0.00407420378f, 8.98984072e-05f, -0.00120259158f, -0.000262361456f, 0.000178224451f, 4.92964537e-05f,
+    6.27226618e-05f, 0.000174725647f, -0.000353924552f, -0.00123052462f, 0.000415945426f, 0.00434569735f, 0.0018428039f, -0.00993897114f,
+    -0.0107449079f, 0.0153739993f, 0.0323530324f, -0.0122665446f, -0.0761002451f, -0.0222295187f, 0.194417313f, 0.403500646f,
+    0.391810715f, 0.17186141f, -0.0344207734f, -0.0731491819f, -0.00594409369f, 0.0329213291f, 0.0125027215f, -0.0118031371f,
+    -0.00890941638f, 0.00254629017f, 0.00409540208f, 0.000112118047f, -0.0012053363f, -0.000268668344f, 0.000178166039f, 5.0208997e-05f,
+    6.17194746e-05f, 0.000175175795f, -0.000347163674f, -0.00122931192f, 0.000391620764f, 0.00432821456f, 0.00190027233f, -0.00986250304f,
+    -0.0108353198f, 0.0151543077f, 0.0324161388f, -0.0117708538f, -0.0759068653f, -0.0232192241f, 0.192680523f, 0.402667731f,
+    0.392775118f, 0.173592895f, -0.0335352682f, -0.0734087378f, -0.00642031059f, 0.0328967459f, 0.0127242925f, -0.0117307408f,
+    -0.00899111573f, 0.0024955729f, 0.00411633914f, 0.000134507107f, -0.0012079709f, -0.00027501295f, 0.000178079528f, 5.112902e-05f,
+    6.07227012e-05f, 0.000175593799f, -0.000340434693f, -0.00122797384f, 0.000367449829f, 0.00431042211f, 0.00195718952f, -0.00978554133f,
+    -0.0109242303f, 0.0149343405f, 0.0324759744f, -0.0112765897f, -0.0757077038f, -0.0242003426f, 0.190943703f, 0.40182358f,
+    0.393728882f, 0.175325274f, -0.0326409936f, -0.073663041f, -0.00689834123f, 0.0328690223f, 0.0129458243f, -0.0116568441f,
+    -0.00907243323f, 0.00244428264f, 0.00413700938f, 0.000157064438f, -0.00121049397f, -0.000281394867f, 0.000177964554f, 5.20564427e-05f,
+    5.97324506e-05f, 0.000175980007f, -0.000333738135f, -0.00122651167f, 0.000343434251f, 0.00429232419f, 0.00201355317f, -0.00970809814f,
+    -0.0110116405f, 0.01471412f, 0.0325325504f, -0.0107837878f, -0.0755028203f, -0.0251728557f, 0.189206958f, 0.400968254f,
+    0.394671917f, 0.177058488f, -0.0317379609f, -0.0739120692f, -0.0073781535f, 0.0328381397f, 0.0131672956f, -0.0115814498f,
+    -0.00915336329f, 0.00239242148f, 0.00415741047f, 0.000179788884f, -0.00121290423f, -0.000287813687f, 0.000177820795f, 5.29911922e-05f,
+    5.87488139e-05f, 0.000176334739f, -0.000327074522f, -0.00122492644f, 0.000319575338f, 0.00427392451f, 0.00206936128f, -0.00963018276f,
+    -0.0110975476f, 0.0144936685f, 0.0325858705f, -0.0102924854f, -0.0752922371f, -0.0261367448f, 0.187470347f, 0.400101781f,
+    0.395604134f, 0.178792447f, -0.0308261886f, -0.0741557404f, -0.00785971247f, 0.0328040905f, 0.0133886868f, -0.0115045533f,
+    -0.0092338929f, 0.00233999128f, 0.00417753682f, 0.000202679221f, -0.00121520064f, -0.000294268888f, 0.000177647918f, 5.39331813e-05f,
+    5.77718893e-05f, 0.00017665833f, -0.000320444437f, -0.00122321968f, 0.000295874517f, 0.00425522635f, 0.00212461129f, -0.00955180731f,
+    -0.0111819524f, 0.0142730046f, 0.0326359496f, -0.00980271678f, -0.0750760213f, -0.0270919893f, 0.185733959f, 0.399224252f,
+    0.396525532f, 0.180527046f, -0.029905688f, -0.0743940175f, -0.00834298227f, 0.0327668563f, 0.0136099728f, -0.0114261564f,
+    -0.00931401178f, 0.00228699297f, 0.00419738609f, 0.000225734213f, -0.00121738156f, -0.000300760061f, 0.000177445545f, 5.488233e-05f,
+    5.68017713e-05f, 0.0001769511f, -0.000313848315f, -0.0012213923f, 0.000272333156f, 0.00423623482f, 0.00217930111f, -0.00947297923f,
+    -0.011264856f, 0.0140521545f, 0.0326827988f, -0.00931452028f, -0.07485421f, -0.0280385725f, 0.183997899f, 0.398335636f,
+    0.397436053f, 0.182262227f, -0.0289764777f, -0.074626863f, -0.00882792939f, 0.0327264294f, 0.0138311367f, -0.0113462564f,
+    -0.00939371064f, 0.00223342888f, 0.00421695365f, 0.000248952652f, -0.00121944584f, -0.000307286682f, 0.000177213398f, 5.58385582e-05f,
+    5.58385582e-05f, 0.000177213398f, -0.000307286682f, -0.00121944584f, 0.000248952652f, 0.00421695365f, 0.00223342888f, -0.00939371064f,
+    -0.0113462564f, 0.0138311367f, 0.0327264294f, -0.00882792939f, -0.074626863f, -0.0289764777f, 0.182262227f, 0.397436053f,
+    0.398335636f, 0.183997899f, -0.0280385725f, -0.07485421f, -0.00931452028f, 0.0326827988f, 0.0140521545f, -0.011264856f,
+    -0.00947297923f, 0.00217930111f, 0.00423623482f, 0.000272333156f, -0.0012213923f, -0.000313848315f, 0.0001769511f, 5.68017713e-05f,
+    5.488233e-05f, 0.000177445545f, -0.000300760061f, -0.00121738156f, 0.000225734213f, 0.00419738609f, 0.00228699297f, -0.00931401178f,
+    -0.0114261564f, 0.0136099728f, 0.0327668563f, -0.00834298227f, -0.0743940175f, -0.029905688f, 0.180527046f, 0.396525532f,
+    0.399224252f, 0.185733959f, -0.0270919893f, -0.0750760213f, -0.00980271678f, 0.0326359496f, 0.0142730046f, -0.0111819524f,
+    -0.00955180731f, 0.00212461129f, 0.00425522635f, 0.000295874517f, -0.00122321968f, -0.000320444437f, 0.00017665833f, 5.77718893e-05f,
+    5.39331813e-05f, 0.000177647918f, -0.000294268888f, -0.00121520064f, 0.000202679221f, 0.00417753682f, 0.00233999128f, -0.0092338929f,
+    -0.0115045533f, 0.0133886868f, 0.0328040905f, -0.00785971247f, -0.0741557404f, -0.0308261886f, 0.178792447f, 0.395604134f,
+    0.400101781f, 0.187470347f, -0.0261367448f, -0.0752922371f, -0.0102924854f, 0.0325858705f, 0.0144936685f, -0.0110975476f,
+    -0.00963018276f, 0.00206936128f, 0.00427392451f, 0.000319575338f, -0.00122492644f, -0.000327074522f, 0.000176334739f, 5.87488139e-05f,
+    5.29911922e-05f, 0.000177820795f, -0.000287813687f, -0.00121290423f, 0.000179788884f, 0.00415741047f, 0.00239242148f, -0.00915336329f,
+    -0.0115814498f, 0.0131672956f, 0.0328381397f, -0.0073781535f, -0.0739120692f, -0.0317379609f, 0.177058488f, 0.394671917f,
+    0.400968254f, 0.189206958f, -0.0251728557f, -0.0755028203f, -0.0107837878f, 0.0325325504f, 0.01471412f, -0.0110116405f,
+    -0.00970809814f, 0.00201355317f, 0.00429232419f, 0.000343434251f, -0.00122651167f, -0.000333738135f, 0.000175980007f, 5.97324506e-05f,
+    5.20564427e-05f, 0.000177964554f, -0.000281394867f, -0.00121049397f, 0.000157064438f, 0.00413700938f, 0.00244428264f, -0.00907243323f,
+    -0.0116568441f, 0.0129458243f, 0.0328690223f, -0.00689834123f, -0.073663041f, -0.0326409936f, 0.175325274f, 0.393728882f,
+    0.40182358f, 0.190943703f, -0.0242003426f, -0.0757077038f, -0.0112765897f, 0.0324759744f, 0.0149343405f, -0.0109242303f,
+    -0.00978554133f, 0.00195718952f, 0.00431042211f, 0.000367449829f, -0.00122797384f, -0.000340434693f, 0.000175593799f, 6.07227012e-05f,
+    5.112902e-05f, 0.000178079528f, -0.00027501295f, -0.0012079709f, 0.000134507107f, 0.00411633914f, 0.0024955729f, -0.00899111573f,
+    -0.0117307408f, 0.0127242925f, 0.0328967459f, -0.00642031059f, -0.0734087378f, -0.0335352682f, 0.173592895f, 0.392775118f,
+    0.402667731f, 0.192680523f, -0.0232192241f, -0.0759068653f, -0.0117708538f, 0.0324161388f, 0.0151543077f, -0.0108353198f,
+    -0.00986250304f, 0.00190027233f, 0.00432821456f, 0.000391620764f, -0.00122931192f, -0.000347163674f, 0.000175175795f, 6.17194746e-05f,
+    5.0208997e-05f, 0.000178166039f, -0.000268668344f, -0.0012053363f, 0.000112118047f, 0.00409540208f, 0.00254629017f, -0.00890941638f,
+    -0.0118031371f, 0.0125027215f, 0.0329213291f, -0.00594409369f, -0.0731491819f, -0.0344207734f, 0.17186141f, 0.391810715f,
+    0.403500646f, 0.194417313f, -0.0222295187f, -0.0761002451f, -0.0122665446f, 0.0323530324f, 0.0153739993f, -0.0107449079f,
+    -0.00993897114f, 0.0018428039f, 0.00434569735f, 0.000415945426f, -0.00123052462f, -0.000353924552f, 0.000174725647f, 6.27226618e-05f,
+    4.92964537e-05f, 0.000178224451f, -0.000262361456f, -0.00120259158f, 8.98984072e-05f, 0.00407420378f, 0.00259643351f, -0.00882734824f,
+    -0.0118740369f, 0.0122811319f, 0.0329427794f, -0.00546972407f, -0.072884433f, -0.0352974981f, 0.170130908f, 0.390835673f,
+    0.404322296f, 0.196153983f, -0.0212312471f, -0.0762877762f, -0.0127636222f, 0.0322866403f, 0.0155933918f, -0.0106529957f,
+    -0.0100149382f, 0.00178478647f, 0.00436286535f, 0.000440422475f, -0.00123161043f, -0.000360716804f, 0.000174243032f, 6.37321573e-05f,
+    4.83914519e-05f, 0.000178255068f, -0.000256092753f, -0.00119973801f, 6.78493161e-05f, 0.00405274797f, 0.00264600106f, -0.00874492154f,
+    -0.011943439f, 0.0120595442f, 0.0329611115f, -0.00499723619f, -0.0726145506f, -0.0361654274f, 0.168401495f, 0.38985005f,
+    0.405132622f, 0.19789046f, -0.0202244315f, -0.0764694437f, -0.0132620521f, 0.032216955f, 0.0158124641f, -0.0105595831f,
+    -0.0100903902f, 0.00172622257f, 0.0043797167f, 0.00046505034f, -0.00123256829f, -0.000367539818f, 0.000173727633f, 6.47478519e-05f,
+    4.74940716e-05f, 0.000178258255f, -0.000249862642f, -0.00119677675f, 4.59718613e-05f, 0.00403103838f, 0.00269499165f, -0.00866214558f,
+    -0.0120113464f, 0.0118379807f, 0.0329763442f, -0.00452666171f, -0.0723395646f, -0.0370245539f, 0.166673228f, 0.388853937f,
+    0.405931532f, 0.199626669f, -0.0192090906f, -0.0766451806f, -0.0137617933f, 0.0321439654f, 0.0160311982f, -0.010464672f,
+    -0.0101653207f, 0.00166711491f, 0.00439624628f, 0.000489827537f, -0.00123339717f, -0.000374393043f, 0.000173179113f, 6.5769651e-05f,
+    4.66043784e-05f, 0.000178234375f, -0.000243671559f, -0.00119370921f, 2.42671013e-05f, 0.00400907919f, 0.00274340413f, -0.00857903063f,
+    -0.01207776f, 0.0116164591f, 0.0329884812f, -0.00405803323f, -0.0720595494f, -0.0378748588f, 0.164946213f, 0.387847364f,
+    0.406719059f, 0.201362491f, -0.0181852505f, -0.0768149421f, -0.0142628103f, 0.032067664f, 0.0162495635f, -0.0103682643f,
+    -0.0102397176f, 0.00160746567f, 0.0044124499f, 0.000514752348f, -0.00123409543f, -0.000381275982f, 0.000172597152f, 6.67974236e-05f,
+    4.57224378e-05f, 0.00017818372f, -0.000237519882f, -0.00119053666f, 2.73608339e-06f, 0.00398687413f, 0.00279123685f, -0.00849558599f,
+    -0.0121426824f, 0.0113950036f, 0.0329975486f, -0.00359138357f, -0.0717745423f, -0.0387163348f, 0.16322051f, 0.386830389f,
+    0.407495141f, 0.20309788f, -0.0171529297f, -0.076978676f, -0.0147650652f, 0.0319880396f, 0.0164675452f, -0.0102703599f,
+    -0.0103135696f, 0.00154727779f, 0.00442832429f, 0.000539823377f, -0.00123466225f, -0.000388187909f, 0.000171981432f, 6.7831068e-05f,
+    4.48483115e-05f, 0.000178106682f, -0.00023140799f, -0.0011872605f, -1.86201887e-05f, 0.00396442786f, 0.0028384889f, -0.00841182377f,
+    -0.0122061139f, 0.011173632f, 0.03300355f, -0.00312674441f, -0.0714845955f, -0.0395489782f, 0.161496207f, 0.385803103f,
+    0.40825969f, 0.204832703f, -0.0161121543f, -0.0771363527f, -0.0152685167f, 0.0319050811f, 0.0166851189f, -0.0101709608f,
+    -0.0103868674f, 0.00148655393f, 0.00444386527f, 0.000565038878f, -0.00123509625f, -0.000395128358f, 0.000171331631f, 6.88704677e-05f,
+    4.39820578e-05f, 0.000178003582f, -0.000225336291f, -0.00118388189f, -3.98007287e-05f, 0.00394174317f, 0.00288515911f, -0.00832775142f,
+    -0.0122680571f, 0.0109523656f, 0.0330065079f, -0.00266414671f, -0.0711897612f, -0.0403727703f, 0.159773409f, 0.384765506f,
+    0.409012705f, 0.2065669f, -0.0150629468f, -0.0772879049f, -0.0157731269f, 0.0318187848f, 0.0169022586f, -0.0100700678f,
+    -0.0104596f, 0.00142529688f, 0.00445906864f, 0.000590397278f, -0.00123539602f, -0.000402096659f, 0.000170647414f, 6.99154916e-05f,
+    4.31237422e-05f, 0.000177874725f, -0.000219305133f, -0.00118040212f, -6.08045739e-05f, 0.00391882518f, 0.0029312463f, -0.00824338105f,
+    -0.0123285139f, 0.010731223f, 0.0330064334f, -0.00220362237f, -0.0708900914f, -0.0411877073f, 0.158052191f, 0.383717686f,
+    0.409754127f, 0.208300382f, -0.0140053313f, -0.0774332955f, -0.0162788574f, 0.0317291394f, 0.0171189439f, -0.00996768381f,
+    -0.0105317589f, 0.00136350933f, 0.00447393116f, 0.000615896774f, -0.00123556063f, -0.000409092172f, 0.000169928477f, 7.09660308e-05f,
+    4.22734192e-05f, 0.000177720518f, -0.000213314896f, -0.0011768227f, -8.16308166e-05f, 0.00389567739f, 0.00297674956f, -0.00815872196f,
+    -0.0123874871f, 0.0105102286f, 0.0330033414f, -0.00174520188f, -0.0705856383f, -0.0419937819f, 0.156332612f, 0.382659674f,
+    0.410483927f, 0.210033059f, -0.0129393358f, -0.0775724798f, -0.0167856682f, 0.0316361412f, 0.017335156f, -0.00986381061f,
+    -0.010603331f, 0.00130119454f, 0.00448844861f, 0.000641535735f, -0.0012355888f, -0.000416114373f, 0.000169174513f, 7.20219468e-05f,
+    4.14311398e-05f, 0.000177541253f, -0.000207365942f, -0.00117314479f, -0.000102278529f, 0.00387230422f, 0.00302166794f, -0.00807378348f,
+    -0.0124449767f, 0.0102893962f, 0.0329972468f, -0.00128891575f, -0.0702764541f, -0.0427909754f, 0.154614747f, 0.381591588f,
+    0.411202043f, 0.211764842f, -0.0118649816f, -0.0777054131f, -0.0172935184f, 0.0315397754f, 0.0175508671f, -0.00975844916f,
+    -0.0106743081f, 0.00123835518f, 0.00450261682f, 0.000667312474f, -0.00123547914f, -0.000423162535f, 0.000168385202f, 7.30831234e-05f,
+    4.05969549e-05f, 0.000177337322f, -0.000201458606f, -0.00116936967f, -0.00012274686f, 0.0038487094f, 0.00306600076f, -0.00798857678f,
+    -0.0125009874f, 0.01006875f, 0.0329881646f, -0.000834794482f, -0.0699625835f, -0.043579299f, 0.152898714f, 0.380513459f,
+    0.411908448f, 0.213495657f, -0.0107822986f, -0.0778320506f, -0.0178023688f, 0.0314400345f, 0.0177660566f, -0.00965160318f,
+    -0.0107446788f, 0.00117499451f, 0.00451643206f, 0.000693225185f, -0.00123523083f, -0.000430236047f, 0.000167560225f, 7.41494223e-05f,
+    3.97709191e-05f, 0.000177109032f, -0.000195593238f, -0.00116549875f, -0.000143034937f, 0.00382489711f, 0.00310974708f, -0.00790311024f,
+    -0.0125555219f, 0.00984830875f, 0.0329761133f, -0.000382867729f, -0.0696440861f, -0.0443587303f, 0.151184589f, 0.379425317f,
+    0.41260308f, 0.215225399f, -0.00969131198f, -0.0779523402f, -0.0183121823f, 0.031336911f, 0.0179807022f, -0.0095432736f,
+    -0.0108144339f, 0.00111111579f, 0.0045298906f, 0.000719272066f, -0.00123484246f, -0.000437334296f, 0.000166699261f, 7.52207125e-05f,
+    3.8953076e-05f, 0.000176856702f, -0.000189770159f, -0.00116153329f, -0.000163141944f, 0.00380087132f, 0.0031529062f, -0.00781739503f,
+    -0.0126085812f, 0.00962809194f, 0.0329611041f, 6.6834873e-05f, -0.0693209991f, -0.0451292731f, 0.14947243f, 0.37832728f,
+    0.413285941f, 0.216953993f, -0.00859204959f, -0.0780662373f, -0.0188229121f, 0.0312304031f, 0.0181947779f, -0.00943346322f,
+    -0.0108835613f, 0.00104672206f, 0.00454298826f, 0.000745451252f, -0.00123431277f, -0.000444456557f, 0.000165802019f, 7.6296863e-05f,
+    3.81434729e-05f, 0.000176580739f, -0.000183989672f, -0.00115747459f, -0.00018306711f, 0.00377663551f, 0.00319547742f, -0.00773144048f,
+    -0.01266017f, 0.0094081182f, 0.0329431593f, 0.000514284126f, -0.0689934045f, -0.0458909236f, 0.147762328f, 0.377219379f,
+    0.41395694f, 0.21868135f, -0.00748454034f, -0.0781737044f, -0.0193345193f, 0.0311205033f, 0.018408265f, -0.00932217576f,
+    -0.0109520517f, 0.000981816789f, 0.00455572177f, 0.000771760999f, -0.00123364094f, -0.000451602216f, 0.000164868194f, 7.73777429e-05f,
+    3.73421535e-05f, 0.000176281435f, -0.000178252143f, -0.00115332392f, -0.00020280965f, 0.00375219458f, 0.00323746027f, -0.00764525589f,
+    -0.01271029f, 0.0091884071f, 0.0329222865f, 0.000959451194f, -0.0686613172f, -0.0466436669f, 0.146054342f, 0.376101643f,
+    0.414616108f, 0.220407397f, -0.00636881171f, -0.0782746822f, -0.0198469665f, 0.0310071986f, 0.0186211392f, -0.00920941308f,
+    -0.0110198958f, 0.000916403194f, 0.00456808694f, 0.000798199326f, -0.00123282545f, -0.000458770577f, 0.000163897479f, 7.8463192e-05f,
+    3.65491578e-05f, 0.000175959169f, -0.000172557804f, -0.00114908279f, -0.000222368835f, 0.00372755225f, 0.00327885407f, -0.00755885243f,
+    -0.0127589451f, 0.00896898005f, 0.032898508f, 0.00140230753f, -0.0683248341f, -0.0473875068f, 0.144348606f, 0.374974191f,
+    0.415263355f, 0.222132012f, -0.00524489349f, -0.0783691555f, -0.020360209f, 0.030890489f, 0.0188333765f, -0.00909517799f,
+    -0.0110870805f, 0.000850484706f, 0.00458008051f, 0.000824764487f, -0.00123186538f, -0.00046596094f, 0.00016288957f, 7.95530868e-05f,
+    3.57645222e-05f, 0.000175614259f, -0.000166907019f, -0.00114475226f, -0.000241743925f, 0.00370271201f, 0.00331965857f, -0.00747223804f,
+    -0.0128061371f, 0.00874985475f, 0.0328718387f, 0.00184282486f, -0.0679839626f, -0.0481224395f, 0.142645165f, 0.373837024f,
+    0.415898621f, 0.223855138f, -0.00411281642f, -0.07845705f, -0.0208742023f, 0.0307703633f, 0.0190449543f, -0.00897947419f,
+    -0.0111535983f, 0.000784064992f, 0.00459169783f, 0.00085145433f, -0.00123075955f, -0.000473172608f, 0.000161844175f, 8.06472672e-05f,
+    3.4988283e-05f, 0.000175247042f, -0.00016130002f, -0.00114033371f, -0.000260934234f, 0.00367767853f, 0.00335987308f, -0.00738542434f,
+    -0.0128518706f, 0.00853104796f, 0.0328422971f, 0.00228097546f, -0.0676387846f, -0.0488484576f, 0.140944093f, 0.37269029f,
+    0.416521937f, 0.225576654f, -0.00297260936f, -0.0785383284f, -0.0213889107f, 0.0306468215f, 0.0192558486f, -0.00886230543f,
+    -0.0112194372f, 0.000717147544f, 0.0046029361f, 0.00087826699f, -0.00122950668f, -0.000480404909f, 0.000160760974f, 8.17456021e-05f,
+    3.42204839e-05f, 0.00017485788f, -0.0001557371f, -0.00113582856f, -0.000279939151f, 0.00365245505f, 0.0033994976f, -0.00729841925f,
+    -0.0128961494f, 0.00831258297f, 0.0328098908f, 0.00271673175f, -0.0672893375f, -0.0495655611f, 0.139245465f, 0.37153399f,
+    0.417133242f, 0.227296516f, -0.00182430469f, -0.0786129683f, -0.0219042897f, 0.0305198524f, 0.0194660388f, -0.00874367356f,
+    -0.0112845879f, 0.000649735972f, 0.00461379066f, 0.000905200548f, -0.00122810574f, -0.000487657089f, 0.000159639705f, 8.28479242e-05f,
+    3.34611432e-05f, 0.000174447094f, -0.000150218548f, -0.00113123807f, -0.00029875795f, 0.00362704601f, 0.00343853142f, -0.00721123302f,
+    -0.0129389754f, 0.00809447374f, 0.0327746533f, 0.00315006636f, -0.0669356808f, -0.0502737537f, 0.137549385f, 0.370368183f,
+    0.417732507f, 0.229014605f, -0.000667933666f, -0.0786808953f, -0.0224202927f, 0.0303894542f, 0.0196754988f, -0.00862358231f,
+    -0.0113490392f, 0.000581834116f, 0.0046242578f, 0.000932252966f, -0.00122655556f, -0.000494928448f, 0.000158480048f, 8.39540808e-05f,
+    3.27102971e-05f, 0.000174015033f, -0.000144744597f, -0.00112656341f, -0.000317390077f, 0.00360145536f, 0.00347697479f, -0.0071238759f,
+    -0.0129803522f, 0.00787674356f, 0.0327365883f, 0.00358095253f, -0.0665778667f, -0.0509730279f, 0.135855913f, 0.369192988f,
+    0.418319672f, 0.230730847f, 0.000496471359f, -0.0787420869f, -0.0229368843f, 0.0302556194f, 0.0198842064f, -0.0085020382f,
+    -0.0114127817f, 0.000513445702f, 0.00463433424f, 0.00095942209f, -0.00122485519f, -0.000502218201f, 0.000157281742f, 8.50639262e-05f,
+    3.19679784e-05f, 0.000173562046f, -0.000139315511f, -0.00112180621f, -0.00033583492f, 0.00357568706f, 0.00351482746f, -0.00703635672f,
+    -0.0130202854f, 0.0076594078f, 0.0326957181f, 0.00400936417f, -0.0662159473f, -0.0516633764f, 0.134165123f, 0.368008435f,
+    0.418894708f, 0.232445151f, 0.00166887755f, -0.078796491f, -0.0234540142f, 0.0301183462f, 0.020092139f, -0.00837904215f,
+    -0.0114758043f, 0.000444574718f, 0.00464401674f, 0.000986705883f, -0.00122300338f, -0.000509525649f, 0.000156044465f, 8.61772933e-05f,
+    3.12342054e-05f, 0.000173088469f, -0.00013393152f, -0.00111696741f, -0.000354091986f, 0.00354974461f, 0.00355208921f, -0.00694868574f,
+    -0.0130587798f, 0.00744248601f, 0.0326520577f, 0.00443527475f, -0.0658499748f, -0.0523448177f, 0.132477105f, 0.366814554f,
+    0.419457614f, 0.234157428f, 0.00284925103f, -0.0788440779f, -0.0239716414f, 0.0299776271f, 0.0202992726f, -0.00825459883f,
+    -0.0115380976f, 0.000375225034f, 0.00465330062f, 0.00101410248f, -0.00122099917f, -0.000516850094f, 0.000154767971f, 8.72940218e-05f,
+    3.05090125e-05f, 0.000172594635f, -0.000128592888f, -0.00111204863f, -0.000372160663f, 0.00352363265f, 0.00358875981f, -0.00686087133f,
+    -0.0130958362f, 0.00722599588f, 0.0326056294f, 0.00485865818f, -0.0654800013f, -0.0530173369f, 0.130791932f, 0.365611464f,
+    0.420008332f, 0.23586759f, 0.0040375581f, -0.0788847879f, -0.0244897269f, 0.0298334621f, 0.0205055848f, -0.00812871475f,
+    -0.0115996515f, 0.000305400696f, 0.00466218311f, 0.00104160933f, -0.00121884141f, -0.000524190662f, 0.00015345194f, 8.84139517e-05f,
+    2.97924107e-05f, 0.00017208088f, -0.000123299804f, -0.00110705092f, -0.000390040455f, 0.00349735492f, 0.00362483971f, -0.00677292421f,
+    -0.0131314611f, 0.00700995652f, 0.0325564481f, 0.00527948933f, -0.065106079f, -0.0536809415f, 0.129109696f, 0.364399254f,
+    0.4205468f, 0.237575546f, 0.00523376418f, -0.0789185986f, -0.0250082202f, 0.0296858456f, 0.0207110494f, -0.00800139178f,
+    -0.0116604539f, 0.000235105763f, 0.00467065955f, 0.00106922456f, -0.00121652894f, -0.000531546655f, 0.000152096138f, 8.95369158e-05f,
+    2.90844255e-05f, 0.000171547552f, -0.000118052536f, -0.00110197579f, -0.000407730899f, 0.00347091537f, 0.00366032892f, -0.00668485323f,
+    -0.0131656583f, 0.00679438515f, 0.0325045325f, 0.0056977435f, -0.0647282675f, -0.0543356352f, 0.127430439f, 0.363177925f,
+    0.421073049f, 0.239281207f, 0.00643783389f, -0.0789454579f, -0.0255270824f, 0.029534772f, 0.0209156461f, -0.00787263457f,
+    -0.0117204972f, 0.000164344456f, 0.00467872713f, 0.00109694607f, -0.00121406082f, -0.000538917258f, 0.00015070026f, 9.06627465e-05f,
+    2.8385075e-05f, 0.000170994987f, -0.00011285123f, -0.00109682442f, -0.000425231556f, 0.00344431726f, 0.00369522744f, -0.00659666676f,
+    -0.0131984316f, 0.00657929946f, 0.0324499011f, 0.00611339509f, -0.0643466115f, -0.0549814142f, 0.125754282f, 0.361947566f,
+    0.42158705f, 0.240984514f, 0.00764973089f, -0.0789653212f, -0.0260462649f, 0.0293802395f, 0.0211193506f, -0.00774244918f,
+    -0.0117797693f, 9.31210016e-05f, 0.00468638213f, 0.00112477143f, -0.001211436f, -0.000546301773f, 0.000149264015f, 9.17912694e-05f,
+    2.76943756e-05f, 0.000170423504f, -0.000107696142f, -0.00109159818f, -0.000442541961f, 0.00341756549f, 0.00372953573f, -0.00650837598f,
+    -0.0132297864f, 0.00636471761f, 0.0323925689f, 0.00652642036f, -0.0639611706f, -0.0556182861f, 0.124081261f, 0.360708266f,
+    0.422088712f, 0.242685333f, 0.00886941981f, -0.0789781585f, -0.0265657268f, 0.0292222463f, 0.0213221386f, -0.00761083979f,
+    -0.011838262f, 2.14397205e-05f, 0.00469362084f, 0.00115269842f, -0.00120865344f, -0.00055369921f, 0.000147787185f, 9.29223097e-05f,
+    2.70123383e-05f, 0.000169833453f, -0.00010258743f, -0.00108629814f, -0.000459661736f, 0.0033906633f, 0.0037632538f, -0.00641998881f,
+    -0.0132597266f, 0.00615065731f, 0.0323325619f, 0.00693679461f, -0.063571997f, -0.0562462546f, 0.122411475f, 0.359460086f,
+    0.422578067f, 0.244383618f, 0.0100968629f, -0.0789839178f, -0.0270854216f, 0.0290607885f, 0.021523986f, -0.00747781154f,
+    -0.011895963f, -5.06949982e-05f, 0.00470043952f, 0.00118072482f, -0.00120571209f, -0.000561108987f, 0.000146269478f, 9.40556856e-05f,
+    2.63389793e-05f, 0.000169225168f, -9.75252915e-05f, -0.00108092604f, -0.000476590445f, 0.0033636149f, 0.00379638211f, -0.0063315155f,
+    -0.0132882567f, 0.00593713531f, 0.0322698914f, 0.00734449411f, -0.0631791428f, -0.0568653196f, 0.120744996f, 0.358203083f,
+    0.423055053f, 0.246079251f, 0.0113320211f, -0.0789825767f, -0.0276053045f, 0.0288958643f, 0.0217248704f, -0.00734337f,
+    -0.011952864f, -0.000123278689f, 0.00470683444f, 0.00120884832f, -0.00120261067f, -0.000568530173f, 0.000144710604f, 9.51912225e-05f,
+    2.56743078e-05f, 0.000168598985f, -9.25099012e-05f, -0.00107548293f, -0.000493327738f, 0.00333642378f, 0.00382892136f, -0.00624296395f,
+    -0.0133153833f, 0.00572416931f, 0.0322045796f, 0.00774949603f, -0.0627826527f, -0.0574754886f, 0.119081885f, 0.356937349f,
+    0.423519641f, 0.247772157f, 0.012574859f, -0.0789740682f, -0.0281253308f, 0.02872747f, 0.0219247676f, -0.00720752031f,
+    -0.0120089548f, -0.000196306835f, 0.00471280329f, 0.00123706681f, -0.00119934871f, -0.000575961953f, 0.000143110345f, 9.63287457e-05f,
+    2.50183293e-05f, 0.000167955237f, -8.75414335e-05f, -0.00106996985f, -0.000509873324f, 0.00330909435f, 0.00386087154f, -0.00615434488f,
+    -0.0133411093f, 0.00551177701f, 0.0321366452f, 0.00815177709f, -0.0623825938f, -0.0580767654f, 0.117422231f, 0.355662912f,
+    0.423971802f, 0.249462262f, 0.0138253355f, -0.0789583772f, -0.028645454f, 0.0285556074f, 0.0221236553f, -0.00707026804f,
+    -0.0120642241f, -0.000269774813f, 0.00471834093f, 0.00126537762f, -0.00119592482f, -0.000583403453f, 0.000141468423f, 9.74680515e-05f,
+    2.43710565e-05f, 0.000167294245f, -8.26200485e-05f, -0.00106438855f, -0.000526226941f, 0.00328162988f, 0.00389223313f, -0.00606566574f,
+    -0.0133654419f, 0.0052999747f, 0.0320661031f, 0.0085513154f, -0.0619790144f, -0.0586691611f, 0.115766108f, 0.354379922f,
+    0.424411565f, 0.251149446f, 0.0150834126f, -0.0789354593f, -0.0291656293f, 0.0283802729f, 0.0223215092f, -0.00693161879f,
+    -0.0121186618f, -0.000343677908f, 0.00472344505f, 0.00129377854f, -0.00119233807f, -0.000590853859f, 0.000139784592f, 9.86089799e-05f,
+    2.37324875e-05f, 0.000166616344f, -7.77458918e-05f, -0.00105874008f, -0.000542388181f, 0.00325403456f, 0.00392300729f, -0.00597693725f,
+    -0.0133883841f, 0.00508877914f, 0.0319929868f, 0.00894808583f, -0.0615719631f, -0.0592526682f, 0.114113584f, 0.353088349f,
+    0.424838811f, 0.252833664f, 0.0163490493f, -0.0789052621f, -0.0296858121f, 0.0282014664f, 0.0225183032f, -0.00679157861f,
+    -0.0121722585f, -0.000418011448f, 0.0047281119f, 0.00132226699f, -0.00118858751f, -0.000598312356f, 0.000138058604f, 9.97513125e-05f,
+    2.31026315e-05f, 0.000165921883f, -7.29191161e-05f, -0.00105302571f, -0.000558356813f, 0.00322631258f, 0.00395319425f, -0.00588816777f,
+    -0.0134099424f, 0.00487820804f, 0.0319172964f, 0.00934206974f, -0.0611615032f, -0.0598273166f, 0.112464741f, 0.351788312f,
+    0.42525363f, 0.254514754f, 0.0176222064f, -0.0788677633f, -0.0302059539f, 0.0280191861f, 0.0227140188f, -0.00665015355f,
+    -0.0122250058f, -0.000492770574f, 0.00473233778f, 0.0013508409f, -0.00118467223f, -0.000605778128f, 0.000136290211f, 0.000100894875f,
+    2.2481483e-05f, 0.000165211139f, -6.81398524e-05f, -0.00104724686f, -0.00057413266f, 0.00319846673f, 0.00398279447f, -0.00579936523f,
+    -0.0134301223f, 0.00466827722f, 0.0318390653f, 0.00973324291f, -0.0607476719f, -0.0603930876f, 0.110819638f, 0.350479901f,
+    0.425655872f, 0.256192744f, 0.018902842f, -0.0788229257f, -0.0307260081f, 0.0278334282f, 0.022908628f, -0.0065073492f,
+    -0.0122768916f, -0.000567950367f, 0.00473611942f, 0.00137949758f, -0.00118059129f, -0.000613250188f, 0.000134479153f, 0.000102039456f,
+    2.18690493e-05f, 0.000164484503f, -6.34082389e-05f, -0.00104140455f, -0.000589715492f, 0.00317050214f, 0.00401180936f, -0.00571054034f,
+    -0.0134489285f, 0.00445900299f, 0.0317583047f, 0.0101215867f, -0.0603305437f, -0.0609500073f, 0.109178357f, 0.349163204f,
+    0.426045626f, 0.257867426f, 0.0201909151f, -0.0787707046f, -0.031245932f, 0.0276442003f, 0.0231021065f, -0.00636317302f,
+    -0.0123279067f, -0.000643545878f, 0.00473945355f, 0.00140823447f, -0.00117634377f, -0.000620727718f, 0.00013262521f, 0.000103184873f,
+    2.12653213e-05f, 0.000163742283f, -5.87243849e-05f, -0.00103550043f, -0.000605105073f, 0.00314242137f, 0.00404023891f, -0.00562170055f,
+    -0.0134663684f, 0.00425040256f, 0.0316750407f, 0.0105070779f, -0.0599101558f, -0.0614980832f, 0.10754098f, 0.347838193f,
+    0.426422805f, 0.2595388f, 0.0214863848f, -0.0787110627f, -0.0317656733f, 0.0274514984f, 0.0232944358f, -0.00621763058f,
+    -0.0123780426f, -0.000719552045f, 0.00474233693f, 0.00143704936f, -0.0011719286f, -0.000628209847f, 0.000130728149f, 0.000104330924f,
+    2.06702971e-05f, 0.000162984768f, -5.40884103e-05f, -0.00102953543f, -0.000620301289f, 0.00311422907f, 0.00406808499f, -0.00553285517f,
+    -0.0134824449f, 0.00404249085f, 0.031589292f, 0.0108896969f, -0.059486568f, -0.0620373078f, 0.105907559f, 0.346505046f,
+    0.426787406f, 0.261206716f, 0.0227892026f, -0.0786439627f, -0.0322851874f, 0.0272553209f, 0.0234855842f, -0.00607072935f,
+    -0.0124272862f, -0.000795963744f, 0.00474476581f, 0.00146593922f, -0.00116734486f, -0.000635695586f, 0.000128787739f, 0.000105477397f,
+    2.00839731e-05f, 0.000162212309f, -4.95004242e-05f, -0.00102351105f, -0.000635303964f, 0.0030859285f, 0.00409534713f, -0.00544401398f,
+    -0.0134971673f, 0.00383528555f, 0.0315010771f, 0.0112694232f, -0.0590598322f, -0.0625677183f, 0.104278177f, 0.345163792f,
+    0.427139401f, 0.262871146f, 0.0240993295f, -0.0785693675f, -0.0328044295f, 0.0270556714f, 0.0236755367f, -0.00592247583f,
+    -0.0124756312f, -0.000872775854f, 0.00474673742f, 0.00149490195f, -0.00116259174f, -0.000643184176f, 0.00012680373f, 0.000106624095f,
+    1.95063367e-05f, 0.00016142524f, -4.49605141e-05f, -0.00101742835f, -0.000650112925f, 0.0030575234f, 0.0041220272f, -0.00535518397f,
+    -0.0135105383f, 0.00362880109f, 0.0314104185f, 0.0116462354f, -0.0586300008f, -0.0630892888f, 0.1026529f, 0.343814522f,
+    0.42747879f, 0.26453197f, 0.0254167207f, -0.0784872398f, -0.0333233476f, 0.0268525518f, 0.0238642618f, -0.00577287702f,
+    -0.0125230644f, -0.000949983078f, 0.00474824803f, 0.00152393465f, -0.00115766842f, -0.000650674512f, 0.000124775936f, 0.0001077708f,
+    1.89373841e-05f, 0.000160623851f, -4.04687853e-05f, -0.00101128884f, -0.000664728228f, 0.00302901817f, 0.00414812705f, -0.00526637537f,
+    -0.0135225663f, 0.003423054f, 0.0313173309f, 0.0120201167f, -0.0581971332f, -0.063602075f, 0.10103181f, 0.342457294f,
+    0.427805543f, 0.266189098f, 0.0267413314f, -0.0783975646f, -0.0338419005f, 0.0266459621f, 0.0240517445f, -0.00562194036f,
+    -0.0125695802f, -0.00102758012f, 0.0047492953f, 0.00155303511f, -0.00115257397f, -0.000658165955f, 0.000122704107f, 0.000108917317f,
+    1.83771008e-05f, 0.000159808493f, -3.6025318e-05f, -0.00100509368f, -0.000679149758f, 0.00300041586f, 0.00417364622f, -0.00517759565f,
+    -0.013533256f, 0.0032180592f, 0.0312218424f, 0.0123910476f, -0.0577612743f, -0.0641060472f, 0.099414967f, 0.341092169f,
+    0.42811963f, 0.267842442f, 0.0280731171f, -0.0783002675f, -0.0343600325f, 0.0264359023f, 0.0242379513f, -0.00546967331f,
+    -0.0126151666f, -0.0011055615f, 0.00474987458f, 0.00158220029f, -0.00114730757f, -0.000665657339f, 0.000120588033f, 0.000110063411f,
+    1.78254777e-05f, 0.00015897947f, -3.16301775e-05f, -0.000998843927f, -0.00069337734f, 0.00297172042f, 0.0041985861f, -0.00508885412f,
+    -0.0135426149f, 0.00301383296f, 0.0311239697f, 0.0127590075f, -0.0573224835f, -0.0646012351f, 0.0978024453f, 0.339719266f,
+    0.428421021f, 0.269491941f, 0.029412033f, -0.0781953484f, -0.0348777026f, 0.0262223762f, 0.0244228654f, -0.00531608285f,
+    -0.0126598133f, -0.00118392182f, 0.00474998308f, 0.00161142752f, -0.00114186818f, -0.000673147792f, 0.000118427502f, 0.000111208894f,
+    1.72824948e-05f, 0.000158137103f, -2.72834441e-05f, -0.000992541085f, -0.000707411033f, 0.00294293533f, 0.00422294857f, -0.00500015868f,
+    -0.0135506485f, 0.00281038973f, 0.0310237333f, 0.0131239789f, -0.0568808131f, -0.0650876611f, 0.096194312f, 0.338338614f,
+    0.428709745f, 0.271137506f, 0.0307580307f, -0.0780827701f, -0.0353948586f, 0.0260053892f, 0.0246064607f, -0.00516117737f,
+    -0.0127035119f, -0.0012626556f, 0.00474961894f, 0.00164071436f, -0.0011362551f, -0.00068063644f, 0.000116222327f, 0.000112353518f,
+    1.6748143e-05f, 0.000157281684f, -2.29851739e-05f, -0.000986186322f, -0.000721250894f, 0.00291406503f, 0.00424673455f, -0.00491151866f,
+    -0.0135573624f, 0.00260774535f, 0.0309211574f, 0.0134859439f, -0.0564363152f, -0.0655653104f, 0.0945906416f, 0.336950332f,
+    0.428985775f, 0.272778988f, 0.0321110636f, -0.0779624805f, -0.0359114595f, 0.0257849395f, 0.0247887131f, -0.00500496384f,
+    -0.0127462512f, -0.00134175713f, 0.00474877749f, 0.001670058f, -0.00113046751f, -0.000688122236f, 0.000113972281f, 0.000113497088f,
+    1.62224005e-05f, 0.000156413575f, -1.87354235e-05f, -0.000979780918f, -0.000734896807f, 0.00288511207f, 0.0042699459f, -0.0048229415f,
+    -0.013562765f, 0.00240591448f, 0.0308162589f, 0.013844884f, -0.0559890419f, -0.0660342276f, 0.0929914936f, 0.335554481f,
+    0.429249048f, 0.274416387f, 0.0334710889f, -0.0778344497f, -0.036427442f, 0.025561031f, 0.024969602f, -0.00484745111f,
+    -0.0127880247f, -0.00142122072f, 0.00474745687f, 0.00169945566f, -0.0011245046f, -0.000695604249f, 0.000111677189f, 0.00011463937f,
+    1.57052509e-05f, 0.000155533038f, -1.45342374e-05f, -0.000973325979f, -0.000748348946f, 0.00285608089f, 0.00429258263f, -0.00473443605f,
+    -0.0135668609f, 0.00220491178f, 0.0307090618f, 0.0142007815f, -0.0555390529f, -0.0664944127f, 0.0913969427f, 0.334151119f,
+    0.429499567f, 0.276049554f, 0.0348380506f, -0.077698648f, -0.0369427726f, 0.0253336672f, 0.0251490977f, -0.00468864711f,
+    -0.0128288204f, -0.00150104053f, 0.00474565243f, 0.00172890443f, -0.00111836556f, -0.000703081547f, 0.000109336834f, 0.000115780131f,
+    1.51966715e-05f, 0.000154640409f, -1.03816556e-05f, -0.000966822845f, -0.000761607138f, 0.00282697473f, 0.00431464706f, -0.0046460107f,
+    -0.0135696577f, 0.00200475194f, 0.0305995811f, 0.0145536195f, -0.0550863855f, -0.0669458658f, 0.0898070559f, 0.332740337f,
+    0.429737359f, 0.27767843f, 0.0362119041f, -0.0775550455f, -0.0374573879f, 0.0251028519f, 0.0253271796f, -0.00452855974f,
+    -0.0128686298f, -0.00158121088f, 0.00474336278f, 0.00175840175f, -0.00111204956f, -0.000710553024f, 0.000106951033f, 0.000116919138f,
+    1.46966431e-05f, 0.000153735993f, -6.27771306e-06f, -0.000960272795f, -0.000774671789f, 0.00279779756f, 0.00433614058f, -0.00455767382f,
+    -0.0135711636f, 0.00180544995f, 0.0304878484f, 0.0149033843f, -0.054631114f, -0.067388624f, 0.0882219076f, 0.331322193f,
+    0.429962397f, 0.279302925f, 0.0375926085f, -0.0774036124f, -0.0379712507f, 0.0248685908f, 0.0255038273f, -0.0043671988f,
+    -0.0129074436f, -0.00166172604f, 0.00474058418f, 0.0017879447f, -0.00110555603f, -0.000718017865f, 0.000104519619f, 0.000118056189f,
+    1.42051404e-05f, 0.000152820096f, -2.22243307e-06f, -0.000953676878f, -0.000787542784f, 0.00276855263f, 0.00435706461f, -0.00446943333f,
+    -0.0135713834f, 0.0016070198f, 0.0303738788f, 0.0152500542f, -0.0541732796f, -0.0678226873f, 0.0866415426f, 0.329896808f,
+    0.430174619f, 0.280922979f, 0.0389800966f, -0.0772443041f, -0.0384843089f, 0.0246308856f, 0.0256790128f, -0.00420457171f,
+    -0.0129452515f, -0.00174257986f, 0.00473731337f, 0.00181753037f, -0.00109888404f, -0.000725474965f, 0.000102042388f, 0.00011919102f,
+    1.37221377e-05f, 0.000151893051f, 1.78416462e-06f, -0.000947036489f, -0.000800220354f, 0.00273924344f, 0.00437742006f, -0.00438129716f,
+    -0.0135703254f, 0.00140947592f, 0.0302576926f, 0.0155936172f, -0.053712938f, -0.0682480857f, 0.0850660503f, 0.32846421f,
+    0.430374056f, 0.282538444f, 0.0403743312f, -0.0770770982f, -0.0389965065f, 0.0243897438f, 0.0258527137f, -0.00404068828f,
+    -0.0129820444f, -0.00182376616f, 0.00473354757f, 0.00184715597f, -0.00109203288f, -0.000732923392f, 9.95191731e-05f, 0.000120323413f,
+    1.32476107e-05f, 0.000150955108f, 5.74206842e-06f, -0.000940352795f, -0.000812704617f, 0.00270987395f, 0.0043972102f, -0.00429327367f,
+    -0.0135679962f, 0.00121283217f, 0.0301393159f, 0.0159340557f, -0.0532501414f, -0.0686648339f, 0.0834954977f, 0.32702449f,
+    0.430560708f, 0.284149289f, 0.0417752601f, -0.0769019723f, -0.0395078063f, 0.0241451673f, 0.0260249078f, -0.00387555687f,
+    -0.0130178146f, -0.001905279f, 0.0047292849f, 0.00187681871f, -0.00108500186f, -0.000740362098f, 9.69498142e-05f, 0.000121453129f,
+    1.2781531e-05f, 0.000150006614f, 9.65127401e-06f, -0.000933626958f, -0.000824995746f, 0.00268044788f, 0.00441643503f, -0.00420537125f,
+    -0.0135644041f, 0.00101710262f, 0.0300187711f, 0.0162713565f, -0.0527849384f, -0.0690729395f, 0.0819299296f, 0.325577766f,
+    0.430734545f, 0.285755396f, 0.0431828313f, -0.0767188743f, -0.0400181487f, 0.0238971673f, 0.0261955708f, -0.00370918703f,
+    -0.0130525529f, -0.00198711222f, 0.00472452119f, 0.00190651556f, -0.0010777904f, -0.000747789978f, 9.43341292e-05f, 0.000122579935f,
+    1.23238697e-05f, 0.000149047846f, 1.35117825e-05f, -0.000926860201f, -0.000837093859f, 0.0026509678f, 0.00443509687f, -0.00411759689f,
+    -0.0135595528f, 0.000822300965f, 0.029896073f, 0.016605502f, -0.0523173921f, -0.0694724098f, 0.0803694353f, 0.324124098f,
+    0.430895537f, 0.287356704f, 0.0445969924f, -0.0765277818f, -0.0405274816f, 0.02364574f, 0.0263646767f, -0.00354158762f,
+    -0.0130862482f, -0.00206925953f, 0.0047192541f, 0.00193624338f, -0.00107039744f, -0.000755206158f, 9.16719728e-05f, 0.000123703561f,
+    1.18745947e-05f, 0.000148079096f, 1.73236022e-05f, -0.000920053746f, -0.000848999247f, 0.00262143835f, 0.00445319759f, -0.00402995991f,
+    -0.0135534545f, 0.000628440757f, 0.0297712497f, 0.0169364791f, -0.0518475473f, -0.0698633045f, 0.0788140595f, 0.322663516f,
+    0.431043684f, 0.288953155f, 0.0460176952f, -0.0763286799f, -0.0410357676f, 0.0233909003f, 0.0265322067f, -0.00337276887f,
+    -0.0131188929f, -0.00215171464f, 0.00471348083f, 0.0019659996f, -0.00106282288f, -0.000762609532f, 8.89631774e-05f, 0.000124823768f,
+    1.14336763e-05f, 0.000147100684f, 2.10867511e-05f, -0.000913208758f, -0.000860712084f, 0.00259186234f, 0.00447073858f, -0.00394246681f,
+    -0.013546112f, 0.000435535447f, 0.0296443198f, 0.017264273f, -0.0513754599f, -0.0702456012f, 0.0772638768f, 0.321196169f,
+    0.431179047f, 0.290544569f, 0.0474448763f, -0.0761215165f, -0.0415429436f, 0.0231326502f, 0.026698133f, -0.0032027401f,
+    -0.0131504769f, -0.0022344715f, 0.00470719859f, 0.00199578074f, -0.00105506554f, -0.000769999053f, 8.62075976e-05f, 0.000125940322f,
+    1.10010778e-05f, 0.000146112914f, 2.48012475e-05f, -0.000906326401f, -0.000872232718f, 0.00256224326f, 0.00448772218f, -0.00385512598f,
+    -0.0135375364f, 0.000243598362f, 0.0295153074f, 0.0175888687f, -0.050901182f, -0.0706193298f, 0.0757189468f, 0.319722086f,
+    0.431301504f, 0.292130947f, 0.0488784909f, -0.0759062767f, -0.0420489646f, 0.022870997f, 0.026862435f, -0.00303151109f,
+    -0.0131809926f, -0.00231752312f, 0.00470040459f, 0.00202558422f, -0.00104712497f, -0.000777373672f, 8.34050807e-05f, 0.00012705299f,
+    1.05767685e-05f, 0.00014511605f, 2.84671205e-05f, -0.000899407954f, -0.000883561326f, 0.00253258483f, 0.00450414931f, -0.00376794511f,
+    -0.0135277323f, 5.26425647e-05f, 0.0293842349f, 0.0179102551f, -0.0504247658f, -0.0709845126f, 0.0741793364f, 0.318241388f,
+    0.431411117f, 0.293712169f, 0.0503184795f, -0.0756829232f, -0.042553775f, 0.0226059463f, 0.0270250868f, -0.00285909185f,
+    -0.0132104289f, -0.00240086275f, 0.0046930965f, 0.0020554068f, -0.00103900046f, -0.000784732343f, 8.05554955e-05f, 0.000128161468f,
+    1.01607102e-05f, 0.000144110381f, 3.20844047e-05f, -0.000892454525f, -0.000894698256f, 0.0025028903f, 0.00452002324f, -0.0036809321f,
+    -0.0135167111f, -0.000137318944f, 0.0292511247f, 0.0182284173f, -0.0499462634f, -0.0713411793f, 0.0726451054f, 0.316754103f,
+    0.431507885f, 0.295288146f, 0.0517647974f, -0.0754514411f, -0.0430573411f, 0.0223375093f, 0.0271860678f, -0.00268549309f,
+    -0.0132387802f, -0.00248448504f, 0.00468527153f, 0.00208524545f, -0.00103069155f, -0.000792074017f, 7.7658704e-05f, 0.000129265565f,
+    9.75286548e-06f, 0.000143096215f, 3.56531455e-05f, -0.00088546722f, -0.000905643741f, 0.00247316295f, 0.00453534536f, -0.00359409419f,
+    -0.0135044772f, -0.000326273381f, 0.0291159973f, 0.018543344f, -0.0494657308f, -0.0716893375f, 0.0711163282f, 0.315260381f,
+    0.431591749f, 0.296858817f, 0.0532173812f, -0.0752117857f, -0.0435595885f, 0.0220656898f, 0.0273453519f, -0.00251072459f,
+    -0.0132660344f, -0.00256838207f, 0.00467692688f, 0.00211509713f, -0.00102219766f, -0.000799397589f, 7.47145823e-05f, 0.000130364962f,
+    9.35319895e-06f, 0.000142073841f, 3.91733847e-05f, -0.000878447318f, -0.000916398247f, 0.00244340673f, 0.00455011753f, -0.00350743928f,
+    -0.0134910392f, -0.000514208165f, 0.0289788786f, 0.0188550185f, -0.04898322f, -0.0720290095f, 0.0695930496f, 0.313760221f,
+    0.431662768f, 0.298424095f, 0.0546761751f, -0.0749639496f, -0.0440604836f, 0.0217904989f, 0.0275029205f, -0.00233479729f,
+    -0.013292186f, -0.00265254802f, 0.00466805976f, 0.00214495859f, -0.00101351819f, -0.000806702068f, 7.17229923e-05f, 0.000131459441f,
+    8.96166785e-06f, 0.000141043536f, 4.26451879e-05f, -0.000871395983f, -0.000926962064f, 0.00241362443f, 0.00456434209f, -0.00342097459f,
+    -0.0134764072f, -0.000701110635f, 0.0288397875f, 0.0191634353f, -0.0484987795f, -0.0723602325f, 0.068075344f, 0.312253773f,
+    0.431720883f, 0.299983859f, 0.0561411344f, -0.0747078881f, -0.0445599668f, 0.0215119421f, 0.0276587456f, -0.00215772167f,
+    -0.0133172236f, -0.00273697544f, 0.0046586683f, 0.0021748268f, -0.00100465259f, -0.000813986291f, 6.86838393e-05f, 0.000132548739f,
+    8.57823125e-06f, 0.000140005592f, 4.60685951e-05f, -0.000864314323f, -0.000937335484f, 0.00238381955f, 0.00457802089f, -0.00333470711f,
+    -0.0134605849f, -0.000886968686f, 0.0286987461f, 0.0194685776f, -0.0480124615f, -0.0726830065f, 0.0665632561f, 0.310741097f,
+    0.431766152f, 0.30153808f, 0.0576121844f, -0.0744435787f, -0.0450579859f, 0.0212300289f, 0.027812805f, -0.0019795082f,
+    -0.01334114f, -0.00282165804f, 0.00464874925f, 0.00220469851f, -0.000995600247f, -0.000821249094f, 6.55969779e-05f, 0.000133632566f,
+    8.20284913e-06f, 0.000138960255f, 4.94436899e-05f, -0.000857203442f, -0.000947519031f, 0.00235399557f, 0.00459115673f, -0.00324864523f,
+    -0.0134435846f, -0.00107177009f, 0.0285557806f, 0.0197704341f, -0.0475243218f, -0.0729973689f, 0.0650568679f, 0.309222281f,
+    0.431798518f, 0.303086638f, 0.0590892881f, -0.0741709992f, -0.0455545001f, 0.0209447704f, 0.0279650763f, -0.00180016877f,
+    -0.0133639267f, -0.00290658837f, 0.00463830074f, 0.00223457068f, -0.000986360712f, -0.000828489545f, 6.24623281e-05f, 0.000134710659f,
+    7.83547603e-06f, 0.000137907846f, 5.27705342e-05f, -0.000850064447f, -0.000957512937f, 0.00232415576f, 0.00460375007f, -0.00316279544f,
+    -0.0134254117f, -0.00125550269f, 0.0284109116f, 0.0200689957f, -0.0470344089f, -0.073303327f, 0.0635562167f, 0.307697386f,
+    0.431818008f, 0.304629475f, 0.0605723672f, -0.0738901198f, -0.0460494459f, 0.0206561759f, 0.0281155352f, -0.00161971385f,
+    -0.0133855743f, -0.00299175968f, 0.00462732045f, 0.00226444006f, -0.000976933283f, -0.000835706363f, 5.92797696e-05f, 0.000135782771f,
+};
+
+} // namespace
+
+const MelTable kMelTables[] = {
+    {229, 2048, 22050, 30.0f, 11025.0f, kMelBands, kMelWeights, 2028},
+};
+const int kNumMelTables = 1;
+
+const ResamplerTable kResamplerTables[] = {
+    {16000, 22050, 441, 320, 32, kResampler16000},
+    {44100, 22050, 1, 2, 32, kResampler44100},
+    {48000, 22050, 147, 320, 32, kResampler48000},
+};
+const int kNumResamplerTables = 3;
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,35 @@
+#include "FFTPlanCache.hpp"
+#include <cmath>
+
+namespace margelo::nitro::chorddsp {
+
+std::vector<float> makeWindow(WindowType type, int size) {
+  std::vector<float> window(size);
+  switch (type) {
+    case WindowType::Hann:
+      for (int i = 0; i < size; i++) {
+        window[i] = 0.5f * (1.0f - std::cos(2.0f * M_PI * i / (size - 1)));
+      }
+      break;
+    case WindowType::HannPeriodic:
+      for (int i = 0; i < size; i++) {
+        window[i] = 0.5f * (1.0f - std::cos(2.0f * M_PI * i / size));
+      }
+      break;
+  }
+  return window;
+}
+
+SpectrumPlan& FFTPlanCache::get(int size, WindowType type) {
+  auto key = std::make_pair(size, type);
+  auto it = plans_.find(key);
+  if (it != plans_.end()) {
+    return *it->second;
+  }
+  auto plan = std::make_unique<SpectrumPlan>(size, type);
+  SpectrumPlan& ref = *plan;
+  plans_.emplace(key, std::move(plan));
+  return ref;
+}
+
+} // namespace margelo::nitro::chorddsp
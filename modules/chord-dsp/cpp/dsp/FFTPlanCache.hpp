@@ -0,0 +1,36 @@
+#pragma once
+
+#include "RealFFT.hpp"
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+enum class WindowType {
+  Hann,         // symmetric: 0.5 * (1 - cos(2*pi*i / (N - 1)))
+  HannPeriodic, // periodic, matches aubio's "hanningz": 0.5 * (1 - cos(2*pi*i / N))
+};
+
+std::vector<float> makeWindow(WindowType type, int size);
+
+// FFT plan plus its analysis window, built together and reused across calls
+struct SpectrumPlan {
+  SpectrumPlan(int size, WindowType type) : fft(size), window(makeWindow(type, size)) {}
+
+  RealFFT fft;
+  std::vector<float> window;
+};
+
+// Owns every SpectrumPlan an analyzer has asked for, keyed by (FFT size, window type).
+// Plans are never evicted, so returned references stay valid for the cache's lifetime.
+class FFTPlanCache {
+public:
+  SpectrumPlan& get(int size, WindowType type);
+
+private:
+  std::map<std::pair<int, WindowType>, std::unique_ptr<SpectrumPlan>> plans_;
+};
+
+} // namespace margelo::nitro::chorddsp
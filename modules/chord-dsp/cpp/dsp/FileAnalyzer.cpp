@@ -0,0 +1,195 @@
+#include "FileAnalyzer.hpp"
+#include "WavFile.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+// aubio headers (both have their own extern "C" guards)
+#include "aubio/aubio.h"
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// Source frames resampled per block
+constexpr size_t kSourceBlock = 4096;
+
+// Reads the analysis-rate samples in order: the file's own, or their
+// resampled version, converted a block ahead of the reads
+class SampleSource {
+public:
+  SampleSource(WavFile& wav, PolyphaseResampler* resampler, std::vector<float>& block, std::vector<float>& pending, PerfStats& perf)
+      : wav_(wav), resampler_(resampler), block_(block), pending_(pending), perf_(perf) {
+    pending_.clear();
+  }
+
+  // Writes the next `count` samples, zeros past the end
+  void read(float* out, size_t count) {
+    size_t n;
+    if (!resampler_) {
+      n = wav_.read(position_, count, out);
+      position_ += n;
+    } else {
+      while (pending_.size() - consumed_ < count && !done_) refill();
+      n = std::min(count, pending_.size() - consumed_);
+      std::copy(pending_.begin() + consumed_, pending_.begin() + consumed_ + n, out);
+      consumed_ += n;
+    }
+    std::fill(out + n, out + count, 0.0f);
+  }
+
+private:
+  void refill() {
+    pending_.erase(pending_.begin(), pending_.begin() + consumed_);
+    consumed_ = 0;
+    block_.resize(kSourceBlock);
+    size_t n = wav_.read(position_, kSourceBlock, block_.data());
+    position_ += n;
+    PerfStats::Timer timer(perf_, PerfStats::kStageResample);
+    resampler_->process(block_.data(), n, pending_);
+    if (n < kSourceBlock) {
+      resampler_->flush(pending_);
+      done_ = true;
+    }
+  }
+
+  WavFile& wav_;
+  PolyphaseResampler* resampler_;
+  std::vector<float>& block_;
+  std::vector<float>& pending_;
+  PerfStats& perf_;
+  size_t position_ = 0;
+  size_t consumed_ = 0;
+  bool done_ = false;
+};
+
+// Run-length encodes decoder decisions into Result::chords
+class ChordRuns {
+public:
+  ChordRuns(std::vector<float>& out, double hopSeconds) : out_(out), hopSeconds_(hopSeconds) {}
+
+  void add(const ChordDecoder::Decision& decision) {
+    if (frames_ == 0 || decision.chord != chord_) {
+      close();
+      chord_ = decision.chord;
+      start_ = frames_;
+    }
+    confidenceSum_ += decision.confidence;
+    count_++;
+    frames_++;
+  }
+
+  void close() {
+    if (count_ == 0) return;
+    out_.push_back(static_cast<float>(start_ * hopSeconds_));
+    out_.push_back(chord_ < 0 ? -1.0f : static_cast<float>(chord_ % 12));
+    out_.push_back(chord_ < 0 ? 0.0f : static_cast<float>(chord_ / 12));
+    out_.push_back(static_cast<float>(confidenceSum_ / count_));
+    confidenceSum_ = 0.0;
+    count_ = 0;
+  }
+
+private:
+  std::vector<float>& out_;
+  double hopSeconds_;
+  size_t frames_ = 0;
+  size_t start_ = 0;
+  int chord_ = -1;
+  double confidenceSum_ = 0.0;
+  size_t count_ = 0;
+};
+
+} // namespace
+
+FileAnalyzer::FileAnalyzer() : decoder_(ChordDecoder::Params(), kDecoderLag), window_(kWindowSize, 0.0f) {}
+
+FileAnalyzer::Result FileAnalyzer::analyze(const std::string& path, const Options& options) {
+  if (options.hopSize < 1 || options.hopSize > kWindowSize) {
+    throw std::invalid_argument("FileAnalyzer: hopSize must be in [1, " + std::to_string(kWindowSize) + "], got " + std::to_string(options.hopSize));
+  }
+  if (options.sampleRate < 0) {
+    throw std::invalid_argument("FileAnalyzer: sampleRate must not be negative, got " + std::to_string(options.sampleRate));
+  }
+  WavFile wav(path);
+  const int sourceRate = static_cast<int>(wav.sampleRate());
+  const int targetRate = options.sampleRate > 0 ? options.sampleRate : sourceRate;
+  const double sampleRate = targetRate;
+  const size_t hop = static_cast<size_t>(options.hopSize);
+
+  PolyphaseResampler* resampler = nullptr;
+  if (targetRate != sourceRate) {
+    if (!resampler_ || resampler_->sourceRate() != sourceRate || resampler_->targetRate() != targetRate) {
+      resampler_ = std::make_unique<PolyphaseResampler>(sourceRate, targetRate);
+    }
+    resampler_->reset();
+    resampler = resampler_.get();
+  }
+
+  core_.setChromaAssignment(options.chromaAssignment);
+  core_.setHarmonicPercussive(options.harmonicPercussive);
+  core_.setSpectralWhitening(options.spectralWhitening);
+  core_.setTuningEstimation(options.tuningEstimation);
+  core_.setOnsetDescriptors(options.onsetMethods, options.onsetWeights);
+  core_.setOnsetParams(options.onsetParams);
+  core_.initOnsetDetector(sampleRate, kWindowSize, static_cast<double>(hop));
+  core_.resetOnsetDetector();
+  decoder_.reset();
+
+  Result result;
+  result.sampleRate = sampleRate;
+  result.hopSize = options.hopSize;
+  size_t frames = resampler ? resampler->outputLength(wav.frames()) : wav.frames();
+  result.hops = frames < static_cast<size_t>(kWindowSize) ? 0 : (frames - kWindowSize) / hop + 1;
+  result.frames.reserve(result.hops * ChordDSPCore::kChromaFrameSize);
+  if (result.hops == 0) return result;
+
+  ChordRuns runs(result.chords, static_cast<double>(hop) / sampleRate);
+  float analysis[ChordDSPCore::kAnalyzeFrameSize];
+  float scores[kNumChords];
+  ChordDecoder::Decision decision;
+  // Samples the onset detector missed over silent hops, for its onset times
+  size_t skipped = 0;
+
+  SampleSource source(wav, resampler, sourceBlock_, resampled_, core_.perf());
+  source.read(window_.data(), kWindowSize);
+  for (size_t h = 0; h < result.hops; h++) {
+    if (options.cancel && options.cancel->load(std::memory_order_relaxed)) {
+      result.hops = h;
+      break;
+    }
+    if (h > 0) {
+      std::copy(window_.begin() + hop, window_.end(), window_.begin());
+      source.read(window_.data() + kWindowSize - hop, hop);
+    }
+
+    double sumSquares = 0.0;
+    for (float sample : window_) sumSquares += sample * sample;
+    float rms = static_cast<float>(std::sqrt(sumSquares / kWindowSize));
+
+    if (rms < options.minRms) {
+      // Like the streaming analyzer: silence leaves the detector untouched
+      std::fill(analysis, analysis + ChordDSPCore::kAnalyzeFrameSize, 0.0f);
+      skipped += hop;
+    } else {
+      core_.analyzeFrame(window_.data(), kWindowSize, sampleRate, analysis);
+      if (analysis[ChordDSPCore::kAnalyzeFrameSize - 2] > 0.0f) {
+        // The detector's clock starts at the end of the first hop it was fed
+        size_t last = aubio_onset_get_last(core_.onsetDetector()->onset());
+        result.onsets.push_back(static_cast<float>((last + kWindowSize - hop + skipped) / sampleRate));
+      }
+    }
+    result.frames.insert(result.frames.end(), analysis, analysis + ChordDSPCore::kChromaFrameSize);
+
+    classifier_.biasedScore(analysis, scores);
+    if (decoder_.push(scores, decision)) runs.add(decision);
+  }
+
+  ChordDecoder::Decision pending[kDecoderLag];
+  int count = decoder_.flush(pending);
+  for (int i = 0; i < count; i++) runs.add(pending[i]);
+  runs.close();
+  return result;
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "ChordClassifier.hpp"
+#include "ChordDSPCore.hpp"
+#include "ChordDecoder.hpp"
+#include "PolyphaseResampler.hpp"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Offline analysis of a recorded WAV file without loading it: WavFile maps
+// the PCM and converts one hop at a time into a kWindowSize window, which
+// goes through the same per-hop path as StreamingChordAnalyzer
+// (ChordDSPCore::analyzeFrame() behind an RMS gate), and chords come from
+// the fixed-lag ChordDecoder. Working memory is the window, the decoder's
+// lag and the mapped pages in flight, whatever the recording length; only
+// the results grow with it. With Options::sampleRate set, the PCM goes
+// through a PolyphaseResampler a block at a time on its way to the window,
+// as live audio is brought to the capture rate.
+class FileAnalyzer {
+public:
+  static constexpr int kWindowSize = ChordDSPCore::kFFTSize;
+  // Chord rows: [start seconds, root (-1 for N/C), quality, mean confidence]
+  static constexpr int kChordSize = 4;
+  // Decoder latency in hops, enough for its path to settle
+  static constexpr int kDecoderLag = 32;
+
+  struct Options {
+    // Analysis rate the file is resampled to; 0 analyzes at the file's own
+    int sampleRate = 0;
+    // In samples at the analysis rate
+    int hopSize = 1024;
+    // Hops below this RMS are silent: no analysis, zero chroma, N/C
+    float minRms = 0.0005f;
+    // Analysis settings, usually copied from the caller's ChordDSPCore
+    ChromaAssignment chromaAssignment = ChromaAssignment::Nearest;
+    bool harmonicPercussive = false;
+    bool spectralWhitening = false;
+    bool tuningEstimation = false;
+    std::vector<std::string> onsetMethods = {"default"};
+    std::vector<double> onsetWeights = {1.0};
+    OnsetParams onsetParams;
+    // When set and true, analysis stops before the next hop and the result
+    // holds the hops done so far
+    const std::atomic<bool>* cancel = nullptr;
+  };
+
+  struct Result {
+    // Analysis rate, which hops and onset times are counted in
+    double sampleRate = 0.0;
+    int hopSize = 0;
+    // Frame h covers samples [h * hopSize, h * hopSize + kWindowSize)
+    size_t hops = 0;
+    // Onset times in seconds
+    std::vector<float> onsets;
+    // ChordDSPCore::kChromaFrameSize values per hop, max-normalized
+    std::vector<float> frames;
+    // kChordSize values per chord run, in order; a run lasts until the next
+    std::vector<float> chords;
+  };
+
+  FileAnalyzer();
+
+  // Throws std::invalid_argument for unreadable files and bad options
+  Result analyze(const std::string& path, const Options& options);
+
+  // Stage timings of every analyze() so far; reset() it to time one file
+  PerfStats& perf() { return core_.perf(); }
+
+private:
+  ChordDSPCore core_;
+  ChordClassifier classifier_;
+  ChordDecoder decoder_;
+  std::vector<float> window_;
+  // Kept across files with the same rates, with its source block and the
+  // output not yet read into the window
+  std::unique_ptr<PolyphaseResampler> resampler_;
+  std::vector<float> sourceBlock_;
+  std::vector<float> resampled_;
+};
+
+} // namespace margelo::nitro::chorddsp
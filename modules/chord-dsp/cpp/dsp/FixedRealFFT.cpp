@@ -0,0 +1,628 @@
+#include "FixedRealFFT.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// The butterflies below are Ooura's (fft8g.c, as vendored by aubio) with the
+// sizes turned into template parameters; variable names and statement
+// order are kept so they stay diffable against the original.
+
+constexpr int log2Of(int n) { return n <= 1 ? 0 : 1 + log2Of(n >> 1); }
+
+// Complex elements i < j that the bit reversal of n / 2 elements swaps
+constexpr int numSwaps(int n) {
+  int m = n / 2;
+  int bits = log2Of(m);
+  int count = 0;
+  for (int i = 0; i < m; i++) {
+    int r = 0;
+    for (int b = 0; b < bits; b++) r |= ((i >> b) & 1) << (bits - 1 - b);
+    if (i < r) count++;
+  }
+  return count;
+}
+
+// Float offsets of each swapped pair, [2i, 2j, ...]
+template <int n>
+constexpr std::array<uint16_t, 2 * numSwaps(n)> makeSwaps() {
+  std::array<uint16_t, 2 * numSwaps(n)> swaps{};
+  int m = n / 2;
+  int bits = log2Of(m);
+  int s = 0;
+  for (int i = 0; i < m; i++) {
+    int r = 0;
+    for (int b = 0; b < bits; b++) r |= ((i >> b) & 1) << (bits - 1 - b);
+    if (i < r) {
+      swaps[s++] = static_cast<uint16_t>(2 * i);
+      swaps[s++] = static_cast<uint16_t>(2 * r);
+    }
+  }
+  return swaps;
+}
+
+template <int n>
+constexpr std::array<uint16_t, 2 * numSwaps(n)> kSwaps = makeSwaps<n>();
+
+// bitrv2: the same permutation, pairs taken in another order
+template <int n>
+void bitrv2(float* a) {
+  const auto& swaps = kSwaps<n>;
+  for (size_t s = 0; s < swaps.size(); s += 2) {
+    float* x = a + swaps[s];
+    float* y = a + swaps[s + 1];
+    float xr = x[0];
+    float xi = x[1];
+    x[0] = y[0];
+    x[1] = y[1];
+    y[0] = xr;
+    y[1] = xi;
+  }
+}
+
+template <int n>
+void cft1st(float* a, const float* w) {
+  int j, k1;
+  float wn4r, wtmp, wk1r, wk1i, wk2r, wk2i, wk3r, wk3i,
+    wk4r, wk4i, wk5r, wk5i, wk6r, wk6i, wk7r, wk7i;
+  float x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i,
+    y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i,
+    y4r, y4i, y5r, y5i, y6r, y6i, y7r, y7i;
+
+  wn4r = w[2];
+  x0r = a[0] + a[2];
+  x0i = a[1] + a[3];
+  x1r = a[0] - a[2];
+  x1i = a[1] - a[3];
+  x2r = a[4] + a[6];
+  x2i = a[5] + a[7];
+  x3r = a[4] - a[6];
+  x3i = a[5] - a[7];
+  y0r = x0r + x2r;
+  y0i = x0i + x2i;
+  y2r = x0r - x2r;
+  y2i = x0i - x2i;
+  y1r = x1r - x3i;
+  y1i = x1i + x3r;
+  y3r = x1r + x3i;
+  y3i = x1i - x3r;
+  x0r = a[8] + a[10];
+  x0i = a[9] + a[11];
+  x1r = a[8] - a[10];
+  x1i = a[9] - a[11];
+  x2r = a[12] + a[14];
+  x2i = a[13] + a[15];
+  x3r = a[12] - a[14];
+  x3i = a[13] - a[15];
+  y4r = x0r + x2r;
+  y4i = x0i + x2i;
+  y6r = x0r - x2r;
+  y6i = x0i - x2i;
+  x0r = x1r - x3i;
+  x0i = x1i + x3r;
+  x2r = x1r + x3i;
+  x2i = x1i - x3r;
+  y5r = wn4r * (x0r - x0i);
+  y5i = wn4r * (x0r + x0i);
+  y7r = wn4r * (x2r - x2i);
+  y7i = wn4r * (x2r + x2i);
+  a[2] = y1r + y5r;
+  a[3] = y1i + y5i;
+  a[10] = y1r - y5r;
+  a[11] = y1i - y5i;
+  a[6] = y3r - y7i;
+  a[7] = y3i + y7r;
+  a[14] = y3r + y7i;
+  a[15] = y3i - y7r;
+  a[0] = y0r + y4r;
+  a[1] = y0i + y4i;
+  a[8] = y0r - y4r;
+  a[9] = y0i - y4i;
+  a[4] = y2r - y6i;
+  a[5] = y2i + y6r;
+  a[12] = y2r + y6i;
+  a[13] = y2i - y6r;
+  if constexpr (n > 16) {
+    wk1r = w[4];
+    wk1i = w[5];
+    x0r = a[16] + a[18];
+    x0i = a[17] + a[19];
+    x1r = a[16] - a[18];
+    x1i = a[17] - a[19];
+    x2r = a[20] + a[22];
+    x2i = a[21] + a[23];
+    x3r = a[20] - a[22];
+    x3i = a[21] - a[23];
+    y0r = x0r + x2r;
+    y0i = x0i + x2i;
+    y2r = x0r - x2r;
+    y2i = x0i - x2i;
+    y1r = x1r - x3i;
+    y1i = x1i + x3r;
+    y3r = x1r + x3i;
+    y3i = x1i - x3r;
+    x0r = a[24] + a[26];
+    x0i = a[25] + a[27];
+    x1r = a[24] - a[26];
+    x1i = a[25] - a[27];
+    x2r = a[28] + a[30];
+    x2i = a[29] + a[31];
+    x3r = a[28] - a[30];
+    x3i = a[29] - a[31];
+    y4r = x0r + x2r;
+    y4i = x0i + x2i;
+    y6r = x0r - x2r;
+    y6i = x0i - x2i;
+    x0r = x1r - x3i;
+    x0i = x1i + x3r;
+    x2r = x1r + x3i;
+    x2i = x3r - x1i;
+    y5r = wk1i * x0r - wk1r * x0i;
+    y5i = wk1i * x0i + wk1r * x0r;
+    y7r = wk1r * x2r + wk1i * x2i;
+    y7i = wk1r * x2i - wk1i * x2r;
+    x0r = wk1r * y1r - wk1i * y1i;
+    x0i = wk1r * y1i + wk1i * y1r;
+    a[18] = x0r + y5r;
+    a[19] = x0i + y5i;
+    a[26] = y5i - x0i;
+    a[27] = x0r - y5r;
+    x0r = wk1i * y3r - wk1r * y3i;
+    x0i = wk1i * y3i + wk1r * y3r;
+    a[22] = x0r - y7r;
+    a[23] = x0i + y7i;
+    a[30] = y7i - x0i;
+    a[31] = x0r + y7r;
+    a[16] = y0r + y4r;
+    a[17] = y0i + y4i;
+    a[24] = y4i - y0i;
+    a[25] = y0r - y4r;
+    x0r = y2r - y6i;
+    x0i = y2i + y6r;
+    a[20] = wn4r * (x0r - x0i);
+    a[21] = wn4r * (x0i + x0r);
+    x0r = y6r - y2i;
+    x0i = y2r + y6i;
+    a[28] = wn4r * (x0r - x0i);
+    a[29] = wn4r * (x0i + x0r);
+    k1 = 4;
+    for (j = 32; j < n; j += 16) {
+      k1 += 4;
+      wk1r = w[k1];
+      wk1i = w[k1 + 1];
+      wk2r = w[k1 + 2];
+      wk2i = w[k1 + 3];
+      wtmp = 2 * wk2i;
+      wk3r = wk1r - wtmp * wk1i;
+      wk3i = wtmp * wk1r - wk1i;
+      wk4r = 1 - wtmp * wk2i;
+      wk4i = wtmp * wk2r;
+      wtmp = 2 * wk4i;
+      wk5r = wk3r - wtmp * wk1i;
+      wk5i = wtmp * wk1r - wk3i;
+      wk6r = wk2r - wtmp * wk2i;
+      wk6i = wtmp * wk2r - wk2i;
+      wk7r = wk1r - wtmp * wk3i;
+      wk7i = wtmp * wk3r - wk1i;
+      x0r = a[j] + a[j + 2];
+      x0i = a[j + 1] + a[j + 3];
+      x1r = a[j] - a[j + 2];
+      x1i = a[j + 1] - a[j + 3];
+      x2r = a[j + 4] + a[j + 6];
+      x2i = a[j + 5] + a[j + 7];
+      x3r = a[j + 4] - a[j + 6];
+      x3i = a[j + 5] - a[j + 7];
+      y0r = x0r + x2r;
+      y0i = x0i + x2i;
+      y2r = x0r - x2r;
+      y2i = x0i - x2i;
+      y1r = x1r - x3i;
+      y1i = x1i + x3r;
+      y3r = x1r + x3i;
+      y3i = x1i - x3r;
+      x0r = a[j + 8] + a[j + 10];
+      x0i = a[j + 9] + a[j + 11];
+      x1r = a[j + 8] - a[j + 10];
+      x1i = a[j + 9] - a[j + 11];
+      x2r = a[j + 12] + a[j + 14];
+      x2i = a[j + 13] + a[j + 15];
+      x3r = a[j + 12] - a[j + 14];
+      x3i = a[j + 13] - a[j + 15];
+      y4r = x0r + x2r;
+      y4i = x0i + x2i;
+      y6r = x0r - x2r;
+      y6i = x0i - x2i;
+      x0r = x1r - x3i;
+      x0i = x1i + x3r;
+      x2r = x1r + x3i;
+      x2i = x1i - x3r;
+      y5r = wn4r * (x0r - x0i);
+      y5i = wn4r * (x0r + x0i);
+      y7r = wn4r * (x2r - x2i);
+      y7i = wn4r * (x2r + x2i);
+      x0r = y1r + y5r;
+      x0i = y1i + y5i;
+      a[j + 2] = wk1r * x0r - wk1i * x0i;
+      a[j + 3] = wk1r * x0i + wk1i * x0r;
+      x0r = y1r - y5r;
+      x0i = y1i - y5i;
+      a[j + 10] = wk5r * x0r - wk5i * x0i;
+      a[j + 11] = wk5r * x0i + wk5i * x0r;
+      x0r = y3r - y7i;
+      x0i = y3i + y7r;
+      a[j + 6] = wk3r * x0r - wk3i * x0i;
+      a[j + 7] = wk3r * x0i + wk3i * x0r;
+      x0r = y3r + y7i;
+      x0i = y3i - y7r;
+      a[j + 14] = wk7r * x0r - wk7i * x0i;
+      a[j + 15] = wk7r * x0i + wk7i * x0r;
+      a[j] = y0r + y4r;
+      a[j + 1] = y0i + y4i;
+      x0r = y0r - y4r;
+      x0i = y0i - y4i;
+      a[j + 8] = wk4r * x0r - wk4i * x0i;
+      a[j + 9] = wk4r * x0i + wk4i * x0r;
+      x0r = y2r - y6i;
+      x0i = y2i + y6r;
+      a[j + 4] = wk2r * x0r - wk2i * x0i;
+      a[j + 5] = wk2r * x0i + wk2i * x0r;
+      x0r = y2r + y6i;
+      x0i = y2i - y6r;
+      a[j + 12] = wk6r * x0r - wk6i * x0i;
+      a[j + 13] = wk6r * x0i + wk6i * x0r;
+    }
+  }
+}
+
+template <int n, int l>
+void cftmdl(float* a, const float* w) {
+  int j, j1, j2, j3, j4, j5, j6, j7, k, k1, m;
+  float wn4r, wtmp, wk1r, wk1i, wk2r, wk2i, wk3r, wk3i,
+    wk4r, wk4i, wk5r, wk5i, wk6r, wk6i, wk7r, wk7i;
+  float x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i,
+    y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i,
+    y4r, y4i, y5r, y5i, y6r, y6i, y7r, y7i;
+
+  m = l << 3;
+  wn4r = w[2];
+  for (j = 0; j < l; j += 2) {
+    j1 = j + l;
+    j2 = j1 + l;
+    j3 = j2 + l;
+    j4 = j3 + l;
+    j5 = j4 + l;
+    j6 = j5 + l;
+    j7 = j6 + l;
+    x0r = a[j] + a[j1];
+    x0i = a[j + 1] + a[j1 + 1];
+    x1r = a[j] - a[j1];
+    x1i = a[j + 1] - a[j1 + 1];
+    x2r = a[j2] + a[j3];
+    x2i = a[j2 + 1] + a[j3 + 1];
+    x3r = a[j2] - a[j3];
+    x3i = a[j2 + 1] - a[j3 + 1];
+    y0r = x0r + x2r;
+    y0i = x0i + x2i;
+    y2r = x0r - x2r;
+    y2i = x0i - x2i;
+    y1r = x1r - x3i;
+    y1i = x1i + x3r;
+    y3r = x1r + x3i;
+    y3i = x1i - x3r;
+    x0r = a[j4] + a[j5];
+    x0i = a[j4 + 1] + a[j5 + 1];
+    x1r = a[j4] - a[j5];
+    x1i = a[j4 + 1] - a[j5 + 1];
+    x2r = a[j6] + a[j7];
+    x2i = a[j6 + 1] + a[j7 + 1];
+    x3r = a[j6] - a[j7];
+    x3i = a[j6 + 1] - a[j7 + 1];
+    y4r = x0r + x2r;
+    y4i = x0i + x2i;
+    y6r = x0r - x2r;
+    y6i = x0i - x2i;
+    x0r = x1r - x3i;
+    x0i = x1i + x3r;
+    x2r = x1r + x3i;
+    x2i = x1i - x3r;
+    y5r = wn4r * (x0r - x0i);
+    y5i = wn4r * (x0r + x0i);
+    y7r = wn4r * (x2r - x2i);
+    y7i = wn4r * (x2r + x2i);
+    a[j1] = y1r + y5r;
+    a[j1 + 1] = y1i + y5i;
+    a[j5] = y1r - y5r;
+    a[j5 + 1] = y1i - y5i;
+    a[j3] = y3r - y7i;
+    a[j3 + 1] = y3i + y7r;
+    a[j7] = y3r + y7i;
+    a[j7 + 1] = y3i - y7r;
+    a[j] = y0r + y4r;
+    a[j + 1] = y0i + y4i;
+    a[j4] = y0r - y4r;
+    a[j4 + 1] = y0i - y4i;
+    a[j2] = y2r - y6i;
+    a[j2 + 1] = y2i + y6r;
+    a[j6] = y2r + y6i;
+    a[j6 + 1] = y2i - y6r;
+  }
+  if (m < n) {
+    wk1r = w[4];
+    wk1i = w[5];
+    for (j = m; j < l + m; j += 2) {
+      j1 = j + l;
+      j2 = j1 + l;
+      j3 = j2 + l;
+      j4 = j3 + l;
+      j5 = j4 + l;
+      j6 = j5 + l;
+      j7 = j6 + l;
+      x0r = a[j] + a[j1];
+      x0i = a[j + 1] + a[j1 + 1];
+      x1r = a[j] - a[j1];
+      x1i = a[j + 1] - a[j1 + 1];
+      x2r = a[j2] + a[j3];
+      x2i = a[j2 + 1] + a[j3 + 1];
+      x3r = a[j2] - a[j3];
+      x3i = a[j2 + 1] - a[j3 + 1];
+      y0r = x0r + x2r;
+      y0i = x0i + x2i;
+      y2r = x0r - x2r;
+      y2i = x0i - x2i;
+      y1r = x1r - x3i;
+      y1i = x1i + x3r;
+      y3r = x1r + x3i;
+      y3i = x1i - x3r;
+      x0r = a[j4] + a[j5];
+      x0i = a[j4 + 1] + a[j5 + 1];
+      x1r = a[j4] - a[j5];
+      x1i = a[j4 + 1] - a[j5 + 1];
+      x2r = a[j6] + a[j7];
+      x2i = a[j6 + 1] + a[j7 + 1];
+      x3r = a[j6] - a[j7];
+      x3i = a[j6 + 1] - a[j7 + 1];
+      y4r = x0r + x2r;
+      y4i = x0i + x2i;
+      y6r = x0r - x2r;
+      y6i = x0i - x2i;
+      x0r = x1r - x3i;
+      x0i = x1i + x3r;
+      x2r = x1r + x3i;
+      x2i = x3r - x1i;
+      y5r = wk1i * x0r - wk1r * x0i;
+      y5i = wk1i * x0i + wk1r * x0r;
+      y7r = wk1r * x2r + wk1i * x2i;
+      y7i = wk1r * x2i - wk1i * x2r;
+      x0r = wk1r * y1r - wk1i * y1i;
+      x0i = wk1r * y1i + wk1i * y1r;
+      a[j1] = x0r + y5r;
+      a[j1 + 1] = x0i + y5i;
+      a[j5] = y5i - x0i;
+      a[j5 + 1] = x0r - y5r;
+      x0r = wk1i * y3r - wk1r * y3i;
+      x0i = wk1i * y3i + wk1r * y3r;
+      a[j3] = x0r - y7r;
+      a[j3 + 1] = x0i + y7i;
+      a[j7] = y7i - x0i;
+      a[j7 + 1] = x0r + y7r;
+      a[j] = y0r + y4r;
+      a[j + 1] = y0i + y4i;
+      a[j4] = y4i - y0i;
+      a[j4 + 1] = y0r - y4r;
+      x0r = y2r - y6i;
+      x0i = y2i + y6r;
+      a[j2] = wn4r * (x0r - x0i);
+      a[j2 + 1] = wn4r * (x0i + x0r);
+      x0r = y6r - y2i;
+      x0i = y2r + y6i;
+      a[j6] = wn4r * (x0r - x0i);
+      a[j6 + 1] = wn4r * (x0i + x0r);
+    }
+    k1 = 4;
+    for (k = 2 * m; k < n; k += m) {
+      k1 += 4;
+      wk1r = w[k1];
+      wk1i = w[k1 + 1];
+      wk2r = w[k1 + 2];
+      wk2i = w[k1 + 3];
+      wtmp = 2 * wk2i;
+      wk3r = wk1r - wtmp * wk1i;
+      wk3i = wtmp * wk1r - wk1i;
+      wk4r = 1 - wtmp * wk2i;
+      wk4i = wtmp * wk2r;
+      wtmp = 2 * wk4i;
+      wk5r = wk3r - wtmp * wk1i;
+      wk5i = wtmp * wk1r - wk3i;
+      wk6r = wk2r - wtmp * wk2i;
+      wk6i = wtmp * wk2r - wk2i;
+      wk7r = wk1r - wtmp * wk3i;
+      wk7i = wtmp * wk3r - wk1i;
+      for (j = k; j < l + k; j += 2) {
+        j1 = j + l;
+        j2 = j1 + l;
+        j3 = j2 + l;
+        j4 = j3 + l;
+        j5 = j4 + l;
+        j6 = j5 + l;
+        j7 = j6 + l;
+        x0r = a[j] + a[j1];
+        x0i = a[j + 1] + a[j1 + 1];
+        x1r = a[j] - a[j1];
+        x1i = a[j + 1] - a[j1 + 1];
+        x2r = a[j2] + a[j3];
+        x2i = a[j2 + 1] + a[j3 + 1];
+        x3r = a[j2] - a[j3];
+        x3i = a[j2 + 1] - a[j3 + 1];
+        y0r = x0r + x2r;
+        y0i = x0i + x2i;
+        y2r = x0r - x2r;
+        y2i = x0i - x2i;
+        y1r = x1r - x3i;
+        y1i = x1i + x3r;
+        y3r = x1r + x3i;
+        y3i = x1i - x3r;
+        x0r = a[j4] + a[j5];
+        x0i = a[j4 + 1] + a[j5 + 1];
+        x1r = a[j4] - a[j5];
+        x1i = a[j4 + 1] - a[j5 + 1];
+        x2r = a[j6] + a[j7];
+        x2i = a[j6 + 1] + a[j7 + 1];
+        x3r = a[j6] - a[j7];
+        x3i = a[j6 + 1] - a[j7 + 1];
+        y4r = x0r + x2r;
+        y4i = x0i + x2i;
+        y6r = x0r - x2r;
+        y6i = x0i - x2i;
+        x0r = x1r - x3i;
+        x0i = x1i + x3r;
+        x2r = x1r + x3i;
+        x2i = x1i - x3r;
+        y5r = wn4r * (x0r - x0i);
+        y5i = wn4r * (x0r + x0i);
+        y7r = wn4r * (x2r - x2i);
+        y7i = wn4r * (x2r + x2i);
+        x0r = y1r + y5r;
+        x0i = y1i + y5i;
+        a[j1] = wk1r * x0r - wk1i * x0i;
+        a[j1 + 1] = wk1r * x0i + wk1i * x0r;
+        x0r = y1r - y5r;
+        x0i = y1i - y5i;
+        a[j5] = wk5r * x0r - wk5i * x0i;
+        a[j5 + 1] = wk5r * x0i + wk5i * x0r;
+        x0r = y3r - y7i;
+        x0i = y3i + y7r;
+        a[j3] = wk3r * x0r - wk3i * x0i;
+        a[j3 + 1] = wk3r * x0i + wk3i * x0r;
+        x0r = y3r + y7i;
+        x0i = y3i - y7r;
+        a[j7] = wk7r * x0r - wk7i * x0i;
+        a[j7 + 1] = wk7r * x0i + wk7i * x0r;
+        a[j] = y0r + y4r;
+        a[j + 1] = y0i + y4i;
+        x0r = y0r - y4r;
+        x0i = y0i - y4i;
+        a[j4] = wk4r * x0r - wk4i * x0i;
+        a[j4 + 1] = wk4r * x0i + wk4i * x0r;
+        x0r = y2r - y6i;
+        x0i = y2i + y6r;
+        a[j2] = wk2r * x0r - wk2i * x0i;
+        a[j2 + 1] = wk2r * x0i + wk2i * x0r;
+        x0r = y2r + y6i;
+        x0i = y2i - y6r;
+        a[j6] = wk6r * x0r - wk6i * x0i;
+        a[j6 + 1] = wk6r * x0i + wk6i * x0r;
+      }
+    }
+  }
+}
+
+// cftfsub's radix-8 stages l = 16, 128, 1024, ... while l * 8 <= n, then a
+// radix-4 or radix-2 pass for the remaining factor
+template <int n, int l>
+void cftStages(float* a, const float* w) {
+  if constexpr ((l << 3) <= n) {
+    cftmdl<n, l>(a, w);
+    cftStages<n, (l << 3)>(a, w);
+  } else if constexpr ((l << 1) < n) {
+    int j, j1, j2, j3;
+    float x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
+
+    for (j = 0; j < l; j += 2) {
+      j1 = j + l;
+      j2 = j1 + l;
+      j3 = j2 + l;
+      x0r = a[j] + a[j1];
+      x0i = a[j + 1] + a[j1 + 1];
+      x1r = a[j] - a[j1];
+      x1i = a[j + 1] - a[j1 + 1];
+      x2r = a[j2] + a[j3];
+      x2i = a[j2 + 1] + a[j3 + 1];
+      x3r = a[j2] - a[j3];
+      x3i = a[j2 + 1] - a[j3 + 1];
+      a[j] = x0r + x2r;
+      a[j + 1] = x0i + x2i;
+      a[j2] = x0r - x2r;
+      a[j2 + 1] = x0i - x2i;
+      a[j1] = x1r - x3i;
+      a[j1 + 1] = x1i + x3r;
+      a[j3] = x1r + x3i;
+      a[j3 + 1] = x1i - x3r;
+    }
+  } else if constexpr ((l << 1) == n) {
+    int j, j1;
+    float x0r, x0i;
+
+    for (j = 0; j < l; j += 2) {
+      j1 = j + l;
+      x0r = a[j] - a[j1];
+      x0i = a[j + 1] - a[j1 + 1];
+      a[j] += a[j1];
+      a[j + 1] += a[j1 + 1];
+      a[j1] = x0r;
+      a[j1 + 1] = x0i;
+    }
+  }
+}
+
+template <int n>
+void cftfsub(float* a, const float* w) {
+  cft1st<n>(a, w);
+  cftStages<n, 16>(a, w);
+}
+
+// rftfsub with nc = n / 4, so its cosine table stride is 1
+template <int n>
+void rftfsub(float* a, const float* c) {
+  constexpr int nc = n >> 2;
+  constexpr int m = n >> 1;
+  int j, k, kk;
+  float wkr, wki, xr, xi, yr, yi;
+
+  kk = 0;
+  for (j = 2; j < m; j += 2) {
+    k = n - j;
+    kk++;
+    wkr = 0.5f - c[nc - kk];
+    wki = c[kk];
+    xr = a[j] - a[k];
+    xi = a[j + 1] + a[k + 1];
+    yr = wkr * xr - wki * xi;
+    yi = wkr * xi + wki * xr;
+    a[j] -= yr;
+    a[j + 1] -= yi;
+    a[k] += yr;
+    a[k + 1] -= yi;
+  }
+}
+
+// aubio_ooura_rdft(n, 1, a, ip, w) once its tables exist
+template <int n>
+void rdft(float* a, const float* w) {
+  static_assert(n >= 32 && (n & (n - 1)) == 0, "rdft: n must be a power of two >= 32");
+  bitrv2<n>(a);
+  cftfsub<n>(a, w);
+  rftfsub<n>(a, w + (n >> 2));
+  float xi = a[0] - a[1];
+  a[0] += a[1];
+  a[1] = xi;
+}
+
+} // namespace
+
+FixedRdft fixedRdft(int size) {
+  switch (size) {
+    case 1024:
+      return rdft<1024>;
+    case 2048:
+      return rdft<2048>;
+    case 4096:
+      return rdft<4096>;
+    default:
+      return nullptr;
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
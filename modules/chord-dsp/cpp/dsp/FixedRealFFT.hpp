@@ -0,0 +1,21 @@
+#pragma once
+
+namespace margelo::nitro::chorddsp {
+
+// Ooura's forward rdft (aubio/spectral/ooura_fft8g.c) specialized at compile
+// time for the analysis sizes. Same butterflies in the same order, so the
+// output matches aubio_ooura_rdft(size, 1, ...) bit for bit, but the
+// bit-reversal permutation is a constexpr swap table instead of the index
+// table bitrv2 rebuilds on every call, and every stage's loop bounds and
+// strides are constants the compiler can unroll.
+//
+// `a` holds size() real samples and is overwritten with Ooura's layout
+// [R0, R(N/2), R1, -I1, ...]; `w` is the size / 2 twiddle table Ooura's
+// first call leaves in its w argument (makewt then makect).
+using FixedRdft = void (*)(float* a, const float* w);
+
+// Kernel for `size`, or nullptr when it is not specialized (1024, 2048 and
+// 4096 are); callers fall back to aubio_ooura_rdft
+FixedRdft fixedRdft(int size);
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,49 @@
+#include "FrameQueue.hpp"
+#include <algorithm>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+size_t nextPowerOfTwo(size_t n) {
+  size_t p = 1;
+  while (p < n) p <<= 1;
+  return p;
+}
+
+} // namespace
+
+FrameQueue::FrameQueue(size_t frameSize, size_t capacity)
+    : frameSize_(frameSize), mask_(nextPowerOfTwo(std::max<size_t>(capacity, 1)) - 1), buffer_((mask_ + 1) * frameSize, 0.0f) {}
+
+bool FrameQueue::push(const float* frame) {
+  uint64_t tail = tail_.load(std::memory_order_relaxed);
+  if (tail - head_.load(std::memory_order_acquire) > mask_) return false;
+
+  std::copy(frame, frame + frameSize_, buffer_.begin() + (static_cast<size_t>(tail) & mask_) * frameSize_);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+bool FrameQueue::pop(float* frame) {
+  uint64_t head = head_.load(std::memory_order_relaxed);
+  if (head == tail_.load(std::memory_order_acquire)) return false;
+
+  auto slot = buffer_.begin() + (static_cast<size_t>(head) & mask_) * frameSize_;
+  std::copy(slot, slot + frameSize_, frame);
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+size_t FrameQueue::size() const {
+  uint64_t head = head_.load(std::memory_order_acquire);
+  uint64_t tail = tail_.load(std::memory_order_acquire);
+  return static_cast<size_t>(tail - head);
+}
+
+void FrameQueue::clear() {
+  head_.store(0, std::memory_order_relaxed);
+  tail_.store(0, std::memory_order_release);
+}
+
+} // namespace margelo::nitro::chorddsp
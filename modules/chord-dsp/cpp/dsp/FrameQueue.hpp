@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Single-producer / single-consumer queue of fixed-size float frames.
+// Neither side blocks or allocates after construction: push() fails when the
+// queue is full and pop() when it is empty.
+class FrameQueue {
+public:
+  // Capacity (in frames) is rounded up to a power of two
+  FrameQueue(size_t frameSize, size_t capacity);
+
+  FrameQueue(const FrameQueue&) = delete;
+  FrameQueue& operator=(const FrameQueue&) = delete;
+
+  size_t frameSize() const { return frameSize_; }
+  size_t capacity() const { return mask_ + 1; }
+
+  // Producer: copies one frame in. Returns false if the queue is full.
+  bool push(const float* frame);
+
+  // Consumer: copies the oldest frame out. Returns false if the queue is empty.
+  bool pop(float* frame);
+
+  // Frames waiting; exact on the consumer side, a lower bound on the producer's
+  size_t size() const;
+
+  // Drops every frame. Not safe while the other side is active.
+  void clear();
+
+private:
+  size_t frameSize_;
+  size_t mask_;
+  std::vector<float> buffer_;
+  std::atomic<uint64_t> head_{0}; // next frame to pop (consumer)
+  std::atomic<uint64_t> tail_{0}; // next frame to push (producer)
+};
+
+} // namespace margelo::nitro::chorddsp
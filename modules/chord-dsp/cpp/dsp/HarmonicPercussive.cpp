@@ -0,0 +1,102 @@
+#include "HarmonicPercussive.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+
+// Removing the first `old` from an ascending run s gives u[r] = s[r] < old ?
+// s[r] : s[r + 1]; inserting `value` into u gives max(u[r - 1], min(value,
+// u[r])) with u[-1] = -inf and u[n - 1] = +inf. Both are elementwise, so a
+// running median update needs no search, shifting or branches.
+inline float removed(float s, float sNext, float old) {
+  return s < old ? s : sNext;
+}
+
+inline float inserted(float uPrev, float u, float value) {
+  return std::max(uPrev, std::min(value, u));
+}
+
+} // namespace
+
+HarmonicPercussive::HarmonicPercussive(int numBins, int timeFrames, int freqBins)
+    : numBins_(numBins), timeFrames_(timeFrames), freqBins_(freqBins | 1) {
+  if (numBins < 1 || timeFrames < 1 || freqBins < 1) {
+    throw std::invalid_argument("HarmonicPercussive: numBins, timeFrames and freqBins must be positive");
+  }
+  history_.resize(static_cast<size_t>(timeFrames_) * numBins_);
+  sorted_.resize(history_.size());
+  carry_.resize(numBins_);
+  percussive_.resize(numBins_);
+  window_.resize(freqBins_ + 2);
+  removed_.resize(freqBins_ + 1);
+  reset();
+}
+
+void HarmonicPercussive::reset() {
+  std::fill(history_.begin(), history_.end(), 0.0f);
+  std::fill(sorted_.begin(), sorted_.end(), 0.0f);
+  next_ = 0;
+}
+
+void HarmonicPercussive::slideWindow(float old, float value) {
+  // window_ is [-inf, sorted x freqBins_, +inf]; removed_[0] stays -inf
+  float* w = window_.data() + 1;
+  float* u = removed_.data() + 1;
+  for (int r = 0; r < freqBins_; r++) u[r] = removed(w[r], w[r + 1], old);
+  for (int r = 0; r < freqBins_; r++) w[r] = inserted(u[r - 1], u[r], value);
+}
+
+void HarmonicPercussive::process(const float* power, float* mask) {
+  int bins = numBins_;
+
+  // Frequency median: a window of freqBins_ bins centred on k, zero beyond
+  // either end, slid one bin at a time
+  int half = freqBins_ / 2;
+  window_.front() = -kInf;
+  window_.back() = kInf;
+  std::fill(window_.begin() + 1, window_.end() - 1, 0.0f);
+  removed_.front() = -kInf;
+  for (int k = 0; k < half && k < bins; k++) slideWindow(0.0f, power[k]);
+  for (int k = 0; k < bins; k++) {
+    int leaving = k - half - 1;
+    int entering = k + half;
+    slideWindow(leaving >= 0 ? power[leaving] : 0.0f, entering < bins ? power[entering] : 0.0f);
+    percussive_[k] = window_[1 + half];
+  }
+
+  // Time median: every bin swaps its oldest frame for this one. Bins are
+  // independent, so each rank is one pass over all bins.
+  float* oldest = history_.data() + static_cast<size_t>(next_) * bins;
+  std::fill(carry_.begin(), carry_.end(), -kInf);
+  for (int r = 0; r + 1 < timeFrames_; r++) {
+    float* rank = sorted_.data() + static_cast<size_t>(r) * bins;
+    const float* above = rank + bins;
+    for (int k = 0; k < bins; k++) {
+      float u = removed(rank[k], above[k], oldest[k]);
+      rank[k] = inserted(carry_[k], u, power[k]);
+      carry_[k] = u;
+    }
+  }
+  // The top rank has nothing above it
+  float* top = sorted_.data() + static_cast<size_t>(timeFrames_ - 1) * bins;
+  for (int k = 0; k < bins; k++) {
+    top[k] = inserted(carry_[k], removed(top[k], kInf, oldest[k]), power[k]);
+  }
+  std::copy(power, power + bins, oldest);
+  next_ = (next_ + 1) % timeFrames_;
+
+  // Medians of power are squared medians of magnitude, so this is the
+  // power-2 Wiener mask H^2 / (H^2 + P^2) on magnitudes
+  const float* harmonic = sorted_.data() + static_cast<size_t>(timeFrames_ / 2) * bins;
+  for (int k = 0; k < bins; k++) {
+    float total = harmonic[k] + percussive_[k];
+    mask[k] = total > 0.0f ? harmonic[k] / total : 0.0f;
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
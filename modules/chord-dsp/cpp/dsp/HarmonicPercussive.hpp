@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Median-filtering harmonic/percussive separation (Fitzgerald) on a stream
+// of power spectra. Harmonic partials are steady along time, strum and pick
+// transients are flat along frequency, so each bin is compared against a
+// running median over its last `timeFrames` frames and a median over its
+// `freqBins` neighbours in the current frame. The result is a soft
+// (Wiener, power 2) mask per bin rather than a second spectrum, so callers
+// split the FFT they already have. The time median is causal: a new chord
+// becomes harmonic about timeFrames / 2 frames after it starts.
+// All buffers are allocated up front; process() does not allocate.
+class HarmonicPercussive {
+public:
+  // Defaults suit hops of 512-1024 samples with a 2048-point FFT
+  static constexpr int kDefaultTimeFrames = 9;
+  static constexpr int kDefaultFreqBins = 17;
+
+  explicit HarmonicPercussive(int numBins, int timeFrames = kDefaultTimeFrames, int freqBins = kDefaultFreqBins);
+
+  int numBins() const { return numBins_; }
+
+  // Pushes one frame of numBins() power values and writes each bin's
+  // harmonic share in [0, 1]: the STFT splits into mask * X (harmonic) and
+  // (1 - mask) * X (percussive)
+  void process(const float* power, float* mask);
+  // Forgets past frames, as if only silence had been seen
+  void reset();
+
+private:
+  int numBins_;
+  int timeFrames_;
+  int freqBins_;
+
+  // Last timeFrames_ frames, slot-major, oldest at slot next_
+  std::vector<float> history_;
+  // The same values sorted per bin, rank-major ([rank][bin])
+  std::vector<float> sorted_;
+  int next_ = 0;
+  // Per-bin scratch for the time update and the frequency medians
+  std::vector<float> carry_;
+  std::vector<float> percussive_;
+  // Sorted sliding window across frequency with -inf / +inf sentinels, and
+  // the same window with one value removed
+  std::vector<float> window_;
+  std::vector<float> removed_;
+
+  // Moves the frequency window one bin: drops `old`, adds `value`
+  void slideWindow(float old, float value);
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,101 @@
+#include "KeyEstimator.hpp"
+#include <algorithm>
+#include <cmath>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// Krumhansl & Kessler (1982) probe-tone ratings, tonic first
+constexpr float kMajorProfile[12] = {6.35f, 2.23f, 3.48f, 2.33f, 4.38f, 4.09f, 2.52f, 5.19f, 2.39f, 3.66f, 2.29f, 2.88f};
+constexpr float kMinorProfile[12] = {6.33f, 2.68f, 3.52f, 5.38f, 2.60f, 3.53f, 2.54f, 4.75f, 3.98f, 2.69f, 3.34f, 3.17f};
+
+} // namespace
+
+KeyEstimator::KeyEstimator(float decay) : decay_(decay) {
+  for (int mode = 0; mode < 2; mode++) {
+    const float* profile = mode == 0 ? kMajorProfile : kMinorProfile;
+    float mean = 0.0f;
+    for (int i = 0; i < 12; i++) mean += profile[i];
+    mean /= 12.0f;
+    float norm = 0.0f;
+    for (int i = 0; i < 12; i++) norm += (profile[i] - mean) * (profile[i] - mean);
+    float scale = 1.0f / std::sqrt(norm);
+
+    for (int tonic = 0; tonic < 12; tonic++) {
+      int key = mode * 12 + tonic;
+      for (int pc = 0; pc < 12; pc++) {
+        profiles_[pc * kNumKeys + key] = (profile[(pc - tonic + 12) % 12] - mean) * scale;
+      }
+    }
+  }
+}
+
+KeyEstimator::Estimate KeyEstimator::estimate() const {
+  Estimate estimate;
+  estimate.key = key_.load(std::memory_order_relaxed);
+  estimate.correlation = correlation_.load(std::memory_order_relaxed);
+  estimate.margin = margin_.load(std::memory_order_relaxed);
+  return estimate;
+}
+
+void KeyEstimator::publish(const Estimate& estimate) {
+  key_.store(estimate.key, std::memory_order_relaxed);
+  correlation_.store(estimate.correlation, std::memory_order_relaxed);
+  margin_.store(estimate.margin, std::memory_order_relaxed);
+}
+
+void KeyEstimator::reset() {
+  std::fill(histogram_, histogram_ + 12, 0.0f);
+  std::fill(correlations_, correlations_ + kNumKeys, 0.0f);
+  publish(Estimate());
+}
+
+void KeyEstimator::update(const float* chroma, float weight) {
+  float mean = 0.0f;
+  for (int i = 0; i < 12; i++) {
+    histogram_[i] = histogram_[i] * decay_ + chroma[i] * weight;
+    mean += histogram_[i];
+  }
+  mean /= 12.0f;
+  float norm = 0.0f;
+  for (int i = 0; i < 12; i++) norm += (histogram_[i] - mean) * (histogram_[i] - mean);
+  if (norm <= 0.0f) return;
+
+  // The profile columns are centered, so the histogram's mean drops out
+#ifdef __APPLE__
+  // (1 x 12) * (12 x kNumKeys)
+  vDSP_mmul(histogram_, 1, profiles_, 1, correlations_, 1, 1, kNumKeys, 12);
+#else
+  std::fill(correlations_, correlations_ + kNumKeys, 0.0f);
+  for (int pc = 0; pc < 12; pc++) {
+    float h = histogram_[pc];
+    const float* row = profiles_ + pc * kNumKeys;
+    for (int k = 0; k < kNumKeys; k++) correlations_[k] += row[k] * h;
+  }
+#endif
+
+  float scale = 1.0f / std::sqrt(norm);
+  Estimate best;
+  best.correlation = -2.0f;
+  float second = -2.0f;
+  for (int k = 0; k < kNumKeys; k++) {
+    float r = correlations_[k] * scale;
+    correlations_[k] = r;
+    if (r > best.correlation) {
+      second = best.correlation;
+      best.correlation = r;
+      best.key = k;
+    } else if (r > second) {
+      second = r;
+    }
+  }
+  best.margin = best.correlation - second;
+  publish(best);
+}
+
+} // namespace margelo::nitro::chorddsp
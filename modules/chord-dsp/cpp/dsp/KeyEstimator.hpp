@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+
+namespace margelo::nitro::chorddsp {
+
+// Running musical key from an exponentially decayed chroma histogram. Each
+// update() decays the 12 sums by a fixed factor, adds one chroma frame, and
+// correlates the histogram with the 24 Krumhansl-Kessler key profiles in a
+// single 12 x 24 matrix-vector product. The profiles are centered and of
+// unit norm, so each product is a Pearson correlation once divided by the
+// norm of the centered histogram. The cost per frame is constant however
+// long the session runs.
+//
+// Keys are indexed mode * 12 + tonic, mode 0 major and 1 minor, tonic a
+// pitch class (0 = C), as chords are quality * 12 + root.
+class KeyEstimator {
+public:
+  static constexpr int kNumKeys = 24;
+
+  struct Estimate {
+    int key = -1; // -1 until a non-flat histogram was seen
+    float correlation = 0.0f;
+    // Correlation minus the runner-up's, a rough confidence
+    float margin = 0.0f;
+  };
+
+  // `decay` in (0, 1] multiplies the histogram before each frame
+  explicit KeyEstimator(float decay);
+
+  // Adds 12 chroma values with weight `weight`
+  void update(const float* chroma, float weight = 1.0f);
+  // Latest estimate; safe to read from any thread, though the fields of
+  // one read may come from two consecutive updates
+  Estimate estimate() const;
+  // Correlations of the last update() with all kNumKeys profiles
+  const float* correlations() const { return correlations_; }
+  void reset();
+
+  float decay() const { return decay_; }
+
+private:
+  float decay_;
+  float histogram_[12] = {};
+  float correlations_[kNumKeys] = {};
+  // profiles_[pc * kNumKeys + key], each key's column centered with unit norm
+  alignas(16) float profiles_[12 * kNumKeys];
+  std::atomic<int> key_{-1};
+  std::atomic<float> correlation_{0.0f};
+  std::atomic<float> margin_{0.0f};
+  void publish(const Estimate& estimate);
+};
+
+} // namespace margelo::nitro::chorddsp
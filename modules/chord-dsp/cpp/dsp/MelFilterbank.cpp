@@ -0,0 +1,147 @@
+#include "MelFilterbank.hpp"
+#include "DSPTables.hpp"
+#include <algorithm>
+#include <cmath>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+float MelFilterbank::hzToMel(float hz) {
+  return 2595.0f * std::log10(1.0f + hz / 700.0f);
+}
+
+float MelFilterbank::melToHz(float mel) {
+  return 700.0f * (std::pow(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+MelFilterbank::MelFilterbank(int numBands, int fftSize, int sampleRate, float minHz, float maxHz, bool usePrecomputed) : numBins_(fftSize / 2 + 1) {
+  if (usePrecomputed) {
+    if (const MelTable* table = findMelTable(numBands, fftSize, sampleRate, minHz, maxHz)) {
+      numBands_ = table->numBands;
+      numWeights_ = table->numWeights;
+      bands_ = table->bands;
+      weights_ = table->weights;
+      precomputed_ = true;
+      return;
+    }
+  }
+
+  float melMin = hzToMel(minHz);
+  float melMax = hzToMel(maxHz);
+
+  // Band edges in (fractional) FFT bins
+  std::vector<float> binFreqs(numBands + 2);
+  for (int i = 0; i < numBands + 2; i++) {
+    float mel = melMin + (melMax - melMin) * i / (numBands + 1);
+    binFreqs[i] = melToHz(mel) * fftSize / static_cast<float>(sampleRate);
+  }
+
+  ownedBands_.reserve(numBands);
+  std::vector<float> row(numBins_);
+
+  for (int m = 0; m < numBands; m++) {
+    float left = binFreqs[m];
+    float center = binFreqs[m + 1];
+    float right = binFreqs[m + 2];
+
+    int first = numBins_;
+    int last = -1;
+    for (int k = 0; k < numBins_; k++) {
+      float fk = static_cast<float>(k);
+      float w = 0.0f;
+      if (fk >= left && fk <= center && center > left) {
+        w = (fk - left) / (center - left);
+      } else if (fk > center && fk <= right && right > center) {
+        w = (right - fk) / (right - center);
+      }
+      row[k] = w;
+      if (w != 0.0f) {
+        first = std::min(first, k);
+        last = k;
+      }
+    }
+
+    Band band{0, 0, static_cast<int>(ownedWeights_.size())};
+    if (last >= first) {
+      band.start = first;
+      band.length = last - first + 1;
+      ownedWeights_.insert(ownedWeights_.end(), row.begin() + first, row.begin() + last + 1);
+    }
+    ownedBands_.push_back(band);
+  }
+
+  ownedWeights_.shrink_to_fit();
+  numBands_ = numBands;
+  numWeights_ = static_cast<int>(ownedWeights_.size());
+  bands_ = ownedBands_.data();
+  weights_ = ownedWeights_.data();
+}
+
+void MelFilterbank::apply(const float* power, float* bands) const {
+  const float* weights = weights_;
+  for (int m = 0; m < numBands_; m++) {
+    const Band& band = bands_[m];
+    float sum = 0.0f;
+#ifdef __APPLE__
+    vDSP_dotpr(power + band.start, 1, weights + band.offset, 1, &sum, band.length);
+#else
+    const float* p = power + band.start;
+    const float* w = weights + band.offset;
+    for (int k = 0; k < band.length; k++) {
+      sum += p[k] * w[k];
+    }
+#endif
+    bands[m] = sum;
+  }
+}
+
+void MelFilterbank::applyBatch(const float* power, int frames, float* bands) const {
+  const float* weights = weights_;
+  const int numBands = numBands_;
+  for (int m = 0; m < numBands; m++) {
+    const Band& band = bands_[m];
+    const float* p = power + band.start;
+    const float* w = weights + band.offset;
+#ifdef __APPLE__
+    if (band.length == 0) {
+      for (int f = 0; f < frames; f++) bands[f * numBands + m] = 0.0f;
+      continue;
+    }
+    // bands[f][m] = sum_k power[f][start + k] * w[k] for every frame at once
+    cblas_sgemv(CblasRowMajor, CblasNoTrans, frames, band.length, 1.0f, p, numBins_, w, 1, 0.0f, bands + m, numBands);
+#else
+    int f = 0;
+    for (; f + 4 <= frames; f += 4) {
+      const float* p0 = p + static_cast<size_t>(f) * numBins_;
+      const float* p1 = p0 + numBins_;
+      const float* p2 = p1 + numBins_;
+      const float* p3 = p2 + numBins_;
+      float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+      for (int k = 0; k < band.length; k++) {
+        float wk = w[k];
+        s0 += p0[k] * wk;
+        s1 += p1[k] * wk;
+        s2 += p2[k] * wk;
+        s3 += p3[k] * wk;
+      }
+      bands[f * numBands + m] = s0;
+      bands[(f + 1) * numBands + m] = s1;
+      bands[(f + 2) * numBands + m] = s2;
+      bands[(f + 3) * numBands + m] = s3;
+    }
+    for (; f < frames; f++) {
+      const float* pf = p + static_cast<size_t>(f) * numBins_;
+      float sum = 0.0f;
+      for (int k = 0; k < band.length; k++) {
+        sum += pf[k] * w[k];
+      }
+      bands[f * numBands + m] = sum;
+    }
+#endif
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
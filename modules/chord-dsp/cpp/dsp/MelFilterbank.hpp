@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Triangular mel filterbank stored sparsely: each band keeps only the span
+// of FFT bins where its weight is non-zero, and all spans share one flat
+// weight array. apply() touches roughly 2 * numBins() weights per frame
+// instead of numBands() * numBins(). Configurations in DSPTables point at
+// precomputed spans and weights instead of building them.
+class MelFilterbank {
+public:
+  struct Band {
+    int start;  // first FFT bin with a non-zero weight
+    int length; // number of contiguous bins
+    int offset; // index of the first weight in weights()
+  };
+
+  // usePrecomputed = false always computes the weights (the table generator)
+  MelFilterbank(int numBands, int fftSize, int sampleRate, float minHz, float maxHz, bool usePrecomputed = true);
+
+  MelFilterbank(const MelFilterbank&) = delete;
+  MelFilterbank& operator=(const MelFilterbank&) = delete;
+
+  int numBands() const { return numBands_; }
+  int numBins() const { return numBins_; }
+  // numBands() spans into weights(), which holds numWeights() values
+  const Band* bands() const { return bands_; }
+  const float* weights() const { return weights_; }
+  int numWeights() const { return numWeights_; }
+  // True when the spans and weights come from DSPTables
+  bool precomputed() const { return precomputed_; }
+
+  // bands[m] = sum_k power[k] * weight[m][k]; `power` holds numBins() values
+  void apply(const float* power, float* bands) const;
+
+  // apply() for `frames` spectra stored back to back (numBins() apart),
+  // writing frames * numBands() values frame by frame. Each band's weights
+  // are read once per batch: one strided sgemv per band on Apple, four
+  // frames per pass elsewhere, summed in the same order as apply().
+  void applyBatch(const float* power, int frames, float* bands) const;
+
+  static float hzToMel(float hz);
+  static float melToHz(float mel);
+
+private:
+  int numBins_;
+  int numBands_ = 0;
+  int numWeights_ = 0;
+  bool precomputed_ = false;
+  // Either the precomputed table or owned*_ below
+  const Band* bands_ = nullptr;
+  const float* weights_ = nullptr;
+
+  std::vector<Band> ownedBands_;
+  std::vector<float> ownedWeights_;
+};
+
+} // namespace margelo::nitro::chorddsp
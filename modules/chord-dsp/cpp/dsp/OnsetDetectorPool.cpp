@@ -0,0 +1,141 @@
+#include "OnsetDetectorPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// aubio_onset_t holds its own method plus at most 7 added ones
+constexpr size_t kMaxOnsetMethods = 8;
+
+// Spectral descriptors aubio_onset_t accepts, see new_aubio_specdesc()
+bool isOnsetMethod(const std::string& method) {
+  static const char* const kMethods[] = {"default", "energy", "hfc", "complex", "complexdomain", "phase", "wphase", "specdiff", "kl", "mkl", "specflux"};
+  for (const char* name : kMethods) {
+    if (method == name) return true;
+  }
+  return false;
+}
+
+} // namespace
+
+void validateOnsetParams(const OnsetParams& params, const char* caller) {
+  std::string prefix = std::string(caller) + ": ";
+  if (!std::isfinite(params.threshold) || params.threshold <= 0.0f) {
+    throw std::invalid_argument(prefix + "threshold must be finite and positive, got " + std::to_string(params.threshold));
+  }
+  if (!std::isfinite(params.silenceDb) || params.silenceDb > 0.0f) {
+    throw std::invalid_argument(prefix + "silenceDb must be finite and <= 0, got " + std::to_string(params.silenceDb));
+  }
+  if (!std::isfinite(params.minIoiMs) || params.minIoiMs < 0.0f) {
+    throw std::invalid_argument(prefix + "minIoiMs must be finite and >= 0, got " + std::to_string(params.minIoiMs));
+  }
+}
+
+void validateOnsetDescriptors(const std::vector<std::string>& methods, const std::vector<double>& weights, const char* caller) {
+  std::string prefix = std::string(caller) + ": ";
+  if (methods.empty() || methods.size() != weights.size()) {
+    throw std::invalid_argument(prefix + "need one weight per method and at least one method");
+  }
+  if (methods.size() > kMaxOnsetMethods) {
+    throw std::invalid_argument(prefix + "at most " + std::to_string(kMaxOnsetMethods) + " methods, got " + std::to_string(methods.size()));
+  }
+  for (size_t i = 0; i < methods.size(); i++) {
+    if (!isOnsetMethod(methods[i])) {
+      throw std::invalid_argument(prefix + "unknown onset method '" + methods[i] + "'");
+    }
+    if (!std::isfinite(weights[i]) || weights[i] < 0.0) {
+      throw std::invalid_argument(prefix + "weight for '" + methods[i] + "' must be finite and >= 0");
+    }
+  }
+}
+
+PooledOnset::PooledOnset(const OnsetConfig& config) : config_(config) {
+  onset_ = new_aubio_onset(config.methods[0].c_str(), config.bufferSize, config.hopSize, config.sampleRate);
+  if (!onset_) {
+    throw std::invalid_argument("onset: invalid bufferSize " + std::to_string(config.bufferSize) + " / hopSize " + std::to_string(config.hopSize) + " at " +
+                                std::to_string(config.sampleRate) + " Hz");
+  }
+  setParams(params_);
+  for (size_t i = 1; i < config.methods.size(); i++) {
+    aubio_onset_add_descriptor(onset_, config.methods[i].c_str(), static_cast<smpl_t>(config.weights[i]));
+  }
+  setWeights(config.weights);
+
+  input_ = new_fvec(config.hopSize);
+  output_ = new_fvec(1);
+  grain_ = new_cvec(config.bufferSize);
+}
+
+PooledOnset::~PooledOnset() {
+  if (onset_) del_aubio_onset(onset_);
+  if (input_) del_fvec(input_);
+  if (output_) del_fvec(output_);
+  if (grain_) del_cvec(grain_);
+}
+
+void PooledOnset::setWeights(const std::vector<double>& weights) {
+  config_.weights = weights;
+  for (size_t i = 0; i < weights.size(); i++) {
+    aubio_onset_set_descriptor_weight(onset_, static_cast<uint_t>(i), static_cast<smpl_t>(weights[i]));
+  }
+}
+
+void PooledOnset::setParams(const OnsetParams& params) {
+  params_ = params;
+  aubio_onset_set_threshold(onset_, params.threshold);
+  aubio_onset_set_silence(onset_, params.silenceDb);
+  aubio_onset_set_minioi_ms(onset_, params.minIoiMs);
+}
+
+void PooledOnset::reset() {
+  aubio_onset_reset(onset_);
+  fvec_zeros(input_);
+  fvec_zeros(output_);
+}
+
+void OnsetDetectorPool::Release::operator()(PooledOnset* onset) const {
+  OnsetDetectorPool::shared().release(onset);
+}
+
+OnsetDetectorPool& OnsetDetectorPool::shared() {
+  static OnsetDetectorPool pool;
+  return pool;
+}
+
+OnsetDetectorPool::Handle OnsetDetectorPool::acquire(const OnsetConfig& config) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(idle_.begin(), idle_.end(), [&](const auto& onset) { return onset->config().sameAllocation(config); });
+    if (it != idle_.end()) {
+      Handle handle((*it).release());
+      idle_.erase(it);
+      handle->setWeights(config.weights);
+      return handle;
+    }
+  }
+  return Handle(new PooledOnset(config));
+}
+
+void OnsetDetectorPool::reserve(const OnsetConfig& config, size_t count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t have = static_cast<size_t>(std::count_if(idle_.begin(), idle_.end(), [&](const auto& onset) { return onset->config().sameAllocation(config); }));
+  for (; have < count && idle_.size() < kMaxIdle; have++) {
+    idle_.push_back(std::make_unique<PooledOnset>(config));
+  }
+}
+
+void OnsetDetectorPool::release(PooledOnset* onset) {
+  std::unique_ptr<PooledOnset> owned(onset);
+  // Reset now so acquire() never does it under the lock or on the audio path
+  owned->reset();
+  owned->setParams(OnsetParams());
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (idle_.size() < kMaxIdle) {
+    idle_.push_back(std::move(owned));
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
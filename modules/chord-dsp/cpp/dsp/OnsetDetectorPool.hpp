@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// aubio types (real definitions, not forward declarations, to avoid
+// typedef conflicts with aubio's anonymous-struct fvec_t)
+extern "C" {
+#include "aubio/types.h"
+#include "aubio/fvec.h"
+#include "aubio/cvec.h"
+#include "aubio/onset/onset.h"
+}
+
+namespace margelo::nitro::chorddsp {
+
+// Everything that decides how an aubio onset detector is allocated. Weights
+// are not part of it: they are applied on every acquire.
+struct OnsetConfig {
+  uint_t sampleRate = 0;
+  uint_t bufferSize = 0;
+  uint_t hopSize = 0;
+  // First method is the detector's own, the rest are fused into it
+  std::vector<std::string> methods = {"default"};
+  std::vector<double> weights = {1.0};
+
+  bool sameAllocation(const OnsetConfig& other) const {
+    return sampleRate == other.sampleRate && bufferSize == other.bufferSize && hopSize == other.hopSize && methods == other.methods;
+  }
+};
+
+// Peak-picking settings aubio can change on a live detector without
+// reallocating it. Defaults are the app's.
+struct OnsetParams {
+  float threshold = 0.3f;  // peak picker threshold on the fused descriptor
+  float silenceDb = -40.0f; // hops quieter than this never trigger
+  float minIoiMs = 50.0f;   // minimum interval between onsets
+};
+
+// OnsetParams from the JS numbers
+inline OnsetParams onsetParams(double threshold, double silenceDb, double minIoiMs) {
+  return {static_cast<float>(threshold), static_cast<float>(silenceDb), static_cast<float>(minIoiMs)};
+}
+
+// Throws std::invalid_argument (prefixed with `caller`) unless threshold is
+// finite and positive, silenceDb finite and <= 0 and minIoiMs finite and >= 0
+void validateOnsetParams(const OnsetParams& params, const char* caller);
+
+// Throws std::invalid_argument (prefixed with `caller`) unless methods and
+// weights are non-empty, the same length, known aubio onset methods and
+// finite non-negative weights
+void validateOnsetDescriptors(const std::vector<std::string>& methods, const std::vector<double>& weights, const char* caller);
+
+// One aubio onset detector with its hop input, result and spectrum buffers,
+// set up with the default OnsetParams
+class PooledOnset {
+public:
+  explicit PooledOnset(const OnsetConfig& config);
+  ~PooledOnset();
+
+  PooledOnset(const PooledOnset&) = delete;
+  PooledOnset& operator=(const PooledOnset&) = delete;
+
+  const OnsetConfig& config() const { return config_; }
+  aubio_onset_t* onset() const { return onset_; }
+  fvec_t* input() const { return input_; }
+  fvec_t* output() const { return output_; }
+  // Spectrum for aubio_onset_do_spectrum(), bufferSize / 2 + 1 bins
+  cvec_t* grain() const { return grain_; }
+
+  void setWeights(const std::vector<double>& weights);
+  // Applies threshold, silence gate and minimum inter-onset interval. Only
+  // between hops: aubio reads them inside aubio_onset_do().
+  void setParams(const OnsetParams& params);
+  const OnsetParams& params() const { return params_; }
+  // Clears all state, as if newly allocated
+  void reset();
+
+  // Copies up to one hop into input(), zero-padding the rest
+  template <typename Sample>
+  void fillInput(const Sample* samples, size_t count) {
+    uint_t len = std::min(static_cast<uint_t>(count), config_.hopSize);
+    for (uint_t i = 0; i < len; i++) {
+      input_->data[i] = static_cast<smpl_t>(samples[i]);
+    }
+    for (uint_t i = len; i < config_.hopSize; i++) {
+      input_->data[i] = 0.0f;
+    }
+  }
+
+  // fillInput() then one aubio_onset_do()
+  template <typename Sample>
+  void process(const Sample* samples, size_t count) {
+    fillInput(samples, count);
+    aubio_onset_do(onset_, input_, output_);
+  }
+
+  bool isOnset() const { return output_->data[0] > 0.0f; }
+
+  // Values written by writeResult(): isOnset and the fused descriptor, then
+  // each descriptor's raw value when there are several (one descriptor
+  // keeps the two-value layout, its raw value being the fused one)
+  static size_t resultSize(size_t methods) { return methods > 1 ? 2 + methods : 2; }
+  size_t resultSize() const { return resultSize(config_.methods.size()); }
+
+  template <typename Out>
+  void writeResult(Out* result) const {
+    result[0] = isOnset() ? 1 : 0;
+    result[1] = static_cast<Out>(aubio_onset_get_descriptor(onset_));
+    if (config_.methods.size() < 2) return;
+    for (size_t i = 0; i < config_.methods.size(); i++) {
+      result[2 + i] = static_cast<Out>(aubio_onset_get_descriptor_value(onset_, static_cast<uint_t>(i)));
+    }
+  }
+
+private:
+  OnsetConfig config_;
+  OnsetParams params_;
+  aubio_onset_t* onset_ = nullptr;
+  fvec_t* input_ = nullptr;
+  fvec_t* output_ = nullptr;
+  cvec_t* grain_ = nullptr;
+};
+
+// Process-wide free list of onset detectors. acquire() hands out an idle
+// detector allocated for the same config (reset, with the new weights) and
+// only allocates when there is none; dropping the handle puts it back with
+// the default OnsetParams. This
+// keeps aubio's allocations off the audio path and lets any number of
+// streams hold their own detector.
+class OnsetDetectorPool {
+public:
+  struct Release {
+    void operator()(PooledOnset* onset) const;
+  };
+  using Handle = std::unique_ptr<PooledOnset, Release>;
+
+  static OnsetDetectorPool& shared();
+
+  Handle acquire(const OnsetConfig& config);
+  // Allocates idle detectors until `count` for this config are available
+  void reserve(const OnsetConfig& config, size_t count);
+
+private:
+  OnsetDetectorPool() = default;
+
+  void release(PooledOnset* onset);
+
+  // Idle detectors beyond this are freed on release
+  static constexpr size_t kMaxIdle = 16;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<PooledOnset>> idle_;
+};
+
+} // namespace margelo::nitro::chorddsp
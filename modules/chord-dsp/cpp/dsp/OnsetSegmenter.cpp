@@ -0,0 +1,44 @@
+#include "OnsetSegmenter.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+OnsetSegmenter::OnsetSegmenter(int minHops, int maxHops) : minHops_(minHops), maxHops_(maxHops) {
+  if (minHops < 1 || maxHops < minHops) {
+    throw std::invalid_argument("OnsetSegmenter: need 1 <= minHops <= maxHops, got " + std::to_string(minHops) + " and " + std::to_string(maxHops));
+  }
+}
+
+bool OnsetSegmenter::push(const float* frame, float* segment) {
+  constexpr int kOnset = ChordDSPCore::kAnalyzeFrameSize - 2;
+  constexpr int kDescriptor = ChordDSPCore::kAnalyzeFrameSize - 1;
+  bool onset = frame[kOnset] > 0.0f;
+
+  bool closed = hops_ > 0 && ((onset && hops_ >= minHops_) || hops_ >= maxHops_);
+  if (closed) {
+    std::copy(sum_, sum_ + ChordDSPCore::kChromaFrameSize, segment);
+    normalize(segment, 12, Normalization::Max);
+    normalize(segment + 12, 12, Normalization::Max);
+    segment[24] = static_cast<float>(hops_);
+    segment[25] = startedByOnset_ ? 1.0f : 0.0f;
+    segment[26] = startDescriptor_;
+    hops_ = 0;
+  }
+
+  if (hops_ == 0) {
+    std::fill(sum_, sum_ + ChordDSPCore::kChromaFrameSize, 0.0f);
+    startedByOnset_ = onset;
+    startDescriptor_ = frame[kDescriptor];
+  }
+  for (int i = 0; i < ChordDSPCore::kChromaFrameSize; i++) sum_[i] += frame[i];
+  hops_++;
+  return closed;
+}
+
+void OnsetSegmenter::reset() {
+  hops_ = 0;
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ChordDSPCore.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+// Onset-synchronous chroma: sums the per-hop chroma of analyzeFrame()
+// frames between consecutive onsets and emits one segment each time an
+// onset closes the running one, so chord decisions run per segment
+// instead of per hop. Only running sums are kept. An onset less than
+// minHops into a segment is merged into it (double triggers on one strum),
+// and a segment reaching maxHops is cut so sustained chords still update.
+class OnsetSegmenter {
+public:
+  // Segment layout: [chroma x12, bass chroma x12 (each max-normalized),
+  // hops, onset (1 if the segment began at an onset, 0 if it continues one
+  // cut at maxHops), onset descriptor of its first hop]
+  static constexpr int kSegmentSize = 27;
+
+  OnsetSegmenter(int minHops, int maxHops);
+
+  // Adds one analyzed hop (ChordDSPCore::analyzeFrame() layout). Returns
+  // true if this hop closed a segment, which is written into `segment`;
+  // the hop itself then starts the next one.
+  bool push(const float* frame, float* segment);
+  // Drops the running segment, e.g. on silence
+  void reset();
+
+  int minHops() const { return minHops_; }
+  int maxHops() const { return maxHops_; }
+
+private:
+  int minHops_;
+  int maxHops_;
+
+  int hops_ = 0;
+  bool startedByOnset_ = false;
+  float startDescriptor_ = 0.0f;
+  float sum_[ChordDSPCore::kChromaFrameSize] = {};
+};
+
+} // namespace margelo::nitro::chorddsp
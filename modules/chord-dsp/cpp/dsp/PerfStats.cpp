@@ -0,0 +1,76 @@
+#include "PerfStats.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+namespace margelo::nitro::chorddsp {
+
+uint64_t PerfStats::now() {
+  using namespace std::chrono;
+  return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+int PerfStats::bucketOf(uint64_t nanos) {
+  // Values below kSubBuckets get a bucket each; above that, each power of
+  // two is split into kSubBuckets equal buckets
+  if (nanos < static_cast<uint64_t>(kSubBuckets)) return static_cast<int>(nanos);
+  int msb = 63;
+  while (!(nanos >> msb)) msb--;
+  int sub = static_cast<int>((nanos >> (msb - 3)) & (kSubBuckets - 1));
+  return std::min((msb - 2) * kSubBuckets + sub, kNumBuckets - 1);
+}
+
+double PerfStats::bucketValue(int bucket) {
+  if (bucket < kSubBuckets) return static_cast<double>(bucket);
+  int shift = bucket / kSubBuckets - 1;
+  double width = std::ldexp(1.0, shift);
+  double low = (kSubBuckets + bucket % kSubBuckets) * width;
+  return low + width / 2.0;
+}
+
+void PerfStats::record(Stage stage, uint64_t nanos, uint32_t count) {
+  buckets_[stage][bucketOf(nanos)] += count;
+  counts_[stage] += count;
+}
+
+void PerfStats::reset() {
+  std::memset(buckets_, 0, sizeof(buckets_));
+  std::memset(counts_, 0, sizeof(counts_));
+  frames_ = 0;
+  inner_ = 0;
+}
+
+void PerfStats::merge(const PerfStats& other) {
+  for (int s = 0; s < kNumStages; s++) {
+    if (other.counts_[s] == 0) continue;
+    for (int b = 0; b < kNumBuckets; b++) buckets_[s][b] += other.buckets_[s][b];
+    counts_[s] += other.counts_[s];
+  }
+  frames_ += other.frames_;
+}
+
+double PerfStats::percentile(Stage stage, double q) const {
+  uint64_t total = counts_[stage];
+  if (total == 0) return 0.0;
+  uint64_t rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(total)));
+  rank = std::max<uint64_t>(rank, 1);
+
+  uint64_t seen = 0;
+  for (int b = 0; b < kNumBuckets; b++) {
+    seen += buckets_[stage][b];
+    if (seen >= rank) return bucketValue(b);
+  }
+  return bucketValue(kNumBuckets - 1);
+}
+
+double PerfStats::total(Stage stage) const {
+  if (counts_[stage] == 0) return 0.0;
+  double sum = 0.0;
+  for (int b = 0; b < kNumBuckets; b++) {
+    if (buckets_[stage][b] > 0) sum += bucketValue(b) * buckets_[stage][b];
+  }
+  return sum;
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::chorddsp {
+
+// Per-stage latency histograms for the analysis paths. Each stage keeps a
+// fixed log-linear histogram of monotonic-clock durations (8 buckets per
+// power of two from 1 ns to ~4 minutes, so percentiles are within ~6%), which
+// makes recording two clock reads and an increment with no allocation.
+// Not thread safe: one PerfStats belongs to one analyzer, like its scratch.
+class PerfStats {
+public:
+  enum Stage {
+    kStageResample,  // sample rate conversion of a whole buffer
+    kStageFFT,       // windowing plus forward FFT / power spectrum (whitening, spectral features), per frame
+    kStageChroma,    // harmonic separation, pitch class folding and normalization, per frame
+    kStageMel,       // mel filterbank and log, per frame (batches record their average)
+    kStageOnset,     // aubio onset detection, per hop
+    kStageConstantQ, // constant-Q transform and folding, per window
+    kStageBridge,    // time in a JS call outside the stages above: argument
+                     // views, result conversion and copies
+    kNumStages,
+  };
+
+  PerfStats() { reset(); }
+
+  // Monotonic nanoseconds
+  static uint64_t now();
+
+  // Records `count` samples of `nanos` each
+  void record(Stage stage, uint64_t nanos, uint32_t count = 1);
+  void addFrames(uint64_t n) { frames_ += n; }
+  void reset();
+
+  // Adds another thread's histograms and frames, for work split across a
+  // WorkerPool where each participant records into its own PerfStats
+  void merge(const PerfStats& other);
+  // Marks `nanos` of the enclosing Call as spent in stages (timed on other
+  // threads) so they are not booked as bridge time
+  void exclude(uint64_t nanos) { inner_ += nanos; }
+
+  // Analysis frames (FFT frames, onset hops, constant-Q windows) since reset()
+  uint64_t frames() const { return frames_; }
+  uint64_t count(Stage stage) const { return counts_[stage]; }
+  // Duration in nanoseconds at quantile q in [0, 1], 0 if nothing was recorded
+  double percentile(Stage stage, double q) const;
+  // Sum of the durations recorded into `stage` in nanoseconds, from the
+  // bucket midpoints (so within the same ~6%)
+  double total(Stage stage) const;
+
+  // Records the lifetime of the scope into `stage`; a scope covering a
+  // batch of `count` frames records its per-frame share `count` times
+  class Timer {
+  public:
+    Timer(PerfStats& stats, Stage stage, uint32_t count = 1) : stats_(stats), stage_(stage), count_(count), start_(now()) {}
+    ~Timer() {
+      uint64_t elapsed = now() - start_;
+      if (count_ > 0) stats_.record(stage_, elapsed / count_, count_);
+      stats_.inner_ += elapsed;
+    }
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+  private:
+    PerfStats& stats_;
+    Stage stage_;
+    uint32_t count_;
+    uint64_t start_;
+  };
+
+  // Wraps one JS call: records into kStageBridge whatever part of the call
+  // the Timers inside it did not account for
+  class Call {
+  public:
+    explicit Call(PerfStats& stats) : stats_(stats), start_(now()) { stats_.inner_ = 0; }
+    ~Call() {
+      uint64_t elapsed = now() - start_;
+      uint64_t inner = stats_.inner_;
+      stats_.record(kStageBridge, elapsed > inner ? elapsed - inner : 0);
+    }
+
+    Call(const Call&) = delete;
+    Call& operator=(const Call&) = delete;
+
+  private:
+    PerfStats& stats_;
+    uint64_t start_;
+  };
+
+private:
+  static constexpr int kSubBuckets = 8;
+  static constexpr int kOctaves = 36;
+  static constexpr int kNumBuckets = kOctaves * kSubBuckets;
+
+  static int bucketOf(uint64_t nanos);
+  // Midpoint of a bucket's range in nanoseconds
+  static double bucketValue(int bucket);
+
+  uint32_t buckets_[kNumStages][kNumBuckets];
+  uint64_t counts_[kNumStages];
+  uint64_t frames_ = 0;
+  // Timer time since the current Call started
+  uint64_t inner_ = 0;
+};
+
+} // namespace margelo::nitro::chorddsp
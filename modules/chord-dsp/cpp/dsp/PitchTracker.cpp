@@ -0,0 +1,157 @@
+#include "PitchTracker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+// aubio headers (both have their own extern "C" guards); mathutils.h is
+// not part of aubio.h
+#include "aubio/aubio.h"
+#include "aubio/mathutils.h"
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+int nextPowerOfTwo(int n) {
+  int size = 16;
+  while (size < n) size <<= 1;
+  return size;
+}
+
+} // namespace
+
+PitchTracker::PitchTracker(int sampleRate, int bufferSize, float threshold)
+    : sampleRate_(sampleRate), bufferSize_(bufferSize), window_(bufferSize / 2), threshold_(threshold) {
+  if (sampleRate < 1) {
+    throw std::invalid_argument("PitchTracker: sampleRate must be positive, got " + std::to_string(sampleRate));
+  }
+  if (bufferSize < 8) {
+    throw std::invalid_argument("PitchTracker: bufferSize must be at least 8, got " + std::to_string(bufferSize));
+  }
+
+  // x[i + tau] for i, tau < W stays below 2W <= bufferSize, so a circular
+  // correlation over bufferSize or more points never wraps
+  fft_ = std::make_unique<RealFFT>(nextPowerOfTwo(bufferSize));
+  size_t size = static_cast<size_t>(fft_->size());
+  size_t bins = static_cast<size_t>(fft_->numBins());
+  // The YIN curve, the padded buffer and four half spectra, each rounded up
+  // to a multiple of four floats
+  scratch_.reserve(static_cast<size_t>(window_) + size + 4 * bins + 6 * 4);
+}
+
+void PitchTracker::differenceFunction(const float* samples, float* yin, ScratchArena::Scope& scratch) {
+  int size = fft_->size();
+  int bins = fft_->numBins();
+  int w = window_;
+
+  float* padded = scratch.take(size);
+  float* xRe = scratch.take(bins);
+  float* xIm = scratch.take(bins);
+  float* wRe = scratch.take(bins);
+  float* wIm = scratch.take(bins);
+
+  // Spectra of the whole buffer and of its first W samples
+  std::copy(samples, samples + bufferSize_, padded);
+  std::fill(padded + bufferSize_, padded + size, 0.0f);
+  fft_->forward(padded, xRe, xIm);
+  std::fill(padded + w, padded + bufferSize_, 0.0f);
+  fft_->forward(padded, wRe, wIm);
+
+  // X * conj(W) is the transform of r(tau) = sum_{i<W} x[i] x[i+tau]
+  for (int k = 0; k < bins; k++) {
+    float re = xRe[k] * wRe[k] + xIm[k] * wIm[k];
+    float im = xIm[k] * wRe[k] - xRe[k] * wIm[k];
+    xRe[k] = re;
+    xIm[k] = im;
+  }
+  float* correlation = padded;
+  fft_->inverse(xRe, xIm, correlation);
+
+  // Energies in double: d(tau) is a small difference of large sums near the
+  // period of a clean tone
+  double e0 = 0.0;
+  for (int i = 0; i < w; i++) e0 += static_cast<double>(samples[i]) * samples[i];
+  double shifted = e0;
+
+  yin[0] = 1.0f;
+  double runningSum = 0.0;
+  for (int tau = 1; tau < w; tau++) {
+    double leaving = samples[tau - 1];
+    double entering = samples[tau - 1 + w];
+    shifted += entering * entering - leaving * leaving;
+    double d = std::max(e0 + shifted - 2.0 * correlation[tau], 0.0);
+    runningSum += d;
+    yin[tau] = runningSum > 0.0 ? static_cast<float>(d * tau / runningSum) : 1.0f;
+  }
+}
+
+PitchTracker::Result PitchTracker::detect(const float* samples) {
+  ScratchArena::Scope scratch(scratch_);
+  int w = window_;
+  float* yin = scratch.take(w);
+  differenceFunction(samples, yin, scratch);
+
+  // YIN step 4: the first dip under the threshold, followed to its minimum
+  int tau = 2;
+  for (; tau < w; tau++) {
+    if (yin[tau] < threshold_) {
+      while (tau + 1 < w && yin[tau + 1] < yin[tau]) tau++;
+      break;
+    }
+  }
+  Result result;
+  if (tau >= w || yin[tau] >= threshold_) return result;
+  float probability = 1.0f - yin[tau];
+  if (probability < kMinProbability) return result;
+
+  // Step 5: parabolic interpolation around the dip
+  fvec_t curve = {static_cast<uint_t>(w), yin};
+  float lag = fvec_quadratic_peak_pos(&curve, static_cast<uint_t>(tau));
+  if (lag <= 0.0f) return result;
+
+  result.frequency = static_cast<float>(sampleRate_) / lag;
+  result.probability = probability;
+  measurePeak(samples, result);
+  return result;
+}
+
+void PitchTracker::measurePeak(const float* samples, Result& result) const {
+  int n = bufferSize_;
+  int lag = static_cast<int>(std::lround(sampleRate_ / result.frequency));
+  if (lag < 1 || lag >= n) return;
+
+  auto correlate = [&](int shift, int count) {
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += static_cast<double>(samples[i]) * samples[i + shift];
+    return sum;
+  };
+  auto energy = [&](int offset, int count) {
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += static_cast<double>(samples[offset + i]) * samples[offset + i];
+    return sum;
+  };
+
+  double energyFirst = energy(0, n - lag);
+  double normalizer = std::sqrt(energyFirst * energy(lag, n - lag));
+  double peak = normalizer > 0.0 ? std::fabs(correlate(lag, n - lag)) / normalizer : 0.0;
+  result.autocorrPeak = static_cast<float>(peak);
+  result.confidence = static_cast<float>(std::min(peak, 1.0));
+
+  if (lag <= 1 || lag >= n - 2) return;
+
+  // Sharpness against the neighbouring lags: a sharp peak means a stable
+  // period. Both neighbours are summed over the shorter (lag + 1) overlap.
+  int overlap = n - lag - 1;
+  double normMinus = std::sqrt(energyFirst * energy(lag - 1, n - lag + 1));
+  double normPlus = std::sqrt(energyFirst * energy(lag + 1, overlap));
+  double peakMinus = normMinus > 0.0 ? std::fabs(correlate(lag - 1, overlap)) / normMinus : 0.0;
+  double peakPlus = normPlus > 0.0 ? std::fabs(correlate(lag + 1, overlap)) / normPlus : 0.0;
+
+  double sharpness = peak - (peakMinus + peakPlus) / 2.0;
+  double normalizedSharpness = std::clamp(sharpness / 0.1, 0.0, 1.0);
+  // 1% of the frequency for a flat peak down to 0.1% for a sharp one
+  result.jitter = static_cast<float>(result.frequency * (0.01 - 0.009 * normalizedSharpness));
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "RealFFT.hpp"
+#include "ScratchArena.hpp"
+#include <memory>
+
+namespace margelo::nitro::chorddsp {
+
+// Monophonic YIN pitch tracker for the tuner screens, the native
+// replacement for pitchfinder's YIN plus enhancePitchfinderResult() in
+// src/utils/enhancedPitchDetection.ts. The difference function comes from
+// three real FFTs instead of the O(N^2) lag loop: for a buffer of N samples
+// and lags below W = N / 2,
+//   d(tau) = sum_{i<W} x[i]^2 + sum_{i<W} x[i+tau]^2 - 2 sum_{i<W} x[i] x[i+tau]
+// with the cross term read off one inverse FFT. The chosen lag is refined
+// with aubio's fvec_quadratic_peak_pos(). Scratch comes from an arena
+// reserved at construction, so detect() does not allocate.
+class PitchTracker {
+public:
+  // pitchfinder's defaults
+  static constexpr float kDefaultThreshold = 0.1f;
+  static constexpr float kMinProbability = 0.1f;
+
+  struct Result {
+    // Hz, 0 when no lag passed the threshold
+    float frequency = 0.0f;
+    // 1 - cumulative mean normalized difference at the chosen lag
+    float probability = 0.0f;
+    // Normalized autocorrelation at round(sampleRate / frequency), in [0, 1]
+    float autocorrPeak = 0.0f;
+    // enhancePitchfinderResult()'s confidence: autocorrPeak capped at 1
+    float confidence = 0.0f;
+    // Frequency instability estimate in Hz from the autocorrelation peak's
+    // sharpness, 0.1% to 1% of frequency
+    float jitter = 0.0f;
+  };
+
+  PitchTracker(int sampleRate, int bufferSize, float threshold = kDefaultThreshold);
+
+  PitchTracker(const PitchTracker&) = delete;
+  PitchTracker& operator=(const PitchTracker&) = delete;
+
+  int sampleRate() const { return sampleRate_; }
+  int bufferSize() const { return bufferSize_; }
+  float threshold() const { return threshold_; }
+  void setThreshold(float threshold) { threshold_ = threshold; }
+
+  // Analyzes the bufferSize() samples at `samples`
+  Result detect(const float* samples);
+
+  uint64_t scratchAllocations() const { return scratch_.allocations(); }
+
+private:
+  // YIN steps 2-3: cumulative mean normalized difference for lags [0, W)
+  void differenceFunction(const float* samples, float* yin, ScratchArena::Scope& scratch);
+  // enhancePitchfinderResult()'s autocorrelation metrics around the lag of
+  // result.frequency
+  void measurePeak(const float* samples, Result& result) const;
+
+  int sampleRate_;
+  int bufferSize_;
+  // YIN window and lag range, bufferSize / 2
+  int window_;
+  float threshold_;
+
+  std::unique_ptr<RealFFT> fft_;
+  ScratchArena scratch_;
+};
+
+} // namespace margelo::nitro::chorddsp
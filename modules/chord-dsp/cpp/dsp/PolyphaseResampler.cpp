@@ -0,0 +1,161 @@
+#include "PolyphaseResampler.hpp"
+#include "DSPTables.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr double kKaiserBeta = 8.6;
+// Passband edge as a fraction of the lower of the two Nyquist frequencies
+constexpr double kRolloff = 0.94;
+
+// Zeroth-order modified Bessel function of the first kind (power series)
+double besselI0(double x) {
+  double sum = 1.0;
+  double term = 1.0;
+  double q = x * x / 4.0;
+  for (int k = 1; k < 50; k++) {
+    term *= q / (static_cast<double>(k) * k);
+    sum += term;
+    if (term < sum * 1e-12) break;
+  }
+  return sum;
+}
+
+} // namespace
+
+PolyphaseResampler::PolyphaseResampler(int sourceRate, int targetRate, bool usePrecomputed) : sourceRate_(sourceRate), targetRate_(targetRate) {
+  if (sourceRate <= 0 || targetRate <= 0) {
+    throw std::invalid_argument("PolyphaseResampler: sample rates must be positive, got " + std::to_string(sourceRate) + " -> " + std::to_string(targetRate));
+  }
+
+  int g = std::gcd(sourceRate, targetRate);
+  up_ = targetRate / g;
+  down_ = sourceRate / g;
+  if (up_ > kMaxPhases) {
+    down_ = std::max(1, static_cast<int>(std::lround(static_cast<double>(down_) * kMaxPhases / up_)));
+    up_ = kMaxPhases;
+  }
+  passthrough_ = up_ == down_;
+
+  const ResamplerTable* table = usePrecomputed && !passthrough_ ? findResamplerTable(sourceRate, targetRate) : nullptr;
+  if (table && table->up == up_ && table->down == down_ && table->taps == kTaps) {
+    taps_ = table->data;
+    precomputed_ = true;
+  } else if (!passthrough_) {
+    double cutoff = kRolloff * std::min(1.0, static_cast<double>(up_) / down_);
+    double half = kTaps / 2.0;
+    double i0Beta = besselI0(kKaiserBeta);
+
+    ownedTaps_.resize(static_cast<size_t>(up_) * kTaps);
+    for (int p = 0; p < up_; p++) {
+      float* row = ownedTaps_.data() + static_cast<size_t>(p) * kTaps;
+      double sum = 0.0;
+      for (int k = 0; k < kTaps; k++) {
+        // Distance in source samples from the output position to tap k
+        double x = (k - half + 1.0) - static_cast<double>(p) / up_;
+        double r = x / half;
+        double window = std::fabs(r) < 1.0 ? besselI0(kKaiserBeta * std::sqrt(1.0 - r * r)) / i0Beta : 0.0;
+        double arg = M_PI * cutoff * x;
+        double sinc = std::fabs(arg) < 1e-12 ? 1.0 : std::sin(arg) / arg;
+        row[k] = static_cast<float>(cutoff * sinc * window);
+        sum += row[k];
+      }
+      // Unity DC gain for every phase
+      for (int k = 0; k < kTaps; k++) row[k] = static_cast<float>(row[k] / sum);
+    }
+    taps_ = ownedTaps_.data();
+  }
+
+  reset();
+}
+
+void PolyphaseResampler::reset() {
+  // Leading silence so the first output's taps are all addressable
+  history_.assign(kTaps / 2 - 1, 0.0f);
+  historyStart_ = -(kTaps / 2 - 1);
+  samplesIn_ = 0;
+  base_ = 0;
+  phase_ = 0;
+  samplesOut_ = 0;
+}
+
+size_t PolyphaseResampler::outputLength(size_t count) const {
+  return static_cast<size_t>((static_cast<uint64_t>(count) * up_ + down_ - 1) / down_);
+}
+
+float PolyphaseResampler::dot(const float* x, const float* h) const {
+  float sum = 0.0f;
+#ifdef __APPLE__
+  vDSP_dotpr(x, 1, h, 1, &sum, kTaps);
+#else
+  for (int k = 0; k < kTaps; k++) {
+    sum += x[k] * h[k];
+  }
+#endif
+  return sum;
+}
+
+size_t PolyphaseResampler::produce(uint64_t available, std::vector<float>& out) {
+  size_t produced = 0;
+  int64_t end = static_cast<int64_t>(available);
+  while (base_ + kTaps / 2 < end) {
+    const float* x = history_.data() + (base_ - kTaps / 2 + 1 - historyStart_);
+    out.push_back(dot(x, taps_ + static_cast<size_t>(phase_) * kTaps));
+    produced++;
+
+    phase_ += down_;
+    base_ += phase_ / up_;
+    phase_ %= up_;
+  }
+  samplesOut_ += produced;
+
+  // Drop samples no later output can reach
+  int64_t keepFrom = std::min<int64_t>(base_ - kTaps / 2 + 1, historyStart_ + static_cast<int64_t>(history_.size()));
+  if (keepFrom > historyStart_) {
+    history_.erase(history_.begin(), history_.begin() + (keepFrom - historyStart_));
+    historyStart_ = keepFrom;
+  }
+  return produced;
+}
+
+size_t PolyphaseResampler::process(const float* input, size_t count, std::vector<float>& out) {
+  samplesIn_ += count;
+  if (passthrough_) {
+    out.insert(out.end(), input, input + count);
+    samplesOut_ += count;
+    return count;
+  }
+
+  history_.insert(history_.end(), input, input + count);
+  return produce(historyStart_ + static_cast<int64_t>(history_.size()), out);
+}
+
+size_t PolyphaseResampler::flush(std::vector<float>& out) {
+  size_t target = outputLength(static_cast<size_t>(samplesIn_));
+  size_t start = out.size();
+
+  if (!passthrough_ && samplesOut_ < target) {
+    // Pad with enough silence for every remaining output, then trim extras
+    size_t remaining = target - samplesOut_;
+    size_t padding = kTaps + (remaining * down_) / up_ + 1;
+    history_.insert(history_.end(), padding, 0.0f);
+    produce(historyStart_ + static_cast<int64_t>(history_.size()), out);
+    out.resize(start + remaining);
+  }
+
+  size_t flushed = out.size() - start;
+  reset();
+  return flushed;
+}
+
+} // namespace margelo::nitro::chorddsp
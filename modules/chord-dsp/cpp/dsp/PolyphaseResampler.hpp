@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Streaming rational-ratio resampler (upsample by L, low-pass, decimate by M)
+// using a Kaiser-windowed sinc split into L polyphase rows of kTaps
+// contiguous taps each. Filter history is carried across process() calls,
+// so a stream can be resampled chunk by chunk without re-processing overlap.
+//
+// Output sample j sits exactly at source position j * M / L, the same grid
+// as linear interpolation, so switching resamplers does not shift frames.
+// The filter is centered on that position, which means process() holds back
+// the outputs whose taps reach past the audio seen so far; flush() emits
+// them by treating the future as silence.
+//
+// Rate pairs in DSPTables use precomputed taps instead of designing the
+// filter.
+class PolyphaseResampler {
+public:
+  // usePrecomputed = false always designs the filter (the table generator)
+  PolyphaseResampler(int sourceRate, int targetRate, bool usePrecomputed = true);
+
+  PolyphaseResampler(const PolyphaseResampler&) = delete;
+  PolyphaseResampler& operator=(const PolyphaseResampler&) = delete;
+
+  int sourceRate() const { return sourceRate_; }
+  int targetRate() const { return targetRate_; }
+  // Reduced ratio actually used (see kMaxPhases)
+  int upFactor() const { return up_; }
+  int downFactor() const { return down_; }
+  // upFactor() rows of kTaps taps, null for a passthrough ratio
+  const float* taps() const { return taps_; }
+  bool precomputed() const { return precomputed_; }
+
+  // Appends the outputs completed by `count` new samples to `out`.
+  // `out` is only grown, so a reused buffer stops allocating once warm.
+  // Returns the number of samples appended.
+  size_t process(const float* input, size_t count, std::vector<float>& out);
+
+  // Emits the remaining outputs up to ceil(samplesIn * L / M) total and
+  // resets the stream. Returns the number of samples appended.
+  size_t flush(std::vector<float>& out);
+
+  void reset();
+
+  // Output length of a complete pass over `count` samples
+  size_t outputLength(size_t count) const;
+
+  static constexpr int kTaps = 32;
+  // Ratios whose reduced L exceeds this are approximated (rate error < 0.1%)
+  static constexpr int kMaxPhases = 512;
+
+private:
+  // Computes outputs while their taps end before `available`
+  size_t produce(uint64_t available, std::vector<float>& out);
+  float dot(const float* x, const float* h) const;
+
+  int sourceRate_;
+  int targetRate_;
+  int up_;
+  int down_;
+  bool passthrough_;
+
+  // up_ rows of kTaps taps: row p is the filter for fractional offset p / up_.
+  // Points into the precomputed table or at ownedTaps_.
+  const float* taps_ = nullptr;
+  std::vector<float> ownedTaps_;
+  bool precomputed_ = false;
+
+  // Source samples from absolute index historyStart_ on (index < 0 is silence)
+  std::vector<float> history_;
+  int64_t historyStart_;
+  uint64_t samplesIn_ = 0;
+
+  // Position of the next output: source index base_ plus phase_ / up_
+  int64_t base_ = 0;
+  int phase_ = 0;
+  uint64_t samplesOut_ = 0;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,179 @@
+#include "RealFFT.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#ifndef __APPLE__
+extern "C" {
+#include "aubio/types.h"
+#include "aubio/spectral/simd_fft.h"
+// Vendored Ooura FFT (aubio/spectral/ooura_fft8g.c)
+void aubio_ooura_rdft(int n, int isgn, smpl_t* a, int* ip, smpl_t* w);
+}
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+RealFFT::RealFFT(int size) : size_(size) {
+  if (size < 16 || (size & (size - 1)) != 0) {
+    throw std::invalid_argument("RealFFT: size must be a power of two >= 16, got " + std::to_string(size));
+  }
+
+#ifdef __APPLE__
+  log2n_ = static_cast<vDSP_Length>(std::log2(size));
+  setup_ = vDSP_create_fftsetup(log2n_, FFT_RADIX2);
+  realp_.resize(size / 2);
+  imagp_.resize(size / 2);
+#else
+  simd_ = new_aubio_simd_fft(static_cast<uint_t>(size));
+  if (simd_) {
+    work_.assign(size / 2 + 1, 0.0f);
+    im_.assign(size / 2 + 1, 0.0f);
+    return;
+  }
+  work_.assign(size, 0.0f);
+  ip_.assign(2 + static_cast<int>(std::sqrt(size / 2.0)) + 1, 0);
+  w_.assign(size / 2, 0.0f);
+  // Ooura builds its bit-reversal and twiddle tables on the first call
+  // (ip[0] == 0), so run one transform now instead of on the first frame.
+  aubio_ooura_rdft(size_, 1, work_.data(), ip_.data(), w_.data());
+  fixed_ = fixedRdft(size_);
+#endif
+}
+
+RealFFT::~RealFFT() {
+#ifdef __APPLE__
+  if (setup_) {
+    vDSP_destroy_fftsetup(setup_);
+    setup_ = nullptr;
+  }
+#else
+  if (simd_) {
+    del_aubio_simd_fft(simd_);
+    simd_ = nullptr;
+  }
+#endif
+}
+
+#ifndef __APPLE__
+void RealFFT::transform() {
+  if (fixed_) {
+    fixed_(work_.data(), w_.data());
+  } else {
+    aubio_ooura_rdft(size_, 1, work_.data(), ip_.data(), w_.data());
+  }
+}
+#endif
+
+void RealFFT::forward(const float* input, float* re, float* im) {
+  int half = size_ / 2;
+
+#ifdef __APPLE__
+  DSPSplitComplex split = {realp_.data(), imagp_.data()};
+  vDSP_ctoz(reinterpret_cast<const DSPComplex*>(input), 2, &split, 1, half);
+  vDSP_fft_zrip(setup_, &split, 1, log2n_, FFT_FORWARD);
+
+  // zrip packs Nyquist into imagp[0] and scales everything by 2
+  re[0] = realp_[0] * 0.5f;
+  im[0] = 0.0f;
+  re[half] = imagp_[0] * 0.5f;
+  im[half] = 0.0f;
+  for (int k = 1; k < half; k++) {
+    re[k] = realp_[k] * 0.5f;
+    im[k] = imagp_[k] * 0.5f;
+  }
+#else
+  if (simd_) {
+    aubio_simd_fft_forward(simd_, input, re, im);
+    return;
+  }
+  std::copy(input, input + size_, work_.begin());
+  transform();
+
+  // Ooura layout: [R0, R(N/2), R1, -I1, R2, -I2, ...]
+  re[0] = work_[0];
+  im[0] = 0.0f;
+  re[half] = work_[1];
+  im[half] = 0.0f;
+  for (int k = 1; k < half; k++) {
+    re[k] = work_[2 * k];
+    im[k] = -work_[2 * k + 1];
+  }
+#endif
+}
+
+void RealFFT::inverse(const float* re, const float* im, float* output) {
+  int half = size_ / 2;
+  float scale = 1.0f / static_cast<float>(size_);
+
+#ifdef __APPLE__
+  // zrip's packed layout again; its inverse scales by size()
+  realp_[0] = re[0];
+  imagp_[0] = re[half];
+  for (int k = 1; k < half; k++) {
+    realp_[k] = re[k];
+    imagp_[k] = im[k];
+  }
+  DSPSplitComplex split = {realp_.data(), imagp_.data()};
+  vDSP_fft_zrip(setup_, &split, 1, log2n_, FFT_INVERSE);
+  vDSP_ztoc(&split, 1, reinterpret_cast<DSPComplex*>(output), 2, half);
+  vDSP_vsmul(output, 1, &scale, output, 1, size_);
+#else
+  if (simd_) {
+    // Unscaled like Ooura's, but by size() rather than size() / 2
+    aubio_simd_fft_inverse(simd_, re, im, output);
+    for (int i = 0; i < size_; i++) output[i] *= scale;
+    return;
+  }
+  output[0] = re[0];
+  output[1] = re[half];
+  for (int k = 1; k < half; k++) {
+    output[2 * k] = re[k];
+    output[2 * k + 1] = -im[k];
+  }
+  // Ooura's backward rdft leaves size() / 2 times the signal
+  aubio_ooura_rdft(size_, -1, output, ip_.data(), w_.data());
+  scale *= 2.0f;
+  for (int i = 0; i < size_; i++) output[i] *= scale;
+#endif
+}
+
+void RealFFT::powerSpectrum(const float* input, float* power, float scale) {
+  int half = size_ / 2;
+
+#ifdef __APPLE__
+  DSPSplitComplex split = {realp_.data(), imagp_.data()};
+  vDSP_ctoz(reinterpret_cast<const DSPComplex*>(input), 2, &split, 1, half);
+  vDSP_fft_zrip(setup_, &split, 1, log2n_, FFT_FORWARD);
+
+  float nyquist = imagp_[0];
+  imagp_[0] = 0.0f;
+  vDSP_zvmags(&split, 1, power, 1, half);
+  power[half] = nyquist * nyquist;
+
+  // Undo zrip's factor of 2 (squared) while applying the caller's scale
+  float zripScale = scale * 0.25f;
+  vDSP_vsmul(power, 1, &zripScale, power, 1, half + 1);
+#else
+  if (simd_) {
+    aubio_simd_fft_forward(simd_, input, work_.data(), im_.data());
+    for (int k = 0; k <= half; k++) {
+      power[k] = scale * (work_[k] * work_[k] + im_[k] * im_[k]);
+    }
+    return;
+  }
+  std::copy(input, input + size_, work_.begin());
+  transform();
+
+  power[0] = scale * work_[0] * work_[0];
+  power[half] = scale * work_[1] * work_[1];
+  for (int k = 1; k < half; k++) {
+    float r = work_[2 * k];
+    float i = work_[2 * k + 1];
+    power[k] = scale * (r * r + i * i);
+  }
+#endif
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#else
+#include "FixedRealFFT.hpp"
+
+struct _aubio_simd_fft_t;
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+// Real FFT with a plan built once at construction.
+// vDSP on Apple platforms. Everywhere else the NEON/SSE2 transform from
+// aubio/spectral/simd_fft.h for sizes from 32 points up, and the vendored
+// Ooura rdft when that is unavailable (its compile-time specialization
+// from FixedRealFFT.hpp for 1024, 2048 and 4096 points, chosen once here).
+// Only the path in use is set up. Shipped NEON/SSE2 builds take the SIMD
+// one; Ooura serves builds without SIMD (AUBIO_NO_SIMD, which
+// chord_dsp_bench_scalar runs) and sizes below 32.
+class RealFFT {
+public:
+  explicit RealFFT(int size);
+  ~RealFFT();
+
+  RealFFT(const RealFFT&) = delete;
+  RealFFT& operator=(const RealFFT&) = delete;
+
+  int size() const { return size_; }
+  int numBins() const { return size_ / 2 + 1; }
+
+  // Unscaled DFT of `input` (size() samples) into re/im (numBins() each).
+  // The DC and Nyquist imaginary parts are always zero.
+  void forward(const float* input, float* re, float* im);
+
+  // Inverse of forward(): `output` (size() samples) is the signal whose
+  // spectrum is re/im, including the 1 / size() factor. im[0] and
+  // im[numBins() - 1] are ignored.
+  void inverse(const float* re, const float* im, float* output);
+
+  // power[k] = scale * |X[k]|^2 for k in [0, numBins())
+  void powerSpectrum(const float* input, float* power, float scale);
+
+private:
+  int size_;
+
+#ifdef __APPLE__
+  vDSP_Length log2n_;
+  FFTSetup setup_;
+  std::vector<float> realp_;
+  std::vector<float> imagp_;
+#else
+  // SIMD plan, or nullptr to fall back to Ooura
+  _aubio_simd_fft_t* simd_ = nullptr;
+  // Imaginary parts for powerSpectrum() on the SIMD path; work_ holds the
+  // real parts
+  std::vector<float> im_;
+  std::vector<float> work_;
+  // Ooura tables, empty on the SIMD path
+  std::vector<int> ip_;
+  std::vector<float> w_;
+  // Specialized kernel for size_, or nullptr to call aubio_ooura_rdft
+  FixedRdft fixed_ = nullptr;
+
+  // Ooura rdft of work_ in place
+  void transform();
+#endif
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,147 @@
+#include "ResonatorBank.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CHORD_DSP_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CHORD_DSP_SSE2 1
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+// States below this are flushed after each process() call, so a long
+// silence does not decay into denormals
+constexpr float kFlushLevel = 1e-30f;
+
+#ifdef CHORD_DSP_NEON
+using V4 = float32x4_t;
+inline V4 load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, V4 v) { vst1q_f32(p, v); }
+inline V4 splat(float x) { return vdupq_n_f32(x); }
+inline V4 add(V4 a, V4 b) { return vaddq_f32(a, b); }
+inline V4 sub(V4 a, V4 b) { return vsubq_f32(a, b); }
+inline V4 mul(V4 a, V4 b) { return vmulq_f32(a, b); }
+#elif defined(CHORD_DSP_SSE2)
+using V4 = __m128;
+inline V4 load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, V4 v) { _mm_storeu_ps(p, v); }
+inline V4 splat(float x) { return _mm_set1_ps(x); }
+inline V4 add(V4 a, V4 b) { return _mm_add_ps(a, b); }
+inline V4 sub(V4 a, V4 b) { return _mm_sub_ps(a, b); }
+inline V4 mul(V4 a, V4 b) { return _mm_mul_ps(a, b); }
+#endif
+
+} // namespace
+
+ResonatorBank::ResonatorBank(double sampleRate, const std::vector<double>& frequencies, float bandwidthCents)
+    : sampleRate_(sampleRate), count_(static_cast<int>(frequencies.size())), bandwidthCents_(bandwidthCents) {
+  if (!(sampleRate >= 1.0)) {
+    throw std::invalid_argument("ResonatorBank: sampleRate must be positive");
+  }
+  if (!(bandwidthCents > 0.0f && bandwidthCents <= 1200.0f)) {
+    throw std::invalid_argument("ResonatorBank: bandwidthCents must be in (0, 1200], got " + std::to_string(bandwidthCents));
+  }
+  double nyquist = sampleRate / 2.0;
+  for (size_t k = 0; k < frequencies.size(); k++) {
+    if (!(frequencies[k] > 0.0 && frequencies[k] < nyquist)) {
+      throw std::invalid_argument("ResonatorBank: frequency " + std::to_string(k) + " must be in (0, " + std::to_string(nyquist) + "), got " + std::to_string(frequencies[k]));
+    }
+  }
+
+  lanes_ = (count_ + kGroup - 1) / kGroup * kGroup;
+  poleRe_.assign(lanes_, 0.0f);
+  poleIm_.assign(lanes_, 0.0f);
+  re_.assign(lanes_, 0.0f);
+  im_.assign(lanes_, 0.0f);
+  gain_.assign(count_, 0.0f);
+
+  // The band spans bandwidthCents centered on the note
+  double spread = std::exp2(bandwidthCents / 2400.0) - std::exp2(-bandwidthCents / 2400.0);
+  for (int k = 0; k < count_; k++) {
+    double bandwidthHz = frequencies[k] * spread;
+    double radius = std::exp(-kPi * bandwidthHz / sampleRate);
+    double w = 2.0 * kPi * frequencies[k] / sampleRate;
+    poleRe_[k] = static_cast<float>(radius * std::cos(w));
+    poleIm_[k] = static_cast<float>(radius * std::sin(w));
+    gain_[k] = static_cast<float>(2.0 * (1.0 - radius));
+  }
+}
+
+double ResonatorBank::timeConstant(int k) const {
+  double radius = std::hypot(static_cast<double>(poleRe_[k]), static_cast<double>(poleIm_[k]));
+  return -1.0 / (sampleRate_ * std::log(radius));
+}
+
+void ResonatorBank::process(const float* samples, size_t count) {
+  if (count_ == 0 || count == 0) return;
+
+  // Each group of kGroup keeps its state in registers across the whole
+  // call; two independent vectors per sample hide the multiply-add latency
+  for (int k = 0; k < lanes_; k += kGroup) {
+#if defined(CHORD_DSP_NEON) || defined(CHORD_DSP_SSE2)
+    const V4 pr0 = load(&poleRe_[k]);
+    const V4 pi0 = load(&poleIm_[k]);
+    const V4 pr1 = load(&poleRe_[k + 4]);
+    const V4 pi1 = load(&poleIm_[k + 4]);
+    V4 re0 = load(&re_[k]);
+    V4 im0 = load(&im_[k]);
+    V4 re1 = load(&re_[k + 4]);
+    V4 im1 = load(&im_[k + 4]);
+    for (size_t n = 0; n < count; n++) {
+      V4 x = splat(samples[n]);
+      V4 nextRe0 = add(sub(mul(pr0, re0), mul(pi0, im0)), x);
+      V4 nextRe1 = add(sub(mul(pr1, re1), mul(pi1, im1)), x);
+      im0 = add(mul(pr0, im0), mul(pi0, re0));
+      im1 = add(mul(pr1, im1), mul(pi1, re1));
+      re0 = nextRe0;
+      re1 = nextRe1;
+    }
+    store(&re_[k], re0);
+    store(&im_[k], im0);
+    store(&re_[k + 4], re1);
+    store(&im_[k + 4], im1);
+#else
+    for (int lane = k; lane < k + kGroup; lane++) {
+      const float pr = poleRe_[lane];
+      const float pi = poleIm_[lane];
+      float re = re_[lane];
+      float im = im_[lane];
+      for (size_t n = 0; n < count; n++) {
+        float nextRe = pr * re - pi * im + samples[n];
+        im = pr * im + pi * re;
+        re = nextRe;
+      }
+      re_[lane] = re;
+      im_[lane] = im;
+    }
+#endif
+  }
+
+  for (int k = 0; k < count_; k++) {
+    if (std::fabs(re_[k]) < kFlushLevel && std::fabs(im_[k]) < kFlushLevel) {
+      re_[k] = 0.0f;
+      im_[k] = 0.0f;
+    }
+  }
+}
+
+void ResonatorBank::magnitudes(float* out) const {
+  for (int k = 0; k < count_; k++) {
+    out[k] = gain_[k] * std::sqrt(re_[k] * re_[k] + im_[k] * im_[k]);
+  }
+}
+
+void ResonatorBank::reset() {
+  std::fill(re_.begin(), re_.end(), 0.0f);
+  std::fill(im_.begin(), im_.end(), 0.0f);
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Energy at a few dozen known pitches without an FFT: one complex one-pole
+// resonator per note, the exponentially windowed form of the sliding DFT.
+// Each sample updates every resonator with one complex multiply-add,
+//   y[n] = r e^(i w) y[n-1] + x[n],
+// so the magnitudes are current after every sample instead of once per
+// 2048-sample window, and r < 1 keeps the recursion stable where a
+// rectangular sliding DFT slowly drifts. The pole radius sets each note's
+// bandwidth in cents, constant-Q like the notes: a window of
+// 1 / (pi * bandwidth) seconds, about 25 ms at A4 and 130 ms at the low E
+// string for the default 50 cents. Resonators run four to a register on
+// NEON and SSE2, two registers per loop.
+class ResonatorBank {
+public:
+  static constexpr float kDefaultBandwidthCents = 50.0f;
+
+  // Resonators at `frequencies` Hz, each below Nyquist, with
+  // `bandwidthCents` wide -3 dB bands; throws std::invalid_argument
+  ResonatorBank(double sampleRate, const std::vector<double>& frequencies, float bandwidthCents = kDefaultBandwidthCents);
+
+  ResonatorBank(const ResonatorBank&) = delete;
+  ResonatorBank& operator=(const ResonatorBank&) = delete;
+
+  double sampleRate() const { return sampleRate_; }
+  int size() const { return count_; }
+  float bandwidthCents() const { return bandwidthCents_; }
+  // Seconds for resonator k's response to fall to 1/e
+  double timeConstant(int k) const;
+
+  // Runs `count` mono samples through every resonator
+  void process(const float* samples, size_t count);
+  // Amplitude of a steady sinusoid at each resonator's pitch, size() values
+  void magnitudes(float* out) const;
+  // Clears every resonator, as for a new stream
+  void reset();
+
+private:
+  double sampleRate_;
+  int count_;
+  float bandwidthCents_;
+  // Resonators per inner loop, two registers of four
+  static constexpr int kGroup = 8;
+  // count_ rounded up to kGroup; the padding resonators stay at zero
+  int lanes_;
+  // Structure of arrays: pole and state per resonator
+  std::vector<float> poleRe_;
+  std::vector<float> poleIm_;
+  std::vector<float> re_;
+  std::vector<float> im_;
+  // 2 (1 - r): maps |y| to the amplitude of a tone at the pole's frequency
+  std::vector<float> gain_;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,67 @@
+#include "SampleRing.hpp"
+#include <algorithm>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+size_t nextPowerOfTwo(size_t n) {
+  size_t p = 1;
+  while (p < n) p <<= 1;
+  return p;
+}
+
+} // namespace
+
+SampleRing::SampleRing(size_t capacity) : buffer_(nextPowerOfTwo(std::max<size_t>(capacity, 1)), 0.0f), mask_(buffer_.size() - 1) {}
+
+void SampleRing::write(const float* samples, size_t count) {
+  size_t cap = buffer_.size();
+  uint64_t pos = written_.load(std::memory_order_relaxed);
+
+  if (count > cap) {
+    samples += count - cap;
+    pos += count - cap;
+    count = cap;
+  }
+
+  // Publish how far this write reaches before touching any slot, so a
+  // concurrent read() can tell whether its window was overwritten
+  reserved_.store(pos + count, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  size_t start = static_cast<size_t>(pos) & mask_;
+  size_t first = std::min(count, cap - start);
+  std::copy(samples, samples + first, buffer_.begin() + start);
+  std::copy(samples + first, samples + count, buffer_.begin());
+
+  written_.store(pos + count, std::memory_order_release);
+}
+
+bool SampleRing::read(uint64_t end, float* out, size_t count) const {
+  size_t cap = buffer_.size();
+  if (count > cap) return false;
+
+  // Leading positions before the start of the stream read as silence
+  size_t zeros = end < count ? static_cast<size_t>(count - end) : 0;
+  std::fill(out, out + zeros, 0.0f);
+  uint64_t begin = end - (count - zeros);
+
+  size_t n = count - zeros;
+  size_t start = static_cast<size_t>(begin) & mask_;
+  size_t first = std::min(n, cap - start);
+  std::copy(buffer_.begin() + start, buffer_.begin() + start + first, out + zeros);
+  std::copy(buffer_.begin(), buffer_.begin() + (n - first), out + zeros + first);
+
+  // The copy is valid only if the producer has not wrapped onto [begin, end)
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return reserved_.load(std::memory_order_relaxed) <= begin + cap;
+}
+
+void SampleRing::reset() {
+  std::fill(buffer_.begin(), buffer_.end(), 0.0f);
+  reserved_.store(0, std::memory_order_relaxed);
+  written_.store(0, std::memory_order_release);
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Single-producer / single-consumer history ring for audio samples.
+// The producer appends with write(); the consumer copies windows addressed
+// by absolute sample position (0 = first sample ever written). Neither side
+// blocks: only the producer advances the write position, and a read that was
+// overtaken by the producer is reported instead of returning torn data.
+class SampleRing {
+public:
+  // Capacity is rounded up to a power of two
+  explicit SampleRing(size_t capacity);
+
+  SampleRing(const SampleRing&) = delete;
+  SampleRing& operator=(const SampleRing&) = delete;
+
+  size_t capacity() const { return buffer_.size(); }
+
+  // Producer: appends samples. Chunks larger than capacity keep only the tail.
+  void write(const float* samples, size_t count);
+
+  // Producer: appends `count` samples that `fill(out, offset, n)` produces
+  // straight into the ring, samples [offset, offset + n) of the chunk per
+  // call, in at most two calls. As in write(), only the tail of a chunk
+  // larger than capacity is produced.
+  template <typename Fill>
+  void writeWith(size_t count, Fill&& fill);
+
+  // Total number of samples ever written (acquire: everything before the
+  // returned position is visible to the caller)
+  uint64_t written() const { return written_.load(std::memory_order_acquire); }
+
+  // Consumer: copies the `count` samples ending at absolute position `end`
+  // (which must not be past written()). Positions before the first sample
+  // read as zero. Returns false if the producer overwrote part of the window
+  // during the copy, in which case `out` must be discarded.
+  bool read(uint64_t end, float* out, size_t count) const;
+
+  // Clears the history. Not safe while the other side is active.
+  void reset();
+
+private:
+  std::vector<float> buffer_;
+  size_t mask_;
+  std::atomic<uint64_t> written_{0};
+  // End of the write in progress (>= written_)
+  std::atomic<uint64_t> reserved_{0};
+};
+
+template <typename Fill>
+void SampleRing::writeWith(size_t count, Fill&& fill) {
+  size_t cap = buffer_.size();
+  uint64_t pos = written_.load(std::memory_order_relaxed);
+
+  size_t skip = count > cap ? count - cap : 0;
+  pos += skip;
+  count -= skip;
+
+  // Same protocol as write()
+  reserved_.store(pos + count, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  size_t start = static_cast<size_t>(pos) & mask_;
+  size_t first = std::min(count, cap - start);
+  if (first > 0) fill(buffer_.data() + start, skip, first);
+  if (count > first) fill(buffer_.data(), skip + first, count - first);
+
+  written_.store(pos + count, std::memory_order_release);
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,49 @@
+#include "ScratchArena.hpp"
+#include <algorithm>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// Four floats, so buffers keep the block's 16-byte alignment for SIMD loads
+constexpr size_t kAlignFloats = 4;
+
+size_t roundUp(size_t count) {
+  return (count + kAlignFloats - 1) / kAlignFloats * kAlignFloats;
+}
+
+} // namespace
+
+void ScratchArena::reserve(size_t floats) {
+  floats = roundUp(floats);
+  if (floats > block_.size()) {
+    block_.resize(floats);
+  }
+  highWater_ = std::max(highWater_, floats);
+}
+
+float* ScratchArena::take(size_t count) {
+  count = roundUp(count);
+  size_t end = used_ + count;
+  highWater_ = std::max(highWater_, end);
+  used_ = end;
+  if (end <= block_.size()) {
+    return block_.data() + (end - count);
+  }
+  // Growing block_ would move buffers already handed out
+  overflow_.push_back(std::make_unique<float[]>(count));
+  allocations_++;
+  return overflow_.back().get();
+}
+
+void ScratchArena::rewind(size_t mark) {
+  used_ = mark;
+  if (--depth_ > 0) return;
+  if (!overflow_.empty()) {
+    overflow_.clear();
+    block_.resize(highWater_);
+    allocations_++;
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
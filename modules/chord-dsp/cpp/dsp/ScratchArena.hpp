@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Per-analyzer float scratch carved from one block that is sized up front.
+// A Scope hands out buffers in order and gives them all back when it ends,
+// so a frame's windowed input, spectrum and band buffers cost a pointer bump
+// instead of a malloc. A request the block cannot hold is served from a
+// separate chunk (earlier pointers stay valid) and the block grows to the
+// high-water mark once the outermost scope ends. allocations() counts both,
+// so it stays constant in steady state once reserve() covered the largest
+// frame.
+class ScratchArena {
+public:
+  ScratchArena() = default;
+
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+  // Grows the block to at least `floats`. Not counted by allocations().
+  void reserve(size_t floats);
+
+  size_t capacity() const { return block_.size(); }
+
+  // Heap allocations made since construction other than by reserve()
+  uint64_t allocations() const { return allocations_; }
+
+  class Scope {
+  public:
+    explicit Scope(ScratchArena& arena) : arena_(arena), mark_(arena.used_) { arena_.depth_++; }
+    ~Scope() { arena_.rewind(mark_); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    // `count` uninitialized floats, starting a multiple of four floats into
+    // the block (SIMD friendly), valid until the scope ends
+    float* take(size_t count) { return arena_.take(count); }
+
+  private:
+    ScratchArena& arena_;
+    size_t mark_;
+  };
+
+private:
+  float* take(size_t count);
+  void rewind(size_t mark);
+
+  std::vector<float> block_;
+  size_t used_ = 0;
+  // Live Scopes; the block only grows when the last one ends
+  int depth_ = 0;
+  // Chunks for requests that did not fit, freed when the outermost scope ends
+  std::vector<std::unique_ptr<float[]>> overflow_;
+  size_t highWater_ = 0;
+  uint64_t allocations_ = 0;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,72 @@
+#include "SharedBufferRegistry.hpp"
+#include "ChordDspSharedBuffer.h"
+
+namespace margelo::nitro::chorddsp {
+
+SharedBufferRegistry& SharedBufferRegistry::shared() {
+  static SharedBufferRegistry registry;
+  return registry;
+}
+
+int64_t SharedBufferRegistry::create(size_t size) {
+  Entry entry;
+  entry.data = std::make_unique<float[]>(size);
+  entry.size = size;
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t handle = nextHandle_++;
+  entries_.emplace(handle, std::move(entry));
+  return handle;
+}
+
+void SharedBufferRegistry::destroy(int64_t handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(handle);
+  if (it == entries_.end()) return;
+  if (it->second.retains > 0) {
+    it->second.destroyed = true;
+  } else {
+    entries_.erase(it);
+  }
+}
+
+float* SharedBufferRegistry::data(int64_t handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(handle);
+  return it == entries_.end() || it->second.destroyed ? nullptr : it->second.data.get();
+}
+
+bool SharedBufferRegistry::isRetained(int64_t handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(handle);
+  return it != entries_.end() && it->second.retains > 0;
+}
+
+float* SharedBufferRegistry::retain(int64_t handle, size_t* size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(handle);
+  if (it == entries_.end() || it->second.destroyed) return nullptr;
+  it->second.retains++;
+  if (size) *size = it->second.size;
+  return it->second.data.get();
+}
+
+void SharedBufferRegistry::release(int64_t handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(handle);
+  if (it == entries_.end() || it->second.retains == 0) return;
+  if (--it->second.retains == 0 && it->second.destroyed) {
+    entries_.erase(it);
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
+
+using margelo::nitro::chorddsp::SharedBufferRegistry;
+
+float* chord_dsp_shared_buffer_retain(int64_t handle, size_t* size) {
+  return SharedBufferRegistry::shared().retain(handle, size);
+}
+
+void chord_dsp_shared_buffer_release(int64_t handle) {
+  SharedBufferRegistry::shared().release(handle);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace margelo::nitro::chorddsp {
+
+// Process-wide float buffers addressed by a numeric handle, so native
+// modules can hand large results to each other while JS only passes the
+// handle (ChordDspSharedBuffer.h is the C side for consumers). The owner
+// creates and writes a buffer; consumers retain it while they read. The
+// owner must not write while isRetained(), and a buffer it destroys lives
+// on until the last release.
+class SharedBufferRegistry {
+public:
+  static SharedBufferRegistry& shared();
+
+  // Registers a zeroed buffer of `size` floats; data stays at the same address
+  int64_t create(size_t size);
+  // Owner's side: forgets the handle once no consumer retains it
+  void destroy(int64_t handle);
+  // Owner's side: data of a buffer it created and has not destroyed
+  float* data(int64_t handle);
+  bool isRetained(int64_t handle);
+
+  // Consumer's side, see ChordDspSharedBuffer.h
+  float* retain(int64_t handle, size_t* size);
+  void release(int64_t handle);
+
+private:
+  SharedBufferRegistry() = default;
+
+  struct Entry {
+    std::unique_ptr<float[]> data;
+    size_t size = 0;
+    int retains = 0;
+    bool destroyed = false;
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<int64_t, Entry> entries_;
+  // Handles start at 1 and are never reused; doubles hold them exactly
+  int64_t nextHandle_ = 1;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace margelo::nitro::chorddsp {
+
+// Hands the latest value of a small settings struct from one writer thread
+// to one reader thread without locks or allocation. The writer fills its
+// own back slot and swaps it with the shared middle one; the reader swaps
+// the middle one into its front slot only when it is fresh, at a point of
+// its choosing (a hop boundary). It is the double buffer that needs no
+// waiting on either side: each slot belongs to exactly one party at any
+// time, so neither ever sees a torn value, and intermediate values the
+// reader did not ask for in time are simply superseded.
+template <typename T>
+class SnapshotExchange {
+  static_assert(std::is_trivially_copyable_v<T>, "SnapshotExchange copies values with plain assignment");
+
+public:
+  SnapshotExchange() = default;
+  explicit SnapshotExchange(const T& initial) {
+    for (T& slot : slots_) slot = initial;
+  }
+
+  SnapshotExchange(const SnapshotExchange&) = delete;
+  SnapshotExchange& operator=(const SnapshotExchange&) = delete;
+
+  // Writer: makes `value` the one the next take() returns
+  void publish(const T& value) {
+    slots_[back_] = value;
+    back_ = state_.exchange(static_cast<uint8_t>(back_ | kFresh), std::memory_order_acq_rel) & kIndex;
+  }
+
+  // Reader: copies the latest published value into `out` and returns true
+  // if one arrived since the last take()
+  bool take(T& out) {
+    if (!(state_.load(std::memory_order_relaxed) & kFresh)) return false;
+    front_ = state_.exchange(front_, std::memory_order_acq_rel) & kIndex;
+    out = slots_[front_];
+    return true;
+  }
+
+private:
+  static constexpr uint8_t kIndex = 0x3;
+  static constexpr uint8_t kFresh = 0x4;
+
+  T slots_[3] = {};
+  // Middle slot index plus kFresh when the writer swapped it in after the
+  // reader's last take()
+  std::atomic<uint8_t> state_{1};
+  uint8_t back_ = 0;  // writer's
+  uint8_t front_ = 2; // reader's
+};
+
+} // namespace margelo::nitro::chorddsp
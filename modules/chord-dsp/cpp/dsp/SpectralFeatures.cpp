@@ -0,0 +1,240 @@
+#include "SpectralFeatures.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CHORD_DSP_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CHORD_DSP_SSE2 1
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr double kLn2 = 0.69314718055994530942;
+// Share of the energy below kRolloff, as in aubio
+constexpr double kRolloffShare = 0.95;
+// Power floor for the flatness logs, so one empty bin does not send the
+// geometric mean to zero
+constexpr float kPowerFloor = 1e-20f;
+
+// Exponent and mantissa bits of an IEEE float, for the flatness product
+constexpr int32_t kMantissaMask = 0x007fffff;
+constexpr int32_t kExponentOne = 0x3f800000;
+constexpr int kExponentShift = 23;
+constexpr int kExponentBias = 127;
+
+#ifdef CHORD_DSP_NEON
+using V4 = float32x4_t;
+using I4 = int32x4_t;
+inline V4 load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, V4 v) { vst1q_f32(p, v); }
+inline V4 splat(float x) { return vdupq_n_f32(x); }
+inline V4 add(V4 a, V4 b) { return vaddq_f32(a, b); }
+inline V4 sub(V4 a, V4 b) { return vsubq_f32(a, b); }
+inline V4 mul(V4 a, V4 b) { return vmulq_f32(a, b); }
+inline V4 max(V4 a, V4 b) { return vmaxq_f32(a, b); }
+inline V4 ramp() { static const float k[4] = {0.0f, 1.0f, 2.0f, 3.0f}; return vld1q_f32(k); }
+inline I4 zeroInt() { return vdupq_n_s32(0); }
+// Moves the biased exponent of `x` into `exponents` and leaves x in [1, 2)
+inline V4 splitExponent(V4 x, I4& exponents) {
+  I4 bits = vreinterpretq_s32_f32(x);
+  exponents = vaddq_s32(exponents, vshrq_n_s32(bits, kExponentShift));
+  bits = vorrq_s32(vandq_s32(bits, vdupq_n_s32(kMantissaMask)), vdupq_n_s32(kExponentOne));
+  return vreinterpretq_f32_s32(bits);
+}
+inline void storeInt(int32_t* p, I4 v) { vst1q_s32(p, v); }
+#elif defined(CHORD_DSP_SSE2)
+using V4 = __m128;
+using I4 = __m128i;
+inline V4 load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, V4 v) { _mm_storeu_ps(p, v); }
+inline V4 splat(float x) { return _mm_set1_ps(x); }
+inline V4 add(V4 a, V4 b) { return _mm_add_ps(a, b); }
+inline V4 sub(V4 a, V4 b) { return _mm_sub_ps(a, b); }
+inline V4 mul(V4 a, V4 b) { return _mm_mul_ps(a, b); }
+inline V4 max(V4 a, V4 b) { return _mm_max_ps(a, b); }
+inline V4 ramp() { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+inline I4 zeroInt() { return _mm_setzero_si128(); }
+inline V4 splitExponent(V4 x, I4& exponents) {
+  I4 bits = _mm_castps_si128(x);
+  exponents = _mm_add_epi32(exponents, _mm_srli_epi32(bits, kExponentShift));
+  bits = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(kMantissaMask)), _mm_set1_epi32(kExponentOne));
+  return _mm_castsi128_ps(bits);
+}
+inline void storeInt(int32_t* p, I4 v) { _mm_storeu_si128(reinterpret_cast<I4*>(p), v); }
+#endif
+
+#if defined(CHORD_DSP_NEON) || defined(CHORD_DSP_SSE2)
+constexpr int kLanes = 4;
+
+inline double sumLanes(V4 v) {
+  float lanes[kLanes];
+  store(lanes, v);
+  return static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+}
+#endif
+
+} // namespace
+
+SpectralFeatures::SpectralFeatures(int bins) : bins_(bins) {
+  if (bins < 2) {
+    throw std::invalid_argument("SpectralFeatures: bins must be at least 2, got " + std::to_string(bins));
+  }
+  double n = bins;
+  double sumSquares = 0.0;
+  harmonicSum_ = 0.0;
+  reciprocal_.assign(bins, 0.0f);
+  for (int k = 1; k < bins; k++) {
+    sumSquares += static_cast<double>(k) * k;
+    harmonicSum_ += 1.0 / k;
+    reciprocal_[k] = 1.0f / static_cast<float>(k);
+  }
+  double sum = n * (n - 1.0) / 2.0;
+  slopeNorm_ = n * sumSquares - sum * sum;
+  previous_.assign(bins, 0.0f);
+}
+
+void SpectralFeatures::reset() {
+  std::fill(previous_.begin(), previous_.end(), 0.0f);
+}
+
+void SpectralFeatures::compute(const float* magnitude, float* features) {
+  const int n = bins_;
+  float* previous = previous_.data();
+  const float* reciprocal = reciprocal_.data();
+
+  // Sweep 1: sum, index-weighted sum, energy, the decrease sum over 1 / k,
+  // flux and the flatness logs. The logs come from a running product of the
+  // powers whose exponent is moved into an integer count after every
+  // multiply, so what is left for std::log is one mantissa per lane.
+  double sum = 0.0, weighted = 0.0, energy = 0.0, decrease = 0.0, flux = 0.0, logSum = 0.0;
+  int k = 0;
+#if defined(CHORD_DSP_NEON) || defined(CHORD_DSP_SSE2)
+  {
+    V4 vSum = splat(0.0f), vWeighted = splat(0.0f), vEnergy = splat(0.0f), vDecrease = splat(0.0f), vFlux = splat(0.0f);
+    V4 product = splat(1.0f);
+    I4 exponents = zeroInt();
+    V4 index = ramp();
+    const V4 step = splat(static_cast<float>(kLanes));
+    const V4 zero = splat(0.0f);
+    const V4 floor = splat(kPowerFloor);
+    for (; k + kLanes <= n; k += kLanes) {
+      V4 m = load(magnitude + k);
+      V4 rise = sub(m, load(previous + k));
+      store(previous + k, m);
+      V4 power = mul(m, m);
+      vSum = add(vSum, m);
+      vWeighted = add(vWeighted, mul(index, m));
+      vEnergy = add(vEnergy, power);
+      vDecrease = add(vDecrease, mul(m, load(reciprocal + k)));
+      vFlux = add(vFlux, max(rise, zero));
+      product = splitExponent(mul(product, max(power, floor)), exponents);
+      index = add(index, step);
+    }
+    sum = sumLanes(vSum);
+    weighted = sumLanes(vWeighted);
+    energy = sumLanes(vEnergy);
+    decrease = sumLanes(vDecrease);
+    flux = sumLanes(vFlux);
+
+    float mantissas[kLanes];
+    int32_t biased[kLanes];
+    store(mantissas, product);
+    storeInt(biased, exponents);
+    int64_t exponentSum = -static_cast<int64_t>(kExponentBias) * (k / kLanes) * kLanes;
+    double mantissaLogs = 0.0;
+    for (int lane = 0; lane < kLanes; lane++) {
+      exponentSum += biased[lane];
+      mantissaLogs += std::log(static_cast<double>(mantissas[lane]));
+    }
+    logSum = static_cast<double>(exponentSum) * kLn2 + mantissaLogs;
+  }
+#endif
+  for (; k < n; k++) {
+    float m = magnitude[k];
+    float power = m * m;
+    sum += m;
+    weighted += static_cast<double>(k) * m;
+    energy += power;
+    decrease += static_cast<double>(m) * reciprocal[k];
+    flux += std::max(m - previous[k], 0.0f);
+    logSum += std::log(static_cast<double>(std::max(power, kPowerFloor)));
+    previous[k] = m;
+  }
+
+  std::fill(features, features + kNumFeatures, 0.0f);
+  features[kFlux] = static_cast<float>(flux);
+  if (sum == 0.0) {
+    return;
+  }
+
+  // Sweep 2: central moments around the centroid
+  double centroid = weighted / sum;
+  double m2 = 0.0, m3 = 0.0, m4 = 0.0;
+  k = 0;
+#if defined(CHORD_DSP_NEON) || defined(CHORD_DSP_SSE2)
+  {
+    V4 v2 = splat(0.0f), v3 = splat(0.0f), v4 = splat(0.0f);
+    V4 index = ramp();
+    const V4 step = splat(static_cast<float>(kLanes));
+    const V4 center = splat(static_cast<float>(centroid));
+    for (; k + kLanes <= n; k += kLanes) {
+      V4 d = sub(index, center);
+      V4 w = mul(mul(d, d), load(magnitude + k));
+      v2 = add(v2, w);
+      w = mul(w, d);
+      v3 = add(v3, w);
+      v4 = add(v4, mul(w, d));
+      index = add(index, step);
+    }
+    m2 = sumLanes(v2);
+    m3 = sumLanes(v3);
+    m4 = sumLanes(v4);
+  }
+#endif
+  for (; k < n; k++) {
+    double d = k - centroid;
+    double w = d * d * magnitude[k];
+    m2 += w;
+    m3 += w * d;
+    m4 += w * d * d;
+  }
+  double spread = m2 / sum;
+
+  features[kCentroid] = static_cast<float>(centroid);
+  features[kSpread] = static_cast<float>(spread);
+  if (spread > 0.0) {
+    features[kSkewness] = static_cast<float>(m3 / sum / std::pow(spread, 1.5));
+    features[kKurtosis] = static_cast<float>(m4 / sum / (spread * spread));
+  }
+  double bins = n;
+  features[kSlope] = static_cast<float>((bins * weighted - sum * bins * (bins - 1.0) / 2.0) / slopeNorm_ / sum);
+  double rest = sum - magnitude[0];
+  if (rest > 0.0) {
+    features[kDecrease] = static_cast<float>((decrease - magnitude[0] * harmonicSum_) / rest);
+  }
+
+  // Bins until the running energy reaches kRolloffShare of the total
+  double target = energy * kRolloffShare;
+  double running = 0.0;
+  int rolloff = 0;
+  while (running < target && rolloff < n) {
+    running += static_cast<double>(magnitude[rolloff]) * magnitude[rolloff];
+    rolloff++;
+  }
+  features[kRolloff] = static_cast<float>(rolloff);
+
+  double meanPower = energy / n;
+  if (meanPower > 0.0) {
+    features[kFlatness] = static_cast<float>(std::min(1.0, std::exp(logSum / n) / meanPower));
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
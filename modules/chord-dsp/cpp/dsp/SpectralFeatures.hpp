@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Shape of one magnitude spectrum for telling instruments from noise: the
+// seven descriptors of aubio/spectral/statistics.c plus specflux and
+// spectral flatness, fused. aubio runs each through its own specdesc
+// object, with its own passes over the spectrum (skewness and kurtosis
+// recompute the sum, the centroid and the spread); here one vector sweep
+// gathers the sums, flux and flatness, and a second one the central
+// moments, four bins per register on NEON and SSE2. Only the rolloff ends
+// with a short scalar scan, which stops at the 95% bin. The values match
+// aubio's definitions, in bins (bin k is k * sampleRate / fftSize Hz).
+class SpectralFeatures {
+public:
+  // Layout of compute()'s output
+  enum Feature {
+    kCentroid, // magnitude-weighted mean bin
+    kSpread,   // magnitude-weighted variance around it, in bins^2
+    kSkewness, // third standardized moment
+    kKurtosis, // fourth standardized moment
+    kSlope,    // least-squares slope of the magnitudes over the sum
+    kDecrease, // mean of (|X[k]| - |X[0]|) / k over the sum without DC
+    kRolloff,  // bins up to 95% of the energy
+    kFlux,     // summed magnitude rises since the last frame
+    kFlatness, // geometric over arithmetic mean of the power, 0 to 1
+    kNumFeatures,
+  };
+
+  // For spectra of `bins` magnitudes (fftSize / 2 + 1), at least 2
+  explicit SpectralFeatures(int bins);
+
+  SpectralFeatures(const SpectralFeatures&) = delete;
+  SpectralFeatures& operator=(const SpectralFeatures&) = delete;
+
+  int bins() const { return bins_; }
+
+  // Writes kNumFeatures values for `magnitude`, and keeps it for the next
+  // frame's flux. An all-zero spectrum gives zeros.
+  void compute(const float* magnitude, float* features);
+  // Forgets the previous frame, so the next flux counts from silence
+  void reset();
+
+private:
+  int bins_;
+  // kSlope's denominator: bins * sum(k^2) - sum(k)^2
+  double slopeNorm_;
+  // sum of 1 / k for k in [1, bins)
+  double harmonicSum_;
+  // 1 / k, with 0 for DC
+  std::vector<float> reciprocal_;
+  std::vector<float> previous_;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,30 @@
+#include "SpectralWhitening.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+SpectralWhitening::SpectralWhitening(int fftSize, int hopSize, int sampleRate)
+    : numBins_(fftSize / 2 + 1), hopSize_(hopSize), sampleRate_(sampleRate) {
+  whitening_ = new_aubio_spectral_whitening(static_cast<uint_t>(fftSize), static_cast<uint_t>(hopSize), static_cast<uint_t>(sampleRate));
+  if (!whitening_) {
+    throw std::invalid_argument("SpectralWhitening: invalid fftSize " + std::to_string(fftSize) + " / hopSize " + std::to_string(hopSize) + " at " +
+                                std::to_string(sampleRate) + " Hz");
+  }
+}
+
+SpectralWhitening::~SpectralWhitening() {
+  if (whitening_) del_aubio_spectral_whitening(whitening_);
+}
+
+void SpectralWhitening::process(float* magnitude) {
+  // aubio only reads and writes the norm of the grain
+  cvec_t grain = {static_cast<uint_t>(numBins_), magnitude, nullptr};
+  aubio_spectral_whitening_do(whitening_, &grain);
+}
+
+void SpectralWhitening::reset() {
+  aubio_spectral_whitening_reset(whitening_);
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,42 @@
+#pragma once
+
+// aubio types (real definitions, see OnsetDetectorPool.hpp)
+extern "C" {
+#include "aubio/types.h"
+#include "aubio/fvec.h"
+#include "aubio/cvec.h"
+#include "aubio/spectral/awhitening.h"
+}
+
+namespace margelo::nitro::chorddsp {
+
+// Owns one aubio adaptive spectral whitening state (awhitening.c, Stowell &
+// Plumbley): every bin is divided by a slowly decaying peak of its own past
+// magnitudes, floored, so each bin is measured against its recent maximum
+// and steady room noise and spectral tilt stop dominating. The decay is
+// per hop, so hopSize and sampleRate must match how often process() runs.
+class SpectralWhitening {
+public:
+  SpectralWhitening(int fftSize, int hopSize, int sampleRate);
+  ~SpectralWhitening();
+
+  SpectralWhitening(const SpectralWhitening&) = delete;
+  SpectralWhitening& operator=(const SpectralWhitening&) = delete;
+
+  int numBins() const { return numBins_; }
+  int hopSize() const { return hopSize_; }
+  int sampleRate() const { return sampleRate_; }
+
+  // Whitens numBins() unscaled magnitudes in place and updates the peaks
+  void process(float* magnitude);
+  // Forgets the peaks, as if only silence had been seen
+  void reset();
+
+private:
+  int numBins_;
+  int hopSize_;
+  int sampleRate_;
+  aubio_spectral_whitening_t* whitening_ = nullptr;
+};
+
+} // namespace margelo::nitro::chorddsp
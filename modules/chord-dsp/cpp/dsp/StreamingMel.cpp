@@ -0,0 +1,84 @@
+#include "StreamingMel.hpp"
+#include "VectorOps.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace margelo::nitro::chorddsp {
+
+StreamingMel::StreamingMel(double sourceRate, int targetRate, int fftSize, int hopSize, int numBands, float minHz, float maxHz, int maxFrames)
+    : fftSize_(fftSize),
+      hopSize_(hopSize),
+      maxFrames_(std::max(maxFrames, 1)),
+      plan_(fftSize, WindowType::Hann),
+      filterbank_(numBands, fftSize, targetRate, minHz, maxHz),
+      resampler_(static_cast<int>(std::lround(sourceRate)), targetRate),
+      windowed_(fftSize),
+      power_(static_cast<size_t>(kBatchFrames) * (fftSize / 2 + 1)),
+      bands_(static_cast<size_t>(kBatchFrames) * numBands),
+      frames_(static_cast<size_t>(maxFrames_) * numBands) {
+  frameInput_.reserve(fftSize + hopSize);
+}
+
+int StreamingMel::push(const float* samples, size_t count) {
+  resampler_.process(samples, count, frameInput_);
+
+  int bands = numBands();
+  int produced = 0;
+  size_t consumed = 0;
+  while (frameInput_.size() - consumed >= static_cast<size_t>(fftSize_)) {
+    // Frames that fit in one batch and in the cache before it wraps
+    size_t available = (frameInput_.size() - consumed - fftSize_) / hopSize_ + 1;
+    int slot = static_cast<int>(framesComputed_ % maxFrames_);
+    int frames = static_cast<int>(std::min<size_t>({available, static_cast<size_t>(kBatchFrames), static_cast<size_t>(maxFrames_ - slot)}));
+    computeFrames(frameInput_.data() + consumed, frames, frames_.data() + static_cast<size_t>(slot) * bands);
+    consumed += static_cast<size_t>(frames) * hopSize_;
+    framesComputed_ += frames;
+    produced += frames;
+  }
+  frameInput_.erase(frameInput_.begin(), frameInput_.begin() + static_cast<ptrdiff_t>(consumed));
+
+  return produced;
+}
+
+void StreamingMel::computeFrames(const float* audio, int frames, uint16_t* out) {
+  const std::vector<float>& window = plan_.window;
+  const int bins = fftSize_ / 2 + 1;
+  for (int f = 0; f < frames; f++) {
+    const float* frame = audio + static_cast<size_t>(f) * hopSize_;
+    for (int i = 0; i < fftSize_; i++) {
+      windowed_[i] = frame[i] * window[i];
+    }
+    // Same 2|X|^2 / N scale as ChordDSPCore's batch mel path
+    plan_.fft.powerSpectrum(windowed_.data(), power_.data() + static_cast<size_t>(f) * bins, 2.0f / fftSize_);
+  }
+
+  size_t values = static_cast<size_t>(frames) * numBands();
+  filterbank_.applyBatch(power_.data(), frames, bands_.data());
+  logFloor(bands_.data(), values, kLogFloor);
+  floatToHalf(bands_.data(), out, values);
+}
+
+void StreamingMel::latest(float* out, int frames) const {
+  int bands = numBands();
+  frames = std::min(frames, maxFrames_);
+  const float silence = std::log(kLogFloor);
+
+  for (int f = 0; f < frames; f++) {
+    int64_t index = static_cast<int64_t>(framesComputed_) - frames + f;
+    float* dst = out + static_cast<size_t>(f) * bands;
+    if (index < 0) {
+      std::fill(dst, dst + bands, silence);
+    } else {
+      const uint16_t* src = frames_.data() + (static_cast<uint64_t>(index) % maxFrames_) * bands;
+      halfToFloat(src, dst, bands);
+    }
+  }
+}
+
+void StreamingMel::reset() {
+  resampler_.reset();
+  frameInput_.clear();
+  framesComputed_ = 0;
+}
+
+} // namespace margelo::nitro::chorddsp
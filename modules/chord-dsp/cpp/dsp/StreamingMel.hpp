@@ -0,0 +1,71 @@
+#pragma once
+
+#include "FFTPlanCache.hpp"
+#include "MelFilterbank.hpp"
+#include "PolyphaseResampler.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Incremental log-mel spectrogram. push() resamples new audio to the target
+// rate (polyphase, filter state carried across calls), computes only the
+// frames it completes and stores them in a rolling cache of the last
+// maxFrames() frames, so the cost per push is proportional to the new audio.
+// The cache holds float16: half the memory of the window readMelWindow()
+// re-reads every call, converted once when a batch is stored and once per
+// read, while the FFT, filterbank and log stay float32. Log-mel values keep
+// an absolute error below 0.008 (half an ulp at 16-32).
+class StreamingMel {
+public:
+  StreamingMel(double sourceRate, int targetRate, int fftSize, int hopSize, int numBands, float minHz, float maxHz, int maxFrames);
+
+  int numBands() const { return filterbank_.numBands(); }
+  int maxFrames() const { return maxFrames_; }
+  // Frames computed since construction or reset()
+  uint64_t framesComputed() const { return framesComputed_; }
+
+  // Appends source-rate samples. Returns the number of new frames.
+  int push(const float* samples, size_t count);
+
+  // Writes the latest `frames` (<= maxFrames()) frames, oldest first, as
+  // frames * numBands() values. Frames not computed yet read as silence.
+  void latest(float* out, int frames) const;
+
+  void reset();
+
+  // log floor used for empty bands and missing frames
+  static constexpr float kLogFloor = 1e-10f;
+  // Most frames projected per MelFilterbank::applyBatch() call
+  static constexpr int kBatchFrames = 16;
+
+private:
+  // `frames` consecutive frames starting at `audio` into `frames` cache slots
+  void computeFrames(const float* audio, int frames, uint16_t* out);
+
+  int fftSize_;
+  int hopSize_;
+  int maxFrames_;
+
+  SpectrumPlan plan_;
+  MelFilterbank filterbank_;
+
+  PolyphaseResampler resampler_;
+
+  // Resampled audio not yet consumed by a full frame
+  std::vector<float> frameInput_;
+
+  std::vector<float> windowed_;
+  // Up to kBatchFrames stacked power spectra, and their log-mel bands
+  // before they go into the cache
+  std::vector<float> power_;
+  std::vector<float> bands_;
+
+  // Rolling cache of maxFrames_ frames as float16 bit patterns, indexed by
+  // framesComputed_ % maxFrames_
+  std::vector<uint16_t> frames_;
+  uint64_t framesComputed_ = 0;
+};
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,62 @@
+#include "TuningEstimator.hpp"
+#include <algorithm>
+#include <cmath>
+
+// aubio headers (both have their own extern "C" guards); mathutils.h is
+// not part of aubio.h
+#include "aubio/aubio.h"
+#include "aubio/mathutils.h"
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+constexpr double kTwoPi = 6.28318530717958647692;
+
+} // namespace
+
+TuningEstimator::TuningEstimator(float maxFreq) : maxFreq_(maxFreq) {
+  // Bin k spans 12 * log2((k + 1) / k) semitones
+  firstBin_ = static_cast<int>(std::ceil(1.0 / (std::exp2(kMaxBinSemitones / 12.0) - 1.0)));
+}
+
+void TuningEstimator::reset() {
+  re_ = 0.0;
+  im_ = 0.0;
+  offset_.store(0.0f, std::memory_order_relaxed);
+}
+
+void TuningEstimator::update(const float* power, int bins, double binHz) {
+  int first = firstBin_;
+  int last = std::min(static_cast<int>(maxFreq_ / binHz), bins - 2);
+  if (first > last) return;
+
+  float peak = *std::max_element(power + first, power + last + 1);
+  if (!(peak > 0.0f)) return;
+  float floor = peak * kPeakFloor;
+
+  re_ *= kDecay;
+  im_ *= kDecay;
+  for (int k = first; k <= last; k++) {
+    float p = power[k];
+    if (p < floor || p <= power[k - 1] || p < power[k + 1]) continue;
+
+    // Parabola through the three log powers around the maximum
+    float logs[3] = {std::log(std::max(power[k - 1], 1e-20f)), std::log(p), std::log(std::max(power[k + 1], 1e-20f))};
+    fvec_t around = {3, logs};
+    double position = k - 1 + fvec_quadratic_peak_pos(&around, 1);
+
+    double note = 69.0 + 12.0 * std::log2(position * binHz / 440.0);
+    double deviation = note - std::round(note);
+    double weight = std::sqrt(p);
+    re_ += weight * std::cos(kTwoPi * deviation);
+    im_ += weight * std::sin(kTwoPi * deviation);
+  }
+  if (re_ != 0.0 || im_ != 0.0) {
+    // atan2 is in (-pi, pi]; fold +0.5 to -0.5
+    float offset = static_cast<float>(std::atan2(im_, re_) / kTwoPi);
+    offset_.store(offset >= 0.5f ? offset - 1.0f : offset, std::memory_order_relaxed);
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+
+namespace margelo::nitro::chorddsp {
+
+// Running estimate of how far an instrument sits from A440, in semitones in
+// [-0.5, 0.5). Each update() takes the local maxima of one power spectrum,
+// refines their positions with aubio's fvec_quadratic_peak_pos() on log
+// power, and adds each peak's deviation from its nearest semitone as a
+// magnitude-weighted unit phasor, exp(2 pi i deviation), to exponentially
+// decaying sums; the estimate is the angle of the sum. The circular mean
+// keeps a quarter-tone-flat string and a quarter-tone-sharp one from
+// averaging to zero, and costs O(bins) per hop with no history.
+//
+// Only bins narrower than kMaxBinSemitones are read (bin index >= 69 for any
+// FFT size, ~540 Hz at 2048 points and 16 kHz), where a bin is fine enough
+// to place a peak within a few cents.
+class TuningEstimator {
+public:
+  static constexpr float kMaxBinSemitones = 0.25f;
+  // Peaks below this share of the frame's strongest one are ignored (-20 dB)
+  static constexpr float kPeakFloor = 0.01f;
+  // Per-update decay of the sums, ~2 s of hops at 64 ms
+  static constexpr float kDecay = 0.97f;
+
+  // Frequencies above maxFreq are ignored
+  explicit TuningEstimator(float maxFreq);
+
+  // Folds in one power spectrum of `bins` values spaced binHz apart
+  void update(const float* power, int bins, double binHz);
+  // Latest estimate in semitones, 0 until a peak was seen; safe to read
+  // from any thread
+  float offset() const { return offset_.load(std::memory_order_relaxed); }
+  void reset();
+
+private:
+  float maxFreq_;
+  int firstBin_;
+  double re_ = 0.0;
+  double im_ = 0.0;
+  std::atomic<float> offset_{0.0f};
+};
+
+} // namespace margelo::nitro::chorddsp
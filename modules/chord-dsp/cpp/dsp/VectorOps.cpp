@@ -0,0 +1,513 @@
+#include "VectorOps.hpp"
+#include "BiquadCascade.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __APPLE__
+#include <Accelerate/Accelerate.h>
+#else
+#include "aubio/simd.h" // aubio_v4_log() for logScaled()
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CHORD_DSP_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CHORD_DSP_SSE2 1
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+#endif
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// 10 / ln(10): log10(x) * 10 from a natural log
+constexpr float kDbPerNeper = 4.34294481903f;
+
+#if defined(CHORD_DSP_NEON) || defined(CHORD_DSP_SSE2)
+
+#ifdef CHORD_DSP_NEON
+using V4 = float32x4_t;
+inline V4 load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, V4 v) { vst1q_f32(p, v); }
+inline V4 set1(float x) { return vdupq_n_f32(x); }
+inline V4 add(V4 a, V4 b) { return vaddq_f32(a, b); }
+inline V4 sub(V4 a, V4 b) { return vsubq_f32(a, b); }
+inline V4 mul(V4 a, V4 b) { return vmulq_f32(a, b); }
+inline V4 max(V4 a, V4 b) { return vmaxq_f32(a, b); }
+inline V4 min(V4 a, V4 b) { return vminq_f32(a, b); }
+// Four mono samples, or the channel sums of four stereo frames, as floats
+inline V4 loadStereo(const float* p) {
+  float32x4x2_t lr = vld2q_f32(p);
+  return vaddq_f32(lr.val[0], lr.val[1]);
+}
+inline V4 loadInt16(const int16_t* p) { return vcvtq_f32_s32(vmovl_s16(vld1_s16(p))); }
+inline V4 loadStereo(const int16_t* p) {
+  int16x4x2_t lr = vld2_s16(p);
+  return vcvtq_f32_s32(vaddl_s16(lr.val[0], lr.val[1]));
+}
+inline V4 loadInt32(const int32_t* p) { return vcvtq_f32_s32(vld1q_s32(p)); }
+inline V4 loadStereo(const int32_t* p) {
+  int32x4x2_t lr = vld2q_s32(p);
+  return vaddq_f32(vcvtq_f32_s32(lr.val[0]), vcvtq_f32_s32(lr.val[1]));
+}
+#else
+using V4 = __m128;
+inline V4 load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, V4 v) { _mm_storeu_ps(p, v); }
+inline V4 set1(float x) { return _mm_set1_ps(x); }
+inline V4 add(V4 a, V4 b) { return _mm_add_ps(a, b); }
+inline V4 sub(V4 a, V4 b) { return _mm_sub_ps(a, b); }
+inline V4 mul(V4 a, V4 b) { return _mm_mul_ps(a, b); }
+inline V4 max(V4 a, V4 b) { return _mm_max_ps(a, b); }
+inline V4 min(V4 a, V4 b) { return _mm_min_ps(a, b); }
+// Left + right of four interleaved float pairs
+inline V4 addPairs(V4 a, V4 b) { return _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))); }
+inline V4 loadStereo(const float* p) { return addPairs(_mm_loadu_ps(p), _mm_loadu_ps(p + 4)); }
+inline V4 loadInt16(const int16_t* p) {
+  __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+  // Each sample into the upper half of a 32-bit lane, then sign-extend down
+  return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+}
+inline V4 loadStereo(const int16_t* p) {
+  // Multiply-add against ones: left + right per frame, exact in 32 bits
+  return _mm_cvtepi32_ps(_mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi16(1)));
+}
+inline V4 loadInt32(const int32_t* p) { return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+inline V4 loadStereo(const int32_t* p) { return addPairs(loadInt32(p), loadInt32(p + 4)); }
+#endif
+inline V4 loadMono(const float* p) { return load(p); }
+inline V4 loadMono(const int16_t* p) { return loadInt16(p); }
+inline V4 loadMono(const int32_t* p) { return loadInt32(p); }
+
+#endif
+
+#ifndef __APPLE__
+
+// values[i] = log(max(values[i], floor)) * scale, four at a time with
+// aubio's Cephes logf kernel (the one cvec_logmag uses) where it has one
+void logScaled(float* values, size_t count, float floor, float scale) {
+  size_t i = 0;
+#ifdef HAVE_AUBIO_SIMD
+  aubio_v4 vfloor = aubio_v4_set1(floor);
+  aubio_v4 vscale = aubio_v4_set1(scale);
+  for (; i + 4 <= count; i += 4) {
+    aubio_v4_store(values + i, aubio_v4_mul(aubio_v4_log(aubio_v4_max(aubio_v4_load(values + i), vfloor)), vscale));
+  }
+#endif
+  for (; i < count; i++) {
+    values[i] = std::log(std::max(values[i], floor)) * scale;
+  }
+}
+
+#endif
+
+constexpr float kInt16Scale = 1.0f / 32768.0f;
+constexpr float kInt32Scale = 1.0f / 2147483648.0f;
+
+// With a pre-filter, conditionPcm() converts, filters and clamps blocks of
+// this many frames in turn, each pass on data still in L1
+constexpr size_t kPcmBlock = 256;
+
+// out[f] = scale * sum of frame f's channels
+template <typename S>
+void sumScalar(const S* in, int channels, size_t frames, float scale, float* out) {
+  for (size_t f = 0; f < frames; f++) {
+    float sum = 0.0f;
+    for (int c = 0; c < channels; c++) sum += static_cast<float>(in[f * channels + c]);
+    out[f] = sum * scale;
+  }
+}
+
+void clampScalar(float* values, size_t count, PcmLevels& levels) {
+  double sumSquares = 0.0;
+  float peak = levels.peak;
+  for (size_t i = 0; i < count; i++) {
+    float x = std::max(-1.0f, std::min(1.0f, values[i]));
+    values[i] = x;
+    sumSquares += x * x;
+    peak = std::max(peak, std::fabs(x));
+  }
+  levels.sumSquares += sumSquares;
+  levels.peak = peak;
+}
+
+#ifdef __APPLE__
+
+inline void convertStrided(const float* in, vDSP_Stride stride, float* out, vDSP_Length n) { cblas_scopy(static_cast<int>(n), in, static_cast<int>(stride), out, 1); }
+inline void convertStrided(const int16_t* in, vDSP_Stride stride, float* out, vDSP_Length n) { vDSP_vflt16(in, stride, out, 1, n); }
+inline void convertStrided(const int32_t* in, vDSP_Stride stride, float* out, vDSP_Length n) { vDSP_vflt32(in, stride, out, 1, n); }
+
+// Strided conversion passes over L1-sized blocks: every channel is turned
+// into floats and added, then scaled, filtered, clipped and measured in
+// place
+template <typename S>
+void conditionFrames(const S* in, int channels, size_t frames, float scale, float* out, PcmLevels& levels, BiquadCascade* filter) {
+  const float lo = -1.0f;
+  const float hi = 1.0f;
+  float channel[kPcmBlock];
+  for (size_t f = 0; f < frames; f += kPcmBlock) {
+    vDSP_Length n = std::min<vDSP_Length>(kPcmBlock, frames - f);
+    const S* src = in + f * channels;
+    float* dst = out + f;
+    convertStrided(src, channels, dst, n);
+    for (int c = 1; c < channels; c++) {
+      convertStrided(src + c, channels, channel, n);
+      vDSP_vadd(dst, 1, channel, 1, dst, 1, n);
+    }
+    vDSP_vsmul(dst, 1, &scale, dst, 1, n);
+    if (filter) filter->process(dst, n);
+    vDSP_vclip(dst, 1, &lo, &hi, dst, 1, n);
+    float energy = 0.0f;
+    float peak = 0.0f;
+    vDSP_svesq(dst, 1, &energy, n);
+    vDSP_maxmgv(dst, 1, &peak, n);
+    levels.sumSquares += energy;
+    levels.peak = std::max(levels.peak, peak);
+  }
+}
+
+#elif defined(CHORD_DSP_NEON) || defined(CHORD_DSP_SSE2)
+
+// Channel sums of the four frames starting at p
+template <int Channels, typename S>
+inline V4 loadFrames(const S* p) {
+  if constexpr (Channels == 1) {
+    return loadMono(p);
+  } else {
+    return loadStereo(p);
+  }
+}
+
+// Clamps to [-1, 1] and adds the squares and magnitudes to the lane sums
+inline V4 clampAccumulate(V4 x, V4& sum, V4& peak) {
+  x = min(max(x, set1(-1.0f)), set1(1.0f));
+  sum = add(sum, mul(x, x));
+  peak = max(peak, max(x, sub(set1(0.0f), x)));
+  return x;
+}
+
+void addLanes(V4 sum, V4 peak, PcmLevels& levels) {
+  float sums[4];
+  float peaks[4];
+  store(sums, sum);
+  store(peaks, peak);
+  levels.sumSquares += (static_cast<double>(sums[0]) + sums[1]) + (static_cast<double>(sums[2]) + sums[3]);
+  levels.peak = std::max({levels.peak, peaks[0], peaks[1], peaks[2], peaks[3]});
+}
+
+// Four frames per step, loaded, scaled, clamped and measured in registers
+// on their way to `out`
+template <int Channels, typename S>
+void conditionSimd(const S* in, size_t frames, float scale, float* out, PcmLevels& levels) {
+  V4 vscale = set1(scale);
+  V4 sum = set1(0.0f);
+  V4 peak = set1(0.0f);
+  size_t f = 0;
+  for (; f + 4 <= frames; f += 4) {
+    store(out + f, clampAccumulate(mul(loadFrames<Channels>(in + f * Channels), vscale), sum, peak));
+  }
+  addLanes(sum, peak, levels);
+  sumScalar(in + f * Channels, Channels, frames - f, scale, out + f);
+  clampScalar(out + f, frames - f, levels);
+}
+
+// The same in kPcmBlock blocks, with the filter between scaling and clamping
+template <int Channels, typename S>
+void conditionSimdFiltered(const S* in, size_t frames, float scale, float* out, PcmLevels& levels, BiquadCascade& filter) {
+  V4 vscale = set1(scale);
+  for (size_t block = 0; block < frames; block += kPcmBlock) {
+    size_t n = std::min(kPcmBlock, frames - block);
+    const S* src = in + block * Channels;
+    float* dst = out + block;
+    size_t f = 0;
+    for (; f + 4 <= n; f += 4) store(dst + f, mul(loadFrames<Channels>(src + f * Channels), vscale));
+    sumScalar(src + f * Channels, Channels, n - f, scale, dst + f);
+
+    filter.process(dst, n);
+
+    V4 sum = set1(0.0f);
+    V4 peak = set1(0.0f);
+    for (f = 0; f + 4 <= n; f += 4) store(dst + f, clampAccumulate(load(dst + f), sum, peak));
+    addLanes(sum, peak, levels);
+    clampScalar(dst + f, n - f, levels);
+  }
+}
+
+template <typename S>
+void conditionFrames(const S* in, int channels, size_t frames, float scale, float* out, PcmLevels& levels, BiquadCascade* filter) {
+  if (channels == 1) {
+    filter ? conditionSimdFiltered<1>(in, frames, scale, out, levels, *filter) : conditionSimd<1>(in, frames, scale, out, levels);
+  } else if (channels == 2) {
+    filter ? conditionSimdFiltered<2>(in, frames, scale, out, levels, *filter) : conditionSimd<2>(in, frames, scale, out, levels);
+  } else {
+    for (size_t block = 0; block < frames; block += kPcmBlock) {
+      size_t n = std::min(kPcmBlock, frames - block);
+      sumScalar(in + block * channels, channels, n, scale, out + block);
+      if (filter) filter->process(out + block, n);
+      clampScalar(out + block, n, levels);
+    }
+  }
+}
+
+#else
+
+template <typename S>
+void conditionFrames(const S* in, int channels, size_t frames, float scale, float* out, PcmLevels& levels, BiquadCascade* filter) {
+  for (size_t block = 0; block < frames; block += kPcmBlock) {
+    size_t n = std::min(kPcmBlock, frames - block);
+    sumScalar(in + block * channels, channels, n, scale, out + block);
+    if (filter) filter->process(out + block, n);
+    clampScalar(out + block, n, levels);
+  }
+}
+
+#endif
+
+#ifndef __APPLE__
+
+uint32_t floatBits(float x) {
+  uint32_t bits;
+  std::memcpy(&bits, &x, sizeof bits);
+  return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+  float x;
+  std::memcpy(&x, &bits, sizeof x);
+  return x;
+}
+
+// Rounds to nearest even like the hardware conversions: normals round the
+// dropped 13 mantissa bits in integer arithmetic, subnormals let a float
+// addition do it against a magic constant
+uint16_t toHalf(float value) {
+  uint32_t bits = floatBits(value);
+  uint32_t sign = (bits >> 16) & 0x8000u;
+  bits &= 0x7fffffffu;
+  if (bits >= 0x47800000u) {
+    // 2^16 and up is out of range; NaNs stay quiet NaNs
+    return static_cast<uint16_t>(sign | (bits > 0x7f800000u ? 0x7e00u : 0x7c00u));
+  }
+  if (bits < 0x38800000u) {
+    // Below 2^-14: subnormal or zero
+    const uint32_t magic = 0x3f000000u; // 0.5, its ulp is the smallest half subnormal
+    return static_cast<uint16_t>(sign | (floatBits(bitsFloat(bits) + bitsFloat(magic)) - magic));
+  }
+  uint32_t odd = (bits >> 13) & 1u;
+  bits += 0xc8000fffu + odd; // rebias the exponent (-112 << 23), round half to even
+  return static_cast<uint16_t>(sign | (bits >> 13));
+}
+
+float fromHalf(uint16_t half) {
+  uint32_t bits = (half & 0x7fffu) << 13;
+  uint32_t exponent = bits & 0x0f800000u;
+  bits += 0x38000000u; // rebias the exponent (+112 << 23)
+  if (exponent == 0x0f800000u) {
+    bits += 0x38000000u; // infinity and NaN keep an all-ones exponent
+  } else if (exponent == 0) {
+    // Subnormal: renormalize through a float subtraction
+    bits = floatBits(bitsFloat(bits + 0x00800000u) - bitsFloat(0x38800000u));
+  }
+  return bitsFloat(bits | static_cast<uint32_t>(half & 0x8000u) << 16);
+}
+
+#endif
+
+} // namespace
+
+size_t pcmSampleBytes(PcmFormat format) {
+  switch (format) {
+    case PcmFormat::Float32:
+      return sizeof(float);
+    case PcmFormat::Int16:
+      return sizeof(int16_t);
+    case PcmFormat::Int32:
+      return sizeof(int32_t);
+  }
+  return sizeof(float);
+}
+
+void conditionPcm(const void* in, PcmFormat format, int channels, size_t frames, float gain, float* out, PcmLevels& levels, BiquadCascade* filter) {
+  if (frames == 0) return;
+  if (filter && filter->sections() == 0) filter = nullptr;
+  // Full scale and the channel mean folded into the gain
+  float scale = gain / static_cast<float>(channels);
+  switch (format) {
+    case PcmFormat::Float32:
+      conditionFrames(static_cast<const float*>(in), channels, frames, scale, out, levels, filter);
+      break;
+    case PcmFormat::Int16:
+      conditionFrames(static_cast<const int16_t*>(in), channels, frames, scale * kInt16Scale, out, levels, filter);
+      break;
+    case PcmFormat::Int32:
+      conditionFrames(static_cast<const int32_t*>(in), channels, frames, scale * kInt32Scale, out, levels, filter);
+      break;
+  }
+}
+
+void clampMin(float* values, size_t count, float floor) {
+#ifdef __APPLE__
+  vDSP_vthr(values, 1, &floor, values, 1, count);
+#else
+  for (size_t i = 0; i < count; i++) values[i] = std::max(values[i], floor);
+#endif
+}
+
+void logFloor(float* values, size_t count, float floor) {
+#ifdef __APPLE__
+  vDSP_vthr(values, 1, &floor, values, 1, count);
+  int n = static_cast<int>(count);
+  vvlogf(values, values, &n);
+#else
+  logScaled(values, count, floor, 1.0f);
+#endif
+}
+
+void powerToDb(float* values, size_t count, float floor) {
+#ifdef __APPLE__
+  // vDSP_vdbcon with flag 0: 10 * log10(values / reference)
+  const float reference = 1.0f;
+  vDSP_vthr(values, 1, &floor, values, 1, count);
+  vDSP_vdbcon(values, 1, &reference, values, 1, count, 0);
+#else
+  logScaled(values, count, floor, kDbPerNeper);
+#endif
+}
+
+void applyMelScale(float* values, size_t count, float floor, MelScale scale) {
+  switch (scale) {
+    case MelScale::Log:
+      logFloor(values, count, floor);
+      break;
+    case MelScale::Decibel:
+      powerToDb(values, count, floor);
+      break;
+    case MelScale::Power:
+      clampMin(values, count, floor);
+      break;
+  }
+}
+
+void normalize(float* values, size_t count, Normalization mode) {
+  if (count == 0 || mode == Normalization::None) return;
+
+  float divisor = 0.0f;
+#ifdef __APPLE__
+  switch (mode) {
+    case Normalization::Max:
+      vDSP_maxv(values, 1, &divisor, count);
+      break;
+    case Normalization::L1:
+      vDSP_svemg(values, 1, &divisor, count);
+      break;
+    case Normalization::L2:
+      vDSP_svesq(values, 1, &divisor, count);
+      divisor = std::sqrt(divisor);
+      break;
+    case Normalization::None:
+      break;
+  }
+  if (divisor > 0.0f) {
+    vDSP_vsdiv(values, 1, &divisor, values, 1, count);
+  }
+#else
+  // Four partial reductions, independent of lane width
+  float acc[4] = {};
+  size_t i = 0;
+  switch (mode) {
+    case Normalization::Max:
+      acc[0] = acc[1] = acc[2] = acc[3] = values[0];
+      for (; i + 4 <= count; i += 4) {
+        for (int l = 0; l < 4; l++) acc[l] = std::max(acc[l], values[i + l]);
+      }
+      for (; i < count; i++) acc[0] = std::max(acc[0], values[i]);
+      divisor = std::max(std::max(acc[0], acc[1]), std::max(acc[2], acc[3]));
+      break;
+    case Normalization::L1:
+      for (; i + 4 <= count; i += 4) {
+        for (int l = 0; l < 4; l++) acc[l] += std::fabs(values[i + l]);
+      }
+      for (; i < count; i++) acc[0] += std::fabs(values[i]);
+      divisor = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+      break;
+    case Normalization::L2:
+      for (; i + 4 <= count; i += 4) {
+        for (int l = 0; l < 4; l++) acc[l] += values[i + l] * values[i + l];
+      }
+      for (; i < count; i++) acc[0] += values[i] * values[i];
+      divisor = std::sqrt((acc[0] + acc[1]) + (acc[2] + acc[3]));
+      break;
+    case Normalization::None:
+      break;
+  }
+  if (divisor > 0.0f) {
+    for (size_t k = 0; k < count; k++) values[k] /= divisor;
+  }
+#endif
+}
+
+void floatToHalf(const float* in, uint16_t* out, size_t count) {
+  if (count == 0) return;
+#ifdef __APPLE__
+  vImage_Buffer src = {const_cast<float*>(in), 1, count, count * sizeof(float)};
+  vImage_Buffer dst = {out, 1, count, count * sizeof(uint16_t)};
+  vImageConvert_PlanarFtoPlanar16F(&src, &dst, kvImageNoFlags);
+#else
+  size_t i = 0;
+#if defined(CHORD_DSP_NEON) && defined(__aarch64__)
+  for (; i + 4 <= count; i += 4) {
+    vst1_u16(out + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(in + i))));
+  }
+#elif defined(__F16C__)
+  for (; i + 4 <= count; i += 4) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_cvtps_ph(_mm_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+#endif
+  for (; i < count; i++) out[i] = toHalf(in[i]);
+#endif
+}
+
+void halfToFloat(const uint16_t* in, float* out, size_t count) {
+  if (count == 0) return;
+#ifdef __APPLE__
+  vImage_Buffer src = {const_cast<uint16_t*>(in), 1, count, count * sizeof(uint16_t)};
+  vImage_Buffer dst = {out, 1, count, count * sizeof(float)};
+  vImageConvert_Planar16FtoPlanarF(&src, &dst, kvImageNoFlags);
+#else
+  size_t i = 0;
+#if defined(CHORD_DSP_NEON) && defined(__aarch64__)
+  for (; i + 4 <= count; i += 4) {
+    vst1q_f32(out + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(in + i))));
+  }
+#elif defined(__F16C__)
+  for (; i + 4 <= count; i += 4) {
+    _mm_storeu_ps(out + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i))));
+  }
+#elif defined(CHORD_DSP_SSE2)
+  // fromHalf() four lanes at a time, the branches as masks
+  const __m128i exponentMask = _mm_set1_epi32(0x0f800000);
+  const __m128i rebias = _mm_set1_epi32(0x38000000);
+  const __m128 subnormalBias = _mm_castsi128_ps(_mm_set1_epi32(0x38800000));
+  for (; i + 4 <= count; i += 4) {
+    __m128i half = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)), _mm_setzero_si128());
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16);
+    __m128i bits = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x7fff)), 13);
+    __m128i exponent = _mm_and_si128(bits, exponentMask);
+    bits = _mm_add_epi32(bits, rebias);
+    bits = _mm_add_epi32(bits, _mm_and_si128(_mm_cmpeq_epi32(exponent, exponentMask), rebias));
+    __m128i subnormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+    __m128i renormalized = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(0x00800000))), subnormalBias));
+    bits = _mm_or_si128(_mm_and_si128(subnormal, renormalized), _mm_andnot_si128(subnormal, bits));
+    _mm_storeu_ps(out + i, _mm_castsi128_ps(_mm_or_si128(bits, sign)));
+  }
+#endif
+  for (; i < count; i++) out[i] = fromHalf(in[i]);
+#endif
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::chorddsp {
+
+// Post-processing kernels for spectra, mel bands and chroma, the PCM
+// ingest kernel and half-precision storage. vDSP / vForce / vImage on
+// Apple; elsewhere log and dB use a four-lane polynomial log on NEON or SSE2
+// (max relative error ~1e-7 against std::log), ingest four frames per step
+// for mono and stereo, half conversion uses NEON fcvt on AArch64 or F16C
+// when the target has it (SSE2 integer lanes for float16 reads without
+// it), and plain loops otherwise.
+
+// How a vector (a chroma frame, a constant-Q chroma) is scaled
+enum class Normalization {
+  Max,  // divide by the maximum, so the largest value is 1 (the default)
+  L1,   // divide by the sum of magnitudes
+  L2,   // divide by the Euclidean norm
+  None, // leave the raw energies
+};
+
+// How mel band energies are compressed
+enum class MelScale {
+  Log,     // natural log (BasicPitch input, the default)
+  Decibel, // 10 * log10
+  Power,   // linear energy, only floored
+};
+
+// Sample encodings conditionPcm() reads, native endian
+enum class PcmFormat {
+  Float32, // full scale 1
+  Int16,   // full scale 32768
+  Int32,   // full scale 2^31
+};
+
+// Bytes per sample of `format`
+size_t pcmSampleBytes(PcmFormat format);
+
+// Energy and peak of conditioned samples, accumulated across calls
+struct PcmLevels {
+  double sumSquares = 0.0;
+  float peak = 0.0f; // largest magnitude
+};
+
+class BiquadCascade;
+
+// One pass over `frames` frames of `channels` interleaved samples:
+// out[f] = clamp(filter(gain * mean of frame f's channels), -1, 1), with
+// the squares and magnitudes of `out` added to `levels`. `filter` may be
+// null; its state carries over to the next call. `in` must be aligned to
+// its sample size.
+void conditionPcm(const void* in, PcmFormat format, int channels, size_t frames, float gain, float* out, PcmLevels& levels, BiquadCascade* filter = nullptr);
+
+// IEEE binary16 bit patterns for long-lived caches that kernels read back
+// as float32: out[i] = float16(in[i]), rounded to nearest even (overflow
+// to infinity), and the exact reverse
+void floatToHalf(const float* in, uint16_t* out, size_t count);
+void halfToFloat(const uint16_t* in, float* out, size_t count);
+
+// values[i] = max(values[i], floor)
+void clampMin(float* values, size_t count, float floor);
+
+// values[i] = log(max(values[i], floor))
+void logFloor(float* values, size_t count, float floor);
+
+// values[i] = 10 * log10(max(values[i], floor))
+void powerToDb(float* values, size_t count, float floor);
+
+// Floors at `floor` and compresses with `scale`
+void applyMelScale(float* values, size_t count, float floor, MelScale scale);
+
+// Scales `values` in place; an all-zero vector is left as is
+void normalize(float* values, size_t count, Normalization mode);
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,197 @@
+#include "WavFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace margelo::nitro::chorddsp {
+
+namespace {
+
+// Mapped bytes read() lets pile up before dropping them
+constexpr size_t kReleaseBytes = 1 << 20;
+
+// Format codes of the fmt chunk, and of an extensible SubFormat
+constexpr uint16_t kFormatPcm = 0x0001;
+constexpr uint16_t kFormatFloat = 0x0003;
+constexpr uint16_t kFormatExtensible = 0xFFFE;
+// SubFormat GUID bytes after its format code (KSDATAFORMAT_SUBTYPE_*)
+constexpr uint8_t kSubFormatTail[12] = {0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+
+uint16_t le16(const uint8_t* p) {
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t le32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+} // namespace
+
+WavFile::WavFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::invalid_argument("WavFile: cannot open " + path);
+  }
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+    ::close(fd);
+    throw std::invalid_argument("WavFile: " + path + " is empty or unreadable");
+  }
+  mapSize_ = static_cast<size_t>(info.st_size);
+  void* map = ::mmap(nullptr, mapSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps the file alive
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    throw std::invalid_argument("WavFile: cannot map " + path);
+  }
+  map_ = static_cast<const uint8_t*>(map);
+  ::madvise(map, mapSize_, MADV_SEQUENTIAL);
+
+  try {
+    parse(path);
+  } catch (...) {
+    ::munmap(const_cast<uint8_t*>(map_), mapSize_);
+    throw;
+  }
+}
+
+WavFile::~WavFile() {
+  if (map_) ::munmap(const_cast<uint8_t*>(map_), mapSize_);
+}
+
+void WavFile::parse(const std::string& path) {
+  if (mapSize_ < 12 || std::memcmp(map_, "RIFF", 4) != 0 || std::memcmp(map_ + 8, "WAVE", 4) != 0) {
+    throw std::invalid_argument("WavFile: " + path + " is not a RIFF/WAVE file");
+  }
+
+  uint16_t format = 0;
+  uint16_t blockAlign = 0;
+  uint16_t validBits = 0;
+  bool haveFormat = false;
+  // Offsets in 64 bits: a 32-bit size_t would wrap on sizes near 4 GiB
+  const uint64_t end = mapSize_;
+  uint64_t pos = 12;
+  while (pos + 8 <= end) {
+    const uint8_t* chunk = map_ + pos;
+    uint64_t size = le32(chunk + 4);
+    uint64_t body = pos + 8;
+    if (std::memcmp(chunk, "fmt ", 4) == 0) {
+      if (size < 16 || body + 16 > end) break;
+      format = le16(map_ + body);
+      channels_ = le16(map_ + body + 2);
+      sampleRate_ = le32(map_ + body + 4);
+      blockAlign = le16(map_ + body + 12);
+      validBits = le16(map_ + body + 14);
+      if (format == kFormatExtensible) {
+        // The real format is the SubFormat GUID's first field; the samples
+        // sit in blockAlign / channels byte containers with validBits used
+        if (size < 40 || body + 40 > end || le16(map_ + body + 16) < 22) {
+          throw std::invalid_argument("WavFile: " + path + " is WAVE_FORMAT_EXTENSIBLE without a SubFormat");
+        }
+        if (le16(map_ + body + 26) != 0 || std::memcmp(map_ + body + 28, kSubFormatTail, sizeof(kSubFormatTail)) != 0) {
+          throw std::invalid_argument("WavFile: " + path + " has an unsupported SubFormat");
+        }
+        uint16_t valid = le16(map_ + body + 18);
+        if (valid != 0) validBits = valid;
+        format = le16(map_ + body + 24);
+      }
+      haveFormat = true;
+    } else if (std::memcmp(chunk, "data", 4) == 0) {
+      if (!haveFormat) break;
+      if (channels_ < 1 || sampleRate_ == 0) {
+        throw std::invalid_argument("WavFile: " + path + " has no channels or sample rate");
+      }
+      if (blockAlign == 0 || blockAlign % channels_ != 0) {
+        throw std::invalid_argument("WavFile: " + path + " has block align " + std::to_string(blockAlign) + " for " + std::to_string(channels_) + " channels");
+      }
+      // Integer samples narrower than their container are left-justified,
+      // so decoding the whole container scales them correctly
+      int container = blockAlign / channels_;
+      bool fits = validBits > 0 && validBits <= container * 8;
+      if (fits && format == kFormatPcm && container == 2) {
+        encoding_ = Encoding::Int16;
+      } else if (fits && format == kFormatPcm && container == 3) {
+        encoding_ = Encoding::Int24;
+      } else if (fits && format == kFormatPcm && container == 4) {
+        encoding_ = Encoding::Int32;
+      } else if (format == kFormatFloat && container == 4 && validBits == 32) {
+        encoding_ = Encoding::Float32;
+      } else {
+        throw std::invalid_argument("WavFile: " + path + " has unsupported format " + std::to_string(format) + " with " + std::to_string(validBits) + " bits in " + std::to_string(container) + " bytes");
+      }
+      bytesPerSample_ = container;
+      // Recorders that never finalize the header leave the size at 0 or
+      // 0xFFFFFFFF; either way the data cannot run past the file
+      uint64_t available = end - body;
+      uint64_t bytes = size == 0 || size > available ? available : size;
+      data_ = map_ + body;
+      frames_ = static_cast<size_t>(bytes / (static_cast<uint64_t>(channels_) * bytesPerSample_));
+      return;
+    }
+    // Any other chunk has to fit in the file before the walk moves past it
+    if (size > end - body) {
+      throw std::invalid_argument("WavFile: " + path + " has a chunk of " + std::to_string(size) + " bytes past the end of the file");
+    }
+    // Chunks are padded to an even size
+    pos = body + size + (size & 1);
+  }
+  throw std::invalid_argument("WavFile: " + path + " has no fmt and data chunks");
+}
+
+size_t WavFile::read(size_t offset, size_t count, float* out) {
+  if (offset >= frames_) return 0;
+  count = std::min(count, frames_ - offset);
+  size_t stride = static_cast<size_t>(channels_) * bytesPerSample_;
+  const uint8_t* p = data_ + offset * stride;
+  const float scale = 1.0f / static_cast<float>(channels_);
+
+  for (size_t f = 0; f < count; f++) {
+    float sum = 0.0f;
+    for (int c = 0; c < channels_; c++) {
+      switch (encoding_) {
+        case Encoding::Int16:
+          sum += static_cast<int16_t>(le16(p)) * (1.0f / 32768.0f);
+          break;
+        case Encoding::Int24: {
+          // Sign-extend from the top byte
+          int32_t v = static_cast<int32_t>((static_cast<uint32_t>(p[0]) << 8) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 24)) >> 8;
+          sum += static_cast<float>(v) * (1.0f / 8388608.0f);
+          break;
+        }
+        case Encoding::Int32:
+          sum += static_cast<float>(static_cast<int32_t>(le32(p))) * (1.0f / 2147483648.0f);
+          break;
+        case Encoding::Float32: {
+          uint32_t bits = le32(p);
+          float v;
+          std::memcpy(&v, &bits, sizeof(v));
+          sum += v;
+          break;
+        }
+      }
+      p += bytesPerSample_;
+    }
+    out[f] = sum * scale;
+  }
+
+  release(static_cast<size_t>(p - map_));
+  return count;
+}
+
+void WavFile::release(size_t end) {
+  if (end < released_ + kReleaseBytes) return;
+  size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+  size_t upTo = end / page * page;
+  if (upTo <= released_) return;
+  // Clean file pages: dropping them only costs a re-read if touched again
+  ::madvise(const_cast<uint8_t*>(map_) + released_, upTo - released_, MADV_DONTNEED);
+  released_ = upTo;
+}
+
+} // namespace margelo::nitro::chorddsp
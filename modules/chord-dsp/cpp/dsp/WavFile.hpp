@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace margelo::nitro::chorddsp {
+
+// Read-only memory map of a RIFF/WAVE file: 16-, 24- and 32-bit integer PCM
+// or 32-bit float, any channel count. WAVE_FORMAT_EXTENSIBLE files are
+// decoded by their SubFormat (PCM or IEEE float) and block alignment, so
+// 24-in-32 PCM reads as integers. Samples are converted on read, channels
+// averaged, so a recording is never decoded into one buffer; read() advises
+// the kernel to drop mapped pages behind it, which keeps resident memory at
+// a few blocks however long the file is. Throws std::invalid_argument on
+// files it cannot open or parse.
+class WavFile {
+public:
+  explicit WavFile(const std::string& path);
+  ~WavFile();
+
+  WavFile(const WavFile&) = delete;
+  WavFile& operator=(const WavFile&) = delete;
+
+  uint32_t sampleRate() const { return sampleRate_; }
+  int channels() const { return channels_; }
+  // Sample frames (per channel) in the data chunk
+  size_t frames() const { return frames_; }
+
+  // Writes the mono mix of `count` frames from frame `offset` to `out`;
+  // returns the number written, fewer at the end of the data
+  size_t read(size_t offset, size_t count, float* out);
+
+private:
+  enum class Encoding { Int16, Int24, Int32, Float32 };
+
+  void parse(const std::string& path);
+  // Drops whole mapped pages before byte `end` of the data
+  void release(size_t end);
+
+  const uint8_t* map_ = nullptr;
+  size_t mapSize_ = 0;
+  const uint8_t* data_ = nullptr;
+  size_t released_ = 0;
+
+  uint32_t sampleRate_ = 0;
+  int channels_ = 0;
+  int bytesPerSample_ = 0;
+  Encoding encoding_ = Encoding::Int16;
+  size_t frames_ = 0;
+};
+
+} // namespace margelo::nitro::chorddsp
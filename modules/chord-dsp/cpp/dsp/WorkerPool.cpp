@@ -0,0 +1,75 @@
+#include "WorkerPool.hpp"
+#include <algorithm>
+
+#ifdef __APPLE__
+#include <pthread.h>
+#endif
+
+namespace margelo::nitro::chorddsp {
+
+WorkerPool::WorkerPool(int participants) {
+  int workers = std::max(participants, 1) - 1;
+  threads_.reserve(workers);
+  for (int i = 0; i < workers; i++) {
+    threads_.emplace_back([this, i] { workerLoop(i + 1); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  start_.notify_all();
+  for (std::thread& thread : threads_) thread.join();
+}
+
+void WorkerPool::drain(int participant) {
+  for (int task = nextTask_.fetch_add(1, std::memory_order_relaxed); task < numTasks_;
+       task = nextTask_.fetch_add(1, std::memory_order_relaxed)) {
+    fn_(context_, task, participant);
+  }
+}
+
+void WorkerPool::dispatch(int numTasks, TaskFn fn, void* context) {
+  if (numTasks <= 0) return;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fn_ = fn;
+    context_ = context;
+    numTasks_ = numTasks;
+    nextTask_.store(0, std::memory_order_relaxed);
+    busy_ = static_cast<int>(threads_.size());
+    generation_++;
+  }
+  start_.notify_all();
+
+  drain(0);
+
+  // Workers may still be finishing the tasks they claimed
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] { return busy_ == 0; });
+}
+
+void WorkerPool::workerLoop(int participant) {
+#ifdef __APPLE__
+  // Offline analysis the user is waiting on, below the audio threads
+  pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+#endif
+  uint64_t seen = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+      if (stopping_) return;
+      seen = generation_;
+    }
+
+    drain(participant);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--busy_ == 0) done_.notify_one();
+  }
+}
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+// Fixed set of threads for splitting one offline job into independent
+// tasks. run() blocks until every task is done; the calling thread works
+// through tasks too, so a pool of size() participants starts size() - 1
+// threads. Tasks are claimed from an atomic counter, so uneven tasks
+// balance themselves. Nothing is allocated per run(). One run() at a time.
+class WorkerPool {
+public:
+  // `participants` includes the calling thread, at least 1
+  explicit WorkerPool(int participants);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  int size() const { return static_cast<int>(threads_.size()) + 1; }
+
+  // Calls fn(task, participant) once for each task in [0, numTasks).
+  // `participant` is in [0, size()) and unique among concurrent calls, so it
+  // can index per-thread state; the calling thread is participant 0.
+  template <typename Fn>
+  void run(int numTasks, Fn& fn) {
+    dispatch(numTasks, [](void* context, int task, int participant) {
+      (*static_cast<Fn*>(context))(task, participant);
+    }, &fn);
+  }
+
+private:
+  using TaskFn = void (*)(void* context, int task, int participant);
+
+  void dispatch(int numTasks, TaskFn fn, void* context);
+  void workerLoop(int participant);
+  void drain(int participant);
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  bool stopping_ = false;
+
+  // Current job, published under mutex_ by bumping generation_
+  uint64_t generation_ = 0;
+  TaskFn fn_ = nullptr;
+  void* context_ = nullptr;
+  int numTasks_ = 0;
+  std::atomic<int> nextTask_{0};
+  // Worker threads still inside the current job
+  int busy_ = 0;
+};
+
+} // namespace margelo::nitro::chorddsp
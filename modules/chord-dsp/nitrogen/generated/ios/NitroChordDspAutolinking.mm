@@ -11,6 +11,11 @@
 #import <type_traits>
 
 #include "HybridChordDSP.hpp"
+#include "HybridStreamingChordAnalyzer.hpp"
+#include "HybridOnsetDetector.hpp"
+#include "HybridChordClassifier.hpp"
+#include "HybridPitchTracker.hpp"
+#include "HybridNoteBank.hpp"
 
 @interface NitroChordDspAutolinking : NSObject
 @end
@@ -30,6 +35,51 @@
       return std::make_shared<HybridChordDSP>();
     }
   );
+  HybridObjectRegistry::registerHybridObjectConstructor(
+    "StreamingChordAnalyzer",
+    []() -> std::shared_ptr<HybridObject> {
+      static_assert(std::is_default_constructible_v<HybridStreamingChordAnalyzer>,
+                    "The HybridObject \"HybridStreamingChordAnalyzer\" is not default-constructible! "
+                    "Create a public constructor that takes zero arguments to be able to autolink this HybridObject.");
+      return std::make_shared<HybridStreamingChordAnalyzer>();
+    }
+  );
+  HybridObjectRegistry::registerHybridObjectConstructor(
+    "OnsetDetector",
+    []() -> std::shared_ptr<HybridObject> {
+      static_assert(std::is_default_constructible_v<HybridOnsetDetector>,
+                    "The HybridObject \"HybridOnsetDetector\" is not default-constructible! "
+                    "Create a public constructor that takes zero arguments to be able to autolink this HybridObject.");
+      return std::make_shared<HybridOnsetDetector>();
+    }
+  );
+  HybridObjectRegistry::registerHybridObjectConstructor(
+    "ChordClassifier",
+    []() -> std::shared_ptr<HybridObject> {
+      static_assert(std::is_default_constructible_v<HybridChordClassifier>,
+                    "The HybridObject \"HybridChordClassifier\" is not default-constructible! "
+                    "Create a public constructor that takes zero arguments to be able to autolink this HybridObject.");
+      return std::make_shared<HybridChordClassifier>();
+    }
+  );
+  HybridObjectRegistry::registerHybridObjectConstructor(
+    "PitchTracker",
+    []() -> std::shared_ptr<HybridObject> {
+      static_assert(std::is_default_constructible_v<HybridPitchTracker>,
+                    "The HybridObject \"HybridPitchTracker\" is not default-constructible! "
+                    "Create a public constructor that takes zero arguments to be able to autolink this HybridObject.");
+      return std::make_shared<HybridPitchTracker>();
+    }
+  );
+  HybridObjectRegistry::registerHybridObjectConstructor(
+    "NoteBank",
+    []() -> std::shared_ptr<HybridObject> {
+      static_assert(std::is_default_constructible_v<HybridNoteBank>,
+                    "The HybridObject \"HybridNoteBank\" is not default-constructible! "
+                    "Create a public constructor that takes zero arguments to be able to autolink this HybridObject.");
+      return std::make_shared<HybridNoteBank>();
+    }
+  );
 }
 
 @end
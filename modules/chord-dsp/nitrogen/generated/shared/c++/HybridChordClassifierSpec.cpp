@@ -0,0 +1,34 @@
+///
+/// HybridChordClassifierSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridChordClassifierSpec.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+  void HybridChordClassifierSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("classifyInto", &HybridChordClassifierSpec::classifyInto);
+      prototype.registerHybridMethod("classifyWithBassInto", &HybridChordClassifierSpec::classifyWithBassInto);
+      prototype.registerHybridMethod("classifyTwoStageInto", &HybridChordClassifierSpec::classifyTwoStageInto);
+      prototype.registerHybridMethod("topNInto", &HybridChordClassifierSpec::topNInto);
+      prototype.registerHybridMethod("classifyActivationsInto", &HybridChordClassifierSpec::classifyActivationsInto);
+      prototype.registerHybridMethod("configureSmoother", &HybridChordClassifierSpec::configureSmoother);
+      prototype.registerHybridMethod("smoothInto", &HybridChordClassifierSpec::smoothInto);
+      prototype.registerHybridMethod("currentRoot", &HybridChordClassifierSpec::currentRoot);
+      prototype.registerHybridMethod("resetSmoother", &HybridChordClassifierSpec::resetSmoother);
+      prototype.registerHybridMethod("configureDecoder", &HybridChordClassifierSpec::configureDecoder);
+      prototype.registerHybridMethod("decodeInto", &HybridChordClassifierSpec::decodeInto);
+      prototype.registerHybridMethod("decodeStepInto", &HybridChordClassifierSpec::decodeStepInto);
+      prototype.registerHybridMethod("flushDecoderInto", &HybridChordClassifierSpec::flushDecoderInto);
+      prototype.registerHybridMethod("resetDecoder", &HybridChordClassifierSpec::resetDecoder);
+    });
+  }
+
+} // namespace margelo::nitro::chorddsp
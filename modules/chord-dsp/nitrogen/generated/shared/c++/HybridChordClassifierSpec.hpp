@@ -0,0 +1,75 @@
+///
+/// HybridChordClassifierSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::chorddsp {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `ChordClassifier`
+   * Inherit this class to create instances of `HybridChordClassifierSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridChordClassifier: public HybridChordClassifierSpec {
+   * public:
+   *   HybridChordClassifier(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridChordClassifierSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridChordClassifierSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridChordClassifierSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual void classifyInto(const std::shared_ptr<ArrayBuffer>& chroma, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void classifyWithBassInto(const std::shared_ptr<ArrayBuffer>& frame, double previousRoot, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void classifyTwoStageInto(const std::shared_ptr<ArrayBuffer>& frame, double previousRoot, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double topNInto(const std::shared_ptr<ArrayBuffer>& chroma, double n, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double classifyActivationsInto(const std::shared_ptr<ArrayBuffer>& notes, double threshold, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void configureSmoother(double minHoldMs, double minFramesToConfirm, double hysteresisMargin) = 0;
+      virtual void smoothInto(double root, double quality, double confidence, bool isOnset, double nowMs, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double currentRoot() = 0;
+      virtual void resetSmoother() = 0;
+      virtual void configureDecoder(double selfTransition, double temperature, double noChordScore, double lagFrames) = 0;
+      virtual double decodeInto(const std::shared_ptr<ArrayBuffer>& frames, double stride, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double decodeStepInto(const std::shared_ptr<ArrayBuffer>& chroma, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double flushDecoderInto(const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void resetDecoder() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "ChordClassifier";
+  };
+
+} // namespace margelo::nitro::chorddsp
@@ -21,6 +21,40 @@ namespace margelo::nitro::chorddsp {
       prototype.registerHybridMethod("initOnsetDetector", &HybridChordDSPSpec::initOnsetDetector);
       prototype.registerHybridMethod("detectOnset", &HybridChordDSPSpec::detectOnset);
       prototype.registerHybridMethod("resetOnsetDetector", &HybridChordDSPSpec::resetOnsetDetector);
+      prototype.registerHybridMethod("setOnsetDescriptors", &HybridChordDSPSpec::setOnsetDescriptors);
+      prototype.registerHybridMethod("setOnsetParameters", &HybridChordDSPSpec::setOnsetParameters);
+      prototype.registerHybridMethod("reserveOnsetDetectors", &HybridChordDSPSpec::reserveOnsetDetectors);
+      prototype.registerHybridMethod("warmup", &HybridChordDSPSpec::warmup);
+      prototype.registerHybridMethod("scratchAllocationCount", &HybridChordDSPSpec::scratchAllocationCount);
+      prototype.registerHybridMethod("getPerfStats", &HybridChordDSPSpec::getPerfStats);
+      prototype.registerHybridMethod("resetPerfStats", &HybridChordDSPSpec::resetPerfStats);
+      prototype.registerHybridMethod("setSoftChroma", &HybridChordDSPSpec::setSoftChroma);
+      prototype.registerHybridMethod("setPeakChroma", &HybridChordDSPSpec::setPeakChroma);
+      prototype.registerHybridMethod("setHarmonicPercussive", &HybridChordDSPSpec::setHarmonicPercussive);
+      prototype.registerHybridMethod("setSpectralWhitening", &HybridChordDSPSpec::setSpectralWhitening);
+      prototype.registerHybridMethod("setTuningEstimation", &HybridChordDSPSpec::setTuningEstimation);
+      prototype.registerHybridMethod("getTuningOffset", &HybridChordDSPSpec::getTuningOffset);
+      prototype.registerHybridMethod("setSpectralFeatures", &HybridChordDSPSpec::setSpectralFeatures);
+      prototype.registerHybridMethod("getSpectralFeatures", &HybridChordDSPSpec::getSpectralFeatures);
+      prototype.registerHybridMethod("setMelThreads", &HybridChordDSPSpec::setMelThreads);
+      prototype.registerHybridMethod("analyzeFrame", &HybridChordDSPSpec::analyzeFrame);
+      prototype.registerHybridMethod("resampledLength", &HybridChordDSPSpec::resampledLength);
+      prototype.registerHybridMethod("resampleTo22050Into", &HybridChordDSPSpec::resampleTo22050Into);
+      prototype.registerHybridMethod("computeMelSpectrogramInto", &HybridChordDSPSpec::computeMelSpectrogramInto);
+      prototype.registerHybridMethod("computeChromagramInto", &HybridChordDSPSpec::computeChromagramInto);
+      prototype.registerHybridMethod("computeBassChromagramInto", &HybridChordDSPSpec::computeBassChromagramInto);
+      prototype.registerHybridMethod("chromaFrameCount", &HybridChordDSPSpec::chromaFrameCount);
+      prototype.registerHybridMethod("computeChromaFramesInto", &HybridChordDSPSpec::computeChromaFramesInto);
+      prototype.registerHybridMethod("detectOnsetInto", &HybridChordDSPSpec::detectOnsetInto);
+      prototype.registerHybridMethod("detectOnsetsBatch", &HybridChordDSPSpec::detectOnsetsBatch);
+      prototype.registerHybridMethod("analyzeFile", &HybridChordDSPSpec::analyzeFile);
+      prototype.registerHybridMethod("analyzeFrameInto", &HybridChordDSPSpec::analyzeFrameInto);
+      prototype.registerHybridMethod("constantQWindowSize", &HybridChordDSPSpec::constantQWindowSize);
+      prototype.registerHybridMethod("computeConstantQInto", &HybridChordDSPSpec::computeConstantQInto);
+      prototype.registerHybridMethod("computeMelSpectrogramAsync", &HybridChordDSPSpec::computeMelSpectrogramAsync);
+      prototype.registerHybridMethod("detectOnsetsBatchAsync", &HybridChordDSPSpec::detectOnsetsBatchAsync);
+      prototype.registerHybridMethod("analyzeFileAsync", &HybridChordDSPSpec::analyzeFileAsync);
+      prototype.registerHybridMethod("cancelAsync", &HybridChordDSPSpec::cancelAsync);
     });
   }
 
@@ -16,6 +16,10 @@
 
 
 #include <vector>
+#include <string>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+#include <NitroModules/Promise.hpp>
 
 namespace margelo::nitro::chorddsp {
 
@@ -55,6 +59,40 @@ namespace margelo::nitro::chorddsp {
       virtual void initOnsetDetector(double sampleRate, double bufferSize, double hopSize) = 0;
       virtual std::vector<double> detectOnset(const std::vector<double>& samples) = 0;
       virtual void resetOnsetDetector() = 0;
+      virtual void setOnsetDescriptors(const std::vector<std::string>& methods, const std::vector<double>& weights) = 0;
+      virtual void setOnsetParameters(double threshold, double silenceDb, double minIoiMs) = 0;
+      virtual void reserveOnsetDetectors(double count, double sampleRate, double bufferSize, double hopSize, const std::vector<std::string>& methods) = 0;
+      virtual void warmup() = 0;
+      virtual double scratchAllocationCount() = 0;
+      virtual std::vector<double> getPerfStats() = 0;
+      virtual void resetPerfStats() = 0;
+      virtual void setSoftChroma(bool enabled) = 0;
+      virtual void setPeakChroma(bool enabled) = 0;
+      virtual void setHarmonicPercussive(bool enabled) = 0;
+      virtual void setSpectralWhitening(bool enabled) = 0;
+      virtual void setTuningEstimation(bool enabled) = 0;
+      virtual double getTuningOffset() = 0;
+      virtual void setSpectralFeatures(bool enabled) = 0;
+      virtual std::vector<double> getSpectralFeatures() = 0;
+      virtual void setMelThreads(double threads) = 0;
+      virtual std::vector<double> analyzeFrame(const std::vector<double>& samples, double sampleRate) = 0;
+      virtual double resampledLength(double numSamples, double sourceSampleRate) = 0;
+      virtual double resampleTo22050Into(const std::shared_ptr<ArrayBuffer>& samples, double sourceSampleRate, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double computeMelSpectrogramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& scale) = 0;
+      virtual void computeChromagramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) = 0;
+      virtual void computeBassChromagramInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) = 0;
+      virtual double chromaFrameCount(double numSamples) = 0;
+      virtual double computeChromaFramesInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) = 0;
+      virtual void detectOnsetInto(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual std::shared_ptr<ArrayBuffer> detectOnsetsBatch(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate) = 0;
+      virtual std::shared_ptr<ArrayBuffer> analyzeFile(const std::string& path, std::optional<double> hopSize, std::optional<double> minRms) = 0;
+      virtual void analyzeFrameInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) = 0;
+      virtual double constantQWindowSize(double sampleRate, double numBins) = 0;
+      virtual void computeConstantQInto(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, double numBins, const std::shared_ptr<ArrayBuffer>& output, const std::optional<std::string>& normalization) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> computeMelSpectrogramAsync(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::string& lane, const std::optional<std::string>& scale) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> detectOnsetsBatchAsync(const std::shared_ptr<ArrayBuffer>& samples, double sampleRate, const std::string& lane) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> analyzeFileAsync(const std::string& path, const std::string& lane, std::optional<double> hopSize, std::optional<double> minRms) = 0;
+      virtual void cancelAsync(const std::string& lane) = 0;
 
     protected:
       // Hybrid Setup
@@ -0,0 +1,25 @@
+///
+/// HybridNoteBankSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridNoteBankSpec.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+  void HybridNoteBankSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("configure", &HybridNoteBankSpec::configure);
+      prototype.registerHybridMethod("process", &HybridNoteBankSpec::process);
+      prototype.registerHybridMethod("readInto", &HybridNoteBankSpec::readInto);
+      prototype.registerHybridMethod("readPitchClassesInto", &HybridNoteBankSpec::readPitchClassesInto);
+      prototype.registerHybridMethod("reset", &HybridNoteBankSpec::reset);
+    });
+  }
+
+} // namespace margelo::nitro::chorddsp
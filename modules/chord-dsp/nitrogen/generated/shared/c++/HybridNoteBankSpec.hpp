@@ -0,0 +1,68 @@
+///
+/// HybridNoteBankSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+#include <optional>
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::chorddsp {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `NoteBank`
+   * Inherit this class to create instances of `HybridNoteBankSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridNoteBank: public HybridNoteBankSpec {
+   * public:
+   *   HybridNoteBank(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridNoteBankSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridNoteBankSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridNoteBankSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual void configure(double sampleRate, const std::vector<double>& notes, std::optional<double> referenceHz, std::optional<double> bandwidthCents) = 0;
+      virtual void process(const std::shared_ptr<ArrayBuffer>& samples) = 0;
+      virtual void readInto(const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void readPitchClassesInto(const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void reset() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "NoteBank";
+  };
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,26 @@
+///
+/// HybridOnsetDetectorSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridOnsetDetectorSpec.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+  void HybridOnsetDetectorSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("configure", &HybridOnsetDetectorSpec::configure);
+      prototype.registerHybridMethod("process", &HybridOnsetDetectorSpec::process);
+      prototype.registerHybridMethod("setParameters", &HybridOnsetDetectorSpec::setParameters);
+      prototype.registerHybridMethod("resultSize", &HybridOnsetDetectorSpec::resultSize);
+      prototype.registerHybridMethod("reset", &HybridOnsetDetectorSpec::reset);
+      prototype.registerHybridMethod("release", &HybridOnsetDetectorSpec::release);
+    });
+  }
+
+} // namespace margelo::nitro::chorddsp
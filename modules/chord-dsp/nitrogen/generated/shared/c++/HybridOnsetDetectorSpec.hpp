@@ -0,0 +1,69 @@
+///
+/// HybridOnsetDetectorSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::chorddsp {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `OnsetDetector`
+   * Inherit this class to create instances of `HybridOnsetDetectorSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridOnsetDetector: public HybridOnsetDetectorSpec {
+   * public:
+   *   HybridOnsetDetector(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridOnsetDetectorSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridOnsetDetectorSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridOnsetDetectorSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual void configure(double sampleRate, double bufferSize, double hopSize, const std::vector<std::string>& methods, const std::vector<double>& weights) = 0;
+      virtual void process(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void setParameters(double threshold, double silenceDb, double minIoiMs) = 0;
+      virtual double resultSize() = 0;
+      virtual void reset() = 0;
+      virtual void release() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "OnsetDetector";
+  };
+
+} // namespace margelo::nitro::chorddsp
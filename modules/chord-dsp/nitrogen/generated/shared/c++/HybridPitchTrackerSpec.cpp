@@ -0,0 +1,22 @@
+///
+/// HybridPitchTrackerSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridPitchTrackerSpec.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+  void HybridPitchTrackerSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("configure", &HybridPitchTrackerSpec::configure);
+      prototype.registerHybridMethod("detectInto", &HybridPitchTrackerSpec::detectInto);
+    });
+  }
+
+} // namespace margelo::nitro::chorddsp
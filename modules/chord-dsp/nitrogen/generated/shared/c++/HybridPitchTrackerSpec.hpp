@@ -0,0 +1,63 @@
+///
+/// HybridPitchTrackerSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::chorddsp {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `PitchTracker`
+   * Inherit this class to create instances of `HybridPitchTrackerSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridPitchTracker: public HybridPitchTrackerSpec {
+   * public:
+   *   HybridPitchTracker(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridPitchTrackerSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridPitchTrackerSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridPitchTrackerSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual void configure(double sampleRate, double bufferSize, double threshold) = 0;
+      virtual bool detectInto(const std::shared_ptr<ArrayBuffer>& samples, const std::shared_ptr<ArrayBuffer>& output) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "PitchTracker";
+  };
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,52 @@
+///
+/// HybridStreamingChordAnalyzerSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridStreamingChordAnalyzerSpec.hpp"
+
+namespace margelo::nitro::chorddsp {
+
+  void HybridStreamingChordAnalyzerSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("configure", &HybridStreamingChordAnalyzerSpec::configure);
+      prototype.registerHybridMethod("pushSamples", &HybridStreamingChordAnalyzerSpec::pushSamples);
+      prototype.registerHybridMethod("pushPcm", &HybridStreamingChordAnalyzerSpec::pushPcm);
+      prototype.registerHybridMethod("pullFrames", &HybridStreamingChordAnalyzerSpec::pullFrames);
+      prototype.registerHybridMethod("pullSegments", &HybridStreamingChordAnalyzerSpec::pullSegments);
+      prototype.registerHybridMethod("readHistory", &HybridStreamingChordAnalyzerSpec::readHistory);
+      prototype.registerHybridMethod("readMelWindow", &HybridStreamingChordAnalyzerSpec::readMelWindow);
+      prototype.registerHybridMethod("readMelWindowShared", &HybridStreamingChordAnalyzerSpec::readMelWindowShared);
+      prototype.registerHybridMethod("reset", &HybridStreamingChordAnalyzerSpec::reset);
+      prototype.registerHybridMethod("setHarmonicPercussive", &HybridStreamingChordAnalyzerSpec::setHarmonicPercussive);
+      prototype.registerHybridMethod("setSpectralWhitening", &HybridStreamingChordAnalyzerSpec::setSpectralWhitening);
+      prototype.registerHybridMethod("setTuningEstimation", &HybridStreamingChordAnalyzerSpec::setTuningEstimation);
+      prototype.registerHybridMethod("getTuningOffset", &HybridStreamingChordAnalyzerSpec::getTuningOffset);
+      prototype.registerHybridMethod("setSpectralFeatures", &HybridStreamingChordAnalyzerSpec::setSpectralFeatures);
+      prototype.registerHybridMethod("getSpectralFeatures", &HybridStreamingChordAnalyzerSpec::getSpectralFeatures);
+      prototype.registerHybridMethod("setPeakChroma", &HybridStreamingChordAnalyzerSpec::setPeakChroma);
+      prototype.registerHybridMethod("setChangeGate", &HybridStreamingChordAnalyzerSpec::setChangeGate);
+      prototype.registerHybridMethod("setAdaptiveScheduling", &HybridStreamingChordAnalyzerSpec::setAdaptiveScheduling);
+      prototype.registerHybridMethod("setThermalState", &HybridStreamingChordAnalyzerSpec::setThermalState);
+      prototype.registerHybridMethod("getSchedule", &HybridStreamingChordAnalyzerSpec::getSchedule);
+      prototype.registerHybridMethod("setOnsetSegments", &HybridStreamingChordAnalyzerSpec::setOnsetSegments);
+      prototype.registerHybridMethod("setBassInterval", &HybridStreamingChordAnalyzerSpec::setBassInterval);
+      prototype.registerHybridMethod("setOnsetParameters", &HybridStreamingChordAnalyzerSpec::setOnsetParameters);
+      prototype.registerHybridMethod("setKeyEstimation", &HybridStreamingChordAnalyzerSpec::setKeyEstimation);
+      prototype.registerHybridMethod("getKey", &HybridStreamingChordAnalyzerSpec::getKey);
+      prototype.registerHybridMethod("setPreFilter", &HybridStreamingChordAnalyzerSpec::setPreFilter);
+      prototype.registerHybridMethod("setPreFilterSections", &HybridStreamingChordAnalyzerSpec::setPreFilterSections);
+      prototype.registerHybridMethod("startWorker", &HybridStreamingChordAnalyzerSpec::startWorker);
+      prototype.registerHybridMethod("stopWorker", &HybridStreamingChordAnalyzerSpec::stopWorker);
+      prototype.registerHybridMethod("startChordEvents", &HybridStreamingChordAnalyzerSpec::startChordEvents);
+      prototype.registerHybridMethod("stopChordEvents", &HybridStreamingChordAnalyzerSpec::stopChordEvents);
+      prototype.registerHybridMethod("setChordHint", &HybridStreamingChordAnalyzerSpec::setChordHint);
+    });
+  }
+
+} // namespace margelo::nitro::chorddsp
@@ -0,0 +1,96 @@
+///
+/// HybridStreamingChordAnalyzerSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::chorddsp {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `StreamingChordAnalyzer`
+   * Inherit this class to create instances of `HybridStreamingChordAnalyzerSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridStreamingChordAnalyzer: public HybridStreamingChordAnalyzerSpec {
+   * public:
+   *   HybridStreamingChordAnalyzer(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridStreamingChordAnalyzerSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridStreamingChordAnalyzerSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridStreamingChordAnalyzerSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual void configure(double sampleRate, double hopSize, double historySize, double inputGain, double minRms) = 0;
+      virtual void pushSamples(const std::shared_ptr<ArrayBuffer>& samples) = 0;
+      virtual std::vector<double> pushPcm(const std::shared_ptr<ArrayBuffer>& samples, const std::string& format, double channels) = 0;
+      virtual double pullFrames(const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double pullSegments(const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual void readHistory(const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double readMelWindow(const std::shared_ptr<ArrayBuffer>& output) = 0;
+      virtual double readMelWindowShared(double frames) = 0;
+      virtual void reset() = 0;
+      virtual void setHarmonicPercussive(bool enabled) = 0;
+      virtual void setSpectralWhitening(bool enabled) = 0;
+      virtual void setTuningEstimation(bool enabled) = 0;
+      virtual double getTuningOffset() = 0;
+      virtual void setSpectralFeatures(bool enabled, double noiseFlatness) = 0;
+      virtual std::vector<double> getSpectralFeatures() = 0;
+      virtual void setPeakChroma(bool enabled) = 0;
+      virtual void setChangeGate(double tolerance, double maxHeldHops) = 0;
+      virtual void setAdaptiveScheduling(bool enabled) = 0;
+      virtual void setThermalState(double state) = 0;
+      virtual std::vector<double> getSchedule() = 0;
+      virtual void setOnsetSegments(bool enabled, double minSeconds, double maxSeconds) = 0;
+      virtual void setBassInterval(double hops) = 0;
+      virtual void setOnsetParameters(double threshold, double silenceDb, double minIoiMs) = 0;
+      virtual void setKeyEstimation(bool enabled, double halfLifeSeconds) = 0;
+      virtual std::vector<double> getKey() = 0;
+      virtual void setPreFilter(double dcCutoffHz, double highPassHz, double preEmphasis) = 0;
+      virtual void setPreFilterSections(const std::vector<double>& coefficients) = 0;
+      virtual void startWorker(double callbackIntervalMs, const std::function<void(double /* available */)>& onFrames) = 0;
+      virtual void stopWorker() = 0;
+      virtual void startChordEvents(double minHoldMs, double minFramesToConfirm, double hysteresisMargin, double confidenceBand, double frameIntervalMs, const std::function<void(const std::vector<double>& /* events */)>& onEvents) = 0;
+      virtual void stopChordEvents() = 0;
+      virtual void setChordHint(double root, double quality, double confidence) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "StreamingChordAnalyzer";
+  };
+
+} // namespace margelo::nitro::chorddsp
@@ -1,5 +1,46 @@
 import { NitroModules } from "react-native-nitro-modules";
 import type { ChordDSP as ChordDSPType } from "./specs/ChordDSP.nitro";
+import type { StreamingChordAnalyzer } from "./specs/StreamingChordAnalyzer.nitro";
+import type { OnsetDetector } from "./specs/OnsetDetector.nitro";
+import type { ChordClassifier } from "./specs/ChordClassifier.nitro";
+import type { PitchTracker } from "./specs/PitchTracker.nitro";
+import type { NoteBank } from "./specs/NoteBank.nitro";
+
+export type {
+  StreamingChordAnalyzer,
+  OnsetDetector,
+  ChordClassifier,
+  PitchTracker,
+  NoteBank,
+};
 
 export const ChordDSP =
   NitroModules.createHybridObject<ChordDSPType>("ChordDSP");
+
+export function createStreamingChordAnalyzer(): StreamingChordAnalyzer {
+  return NitroModules.createHybridObject<StreamingChordAnalyzer>(
+    "StreamingChordAnalyzer"
+  );
+}
+
+export function createOnsetDetector(): OnsetDetector {
+  return NitroModules.createHybridObject<OnsetDetector>("OnsetDetector");
+}
+
+export function createChordClassifier(): ChordClassifier {
+  return NitroModules.createHybridObject<ChordClassifier>("ChordClassifier");
+}
+
+export function createPitchTracker(): PitchTracker {
+  return NitroModules.createHybridObject<PitchTracker>("PitchTracker");
+}
+
+export function createNoteBank(): NoteBank {
+  return NitroModules.createHybridObject<NoteBank>("NoteBank");
+}
+
+/** MIDI notes of the 88 piano keys, A0 (21) to C8 (108), for NoteBank. */
+export const PIANO_NOTES: number[] = Array.from({ length: 88 }, (_, i) => 21 + i);
+
+/** MIDI notes of the open guitar strings in standard tuning, E2 to E4. */
+export const GUITAR_STRINGS: number[] = [40, 45, 50, 55, 59, 64];
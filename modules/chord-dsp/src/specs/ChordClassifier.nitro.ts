@@ -0,0 +1,99 @@
+import { type HybridObject } from "react-native-nitro-modules";
+
+/**
+ * Native chord template matching and smoothing, a port of
+ * src/utils/chordClassification.ts. Results are written as
+ * [root, quality, confidence] triplets, with root a pitch class (0 = C) and
+ * quality an index into ["", "m", "7", "maj7", "m7", "sus2", "sus4"].
+ * Chroma inputs are float32 and max-normalized; previousRoot is a pitch
+ * class or -1.
+ */
+export interface ChordClassifier extends HybridObject<{ ios: "c++" }> {
+  /** classifyChroma() on 12 chroma values. */
+  classifyInto(chroma: ArrayBuffer, output: ArrayBuffer): void;
+  /** classifyChromaWithBass() on [chroma x12, bassChroma x12]. */
+  classifyWithBassInto(
+    frame: ArrayBuffer,
+    previousRoot: number,
+    output: ArrayBuffer
+  ): void;
+  /** classifyChromaTwoStage() on [chroma x12, bassChroma x12]. */
+  classifyTwoStageInto(
+    frame: ArrayBuffer,
+    previousRoot: number,
+    output: ArrayBuffer
+  ): void;
+  /**
+   * classifyChromaTopN(): writes the n best chords, best first, as 3n
+   * values. Returns the number of chords written.
+   */
+  topNInto(chroma: ArrayBuffer, n: number, output: ArrayBuffer): number;
+  /**
+   * classifyFrame() on BasicPitch note activations (88 per frame, oldest
+   * first) pooled with a recency ramp, frame f weighted (f + 1) / frames,
+   * then folded to chroma with `threshold`. Returns the number of frames
+   * pooled; nothing is written when `notes` holds less than one frame.
+   */
+  classifyActivationsInto(
+    notes: ArrayBuffer,
+    threshold: number,
+    output: ArrayBuffer
+  ): number;
+  /** ChordSmoother parameters; the smoother is reset. */
+  configureSmoother(
+    minHoldMs: number,
+    minFramesToConfirm: number,
+    hysteresisMargin: number
+  ): void;
+  /**
+   * ChordSmoother.process() at time nowMs. root -1 means N/C, in which case
+   * quality is ignored. Writes the smoothed [root, quality, confidence].
+   */
+  smoothInto(
+    root: number,
+    quality: number,
+    confidence: number,
+    isOnset: boolean,
+    nowMs: number,
+    output: ArrayBuffer
+  ): void;
+  /** Root of the smoothed chord, -1 for N/C. */
+  currentRoot(): number;
+  resetSmoother(): void;
+  /**
+   * Viterbi decoder over the chord templates plus N/C, for whole recorded
+   * takes and a fixed-lag online mode. Template similarities are emissions
+   * at `temperature` (exp(similarity / temperature)), N/C scores a constant
+   * `noChordScore`; a chord stays with probability `selfTransition`,
+   * otherwise it moves in proportion to getTransitionPlausibility() of the
+   * root interval. `lagFrames` (0-1024) is the online latency. Defaults
+   * are 0.9, 0.05, 0.6 and 0; the online stream is reset.
+   */
+  configureDecoder(
+    selfTransition: number,
+    temperature: number,
+    noChordScore: number,
+    lagFrames: number
+  ): void;
+  /**
+   * Globally optimal chord sequence over a whole recording: frame f starts
+   * at f * stride and begins with its 12 chroma values (stride 24 reads
+   * computeChromaFramesInto() output directly). Writes one
+   * [root, quality, confidence] triplet per frame, root -1 for N/C, and
+   * returns the frame count. The online stream is untouched.
+   */
+  decodeInto(frames: ArrayBuffer, stride: number, output: ArrayBuffer): number;
+  /**
+   * Online mode: feeds one chroma frame and, once lagFrames frames are
+   * buffered, writes the decision for the frame lagFrames back. Returns 1
+   * when a triplet was written, 0 otherwise.
+   */
+  decodeStepInto(chroma: ArrayBuffer, output: ArrayBuffer): number;
+  /**
+   * Writes the triplets of the frames decodeStepInto() has not decided yet,
+   * oldest first (output must hold lagFrames * 3 values), and resets the
+   * online stream. Returns the number written.
+   */
+  flushDecoderInto(output: ArrayBuffer): number;
+  resetDecoder(): void;
+}
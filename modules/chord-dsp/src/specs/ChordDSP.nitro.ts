@@ -6,6 +6,213 @@ export interface ChordDSP extends HybridObject<{ ios: "c++" }> {
   computeChromagram(samples: number[], sampleRate: number): number[];
   computeBassChromagram(samples: number[], sampleRate: number): number[];
   initOnsetDetector(sampleRate: number, bufferSize: number, hopSize: number): void;
+  /**
+   * Returns [isOnset, fused descriptor], plus descriptor x methods.length
+   * when setOnsetDescriptors() configured several; the fused value is what
+   * gets peak-picked.
+   */
   detectOnset(samples: number[]): number[];
   resetOnsetDetector(): void;
+  /**
+   * aubio onset methods ("default", "hfc", "complex", "specflux", ...) fused
+   * by the detector from one shared spectrum, each scaled by its running mean
+   * and weighted. Defaults to ["default"] with weight 1; rebuilds a detector
+   * that already exists.
+   */
+  setOnsetDescriptors(methods: string[], weights: number[]): void;
+  /**
+   * Peak-picking settings of every detector this instance uses (defaults
+   * 0.3, -40 dB and 50 ms): the fused descriptor must exceed `threshold`,
+   * hops below `silenceDb` never trigger and onsets are at least `minIoiMs`
+   * apart. Unlike setOnsetDescriptors() the streaming detector is not
+   * rebuilt: it keeps its history and picks the values up at its next hop.
+   */
+  setOnsetParameters(threshold: number, silenceDb: number, minIoiMs: number): void;
+  /**
+   * Preallocates `count` pooled onset detectors for this config, so later
+   * initOnsetDetector() / OnsetDetector.configure() calls with the same
+   * sizes and methods take one without allocating.
+   */
+  reserveOnsetDetectors(
+    count: number,
+    sampleRate: number,
+    bufferSize: number,
+    hopSize: number,
+    methods: string[]
+  ): void;
+  warmup(): void;
+  /**
+   * Debug counter: heap allocations the chroma, onset and mel paths made
+   * since this object was created (per-frame scratch that did not fit the
+   * preallocated arena, resample buffer growth). Stays constant in steady
+   * state; the number[]-returning methods still allocate their results.
+   */
+  scratchAllocationCount(): number;
+  /**
+   * Latency per analysis stage since creation or resetPerfStats(), from a
+   * monotonic clock. Returns [frames, then for each stage in the order
+   * resample, fft, chroma, mel, onset, constantQ, bridge: count, p50, p95,
+   * p99], durations in microseconds. `frames` counts FFT frames, onset hops
+   * and constant-Q windows; each stage's count is how many times it ran.
+   * `bridge` is the time a call spent outside the other stages (argument
+   * views, result conversion and copies), not JSI argument conversion.
+   */
+  getPerfStats(): number[];
+  resetPerfStats(): void;
+  /**
+   * Split each FFT bin between its two nearest pitch classes instead of
+   * assigning it to the nearest one (off by default).
+   */
+  setSoftChroma(enabled: boolean): void;
+  /**
+   * Fold only spectral peaks into chroma instead of every bin (off by
+   * default): local maxima within 30 dB of the strongest are refined by
+   * parabolic interpolation and each adds its interpolated power to the
+   * pitch class of its exact frequency, so the noise floor between partials
+   * stays out. Replaces setSoftChroma(); the last of the two calls wins.
+   */
+  setPeakChroma(enabled: boolean): void;
+  /**
+   * Median-filter harmonic/percussive separation on the FFT chroma already
+   * uses (off by default): chroma folds only the sustained harmonic part, so
+   * strum transients no longer smear it, and analyzeFrame()'s onset detector
+   * sees only the percussive part of the same spectrum. analyzeFrame() calls
+   * form one stream (about 9 frames of history, cleared by
+   * resetOnsetDetector()); the whole-buffer chroma methods separate each
+   * buffer on its own.
+   */
+  setHarmonicPercussive(enabled: boolean): void;
+  /**
+   * Adaptive spectral whitening of analyzeFrame()'s spectrum (off by
+   * default): each bin is divided by a slowly decaying peak of its own past
+   * magnitudes, once per frame, and both chroma and the onset descriptors
+   * read the result, so the detector skips its own whitening. The peaks
+   * decay per onset hop and are cleared by enabling or resetOnsetDetector();
+   * the whole-buffer chroma methods are not whitened.
+   */
+  setSpectralWhitening(enabled: boolean): void;
+  /**
+   * Running estimate of the instrument's tuning from analyzeFrame()'s
+   * spectra (off by default): spectral peaks are located to a fraction of a
+   * bin and their deviations from equal temperament averaged over about two
+   * seconds. While enabled, analyzeFrame() folds chroma around semitones
+   * shifted by the estimate, in 10 cent steps. Cleared by enabling or
+   * resetOnsetDetector(); the whole-buffer chroma methods stay at A440.
+   */
+  setTuningEstimation(enabled: boolean): void;
+  /** Current tuning estimate in cents from A440, in [-50, 50); 0 while disabled. */
+  getTuningOffset(): number;
+  /**
+   * Spectral shape of every analyzeFrame() magnitude spectrum (off by
+   * default), the whitened one while whitening: [centroid, spread, skewness,
+   * kurtosis, slope, decrease, rolloff, flux, flatness], with aubio's
+   * definitions in FFT bins (bin k is k * sampleRate / 2048 Hz). Flux sums
+   * the magnitude rises since the previous frame and is cleared by enabling
+   * or resetOnsetDetector(); flatness is near 0 for a few clear partials
+   * and about 0.56 for white noise. All nine come from two passes over the
+   * spectrum analyzeFrame() already has.
+   */
+  setSpectralFeatures(enabled: boolean): void;
+  /** The 9 features of the last analyzeFrame(), zeros before the first; empty while disabled. */
+  getSpectralFeatures(): number[];
+  /**
+   * Offline mode for long recordings: computeMelSpectrogram() and
+   * computeMelSpectrogramInto() split inputs of 64+ frames across this many
+   * threads (including the calling one), each with its own FFT plan and
+   * scratch. 1 (default) stays single threaded; 0 uses the core count, up
+   * to 8. Results are identical either way.
+   */
+  setMelThreads(threads: number): void;
+  /**
+   * One FFT over the latest 2048 samples feeding chroma, bass chroma and onset.
+   * Returns [chroma x12, bassChroma x12, isOnset, onsetDescriptor].
+   */
+  analyzeFrame(samples: number[], sampleRate: number): number[];
+
+  // Float32 variants: `samples` is read in place and results are written into
+  // `output` (which must be large enough) instead of allocating number arrays.
+  // Analysis is float32 internally, so these skip the number[] conversions.
+  /** Samples resampleTo22050Into() writes for `numSamples` input samples. */
+  resampledLength(numSamples: number, sourceSampleRate: number): number;
+  /** Returns the number of samples written, resampledLength() of the input. */
+  resampleTo22050Into(samples: ArrayBuffer, sourceSampleRate: number, output: ArrayBuffer): number;
+  /**
+   * Returns the number of 229-bin mel frames written. `scale` is "log"
+   * (natural log, default), "db" (10 * log10) or "power" (linear); bands
+   * are floored at 1e-10 first.
+   */
+  computeMelSpectrogramInto(samples: ArrayBuffer, sampleRate: number, output: ArrayBuffer, scale?: string): number;
+
+  // `normalization` scales each chroma vector natively: "max" (default, the
+  // largest bin is 1), "l1" (bins sum to 1), "l2" (unit length) or "none".
+  computeChromagramInto(samples: ArrayBuffer, sampleRate: number, output: ArrayBuffer, normalization?: string): void;
+  computeBassChromagramInto(samples: ArrayBuffer, sampleRate: number, output: ArrayBuffer, normalization?: string): void;
+  /** STFT frames (2048-sample window, 512-sample hop) in `numSamples` samples. */
+  chromaFrameCount(numSamples: number): number;
+  /**
+   * Chromagram timeline from one STFT pass: frame f (samples f * 512 to
+   * f * 512 + 2048 at `sampleRate`) is [chroma x12, bassChroma x12], each
+   * normalized per frame. `output` must hold chromaFrameCount() * 24 floats;
+   * returns the frame count. computeChromagramInto() stays the cheap
+   * aggregate: the sum of the "none" frames, normalized once.
+   */
+  computeChromaFramesInto(samples: ArrayBuffer, sampleRate: number, output: ArrayBuffer, normalization?: string): number;
+  /**
+   * Writes the detectOnset() layout: 2 values, or 2 + number of descriptors
+   * for several.
+   */
+  detectOnsetInto(samples: ArrayBuffer, output: ArrayBuffer): void;
+  /**
+   * Offline onset detection over a whole Float32 recording with a fresh
+   * detector (2048-sample window, 1024-sample hop, the current
+   * setOnsetDescriptors() config); the streaming detector is left untouched.
+   * Returns Float32 [numOnsets, numHops, onset time in seconds x numOnsets,
+   * fused descriptor x numHops].
+   */
+  detectOnsetsBatch(samples: ArrayBuffer, sampleRate: number): ArrayBuffer;
+  /**
+   * Analyzes a WAV file (16/24/32-bit PCM or float, any channel count, a
+   * path or file:// URI) straight from disk: the file is memory-mapped and
+   * read hop by hop, so memory stays flat however long the recording is.
+   * Each hop runs analyzeFrame() on a 2048-sample window (hopSize defaults
+   * to 1024) with the current soft chroma, harmonic/percussive, whitening
+   * and onset descriptor settings; hops under minRms (default 0.0005) count
+   * as silence. Chords come from a fixed-lag Viterbi decoder with the
+   * ChordClassifier.configureDecoder() defaults. Returns Float32
+   * [sampleRate, hopSize, numHops, numOnsets, numChords,
+   * onset time in seconds x numOnsets,
+   * [chroma x12, bassChroma x12] x numHops (hop h starts at h * hopSize),
+   * [start seconds, root, quality, confidence] x numChords], one chord per
+   * run with root -1 for N/C.
+   */
+  analyzeFile(path: string, hopSize?: number, minRms?: number): ArrayBuffer;
+  analyzeFrameInto(samples: ArrayBuffer, sampleRate: number, output: ArrayBuffer, normalization?: string): void;
+
+  // Constant-Q mode: `numBins` is 36 (C1-B3, bass) or 84 (C1-B7), 12 per octave.
+  /** Samples computeConstantQInto() reads from the end of `samples`. */
+  constantQWindowSize(sampleRate: number, numBins: number): number;
+  /** Writes [magnitude x numBins (lowest first), chroma x12] into `output`. */
+  computeConstantQInto(
+    samples: ArrayBuffer,
+    sampleRate: number,
+    numBins: number,
+    output: ArrayBuffer,
+    normalization?: string
+  ): void;
+
+  // Promise variants of the heavy batch calls, run on a shared pool of two
+  // native threads so the JS thread stays free. The input is copied before
+  // returning. `lane` names one stream of requests (e.g. "inference",
+  // "import"): a new call on a lane replaces its call still waiting and
+  // rejects it with "<method>: cancelled", as it does a running call whose
+  // result arrives after a newer one was made. Settings are those in effect
+  // at the call.
+  /** computeMelSpectrogramInto() into a new buffer of numFrames * 229 floats. */
+  computeMelSpectrogramAsync(samples: ArrayBuffer, sampleRate: number, lane: string, scale?: string): Promise<ArrayBuffer>;
+  /** detectOnsetsBatch() off the JS thread. */
+  detectOnsetsBatchAsync(samples: ArrayBuffer, sampleRate: number, lane: string): Promise<ArrayBuffer>;
+  /** analyzeFile() off the JS thread; a cancelled call stops at its next hop. */
+  analyzeFileAsync(path: string, lane: string, hopSize?: number, minRms?: number): Promise<ArrayBuffer>;
+  /** Rejects the lane's waiting and running calls with "<method>: cancelled". */
+  cancelAsync(lane: string): void;
 }
@@ -0,0 +1,33 @@
+import { type HybridObject } from "react-native-nitro-modules";
+
+/**
+ * Native bank of note resonators for targeted pitch queries such as the
+ * tuner's "is this string in tune": energy at a few dozen known pitches
+ * (see PIANO_NOTES and GUITAR_STRINGS), updated per sample at a fixed cost
+ * per note instead of a full FFT per 2048-sample window. Each note's
+ * window is constant-Q, so high notes respond in a few milliseconds.
+ */
+export interface NoteBank extends HybridObject<{ ios: "c++" }> {
+  /**
+   * One resonator per entry of `notes`, MIDI note numbers tuned to
+   * `referenceHz` for A4 (default 440). Fractional notes sit between the
+   * semitones: 40.1 is the low E string 10 cents sharp. Each band is
+   * `bandwidthCents` wide (default 50, a window of about 25 ms at A4 and
+   * 130 ms at E2). Clears the resonators.
+   */
+  configure(sampleRate: number, notes: number[], referenceHz?: number, bandwidthCents?: number): void;
+  /** Runs float32 mono samples, any count, through every resonator. */
+  process(samples: ArrayBuffer): void;
+  /**
+   * Writes one float per configured note, in order: the amplitude of a
+   * sinusoid at the note's pitch that would give its current response.
+   */
+  readInto(output: ArrayBuffer): void;
+  /**
+   * Writes 12 floats, C first: per pitch class, the root sum of squares of
+   * the amplitudes of its notes (each rounded to the nearest semitone).
+   */
+  readPitchClassesInto(output: ArrayBuffer): void;
+  /** Clears the resonators, as for a new stream. */
+  reset(): void;
+}
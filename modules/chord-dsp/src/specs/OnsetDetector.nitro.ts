@@ -0,0 +1,37 @@
+import { type HybridObject } from "react-native-nitro-modules";
+
+/**
+ * An independent aubio onset detector, e.g. one per input or one for a
+ * background file. Detectors come from a native pool shared by every
+ * instance (see ChordDSP.reserveOnsetDetectors()), so configuring one with
+ * a config seen before does not allocate.
+ */
+export interface OnsetDetector extends HybridObject<{ ios: "c++" }> {
+  /**
+   * Takes a detector from the pool for these sizes and fused methods (see
+   * ChordDSP.setOnsetDescriptors()), returning any previous one first.
+   */
+  configure(
+    sampleRate: number,
+    bufferSize: number,
+    hopSize: number,
+    methods: string[],
+    weights: number[]
+  ): void;
+  /**
+   * Runs one hop of float32 `samples` and writes [isOnset, fused descriptor]
+   * into `output`, then descriptor x methods.length for several methods.
+   */
+  process(samples: ArrayBuffer, output: ArrayBuffer): void;
+  /**
+   * Threshold, silence gate (dB) and minimum inter-onset interval (ms), as
+   * ChordDSP.setOnsetParameters(); applied before the next process()
+   * without resetting the detector. configure() restores the defaults.
+   */
+  setParameters(threshold: number, silenceDb: number, minIoiMs: number): void;
+  /** Number of values process() writes. */
+  resultSize(): number;
+  reset(): void;
+  /** Returns the detector to the pool; configure() again before process(). */
+  release(): void;
+}
@@ -0,0 +1,24 @@
+import { type HybridObject } from "react-native-nitro-modules";
+
+/**
+ * Native YIN pitch tracker for the tuner, replacing pitchfinder's YIN and
+ * enhancePitchfinderResult() from src/utils/enhancedPitchDetection.ts. The
+ * difference function is computed with FFTs, so a 2048-sample buffer costs
+ * tens of microseconds instead of a quadratic loop on the JS thread.
+ */
+export interface PitchTracker extends HybridObject<{ ios: "c++" }> {
+  /**
+   * Analysis buffer length in samples (lags up to half of it are searched)
+   * and YIN threshold, pitchfinder's `threshold` option (0.1 by default
+   * there). Rebuilds the FFT plan only when the sizes change.
+   */
+  configure(sampleRate: number, bufferSize: number, threshold: number): void;
+  /**
+   * Analyzes the latest bufferSize float32 samples and writes [frequency,
+   * probability, autocorrPeak, confidence, jitter] into `output`: frequency
+   * in Hz (0 if no pitch), the YIN periodicity, and the normalized
+   * autocorrelation peak, confidence and jitter (Hz) that
+   * enhancePitchfinderResult() derives. Returns whether a pitch was found.
+   */
+  detectInto(samples: ArrayBuffer, output: ArrayBuffer): boolean;
+}
@@ -0,0 +1,254 @@
+import { type HybridObject } from "react-native-nitro-modules";
+
+/**
+ * Owns the live audio history and runs one analysis per hop natively.
+ * JS pushes raw recorder chunks and pulls finished frames, either analyzed
+ * synchronously inside pullFrames() or, after startWorker(), ahead of time
+ * on a native thread.
+ */
+export interface StreamingChordAnalyzer extends HybridObject<{ ios: "c++" }> {
+  /**
+   * Sets up the ring, onset detector and gate. Clears history and pending
+   * hops and stops the worker; call before the first pushSamples().
+   * `historySize` is the number of raw samples kept for readHistory().
+   */
+  configure(
+    sampleRate: number,
+    hopSize: number,
+    historySize: number,
+    inputGain: number,
+    minRms: number
+  ): void;
+  /** Appends mono float32 samples; pushPcm(samples, "float32", 1) without the levels. */
+  pushSamples(samples: ArrayBuffer): void;
+  /**
+   * Appends a recorder chunk of interleaved `channels`-channel PCM in
+   * `format` ("float32", "int16" or "int32", native endian; integers are
+   * scaled from full scale). One native pass converts, downmixes to the
+   * channel mean, applies the input gain and the setPreFilter() filter and
+   * clamps to [-1, 1] on the way into the history, so every later read
+   * (hops, readHistory(), mel windows) sees the conditioned audio. Returns
+   * [rms, peak] of the conditioned chunk, for level meters and clip
+   * indicators; a chunk longer than the history is measured over the part
+   * kept.
+   */
+  pushPcm(samples: ArrayBuffer, format: string, channels: number): number[];
+  /**
+   * Analyzes every hop completed since the last call and writes one frame per
+   * hop into `output`: [chroma x12, bassChroma x12, isOnset, onsetDescriptor,
+   * rms, active]. Frames with active == 0 were below `minRms` and carry only
+   * the rms; active == 2 marks a hop the change gate held, which repeats the
+   * last analyzed frame with isOnset 0. Frames the worker queued come first; while no worker runs, the
+   * remaining hops are analyzed here. Returns the number of frames written.
+   */
+  pullFrames(output: ArrayBuffer): number;
+  /**
+   * Onset segments finished since the last call, oldest first, 27 values
+   * each: [chroma x12, bassChroma x12 (each max-normalized), hops, onset,
+   * onsetDescriptor]. A segment sums the chroma of every active hop from one
+   * onset to the next; `onset` is 0 when it continues a segment cut at
+   * setOnsetSegments()'s maxSeconds, and onsetDescriptor is that of its
+   * first hop. Segments are produced alongside the frames (on the worker if
+   * one runs). Returns the number written, 0 while segments are disabled.
+   */
+  pullSegments(output: ArrayBuffer): number;
+  /** Fills `output` with the latest samples, gained and clamped. */
+  readHistory(output: ArrayBuffer): void;
+  /**
+   * Writes the latest `output.byteLength / 4 / 229` log-mel frames (BasicPitch
+   * input, oldest first) of the gained, clamped audio. Only frames completed
+   * since the previous call are computed; frames older than the stream read
+   * as silence. Frames are cached as float16, half the memory, and read
+   * back within 0.008 of the float32 log values. Call from the same thread
+   * as pullFrames(). Returns the number of frames written.
+   */
+  readMelWindow(output: ArrayBuffer): number;
+  /**
+   * readMelWindow() into a native buffer instead of a JS one: writes the
+   * latest `frames` mel frames and returns the buffer's shared handle, which
+   * native consumers (ChordModelInference.runInferenceShared()) read in
+   * place through chord_dsp_shared_buffer_retain(). The handle stays the same
+   * across calls unless `frames` changes or a consumer still holds the
+   * previous window.
+   */
+  readMelWindowShared(frames: number): number;
+  reset(): void;
+  /**
+   * Harmonic/percussive separation for the per-hop analysis, as
+   * ChordDSP.setHarmonicPercussive(): chroma gets the harmonic part and the
+   * onset detector the percussive part of each hop's spectrum. Clears the
+   * separation history; a running worker is paused around the change.
+   */
+  setHarmonicPercussive(enabled: boolean): void;
+  /**
+   * Spectral whitening of each hop's spectrum, shared by chroma and the onset
+   * detector, as ChordDSP.setSpectralWhitening(). Clears the whitening peaks;
+   * a running worker is paused around the change.
+   */
+  setSpectralWhitening(enabled: boolean): void;
+  /**
+   * Tuning estimation for the per-hop analysis, as
+   * ChordDSP.setTuningEstimation(): chroma follows an instrument tuned away
+   * from A440. Clears the estimate; a running worker is paused around the
+   * change.
+   */
+  setTuningEstimation(enabled: boolean): void;
+  /** Current tuning estimate in cents, readable while the worker runs; 0 while disabled. */
+  getTuningOffset(): number;
+  /**
+   * Spectral features of each analyzed hop, as
+   * ChordDSP.setSpectralFeatures(), doubling as a noise gate for the chord
+   * decisions: with noiseFlatness in (0, 1], hops whose flatness reaches it
+   * (hiss, breath, broadband noise) still reach pullFrames() but not the
+   * key estimate, the onset segments or the chord events; 0 turns the gate
+   * off. Clears the flux history; a running worker is paused around the
+   * change.
+   */
+  setSpectralFeatures(enabled: boolean, noiseFlatness: number): void;
+  /** The 9 features of the latest analyzed hop, readable while the worker runs; empty while disabled. */
+  getSpectralFeatures(): number[];
+  /**
+   * Peak-only chroma for the per-hop analysis and the long bass transform,
+   * as ChordDSP.setPeakChroma(). A running worker is paused around the
+   * change.
+   */
+  setPeakChroma(enabled: boolean): void;
+  /**
+   * Skips the FFT and onset detector for hops that did not change: when the
+   * window's energy and brightness (first-difference energy over energy)
+   * are both within `tolerance` (relative, e.g. 0.05) of the last analyzed
+   * window, the hop repeats that frame with active == 2, at most
+   * `maxHeldHops` times in a row. 0 disables the gate (default). Held hops
+   * are not fed to the onset detector.
+   */
+  setChangeGate(tolerance: number, maxHeldHops: number): void;
+  /**
+   * Load-adaptive analysis (off by default). Each analyzed hop's time
+   * against its real-time budget and the backlog of unanalyzed hops and
+   * unpulled frames pick a level from 0 to 3: raised after 0.25 s of load
+   * above 50% or more than 0.5 s of backlog, lowered after 3 s of calm.
+   * Level 2 folds chroma every 2nd hop and level 3 every 4th, repeating the
+   * last chroma in between; onset detection and the hop size never change.
+   */
+  setAdaptiveScheduling(enabled: boolean): void;
+  /**
+   * Device thermal state, 0 (nominal) to 3 (critical) as in iOS
+   * ProcessInfo.ThermalState: the schedule level never drops below it, with
+   * or without adaptive scheduling.
+   */
+  setThermalState(state: number): void;
+  /**
+   * Current schedule: [level, chromaStride (hops per chroma fold),
+   * melStride (multiplier for the caller's mel/ML period), load (smoothed
+   * analysis time over the hop duration)].
+   */
+  getSchedule(): number[];
+  /**
+   * Onset-synchronous chroma for pullSegments() (off by default). Onsets
+   * less than `minSeconds` into a segment are merged into it and segments
+   * are cut at `maxSeconds` so sustained chords keep updating. Silence drops
+   * the running segment; up to 64 finished segments wait for
+   * pullSegments(), newer ones are dropped while it is full.
+   */
+  setOnsetSegments(enabled: boolean, minSeconds: number, maxSeconds: number): void;
+  /**
+   * Dual-resolution analysis from the same ring (off with 0, the default):
+   * every `hops` hops that fold chroma, the bass chroma comes from one
+   * 8192-point FFT (about 0.5 s at 16 kHz, a quarter of the bin width of
+   * the per-hop 2048-point one) and is reused until the next, while onsets
+   * and the treble chroma keep the short per-hop window. At 4 the long
+   * transform adds less per hop than the short analysis itself costs.
+   * `hops` is at most 64; a running worker is paused around the change.
+   */
+  setBassInterval(hops: number): void;
+  /**
+   * Onset threshold, silence gate (dB) and minimum inter-onset interval
+   * (ms), as ChordDSP.setOnsetParameters(). Safe while the worker runs: the
+   * values are handed over lock-free and take effect at the next hop,
+   * without pausing the worker or resetting the detector. configure()
+   * keeps them.
+   */
+  setOnsetParameters(threshold: number, silenceDb: number, minIoiMs: number): void;
+  /**
+   * Running key estimate (off by default): the chroma of every active hop
+   * is added to a histogram that decays with `halfLifeSeconds`, and each
+   * hop correlates it with the 24 Krumhansl-Kessler major and minor
+   * profiles at constant cost. Silent hops leave it; reset() and
+   * re-enabling clear it. A running worker is paused around the change.
+   */
+  setKeyEstimation(enabled: boolean, halfLifeSeconds: number): void;
+  /**
+   * Current key as [tonic (pitch class, 0 = C, -1 before any estimate),
+   * mode (0 major, 1 minor), correlation (Pearson, -1 to 1), margin over
+   * the runner-up key]. Readable while the worker runs.
+   */
+  getKey(): number[];
+  /**
+   * Pre-filter for the conditioning pass of pushSamples() and pushPcm() (off
+   * by default): a one-pole DC blocker at `dcCutoffHz`, a 4th-order
+   * Butterworth high-pass at `highPassHz` against handling noise and
+   * rumble, and pre-emphasis y[n] = x[n] - preEmphasis * x[n-1]; 0 leaves a
+   * part out and all three 0 turn the filter off. It runs after the gain and
+   * before the clamp, so the history, hops, mel windows and the levels
+   * pushPcm() returns all see filtered audio. Needs configure(), which
+   * redesigns it for the new sample rate; reset() clears its state.
+   */
+  setPreFilter(dcCutoffHz: number, highPassHz: number, preEmphasis: number): void;
+  /**
+   * A custom pre-filter in place of setPreFilter()'s: up to 4 second-order
+   * sections in series, 5 values each [b0, b1, b2, a1, a2] with a0 = 1. An
+   * empty array turns the filter off. Throws for an unstable section.
+   */
+  setPreFilterSections(coefficients: number[]): void;
+  /**
+   * Moves hop analysis onto a high-priority native thread that wakes on
+   * pushSamples(). Finished frames wait in a lock-free queue for
+   * pullFrames(); `onFrames` is called on the JS thread with the number
+   * waiting, at most once per `callbackIntervalMs` and not again until
+   * pullFrames() has run. While the queue is full the worker pauses, and if
+   * it falls behind the history the oldest hops are dropped as in
+   * pullFrames().
+   */
+  startWorker(
+    callbackIntervalMs: number,
+    onFrames: (available: number) => void
+  ): void;
+  /** Joins the worker; frames it queued can still be pulled. */
+  stopWorker(): void;
+  /**
+   * Native chord decisions, so JS hears only about changes: each onset
+   * segment (each active hop while segments are off) is classified as
+   * ChordClassifier.classifyTwoStageInto() with the smoothed root as
+   * previous root, fused with setChordHint()'s ML chord, boosted when
+   * diatonic to a clear getKey() estimate (margin 0.05 or more, x1.1) and
+   * run through ChordSmoother with the given parameters at stream time.
+   * An event is queued when the smoothed chord changes, or when its
+   * confidence leaves +-`confidenceBand` of the last one reported. A silent
+   * hop, or `minHoldMs` of hops the setSpectralFeatures() gate calls noise,
+   * drops a reported chord to N/C with one event and restarts the tracker;
+   * events are 5 values [seconds, root, quality, confidence, changed], root
+   * -1 for N/C, quality as in ChordClassifier and changed 0 for a
+   * confidence-only update. Queued events reach `onEvents` in one batch at
+   * most once per `frameIntervalMs` (e.g. 16 for one per UI frame), from
+   * the worker if one runs and otherwise from pullFrames(). Restarts the
+   * tracker; a running worker is paused around the change.
+   */
+  startChordEvents(
+    minHoldMs: number,
+    minFramesToConfirm: number,
+    hysteresisMargin: number,
+    confidenceBand: number,
+    frameIntervalMs: number,
+    onEvents: (events: number[]) => void
+  ): void;
+  /** Stops chord events; queued ones are dropped. */
+  stopChordEvents(): void;
+  /**
+   * Latest ML chord for startChordEvents() ([root, quality] as in
+   * ChordClassifier, root -1 to clear), kept until the next hint or
+   * reset(). It boosts an agreeing chroma chord by 15%, and replaces one
+   * below 0.5 confidence when its own is above 0.8. Safe while the worker
+   * runs; ignored while chord events are off.
+   */
+  setChordHint(root: number, quality: number, confidence: number): void;
+}
@@ -0,0 +1,110 @@
+// Writes cpp/dsp/DSPTablesData.cpp: the mel filterbank and resampler taps
+// for the configurations the app always uses, computed with the same code
+// the library would run at startup. See DSPTables.hpp.
+//
+//   generate_dsp_tables <output.cpp>          # (re)write the tables
+//   generate_dsp_tables --check <output.cpp>  # exit 1 if they are stale
+#include "dsp/ChordDSPCore.hpp"
+#include "dsp/MelFilterbank.hpp"
+#include "dsp/PolyphaseResampler.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace margelo::nitro::chorddsp;
+
+namespace {
+
+// Capture rates resampled to the mel rate
+constexpr int kResampleSourceRates[] = {16000, 44100, 48000};
+
+// Shortest decimal that reads back as the same float, as a float literal
+std::string floatLiteral(float value) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.9g", value);
+  std::string s = buf;
+  if (s.find_first_of(".en") == std::string::npos) s += ".0";
+  return s + "f";
+}
+
+void writeFloats(std::ostringstream& out, const float* values, int count) {
+  for (int i = 0; i < count; i++) {
+    out << (i % 8 == 0 ? "    " : " ") << floatLiteral(values[i]) << ",";
+    if (i % 8 == 7 || i + 1 == count) out << "\n";
+  }
+}
+
+std::string generate() {
+  std::ostringstream out;
+  out << "// Generated by tools/GenerateDSPTables.cpp, do not edit. Regenerate with\n"
+         "//   cmake -S modules/chord-dsp/tools -B build/tools\n"
+         "//   cmake --build build/tools --target dsp_tables\n"
+         "#include \"DSPTables.hpp\"\n\n"
+         "namespace margelo::nitro::chorddsp {\n\n"
+         "namespace {\n\n";
+
+  MelFilterbank mel(ChordDSPCore::kMelBins, ChordDSPCore::kFFTSize, ChordDSPCore::kTargetSampleRate, ChordDSPCore::kMinFreq, ChordDSPCore::kMaxFreq, false);
+  out << "// " << mel.numBands() << " mel bands, " << ChordDSPCore::kFFTSize << "-point FFT at " << ChordDSPCore::kTargetSampleRate << " Hz, "
+      << ChordDSPCore::kMinFreq << "-" << ChordDSPCore::kMaxFreq << " Hz\n";
+  out << "const MelFilterbank::Band kMelBands[] = {\n";
+  for (int m = 0; m < mel.numBands(); m++) {
+    const MelFilterbank::Band& b = mel.bands()[m];
+    out << "    {" << b.start << ", " << b.length << ", " << b.offset << "},\n";
+  }
+  out << "};\n\nalignas(16) const float kMelWeights[] = {\n";
+  writeFloats(out, mel.weights(), mel.numWeights());
+  out << "};\n\n";
+
+  for (int rate : kResampleSourceRates) {
+    PolyphaseResampler resampler(rate, ChordDSPCore::kTargetSampleRate, false);
+    out << "// " << rate << " -> " << ChordDSPCore::kTargetSampleRate << " Hz: " << resampler.upFactor() << " phases of " << PolyphaseResampler::kTaps
+        << " taps\n";
+    out << "alignas(16) const float kResampler" << rate << "[] = {\n";
+    writeFloats(out, resampler.taps(), resampler.upFactor() * PolyphaseResampler::kTaps);
+    out << "};\n\n";
+  }
+
+  out << "} // namespace\n\n";
+  out << "const MelTable kMelTables[] = {\n";
+  out << "    {" << ChordDSPCore::kMelBins << ", " << ChordDSPCore::kFFTSize << ", " << ChordDSPCore::kTargetSampleRate << ", "
+      << floatLiteral(ChordDSPCore::kMinFreq) << ", " << floatLiteral(ChordDSPCore::kMaxFreq) << ", kMelBands, kMelWeights, " << mel.numWeights() << "},\n";
+  out << "};\nconst int kNumMelTables = 1;\n\n";
+
+  out << "const ResamplerTable kResamplerTables[] = {\n";
+  for (int rate : kResampleSourceRates) {
+    PolyphaseResampler resampler(rate, ChordDSPCore::kTargetSampleRate, false);
+    out << "    {" << rate << ", " << ChordDSPCore::kTargetSampleRate << ", " << resampler.upFactor() << ", " << resampler.downFactor() << ", "
+        << PolyphaseResampler::kTaps << ", kResampler" << rate << "},\n";
+  }
+  out << "};\nconst int kNumResamplerTables = " << std::size(kResampleSourceRates) << ";\n\n";
+  out << "} // namespace margelo::nitro::chorddsp\n";
+  return out.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  bool check = argc == 3 && std::strcmp(argv[1], "--check") == 0;
+  if (argc != 2 && !check) {
+    std::fprintf(stderr, "usage: %s [--check] <DSPTablesData.cpp>\n", argv[0]);
+    return 2;
+  }
+  const char* path = argv[argc - 1];
+  std::string tables = generate();
+
+  if (check) {
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream current;
+    current << in.rdbuf();
+    if (current.str() != tables) {
+      std::fprintf(stderr, "%s is stale, regenerate it\n", path);
+      return 1;
+    }
+    return 0;
+  }
+
+  std::ofstream(path, std::ios::binary) << tables;
+  return 0;
+}
@@ -32,6 +32,22 @@ export async function runInference(
   };
 }
 
+/**
+ * Runs the model on a mel window chord-dsp wrote natively
+ * (StreamingChordAnalyzer.readMelWindowShared() returns `handle`), without
+ * copying it through JS. Returns the note activations, 88 per frame.
+ */
+export async function runInferenceShared(
+  handle: number,
+  nFrames: number
+): Promise<Float32Array> {
+  const notes = await ChordModelInferenceModule.runInferenceShared(
+    handle,
+    nFrames
+  );
+  return new Float32Array(notes);
+}
+
 export function isModelLoaded(): boolean {
   return ChordModelInferenceModule.isModelLoaded();
 }
@@ -0,0 +1,21 @@
+#pragma once
+
+// Shared native buffers exported by chord-dsp (NitroChordDsp); a copy of
+// modules/chord-dsp/cpp/ChordDspSharedBuffer.h, keep the two in sync.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Keeps buffer `handle` alive until the matching release and returns its
+// data, with its length in floats in *size; NULL if the handle is unknown
+float* chord_dsp_shared_buffer_retain(int64_t handle, size_t* size);
+
+void chord_dsp_shared_buffer_release(int64_t handle);
+
+#ifdef __cplusplus
+}
+#endif
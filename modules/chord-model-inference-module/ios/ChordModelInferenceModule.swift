@@ -84,6 +84,69 @@ public class ChordModelInferenceModule: Module {
       return result
     }
 
+    // Same model on a mel window chord-dsp wrote into a shared native buffer
+    // (StreamingChordAnalyzer.readMelWindowShared()): the MLMultiArray wraps
+    // that memory, retained until Core ML lets go of the array, and only the
+    // note activations come back
+    AsyncFunction("runInferenceShared") { (handle: Int64, nFrames: Int) -> [Float] in
+      guard let model = self.model else {
+        throw NSError(domain: "ChordModelInference", code: 3, userInfo: [
+          NSLocalizedDescriptionKey: "Model not loaded. Call loadModel() first."
+        ])
+      }
+
+      let melBins = 229
+
+      var size = 0
+      guard let data = chord_dsp_shared_buffer_retain(handle, &size) else {
+        throw NSError(domain: "ChordModelInference", code: 5, userInfo: [
+          NSLocalizedDescriptionKey: "Unknown shared mel buffer \(handle)"
+        ])
+      }
+      guard nFrames > 0, size >= nFrames * melBins else {
+        chord_dsp_shared_buffer_release(handle)
+        throw NSError(domain: "ChordModelInference", code: 4, userInfo: [
+          NSLocalizedDescriptionKey: "Shared mel buffer holds \(size) floats, \(nFrames) frames need \(nFrames * melBins)"
+        ])
+      }
+
+      let inputArray: MLMultiArray
+      do {
+        inputArray = try MLMultiArray(
+          dataPointer: data,
+          shape: [1, nFrames, melBins, 1] as [NSNumber],
+          dataType: .float32,
+          strides: [nFrames * melBins, melBins, 1, 1] as [NSNumber],
+          deallocator: { _ in chord_dsp_shared_buffer_release(handle) }
+        )
+      } catch {
+        chord_dsp_shared_buffer_release(handle)
+        throw error
+      }
+
+      let inputFeature = try MLDictionaryFeatureProvider(dictionary: [
+        "input_2": MLFeatureValue(multiArray: inputArray)
+      ])
+
+      let prediction = try model.prediction(from: inputFeature)
+
+      let names = Array(prediction.featureNames)
+      guard let name = names.first(where: { $0.lowercased().contains("note") }) ?? names.first,
+            let notes = prediction.featureValue(for: name)?.multiArrayValue else {
+        return []
+      }
+      if notes.dataType == .float32 {
+        let pointer = notes.dataPointer.bindMemory(to: Float.self, capacity: notes.count)
+        return Array(UnsafeBufferPointer(start: pointer, count: notes.count))
+      }
+      var values: [Float] = []
+      values.reserveCapacity(notes.count)
+      for i in 0..<notes.count {
+        values.append(notes[i].floatValue)
+      }
+      return values
+    }
+
     Function("isModelLoaded") { () -> Bool in
       return self.model != nil
     }
@@ -6,6 +6,7 @@ declare class ChordModelInferenceModuleType extends NativeModule {
     melSpectrogram: number[],
     nFrames: number
   ): Promise<{ [key: string]: number[] }>;
+  runInferenceShared(handle: number, nFrames: number): Promise<number[]>;
   isModelLoaded(): boolean;
 }
 
@@ -18,7 +18,6 @@ import {
   AudioManager,
   type AudioBuffer as AudioApiBuffer,
 } from "react-native-audio-api";
-import Pitchfinder from "pitchfinder";
 
 import { SmoothTunerDisplay } from "./SmoothTunerDisplay";
 import {
@@ -27,9 +26,11 @@ import {
   type StabilizedPitch,
 } from "../hooks/usePitchStabilization";
 import {
-  enhancePitchfinderResult,
   frequencyToNoteInfo,
+  pitchTrackerResult,
+  PITCH_TRACKER_RESULT_SIZE,
 } from "../utils/enhancedPitchDetection";
+import { createPitchTracker, type PitchTracker } from "chord-dsp";
 
 // ============================================================================
 // CONFIGURATION
@@ -125,9 +126,8 @@ export function AudioApiTuner({ isActive: isScreenActive = true }: AudioApiTuner
 
   const audioContextRef = useRef<AudioContext | null>(null);
   const audioRecorderRef = useRef<AudioRecorder | null>(null);
-  const detectPitchRef = useRef<ReturnType<typeof Pitchfinder.YIN> | null>(
-    null
-  );
+  const pitchTrackerRef = useRef<PitchTracker | null>(null);
+  const pitchResultRef = useRef(new Float32Array(PITCH_TRACKER_RESULT_SIZE));
   const inactivityTimeoutRef = useRef<NodeJS.Timeout | null>(null);
   const frameCountRef = useRef(0);
   const isStartedRef = useRef(false);
@@ -179,7 +179,8 @@ export function AudioApiTuner({ isActive: isScreenActive = true }: AudioApiTuner
 
   const processAudioBuffer = useCallback(
     (samples: Float32Array, sampleRate: number) => {
-      if (!detectPitchRef.current) {
+      const pitchTracker = pitchTrackerRef.current;
+      if (!pitchTracker) {
         return;
       }
 
@@ -261,24 +262,23 @@ export function AudioApiTuner({ isActive: isScreenActive = true }: AudioApiTuner
           return;
         }
 
-        // Run pitch detection using CONFIG sample rate (what we requested)
-        const rawFrequency = detectPitchRef.current(analysisBuffer);
+        // Run native YIN pitch detection, which also measures confidence
+        // and jitter, at the AudioContext's actual sample rate
+        const pitchResult = pitchResultRef.current;
+        const found = pitchTracker.detectInto(
+          analysisBuffer.buffer as ArrayBuffer,
+          pitchResult.buffer as ArrayBuffer
+        );
+        const enhanced = pitchTrackerResult(found, pitchResult);
 
         // Log pitch detection result periodically
         if (CONFIG.LOG_ENABLED && frameCountRef.current % 60 === 0) {
           console.log("[AudioApiTuner] Pitch detection:", {
-            rawFrequency,
+            rawFrequency: enhanced.rawFrequency,
             rms: rms.toFixed(4),
           });
         }
 
-        // Enhance with confidence and jitter metrics
-        const enhanced = enhancePitchfinderResult(
-          rawFrequency,
-          analysisBuffer,
-          CONFIG.SAMPLE_RATE // Use config sample rate, not incoming
-        );
-
         // Validate frequency range
         if (
           enhanced.frequency === null ||
@@ -485,10 +485,14 @@ export function AudioApiTuner({ isActive: isScreenActive = true }: AudioApiTuner
       const actualSampleRate = audioContextRef.current.sampleRate;
 
       // Initialize YIN pitch detector with the actual sample rate
-      detectPitchRef.current = Pitchfinder.YIN({
-        sampleRate: actualSampleRate,
-        threshold: CONFIG.YIN_THRESHOLD,
-      });
+      if (!pitchTrackerRef.current) {
+        pitchTrackerRef.current = createPitchTracker();
+      }
+      pitchTrackerRef.current.configure(
+        actualSampleRate,
+        CONFIG.BUFFER_SIZE,
+        CONFIG.YIN_THRESHOLD
+      );
 
       // Create AudioRecorder
       audioRecorderRef.current = new AudioRecorder();
@@ -5,7 +5,7 @@
  * 1. Audio capture via react-native-audio-api
  * 2. Nitro C++ DSP module for chromagram / mel spectrogram
  * 3. CoreML BasicPitch for ML-based note detection
- * 4. JS chord classification via chroma template matching
+ * 4. Native chord classification and smoothing; JS hears only chord changes
  */
 
 import React, { useState, useRef, useEffect, useCallback, memo } from "react";
@@ -26,14 +26,16 @@ import { LegendList, LegendListRef } from "@legendapp/list";
 
 import {
   classifyChromaWithBass,
-  classifyChromaTwoStage,
   classifyChromaTopN,
-  classifyFrame,
-  ChordSmoother,
+  chordFromNative,
   ChordResult,
 } from "../utils/chordClassification";
-import { ChordSequenceContext } from "../utils/chordSequenceContext";
-import { ChordDSP } from "chord-dsp";
+import {
+  createChordClassifier,
+  createStreamingChordAnalyzer,
+  type ChordClassifier,
+  type StreamingChordAnalyzer,
+} from "chord-dsp";
 import * as ChordModelInference from "../../modules/chord-model-inference-module";
 
 // ============================================================================
@@ -46,14 +48,75 @@ const CONFIG = {
   RING_BUFFER_SIZE: 32000, // ~2 seconds at 16kHz
   HOP_SIZE: 1024,
   MIN_RMS_THRESHOLD: 0.005,
+  // Native onset picking: threshold on the fused descriptor, silence gate
+  // and minimum gap; can be changed while the worker runs
+  ONSET_THRESHOLD: 0.3,
+  ONSET_SILENCE_DB: -40,
+  ONSET_MIN_IOI_MS: 50,
+  // Native change gate: hops within 5% of the last analyzed one in energy
+  // and brightness reuse it, for at most 4 hops (~256ms) in a row
+  CHANGE_TOLERANCE: 0.05,
+  MAX_HELD_HOPS: 4,
+  // Analysis frames between ML inferences at schedule level 0; the native
+  // scheduler's melStride stretches it when the device falls behind
+  ML_FRAME_INTERVAL: 4,
   INPUT_GAIN: 10.0,
   FFT_SIZE: 2048,
   MIN_FREQUENCY: 60,
   MAX_FREQUENCY: 2000,
+  // Folding hops per 8192-point bass FFT (~256ms at 1024-sample hops)
+  BASS_FFT_INTERVAL: 4,
+  // Native onset segments: chords are classified once per inter-onset
+  // segment, onsets closer than 120ms merge and sustained chords are re-read
+  // every 500ms
+  MIN_SEGMENT_SECONDS: 0.12,
+  MAX_SEGMENT_SECONDS: 0.5,
+  // Native key estimate: chroma histogram half-life, and the margin over
+  // the runner-up key above which it is shown (and chords diatonic to it
+  // get the native key prior)
+  KEY_HALF_LIFE_SECONDS: 20,
+  KEY_MIN_MARGIN: 0.05,
+  // Native pre-filter on ingest: DC blocker and a high-pass below the low E
+  // (82 Hz) against handling noise and rumble; no pre-emphasis, which would
+  // thin out the bass chroma
+  PRE_FILTER_DC_HZ: 20,
+  PRE_FILTER_HIGH_PASS_HZ: 50,
+  // Native chord events: smoother minimum hold (ms), frames to confirm and
+  // hysteresis, the confidence band a held chord has to leave before JS
+  // hears about it again, and at most one batch per UI frame
+  SMOOTHER_MIN_HOLD_MS: 50,
+  SMOOTHER_CONFIRM_FRAMES: 1,
+  SMOOTHER_HYSTERESIS: 0.03,
+  CONFIDENCE_BAND: 0.1,
+  CHORD_EVENT_INTERVAL_MS: 16,
   MAX_TIMELINE_ENTRIES: 100,
   ROW_HEIGHT: 52,
 };
 
+// StreamingChordAnalyzer.pullFrames layout:
+// [chroma x12, bassChroma x12, isOnset, onsetDescriptor, rms, active]
+const STREAM_FRAME_SIZE = 28;
+// `active` of a hop the change gate held (a repeat of the last analysis)
+const FRAME_HELD = 2;
+// Frames pulled per recorder callback (normally one hop per callback)
+const MAX_PULLED_FRAMES = 8;
+// StreamingChordAnalyzer.pullSegments layout: [chroma x12, bassChroma x12
+// (max-normalized segment sums), hops, onset, onsetDescriptor]
+const STREAM_SEGMENT_SIZE = 27;
+const MAX_PULLED_SEGMENTS = 8;
+// StreamingChordAnalyzer.startChordEvents layout: [seconds, root, quality,
+// confidence, changed]
+const CHORD_EVENT_SIZE = 5;
+
+// Mel frames covering `numSamples` at `sampleRate` (2048-point frames,
+// 512 hop at 22050 Hz), i.e. the BasicPitch window length
+function melFrameCapacity(numSamples: number, sampleRate: number): number {
+  const resampled = Math.ceil((numSamples * 22050) / sampleRate);
+  return resampled < 2048 ? 0 : Math.floor((resampled - 2048) / 512) + 1;
+}
+
+const PITCH_NAMES = ["C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"];
+
 const NOTE_COLORS: Record<string, string> = {
   C: "#FF6B6B",
   "C#": "#FF8E72",
@@ -149,41 +212,40 @@ export function ChordDetection({
   const [isInitialized, setIsInitialized] = useState(false);
   const [dimensions, setDimensions] = useState(Dimensions.get("window"));
   const [mlReady, setMlReady] = useState(false);
+  // Native running key, e.g. "Em"; null until it is clear
+  const [currentKey, setCurrentKey] = useState<string | null>(null);
+  const currentKeyRef = useRef<string | null>(null);
 
   const audioContextRef = useRef<AudioContext | null>(null);
   const audioRecorderRef = useRef<AudioRecorder | null>(null);
   const listRef = useRef<LegendListRef>(null);
   const entryIdRef = useRef(0);
   const isStartedRef = useRef(false);
-  const chordSmootherRef = useRef(new ChordSmoother(50, 1, 0.03));
 
-  const audioBufferRef = useRef<Float32Array>(
-    new Float32Array(CONFIG.RING_BUFFER_SIZE)
+  // Native analyzer owns the audio ring, hop scheduling, gain and RMS gate
+  const analyzerRef = useRef<StreamingChordAnalyzer | null>(null);
+  // Output buffers the native DSP writes into (reused across hops)
+  const frameOutputRef = useRef(
+    new Float32Array(STREAM_FRAME_SIZE * MAX_PULLED_FRAMES)
+  );
+  const segmentOutputRef = useRef(
+    new Float32Array(STREAM_SEGMENT_SIZE * MAX_PULLED_SEGMENTS)
   );
-  const bufferWriteIndexRef = useRef(0);
-  const samplesSinceLastAnalysisRef = useRef(0);
-
-  // Exponential decay chroma accumulator — notes fade naturally over time,
-  // so arpeggiated notes accumulate into a full chord picture
-  const chromaAccumulatorRef = useRef<number[] | null>(null);
-  const bassChromaAccumulatorRef = useRef<number[] | null>(null);
-  const framesAccumulatedRef = useRef(0);
+
   // Separate counter for ML inference gating
   const mlFrameCountRef = useRef(0);
-  // Sequence context for temporal voting (F5)
-  const sequenceContextRef = useRef(new ChordSequenceContext(24));
-  // Onset detector initialization flag
-  const onsetInitializedRef = useRef(false);
+  const mlStrideRef = useRef(1);
+  // Chroma of the latest onset segment, for the alternatives shown with
+  // the next chord event
+  const lastSegmentChromaRef = useRef<number[] | null>(null);
 
   // ML inference lock and latest result
   const mlInferenceInProgressRef = useRef(false);
   const mlReadyRef = useRef(false);
-  const mlLastResultRef = useRef<{
-    chord: string;
-    root: string;
-    quality: string;
-    confidence: number;
-  } | null>(null);
+  // Native classifier for the ML note activations and its [root, quality,
+  // confidence] output
+  const mlClassifierRef = useRef<ChordClassifier | null>(null);
+  const mlChordRef = useRef(new Float32Array(3));
 
   // Load CoreML model on mount
   useEffect(() => {
@@ -217,40 +279,33 @@ export function ChordDetection({
 
   // ML inference pipeline (async) - uses shorter window with recency weighting
   const runMLInference = useCallback(
-    async (samples: Float32Array, sampleRate: number) => {
-      if (mlInferenceInProgressRef.current) return null;
+    async (windowSamples: number, sampleRate: number) => {
+      const analyzer = analyzerRef.current;
+      if (!analyzer || mlInferenceInProgressRef.current) return null;
       mlInferenceInProgressRef.current = true;
 
       try {
-        const samplesArray = Array.from(samples);
-        const melSpec = ChordDSP.computeMelSpectrogram(samplesArray, sampleRate);
-
-        const melBins = 229;
-        const nFrames = Math.floor(melSpec.length / melBins);
+        // The native analyzer keeps a rolling mel cache and only computes the
+        // frames completed since the last call. The window stays native: the
+        // inference module reads it in place through the shared handle.
+        const nFrames = melFrameCapacity(windowSamples, sampleRate);
         if (nFrames === 0) return null;
+        const melHandle = analyzer.readMelWindowShared(nFrames);
 
-        const melFloat32 = new Float32Array(melSpec);
-        const output = await ChordModelInference.runInference(melFloat32, nFrames);
-
-        if (output.notes.length >= 88) {
-          const framesCount = Math.floor(output.notes.length / 88);
-          const avgActivations = new Float32Array(88);
-
-          // Recency-weighted averaging: recent frames contribute more
-          let totalWeight = 0;
-          for (let f = 0; f < framesCount; f++) {
-            const weight = (f + 1) / framesCount; // linear ramp: last frame = 1.0
-            totalWeight += weight;
-            for (let i = 0; i < 88; i++) {
-              avgActivations[i] += output.notes[f * 88 + i] * weight;
-            }
-          }
-          for (let i = 0; i < 88; i++) avgActivations[i] /= totalWeight;
+        const notes = await ChordModelInference.runInferenceShared(melHandle, nFrames);
 
-          return classifyFrame(avgActivations, 0.4);
+        // Native recency-weighted pooling (last frame counts most), 88 -> 12
+        // fold and template match
+        if (!mlClassifierRef.current) {
+          mlClassifierRef.current = createChordClassifier();
         }
-
-        return null;
+        const chord = mlChordRef.current;
+        const pooled = mlClassifierRef.current.classifyActivationsInto(
+          notes.buffer as ArrayBuffer,
+          0.4,
+          chord.buffer as ArrayBuffer
+        );
+        return pooled > 0 ? chordFromNative(chord) : null;
       } catch (err) {
         console.error("[ChordDetection] ML inference error:", err);
         return null;
@@ -261,23 +316,32 @@ export function ChordDetection({
     []
   );
 
+  // `changed` false is a confidence-only update of the current chord: it
+  // touches the top row and never scrolls
   const updateTimeline = useCallback(
-    (smoothed: { smoothedChord: string; root: string; quality: string; confidence: number }) => {
+    (chord: Omit<ChordResult, "chroma">, changed: boolean) => {
+      if (!changed) {
+        setTimeline((prev) =>
+          prev.length > 0 && prev[0].chord === chord.chord
+            ? [{ ...prev[0], confidence: chord.confidence }, ...prev.slice(1)]
+            : prev
+        );
+        return;
+      }
+
       setTimeline((prev) => {
-        if (prev.length > 0 && prev[0].chord === smoothed.smoothedChord) {
-          const updated = { ...prev[0], confidence: smoothed.confidence };
-          return [updated, ...prev.slice(1)];
+        // The first chord after a restart may continue the last row
+        if (prev.length > 0 && prev[0].chord === chord.chord) {
+          return [{ ...prev[0], confidence: chord.confidence }, ...prev.slice(1)];
         }
 
-        if (smoothed.smoothedChord === "N/C") return prev;
-
         const newEntry: ChordTimelineEntry = {
           id: entryIdRef.current++,
           timestamp: Date.now(),
-          chord: smoothed.smoothedChord,
-          root: smoothed.root,
-          quality: smoothed.quality,
-          confidence: smoothed.confidence,
+          chord: chord.chord,
+          root: chord.root,
+          quality: chord.quality,
+          confidence: chord.confidence,
         };
 
         const updated = [newEntry, ...prev];
@@ -291,216 +355,151 @@ export function ChordDetection({
     []
   );
 
-  const processAudioBuffer = useCallback(
-    (samples: Float32Array, sampleRate: number) => {
+  const processFrame = useCallback(
+    (frame: Float32Array, sampleRate: number) => {
       try {
-        const ringBuffer = audioBufferRef.current;
-        const ringSize = CONFIG.RING_BUFFER_SIZE;
-
-        for (let i = 0; i < samples.length; i++) {
-          ringBuffer[bufferWriteIndexRef.current] = samples[i];
-          bufferWriteIndexRef.current =
-            (bufferWriteIndexRef.current + 1) % ringSize;
-        }
-
-        samplesSinceLastAnalysisRef.current += samples.length;
-
-        if (samplesSinceLastAnalysisRef.current < CONFIG.HOP_SIZE) return;
-        samplesSinceLastAnalysisRef.current %= CONFIG.HOP_SIZE;
-
-        // Extract analysis window with gain
-        const analysisSize = CONFIG.FFT_SIZE;
-        const analysisBuffer = new Float32Array(analysisSize);
-        const startIdx =
-          (bufferWriteIndexRef.current - analysisSize + ringSize) % ringSize;
-
-        const gain = CONFIG.INPUT_GAIN;
-        let rms = 0;
-
-        for (let i = 0; i < analysisSize; i++) {
-          const sample = ringBuffer[(startIdx + i) % ringSize] * gain;
-          const clamped = Math.max(-1, Math.min(1, sample));
-          analysisBuffer[i] = clamped;
-          rms += clamped * clamped;
-        }
-
-        rms = Math.sqrt(rms / analysisSize);
-
-        if (rms < CONFIG.MIN_RMS_THRESHOLD) {
+        // Native RMS gate: inactive frames were below MIN_RMS_THRESHOLD
+        if (frame[27] === 0) {
           setIsListening(false);
-          chromaAccumulatorRef.current = null;
-          bassChromaAccumulatorRef.current = null;
-          framesAccumulatedRef.current = 0;
           mlFrameCountRef.current = 0;
-          sequenceContextRef.current.reset();
-          setAlternatives([]);
+          // Keep the state as is when already empty, so silence re-renders nothing
+          setAlternatives((prev) => (prev.length > 0 ? [] : prev));
           return;
         }
 
         setIsListening(true);
+        // Held hops repeat the frame already analyzed
+        if (frame[27] === FRAME_HELD) return;
 
-        const analysisArray = Array.from(analysisBuffer);
-
-        // Nitro C++ DSP: compute full + bass chromagrams
-        const frameChroma = ChordDSP.computeChromagram(analysisArray, sampleRate);
-        const frameBassChroma = ChordDSP.computeBassChromagram(analysisArray, sampleRate);
-
-        // aubio onset detection: extract latest HOP_SIZE samples
-        let isOnset = false;
-        let onsetStrength = 0;
-        if (onsetInitializedRef.current) {
-          const hopSize = CONFIG.HOP_SIZE;
-          const hopStart = (bufferWriteIndexRef.current - hopSize + ringSize) % ringSize;
-          const hopSamples = new Array(hopSize);
-          for (let i = 0; i < hopSize; i++) {
-            hopSamples[i] = ringBuffer[(hopStart + i) % ringSize] * gain;
-          }
-          const onsetResult = ChordDSP.detectOnset(hopSamples);
-          isOnset = onsetResult[0] > 0;
-          onsetStrength = onsetResult[1];
-        }
-
-        // Adaptive decay accumulator for full chroma
-        const acc = chromaAccumulatorRef.current;
-        const avgChroma = new Array(12);
-
-        if (acc === null) {
-          for (let i = 0; i < 12; i++) avgChroma[i] = frameChroma[i];
-        } else {
-          let flux = 0;
-          for (let i = 0; i < 12; i++) {
-            const increase = frameChroma[i] - acc[i];
-            if (increase > 0) flux += increase;
-          }
-          const decay = Math.max(0.2, 0.7 - flux * 0.7);
-          for (let i = 0; i < 12; i++) {
-            avgChroma[i] = acc[i] * decay + frameChroma[i] * (1 - decay);
-          }
-        }
-        chromaAccumulatorRef.current = avgChroma;
-
-        // Adaptive decay accumulator for bass chroma (same logic)
-        const bassAcc = bassChromaAccumulatorRef.current;
-        const avgBassChroma = new Array(12);
-
-        if (bassAcc === null) {
-          for (let i = 0; i < 12; i++) avgBassChroma[i] = frameBassChroma[i];
-        } else {
-          let bassFlux = 0;
-          for (let i = 0; i < 12; i++) {
-            const increase = frameBassChroma[i] - bassAcc[i];
-            if (increase > 0) bassFlux += increase;
-          }
-          const bassDecay = Math.max(0.2, 0.7 - bassFlux * 0.7);
-          for (let i = 0; i < 12; i++) {
-            avgBassChroma[i] = bassAcc[i] * bassDecay + frameBassChroma[i] * (1 - bassDecay);
-          }
-        }
-        bassChromaAccumulatorRef.current = avgBassChroma;
-
-        framesAccumulatedRef.current++;
-
-        // Wait for accumulator to warm up (~3 frames / ~192ms)
-        if (framesAccumulatedRef.current < 3) return;
-
-        // Normalize full chroma for classification
-        const maxVal = Math.max(...avgChroma);
-        const classChroma = new Array(12);
-        if (maxVal > 0) {
-          for (let i = 0; i < 12; i++) classChroma[i] = avgChroma[i] / maxVal;
-        } else {
-          for (let i = 0; i < 12; i++) classChroma[i] = 0;
-        }
-
-        // Normalize bass chroma separately
-        const bassMaxVal = Math.max(...avgBassChroma);
-        const classBassChroma = new Array(12);
-        if (bassMaxVal > 0) {
-          for (let i = 0; i < 12; i++) classBassChroma[i] = avgBassChroma[i] / bassMaxVal;
-        } else {
-          for (let i = 0; i < 12; i++) classBassChroma[i] = 0;
-        }
-
-        // ML inference on a separate cadence (~every 4 analysis frames)
+        // ML inference on a separate cadence (~every 4 analysis frames,
+        // stretched by the native schedule under load)
         mlFrameCountRef.current++;
         if (
           mlReadyRef.current &&
           !mlInferenceInProgressRef.current &&
-          mlFrameCountRef.current >= 4
+          mlFrameCountRef.current >= CONFIG.ML_FRAME_INTERVAL * mlStrideRef.current
         ) {
           mlFrameCountRef.current = 0;
           // 1.5 second window — captures more arpeggio notes (~61 mel frames) [F1]
           const mlWindowSize = Math.floor(sampleRate * 1.5);
-          const mlBuffer = new Float32Array(mlWindowSize);
-          const mlStart =
-            (bufferWriteIndexRef.current - mlWindowSize + ringSize) % ringSize;
-          for (let i = 0; i < mlWindowSize; i++) {
-            mlBuffer[i] = ringBuffer[(mlStart + i) % ringSize] * gain;
-          }
-          runMLInference(mlBuffer, sampleRate).then((mlResult) => {
+          runMLInference(mlWindowSize, sampleRate).then((mlResult) => {
+            // The native chord tracker fuses it with the chroma result
             if (mlResult && mlResult.confidence > 0.5) {
-              mlLastResultRef.current = mlResult;
+              const chord = mlChordRef.current;
+              analyzerRef.current?.setChordHint(chord[0], chord[1], mlResult.confidence);
             }
           });
         }
+      } catch (err) {
+        console.error("[ChordDetection] Processing error:", err);
+      }
+    },
+    [runMLInference]
+  );
+
+  // Chord decisions are native (one per onset segment, see
+  // handleChordEvents); JS keeps the segment chroma only for the
+  // alternatives
+  const processSegment = useCallback((segment: Float32Array) => {
+    lastSegmentChromaRef.current = Array.from(segment.subarray(0, 12));
+  }, []);
+
+  // Native chord events, at most one batch per UI frame: a new smoothed
+  // chord, or its confidence leaving CONFIG.CONFIDENCE_BAND. Held chords
+  // cause no state updates at all.
+  const handleChordEvents = useCallback(
+    (events: number[]) => {
+      try {
+        if (events.length < CHORD_EVENT_SIZE) return;
+        let latest: Omit<ChordResult, "chroma"> | null = null;
+        for (let e = 0; e + CHORD_EVENT_SIZE <= events.length; e += CHORD_EVENT_SIZE) {
+          // root -1: N/C, which the timeline leaves out
+          if (events[e + 1] < 0) {
+            latest = null;
+            continue;
+          }
+          const chord = chordFromNative(events, e + 1);
+          updateTimeline(chord, events[e + 4] === 1);
+          latest = chord;
+        }
+
+        // Silence or lasting noise ends the chord with a single N/C event,
+        // and the tracker stays quiet until the next chord
+        if (!latest) {
+          const last = events.length - CHORD_EVENT_SIZE;
+          setCurrentChord("N/C");
+          setCurrentConfidence(events[last + 3]);
+          setAlternatives((prev) => (prev.length === 0 ? prev : []));
+          return;
+        }
+
+        setCurrentChord(latest.chord);
+        setCurrentConfidence(latest.confidence);
 
-        // Two-stage chord classification (ChordAI-inspired):
-        // Stage 1: Root detection from bass
-        // Stage 2: Quality detection given root
-        const previousRoot = chordSmootherRef.current.getCurrentRoot() || undefined;
-        const rawResult = classifyChromaTwoStage(classChroma, classBassChroma, previousRoot);
-
-        // Debug logging
-        const noteNames = ['C', 'C#', 'D', 'D#', 'E', 'F', 'F#', 'G', 'G#', 'A', 'A#', 'B'];
-        const chromaStr = classChroma.map((v: number, i: number) =>
-          v > 0.2 ? `${noteNames[i]}:${v.toFixed(2)}` : null
-        ).filter(Boolean).join(' ');
-        const bassStr = classBassChroma.map((v: number, i: number) =>
-          v > 0.2 ? `${noteNames[i]}:${v.toFixed(2)}` : null
-        ).filter(Boolean).join(' ');
-        console.log(`[2Stage] ${chromaStr} | Bass: ${bassStr} → ${rawResult.chord} (${(rawResult.confidence * 100).toFixed(0)}%)`);
-
-        // Fuse ML result: boost confidence when ML agrees, or defer to
-        // high-confidence ML when chroma is uncertain
-        const mlResult = mlLastResultRef.current;
-        if (mlResult) {
-          if (mlResult.chord === rawResult.chord) {
-            rawResult.confidence = Math.min(1, rawResult.confidence * 1.15);
-          } else if (
-            mlResult.confidence > 0.8 &&
-            rawResult.confidence < 0.5
-          ) {
-            rawResult.chord = mlResult.chord;
-            rawResult.root = mlResult.root;
-            rawResult.quality = mlResult.quality;
-            rawResult.confidence = mlResult.confidence;
+        // Once the running key is clear (the native key prior uses it too)
+        const key = analyzerRef.current?.getKey();
+        if (key && key[0] >= 0 && key[3] >= CONFIG.KEY_MIN_MARGIN) {
+          const keyName = PITCH_NAMES[key[0]] + (key[1] === 1 ? "m" : "");
+          if (keyName !== currentKeyRef.current) {
+            currentKeyRef.current = keyName;
+            setCurrentKey(keyName);
           }
         }
 
-        // Sequence context: temporal voting with bass consensus [F5]
-        const contextResult = sequenceContextRef.current.process(rawResult, classBassChroma);
+        // Alternative chords (2 runners-up with distinct names)
+        const chroma = lastSegmentChromaRef.current;
+        if (chroma) {
+          const alts: ChordResult[] = [];
+          for (const candidate of classifyChromaTopN(chroma, 5)) {
+            if (candidate.chord === latest.chord) continue;
+            alts.push(candidate);
+            if (alts.length >= 2) break;
+          }
+          setAlternatives(alts);
+        }
+      } catch (err) {
+        console.error("[ChordDetection] Chord event error:", err);
+      }
+    },
+    [updateTimeline]
+  );
 
-        // Onset-aware smoothing [F3]
-        const smoothed = chordSmootherRef.current.process(contextResult, isOnset, onsetStrength);
+  const processAudioBuffer = useCallback(
+    (samples: Float32Array, sampleRate: number) => {
+      const analyzer = analyzerRef.current;
+      if (!analyzer) return;
 
-        setCurrentChord(smoothed.smoothedChord);
-        setCurrentConfidence(smoothed.confidence);
-        updateTimeline(smoothed);
+      try {
+        // The native side reads whole ArrayBuffers, so copy views first
+        const chunk =
+          samples.byteOffset === 0 && samples.byteLength === samples.buffer.byteLength
+            ? samples
+            : samples.slice();
+        analyzer.pushSamples(chunk.buffer as ArrayBuffer);
+
+        const frames = frameOutputRef.current;
+        const count = analyzer.pullFrames(frames.buffer as ArrayBuffer);
+        // [level, chromaStride, melStride, load]
+        mlStrideRef.current = analyzer.getSchedule()[2];
+        for (let f = 0; f < count; f++) {
+          processFrame(
+            frames.subarray(f * STREAM_FRAME_SIZE, (f + 1) * STREAM_FRAME_SIZE),
+            sampleRate
+          );
+        }
 
-        // Compute alternative chords (2 runners-up with distinct names)
-        const topN = classifyChromaTopN(classChroma, 5);
-        const alts: ChordResult[] = [];
-        for (const candidate of topN) {
-          if (candidate.chord === smoothed.smoothedChord) continue;
-          alts.push(candidate);
-          if (alts.length >= 2) break;
+        const segments = segmentOutputRef.current;
+        const segmentCount = analyzer.pullSegments(segments.buffer as ArrayBuffer);
+        for (let s = 0; s < segmentCount; s++) {
+          processSegment(
+            segments.subarray(s * STREAM_SEGMENT_SIZE, (s + 1) * STREAM_SEGMENT_SIZE)
+          );
         }
-        setAlternatives(alts);
       } catch (err) {
         console.error("[ChordDetection] Processing error:", err);
       }
     },
-    [runMLInference, updateTimeline]
+    [processFrame, processSegment]
   );
 
   const handleStart = useCallback(async () => {
@@ -509,7 +508,6 @@ export function ChordDetection({
     try {
       setError(null);
       isStartedRef.current = true;
-      chordSmootherRef.current.reset();
 
       AudioManager.setAudioSessionOptions({
         iosCategory: "playAndRecord",
@@ -526,15 +524,10 @@ export function ChordDetection({
         return;
       }
 
-      audioBufferRef.current = new Float32Array(CONFIG.RING_BUFFER_SIZE);
-      bufferWriteIndexRef.current = 0;
-      samplesSinceLastAnalysisRef.current = 0;
-      chromaAccumulatorRef.current = null;
-      bassChromaAccumulatorRef.current = null;
-      framesAccumulatedRef.current = 0;
       mlFrameCountRef.current = 0;
-      mlLastResultRef.current = null;
-      sequenceContextRef.current.reset();
+      lastSegmentChromaRef.current = null;
+      currentKeyRef.current = null;
+      setCurrentKey(null);
 
       audioContextRef.current = new AudioContext({
         sampleRate: CONFIG.SAMPLE_RATE,
@@ -542,14 +535,55 @@ export function ChordDetection({
 
       const actualSampleRate = audioContextRef.current.sampleRate;
 
-      // Initialize aubio onset detector [F3]
-      try {
-        ChordDSP.initOnsetDetector(actualSampleRate, CONFIG.FFT_SIZE, CONFIG.HOP_SIZE);
-        onsetInitializedRef.current = true;
-      } catch (e) {
-        console.warn("[ChordDetection] Onset detector init failed:", e);
-        onsetInitializedRef.current = false;
+      // Native streaming analyzer: audio ring, hop scheduling, gain/RMS gate
+      // and the aubio onset detector [F3]. Also builds FFT plans up front.
+      if (!analyzerRef.current) {
+        analyzerRef.current = createStreamingChordAnalyzer();
       }
+      analyzerRef.current.configure(
+        actualSampleRate,
+        CONFIG.HOP_SIZE,
+        CONFIG.RING_BUFFER_SIZE,
+        CONFIG.INPUT_GAIN,
+        CONFIG.MIN_RMS_THRESHOLD
+      );
+      analyzerRef.current.setPreFilter(
+        CONFIG.PRE_FILTER_DC_HZ,
+        CONFIG.PRE_FILTER_HIGH_PASS_HZ,
+        0
+      );
+      analyzerRef.current.setOnsetParameters(
+        CONFIG.ONSET_THRESHOLD,
+        CONFIG.ONSET_SILENCE_DB,
+        CONFIG.ONSET_MIN_IOI_MS
+      );
+      // Harmonic part of each hop's spectrum feeds chroma, percussive part the onsets
+      analyzerRef.current.setHarmonicPercussive(true);
+      // Follow guitars tuned away from A440 instead of smearing chroma across semitones
+      analyzerRef.current.setTuningEstimation(true);
+      // Chroma from interpolated spectral peaks only, not the noise floor between partials
+      analyzerRef.current.setPeakChroma(true);
+      analyzerRef.current.setChangeGate(CONFIG.CHANGE_TOLERANCE, CONFIG.MAX_HELD_HOPS);
+      // Fold chroma and run ML less often when hops take too long or pile up
+      analyzerRef.current.setAdaptiveScheduling(true);
+      // Bass chroma from an 8192-point FFT every few hops, onsets stay per hop
+      analyzerRef.current.setBassInterval(CONFIG.BASS_FFT_INTERVAL);
+      analyzerRef.current.setKeyEstimation(true, CONFIG.KEY_HALF_LIFE_SECONDS);
+      analyzerRef.current.setOnsetSegments(
+        true,
+        CONFIG.MIN_SEGMENT_SECONDS,
+        CONFIG.MAX_SEGMENT_SECONDS
+      );
+      // Chord per segment, ML hint fusion, key prior and smoothing run
+      // natively; React only hears about chord changes
+      analyzerRef.current.startChordEvents(
+        CONFIG.SMOOTHER_MIN_HOLD_MS,
+        CONFIG.SMOOTHER_CONFIRM_FRAMES,
+        CONFIG.SMOOTHER_HYSTERESIS,
+        CONFIG.CONFIDENCE_BAND,
+        CONFIG.CHORD_EVENT_INTERVAL_MS,
+        handleChordEvents
+      );
       audioRecorderRef.current = new AudioRecorder();
 
       audioRecorderRef.current.onError((error) => {
@@ -580,7 +614,7 @@ export function ChordDetection({
       setError(err.message || "Failed to start");
       isStartedRef.current = false;
     }
-  }, [processAudioBuffer]);
+  }, [processAudioBuffer, handleChordEvents]);
 
   const handleStop = useCallback(async () => {
     if (!isStartedRef.current) return;
@@ -592,6 +626,8 @@ export function ChordDetection({
         audioRecorderRef.current.stop();
         audioRecorderRef.current = null;
       }
+      // No batch may arrive after the timeline stopped
+      analyzerRef.current?.stopChordEvents();
 
       if (audioContextRef.current) {
         await audioContextRef.current.close();
@@ -702,6 +738,7 @@ export function ChordDetection({
             </View>
             <Text style={styles.pipelineLabel}>
               {mlReady ? "ML + Native DSP" : "Native DSP"}
+              {currentKey ? ` · Key: ${currentKey}` : ""}
             </Text>
           </>
         )}
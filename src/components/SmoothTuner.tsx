@@ -20,7 +20,6 @@ import {
   AppStateStatus,
 } from "react-native";
 import ExpoAudioStudio from "expo-audio-studio";
-import Pitchfinder from "pitchfinder";
 import { AudioChunkEvent } from "expo-audio-studio/build/types";
 
 import { SmoothTunerDisplay } from "./SmoothTunerDisplay";
@@ -30,9 +29,11 @@ import {
   type StabilizedPitch,
 } from "../hooks/usePitchStabilization";
 import {
-  enhancePitchfinderResult,
   frequencyToNoteInfo,
+  pitchTrackerResult,
+  PITCH_TRACKER_RESULT_SIZE,
 } from "../utils/enhancedPitchDetection";
+import { createPitchTracker, type PitchTracker } from "chord-dsp";
 
 // ============================================================================
 // CONFIGURATION
@@ -114,10 +115,9 @@ export function SmoothTuner() {
   );
   const bufferWriteIndexRef = useRef(0);
 
-  // Pitch detector
-  const detectPitchRef = useRef<ReturnType<typeof Pitchfinder.YIN> | null>(
-    null
-  );
+  // Pitch detector (native YIN) and its reusable result buffer
+  const pitchTrackerRef = useRef<PitchTracker | null>(null);
+  const pitchResultRef = useRef(new Float32Array(PITCH_TRACKER_RESULT_SIZE));
 
   // Inactivity timeout
   const inactivityTimeoutRef = useRef<NodeJS.Timeout | null>(null);
@@ -168,10 +168,14 @@ export function SmoothTuner() {
         await ExpoAudioStudio.activateAudioSession();
 
         // Initialize YIN pitch detector
-        detectPitchRef.current = Pitchfinder.YIN({
-          sampleRate: CONFIG.SAMPLE_RATE,
-          threshold: CONFIG.YIN_THRESHOLD,
-        });
+        if (!pitchTrackerRef.current) {
+          pitchTrackerRef.current = createPitchTracker();
+        }
+        pitchTrackerRef.current.configure(
+          CONFIG.SAMPLE_RATE,
+          CONFIG.BUFFER_SIZE,
+          CONFIG.YIN_THRESHOLD
+        );
 
         // Enable chunk listening
         ExpoAudioStudio.setListenToChunks(true);
@@ -228,7 +232,8 @@ export function SmoothTuner() {
 
   const processAudioChunk = useCallback(
     (event: AudioChunkEvent) => {
-      if (!detectPitchRef.current || !event.base64) {
+      const pitchTracker = pitchTrackerRef.current;
+      if (!pitchTracker || !event.base64) {
         return;
       }
 
@@ -273,17 +278,17 @@ export function SmoothTuner() {
         // ============================================================
         // STEP 3: Run pitch detection
         // ============================================================
-        // The pitch detector (YIN) returns null if it can't find a valid pitch
-        const rawFrequency = detectPitchRef.current(analysisBuffer);
+        // The native YIN tracker reports whether it found a valid pitch
+        const pitchResult = pitchResultRef.current;
+        const found = pitchTracker.detectInto(
+          analysisBuffer.buffer as ArrayBuffer,
+          pitchResult.buffer as ArrayBuffer
+        );
 
         // ============================================================
-        // STEP 4: Enhance with confidence and jitter metrics
+        // STEP 4: Read confidence and jitter metrics
         // ============================================================
-        const enhanced = enhancePitchfinderResult(
-          rawFrequency,
-          analysisBuffer,
-          CONFIG.SAMPLE_RATE
-        );
+        const enhanced = pitchTrackerResult(found, pitchResult);
 
         // ============================================================
         // STEP 5: Validate frequency range
@@ -88,6 +88,9 @@ const TRANSITION_PLAUSIBILITY = [
   0.65, // 11: M7
 ];
 
+// Quality names in the native ChordClassifier's template order
+const NATIVE_QUALITIES = Object.keys(CHORD_TEMPLATES);
+
 export interface ChordResult {
   chord: string; // e.g. "Am7", "C", "G7"
   root: string; // e.g. "A", "C", "G"
@@ -728,6 +731,27 @@ export function classifyChromaTopN(chroma: number[], n: number): ChordResult[] {
   return results;
 }
 
+/**
+ * Label of a native ChordClassifier [root, quality, confidence] triplet.
+ *
+ * @param output - Values written by a ChordClassifier *Into() call, or a
+ *   StreamingChordAnalyzer chord event
+ * @param offset - Index of the triplet in `output`
+ */
+export function chordFromNative(
+  output: ArrayLike<number>,
+  offset: number = 0
+): Omit<ChordResult, "chroma"> {
+  const root = NOTE_NAMES[output[offset]];
+  const quality = NATIVE_QUALITIES[output[offset + 1]];
+  return {
+    chord: `${root}${QUALITY_DISPLAY[quality] ?? quality}`,
+    root,
+    quality,
+    confidence: output[offset + 2],
+  };
+}
+
 /**
  * Classify BasicPitch note activations for a single frame.
  *
@@ -455,6 +455,42 @@ export function detectPitchEnhanced(
   };
 }
 
+// ============================================================================
+// NATIVE PITCH TRACKER
+// ============================================================================
+
+/** Floats PitchTracker.detectInto() (chord-dsp) writes. */
+export const PITCH_TRACKER_RESULT_SIZE = 5;
+
+/**
+ * Reads PitchTracker.detectInto()'s [frequency, probability, autocorrPeak,
+ * confidence, jitter] output. The native tracker runs YIN and the
+ * enhancePitchfinderResult() metrics below in one call.
+ */
+export function pitchTrackerResult(
+  found: boolean,
+  output: Float32Array
+): EnhancedPitchResult {
+  if (!found) {
+    return {
+      frequency: null,
+      confidence: 0,
+      autocorrPeak: 0,
+      jitter: 0,
+      rawFrequency: null,
+      octaveCorrected: false,
+    };
+  }
+  return {
+    frequency: output[0],
+    confidence: output[3],
+    autocorrPeak: output[2],
+    jitter: output[4],
+    rawFrequency: output[0],
+    octaveCorrected: false,
+  };
+}
+
 // ============================================================================
 // WRAPPER FOR PITCHFINDER INTEGRATION
 // ============================================================================